@@ -0,0 +1,534 @@
+// Micro benchmarks of editor internals, compiled together with main.c
+// so they exercise exactly the code the editor runs.
+#define E_NO_MAIN
+#include "main.c"
+
+typedef struct Bench {
+  const char *name;
+  void (*run)(void);
+} Bench;
+
+// guards against the compiler dropping benchmark loops
+volatile Uint64 benchSink;
+
+Uint32 benchRandom(Uint32 *state) {
+  *state = *state * 1664525u + 1013904223u;
+  return *state >> 8;
+}
+
+void reportBench(const char *name, Uint64 ops, Uint64 start, Uint64 end) {
+  double ns = (end - start) * 1e9 / SDL_GetPerformanceFrequency();
+  printf("%-32s %10" PRIu64 " ops %10.2f ns/op\n", name, ops, ns / ops);
+}
+
+void benchKeyHandler(E *e) {
+  benchSink++;
+}
+
+enum {
+  BENCH_KEY_BINDINGS = 1000,
+  BENCH_KEY_LOOKUPS = 10 * 1000 * 1000,
+};
+
+// 1000 single key bindings spread over printable syms and modifier combinations,
+// dispatched through handleKey and through the linear scan with loose modifier
+// matching the key trie used before
+void benchKeyDispatch(void) {
+  static E e;
+  Uint16 mods[] = {KMOD_LCTRL, KMOD_LALT, KMOD_LCTRL | KMOD_LALT, KMOD_LCTRL | KMOD_LSHIFT,
+                   KMOD_LALT | KMOD_LSHIFT, KMOD_LGUI, KMOD_LGUI | KMOD_LCTRL, KMOD_LGUI | KMOD_LALT,
+                   KMOD_LGUI | KMOD_LSHIFT, KMOD_LCTRL | KMOD_LALT | KMOD_LSHIFT, KMOD_LGUI | KMOD_LCTRL | KMOD_LALT};
+  E_Key *linearKeys = 0;
+  SDL_Keysym *keysyms = 0;
+  for (size_t m = 0; m < SDL_arraysize(mods) && buf_len(keysyms) < BENCH_KEY_BINDINGS; m++) {
+    for (SDL_Keycode sym = '!'; sym <= '~' && buf_len(keysyms) < BENCH_KEY_BINDINGS; sym++) {
+      E_Key key = {.sym = sym, .mod = mods[m], .hasMoreKeys = true};
+      installKeySequence(&e, &key, 1, benchKeyHandler);
+      key.hasMoreKeys = false;
+      key.handler = benchKeyHandler;
+      buf_push(linearKeys, key);
+      buf_push(keysyms, ((SDL_Keysym){.sym = sym, .mod = mods[m]}));
+    }
+  }
+  e.curKeys = e.rootKeys;
+  size_t bindingCount = buf_len(keysyms);
+
+  SDL_Keysym *lookups = xalloc(BENCH_KEY_LOOKUPS * sizeof(SDL_Keysym));
+  Uint32 random = 42;
+  for (size_t i = 0; i < BENCH_KEY_LOOKUPS; i++) {
+    lookups[i] = keysyms[benchRandom(&random) % bindingCount];
+  }
+
+  Uint64 t0 = SDL_GetPerformanceCounter();
+  for (size_t i = 0; i < BENCH_KEY_LOOKUPS; i++) {
+    handleKey(&e, lookups[i]);
+  }
+  Uint64 t1 = SDL_GetPerformanceCounter();
+  reportBench("keyDispatch.hash", BENCH_KEY_LOOKUPS, t0, t1);
+
+  t0 = SDL_GetPerformanceCounter();
+  for (size_t i = 0; i < BENCH_KEY_LOOKUPS; i++) {
+    SDL_Keysym key = lookups[i];
+    for (size_t j = 0; j < bindingCount; j++) {
+      E_Key k = linearKeys[j];
+      if (k.sym == key.sym && (k.mod == key.mod || k.mod & key.mod)) {
+        k.handler(&e);
+        break;
+      }
+    }
+  }
+  t1 = SDL_GetPerformanceCounter();
+  reportBench("keyDispatch.linear", BENCH_KEY_LOOKUPS, t0, t1);
+
+  free(lookups);
+  buf_free(keysyms);
+  buf_free(linearKeys);
+}
+
+// editor over a generated file rendered into an offscreen surface,
+// writeText fills the file
+void initBenchEditorWith(E *e, void (*writeText)(FILE *file, size_t n), size_t n) {
+  char path[] = "/tmp/e-bench-XXXXXX";
+  int fd = mkstemp(path);
+  FILE *file = fd >= 0 ? fdopen(fd, "w") : 0;
+  if (!file) {
+    die("Failed to create bench file");
+  }
+  writeText(file, n);
+  fclose(file);
+  char *paths[] = {path};
+  *e = init(paths, 1);
+  remove(path);
+  if (!initHeadlessUI(e)) {
+    die((char *) e->error);
+  }
+}
+
+void writeBenchLines(FILE *file, size_t lineCount) {
+  for (size_t i = 0; i < lineCount; i++) {
+    fprintf(file, "  line %zu: the quick brown fox jumps over the lazy dog\n", i);
+  }
+}
+
+// editor over a generated file of lineCount lines
+void initBenchEditor(E *e, size_t lineCount) {
+  initBenchEditorWith(e, writeBenchLines, lineCount);
+}
+
+enum {
+  BENCH_MACRO_LINES = 100 * 1000,
+  BENCH_MACRO_REPEATS = 10 * 1000,
+};
+
+// C-x ( C-e ; C-n C-a C-x ) replayed 10k times over a 100k line file
+void benchMacroReplay(void) {
+  static E e;
+  initBenchEditor(&e, BENCH_MACRO_LINES);
+  buf_push(e.macro.steps, ((MacroStep){.handler = moveToEndOfLine}));
+  buf_push(e.macro.steps, ((MacroStep){.c = ';'}));
+  buf_push(e.macro.steps, ((MacroStep){.handler = moveLineDown}));
+  buf_push(e.macro.steps, ((MacroStep){.handler = moveToStartOfLine}));
+  e.prefixArg = BENCH_MACRO_REPEATS;
+  Uint64 t0 = SDL_GetPerformanceCounter();
+  executeMacro(&e);
+  updateUI(&e);
+  Uint64 t1 = SDL_GetPerformanceCounter();
+  reportBench("macroReplay", BENCH_MACRO_REPEATS, t0, t1);
+  closeEditor(&e);
+}
+
+enum {
+  BENCH_LONG_LINE_SIZE = 16 * 1024 * 1024,
+  BENCH_LONG_LINE_FRAMES = 1000,
+};
+
+// two lines of minified JSON separated by a short one
+void writeBenchLongLines(FILE *file, size_t lineSize) {
+  for (int line = 0; line < 2; line++) {
+    for (size_t size = 0; size < lineSize;) {
+      size += fprintf(file, "{\"id\":%zu,\"name\":\"item\",\"tags\":[\"a\",\"b\"]},", size);
+    }
+    fprintf(file, "\n}\n");
+  }
+}
+
+// frames rendered at the end of a 16 MB line, each moving the cursor to the
+// other long line and back at the same x
+void benchLongLine(void) {
+  static E e;
+  initBenchEditorWith(&e, writeBenchLongLines, BENCH_LONG_LINE_SIZE);
+  Uint64 t0 = SDL_GetPerformanceCounter();
+  moveToEndOfLine(&e);
+  updateUI(&e);
+  Uint64 t1 = SDL_GetPerformanceCounter();
+  reportBench("longLine.firstFrame", 1, t0, t1);
+  t0 = SDL_GetPerformanceCounter();
+  for (int i = 0; i < BENCH_LONG_LINE_FRAMES; i++) {
+    moveLineDown(&e);
+    moveLineDown(&e);
+    moveLineUp(&e);
+    moveLineUp(&e);
+    moveLeft(&e);
+    insertCharAtCursor(&e, ' ');
+    updateUI(&e);
+  }
+  t1 = SDL_GetPerformanceCounter();
+  reportBench("longLine.frame", BENCH_LONG_LINE_FRAMES, t0, t1);
+  benchSink += e.view->cursor;
+  closeEditor(&e);
+}
+
+enum {
+  BENCH_HIGHLIGHT_LINES = 1000 * 1000,
+  BENCH_HIGHLIGHT_EDITS = 10 * 1000,
+};
+
+// lexing a 1M line file, then keystrokes in the middle of it each followed by
+// a frame, every other one opening a comment which changes the state of all
+// lines below
+void benchHighlight(void) {
+  static E e;
+  initBenchEditor(&e, BENCH_HIGHLIGHT_LINES);
+  e.doc->highlight.language = LANGUAGE_C;
+  Uint64 t0 = SDL_GetPerformanceCounter();
+  updateHighlight(e.doc, BENCH_HIGHLIGHT_LINES);
+  Uint64 t1 = SDL_GetPerformanceCounter();
+  reportBench("highlight.full", BENCH_HIGHLIGHT_LINES, t0, t1);
+  for (int i = 0; i < BENCH_HIGHLIGHT_LINES / 2; i++) {
+    moveLineDown(&e);
+  }
+  t0 = SDL_GetPerformanceCounter();
+  for (int i = 0; i < BENCH_HIGHLIGHT_EDITS; i++) {
+    if (i % 2) {
+      deleteCharBackwards(&e);
+      deleteCharBackwards(&e);
+    } else {
+      insertCharAtCursor(&e, '/');
+      insertCharAtCursor(&e, '*');
+    }
+    updateUI(&e);
+  }
+  t1 = SDL_GetPerformanceCounter();
+  reportBench("highlight.edit", BENCH_HIGHLIGHT_EDITS, t0, t1);
+  closeEditor(&e);
+}
+
+enum {
+  BENCH_SYNTAX_FUNCTIONS = 20 * 1000,
+  BENCH_SYNTAX_KEYSTROKES = 10 * 1000,
+};
+
+void writeBenchFunctions(FILE *file, size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    fprintf(file, "int f%zu(int x) {\n  if (x > %zu) {\n    return g(x, a[%zu]);\n  }\n  return 0;\n}\n", i, i, i);
+  }
+}
+
+// parsing a 120k line C file, then typing a call with its brackets in the middle of it
+void benchSyntax(void) {
+  static E e;
+  initBenchEditorWith(&e, writeBenchFunctions, BENCH_SYNTAX_FUNCTIONS);
+  e.doc->highlight.language = LANGUAGE_C;
+  Uint64 t0 = SDL_GetPerformanceCounter();
+  getSyntaxTree(&e);
+  Uint64 t1 = SDL_GetPerformanceCounter();
+  reportBench("syntax.parse", 1, t0, t1);
+  for (int i = 0; i < BENCH_SYNTAX_FUNCTIONS * 6 / 2 + 2; i++) {
+    moveLineDown(&e);
+  }
+  const char *typed = "h(y[1]); ";
+  size_t typedLen = strlen(typed);
+  t0 = SDL_GetPerformanceCounter();
+  for (int i = 0; i < BENCH_SYNTAX_KEYSTROKES; i++) {
+    insertCharAtCursor(&e, typed[i % typedLen]);
+  }
+  t1 = SDL_GetPerformanceCounter();
+  reportBench("syntax.keystroke", BENCH_SYNTAX_KEYSTROKES, t0, t1);
+  t0 = SDL_GetPerformanceCounter();
+  for (int i = 0; i < BENCH_SYNTAX_KEYSTROKES; i++) {
+    if (i % 2) {
+      forwardList(&e);
+    } else {
+      backwardUpList(&e);
+    }
+  }
+  t1 = SDL_GetPerformanceCounter();
+  reportBench("syntax.navigate", BENCH_SYNTAX_KEYSTROKES, t0, t1);
+  closeEditor(&e);
+}
+
+enum {
+  BENCH_BRACKET_FUNCTIONS = 200 * 1000,
+  BENCH_BRACKET_LOOKUPS = 100 * 1000,
+  BENCH_BRACKET_KEYSTROKES = 10 * 1000,
+};
+
+// matching an unclosed '{' at the top of a 1.2M line C file, whose search
+// goes through all lines, then keystrokes with a frame each in the middle
+// of the file typing lines with brackets
+void benchBrackets(void) {
+  static E e;
+  initBenchEditorWith(&e, writeBenchFunctions, BENCH_BRACKET_FUNCTIONS);
+  e.doc->highlight.language = LANGUAGE_C;
+  insertCharAtCursor(&e, '{');
+  moveLeft(&e);
+  Uint64 t0 = SDL_GetPerformanceCounter();
+  updateHighlight(e.doc, SIZE_MAX);
+  Uint64 t1 = SDL_GetPerformanceCounter();
+  reportBench("brackets.index", 1, t0, t1);
+  size_t marked[2];
+  t0 = SDL_GetPerformanceCounter();
+  for (int i = 0; i < BENCH_BRACKET_LOOKUPS; i++) {
+    benchSink += getMarkedBrackets(&e, marked) + marked[0];
+  }
+  t1 = SDL_GetPerformanceCounter();
+  reportBench("brackets.unmatched", BENCH_BRACKET_LOOKUPS, t0, t1);
+  for (int i = 0; i < BENCH_BRACKET_FUNCTIONS * 6 / 2 + 2; i++) {
+    moveLineDown(&e);
+  }
+  const char *typed = "h(y[1]);\n";
+  size_t typedLen = strlen(typed);
+  t0 = SDL_GetPerformanceCounter();
+  for (int i = 0; i < BENCH_BRACKET_KEYSTROKES; i++) {
+    insertCharAtCursor(&e, typed[i % typedLen]);
+    updateUI(&e);
+  }
+  t1 = SDL_GetPerformanceCounter();
+  reportBench("brackets.keystroke", BENCH_BRACKET_KEYSTROKES, t0, t1);
+  closeEditor(&e);
+}
+
+enum {
+  BENCH_GO_TO_LINES = 4 * 1000 * 1000,
+  BENCH_GO_TO_JUMPS = 10 * 1000,
+};
+
+// M-<line> M-g g to random lines of a 4M line file, each followed by a frame.
+// There is no idle time to lex the lines above, so they are shown unhighlighted.
+void benchGoToLine(void) {
+  static E e;
+  initBenchEditor(&e, BENCH_GO_TO_LINES);
+  e.doc->highlight.language = LANGUAGE_C;
+  Uint32 random = 42;
+  Uint64 t0 = SDL_GetPerformanceCounter();
+  for (int i = 0; i < BENCH_GO_TO_JUMPS; i++) {
+    e.prefixArg = benchRandom(&random) % BENCH_GO_TO_LINES + 1;
+    goToLine(&e);
+    updateUI(&e);
+  }
+  Uint64 t1 = SDL_GetPerformanceCounter();
+  reportBench("goToLine", BENCH_GO_TO_JUMPS, t0, t1);
+  benchSink += e.view->cursor;
+  closeEditor(&e);
+}
+
+enum {
+  BENCH_SCROLL_SMALL_LINES = 10 * 1000,
+  BENCH_SCROLL_LARGE_LINES = 1000 * 1000,
+  BENCH_SCROLL_PAGES = 10 * 1000,
+};
+
+// C-v 100 pages down and M-v 100 pages back up, each followed by a frame
+void benchScrollLines(const char *name, size_t lineCount, bool lineNumbers) {
+  static E e;
+  initBenchEditor(&e, lineCount);
+  e.lineNumbers = lineNumbers;
+  updateUI(&e);
+  Uint64 t0 = SDL_GetPerformanceCounter();
+  for (int i = 0; i < BENCH_SCROLL_PAGES; i++) {
+    if (i / 100 % 2) {
+      scrollPageUp(&e);
+    } else {
+      scrollPageDown(&e);
+    }
+    updateUI(&e);
+  }
+  Uint64 t1 = SDL_GetPerformanceCounter();
+  reportBench(name, BENCH_SCROLL_PAGES, t0, t1);
+  benchSink += e.view->cursor;
+  closeEditor(&e);
+}
+
+// frames of a wheel scroll animation moving 7 pixels each
+void benchScrollPixels(const char *name, bool lineCache) {
+  static E e;
+  initBenchEditor(&e, BENCH_SCROLL_LARGE_LINES);
+  e.lineCache.enabled = lineCache;
+  updateUI(&e);
+  Uint64 t0 = SDL_GetPerformanceCounter();
+  for (int i = 0; i < BENCH_SCROLL_PAGES; i++) {
+    scrollViewPixels(&e, 7);
+    updateUI(&e);
+  }
+  Uint64 t1 = SDL_GetPerformanceCounter();
+  reportBench(name, BENCH_SCROLL_PAGES, t0, t1);
+  if (lineCache) {
+    LineCache *cache = &e.lineCache;
+    printf("%-32s %10" PRIu64 " hits %10" PRIu64 " misses\n", name, cache->hits, cache->misses);
+  }
+  benchSink += e.view->cursor;
+  closeEditor(&e);
+}
+
+// the cost of a page doesn't depend on the file size
+void benchScroll(void) {
+  benchScrollLines("scroll.10kLines", BENCH_SCROLL_SMALL_LINES, false);
+  benchScrollLines("scroll.1MLines", BENCH_SCROLL_LARGE_LINES, false);
+  benchScrollPixels("scroll.pixelFrame", false);
+}
+
+// the scroll animation drawing rows from the line cache instead of glyph by glyph,
+// about one row per frame misses
+void benchLineCache(void) {
+  benchScrollPixels("lineCache.pixelFrame", true);
+}
+
+enum {
+  BENCH_FRAMES = 2000,
+};
+
+// Frames scrolled by a line, which change every scanline, and frames moving
+// the cursor, which upload only its rows to the framebuffer texture. Both run
+// on SDL's software renderer of headless mode, drawing with SDL calls or into
+// the framebuffer.
+void benchFrames(const char *name, bool framebuffer) {
+  static E e;
+  initBenchEditor(&e, BENCH_SCROLL_SMALL_LINES);
+  e.framebuffer.enabled = framebuffer;
+  updateUI(&e);
+  char scrollName[64], cursorName[64];
+  snprintf(scrollName, sizeof(scrollName), "%s.scrollFrame", name);
+  snprintf(cursorName, sizeof(cursorName), "%s.cursorFrame", name);
+  Uint64 t0 = SDL_GetPerformanceCounter();
+  for (int i = 0; i < BENCH_FRAMES; i++) {
+    scrollView(&e, 1);
+    updateUI(&e);
+  }
+  Uint64 t1 = SDL_GetPerformanceCounter();
+  reportBench(scrollName, BENCH_FRAMES, t0, t1);
+  for (int i = 0; i < BENCH_FRAMES; i++) {
+    if (i / 10 % 2) {
+      moveLineUp(&e);
+    } else {
+      moveLineDown(&e);
+    }
+    updateUI(&e);
+  }
+  Uint64 t2 = SDL_GetPerformanceCounter();
+  reportBench(cursorName, BENCH_FRAMES, t1, t2);
+  benchSink += e.view->cursor;
+  closeEditor(&e);
+}
+
+void benchFramebuffer(void) {
+  benchFrames("renderer", false);
+  benchFrames("framebuffer", true);
+}
+
+void writeBenchTabLines(FILE *file, size_t lineCount) {
+  for (size_t i = 0; i < lineCount; i++) {
+    fprintf(file, "\t\tcase %zu:\treturn quick(brown, fox);  \r\n", i);
+  }
+}
+
+// frames scrolled by a line over tab indented CRLF lines with trailing spaces,
+// with the markers of all of them shown and with none
+void benchMarkerFrames(const char *name, Uint8 markers) {
+  static E e;
+  initBenchEditorWith(&e, writeBenchTabLines, BENCH_SCROLL_SMALL_LINES);
+  e.markers = markers;
+  updateShownGlyphs(&e);
+  updateUI(&e);
+  Uint64 t0 = SDL_GetPerformanceCounter();
+  for (int i = 0; i < BENCH_FRAMES; i++) {
+    scrollView(&e, 1);
+    updateUI(&e);
+  }
+  Uint64 t1 = SDL_GetPerformanceCounter();
+  reportBench(name, BENCH_FRAMES, t0, t1);
+  benchSink += e.view->cursor;
+  closeEditor(&e);
+}
+
+void benchMarkers(void) {
+  benchMarkerFrames("markers.noneFrame", 0);
+  benchMarkerFrames("markers.allFrame", (1 << MARKER_COUNT) - 1);
+}
+
+enum {
+  BENCH_ZOOM_STEPS = 200,
+};
+
+// Zooming between 10 and 20 points with cached atlases: building on the font
+// thread, and swapping the glyphs in and laying the panes out on the UI thread.
+void benchZoom(void) {
+  static E e;
+  initBenchEditor(&e, BENCH_SCROLL_SMALL_LINES);
+  updateUI(&e);
+  Uint64 buildTicks = 0, applyTicks = 0;
+  for (int i = 0; i < BENCH_ZOOM_STEPS; i++) {
+    FontBuild build = {
+            .fontData = e.fontData,
+            .fontDataSize = e.fontDataSize,
+            .fontSize = 10 + i % 11,
+            .dpi = e.dpi,
+    };
+    Uint64 t0 = SDL_GetPerformanceCounter();
+    if (!buildFont(&build)) {
+      die((char *) build.error);
+    }
+    Uint64 t1 = SDL_GetPerformanceCounter();
+    applyFont(&e, &build);
+    relayoutFont(&e);
+    Uint64 t2 = SDL_GetPerformanceCounter();
+    FontBuild_free(&build);
+    // the first pass fills the cache
+    if (i >= 11) {
+      buildTicks += t1 - t0;
+      applyTicks += t2 - t1;
+    }
+    updateUI(&e);
+  }
+  reportBench("zoom.build", BENCH_ZOOM_STEPS - 11, 0, buildTicks);
+  reportBench("zoom.apply", BENCH_ZOOM_STEPS - 11, 0, applyTicks);
+  benchSink += e.lineHeight;
+  closeEditor(&e);
+}
+
+// pages of a 1M line file with and without the line number gutter
+void benchGutter(void) {
+  benchScrollLines("gutter.off", BENCH_SCROLL_LARGE_LINES, false);
+  benchScrollLines("gutter.on", BENCH_SCROLL_LARGE_LINES, true);
+}
+
+Bench benches[] = {
+        {"keyDispatch", benchKeyDispatch},
+        {"macroReplay", benchMacroReplay},
+        {"longLine", benchLongLine},
+        {"highlight", benchHighlight},
+        {"syntax", benchSyntax},
+        {"brackets", benchBrackets},
+        {"goToLine", benchGoToLine},
+        {"scroll", benchScroll},
+        {"lineCache", benchLineCache},
+        {"framebuffer", benchFramebuffer},
+        {"zoom", benchZoom},
+        {"markers", benchMarkers},
+        {"gutter", benchGutter},
+};
+
+int main(int argc, char **argv) {
+  // run all benchmarks or only the ones named on the command line
+  for (size_t i = 0; i < SDL_arraysize(benches); i++) {
+    bool selected = argc == 1;
+    for (int j = 1; j < argc; j++) {
+      if (strcmp(argv[j], benches[i].name) == 0) {
+        selected = true;
+      }
+    }
+    if (selected) {
+      benches[i].run();
+    }
+  }
+  return EXIT_SUCCESS;
+}
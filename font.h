@@ -1,17419 +0,0 @@
-unsigned char font[] = {
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x12, 0x01, 0x00,
-    0x00, 0x04, 0x00, 0x20, 0x44, 0x53, 0x49, 0x47,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x20, 0x3c,
-    0x00, 0x00, 0x00, 0x08, 0x47, 0x44, 0x45, 0x46,
-    0x00, 0x0f, 0x00, 0x6a, 0x00, 0x00, 0x01, 0x2c,
-    0x00, 0x00, 0x00, 0x14, 0x47, 0x50, 0x4f, 0x53,
-    0x00, 0x19, 0x00, 0x0c, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x10, 0x47, 0x53, 0x55, 0x42,
-    0x91, 0x19, 0xcb, 0x64, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x75, 0xce, 0x4f, 0x53, 0x2f, 0x32,
-    0x33, 0xb5, 0xd2, 0xb7, 0x00, 0x00, 0x77, 0x20,
-    0x00, 0x00, 0x00, 0x60, 0x63, 0x6d, 0x61, 0x70,
-    0x61, 0xb0, 0x11, 0x95, 0x00, 0x00, 0x77, 0x80,
-    0x00, 0x00, 0x07, 0x68, 0x63, 0x76, 0x74, 0x20,
-    0x38, 0xbc, 0x0e, 0x63, 0x00, 0x02, 0x10, 0xa0,
-    0x00, 0x00, 0x00, 0xc4, 0x66, 0x70, 0x67, 0x6d,
-    0x50, 0xc0, 0xfc, 0x3c, 0x00, 0x02, 0x11, 0x64,
-    0x00, 0x00, 0x0d, 0xfd, 0x67, 0x61, 0x73, 0x70,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x02, 0x10, 0x98,
-    0x00, 0x00, 0x00, 0x08, 0x67, 0x6c, 0x79, 0x66,
-    0x64, 0xf9, 0xbb, 0xa6, 0x00, 0x00, 0x7e, 0xe8,
-    0x00, 0x01, 0x62, 0x56, 0x68, 0x65, 0x61, 0x64,
-    0x0f, 0x61, 0x5a, 0x78, 0x00, 0x01, 0xe1, 0x40,
-    0x00, 0x00, 0x00, 0x36, 0x68, 0x68, 0x65, 0x61,
-    0x01, 0x39, 0x05, 0xfe, 0x00, 0x01, 0xe1, 0x78,
-    0x00, 0x00, 0x00, 0x24, 0x68, 0x6d, 0x74, 0x78,
-    0xc1, 0x5e, 0x18, 0x5a, 0x00, 0x01, 0xe1, 0x9c,
-    0x00, 0x00, 0x09, 0xf4, 0x6c, 0x6f, 0x63, 0x61,
-    0x2a, 0x93, 0xcf, 0x74, 0x00, 0x01, 0xeb, 0x90,
-    0x00, 0x00, 0x05, 0x06, 0x6d, 0x61, 0x78, 0x70,
-    0x04, 0x85, 0x10, 0x36, 0x00, 0x01, 0xf0, 0x98,
-    0x00, 0x00, 0x00, 0x20, 0x6e, 0x61, 0x6d, 0x65,
-    0x73, 0xfe, 0x57, 0x50, 0x00, 0x01, 0xf0, 0xb8,
-    0x00, 0x00, 0x06, 0x3f, 0x70, 0x6f, 0x73, 0x74,
-    0x7a, 0x04, 0x8b, 0x54, 0x00, 0x01, 0xf6, 0xf8,
-    0x00, 0x00, 0x19, 0xa0, 0x70, 0x72, 0x65, 0x70,
-    0x20, 0xe5, 0xa6, 0x3c, 0x00, 0x02, 0x1f, 0x64,
-    0x00, 0x00, 0x00, 0xd6, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x68, 0x00, 0x01, 0x00, 0x02,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x0c,
-    0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x34,
-    0x02, 0x8a, 0x00, 0x02, 0x44, 0x46, 0x4c, 0x54,
-    0x00, 0x0e, 0x6c, 0x61, 0x74, 0x6e, 0x00, 0x1c,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-    0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x02,
-    0x00, 0x01, 0x00, 0x03, 0x00, 0x04, 0x63, 0x61,
-    0x6c, 0x74, 0x00, 0x1a, 0x63, 0x61, 0x6c, 0x74,
-    0x01, 0x32, 0x7a, 0x65, 0x72, 0x6f, 0x02, 0x4a,
-    0x7a, 0x65, 0x72, 0x6f, 0x02, 0x50, 0x00, 0x00,
-    0x00, 0x8a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02,
-    0x00, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06,
-    0x00, 0x07, 0x00, 0x08, 0x00, 0x09, 0x00, 0x0a,
-    0x00, 0x0b, 0x00, 0x0c, 0x00, 0x0d, 0x00, 0x0e,
-    0x00, 0x0f, 0x00, 0x10, 0x00, 0x11, 0x00, 0x12,
-    0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16,
-    0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1a,
-    0x00, 0x1b, 0x00, 0x1c, 0x00, 0x1d, 0x00, 0x1e,
-    0x00, 0x1f, 0x00, 0x20, 0x00, 0x21, 0x00, 0x22,
-    0x00, 0x23, 0x00, 0x24, 0x00, 0x25, 0x00, 0x26,
-    0x00, 0x27, 0x00, 0x28, 0x00, 0x29, 0x00, 0x2a,
-    0x00, 0x2b, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x2e,
-    0x00, 0x2f, 0x00, 0x30, 0x00, 0x31, 0x00, 0x32,
-    0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36,
-    0x00, 0x37, 0x00, 0x38, 0x00, 0x39, 0x00, 0x3a,
-    0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3e,
-    0x00, 0x3f, 0x00, 0x40, 0x00, 0x41, 0x00, 0x42,
-    0x00, 0x43, 0x00, 0x44, 0x00, 0x45, 0x00, 0x46,
-    0x00, 0x47, 0x00, 0x48, 0x00, 0x49, 0x00, 0x4a,
-    0x00, 0x4b, 0x00, 0x4c, 0x00, 0x4d, 0x00, 0x4e,
-    0x00, 0x4f, 0x00, 0x50, 0x00, 0x51, 0x00, 0x52,
-    0x00, 0x53, 0x00, 0x54, 0x00, 0x55, 0x00, 0x56,
-    0x00, 0x57, 0x00, 0x58, 0x00, 0x59, 0x00, 0x5a,
-    0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5d, 0x00, 0x5e,
-    0x00, 0x5f, 0x00, 0x60, 0x00, 0x61, 0x00, 0x62,
-    0x00, 0x63, 0x00, 0x64, 0x00, 0x65, 0x00, 0x66,
-    0x00, 0x67, 0x00, 0x68, 0x00, 0x69, 0x00, 0x6a,
-    0x00, 0x6b, 0x00, 0x6c, 0x00, 0x6d, 0x00, 0x6e,
-    0x00, 0x6f, 0x00, 0x70, 0x00, 0x71, 0x00, 0x72,
-    0x00, 0x73, 0x00, 0x74, 0x00, 0x75, 0x00, 0x76,
-    0x00, 0x77, 0x00, 0x78, 0x00, 0x79, 0x00, 0x7a,
-    0x00, 0x7b, 0x00, 0x7c, 0x00, 0x7d, 0x00, 0x7e,
-    0x00, 0x7f, 0x00, 0x80, 0x00, 0x81, 0x00, 0x82,
-    0x00, 0x83, 0x00, 0x84, 0x00, 0x85, 0x00, 0x86,
-    0x00, 0x87, 0x00, 0x88, 0x00, 0x89, 0x00, 0x00,
-    0x00, 0x8a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02,
-    0x00, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06,
-    0x00, 0x07, 0x00, 0x08, 0x00, 0x09, 0x00, 0x0a,
-    0x00, 0x0b, 0x00, 0x0c, 0x00, 0x0d, 0x00, 0x0e,
-    0x00, 0x0f, 0x00, 0x10, 0x00, 0x11, 0x00, 0x12,
-    0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16,
-    0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1a,
-    0x00, 0x1b, 0x00, 0x1c, 0x00, 0x1d, 0x00, 0x1e,
-    0x00, 0x1f, 0x00, 0x20, 0x00, 0x21, 0x00, 0x22,
-    0x00, 0x23, 0x00, 0x24, 0x00, 0x25, 0x00, 0x26,
-    0x00, 0x27, 0x00, 0x28, 0x00, 0x29, 0x00, 0x2a,
-    0x00, 0x2b, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x2e,
-    0x00, 0x2f, 0x00, 0x30, 0x00, 0x31, 0x00, 0x32,
-    0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36,
-    0x00, 0x37, 0x00, 0x38, 0x00, 0x39, 0x00, 0x3a,
-    0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3e,
-    0x00, 0x3f, 0x00, 0x40, 0x00, 0x41, 0x00, 0x42,
-    0x00, 0x43, 0x00, 0x44, 0x00, 0x45, 0x00, 0x46,
-    0x00, 0x47, 0x00, 0x48, 0x00, 0x49, 0x00, 0x4a,
-    0x00, 0x4b, 0x00, 0x4c, 0x00, 0x4d, 0x00, 0x4e,
-    0x00, 0x4f, 0x00, 0x50, 0x00, 0x51, 0x00, 0x52,
-    0x00, 0x53, 0x00, 0x54, 0x00, 0x55, 0x00, 0x56,
-    0x00, 0x57, 0x00, 0x58, 0x00, 0x59, 0x00, 0x5a,
-    0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5d, 0x00, 0x5e,
-    0x00, 0x5f, 0x00, 0x60, 0x00, 0x61, 0x00, 0x62,
-    0x00, 0x63, 0x00, 0x64, 0x00, 0x65, 0x00, 0x66,
-    0x00, 0x67, 0x00, 0x68, 0x00, 0x69, 0x00, 0x6a,
-    0x00, 0x6b, 0x00, 0x6c, 0x00, 0x6d, 0x00, 0x6e,
-    0x00, 0x6f, 0x00, 0x70, 0x00, 0x71, 0x00, 0x72,
-    0x00, 0x73, 0x00, 0x74, 0x00, 0x75, 0x00, 0x76,
-    0x00, 0x77, 0x00, 0x78, 0x00, 0x79, 0x00, 0x7a,
-    0x00, 0x7b, 0x00, 0x7c, 0x00, 0x7d, 0x00, 0x7e,
-    0x00, 0x7f, 0x00, 0x80, 0x00, 0x81, 0x00, 0x82,
-    0x00, 0x83, 0x00, 0x84, 0x00, 0x85, 0x00, 0x86,
-    0x00, 0x87, 0x00, 0x88, 0x00, 0x89, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x8a, 0x00, 0xfd, 0x01, 0xfc, 0x02, 0x0a,
-    0x02, 0x1a, 0x02, 0x2c, 0x02, 0x3e, 0x02, 0x4c,
-    0x02, 0x5a, 0x02, 0x68, 0x02, 0x76, 0x02, 0x84,
-    0x02, 0x92, 0x02, 0xa2, 0x02, 0xb2, 0x02, 0xc2,
-    0x02, 0xd0, 0x02, 0xde, 0x02, 0xee, 0x03, 0x00,
-    0x03, 0x0e, 0x03, 0x1e, 0x03, 0x2c, 0x03, 0x3c,
-    0x03, 0x4c, 0x03, 0x5c, 0x03, 0x6e, 0x03, 0x7e,
-    0x03, 0x92, 0x03, 0xa0, 0x03, 0xae, 0x03, 0xc2,
-    0x03, 0xd2, 0x03, 0xe2, 0x03, 0xf2, 0x04, 0x04,
-    0x04, 0x14, 0x04, 0x24, 0x04, 0x34, 0x04, 0x44,
-    0x04, 0x54, 0x04, 0x64, 0x04, 0x7a, 0x04, 0x8a,
-    0x04, 0x9a, 0x04, 0xa8, 0x04, 0xb6, 0x04, 0xc8,
-    0x04, 0xd8, 0x04, 0xea, 0x04, 0xfa, 0x05, 0x0a,
-    0x05, 0x1a, 0x05, 0x28, 0x05, 0x38, 0x05, 0x48,
-    0x05, 0x5c, 0x05, 0x6c, 0x05, 0x7c, 0x05, 0x8c,
-    0x05, 0x9c, 0x05, 0xaa, 0x05, 0xb8, 0x05, 0xc8,
-    0x05, 0xd6, 0x05, 0xe6, 0x05, 0xf6, 0x06, 0x06,
-    0x06, 0x16, 0x06, 0x28, 0x06, 0x38, 0x06, 0x48,
-    0x06, 0x58, 0x06, 0x66, 0x06, 0x76, 0x06, 0x86,
-    0x06, 0x98, 0x06, 0xa6, 0x06, 0xb6, 0x06, 0xc4,
-    0x06, 0xd4, 0x06, 0xe2, 0x06, 0xf0, 0x06, 0xfe,
-    0x07, 0x0e, 0x07, 0x1e, 0x07, 0x2c, 0x07, 0x3a,
-    0x07, 0x48, 0x07, 0x58, 0x07, 0x68, 0x07, 0x78,
-    0x07, 0x8a, 0x07, 0x9a, 0x07, 0xaa, 0x07, 0xba,
-    0x07, 0xca, 0x07, 0xda, 0x07, 0xe8, 0x07, 0xf8,
-    0x08, 0x0a, 0x08, 0x1a, 0x08, 0x28, 0x08, 0x38,
-    0x08, 0x48, 0x08, 0x58, 0x08, 0x68, 0x08, 0x76,
-    0x08, 0x84, 0x08, 0x94, 0x08, 0xa4, 0x08, 0xb6,
-    0x08, 0xc6, 0x08, 0xd6, 0x08, 0xe4, 0x08, 0xf2,
-    0x09, 0x00, 0x09, 0x0e, 0x09, 0x1c, 0x09, 0x2c,
-    0x09, 0x3a, 0x09, 0x48, 0x09, 0x58, 0x09, 0x66,
-    0x09, 0x74, 0x09, 0x84, 0x09, 0x92, 0x09, 0xa0,
-    0x09, 0xb0, 0x09, 0xbe, 0x09, 0xcc, 0x09, 0xda,
-    0x09, 0xe8, 0x09, 0xf6, 0x0a, 0x04, 0x0a, 0x14,
-    0x0a, 0x22, 0x0a, 0x30, 0x0a, 0x3e, 0x0a, 0x4e,
-    0x0a, 0x5c, 0x0a, 0x64, 0x0a, 0x6c, 0x0a, 0x74,
-    0x0a, 0x7c, 0x0a, 0x84, 0x0a, 0x8c, 0x0a, 0x94,
-    0x0a, 0x9c, 0x0a, 0xa4, 0x0a, 0xac, 0x0a, 0xb4,
-    0x0a, 0xbc, 0x0a, 0xc4, 0x0a, 0xcc, 0x0a, 0xd4,
-    0x0a, 0xdc, 0x0a, 0xe4, 0x0a, 0xec, 0x0a, 0xf4,
-    0x0a, 0xfc, 0x0b, 0x04, 0x0b, 0x0c, 0x0b, 0x14,
-    0x0b, 0x1c, 0x0b, 0x24, 0x0b, 0x2c, 0x0b, 0x34,
-    0x0b, 0x3c, 0x0b, 0x44, 0x0b, 0x4c, 0x0b, 0x54,
-    0x0b, 0x5c, 0x0b, 0x64, 0x0b, 0x6c, 0x0b, 0x74,
-    0x0b, 0x7c, 0x0b, 0x84, 0x0b, 0x8c, 0x0b, 0x94,
-    0x0b, 0x9c, 0x0b, 0xa4, 0x0b, 0xac, 0x0b, 0xb4,
-    0x0b, 0xbc, 0x0b, 0xc4, 0x0b, 0xcc, 0x0b, 0xd4,
-    0x0b, 0xdc, 0x0b, 0xe4, 0x0b, 0xec, 0x0b, 0xf4,
-    0x0b, 0xfc, 0x0c, 0x04, 0x0c, 0x0c, 0x0c, 0x14,
-    0x0c, 0x1c, 0x0c, 0x24, 0x0c, 0x2c, 0x0c, 0x34,
-    0x0c, 0x3c, 0x0c, 0x44, 0x0c, 0x4c, 0x0c, 0x54,
-    0x0c, 0x5c, 0x0c, 0x64, 0x0c, 0x6c, 0x0c, 0x74,
-    0x0c, 0x7c, 0x0c, 0x84, 0x0c, 0x8c, 0x0c, 0x94,
-    0x0c, 0x9c, 0x0c, 0xa4, 0x0c, 0xac, 0x0c, 0xb4,
-    0x0c, 0xbc, 0x0c, 0xc4, 0x0c, 0xcc, 0x0c, 0xd4,
-    0x0c, 0xdc, 0x0c, 0xe4, 0x0c, 0xec, 0x0c, 0xf4,
-    0x0c, 0xfc, 0x0d, 0x04, 0x0d, 0x0c, 0x0d, 0x14,
-    0x0d, 0x1c, 0x0d, 0x24, 0x0d, 0x2c, 0x0d, 0x34,
-    0x0d, 0x3c, 0x0d, 0x44, 0x0d, 0x4c, 0x0d, 0x54,
-    0x0d, 0x5c, 0x0d, 0x64, 0x0d, 0x6c, 0x0d, 0x74,
-    0x0d, 0x7c, 0x0d, 0x84, 0x0d, 0x8c, 0x0d, 0x94,
-    0x0d, 0x9c, 0x0d, 0xa4, 0x0d, 0xac, 0x0d, 0xb4,
-    0x0d, 0xbc, 0x0d, 0xc4, 0x0d, 0xcc, 0x0d, 0xd4,
-    0x0d, 0xdc, 0x0d, 0xe4, 0x0d, 0xec, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x04, 0x0b, 0xf8, 0x0c, 0x1a,
-    0x0c, 0x3c, 0x0c, 0x5a, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x05, 0x0c, 0x6a, 0x0c, 0x94, 0x0c, 0xbe,
-    0x0c, 0xe4, 0x0d, 0x0a, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x06, 0x0d, 0x20, 0x0d, 0x52, 0x0d, 0x84,
-    0x0d, 0xb2, 0x0d, 0xe0, 0x0e, 0x0e, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x06, 0x0e, 0x2a, 0x0e, 0x5c,
-    0x0e, 0x8e, 0x0e, 0xbc, 0x0e, 0xea, 0x0f, 0x18,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x0f, 0x34,
-    0x0f, 0x56, 0x0f, 0x78, 0x0f, 0x96, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x04, 0x0f, 0xa6, 0x0f, 0xc8,
-    0x0f, 0xea, 0x10, 0x08, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x04, 0x10, 0x18, 0x10, 0x3a, 0x10, 0x5c,
-    0x10, 0x7a, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04,
-    0x10, 0x8a, 0x10, 0xac, 0x10, 0xce, 0x10, 0xec,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x10, 0xfc,
-    0x11, 0x1e, 0x11, 0x40, 0x11, 0x5e, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x04, 0x11, 0x6e, 0x11, 0x90,
-    0x11, 0xb2, 0x11, 0xd0, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x05, 0x11, 0xe0, 0x12, 0x0a, 0x12, 0x34,
-    0x12, 0x5a, 0x12, 0x80, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x05, 0x12, 0x96, 0x12, 0xb8, 0x12, 0xda,
-    0x12, 0xfc, 0x13, 0x1a, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x05, 0x13, 0x28, 0x13, 0x52, 0x13, 0x7c,
-    0x13, 0xa2, 0x13, 0xc8, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x04, 0x13, 0xde, 0x14, 0x00, 0x14, 0x22,
-    0x14, 0x40, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04,
-    0x14, 0x50, 0x14, 0x72, 0x14, 0x94, 0x14, 0xb2,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x14, 0xc2,
-    0x14, 0xec, 0x15, 0x16, 0x15, 0x3c, 0x15, 0x62,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x15, 0x78,
-    0x15, 0xa2, 0x15, 0xcc, 0x15, 0xf6, 0x16, 0x1c,
-    0x16, 0x42, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04,
-    0x16, 0x56, 0x16, 0x78, 0x16, 0x9a, 0x16, 0xb8,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x16, 0xc8,
-    0x16, 0xf2, 0x17, 0x1c, 0x17, 0x42, 0x17, 0x68,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x17, 0x7e,
-    0x17, 0xa0, 0x17, 0xc2, 0x17, 0xe0, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x05, 0x17, 0xf0, 0x18, 0x12,
-    0x18, 0x34, 0x18, 0x56, 0x18, 0x74, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x05, 0x18, 0x82, 0x18, 0xac,
-    0x18, 0xd6, 0x18, 0xfc, 0x19, 0x22, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x05, 0x19, 0x38, 0x19, 0x62,
-    0x19, 0x8c, 0x19, 0xb2, 0x19, 0xd8, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x06, 0x19, 0xee, 0x1a, 0x20,
-    0x1a, 0x52, 0x1a, 0x80, 0x1a, 0xae, 0x1a, 0xdc,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x1a, 0xf8,
-    0x1b, 0x22, 0x1b, 0x4c, 0x1b, 0x72, 0x1b, 0x98,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x1b, 0xae,
-    0x1b, 0xd0, 0x1b, 0xf2, 0x1c, 0x14, 0x1c, 0x36,
-    0x1c, 0x58, 0x1c, 0x76, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x04, 0x1c, 0x80, 0x1c, 0xa2, 0x1c, 0xc4,
-    0x1c, 0xe2, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04,
-    0x1c, 0xf2, 0x1d, 0x14, 0x1d, 0x36, 0x1d, 0x54,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x1d, 0x64,
-    0x1d, 0x86, 0x1d, 0xa8, 0x1d, 0xca, 0x1d, 0xec,
-    0x1e, 0x0e, 0x1e, 0x2c, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x05, 0x1e, 0x36, 0x1e, 0x60, 0x1e, 0x8a,
-    0x1e, 0xb0, 0x1e, 0xd6, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x05, 0x1e, 0xec, 0x1f, 0x16, 0x1f, 0x40,
-    0x1f, 0x66, 0x1f, 0x8c, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x05, 0x1f, 0xa2, 0x1f, 0xcc, 0x1f, 0xf6,
-    0x20, 0x1c, 0x20, 0x42, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x06, 0x20, 0x58, 0x20, 0x8a, 0x20, 0xbc,
-    0x20, 0xea, 0x21, 0x18, 0x21, 0x46, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x05, 0x21, 0x62, 0x21, 0x8c,
-    0x21, 0xb6, 0x21, 0xdc, 0x22, 0x02, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x05, 0x22, 0x18, 0x22, 0x3a,
-    0x22, 0x5c, 0x22, 0x7e, 0x22, 0x9c, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x05, 0x22, 0xaa, 0x22, 0xcc,
-    0x22, 0xee, 0x23, 0x10, 0x23, 0x2e, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x05, 0x23, 0x3c, 0x23, 0x66,
-    0x23, 0x90, 0x23, 0xb6, 0x23, 0xdc, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x05, 0x23, 0xf2, 0x24, 0x1c,
-    0x24, 0x46, 0x24, 0x6c, 0x24, 0x92, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x05, 0x24, 0xa8, 0x24, 0xca,
-    0x24, 0xec, 0x25, 0x0e, 0x25, 0x2c, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x08, 0x25, 0x3a, 0x25, 0x5c,
-    0x25, 0x7e, 0x25, 0xa0, 0x25, 0xc2, 0x25, 0xe4,
-    0x26, 0x06, 0x26, 0x24, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x05, 0x26, 0x2c, 0x26, 0x56, 0x26, 0x80,
-    0x26, 0xa6, 0x26, 0xcc, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x05, 0x26, 0xe2, 0x27, 0x04, 0x27, 0x26,
-    0x27, 0x48, 0x27, 0x66, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x04, 0x27, 0x74, 0x27, 0x96, 0x27, 0xb8,
-    0x27, 0xd6, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04,
-    0x27, 0xe6, 0x28, 0x08, 0x28, 0x2a, 0x28, 0x48,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x28, 0x58,
-    0x28, 0x7a, 0x28, 0x9c, 0x28, 0xbe, 0x28, 0xe0,
-    0x28, 0xfe, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05,
-    0x29, 0x0a, 0x29, 0x34, 0x29, 0x5e, 0x29, 0x7c,
-    0x29, 0xa2, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06,
-    0x29, 0xb8, 0x29, 0xe2, 0x2a, 0x0c, 0x2a, 0x36,
-    0x2a, 0x5c, 0x2a, 0x82, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x05, 0x2a, 0x96, 0x2a, 0xc0, 0x2a, 0xea,
-    0x2b, 0x10, 0x2b, 0x36, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x05, 0x2b, 0x4c, 0x2b, 0x76, 0x2b, 0xa0,
-    0x2b, 0xc6, 0x2b, 0xec, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x05, 0x2c, 0x02, 0x2c, 0x24, 0x2c, 0x46,
-    0x2c, 0x68, 0x2c, 0x86, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x04, 0x2c, 0x94, 0x2c, 0xb6, 0x2c, 0xd8,
-    0x2c, 0xf6, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05,
-    0x2d, 0x06, 0x2d, 0x30, 0x2d, 0x5a, 0x2d, 0x80,
-    0x2d, 0xa6, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05,
-    0x2d, 0xbc, 0x2d, 0xe6, 0x2e, 0x10, 0x2e, 0x36,
-    0x2e, 0x5c, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07,
-    0x2e, 0x72, 0x2e, 0x94, 0x2e, 0xb6, 0x2e, 0xd8,
-    0x2e, 0xfa, 0x2f, 0x1c, 0x2f, 0x3a, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x05, 0x2f, 0x44, 0x2f, 0x66,
-    0x2f, 0x88, 0x2f, 0xaa, 0x2f, 0xc8, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x05, 0x2f, 0xd6, 0x30, 0x00,
-    0x30, 0x2a, 0x30, 0x50, 0x30, 0x76, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x05, 0x30, 0x8c, 0x30, 0xb6,
-    0x30, 0xe0, 0x31, 0x06, 0x31, 0x2c, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x05, 0x31, 0x42, 0x31, 0x64,
-    0x31, 0x86, 0x31, 0xa8, 0x31, 0xc6, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x04, 0x31, 0xd4, 0x31, 0xf6,
-    0x32, 0x18, 0x32, 0x36, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x04, 0x32, 0x46, 0x32, 0x68, 0x32, 0x8a,
-    0x32, 0xa8, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05,
-    0x32, 0xb8, 0x32, 0xda, 0x32, 0xfc, 0x33, 0x1e,
-    0x33, 0x3c, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04,
-    0x33, 0x4a, 0x33, 0x6c, 0x33, 0x8e, 0x33, 0xac,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x33, 0xbc,
-    0x33, 0xe6, 0x34, 0x10, 0x34, 0x36, 0x34, 0x5c,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x34, 0x72,
-    0x34, 0x94, 0x34, 0xb6, 0x34, 0xd8, 0x34, 0xf6,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x35, 0x04,
-    0x35, 0x2e, 0x35, 0x58, 0x35, 0x7e, 0x35, 0xa4,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x35, 0xba,
-    0x35, 0xe4, 0x36, 0x0e, 0x36, 0x34, 0x36, 0x5a,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x36, 0x70,
-    0x36, 0xaa, 0x36, 0xdc, 0x37, 0x0a, 0x37, 0x38,
-    0x37, 0x66, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05,
-    0x37, 0x82, 0x37, 0xb4, 0x37, 0xde, 0x38, 0x04,
-    0x38, 0x2a, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05,
-    0x38, 0x40, 0x38, 0x72, 0x38, 0x9c, 0x38, 0xc2,
-    0x38, 0xe8, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05,
-    0x38, 0xfe, 0x39, 0x30, 0x39, 0x5a, 0x39, 0x80,
-    0x39, 0xa6, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04,
-    0x39, 0xbc, 0x39, 0xe6, 0x3a, 0x08, 0x3a, 0x26,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x3a, 0x36,
-    0x3a, 0x58, 0x3a, 0x7a, 0x3a, 0x9c, 0x3a, 0xba,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x3a, 0xc8,
-    0x3a, 0xea, 0x3b, 0x0c, 0x3b, 0x2e, 0x3b, 0x4c,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x3b, 0x5a,
-    0x3b, 0x7c, 0x3b, 0x9e, 0x3b, 0xc0, 0x3b, 0xe2,
-    0x3c, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04,
-    0x3c, 0x0c, 0x3c, 0x2e, 0x3c, 0x50, 0x3c, 0x6e,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x3c, 0x7e,
-    0x3c, 0xa8, 0x3c, 0xd2, 0x3c, 0xf8, 0x3d, 0x1e,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x3d, 0x34,
-    0x3d, 0x56, 0x3d, 0x78, 0x3d, 0x96, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x05, 0x3d, 0xa6, 0x3d, 0xc8,
-    0x3d, 0xea, 0x3e, 0x0c, 0x3e, 0x2a, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x04, 0x3e, 0x38, 0x3e, 0x5a,
-    0x3e, 0x7c, 0x3e, 0x9a, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x04, 0x3e, 0xaa, 0x3e, 0xcc, 0x3e, 0xee,
-    0x3f, 0x0c, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04,
-    0x3f, 0x1c, 0x3f, 0x3e, 0x3f, 0x60, 0x3f, 0x7e,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x3f, 0x8e,
-    0x3f, 0xb0, 0x3f, 0xd2, 0x3f, 0xf4, 0x40, 0x12,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x40, 0x20,
-    0x40, 0x4a, 0x40, 0x74, 0x40, 0x9a, 0x40, 0xc0,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x40, 0xd6,
-    0x40, 0xf8, 0x41, 0x1a, 0x41, 0x38, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x04, 0x41, 0x48, 0x41, 0x6a,
-    0x41, 0x8c, 0x41, 0xaa, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x04, 0x41, 0xba, 0x41, 0xdc, 0x41, 0xfe,
-    0x42, 0x1c, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05,
-    0x42, 0x2c, 0x42, 0x56, 0x42, 0x80, 0x42, 0xa6,
-    0x42, 0xcc, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05,
-    0x42, 0xe2, 0x43, 0x0c, 0x43, 0x36, 0x43, 0x5c,
-    0x43, 0x82, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05,
-    0x43, 0x98, 0x43, 0xc2, 0x43, 0xec, 0x44, 0x12,
-    0x44, 0x38, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06,
-    0x44, 0x4e, 0x44, 0x80, 0x44, 0xb2, 0x44, 0xd8,
-    0x45, 0x06, 0x45, 0x34, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x05, 0x45, 0x50, 0x45, 0x7a, 0x45, 0xa4,
-    0x45, 0xca, 0x45, 0xf0, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x05, 0x46, 0x06, 0x46, 0x30, 0x46, 0x5a,
-    0x46, 0x80, 0x46, 0xa6, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x05, 0x46, 0xbc, 0x46, 0xe6, 0x47, 0x10,
-    0x47, 0x36, 0x47, 0x5c, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x05, 0x47, 0x72, 0x47, 0x9c, 0x47, 0xc6,
-    0x47, 0xec, 0x48, 0x12, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x05, 0x48, 0x28, 0x48, 0x52, 0x48, 0x7c,
-    0x48, 0xa2, 0x48, 0xc8, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x04, 0x48, 0xde, 0x49, 0x00, 0x49, 0x22,
-    0x49, 0x40, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05,
-    0x49, 0x50, 0x49, 0x72, 0x49, 0x94, 0x49, 0xb6,
-    0x49, 0xd4, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06,
-    0x49, 0xe2, 0x4a, 0x04, 0x4a, 0x26, 0x4a, 0x48,
-    0x4a, 0x6a, 0x4a, 0x88, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x05, 0x4a, 0x94, 0x4a, 0xbe, 0x4a, 0xe8,
-    0x4b, 0x0e, 0x4b, 0x34, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x04, 0x4b, 0x4a, 0x4b, 0x6c, 0x4b, 0x8e,
-    0x4b, 0xac, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05,
-    0x4b, 0xbc, 0x4b, 0xe6, 0x4c, 0x10, 0x4c, 0x36,
-    0x4c, 0x5c, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05,
-    0x4c, 0x72, 0x4c, 0x9c, 0x4c, 0xc6, 0x4c, 0xec,
-    0x4d, 0x12, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05,
-    0x4d, 0x28, 0x4d, 0x52, 0x4d, 0x7c, 0x4d, 0xa2,
-    0x4d, 0xc8, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05,
-    0x4d, 0xde, 0x4e, 0x08, 0x4e, 0x32, 0x4e, 0x58,
-    0x4e, 0x7e, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04,
-    0x4e, 0x94, 0x4e, 0xb6, 0x4e, 0xd8, 0x4e, 0xf6,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x4f, 0x06,
-    0x4f, 0x28, 0x4f, 0x4a, 0x4f, 0x68, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x05, 0x4f, 0x78, 0x4f, 0xa2,
-    0x4f, 0xcc, 0x4f, 0xf2, 0x50, 0x18, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x05, 0x50, 0x2e, 0x50, 0x58,
-    0x50, 0x82, 0x50, 0xa8, 0x50, 0xce, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x06, 0x50, 0xe4, 0x51, 0x0e,
-    0x51, 0x38, 0x51, 0x62, 0x51, 0x88, 0x51, 0xae,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x51, 0xc2,
-    0x51, 0xe4, 0x52, 0x06, 0x52, 0x28, 0x52, 0x46,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x52, 0x54,
-    0x52, 0x7e, 0x52, 0xa8, 0x52, 0xce, 0x52, 0xf4,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x53, 0x0a,
-    0x53, 0x2c, 0x53, 0x4e, 0x53, 0x6c, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x04, 0x53, 0x7c, 0x53, 0x9e,
-    0x53, 0xc0, 0x53, 0xde, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x04, 0x53, 0xee, 0x54, 0x10, 0x54, 0x32,
-    0x54, 0x50, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04,
-    0x54, 0x60, 0x54, 0x82, 0x54, 0xa4, 0x54, 0xc2,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x54, 0xd2,
-    0x54, 0xf4, 0x55, 0x16, 0x55, 0x34, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x05, 0x55, 0x44, 0x55, 0x6e,
-    0x55, 0x98, 0x55, 0xbe, 0x55, 0xe4, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x04, 0x55, 0xfa, 0x56, 0x1c,
-    0x56, 0x3e, 0x56, 0x5c, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x04, 0x56, 0x6c, 0x56, 0x8e, 0x56, 0xb0,
-    0x56, 0xce, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05,
-    0x56, 0xde, 0x57, 0x08, 0x57, 0x32, 0x57, 0x58,
-    0x57, 0x7e, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04,
-    0x57, 0x94, 0x57, 0xb6, 0x57, 0xd8, 0x57, 0xf6,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x58, 0x06,
-    0x58, 0x28, 0x58, 0x4a, 0x58, 0x68, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x05, 0x58, 0x78, 0x58, 0xa2,
-    0x58, 0xcc, 0x58, 0xf2, 0x59, 0x18, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x04, 0x59, 0x2e, 0x59, 0x50,
-    0x59, 0x72, 0x59, 0x90, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x04, 0x59, 0xa0, 0x59, 0xc2, 0x59, 0xe4,
-    0x5a, 0x02, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05,
-    0x5a, 0x12, 0x5a, 0x3c, 0x5a, 0x66, 0x5a, 0x8c,
-    0x5a, 0xb2, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04,
-    0x5a, 0xc8, 0x5a, 0xea, 0x5b, 0x0c, 0x5b, 0x2a,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x5b, 0x3a,
-    0x5b, 0x5c, 0x5b, 0x7e, 0x5b, 0x9c, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x04, 0x5b, 0xac, 0x5b, 0xce,
-    0x5b, 0xf0, 0x5c, 0x0e, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x04, 0x5c, 0x1e, 0x5c, 0x40, 0x5c, 0x62,
-    0x5c, 0x80, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04,
-    0x5c, 0x90, 0x5c, 0xb2, 0x5c, 0xd4, 0x5c, 0xf2,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x5d, 0x02,
-    0x5d, 0x24, 0x5d, 0x46, 0x5d, 0x64, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x05, 0x5d, 0x74, 0x5d, 0x96,
-    0x5d, 0xb8, 0x5d, 0xda, 0x5d, 0xf8, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x04, 0x5e, 0x06, 0x5e, 0x28,
-    0x5e, 0x4a, 0x5e, 0x68, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x04, 0x5e, 0x78, 0x5e, 0x9a, 0x5e, 0xbc,
-    0x5e, 0xda, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04,
-    0x5e, 0xea, 0x5f, 0x0c, 0x5f, 0x2e, 0x5f, 0x4c,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x5f, 0x5c,
-    0x5f, 0x86, 0x5f, 0xb0, 0x5f, 0xd6, 0x5f, 0xfc,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x60, 0x12,
-    0x60, 0x34, 0x60, 0x56, 0x60, 0x74, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x60, 0x84, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x60, 0x88, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x60, 0x8c, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x60, 0x90, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x60, 0x94, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x60, 0x98, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x60, 0x9c, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x60, 0xb2, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x60, 0xc0, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x60, 0xce, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x60, 0xd8, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x60, 0xdc, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x60, 0xe0, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x60, 0xea, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x60, 0xee, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x60, 0xfc, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x61, 0x06, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x61, 0x0a, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x61, 0x0e, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x61, 0x12, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x61, 0x20, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x61, 0x24, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x61, 0x28, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x61, 0x36, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x61, 0x3a, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x61, 0x3e, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x61, 0x42, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x61, 0x50, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x61, 0x5e, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x61, 0x68, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x61, 0x7a, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x61, 0x7e, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x61, 0x82, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x61, 0x86, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x61, 0x94, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x61, 0xa6, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x61, 0xb0, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x61, 0xb4, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x61, 0xbe, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x61, 0xc8, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x61, 0xd6, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x61, 0xe0, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x61, 0xea, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x61, 0xf4, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x61, 0xf8, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x61, 0xfc, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x62, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x62, 0x12, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x62, 0x1c, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x62, 0x26, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x62, 0x2a, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x62, 0x40, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x62, 0x4e, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x62, 0x52, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x62, 0x5c, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x62, 0x66, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x62, 0x70, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x62, 0x7a, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x62, 0x7e, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x62, 0x82, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x62, 0x86, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x62, 0x8a, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x62, 0x94, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x62, 0x98, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x62, 0xaa, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x62, 0xae, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x62, 0xb8, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x62, 0xc2, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x62, 0xd0, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x62, 0xe6, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x62, 0xf8, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x63, 0x0a, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x63, 0x0e, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x63, 0x18, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x63, 0x1c, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x63, 0x20, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x63, 0x2a, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x63, 0x40, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x63, 0x4a, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x63, 0x4e, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x63, 0x64, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x63, 0x72, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x63, 0x80, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x63, 0x84, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x63, 0x8e, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x63, 0x9c, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x63, 0xa6, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x63, 0xaa, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x63, 0xb4, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x63, 0xbe, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x63, 0xcc, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x63, 0xde, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x63, 0xe2, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x63, 0xf0, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x63, 0xfa, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x63, 0xfe, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x64, 0x08, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x64, 0x0c, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x64, 0x1e, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x64, 0x34, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x64, 0x4a, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x64, 0x5c, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x64, 0x66, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x64, 0x74, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x64, 0x8a, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x64, 0xa0, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x64, 0xae, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x64, 0xc0, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x64, 0xce, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x64, 0xe0, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x64, 0xee, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x65, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x65, 0x0e, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x65, 0x38, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x01, 0x65, 0x46, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x16,
-    0x00, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x51, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x51, 0x00, 0x01, 0x00, 0x01, 0x00, 0x51,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x02, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x51, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x51, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x51, 0x00, 0x03, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x8b, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x51,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x18, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x8c, 0x00, 0x01, 0x00, 0x01, 0x00, 0x51,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x51, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x02, 0x00, 0x1e, 0x00, 0x24, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x51, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x51, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x51, 0x00, 0x01, 0x00, 0x01, 0x00, 0x51,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x03, 0x00, 0x18, 0x00, 0x1e, 0x00, 0x24,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x51,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x51, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x51, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x51, 0x00, 0x03, 0x00, 0x02, 0x00, 0x14,
-    0x00, 0x1a, 0x00, 0x01, 0x00, 0x20, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x51,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x14, 0x00, 0x01,
-    0x00, 0x1a, 0x00, 0x01, 0x00, 0x20, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x8e, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x51,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x51, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x14, 0x00, 0x02,
-    0x00, 0x1a, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x8e, 0x00, 0x01, 0x00, 0x01, 0x00, 0x51,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x51, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x51, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x14, 0x00, 0x01, 0x00, 0x1a, 0x00, 0x03,
-    0x00, 0x20, 0x00, 0x26, 0x00, 0x2c, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x51, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x51, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x51, 0x00, 0x01, 0x00, 0x01, 0x00, 0x51,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x51, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x14, 0x00, 0x04,
-    0x00, 0x1a, 0x00, 0x20, 0x00, 0x26, 0x00, 0x2c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x51,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x51, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x51, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x51, 0x00, 0x01, 0x00, 0x01, 0x00, 0x51,
-    0x00, 0x03, 0x00, 0x03, 0x00, 0x16, 0x00, 0x1c,
-    0x00, 0x22, 0x00, 0x01, 0x00, 0x28, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x51, 0x00, 0x03,
-    0x00, 0x02, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x01,
-    0x00, 0x22, 0x00, 0x01, 0x00, 0x28, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x51, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x51, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x16, 0x00, 0x01, 0x00, 0x1c, 0x00, 0x02,
-    0x00, 0x22, 0x00, 0x28, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x90, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x51, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x51, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x51, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x16, 0x00, 0x03, 0x00, 0x1c, 0x00, 0x22,
-    0x00, 0x28, 0x00, 0x01, 0x00, 0x00, 0x00, 0x90,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x51, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x51, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x51, 0x00, 0x01, 0x00, 0x01, 0x00, 0x51,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x14, 0x00, 0x01,
-    0x00, 0x1a, 0x00, 0x03, 0x00, 0x20, 0x00, 0x26,
-    0x00, 0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x53, 0x00, 0x01, 0x00, 0x01, 0x00, 0x53,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x54, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x54, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x63, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x14, 0x00, 0x04, 0x00, 0x1a, 0x00, 0x20,
-    0x00, 0x26, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x53, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x01, 0x00, 0x01, 0x00, 0x54,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x63, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x63, 0x00, 0x03, 0x00, 0x03,
-    0x00, 0x16, 0x00, 0x1c, 0x00, 0x22, 0x00, 0x01,
-    0x00, 0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x90, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x63, 0x00, 0x03, 0x00, 0x02, 0x00, 0x16,
-    0x00, 0x1c, 0x00, 0x01, 0x00, 0x22, 0x00, 0x01,
-    0x00, 0x28, 0x00, 0x01, 0x00, 0x00, 0x00, 0x90,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x01, 0x00, 0x01, 0x00, 0x63,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x16, 0x00, 0x01,
-    0x00, 0x1c, 0x00, 0x02, 0x00, 0x22, 0x00, 0x28,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x01, 0x00, 0x01, 0x00, 0x54,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x63, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x16, 0x00, 0x03,
-    0x00, 0x1c, 0x00, 0x22, 0x00, 0x28, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x55, 0x00, 0x01, 0x00, 0x01, 0x00, 0x54,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x54, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x63, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x10, 0x00, 0x01, 0x00, 0x16, 0x00, 0x01,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x01, 0x00, 0x01, 0x00, 0x54,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x10, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x02,
-    0x00, 0x16, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x54, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x01, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x90, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x10, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x01, 0x00, 0x00, 0x00, 0x90,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x54, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x10, 0x00, 0x01, 0x00, 0x16, 0x00, 0x01,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x55, 0x00, 0x01, 0x00, 0x01, 0x00, 0x55,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x54, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x02,
-    0x00, 0x16, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x55, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x01, 0x00, 0x01, 0x00, 0x54,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x91, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x54, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x01, 0x00, 0x00, 0x00, 0x91,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x55, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x54, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x10, 0x00, 0x01, 0x00, 0x16, 0x00, 0x01,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x55, 0x00, 0x01, 0x00, 0x01, 0x00, 0x55,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x02,
-    0x00, 0x16, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x55, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x91, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x01, 0x00, 0x00, 0x00, 0x91,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x55, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x10, 0x00, 0x01, 0x00, 0x16, 0x00, 0x01,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x53, 0x00, 0x01, 0x00, 0x01, 0x00, 0x53,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x54, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x02,
-    0x00, 0x16, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x53, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x01, 0x00, 0x01, 0x00, 0x54,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x92, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x54, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x01, 0x00, 0x00, 0x00, 0x92,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x53, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x54, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x10, 0x00, 0x01, 0x00, 0x16, 0x00, 0x01,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x01, 0x00, 0x01, 0x00, 0x54,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x63, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x02,
-    0x00, 0x16, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x54, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x63, 0x00, 0x01, 0x00, 0x01, 0x00, 0x63,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x92, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x63, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x01, 0x00, 0x00, 0x00, 0x93,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x54, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x63, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x10, 0x00, 0x01, 0x00, 0x16, 0x00, 0x01,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x47, 0x00, 0x01, 0x00, 0x01, 0x00, 0x47,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x47, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x02,
-    0x00, 0x16, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x47, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x47, 0x00, 0x01, 0x00, 0x01, 0x00, 0x47,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x93, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x47, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x01, 0x00, 0x00, 0x00, 0x94,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x47, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x47, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x01, 0x00, 0x18, 0x00, 0x02,
-    0x00, 0x1e, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x47, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x47, 0x00, 0x01, 0x00, 0x01, 0x00, 0x47,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x47, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x03,
-    0x00, 0x18, 0x00, 0x1e, 0x00, 0x24, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x47, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x47, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x47, 0x00, 0x01, 0x00, 0x01, 0x00, 0x47,
-    0x00, 0x03, 0x00, 0x02, 0x00, 0x14, 0x00, 0x1a,
-    0x00, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x95, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x47, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x14, 0x00, 0x01, 0x00, 0x1a,
-    0x00, 0x01, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x96, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x47, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x47, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x14, 0x00, 0x02, 0x00, 0x1a,
-    0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0x96,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x47, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x47, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x47, 0x00, 0x03, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x01, 0x00, 0x16, 0x00, 0x01, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x47,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x47, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x10, 0x00, 0x01, 0x00, 0x16, 0x00, 0x01,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x01, 0x00, 0x01, 0x00, 0x47,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x02,
-    0x00, 0x16, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x47, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x96, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x01, 0x00, 0x00, 0x00, 0x96,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x47, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x01, 0x00, 0x18, 0x00, 0x02,
-    0x00, 0x1e, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x47, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x47, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x03,
-    0x00, 0x18, 0x00, 0x1e, 0x00, 0x24, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x47, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x03, 0x00, 0x02, 0x00, 0x14, 0x00, 0x1a,
-    0x00, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x97, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x14, 0x00, 0x01, 0x00, 0x1a,
-    0x00, 0x01, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x98, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x14, 0x00, 0x02, 0x00, 0x1a,
-    0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0x98,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x47, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x03, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x01, 0x00, 0x16, 0x00, 0x01, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x47,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x47, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x46, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x02, 0x00, 0x16,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x47, 0x00, 0x01, 0x00, 0x01, 0x00, 0x46,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x46, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x98,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x46, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x98, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x47, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x46, 0x00, 0x03, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x01, 0x00, 0x16, 0x00, 0x01, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x46,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x46, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x47, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x02, 0x00, 0x16,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x46, 0x00, 0x01, 0x00, 0x01, 0x00, 0x47,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x47, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x99,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x47, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x99, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x46, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x47, 0x00, 0x03, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x18, 0x00, 0x02, 0x00, 0x1e,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x46, 0x00, 0x01, 0x00, 0x01, 0x00, 0x46,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x46, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x46, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x03, 0x00, 0x18,
-    0x00, 0x1e, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x46, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x46, 0x00, 0x01, 0x00, 0x01, 0x00, 0x46,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x46, 0x00, 0x03,
-    0x00, 0x02, 0x00, 0x14, 0x00, 0x1a, 0x00, 0x01,
-    0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x9a, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x46, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x14, 0x00, 0x01, 0x00, 0x1a, 0x00, 0x01,
-    0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0x9b,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x46, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x46, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x14, 0x00, 0x02, 0x00, 0x1a, 0x00, 0x20,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x46, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x46, 0x00, 0x01, 0x00, 0x01, 0x00, 0x46,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x02, 0x00, 0x1e, 0x00, 0x24,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x47,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x47, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x46, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x46, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x03, 0x00, 0x18, 0x00, 0x1e,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x47, 0x00, 0x01, 0x00, 0x01, 0x00, 0x46,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x46, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x46, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x03, 0x00, 0x18,
-    0x00, 0x1e, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x47, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x46, 0x00, 0x01, 0x00, 0x01, 0x00, 0x46,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x47, 0x00, 0x03,
-    0x00, 0x02, 0x00, 0x14, 0x00, 0x1a, 0x00, 0x01,
-    0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x9c, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x46, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x14, 0x00, 0x01, 0x00, 0x1a, 0x00, 0x01,
-    0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0x9d,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x46, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x46, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x14, 0x00, 0x02, 0x00, 0x1a, 0x00, 0x20,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x47, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x46, 0x00, 0x01, 0x00, 0x01, 0x00, 0x46,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01,
-    0x00, 0x16, 0x00, 0x01, 0x00, 0x1c, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x45, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x45, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x45, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x10, 0x00, 0x02, 0x00, 0x16, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x45,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x45, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x45, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x01, 0x00, 0x18, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x45, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x01, 0x00, 0x18, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x9e, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x45, 0x00, 0x01, 0x00, 0x01, 0x00, 0x45,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x02, 0x00, 0x1e, 0x00, 0x24,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x45,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x45, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x45, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x45, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x03, 0x00, 0x18, 0x00, 0x1e,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x45, 0x00, 0x01, 0x00, 0x01, 0x00, 0x45,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x45, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x45, 0x00, 0x03, 0x00, 0x02,
-    0x00, 0x14, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x9f,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x45, 0x00, 0x03, 0x00, 0x01, 0x00, 0x14,
-    0x00, 0x01, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x20,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x45, 0x00, 0x01, 0x00, 0x01, 0x00, 0x45,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x14,
-    0x00, 0x02, 0x00, 0x1a, 0x00, 0x20, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xa0, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x45, 0x00, 0x01, 0x00, 0x01, 0x00, 0x45,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x45, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x16,
-    0x00, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x29, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x29, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4e,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x02, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x29, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4e, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4e, 0x00, 0x03, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xa0, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4e,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x18, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xa0, 0x00, 0x01, 0x00, 0x01, 0x00, 0x29,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4e, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x16,
-    0x00, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x29, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x29, 0x00, 0x01, 0x00, 0x01, 0x00, 0x29,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x02, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x29, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x29, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x29, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x10, 0x00, 0x02, 0x00, 0x16, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x29,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x29, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x01, 0x00, 0x18, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xa1, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x29, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x01, 0x00, 0x18, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xa2, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x29, 0x00, 0x01, 0x00, 0x01, 0x00, 0x29,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x02, 0x00, 0x1e, 0x00, 0x24,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x29,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x29, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x29, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x29, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x03, 0x00, 0x18, 0x00, 0x1e,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x29, 0x00, 0x01, 0x00, 0x01, 0x00, 0x29,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x29, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x29, 0x00, 0x03, 0x00, 0x02,
-    0x00, 0x14, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa3,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x29, 0x00, 0x03, 0x00, 0x01, 0x00, 0x14,
-    0x00, 0x01, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x20,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x29, 0x00, 0x01, 0x00, 0x01, 0x00, 0x29,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x14,
-    0x00, 0x02, 0x00, 0x1a, 0x00, 0x20, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xa4, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x29, 0x00, 0x01, 0x00, 0x01, 0x00, 0x29,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x29, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x02, 0x00, 0x1e, 0x00, 0x24, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x29, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x29, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x29, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x03, 0x00, 0x18, 0x00, 0x1e, 0x00, 0x24,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x29,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x29, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x03, 0x00, 0x02, 0x00, 0x14,
-    0x00, 0x1a, 0x00, 0x01, 0x00, 0x20, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x14, 0x00, 0x01,
-    0x00, 0x1a, 0x00, 0x01, 0x00, 0x20, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xa4, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x29,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x14, 0x00, 0x02,
-    0x00, 0x1a, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xa4, 0x00, 0x01, 0x00, 0x01, 0x00, 0x29,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x29, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x14, 0x00, 0x01, 0x00, 0x1a, 0x00, 0x03,
-    0x00, 0x20, 0x00, 0x26, 0x00, 0x2c, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4d, 0x00, 0x01, 0x00, 0x01, 0x00, 0x44,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x44, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x14, 0x00, 0x04,
-    0x00, 0x1a, 0x00, 0x20, 0x00, 0x26, 0x00, 0x2c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4d, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x44, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x44, 0x00, 0x01, 0x00, 0x01, 0x00, 0x44,
-    0x00, 0x03, 0x00, 0x03, 0x00, 0x16, 0x00, 0x1c,
-    0x00, 0x22, 0x00, 0x01, 0x00, 0x28, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x44, 0x00, 0x03,
-    0x00, 0x02, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x01,
-    0x00, 0x22, 0x00, 0x01, 0x00, 0x28, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xa5, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x44, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x44, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x16, 0x00, 0x01, 0x00, 0x1c, 0x00, 0x02,
-    0x00, 0x22, 0x00, 0x28, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xa5, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4d, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x44, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x44, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x16, 0x00, 0x03, 0x00, 0x1c, 0x00, 0x22,
-    0x00, 0x28, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa5,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4d, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x44, 0x00, 0x01, 0x00, 0x01, 0x00, 0x44,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x02, 0x00, 0x1e, 0x00, 0x24,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x44, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x03, 0x00, 0x18, 0x00, 0x1e,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x44, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x44, 0x00, 0x03, 0x00, 0x02,
-    0x00, 0x14, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa6,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x44, 0x00, 0x03, 0x00, 0x01, 0x00, 0x14,
-    0x00, 0x01, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x20,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x44,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x14,
-    0x00, 0x02, 0x00, 0x1a, 0x00, 0x20, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xa6, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x44, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x16,
-    0x00, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x44,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x02, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x44, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x44, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x10, 0x00, 0x02, 0x00, 0x16, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x44, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x02, 0x00, 0x16,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x44,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x54, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x02,
-    0x00, 0x16, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x44, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xa7, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x44, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa7,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x44, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x10, 0x00, 0x01, 0x00, 0x16, 0x00, 0x01,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x02,
-    0x00, 0x16, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xa7, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa7,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x10, 0x00, 0x01, 0x00, 0x16, 0x00, 0x01,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x49, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x02,
-    0x00, 0x16, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x49, 0x00, 0x01, 0x00, 0x01, 0x00, 0x49,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xa7, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x49, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa7,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x49, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x10, 0x00, 0x01, 0x00, 0x16, 0x00, 0x01,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x16,
-    0x00, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x44, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01,
-    0x00, 0x16, 0x00, 0x01, 0x00, 0x1c, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x10, 0x00, 0x02, 0x00, 0x16, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x02, 0x00, 0x16,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa8,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x03, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x18, 0x00, 0x02, 0x00, 0x1e,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x03, 0x00, 0x18,
-    0x00, 0x1e, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x03,
-    0x00, 0x02, 0x00, 0x14, 0x00, 0x1a, 0x00, 0x01,
-    0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xaa, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x14, 0x00, 0x01, 0x00, 0x1a, 0x00, 0x01,
-    0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0xab,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x14, 0x00, 0x02, 0x00, 0x1a, 0x00, 0x20,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xab, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x02, 0x00, 0x1e, 0x00, 0x24,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x03, 0x00, 0x18, 0x00, 0x1e,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x02,
-    0x00, 0x14, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xab,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x03, 0x00, 0x01, 0x00, 0x14,
-    0x00, 0x01, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x20,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xab, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x14,
-    0x00, 0x02, 0x00, 0x1a, 0x00, 0x20, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xab, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x02, 0x00, 0x1e, 0x00, 0x24, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x44, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x03, 0x00, 0x18, 0x00, 0x1e, 0x00, 0x24,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x44, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x03, 0x00, 0x02, 0x00, 0x14,
-    0x00, 0x1a, 0x00, 0x01, 0x00, 0x20, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xac, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x14, 0x00, 0x01,
-    0x00, 0x1a, 0x00, 0x01, 0x00, 0x20, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xac, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x44,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x14, 0x00, 0x02,
-    0x00, 0x1a, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xac, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x44, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x14, 0x00, 0x01, 0x00, 0x1a, 0x00, 0x03,
-    0x00, 0x20, 0x00, 0x26, 0x00, 0x2c, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x01, 0x00, 0x01, 0x00, 0x54,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x54, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x14, 0x00, 0x04,
-    0x00, 0x1a, 0x00, 0x20, 0x00, 0x26, 0x00, 0x2c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x54, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x54, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x01, 0x00, 0x01, 0x00, 0x54,
-    0x00, 0x03, 0x00, 0x03, 0x00, 0x16, 0x00, 0x1c,
-    0x00, 0x22, 0x00, 0x01, 0x00, 0x28, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xac, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x54, 0x00, 0x03,
-    0x00, 0x02, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x01,
-    0x00, 0x22, 0x00, 0x01, 0x00, 0x28, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xad, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x54, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x54, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x16, 0x00, 0x01, 0x00, 0x1c, 0x00, 0x02,
-    0x00, 0x22, 0x00, 0x28, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xad, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x54, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x54, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x16, 0x00, 0x03, 0x00, 0x1c, 0x00, 0x22,
-    0x00, 0x28, 0x00, 0x01, 0x00, 0x00, 0x00, 0xad,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x54, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x01, 0x00, 0x01, 0x00, 0x54,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x02, 0x00, 0x1e, 0x00, 0x24,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x54, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x03, 0x00, 0x18, 0x00, 0x1e,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x54,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x54, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x54, 0x00, 0x03, 0x00, 0x02,
-    0x00, 0x14, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xae,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x03, 0x00, 0x01, 0x00, 0x14,
-    0x00, 0x01, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x20,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x01, 0x00, 0x01, 0x00, 0x54,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x14,
-    0x00, 0x02, 0x00, 0x1a, 0x00, 0x20, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xaf, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x54,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x54, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x16,
-    0x00, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x54,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x02, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x54, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x10, 0x00, 0x02, 0x00, 0x16, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x54, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x01, 0x00, 0x18, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x01, 0x00, 0x18, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xb0, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x54,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01,
-    0x00, 0x16, 0x00, 0x01, 0x00, 0x1c, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x44, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x44, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x03, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x01, 0x00, 0x16, 0x00, 0x01, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x44, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x54, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x02, 0x00, 0x16,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x44, 0x00, 0x01, 0x00, 0x01, 0x00, 0x54,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x54, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xb1,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x54, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xb1, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x44, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x03, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x18, 0x00, 0x02, 0x00, 0x1e,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x44, 0x00, 0x01, 0x00, 0x01, 0x00, 0x44,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x03, 0x00, 0x18,
-    0x00, 0x1e, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x44, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x03,
-    0x00, 0x02, 0x00, 0x14, 0x00, 0x1a, 0x00, 0x01,
-    0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xb1, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x14, 0x00, 0x01, 0x00, 0x1a, 0x00, 0x01,
-    0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0xb2,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x14, 0x00, 0x02, 0x00, 0x1a, 0x00, 0x20,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xb2, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x44, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x02, 0x00, 0x1e, 0x00, 0x24,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x44,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x44, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x44, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x03, 0x00, 0x18, 0x00, 0x1e,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x44, 0x00, 0x01, 0x00, 0x01, 0x00, 0x44,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x02,
-    0x00, 0x14, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xb3,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x03, 0x00, 0x01, 0x00, 0x14,
-    0x00, 0x01, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x20,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xb3, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x44, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x14,
-    0x00, 0x02, 0x00, 0x1a, 0x00, 0x20, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xb3, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x44, 0x00, 0x01, 0x00, 0x01, 0x00, 0x44,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x16,
-    0x00, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x44, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x44, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01,
-    0x00, 0x16, 0x00, 0x01, 0x00, 0x1c, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x54, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x44, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x10, 0x00, 0x02, 0x00, 0x16, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x44,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x01, 0x00, 0x18, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x01, 0x00, 0x18, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xb4, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x44, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01,
-    0x00, 0x16, 0x00, 0x01, 0x00, 0x1c, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x10, 0x00, 0x02, 0x00, 0x16, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x02, 0x00, 0x16,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x02,
-    0x00, 0x16, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x44,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01,
-    0x00, 0x16, 0x00, 0x01, 0x00, 0x1c, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x03, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x01, 0x00, 0x16, 0x00, 0x01, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x47,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x01, 0x00, 0x18, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xb5, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x01, 0x00, 0x18, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xb6, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x02, 0x00, 0x1e, 0x00, 0x24,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x03, 0x00, 0x18, 0x00, 0x1e,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x02,
-    0x00, 0x14, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xb7,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x03, 0x00, 0x01, 0x00, 0x14,
-    0x00, 0x01, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x20,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x14,
-    0x00, 0x02, 0x00, 0x1a, 0x00, 0x20, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xb8, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x16,
-    0x00, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x02, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x10, 0x00, 0x02, 0x00, 0x16, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x01, 0x00, 0x18, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x01, 0x00, 0x18, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xb8, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01,
-    0x00, 0x16, 0x00, 0x01, 0x00, 0x1c, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x49, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x10, 0x00, 0x02, 0x00, 0x16, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x49, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x49, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x01, 0x00, 0x18, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x49, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x01, 0x00, 0x18, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xb8, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x49,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01,
-    0x00, 0x16, 0x00, 0x01, 0x00, 0x1c, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x63, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x10, 0x00, 0x02, 0x00, 0x16, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x63, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x63, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x01, 0x00, 0x18, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x63, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x01, 0x00, 0x18, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xb8, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x63,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x02, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x03, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x01, 0x00, 0x16, 0x00, 0x01, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x02, 0x00, 0x16,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x02,
-    0x00, 0x16, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xb9, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x01, 0x00, 0x00, 0x00, 0xb9,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x03, 0x00, 0x18,
-    0x00, 0x1e, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x02, 0x00, 0x1e, 0x00, 0x24, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xba, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x14, 0x00, 0x01, 0x00, 0x1a,
-    0x00, 0x01, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xba, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x14, 0x00, 0x02, 0x00, 0x1a,
-    0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0xba,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x03, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x18, 0x00, 0x02, 0x00, 0x1e,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x03, 0x00, 0x18,
-    0x00, 0x1e, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x03,
-    0x00, 0x18, 0x00, 0x1e, 0x00, 0x24, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x03, 0x00, 0x02, 0x00, 0x14, 0x00, 0x1a,
-    0x00, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xbb, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x14, 0x00, 0x01, 0x00, 0x1a,
-    0x00, 0x01, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xbc, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x14, 0x00, 0x02, 0x00, 0x1a,
-    0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0xbc,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x03, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x18, 0x00, 0x02, 0x00, 0x1e,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x54, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x03, 0x00, 0x18,
-    0x00, 0x1e, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x03,
-    0x00, 0x02, 0x00, 0x14, 0x00, 0x1a, 0x00, 0x01,
-    0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xbc, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x14, 0x00, 0x01, 0x00, 0x1a, 0x00, 0x01,
-    0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0xbc,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x54, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x14, 0x00, 0x02, 0x00, 0x1a, 0x00, 0x20,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x02, 0x00, 0x1e, 0x00, 0x24,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x56,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x56, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x54, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x56, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x03, 0x00, 0x18, 0x00, 0x1e,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x56, 0x00, 0x01, 0x00, 0x01, 0x00, 0x54,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x56, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x56, 0x00, 0x03, 0x00, 0x02,
-    0x00, 0x14, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xbc,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x56, 0x00, 0x03, 0x00, 0x01, 0x00, 0x14,
-    0x00, 0x01, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x20,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x01, 0x00, 0x01, 0x00, 0x56,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x14,
-    0x00, 0x02, 0x00, 0x1a, 0x00, 0x20, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xbd, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x56, 0x00, 0x01, 0x00, 0x01, 0x00, 0x54,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x56, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x16,
-    0x00, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4d, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4d, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01,
-    0x00, 0x16, 0x00, 0x01, 0x00, 0x1c, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4d, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x10, 0x00, 0x02, 0x00, 0x16, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4d,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x01, 0x00, 0x18, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xbd, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x01, 0x00, 0x18, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xbd, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4d, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01,
-    0x00, 0x16, 0x00, 0x01, 0x00, 0x1c, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4d, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4d, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4d, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x10, 0x00, 0x02, 0x00, 0x16, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4d,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4d, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4d, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x01, 0x00, 0x18, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xbe, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4d, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x01, 0x00, 0x18, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xbf, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4d, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4d,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x02, 0x00, 0x1e, 0x00, 0x24,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4d,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4d, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x03, 0x00, 0x18, 0x00, 0x1e,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4d, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x03, 0x00, 0x02,
-    0x00, 0x14, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xbf,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x03, 0x00, 0x01, 0x00, 0x14,
-    0x00, 0x01, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x20,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x14,
-    0x00, 0x02, 0x00, 0x1a, 0x00, 0x20, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xc0, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4d, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x02, 0x00, 0x1e, 0x00, 0x24, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4d, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x03, 0x00, 0x18, 0x00, 0x1e, 0x00, 0x24,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4d, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x03, 0x00, 0x02, 0x00, 0x14,
-    0x00, 0x1a, 0x00, 0x01, 0x00, 0x20, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x14, 0x00, 0x01,
-    0x00, 0x1a, 0x00, 0x01, 0x00, 0x20, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xc1, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4d,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x14, 0x00, 0x02,
-    0x00, 0x1a, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xc2, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4d, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x10, 0x00, 0x01, 0x00, 0x16, 0x00, 0x01,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x16,
-    0x00, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01,
-    0x00, 0x16, 0x00, 0x01, 0x00, 0x1c, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x54, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x10, 0x00, 0x02, 0x00, 0x16, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x02, 0x00, 0x16,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc2,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x03, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x01, 0x00, 0x16, 0x00, 0x01, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x02, 0x00, 0x16,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x02,
-    0x00, 0x16, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xc3, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc4,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x01, 0x00, 0x18, 0x00, 0x02,
-    0x00, 0x1e, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x03,
-    0x00, 0x18, 0x00, 0x1e, 0x00, 0x24, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x03, 0x00, 0x02, 0x00, 0x14, 0x00, 0x1a,
-    0x00, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xc5, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x14, 0x00, 0x01, 0x00, 0x1a,
-    0x00, 0x01, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xc6, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x14, 0x00, 0x02, 0x00, 0x1a,
-    0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc6,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x03, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x18, 0x00, 0x02, 0x00, 0x1e,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x49, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x03, 0x00, 0x18,
-    0x00, 0x1e, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x49, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x03,
-    0x00, 0x02, 0x00, 0x14, 0x00, 0x1a, 0x00, 0x01,
-    0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xc7, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x14, 0x00, 0x01, 0x00, 0x1a, 0x00, 0x01,
-    0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc7,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x49, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x14, 0x00, 0x02, 0x00, 0x1a, 0x00, 0x20,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x49, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01,
-    0x00, 0x16, 0x00, 0x01, 0x00, 0x1c, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x49, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x03, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x01, 0x00, 0x16, 0x00, 0x01, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x49,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x49, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x02, 0x00, 0x16,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x49, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc9,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xc9, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x49, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x03, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x01, 0x00, 0x16, 0x00, 0x01, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x49,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x49, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x02, 0x00, 0x16,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x49, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc9,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xc9, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x49, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x03, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x01, 0x00, 0x16, 0x00, 0x01, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x49,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x49, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x02, 0x00, 0x16,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x49, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc9,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xc9, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x49, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x03, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x01, 0x00, 0x16, 0x00, 0x01, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x49,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x49, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x49, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x02, 0x00, 0x16,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x49, 0x00, 0x01, 0x00, 0x01, 0x00, 0x49,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x49, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x02,
-    0x00, 0x16, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x49, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x49, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xca, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x49, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x01, 0x00, 0x00, 0x00, 0xcb,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x49, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x49, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x10, 0x00, 0x01, 0x00, 0x16, 0x00, 0x01,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4a, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4a,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4a, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x02,
-    0x00, 0x16, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4a, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4a, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4a,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xcb, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4a, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x01, 0x00, 0x00, 0x00, 0xcc,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4a, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4a, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x01, 0x00, 0x18, 0x00, 0x02,
-    0x00, 0x1e, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x49, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x49, 0x00, 0x01, 0x00, 0x01, 0x00, 0x49,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x49, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x03,
-    0x00, 0x18, 0x00, 0x1e, 0x00, 0x24, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x49, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x49, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x49, 0x00, 0x01, 0x00, 0x01, 0x00, 0x49,
-    0x00, 0x03, 0x00, 0x02, 0x00, 0x14, 0x00, 0x1a,
-    0x00, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xcc, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x49, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x14, 0x00, 0x01, 0x00, 0x1a,
-    0x00, 0x01, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xcd, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x49, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x49, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x14, 0x00, 0x02, 0x00, 0x1a,
-    0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0xcd,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x49, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x49, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x49, 0x00, 0x03, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x01, 0x00, 0x16, 0x00, 0x01, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x49,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x49, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4e, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x02, 0x00, 0x16,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x49, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4e,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4e, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x02,
-    0x00, 0x16, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x49, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4e, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xcd, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4e, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x01, 0x00, 0x00, 0x00, 0xcd,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x49, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4e, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x01, 0x00, 0x18, 0x00, 0x02,
-    0x00, 0x1e, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x49, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x49, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4e,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x03,
-    0x00, 0x18, 0x00, 0x1e, 0x00, 0x24, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x49, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4e, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x03, 0x00, 0x02, 0x00, 0x14, 0x00, 0x1a,
-    0x00, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xcd, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x14, 0x00, 0x01, 0x00, 0x1a,
-    0x00, 0x01, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xce, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4e, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x14, 0x00, 0x02, 0x00, 0x1a,
-    0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0xce,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x49, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4e, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x03, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x18, 0x00, 0x02, 0x00, 0x1e,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x49, 0x00, 0x01, 0x00, 0x01, 0x00, 0x49,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x49, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x03, 0x00, 0x18,
-    0x00, 0x1e, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x49, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x49, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x03,
-    0x00, 0x02, 0x00, 0x14, 0x00, 0x1a, 0x00, 0x01,
-    0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xce, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x14, 0x00, 0x01, 0x00, 0x1a, 0x00, 0x01,
-    0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0xce,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x49, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x14, 0x00, 0x02, 0x00, 0x1a, 0x00, 0x20,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xce, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x49, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x49, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x16, 0x00, 0x01,
-    0x00, 0x1c, 0x00, 0x04, 0x00, 0x22, 0x00, 0x28,
-    0x00, 0x2e, 0x00, 0x34, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x54, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x01, 0x00, 0x01, 0x00, 0x54,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x54, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x14, 0x00, 0x04, 0x00, 0x1a, 0x00, 0x20,
-    0x00, 0x26, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x54, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x01, 0x00, 0x01, 0x00, 0x54,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x54, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x03,
-    0x00, 0x16, 0x00, 0x1c, 0x00, 0x22, 0x00, 0x01,
-    0x00, 0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xce, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x03, 0x00, 0x02, 0x00, 0x16,
-    0x00, 0x1c, 0x00, 0x01, 0x00, 0x22, 0x00, 0x01,
-    0x00, 0x28, 0x00, 0x01, 0x00, 0x00, 0x00, 0xce,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x16, 0x00, 0x01,
-    0x00, 0x1c, 0x00, 0x02, 0x00, 0x22, 0x00, 0x28,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xce, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x01, 0x00, 0x01, 0x00, 0x54,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x16, 0x00, 0x03,
-    0x00, 0x1c, 0x00, 0x22, 0x00, 0x28, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xce, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x01, 0x00, 0x01, 0x00, 0x54,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x54, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x14, 0x00, 0x01, 0x00, 0x1a, 0x00, 0x03,
-    0x00, 0x20, 0x00, 0x26, 0x00, 0x2c, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x54, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x54, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x03,
-    0x00, 0x18, 0x00, 0x1e, 0x00, 0x24, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x54, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x54, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x03, 0x00, 0x02, 0x00, 0x14, 0x00, 0x1a,
-    0x00, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xcf, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x14, 0x00, 0x01, 0x00, 0x1a,
-    0x00, 0x01, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xcf, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x54, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x14, 0x00, 0x02, 0x00, 0x1a,
-    0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0xcf,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x54, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x54, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x03, 0x00, 0x01, 0x00, 0x14,
-    0x00, 0x01, 0x00, 0x1a, 0x00, 0x03, 0x00, 0x20,
-    0x00, 0x26, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x54, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x01, 0x00, 0x01, 0x00, 0x54,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x44, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x44, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x03, 0x00, 0x18,
-    0x00, 0x1e, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x54, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x01, 0x00, 0x01, 0x00, 0x54,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x44, 0x00, 0x03,
-    0x00, 0x02, 0x00, 0x14, 0x00, 0x1a, 0x00, 0x01,
-    0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xcf, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x44, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x14, 0x00, 0x01, 0x00, 0x1a, 0x00, 0x01,
-    0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0xcf,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x54, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x44, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x14, 0x00, 0x02, 0x00, 0x1a, 0x00, 0x20,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xcf, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x54, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x01, 0x00, 0x01, 0x00, 0x44,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x14, 0x00, 0x01,
-    0x00, 0x1a, 0x00, 0x03, 0x00, 0x20, 0x00, 0x26,
-    0x00, 0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x01, 0x00, 0x01, 0x00, 0x54,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x54, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x03, 0x00, 0x18, 0x00, 0x1e,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x01, 0x00, 0x01, 0x00, 0x54,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x54, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x03, 0x00, 0x02,
-    0x00, 0x14, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xcf,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x03, 0x00, 0x01, 0x00, 0x14,
-    0x00, 0x01, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x20,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xcf, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x14,
-    0x00, 0x02, 0x00, 0x1a, 0x00, 0x20, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xcf, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x01, 0x00, 0x01, 0x00, 0x54,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x02, 0x00, 0x1e, 0x00, 0x24, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x54, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x54, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x02, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x54, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x54, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x03, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xd0, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x18, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xd0, 0x00, 0x01, 0x00, 0x01, 0x00, 0x54,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x16,
-    0x00, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x54, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x01, 0x00, 0x01, 0x00, 0x44,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x02, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x54, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x44, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x44, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x10, 0x00, 0x02, 0x00, 0x16, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x54,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x44, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x01, 0x00, 0x18, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x44, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x01, 0x00, 0x18, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xd0, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x01, 0x00, 0x01, 0x00, 0x44,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01,
-    0x00, 0x16, 0x00, 0x01, 0x00, 0x1c, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x54, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x54, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x10, 0x00, 0x02, 0x00, 0x16, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x54,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x02, 0x00, 0x16,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xd0,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x54, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x03, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x01, 0x00, 0x16, 0x00, 0x01, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x54,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x54, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x54, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x02, 0x00, 0x16,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x01, 0x00, 0x01, 0x00, 0x54,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x54, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x16,
-    0x00, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x55, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x01, 0x00, 0x01, 0x00, 0x54,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x02, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x54, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x54, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x63, 0x00, 0x03, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xd1, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x54,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x18, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xd2, 0x00, 0x01, 0x00, 0x01, 0x00, 0x54,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x54, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x16,
-    0x00, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x44, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x44, 0x00, 0x01, 0x00, 0x01, 0x00, 0x44,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x02, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x44, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x44, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x44, 0x00, 0x03, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xd2, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x44,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x18, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xd3, 0x00, 0x01, 0x00, 0x01, 0x00, 0x44,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x44, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x02, 0x00, 0x1e, 0x00, 0x24, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x44, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x44, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x44, 0x00, 0x01, 0x00, 0x01, 0x00, 0x44,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x03, 0x00, 0x18, 0x00, 0x1e, 0x00, 0x24,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x44,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x44, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x44, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x44, 0x00, 0x03, 0x00, 0x02, 0x00, 0x14,
-    0x00, 0x1a, 0x00, 0x01, 0x00, 0x20, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xd4, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x44,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x14, 0x00, 0x01,
-    0x00, 0x1a, 0x00, 0x01, 0x00, 0x20, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xd5, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x44,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x44, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x14, 0x00, 0x02,
-    0x00, 0x1a, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xd5, 0x00, 0x01, 0x00, 0x01, 0x00, 0x44,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x44, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x44, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x10, 0x00, 0x01, 0x00, 0x16, 0x00, 0x01,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4e, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4e,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4e, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x02,
-    0x00, 0x16, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4e, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4e, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4e,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xd5, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4e, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x01, 0x00, 0x00, 0x00, 0xd6,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4e, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4e, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x10, 0x00, 0x01, 0x00, 0x16, 0x00, 0x01,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4e, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4e,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x49, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x02,
-    0x00, 0x16, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4e, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x49, 0x00, 0x01, 0x00, 0x01, 0x00, 0x49,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x02, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4e, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x49, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x03, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xd6, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x49,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x18, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xd6, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4e,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x49, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x16,
-    0x00, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4e, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4e, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x02, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4e, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x03, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xd6, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x18, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xd6, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4e,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x16,
-    0x00, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4e, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4e, 0x00, 0x01, 0x00, 0x01, 0x00, 0x29,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x02, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4e, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x29, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x29, 0x00, 0x03, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xd6, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x29,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x18, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xd6, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4e,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x29, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x16,
-    0x00, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x62, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x62, 0x00, 0x01, 0x00, 0x01, 0x00, 0x62,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x02, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x62, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x62, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x62, 0x00, 0x03, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xd6, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x62,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x18, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xd7, 0x00, 0x01, 0x00, 0x01, 0x00, 0x62,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x62, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x16,
-    0x00, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x62, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x62, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x02, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x62, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x10, 0x00, 0x02, 0x00, 0x16, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x62,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x01, 0x00, 0x18, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xd7, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x01, 0x00, 0x18, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xd7, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x62, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x02, 0x00, 0x1e, 0x00, 0x24,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x62,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x62, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x62, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x62, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x03, 0x00, 0x18, 0x00, 0x1e,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x62, 0x00, 0x01, 0x00, 0x01, 0x00, 0x62,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x62, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x62, 0x00, 0x03, 0x00, 0x02,
-    0x00, 0x14, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xd8,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x62, 0x00, 0x03, 0x00, 0x01, 0x00, 0x14,
-    0x00, 0x01, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x20,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xd9, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x62, 0x00, 0x01, 0x00, 0x01, 0x00, 0x62,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x14,
-    0x00, 0x02, 0x00, 0x1a, 0x00, 0x20, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xd9, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x62, 0x00, 0x01, 0x00, 0x01, 0x00, 0x62,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x62, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x16,
-    0x00, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x29, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x29, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x02, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x29, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x03, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xd9, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x18, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xd9, 0x00, 0x01, 0x00, 0x01, 0x00, 0x29,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x16,
-    0x00, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x29, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x29, 0x00, 0x01, 0x00, 0x01, 0x00, 0x44,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x02, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x29, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x44, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x44, 0x00, 0x03, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xd9, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x44,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x18, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xd9, 0x00, 0x01, 0x00, 0x01, 0x00, 0x29,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x44, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x16,
-    0x00, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x56, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x56, 0x00, 0x01, 0x00, 0x01, 0x00, 0x56,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x02, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x56, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x56, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x56, 0x00, 0x03, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xd9, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x56,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x18, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xda, 0x00, 0x01, 0x00, 0x01, 0x00, 0x56,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x56, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x02, 0x00, 0x1e, 0x00, 0x24, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x47, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x03, 0x00, 0x18, 0x00, 0x1e, 0x00, 0x24,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x47, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x03, 0x00, 0x02, 0x00, 0x14,
-    0x00, 0x1a, 0x00, 0x01, 0x00, 0x20, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xda, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x14, 0x00, 0x01,
-    0x00, 0x1a, 0x00, 0x01, 0x00, 0x20, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xda, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x47,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x14, 0x00, 0x02,
-    0x00, 0x1a, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xdb, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x47, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x01, 0x00, 0x18, 0x00, 0x02,
-    0x00, 0x1e, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x44,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x03,
-    0x00, 0x18, 0x00, 0x1e, 0x00, 0x24, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x44, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x03, 0x00, 0x02, 0x00, 0x14, 0x00, 0x1a,
-    0x00, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xdb, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x14, 0x00, 0x01, 0x00, 0x1a,
-    0x00, 0x01, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xdb, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x44, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x14, 0x00, 0x02, 0x00, 0x1a,
-    0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0xdc,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x44, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x03, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x18, 0x00, 0x02, 0x00, 0x1e,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x03, 0x00, 0x18,
-    0x00, 0x1e, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x03,
-    0x00, 0x02, 0x00, 0x14, 0x00, 0x1a, 0x00, 0x01,
-    0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xdd, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x14, 0x00, 0x01, 0x00, 0x1a, 0x00, 0x01,
-    0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0xdd,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x14, 0x00, 0x02, 0x00, 0x1a, 0x00, 0x20,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xde, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x14, 0x00, 0x01,
-    0x00, 0x1a, 0x00, 0x03, 0x00, 0x20, 0x00, 0x26,
-    0x00, 0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x14, 0x00, 0x04, 0x00, 0x1a, 0x00, 0x20,
-    0x00, 0x26, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x02,
-    0x00, 0x14, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xde,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x03, 0x00, 0x02, 0x00, 0x16,
-    0x00, 0x1c, 0x00, 0x01, 0x00, 0x22, 0x00, 0x01,
-    0x00, 0x28, 0x00, 0x01, 0x00, 0x00, 0x00, 0xde,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x16, 0x00, 0x01,
-    0x00, 0x1c, 0x00, 0x02, 0x00, 0x22, 0x00, 0x28,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xde, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x16, 0x00, 0x03,
-    0x00, 0x1c, 0x00, 0x22, 0x00, 0x28, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xde, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x01, 0x00, 0x18, 0x00, 0x02,
-    0x00, 0x1e, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x03,
-    0x00, 0x18, 0x00, 0x1e, 0x00, 0x24, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x03, 0x00, 0x02, 0x00, 0x14, 0x00, 0x1a,
-    0x00, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xdf, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x14, 0x00, 0x01, 0x00, 0x1a,
-    0x00, 0x01, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xdf, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x14, 0x00, 0x02, 0x00, 0x1a,
-    0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0xdf,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x03, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x18, 0x00, 0x02, 0x00, 0x1e,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x03, 0x00, 0x18,
-    0x00, 0x1e, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x03,
-    0x00, 0x02, 0x00, 0x14, 0x00, 0x1a, 0x00, 0x01,
-    0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xe0, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x14, 0x00, 0x01, 0x00, 0x1a, 0x00, 0x01,
-    0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0xe1,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x14, 0x00, 0x02, 0x00, 0x1a, 0x00, 0x20,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xe1, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x02, 0x00, 0x1e, 0x00, 0x24,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x03, 0x00, 0x18, 0x00, 0x1e,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x02,
-    0x00, 0x14, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xe2,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x03, 0x00, 0x01, 0x00, 0x14,
-    0x00, 0x01, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x20,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xe2, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x14,
-    0x00, 0x02, 0x00, 0x1a, 0x00, 0x20, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xe3, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x02, 0x00, 0x1e, 0x00, 0x24, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x03, 0x00, 0x18, 0x00, 0x1e, 0x00, 0x24,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x03, 0x00, 0x02, 0x00, 0x14,
-    0x00, 0x1a, 0x00, 0x01, 0x00, 0x20, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xe3, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x14, 0x00, 0x01,
-    0x00, 0x1a, 0x00, 0x01, 0x00, 0x20, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xe3, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x14, 0x00, 0x02,
-    0x00, 0x1a, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xe3, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x01, 0x00, 0x18, 0x00, 0x02,
-    0x00, 0x1e, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x44, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x03,
-    0x00, 0x18, 0x00, 0x1e, 0x00, 0x24, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x44, 0x00, 0x01, 0x00, 0x01, 0x00, 0x44,
-    0x00, 0x03, 0x00, 0x02, 0x00, 0x14, 0x00, 0x1a,
-    0x00, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xe3, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x44, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x14, 0x00, 0x01, 0x00, 0x1a,
-    0x00, 0x01, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xe3, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x44, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x14, 0x00, 0x02, 0x00, 0x1a,
-    0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0xe3,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x44, 0x00, 0x03, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x01, 0x00, 0x16, 0x00, 0x01, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x44, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x02, 0x00, 0x16,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x44,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x44, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xe4,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x44, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x44, 0x00, 0x03, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x01, 0x00, 0x16, 0x00, 0x01, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x8e, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x02, 0x00, 0x16,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x8e,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x8e, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x02,
-    0x00, 0x16, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x8e, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xe4, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x8e, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x01, 0x00, 0x00, 0x00, 0xe4,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x8e, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x10, 0x00, 0x01, 0x00, 0x16, 0x00, 0x01,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x8e, 0x00, 0x01, 0x00, 0x01, 0x00, 0x8e,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x8e, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x16,
-    0x00, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x8e, 0x00, 0x01, 0x00, 0x01, 0x00, 0x8e,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x02, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x8e, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x8e, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x8e, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x10, 0x00, 0x02, 0x00, 0x16, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x8e,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x8e, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x01, 0x00, 0x18, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xe5, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x8e, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x01, 0x00, 0x18, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xe6, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x8e, 0x00, 0x01, 0x00, 0x01, 0x00, 0x8e,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x02, 0x00, 0x1e, 0x00, 0x24,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x8e, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x03, 0x00, 0x18, 0x00, 0x1e,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x8e,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x02,
-    0x00, 0x14, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xe6,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x03, 0x00, 0x01, 0x00, 0x14,
-    0x00, 0x01, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x20,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xe6, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x8e, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x14,
-    0x00, 0x02, 0x00, 0x1a, 0x00, 0x20, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xe6, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x8e,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x16,
-    0x00, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x44, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x44, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x02, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x44, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x03, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xe7, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x18, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xe7, 0x00, 0x01, 0x00, 0x01, 0x00, 0x44,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x02, 0x00, 0x1e, 0x00, 0x24, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x44, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x44, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x03, 0x00, 0x18, 0x00, 0x1e, 0x00, 0x24,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x44,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x03, 0x00, 0x02, 0x00, 0x14,
-    0x00, 0x1a, 0x00, 0x01, 0x00, 0x20, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x14, 0x00, 0x01,
-    0x00, 0x1a, 0x00, 0x01, 0x00, 0x20, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xe9, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x14, 0x00, 0x02,
-    0x00, 0x1a, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xe9, 0x00, 0x01, 0x00, 0x01, 0x00, 0x44,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x01, 0x00, 0x18, 0x00, 0x02,
-    0x00, 0x1e, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x03,
-    0x00, 0x18, 0x00, 0x1e, 0x00, 0x24, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x03, 0x00, 0x02, 0x00, 0x14, 0x00, 0x1a,
-    0x00, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xea, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x14, 0x00, 0x01, 0x00, 0x1a,
-    0x00, 0x01, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xeb, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x14, 0x00, 0x02, 0x00, 0x1a,
-    0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0xeb,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x03, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x18, 0x00, 0x02, 0x00, 0x1e,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x44, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x54, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x03, 0x00, 0x18,
-    0x00, 0x1e, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x44, 0x00, 0x01, 0x00, 0x01, 0x00, 0x54,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x54, 0x00, 0x03,
-    0x00, 0x02, 0x00, 0x14, 0x00, 0x1a, 0x00, 0x01,
-    0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xeb, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x54, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x14, 0x00, 0x01, 0x00, 0x1a, 0x00, 0x01,
-    0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0xeb,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x44, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x14, 0x00, 0x02, 0x00, 0x1a, 0x00, 0x20,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xeb, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x44, 0x00, 0x01, 0x00, 0x01, 0x00, 0x54,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x02, 0x00, 0x1e, 0x00, 0x24,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x03, 0x00, 0x18, 0x00, 0x1e,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x54, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x54, 0x00, 0x03, 0x00, 0x02,
-    0x00, 0x14, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xec,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x03, 0x00, 0x01, 0x00, 0x14,
-    0x00, 0x01, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x20,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xec, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x01, 0x00, 0x01, 0x00, 0x54,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x14,
-    0x00, 0x02, 0x00, 0x1a, 0x00, 0x20, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xec, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x54, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x16,
-    0x00, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x47, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x47, 0x00, 0x01, 0x00, 0x01, 0x00, 0x48,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x02, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x47, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x48, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x48, 0x00, 0x03, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xec, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x48,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x18, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xec, 0x00, 0x01, 0x00, 0x01, 0x00, 0x47,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x48, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x02,
-    0x00, 0x16, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x48, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x47, 0x00, 0x01, 0x00, 0x01, 0x00, 0x47,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01,
-    0x00, 0x16, 0x00, 0x01, 0x00, 0x1c, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x48, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x47, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x47, 0x00, 0x03, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xed, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x47,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x18, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xed, 0x00, 0x01, 0x00, 0x01, 0x00, 0x48,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x47, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x02, 0x00, 0x1e, 0x00, 0x24, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x54, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x54, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x03, 0x00, 0x18, 0x00, 0x1e, 0x00, 0x24,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x54,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x03, 0x00, 0x02, 0x00, 0x14,
-    0x00, 0x1a, 0x00, 0x01, 0x00, 0x20, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xed, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x14, 0x00, 0x01,
-    0x00, 0x1a, 0x00, 0x01, 0x00, 0x20, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xed, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x14, 0x00, 0x02,
-    0x00, 0x1a, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xed, 0x00, 0x01, 0x00, 0x01, 0x00, 0x54,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x01, 0x00, 0x18, 0x00, 0x02,
-    0x00, 0x1e, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x54, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x01, 0x00, 0x01, 0x00, 0x44,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x03,
-    0x00, 0x18, 0x00, 0x1e, 0x00, 0x24, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x54, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x44, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x03, 0x00, 0x02, 0x00, 0x14, 0x00, 0x1a,
-    0x00, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xee, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x14, 0x00, 0x01, 0x00, 0x1a,
-    0x00, 0x01, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xee, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x44, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x14, 0x00, 0x02, 0x00, 0x1a,
-    0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0xee,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x54, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x44, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x03, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x18, 0x00, 0x02, 0x00, 0x1e,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x8e, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x8e, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x03, 0x00, 0x18,
-    0x00, 0x1e, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x8e, 0x00, 0x01, 0x00, 0x01, 0x00, 0x8e,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x8e, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x03,
-    0x00, 0x18, 0x00, 0x1e, 0x00, 0x24, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x8e, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x8e, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x03, 0x00, 0x02, 0x00, 0x14, 0x00, 0x1a,
-    0x00, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xee, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x8e, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x14, 0x00, 0x01, 0x00, 0x1a,
-    0x00, 0x01, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xef, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x8e, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x8e, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x14, 0x00, 0x02, 0x00, 0x1a,
-    0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0xef,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x8e, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x8e, 0x00, 0x03, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x01, 0x00, 0x16, 0x00, 0x01, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x44,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x44, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x8e, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x02, 0x00, 0x16,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x44, 0x00, 0x01, 0x00, 0x01, 0x00, 0x8e,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x8e, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x02,
-    0x00, 0x16, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x44, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x8e, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xf0, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x8e, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf0,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x44, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x8e, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x01, 0x00, 0x18, 0x00, 0x02,
-    0x00, 0x1e, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x8e, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x8e, 0x00, 0x01, 0x00, 0x01, 0x00, 0x8e,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x03,
-    0x00, 0x18, 0x00, 0x1e, 0x00, 0x24, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x8e, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x8e, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x03, 0x00, 0x02, 0x00, 0x14, 0x00, 0x1a,
-    0x00, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xf0, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x14, 0x00, 0x01, 0x00, 0x1a,
-    0x00, 0x01, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xf1, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x8e, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x14, 0x00, 0x02, 0x00, 0x1a,
-    0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x8e, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x8e, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x03, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x01, 0x00, 0x16, 0x00, 0x01, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x8e,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x8e, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x02, 0x00, 0x16,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x8e, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x8e, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x03, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x01, 0x00, 0x16, 0x00, 0x01, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x8e,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x8e, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x02, 0x00, 0x16,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x8e, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x8e, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x03, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x01, 0x00, 0x16, 0x00, 0x01, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x8e,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x8e, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x44, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x02, 0x00, 0x16,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x8e, 0x00, 0x01, 0x00, 0x01, 0x00, 0x44,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x44, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x44, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x8e, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x44, 0x00, 0x03, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x01, 0x00, 0x16, 0x00, 0x01, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x8e,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x8e, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x61, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x02, 0x00, 0x16,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x8e, 0x00, 0x01, 0x00, 0x01, 0x00, 0x61,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x61, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x61, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x8e, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x61, 0x00, 0x03, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x01, 0x00, 0x16, 0x00, 0x01, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x5c,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x5c, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x02, 0x00, 0x16,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x5c, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x5c, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x03, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x18, 0x00, 0x02, 0x00, 0x1e,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x64, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x03, 0x00, 0x18,
-    0x00, 0x1e, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x64, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x03,
-    0x00, 0x02, 0x00, 0x14, 0x00, 0x1a, 0x00, 0x01,
-    0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xf2, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x14, 0x00, 0x01, 0x00, 0x1a, 0x00, 0x01,
-    0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x64, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x14, 0x00, 0x02, 0x00, 0x1a, 0x00, 0x20,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x64, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01,
-    0x00, 0x16, 0x00, 0x01, 0x00, 0x1c, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x64, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x10, 0x00, 0x02, 0x00, 0x16, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x64, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x64, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x01, 0x00, 0x18, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xf3, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x64, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x01, 0x00, 0x18, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xf3, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x64,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01,
-    0x00, 0x16, 0x00, 0x01, 0x00, 0x1c, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x64, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x64, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x10, 0x00, 0x02, 0x00, 0x16, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x64,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x01, 0x00, 0x18, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xf3, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x01, 0x00, 0x18, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xf4, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x64, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x02, 0x00, 0x1e, 0x00, 0x24,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x45, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x03, 0x00, 0x18, 0x00, 0x1e,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x45,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x02,
-    0x00, 0x14, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf4,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x03, 0x00, 0x01, 0x00, 0x14,
-    0x00, 0x01, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x20,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xf4, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x45, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x14,
-    0x00, 0x02, 0x00, 0x1a, 0x00, 0x20, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xf4, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x45,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x16,
-    0x00, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x45,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x02, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x45, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x45, 0x00, 0x03, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xf5, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x45,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x18, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xf5, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x45, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x16,
-    0x00, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x45, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x45, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x02, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x45, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x03, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xf5, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x01, 0x00, 0x18, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xf6, 0x00, 0x01, 0x00, 0x01, 0x00, 0x45,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x02, 0x00, 0x1e, 0x00, 0x24, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x46, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x12,
-    0x00, 0x03, 0x00, 0x18, 0x00, 0x1e, 0x00, 0x24,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x46, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x03, 0x00, 0x02, 0x00, 0x14,
-    0x00, 0x1a, 0x00, 0x01, 0x00, 0x20, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x01,
-    0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x14, 0x00, 0x01,
-    0x00, 0x1a, 0x00, 0x01, 0x00, 0x20, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xf6, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x46,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x14, 0x00, 0x02,
-    0x00, 0x1a, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xf6, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x46, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x10, 0x00, 0x01, 0x00, 0x16, 0x00, 0x01,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x46, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x02,
-    0x00, 0x16, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x46, 0x00, 0x01, 0x00, 0x01, 0x00, 0x46,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xf7, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x46, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf7,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x46, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x10, 0x00, 0x01, 0x00, 0x16, 0x00, 0x01,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x46, 0x00, 0x01, 0x00, 0x01, 0x00, 0x46,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x02,
-    0x00, 0x16, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x46, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xf7, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf8,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x46, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x01, 0x00, 0x18, 0x00, 0x02,
-    0x00, 0x1e, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x47,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x03,
-    0x00, 0x18, 0x00, 0x1e, 0x00, 0x24, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x47, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x03, 0x00, 0x02, 0x00, 0x14, 0x00, 0x1a,
-    0x00, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xf8, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x14, 0x00, 0x01, 0x00, 0x1a,
-    0x00, 0x01, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xf8, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x47, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x14, 0x00, 0x02, 0x00, 0x1a,
-    0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf8,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x47, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x03, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x01, 0x00, 0x16, 0x00, 0x01, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4b, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x47, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x02, 0x00, 0x16,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x47,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x47, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf9,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x47, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x47, 0x00, 0x03, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x01, 0x00, 0x16, 0x00, 0x01, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x47,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x47, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x02, 0x00, 0x16,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x47, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf9,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x47, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x03, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x01, 0x00, 0x16, 0x00, 0x01, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x51,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x51, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x53, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x02, 0x00, 0x16,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x51, 0x00, 0x01, 0x00, 0x01, 0x00, 0x53,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x53, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xfa,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x53, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x51, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x53, 0x00, 0x03, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x01, 0x00, 0x16, 0x00, 0x01, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x51,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x51, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x55, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x02, 0x00, 0x16,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x51, 0x00, 0x01, 0x00, 0x01, 0x00, 0x55,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x55, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xfa,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x55, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x51, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x55, 0x00, 0x03, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x01, 0x00, 0x16, 0x00, 0x01, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x51,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x51, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x07, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x02, 0x00, 0x16,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x51, 0x00, 0x01, 0x00, 0x01, 0x00, 0x07,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x07, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xfa,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x07, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x51, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x07, 0x00, 0x03, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x01, 0x00, 0x16, 0x00, 0x01, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x51,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x51, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4e, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x02, 0x00, 0x16,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x51, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4e,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4e, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xfa,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4e, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x51, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4e, 0x00, 0x03, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x01, 0x00, 0x16, 0x00, 0x01, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x51,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x51, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x56, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x02, 0x00, 0x16,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x51, 0x00, 0x01, 0x00, 0x01, 0x00, 0x56,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x56, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x02,
-    0x00, 0x16, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x51, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x56, 0x00, 0x01, 0x00, 0x01, 0x00, 0x07,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xfa, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x56, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x01, 0x00, 0x00, 0x00, 0xfa,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x51, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x56, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x10, 0x00, 0x01, 0x00, 0x16, 0x00, 0x01,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x51, 0x00, 0x01, 0x00, 0x01, 0x00, 0x51,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4d, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x02,
-    0x00, 0x16, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x51, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4d, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4d,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xfa, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4d, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x01, 0x00, 0x00, 0x00, 0xfa,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x51, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4d, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x10, 0x00, 0x01, 0x00, 0x16, 0x00, 0x01,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x51, 0x00, 0x01, 0x00, 0x01, 0x00, 0x51,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x49, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x02,
-    0x00, 0x16, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x51, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x49, 0x00, 0x01, 0x00, 0x01, 0x00, 0x49,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xfa, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x49, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x01, 0x00, 0x00, 0x00, 0xfa,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x51, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x49, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x10, 0x00, 0x01, 0x00, 0x16, 0x00, 0x01,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x51, 0x00, 0x01, 0x00, 0x01, 0x00, 0x51,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x02,
-    0x00, 0x16, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x51, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4c, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xfa, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
-    0x00, 0x18, 0x00, 0x01, 0x00, 0x00, 0x00, 0xfa,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x51, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x12, 0x00, 0x01, 0x00, 0x18, 0x00, 0x02,
-    0x00, 0x1e, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x51, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x51, 0x00, 0x01, 0x00, 0x01, 0x00, 0x56,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x07, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x03,
-    0x00, 0x18, 0x00, 0x1e, 0x00, 0x24, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x51, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x56, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x07, 0x00, 0x01, 0x00, 0x01, 0x00, 0x07,
-    0x00, 0x03, 0x00, 0x02, 0x00, 0x14, 0x00, 0x1a,
-    0x00, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0xfb, 0x00, 0x01, 0x00, 0x01,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x07, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x14, 0x00, 0x01, 0x00, 0x1a,
-    0x00, 0x01, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0xfb, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x56, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x07, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x14, 0x00, 0x02, 0x00, 0x1a,
-    0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0xfb,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x51, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x56, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x07, 0x00, 0x03, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x01, 0x00, 0x16, 0x00, 0x01, 0x00, 0x1c,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x63,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x63, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x51, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x02, 0x00, 0x16,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x63, 0x00, 0x01, 0x00, 0x01, 0x00, 0x51,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x51, 0x00, 0x03,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xfc,
-    0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x51, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x18,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x63, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x51, 0x00, 0x01, 0x00, 0x06, 0x01, 0xd2,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x3a, 0x00, 0x01,
-    0x00, 0x06, 0x01, 0xd3, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x51, 0x00, 0x01, 0x00, 0x06, 0x01, 0xb1,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x51, 0x00, 0x01,
-    0x00, 0x06, 0x01, 0xd2, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x51, 0x00, 0x01, 0x00, 0x06, 0x01, 0xb1,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x51, 0x00, 0x01,
-    0x00, 0x06, 0x01, 0xd5, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x51, 0x00, 0x02, 0x00, 0x10, 0x00, 0x05,
-    0x02, 0x07, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x0e, 0x00, 0x01, 0x00, 0x05, 0x00, 0x10,
-    0x00, 0x51, 0x00, 0x54, 0x00, 0x55, 0x00, 0x63,
-    0x00, 0x02, 0x00, 0x0c, 0x00, 0x03, 0x02, 0x08,
-    0x02, 0x05, 0x02, 0x02, 0x00, 0x01, 0x00, 0x03,
-    0x00, 0x4b, 0x00, 0x54, 0x00, 0x55, 0x00, 0x02,
-    0x00, 0x0c, 0x00, 0x03, 0x02, 0x02, 0x02, 0x06,
-    0x02, 0x04, 0x00, 0x01, 0x00, 0x03, 0x00, 0x53,
-    0x00, 0x54, 0x00, 0x63, 0x00, 0x02, 0x00, 0x0a,
-    0x00, 0x02, 0x00, 0x69, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x02, 0x00, 0x47, 0x00, 0x54, 0x00, 0x01,
-    0x00, 0x06, 0x01, 0xbb, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x47, 0x00, 0x01, 0x00, 0x06, 0x01, 0x4b,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x47, 0x00, 0x02,
-    0x00, 0x0a, 0x00, 0x02, 0x02, 0x02, 0x02, 0x0d,
-    0x00, 0x01, 0x00, 0x02, 0x00, 0x47, 0x00, 0x4c,
-    0x00, 0x01, 0x00, 0x06, 0x01, 0xe8, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x02, 0x00, 0x0c,
-    0x00, 0x03, 0x00, 0x6b, 0x02, 0x02, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x03, 0x00, 0x46, 0x00, 0x47,
-    0x00, 0x4c, 0x00, 0x02, 0x00, 0x0a, 0x00, 0x02,
-    0x02, 0x02, 0x00, 0x6c, 0x00, 0x01, 0x00, 0x02,
-    0x00, 0x46, 0x00, 0x47, 0x00, 0x01, 0x00, 0x06,
-    0x01, 0xea, 0x00, 0x01, 0x00, 0x01, 0x00, 0x46,
-    0x00, 0x01, 0x00, 0x06, 0x01, 0xbc, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x46, 0x00, 0x01, 0x00, 0x06,
-    0x00, 0x24, 0x00, 0x01, 0x00, 0x01, 0x00, 0x46,
-    0x00, 0x02, 0x00, 0x0c, 0x00, 0x03, 0x01, 0x95,
-    0x02, 0x02, 0x02, 0x02, 0x00, 0x01, 0x00, 0x03,
-    0x00, 0x45, 0x00, 0x46, 0x00, 0x47, 0x00, 0x01,
-    0x00, 0x06, 0x01, 0xbd, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x45, 0x00, 0x01, 0x00, 0x06, 0x01, 0xdc,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x45, 0x00, 0x02,
-    0x00, 0x0c, 0x00, 0x03, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x27, 0x00, 0x01, 0x00, 0x03, 0x00, 0x29,
-    0x00, 0x45, 0x00, 0x4e, 0x00, 0x01, 0x00, 0x06,
-    0x00, 0x55, 0x00, 0x01, 0x00, 0x01, 0x00, 0x29,
-    0x00, 0x01, 0x00, 0x06, 0x01, 0xd9, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x29, 0x00, 0x01, 0x00, 0x06,
-    0x00, 0x54, 0x00, 0x01, 0x00, 0x01, 0x00, 0x29,
-    0x00, 0x02, 0x00, 0x0c, 0x00, 0x03, 0x02, 0x02,
-    0x00, 0x6d, 0x02, 0x69, 0x00, 0x01, 0x00, 0x03,
-    0x00, 0x29, 0x00, 0x44, 0x00, 0x4b, 0x00, 0x02,
-    0x00, 0x0c, 0x00, 0x03, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x03, 0x00, 0x44,
-    0x00, 0x4b, 0x00, 0x4d, 0x00, 0x02, 0x00, 0x0a,
-    0x00, 0x02, 0x00, 0x70, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x02, 0x00, 0x44, 0x00, 0x4b, 0x00, 0x02,
-    0x00, 0x0e, 0x00, 0x04, 0x02, 0x2f, 0x00, 0x72,
-    0x02, 0x2b, 0x02, 0x02, 0x00, 0x01, 0x00, 0x04,
-    0x00, 0x0f, 0x00, 0x44, 0x00, 0x49, 0x00, 0x4b,
-    0x00, 0x01, 0x00, 0x06, 0x01, 0xb5, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x06,
-    0x01, 0xb7, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x01, 0x00, 0x06, 0x01, 0xf4, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x02, 0x00, 0x0c,
-    0x00, 0x03, 0x00, 0x73, 0x02, 0x02, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x4b,
-    0x00, 0x4c, 0x00, 0x02, 0x00, 0x0e, 0x00, 0x04,
-    0x02, 0x68, 0x02, 0x02, 0x02, 0x02, 0x01, 0xfe,
-    0x00, 0x01, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x44,
-    0x00, 0x4b, 0x00, 0x54, 0x00, 0x02, 0x00, 0x0a,
-    0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x02, 0x00, 0x4b, 0x00, 0x54, 0x00, 0x01,
-    0x00, 0x06, 0x01, 0xa8, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x54, 0x00, 0x02, 0x00, 0x0a, 0x00, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x00, 0x01, 0x00, 0x02,
-    0x00, 0x4b, 0x00, 0x54, 0x00, 0x02, 0x00, 0x0a,
-    0x00, 0x02, 0x02, 0x02, 0x01, 0xfa, 0x00, 0x01,
-    0x00, 0x02, 0x00, 0x4b, 0x00, 0x54, 0x00, 0x02,
-    0x00, 0x0c, 0x00, 0x03, 0x00, 0x6f, 0x02, 0x02,
-    0x02, 0x6f, 0x00, 0x01, 0x00, 0x03, 0x00, 0x0f,
-    0x00, 0x44, 0x00, 0x54, 0x00, 0x02, 0x00, 0x0a,
-    0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x02, 0x00, 0x0f, 0x00, 0x44, 0x00, 0x02,
-    0x00, 0x0a, 0x00, 0x02, 0x00, 0x68, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x02, 0x00, 0x0f, 0x00, 0x44,
-    0x00, 0x02, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x71,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x02, 0x00, 0x0f,
-    0x00, 0x44, 0x00, 0x01, 0x00, 0x06, 0x01, 0xf0,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x01,
-    0x00, 0x06, 0x01, 0xf3, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x0f, 0x00, 0x01, 0x00, 0x06, 0x02, 0x31,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x02,
-    0x00, 0x0e, 0x00, 0x04, 0x02, 0x02, 0x02, 0x2e,
-    0x00, 0x77, 0x02, 0x09, 0x00, 0x01, 0x00, 0x04,
-    0x00, 0x0f, 0x00, 0x49, 0x00, 0x4c, 0x00, 0x63,
-    0x00, 0x02, 0x00, 0x0a, 0x00, 0x02, 0x02, 0x02,
-    0x00, 0x76, 0x00, 0x01, 0x00, 0x02, 0x00, 0x4b,
-    0x00, 0x4c, 0x00, 0x02, 0x00, 0x0a, 0x00, 0x02,
-    0x02, 0x02, 0x02, 0x42, 0x00, 0x01, 0x00, 0x02,
-    0x00, 0x4b, 0x00, 0x4c, 0x00, 0x01, 0x00, 0x06,
-    0x01, 0xf7, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x02, 0x00, 0x10, 0x00, 0x05, 0x02, 0x2a,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x70,
-    0x00, 0x01, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x4b,
-    0x00, 0x4c, 0x00, 0x54, 0x00, 0x56, 0x00, 0x02,
-    0x00, 0x0c, 0x00, 0x03, 0x00, 0x75, 0x02, 0x02,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x03, 0x00, 0x4c,
-    0x00, 0x4d, 0x00, 0x56, 0x00, 0x01, 0x00, 0x06,
-    0x01, 0xd0, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4d,
-    0x00, 0x02, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x79,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x02, 0x00, 0x4c,
-    0x00, 0x4d, 0x00, 0x02, 0x00, 0x0a, 0x00, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x00, 0x01, 0x00, 0x02,
-    0x00, 0x4c, 0x00, 0x4d, 0x00, 0x02, 0x00, 0x0a,
-    0x00, 0x02, 0x02, 0x29, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x02, 0x00, 0x4c, 0x00, 0x4d, 0x00, 0x02,
-    0x00, 0x0a, 0x00, 0x02, 0x01, 0x97, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x02, 0x00, 0x0f, 0x00, 0x4c,
-    0x00, 0x01, 0x00, 0x06, 0x00, 0x28, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x01, 0x00, 0x06,
-    0x01, 0xb6, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x01, 0x00, 0x06, 0x01, 0x48, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4c, 0x00, 0x01, 0x00, 0x06,
-    0x01, 0xb6, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4c,
-    0x00, 0x02, 0x00, 0x0a, 0x00, 0x02, 0x02, 0x02,
-    0x00, 0x78, 0x00, 0x01, 0x00, 0x02, 0x00, 0x49,
-    0x00, 0x4c, 0x00, 0x01, 0x00, 0x06, 0x01, 0xb6,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x02,
-    0x00, 0x0e, 0x00, 0x04, 0x02, 0x2d, 0x02, 0x02,
-    0x02, 0x2c, 0x00, 0x6e, 0x00, 0x01, 0x00, 0x04,
-    0x00, 0x0f, 0x00, 0x49, 0x00, 0x4b, 0x00, 0x4c,
-    0x00, 0x01, 0x00, 0x06, 0x01, 0xd7, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x49, 0x00, 0x02, 0x00, 0x0a,
-    0x00, 0x02, 0x02, 0x02, 0x02, 0x31, 0x00, 0x01,
-    0x00, 0x02, 0x00, 0x49, 0x00, 0x4a, 0x00, 0x02,
-    0x00, 0x0a, 0x00, 0x02, 0x02, 0x25, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x02, 0x00, 0x49, 0x00, 0x4a,
-    0x00, 0x02, 0x00, 0x0c, 0x00, 0x03, 0x02, 0x0a,
-    0x02, 0x02, 0x02, 0x0b, 0x00, 0x01, 0x00, 0x03,
-    0x00, 0x0f, 0x00, 0x49, 0x00, 0x4e, 0x00, 0x02,
-    0x00, 0x10, 0x00, 0x05, 0x01, 0xfd, 0x02, 0x02,
-    0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x05, 0x00, 0x0f, 0x00, 0x49, 0x00, 0x4c,
-    0x00, 0x4e, 0x00, 0x54, 0x00, 0x02, 0x00, 0x0e,
-    0x00, 0x04, 0x01, 0xfb, 0x02, 0x72, 0x02, 0x74,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x04, 0x00, 0x0f,
-    0x00, 0x44, 0x00, 0x4c, 0x00, 0x54, 0x00, 0x02,
-    0x00, 0x0e, 0x00, 0x04, 0x01, 0xf9, 0x02, 0x71,
-    0x02, 0x73, 0x02, 0x02, 0x00, 0x01, 0x00, 0x04,
-    0x00, 0x0f, 0x00, 0x44, 0x00, 0x4c, 0x00, 0x54,
-    0x00, 0x01, 0x00, 0x06, 0x00, 0x28, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x54, 0x00, 0x02, 0x00, 0x0a,
-    0x00, 0x02, 0x01, 0x96, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x02, 0x00, 0x44, 0x00, 0x54, 0x00, 0x01,
-    0x00, 0x06, 0x01, 0xbe, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x44, 0x00, 0x01, 0x00, 0x06, 0x02, 0x0b,
-    0x00, 0x01, 0x00, 0x01, 0x00, 0x44, 0x00, 0x02,
-    0x00, 0x0a, 0x00, 0x02, 0x02, 0x02, 0x02, 0x22,
-    0x00, 0x01, 0x00, 0x02, 0x00, 0x44, 0x00, 0x4e,
-    0x00, 0x02, 0x00, 0x10, 0x00, 0x05, 0x02, 0x1f,
-    0x02, 0x1e, 0x02, 0x28, 0x02, 0x02, 0x00, 0x7b,
-    0x00, 0x01, 0x00, 0x05, 0x00, 0x29, 0x00, 0x49,
-    0x00, 0x4c, 0x00, 0x4e, 0x00, 0x62, 0x00, 0x02,
-    0x00, 0x0a, 0x00, 0x02, 0x02, 0x80, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x02, 0x00, 0x4c, 0x00, 0x62,
-    0x00, 0x01, 0x00, 0x06, 0x01, 0x31, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x62, 0x00, 0x02, 0x00, 0x10,
-    0x00, 0x05, 0x02, 0x02, 0x02, 0x3b, 0x02, 0x3a,
-    0x02, 0x3c, 0x02, 0x02, 0x00, 0x01, 0x00, 0x05,
-    0x00, 0x29, 0x00, 0x44, 0x00, 0x4c, 0x00, 0x56,
-    0x00, 0x62, 0x00, 0x02, 0x00, 0x0c, 0x00, 0x03,
-    0x02, 0x02, 0x02, 0x3d, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x03, 0x00, 0x47, 0x00, 0x4c, 0x00, 0x56,
-    0x00, 0x02, 0x00, 0x0c, 0x00, 0x03, 0x02, 0x02,
-    0x02, 0x3e, 0x02, 0x02, 0x00, 0x01, 0x00, 0x03,
-    0x00, 0x44, 0x00, 0x4b, 0x00, 0x4c, 0x00, 0x01,
-    0x00, 0x06, 0x01, 0xb7, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x02, 0x00, 0x0a, 0x00, 0x02,
-    0x02, 0x41, 0x02, 0x02, 0x00, 0x01, 0x00, 0x02,
-    0x00, 0x4b, 0x00, 0x4c, 0x00, 0x02, 0x00, 0x0c,
-    0x00, 0x03, 0x02, 0x44, 0x02, 0x02, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x4b,
-    0x00, 0x4c, 0x00, 0x02, 0x00, 0x0a, 0x00, 0x02,
-    0x02, 0x45, 0x02, 0x02, 0x00, 0x01, 0x00, 0x02,
-    0x00, 0x0f, 0x00, 0x4c, 0x00, 0x01, 0x00, 0x06,
-    0x02, 0x37, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f,
-    0x00, 0x02, 0x00, 0x0a, 0x00, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x02, 0x00, 0x0f,
-    0x00, 0x4c, 0x00, 0x02, 0x00, 0x0a, 0x00, 0x02,
-    0x02, 0x47, 0x02, 0x02, 0x00, 0x01, 0x00, 0x02,
-    0x00, 0x0f, 0x00, 0x4c, 0x00, 0x02, 0x00, 0x0c,
-    0x00, 0x03, 0x02, 0x02, 0x02, 0x49, 0x02, 0x48,
-    0x00, 0x01, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x44,
-    0x00, 0x4c, 0x00, 0x02, 0x00, 0x0e, 0x00, 0x04,
-    0x02, 0x02, 0x02, 0x4a, 0x02, 0x02, 0x02, 0x57,
-    0x00, 0x01, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x44,
-    0x00, 0x4b, 0x00, 0x8e, 0x00, 0x01, 0x00, 0x06,
-    0x01, 0xca, 0x00, 0x01, 0x00, 0x01, 0x00, 0x8e,
-    0x00, 0x02, 0x00, 0x0c, 0x00, 0x03, 0x02, 0x4b,
-    0x02, 0x02, 0x02, 0x02, 0x00, 0x01, 0x00, 0x03,
-    0x00, 0x0f, 0x00, 0x4b, 0x00, 0x8e, 0x00, 0x02,
-    0x00, 0x0a, 0x00, 0x02, 0x02, 0x02, 0x02, 0x4c,
-    0x00, 0x01, 0x00, 0x02, 0x00, 0x44, 0x00, 0x4b,
-    0x00, 0x01, 0x00, 0x06, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x02, 0x00, 0x0a,
-    0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x02, 0x00, 0x44, 0x00, 0x4b, 0x00, 0x01,
-    0x00, 0x06, 0x02, 0x03, 0x00, 0x01, 0x00, 0x01,
-    0x00, 0x4b, 0x00, 0x02, 0x00, 0x0e, 0x00, 0x04,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x50,
-    0x00, 0x01, 0x00, 0x04, 0x00, 0x44, 0x00, 0x4b,
-    0x00, 0x4c, 0x00, 0x54, 0x00, 0x02, 0x00, 0x10,
-    0x00, 0x05, 0x02, 0x02, 0x02, 0x52, 0x02, 0x02,
-    0x02, 0x02, 0x02, 0x51, 0x00, 0x01, 0x00, 0x05,
-    0x00, 0x47, 0x00, 0x48, 0x00, 0x4b, 0x00, 0x4c,
-    0x00, 0x54, 0x00, 0x02, 0x00, 0x10, 0x00, 0x05,
-    0x02, 0x54, 0x02, 0x53, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x05, 0x00, 0x0f,
-    0x00, 0x47, 0x00, 0x48, 0x00, 0x4c, 0x00, 0x54,
-    0x00, 0x02, 0x00, 0x0e, 0x00, 0x04, 0x02, 0x55,
-    0x02, 0x02, 0x02, 0x02, 0x02, 0x56, 0x00, 0x01,
-    0x00, 0x04, 0x00, 0x0f, 0x00, 0x44, 0x00, 0x54,
-    0x00, 0x8e, 0x00, 0x02, 0x00, 0x0a, 0x00, 0x02,
-    0x02, 0x02, 0x02, 0x02, 0x00, 0x01, 0x00, 0x02,
-    0x00, 0x4b, 0x00, 0x8e, 0x00, 0x02, 0x00, 0x0c,
-    0x00, 0x03, 0x02, 0x59, 0x02, 0x02, 0x02, 0x6c,
-    0x00, 0x01, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x44,
-    0x00, 0x8e, 0x00, 0x02, 0x00, 0x10, 0x00, 0x05,
-    0x02, 0x5a, 0x02, 0x6b, 0x02, 0x6a, 0x02, 0x6d,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x05, 0x00, 0x0f,
-    0x00, 0x44, 0x00, 0x4c, 0x00, 0x61, 0x00, 0x8e,
-    0x00, 0x02, 0x00, 0x10, 0x00, 0x05, 0x02, 0x5b,
-    0x02, 0x02, 0x02, 0x6e, 0x02, 0x02, 0x02, 0x02,
-    0x00, 0x01, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x4b,
-    0x00, 0x4c, 0x00, 0x5c, 0x00, 0x64, 0x00, 0x02,
-    0x00, 0x0c, 0x00, 0x03, 0x02, 0x5d, 0x02, 0x02,
-    0x02, 0x5c, 0x00, 0x01, 0x00, 0x03, 0x00, 0x0f,
-    0x00, 0x4b, 0x00, 0x64, 0x00, 0x02, 0x00, 0x0e,
-    0x00, 0x04, 0x02, 0x5e, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x04, 0x00, 0x0f,
-    0x00, 0x45, 0x00, 0x4b, 0x00, 0x64, 0x00, 0x02,
-    0x00, 0x0c, 0x00, 0x03, 0x02, 0x60, 0x02, 0x5f,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x03, 0x00, 0x0f,
-    0x00, 0x45, 0x00, 0x4b, 0x00, 0x02, 0x00, 0x0e,
-    0x00, 0x04, 0x02, 0x61, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x04, 0x00, 0x0f,
-    0x00, 0x45, 0x00, 0x46, 0x00, 0x4b, 0x00, 0x02,
-    0x00, 0x0c, 0x00, 0x03, 0x02, 0x63, 0x02, 0x62,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x03, 0x00, 0x0f,
-    0x00, 0x46, 0x00, 0x4b, 0x00, 0x02, 0x00, 0x0e,
-    0x00, 0x04, 0x02, 0x65, 0x02, 0x02, 0x02, 0x02,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x04, 0x00, 0x0f,
-    0x00, 0x46, 0x00, 0x47, 0x00, 0x4b, 0x00, 0x02,
-    0x00, 0x0c, 0x00, 0x03, 0x02, 0x66, 0x02, 0x64,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x03, 0x00, 0x0f,
-    0x00, 0x47, 0x00, 0x4b, 0x00, 0x02, 0x00, 0x1a,
-    0x00, 0x0a, 0x02, 0x78, 0x02, 0x02, 0x02, 0x7c,
-    0x02, 0x7e, 0x02, 0x7d, 0x02, 0x79, 0x02, 0x02,
-    0x02, 0x75, 0x02, 0x76, 0x02, 0x7a, 0x00, 0x01,
-    0x00, 0x0a, 0x00, 0x07, 0x00, 0x47, 0x00, 0x49,
-    0x00, 0x4c, 0x00, 0x4d, 0x00, 0x4e, 0x00, 0x51,
-    0x00, 0x53, 0x00, 0x55, 0x00, 0x56, 0x00, 0x02,
-    0x00, 0x0c, 0x00, 0x03, 0x02, 0x7b, 0x02, 0x02,
-    0x02, 0x02, 0x00, 0x01, 0x00, 0x03, 0x00, 0x07,
-    0x00, 0x51, 0x00, 0x56, 0x00, 0x02, 0x00, 0x0a,
-    0x00, 0x02, 0x02, 0x77, 0x02, 0x02, 0x00, 0x01,
-    0x00, 0x02, 0x00, 0x51, 0x00, 0x63, 0x00, 0x00,
-    0x00, 0x04, 0x02, 0x59, 0x01, 0x90, 0x00, 0x05,
-    0x00, 0x04, 0x02, 0x8a, 0x02, 0x58, 0x00, 0x00,
-    0x00, 0x4b, 0x02, 0x8a, 0x02, 0x58, 0x00, 0x00,
-    0x01, 0x5e, 0x00, 0x2d, 0x01, 0x45, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x02, 0x07, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x4a, 0x42, 0x20, 0x20, 0x00, 0xc0,
-    0x00, 0x00, 0xfb, 0x02, 0x03, 0xd9, 0xff, 0x10,
-    0x00, 0x00, 0x03, 0xd9, 0x00, 0xf5, 0x00, 0x00,
-    0x00, 0x97, 0x00, 0x00, 0x00, 0x00, 0x02, 0x26,
-    0x02, 0xd0, 0x00, 0x00, 0x00, 0x20, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
-    0x00, 0x00, 0x02, 0x28, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1c, 0x00, 0x03, 0x00, 0x01,
-    0x00, 0x00, 0x02, 0x28, 0x00, 0x06, 0x02, 0x0a,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x00, 0x4d, 0x00, 0x50, 0x00, 0x51, 0x00, 0x64,
-    0x00, 0x52, 0x00, 0x62, 0x00, 0x4f, 0x00, 0x07,
-    0x00, 0x57, 0x00, 0x46, 0x00, 0x45, 0x00, 0x39,
-    0x00, 0x44, 0x00, 0x29, 0x00, 0x47, 0x00, 0x3a,
-    0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3e,
-    0x00, 0x3f, 0x00, 0x40, 0x00, 0x41, 0x00, 0x42,
-    0x00, 0x43, 0x00, 0x49, 0x00, 0x4a, 0x00, 0x4b,
-    0x00, 0x4c, 0x00, 0x0f, 0x00, 0x4e, 0x00, 0x61,
-    0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14,
-    0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x04,
-    0x00, 0x18, 0x00, 0x19, 0x00, 0x1a, 0x00, 0x1b,
-    0x00, 0x1c, 0x00, 0x1d, 0x00, 0x0b, 0x00, 0x1e,
-    0x00, 0x1f, 0x00, 0x20, 0x00, 0x21, 0x00, 0x22,
-    0x00, 0x23, 0x00, 0x24, 0x00, 0x25, 0x00, 0x26,
-    0x00, 0x27, 0x00, 0x28, 0x00, 0x55, 0x00, 0x48,
-    0x00, 0x63, 0x00, 0x5c, 0x00, 0x56, 0x00, 0x92,
-    0x00, 0x2a, 0x00, 0x2b, 0x00, 0x2c, 0x00, 0x58,
-    0x00, 0x2d, 0x00, 0x2e, 0x00, 0x0e, 0x00, 0x0c,
-    0x00, 0x09, 0x00, 0x2f, 0x00, 0x0d, 0x00, 0x0a,
-    0x00, 0x30, 0x00, 0x05, 0x00, 0x08, 0x00, 0x06,
-    0x00, 0x59, 0x00, 0x31, 0x00, 0x32, 0x00, 0x33,
-    0x00, 0x5a, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36,
-    0x00, 0x37, 0x00, 0x38, 0x00, 0x53, 0x00, 0x54,
-    0x00, 0x10, 0x00, 0x8e, 0x00, 0x00, 0x00, 0xa7,
-    0x00, 0xa8, 0x00, 0xa9, 0x00, 0xab, 0x00, 0xd8,
-    0x00, 0xb6, 0x00, 0xbb, 0x00, 0xbf, 0x00, 0x95,
-    0x00, 0xc0, 0x00, 0x9a, 0x00, 0xc1, 0x00, 0xc2,
-    0x00, 0xa2, 0x00, 0xc4, 0x00, 0xc3, 0x00, 0xc5,
-    0x00, 0xc6, 0x00, 0xc8, 0x00, 0xc7, 0x00, 0xc9,
-    0x00, 0xca, 0x00, 0x96, 0x00, 0xcc, 0x00, 0xcb,
-    0x00, 0xcd, 0x00, 0xcf, 0x00, 0xce, 0x00, 0xd2,
-    0x00, 0xd1, 0x00, 0xd3, 0x00, 0xd4, 0x01, 0x89,
-    0x01, 0x43, 0x01, 0x75, 0x01, 0x76, 0x01, 0x73,
-    0x00, 0x80, 0x01, 0x68, 0x01, 0x6e, 0x01, 0x58,
-    0x01, 0x57, 0x01, 0x71, 0x00, 0x93, 0x00, 0x99,
-    0x01, 0xdc, 0x01, 0x6c, 0x00, 0xdc, 0x02, 0x17,
-    0x00, 0x5f, 0x02, 0x32, 0x02, 0x33, 0x01, 0x77,
-    0x01, 0x69, 0x02, 0x18, 0x02, 0x14, 0x02, 0x10,
-    0x02, 0x15, 0x02, 0x11, 0x01, 0x78, 0x01, 0x79,
-    0x02, 0x12, 0x01, 0x6d, 0x00, 0xdd, 0x01, 0x5a,
-    0x01, 0x59, 0x01, 0x70, 0x02, 0x16, 0x01, 0x72,
-    0x02, 0x19, 0x02, 0x13, 0x00, 0x83, 0x00, 0x82,
-    0x01, 0x67, 0x00, 0x00, 0x00, 0xa3, 0x00, 0xa6,
-    0x00, 0xb5, 0x01, 0x6a, 0x01, 0x6b, 0x00, 0x66,
-    0x00, 0x5b, 0x00, 0x88, 0x00, 0x89, 0x00, 0x86,
-    0x00, 0x87, 0x00, 0x5d, 0x02, 0x1a, 0x00, 0xd6,
-    0x00, 0xbc, 0x01, 0x84, 0x00, 0x7f, 0x00, 0x84,
-    0x00, 0x85, 0x02, 0x38, 0x02, 0x39, 0x01, 0x8a,
-    0x00, 0x67, 0x00, 0x8a, 0x00, 0x8b, 0x01, 0x88,
-    0x00, 0xa5, 0x00, 0xac, 0x00, 0xa4, 0x00, 0xad,
-    0x00, 0xaa, 0x00, 0xaf, 0x00, 0xb0, 0x00, 0xb1,
-    0x00, 0xae, 0x00, 0xb3, 0x00, 0xb4, 0x00, 0x00,
-    0x00, 0xb2, 0x00, 0xb9, 0x00, 0xba, 0x00, 0xb8,
-    0x00, 0x7a, 0x00, 0x9b, 0x00, 0x8c, 0x00, 0x8d,
-    0x00, 0x8f, 0x00, 0x90, 0x00, 0x91, 0x00, 0x9e,
-    0x00, 0x94, 0x00, 0x9f, 0x00, 0x9c, 0x00, 0x00,
-    0x00, 0x04, 0x05, 0x3e, 0x00, 0x00, 0x00, 0x68,
-    0x00, 0x40, 0x00, 0x05, 0x00, 0x28, 0x00, 0x00,
-    0x00, 0x0a, 0x00, 0x0d, 0x00, 0x7e, 0x00, 0xac,
-    0x01, 0x7f, 0x01, 0x92, 0x02, 0x1b, 0x02, 0x37,
-    0x02, 0xc7, 0x02, 0xc9, 0x02, 0xdd, 0x03, 0xbc,
-    0x03, 0xc0, 0x04, 0x0c, 0x04, 0x4f, 0x04, 0x5c,
-    0x04, 0x5f, 0x04, 0x91, 0x1e, 0x85, 0x20, 0x14,
-    0x20, 0x1a, 0x20, 0x1e, 0x20, 0x22, 0x20, 0x26,
-    0x20, 0x30, 0x20, 0x3a, 0x20, 0x44, 0x20, 0x70,
-    0x20, 0x74, 0x20, 0x84, 0x20, 0xac, 0x21, 0x13,
-    0x21, 0x16, 0x21, 0x22, 0x21, 0x26, 0x21, 0x2e,
-    0x22, 0x02, 0x22, 0x06, 0x22, 0x0f, 0x22, 0x12,
-    0x22, 0x15, 0x22, 0x1a, 0x22, 0x1e, 0x22, 0x2b,
-    0x22, 0x48, 0x22, 0x60, 0x22, 0x65, 0x25, 0xca,
-    0x26, 0xc4, 0xfb, 0x02, 0xff, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0a, 0x00, 0x0d, 0x00, 0x20,
-    0x00, 0xa1, 0x00, 0xae, 0x01, 0x92, 0x02, 0x18,
-    0x02, 0x37, 0x02, 0xc6, 0x02, 0xc9, 0x02, 0xd8,
-    0x03, 0xbc, 0x03, 0xc0, 0x04, 0x01, 0x04, 0x0e,
-    0x04, 0x51, 0x04, 0x5e, 0x04, 0x90, 0x1e, 0x80,
-    0x20, 0x13, 0x20, 0x18, 0x20, 0x1c, 0x20, 0x20,
-    0x20, 0x26, 0x20, 0x30, 0x20, 0x39, 0x20, 0x44,
-    0x20, 0x70, 0x20, 0x74, 0x20, 0x80, 0x20, 0xac,
-    0x21, 0x13, 0x21, 0x16, 0x21, 0x22, 0x21, 0x26,
-    0x21, 0x2e, 0x22, 0x02, 0x22, 0x06, 0x22, 0x0f,
-    0x22, 0x11, 0x22, 0x15, 0x22, 0x19, 0x22, 0x1e,
-    0x22, 0x2b, 0x22, 0x48, 0x22, 0x60, 0x22, 0x64,
-    0x25, 0xca, 0x26, 0xc4, 0xfb, 0x01, 0xff, 0xff,
-    0x00, 0x01, 0x00, 0x5b, 0xff, 0xf5, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x00, 0x00,
-    0xff, 0x27, 0x00, 0x00, 0xff, 0x6e, 0x00, 0x00,
-    0xfe, 0x53, 0xfe, 0x55, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xe1, 0x41, 0xe1, 0x58, 0x00, 0x00, 0xe1, 0x40,
-    0xe1, 0x0d, 0xe1, 0x0a, 0x00, 0x00, 0xdf, 0xd3,
-    0xe1, 0x08, 0xe1, 0x69, 0xe0, 0x4f, 0xe0, 0xec,
-    0xe0, 0xee, 0xe0, 0x16, 0xe0, 0x0d, 0xe0, 0x01,
-    0x00, 0x00, 0xe0, 0x20, 0x00, 0x00, 0xdf, 0xf9,
-    0xdf, 0xe6, 0xdf, 0xd1, 0xdf, 0x7c, 0x00, 0x00,
-    0xdc, 0x50, 0xdb, 0xa3, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62,
-    0x01, 0x1e, 0x01, 0x34, 0x00, 0x00, 0x02, 0xd4,
-    0x00, 0x00, 0x02, 0xd8, 0x00, 0x00, 0x02, 0xd8,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xde, 0x02, 0xf4,
-    0x03, 0x76, 0x03, 0x8c, 0x03, 0x8e, 0x03, 0x90,
-    0x03, 0x9a, 0x03, 0x9c, 0x03, 0xa0, 0x03, 0xa4,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xa4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xa0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x96, 0x00, 0x00, 0x03, 0x96, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x8e, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x4d, 0x00, 0x50, 0x00, 0x51,
-    0x00, 0x64, 0x00, 0x52, 0x00, 0x62, 0x00, 0x4f,
-    0x00, 0x07, 0x00, 0x57, 0x00, 0x46, 0x00, 0x45,
-    0x00, 0x39, 0x00, 0x44, 0x00, 0x29, 0x00, 0x47,
-    0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3d,
-    0x00, 0x3e, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x41,
-    0x00, 0x42, 0x00, 0x43, 0x00, 0x49, 0x00, 0x4a,
-    0x00, 0x4b, 0x00, 0x4c, 0x00, 0x0f, 0x00, 0x4e,
-    0x00, 0x61, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13,
-    0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17,
-    0x00, 0x04, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1a,
-    0x00, 0x1b, 0x00, 0x1c, 0x00, 0x1d, 0x00, 0x0b,
-    0x00, 0x1e, 0x00, 0x1f, 0x00, 0x20, 0x00, 0x21,
-    0x00, 0x22, 0x00, 0x23, 0x00, 0x24, 0x00, 0x25,
-    0x00, 0x26, 0x00, 0x27, 0x00, 0x28, 0x00, 0x55,
-    0x00, 0x48, 0x00, 0x63, 0x00, 0x5c, 0x00, 0x56,
-    0x00, 0x92, 0x00, 0x2a, 0x00, 0x2b, 0x00, 0x2c,
-    0x00, 0x58, 0x00, 0x2d, 0x00, 0x2e, 0x00, 0x0e,
-    0x00, 0x0c, 0x00, 0x09, 0x00, 0x2f, 0x00, 0x0d,
-    0x00, 0x0a, 0x00, 0x30, 0x00, 0x05, 0x00, 0x08,
-    0x00, 0x06, 0x00, 0x59, 0x00, 0x31, 0x00, 0x32,
-    0x00, 0x33, 0x00, 0x5a, 0x00, 0x34, 0x00, 0x35,
-    0x00, 0x36, 0x00, 0x37, 0x00, 0x38, 0x00, 0x53,
-    0x00, 0x54, 0x00, 0x10, 0x00, 0x8e, 0x01, 0x59,
-    0x01, 0x75, 0x01, 0x76, 0x01, 0x74, 0x01, 0x77,
-    0x00, 0x81, 0x01, 0x73, 0x00, 0x99, 0x01, 0x57,
-    0x01, 0x78, 0x00, 0x83, 0x01, 0x70, 0x01, 0x58,
-    0x00, 0x8d, 0x01, 0x43, 0x00, 0x5f, 0x01, 0x7b,
-    0x01, 0x7c, 0x00, 0x93, 0x01, 0x69, 0x01, 0x68,
-    0x00, 0x67, 0x00, 0x9e, 0x01, 0x7a, 0x01, 0x79,
-    0x00, 0x82, 0x01, 0x85, 0x01, 0x86, 0x01, 0x87,
-    0x01, 0x5a, 0x00, 0xa3, 0x00, 0xa4, 0x00, 0xa5,
-    0x00, 0xa6, 0x00, 0xa7, 0x00, 0xa8, 0x01, 0x6c,
-    0x00, 0xa9, 0x00, 0xaa, 0x00, 0xab, 0x00, 0xac,
-    0x00, 0xad, 0x00, 0xae, 0x00, 0xaf, 0x00, 0xb0,
-    0x00, 0xb1, 0x00, 0xda, 0x00, 0xd8, 0x00, 0xb2,
-    0x00, 0xb3, 0x00, 0xb4, 0x00, 0xb5, 0x00, 0xb6,
-    0x00, 0x5e, 0x00, 0xdc, 0x00, 0xb8, 0x00, 0xb9,
-    0x00, 0xba, 0x00, 0xbb, 0x00, 0xbd, 0x01, 0x5d,
-    0x01, 0x6e, 0x00, 0x95, 0x00, 0xbf, 0x00, 0xc0,
-    0x00, 0xc1, 0x00, 0x9a, 0x00, 0xc2, 0x01, 0x6d,
-    0x00, 0xa2, 0x00, 0xc3, 0x00, 0xc4, 0x00, 0xc5,
-    0x00, 0xc6, 0x00, 0xc7, 0x00, 0xc8, 0x00, 0xc9,
-    0x00, 0xca, 0x01, 0x6f, 0x00, 0x96, 0x00, 0xcb,
-    0x00, 0xcc, 0x00, 0xcd, 0x00, 0xce, 0x00, 0xcf,
-    0x00, 0x5d, 0x00, 0xdd, 0x00, 0xd1, 0x00, 0xd2,
-    0x00, 0xd3, 0x00, 0xd4, 0x00, 0xd5, 0x00, 0xdb,
-    0x00, 0xd6, 0x00, 0xe0, 0x00, 0xe1, 0x00, 0xe2,
-    0x00, 0xe3, 0x00, 0xe4, 0x00, 0xe5, 0x00, 0xe6,
-    0x00, 0xe7, 0x00, 0xe8, 0x00, 0xe9, 0x00, 0xea,
-    0x00, 0xeb, 0x00, 0xec, 0x00, 0x9d, 0x00, 0xed,
-    0x00, 0xee, 0x00, 0xd9, 0x01, 0x61, 0x00, 0xef,
-    0x00, 0xf0, 0x00, 0xf1, 0x00, 0xf2, 0x00, 0xf3,
-    0x00, 0xf4, 0x00, 0xf5, 0x00, 0xf6, 0x00, 0xf7,
-    0x00, 0xf8, 0x00, 0xf9, 0x00, 0xfa, 0x00, 0xfb,
-    0x00, 0xfc, 0x00, 0xfd, 0x00, 0xfe, 0x01, 0x4c,
-    0x01, 0x62, 0x00, 0xff, 0x01, 0x00, 0x01, 0x63,
-    0x01, 0x55, 0x01, 0x01, 0x01, 0x02, 0x01, 0x03,
-    0x01, 0x04, 0x01, 0x8d, 0x01, 0x8c, 0x01, 0x05,
-    0x01, 0x06, 0x01, 0x07, 0x00, 0x7a, 0x01, 0xf8,
-    0x01, 0xf7, 0x01, 0x64, 0x01, 0x65, 0x01, 0x4a,
-    0x01, 0x4b, 0x01, 0x8b, 0x01, 0x56, 0x01, 0x4d,
-    0x01, 0x45, 0x01, 0x4e, 0x01, 0x51, 0x01, 0x52,
-    0x01, 0x41, 0x01, 0x42, 0x00, 0xdf, 0x00, 0xde,
-    0x01, 0x08, 0x01, 0x09, 0x01, 0x49, 0x01, 0x47,
-    0x01, 0x0a, 0x01, 0x0b, 0x01, 0x5b, 0x01, 0x90,
-    0x01, 0x8f, 0x01, 0x0c, 0x01, 0x0d, 0x01, 0x0e,
-    0x01, 0x0f, 0x01, 0x10, 0x01, 0x11, 0x01, 0x6a,
-    0x01, 0x6b, 0x01, 0x12, 0x01, 0x13, 0x01, 0x50,
-    0x01, 0x4f, 0x01, 0x14, 0x01, 0x15, 0x01, 0x16,
-    0x01, 0x17, 0x01, 0x18, 0x01, 0x19, 0x01, 0x1a,
-    0x01, 0x1b, 0x00, 0xb7, 0x00, 0xd0, 0x01, 0x5f,
-    0x01, 0x60, 0x01, 0x1c, 0x01, 0x66, 0x01, 0x53,
-    0x01, 0x54, 0x01, 0x1d, 0x01, 0x1e, 0x01, 0x1f,
-    0x01, 0x20, 0x01, 0x21, 0x01, 0x22, 0x01, 0x23,
-    0x01, 0x24, 0x00, 0x97, 0x00, 0x98, 0x00, 0xa0,
-    0x00, 0xa1, 0x01, 0x25, 0x01, 0x26, 0x01, 0x27,
-    0x01, 0x28, 0x00, 0xbc, 0x01, 0x29, 0x01, 0x2a,
-    0x01, 0x2b, 0x01, 0x2c, 0x00, 0xbe, 0x00, 0xd7,
-    0x01, 0x8e, 0x01, 0x5c, 0x01, 0x46, 0x01, 0x48,
-    0x01, 0x44, 0x00, 0x9b, 0x00, 0x9c, 0x00, 0x8f,
-    0x00, 0x90, 0x00, 0x91, 0x00, 0x9f, 0x00, 0x8c,
-    0x00, 0x94, 0x01, 0xdd, 0x01, 0xf6, 0x01, 0xe5,
-    0x01, 0xf2, 0x01, 0xb4, 0x01, 0xde, 0x01, 0xdf,
-    0x01, 0xe0, 0x01, 0xef, 0x01, 0xed, 0x01, 0xf5,
-    0x01, 0xe7, 0x01, 0xe9, 0x01, 0xeb, 0x01, 0x9a,
-    0x01, 0xaa, 0x01, 0x9b, 0x01, 0xad, 0x01, 0xbe,
-    0x01, 0x9e, 0x01, 0xae, 0x01, 0xb2, 0x01, 0xab,
-    0x01, 0xb3, 0x01, 0x9f, 0x01, 0xbd, 0x01, 0xa0,
-    0x01, 0x98, 0x01, 0x99, 0x01, 0xa9, 0x01, 0x9c,
-    0x01, 0x9d, 0x01, 0xac, 0x01, 0xbf, 0x01, 0xc0,
-    0x01, 0xa1, 0x01, 0xaf, 0x01, 0xc1, 0x01, 0xb1,
-    0x01, 0xb0, 0x01, 0xba, 0x01, 0xb9, 0x01, 0xb8,
-    0x01, 0xbc, 0x01, 0xb7, 0x01, 0xbb, 0x01, 0xa2,
-    0x01, 0xdb, 0x01, 0xd0, 0x01, 0xc9, 0x01, 0xc8,
-    0x01, 0xa3, 0x01, 0xcf, 0x01, 0xda, 0x01, 0xc4,
-    0x01, 0xcd, 0x01, 0xca, 0x01, 0xc7, 0x01, 0xcb,
-    0x01, 0xc2, 0x01, 0xa4, 0x01, 0xc6, 0x01, 0xa8,
-    0x01, 0xa5, 0x01, 0xce, 0x01, 0xa6, 0x01, 0xcc,
-    0x01, 0xa7, 0x01, 0xd6, 0x01, 0xd8, 0x01, 0xd1,
-    0x01, 0xd2, 0x01, 0xd4, 0x01, 0xd9, 0x01, 0xd3,
-    0x01, 0xd5, 0x01, 0xd7, 0x01, 0xc5, 0x01, 0xc3,
-    0x01, 0xf4, 0x01, 0xe6, 0x01, 0xf1, 0x01, 0xb5,
-    0x01, 0xb6, 0x01, 0xe1, 0x01, 0xe2, 0x01, 0xf0,
-    0x01, 0xee, 0x01, 0xf3, 0x01, 0xe8, 0x01, 0xea,
-    0x01, 0xec, 0x01, 0xe3, 0x01, 0xe4, 0x01, 0x2d,
-    0x01, 0x2e, 0x01, 0x2f, 0x01, 0x30, 0x01, 0x31,
-    0x01, 0x32, 0x00, 0x66, 0x00, 0x5b, 0x00, 0x86,
-    0x00, 0x87, 0x00, 0x8a, 0x00, 0x88, 0x00, 0x89,
-    0x00, 0x8b, 0x01, 0x89, 0x01, 0x8a, 0x00, 0x80,
-    0x00, 0x84, 0x00, 0x85, 0x01, 0x7f, 0x01, 0x80,
-    0x01, 0x81, 0x01, 0x82, 0x01, 0x83, 0x02, 0x14,
-    0x00, 0x60, 0x02, 0x36, 0x02, 0x16, 0x02, 0x32,
-    0x02, 0x33, 0x02, 0x38, 0x02, 0x39, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x5a, 0x00, 0x00, 0x01, 0xfe,
-    0x02, 0xd0, 0x00, 0x03, 0x00, 0x06, 0x00, 0x09,
-    0x00, 0x31, 0x40, 0x2e, 0x09, 0x06, 0x02, 0x02,
-    0x03, 0x01, 0x4c, 0x00, 0x00, 0x00, 0x03, 0x02,
-    0x00, 0x03, 0x67, 0x00, 0x02, 0x01, 0x01, 0x02,
-    0x57, 0x00, 0x02, 0x02, 0x01, 0x5f, 0x04, 0x01,
-    0x01, 0x02, 0x01, 0x4f, 0x00, 0x00, 0x08, 0x07,
-    0x05, 0x04, 0x00, 0x03, 0x00, 0x03, 0x11, 0x05,
-    0x06, 0x17, 0x2b, 0x33, 0x11, 0x21, 0x11, 0x25,
-    0x21, 0x11, 0x27, 0x21, 0x11, 0x5a, 0x01, 0xa4,
-    0xfe, 0xa2, 0x01, 0x2c, 0x14, 0xfe, 0xd4, 0x02,
-    0xd0, 0xfd, 0x30, 0x32, 0x02, 0x31, 0x3b, 0xfd,
-    0xcf, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x5a,
-    0x00, 0x00, 0x01, 0xfe, 0x02, 0xd0, 0x00, 0x0b,
-    0x00, 0x27, 0x40, 0x24, 0x00, 0x00, 0x00, 0x03,
-    0x02, 0x00, 0x03, 0x67, 0x06, 0x05, 0x02, 0x01,
-    0x01, 0x3a, 0x4d, 0x04, 0x01, 0x02, 0x02, 0x3b,
-    0x02, 0x4e, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x0b,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x07, 0x09, 0x1b,
-    0x2b, 0x13, 0x11, 0x33, 0x11, 0x33, 0x11, 0x23,
-    0x11, 0x23, 0x11, 0x23, 0x11, 0xb4, 0xf0, 0x5a,
-    0x5a, 0xf0, 0x5a, 0x02, 0xd0, 0xfe, 0xd0, 0x01,
-    0x30, 0xfd, 0x30, 0x01, 0x4e, 0xfe, 0xb2, 0x02,
-    0xd0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x58,
-    0x00, 0x00, 0x02, 0x01, 0x02, 0x30, 0x00, 0x16,
-    0x00, 0x4c, 0xb5, 0x03, 0x01, 0x02, 0x03, 0x01,
-    0x4c, 0x4b, 0xb0, 0x18, 0x50, 0x58, 0x40, 0x13,
-    0x00, 0x03, 0x03, 0x00, 0x61, 0x01, 0x01, 0x00,
-    0x00, 0x3d, 0x4d, 0x05, 0x04, 0x02, 0x02, 0x02,
-    0x3b, 0x02, 0x4e, 0x1b, 0x40, 0x17, 0x00, 0x00,
-    0x00, 0x3d, 0x4d, 0x00, 0x03, 0x03, 0x01, 0x61,
-    0x00, 0x01, 0x01, 0x45, 0x4d, 0x05, 0x04, 0x02,
-    0x02, 0x02, 0x3b, 0x02, 0x4e, 0x59, 0x40, 0x0d,
-    0x00, 0x00, 0x00, 0x16, 0x00, 0x16, 0x23, 0x15,
-    0x24, 0x11, 0x06, 0x09, 0x1a, 0x2b, 0x33, 0x11,
-    0x33, 0x15, 0x33, 0x3e, 0x01, 0x33, 0x32, 0x1e,
-    0x02, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x23,
-    0x22, 0x06, 0x15, 0x11, 0x58, 0x55, 0x08, 0x0d,
-    0x4f, 0x3b, 0x29, 0x43, 0x2f, 0x1a, 0x5a, 0x40,
-    0x39, 0x39, 0x43, 0x02, 0x26, 0x5f, 0x32, 0x37,
-    0x1c, 0x33, 0x47, 0x2c, 0xfe, 0x92, 0x01, 0x5f,
-    0x3f, 0x46, 0x4b, 0x40, 0xfe, 0xa7, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x58, 0xff, 0x5b, 0x02, 0x08,
-    0x02, 0x30, 0x00, 0x1c, 0x00, 0x2a, 0x00, 0x67,
-    0x40, 0x0b, 0x13, 0x01, 0x02, 0x04, 0x05, 0x16,
-    0x01, 0x01, 0x04, 0x02, 0x4c, 0x4b, 0xb0, 0x18,
-    0x50, 0x58, 0x40, 0x1c, 0x00, 0x05, 0x05, 0x00,
-    0x61, 0x06, 0x03, 0x02, 0x00, 0x00, 0x45, 0x4d,
-    0x00, 0x04, 0x04, 0x01, 0x61, 0x00, 0x01, 0x01,
-    0x43, 0x4d, 0x00, 0x02, 0x02, 0x3f, 0x02, 0x4e,
-    0x1b, 0x40, 0x20, 0x06, 0x01, 0x03, 0x03, 0x3d,
-    0x4d, 0x00, 0x05, 0x05, 0x00, 0x61, 0x00, 0x00,
-    0x00, 0x45, 0x4d, 0x00, 0x04, 0x04, 0x01, 0x61,
-    0x00, 0x01, 0x01, 0x43, 0x4d, 0x00, 0x02, 0x02,
-    0x3f, 0x02, 0x4e, 0x59, 0x40, 0x10, 0x00, 0x00,
-    0x28, 0x26, 0x21, 0x1f, 0x00, 0x1c, 0x00, 0x1c,
-    0x19, 0x29, 0x24, 0x07, 0x09, 0x19, 0x2b, 0x13,
-    0x15, 0x33, 0x3e, 0x01, 0x33, 0x32, 0x1e, 0x02,
-    0x1d, 0x01, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x26,
-    0x27, 0x23, 0x16, 0x17, 0x1e, 0x01, 0x1d, 0x01,
-    0x23, 0x11, 0x13, 0x14, 0x16, 0x33, 0x32, 0x36,
-    0x3d, 0x01, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15,
-    0xad, 0x08, 0x0d, 0x50, 0x3d, 0x2a, 0x44, 0x30,
-    0x1b, 0x1b, 0x30, 0x44, 0x2a, 0x3d, 0x50, 0x0d,
-    0x08, 0x01, 0x02, 0x01, 0x01, 0x5a, 0x5a, 0x43,
-    0x38, 0x3c, 0x45, 0x44, 0x3d, 0x38, 0x43, 0x02,
-    0x26, 0x5f, 0x32, 0x37, 0x1e, 0x37, 0x50, 0x32,
-    0x8c, 0x32, 0x50, 0x37, 0x1e, 0x37, 0x32, 0x11,
-    0x11, 0x0f, 0x20, 0x0e, 0xa5, 0x02, 0xcb, 0xfe,
-    0xa7, 0x3f, 0x4a, 0x4a, 0x3f, 0x8c, 0x41, 0x48,
-    0x4a, 0x3f, 0x00, 0x00, 0x00, 0x01, 0x00, 0xb9,
-    0xff, 0x83, 0x01, 0xe5, 0x03, 0x4d, 0x00, 0x17,
-    0x00, 0x06, 0xb3, 0x12, 0x05, 0x01, 0x32, 0x2b,
-    0x13, 0x34, 0x3e, 0x02, 0x37, 0x15, 0x0e, 0x03,
-    0x1d, 0x01, 0x14, 0x1e, 0x02, 0x17, 0x15, 0x2e,
-    0x03, 0x35, 0xb9, 0x2a, 0x4e, 0x6f, 0x45, 0x30,
-    0x4e, 0x36, 0x1e, 0x1d, 0x37, 0x4e, 0x30, 0x47,
-    0x6f, 0x4d, 0x29, 0x01, 0xc7, 0x49, 0x7f, 0x65,
-    0x48, 0x11, 0x55, 0x0b, 0x36, 0x50, 0x65, 0x3b,
-    0xbe, 0x3a, 0x64, 0x4e, 0x36, 0x0b, 0x59, 0x12,
-    0x46, 0x64, 0x7f, 0x4b, 0x00, 0x02, 0x00, 0x50,
-    0xff, 0xf6, 0x02, 0x08, 0x02, 0x30, 0x00, 0x0d,
-    0x00, 0x21, 0x00, 0x1f, 0x40, 0x1c, 0x00, 0x01,
-    0x01, 0x02, 0x61, 0x00, 0x02, 0x02, 0x45, 0x4d,
-    0x00, 0x00, 0x00, 0x03, 0x61, 0x00, 0x03, 0x03,
-    0x43, 0x03, 0x4e, 0x27, 0x27, 0x25, 0x22, 0x04,
-    0x09, 0x1a, 0x2b, 0x37, 0x14, 0x16, 0x33, 0x32,
-    0x36, 0x3d, 0x01, 0x34, 0x26, 0x23, 0x22, 0x06,
-    0x15, 0x23, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16,
-    0x1d, 0x01, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e,
-    0x02, 0x35, 0xaa, 0x45, 0x3d, 0x3c, 0x46, 0x46,
-    0x3c, 0x3c, 0x46, 0x5a, 0x1f, 0x39, 0x51, 0x33,
-    0x66, 0x76, 0x1e, 0x39, 0x52, 0x33, 0x33, 0x51,
-    0x39, 0x1f, 0xcd, 0x3f, 0x48, 0x48, 0x3f, 0x8c,
-    0x3f, 0x48, 0x48, 0x3f, 0x32, 0x4f, 0x38, 0x1e,
-    0x72, 0x64, 0x8d, 0x32, 0x50, 0x37, 0x1e, 0x1e,
-    0x38, 0x50, 0x31, 0x00, 0x00, 0x02, 0x00, 0x5f,
-    0x00, 0x00, 0x02, 0x26, 0x02, 0xfd, 0x00, 0x09,
-    0x00, 0x17, 0x00, 0x65, 0x4b, 0xb0, 0x17, 0x50,
-    0x58, 0x40, 0x22, 0x00, 0x06, 0x06, 0x05, 0x61,
-    0x08, 0x01, 0x05, 0x05, 0x44, 0x4d, 0x00, 0x01,
-    0x01, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x3d, 0x4d,
-    0x03, 0x01, 0x00, 0x00, 0x04, 0x5f, 0x07, 0x01,
-    0x04, 0x04, 0x3b, 0x04, 0x4e, 0x1b, 0x40, 0x20,
-    0x08, 0x01, 0x05, 0x00, 0x06, 0x02, 0x05, 0x06,
-    0x69, 0x00, 0x01, 0x01, 0x02, 0x5f, 0x00, 0x02,
-    0x02, 0x3d, 0x4d, 0x03, 0x01, 0x00, 0x00, 0x04,
-    0x5f, 0x07, 0x01, 0x04, 0x04, 0x3b, 0x04, 0x4e,
-    0x59, 0x40, 0x15, 0x0c, 0x0a, 0x00, 0x00, 0x13,
-    0x10, 0x0a, 0x17, 0x0c, 0x17, 0x00, 0x09, 0x00,
-    0x09, 0x11, 0x11, 0x11, 0x11, 0x09, 0x09, 0x1a,
-    0x2b, 0x33, 0x35, 0x33, 0x11, 0x23, 0x35, 0x21,
-    0x11, 0x33, 0x15, 0x03, 0x33, 0x32, 0x16, 0x15,
-    0x14, 0x06, 0x2b, 0x01, 0x22, 0x26, 0x35, 0x34,
-    0x36, 0x5f, 0xc8, 0xaf, 0x01, 0x09, 0xa5, 0xeb,
-    0x14, 0x1d, 0x24, 0x24, 0x1d, 0x14, 0x1d, 0x24,
-    0x24, 0x52, 0x01, 0x82, 0x52, 0xfe, 0x2c, 0x52,
-    0x02, 0xfd, 0x22, 0x1b, 0x1b, 0x20, 0x1f, 0x1c,
-    0x1b, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x28,
-    0x00, 0x00, 0x02, 0x26, 0x02, 0xda, 0x00, 0x0d,
-    0x00, 0x63, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40,
-    0x16, 0x00, 0x02, 0x02, 0x03, 0x5f, 0x04, 0x01,
-    0x03, 0x03, 0x3c, 0x4d, 0x00, 0x00, 0x00, 0x01,
-    0x5f, 0x00, 0x01, 0x01, 0x3b, 0x01, 0x4e, 0x1b,
-    0x4b, 0xb0, 0x31, 0x50, 0x58, 0x40, 0x16, 0x00,
-    0x02, 0x02, 0x03, 0x5f, 0x04, 0x01, 0x03, 0x03,
-    0x3a, 0x4d, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x00,
-    0x01, 0x01, 0x3b, 0x01, 0x4e, 0x1b, 0x40, 0x14,
-    0x04, 0x01, 0x03, 0x00, 0x02, 0x00, 0x03, 0x02,
-    0x67, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x00, 0x01,
-    0x01, 0x3b, 0x01, 0x4e, 0x59, 0x59, 0x40, 0x0c,
-    0x00, 0x00, 0x00, 0x0d, 0x00, 0x0d, 0x13, 0x21,
-    0x23, 0x05, 0x09, 0x19, 0x2b, 0x01, 0x11, 0x14,
-    0x16, 0x3b, 0x01, 0x15, 0x23, 0x22, 0x26, 0x35,
-    0x11, 0x23, 0x35, 0x01, 0x38, 0x28, 0x23, 0xa3,
-    0xa3, 0x4d, 0x58, 0xb6, 0x02, 0xda, 0xfd, 0xc6,
-    0x25, 0x29, 0x52, 0x55, 0x4b, 0x01, 0xe8, 0x52,
-    0x00, 0x02, 0x00, 0x50, 0xff, 0xf6, 0x02, 0x08,
-    0x02, 0xda, 0x00, 0x0d, 0x00, 0x23, 0x00, 0x1f,
-    0x40, 0x1c, 0x00, 0x01, 0x01, 0x02, 0x61, 0x00,
-    0x02, 0x02, 0x42, 0x4d, 0x00, 0x00, 0x00, 0x03,
-    0x61, 0x00, 0x03, 0x03, 0x43, 0x03, 0x4e, 0x29,
-    0x27, 0x25, 0x22, 0x04, 0x09, 0x1a, 0x2b, 0x37,
-    0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x11, 0x34,
-    0x26, 0x23, 0x22, 0x06, 0x15, 0x23, 0x34, 0x3e,
-    0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x11, 0x14,
-    0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0xaa,
-    0x46, 0x3c, 0x3c, 0x46, 0x46, 0x3c, 0x3c, 0x46,
-    0x5a, 0x1f, 0x39, 0x51, 0x33, 0x33, 0x51, 0x39,
-    0x1f, 0x1f, 0x39, 0x52, 0x32, 0x33, 0x51, 0x39,
-    0x1f, 0xcd, 0x3e, 0x49, 0x49, 0x3e, 0x01, 0x36,
-    0x3e, 0x49, 0x49, 0x3e, 0x31, 0x50, 0x38, 0x1e,
-    0x1e, 0x38, 0x50, 0x31, 0xfe, 0xca, 0x31, 0x4f,
-    0x38, 0x1f, 0x1e, 0x38, 0x50, 0x31, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x58, 0x00, 0x00, 0x02, 0x01,
-    0x02, 0xda, 0x00, 0x1b, 0x00, 0x67, 0xb5, 0x07,
-    0x01, 0x02, 0x03, 0x01, 0x4c, 0x4b, 0xb0, 0x17,
-    0x50, 0x58, 0x40, 0x16, 0x00, 0x00, 0x00, 0x3c,
-    0x4d, 0x00, 0x03, 0x03, 0x01, 0x61, 0x00, 0x01,
-    0x01, 0x45, 0x4d, 0x04, 0x01, 0x02, 0x02, 0x3b,
-    0x02, 0x4e, 0x1b, 0x4b, 0xb0, 0x31, 0x50, 0x58,
-    0x40, 0x16, 0x00, 0x00, 0x00, 0x3a, 0x4d, 0x00,
-    0x03, 0x03, 0x01, 0x61, 0x00, 0x01, 0x01, 0x45,
-    0x4d, 0x04, 0x01, 0x02, 0x02, 0x3b, 0x02, 0x4e,
-    0x1b, 0x40, 0x16, 0x00, 0x03, 0x03, 0x01, 0x61,
-    0x00, 0x01, 0x01, 0x45, 0x4d, 0x00, 0x00, 0x00,
-    0x02, 0x5f, 0x04, 0x01, 0x02, 0x02, 0x3b, 0x02,
-    0x4e, 0x59, 0x59, 0xb7, 0x13, 0x23, 0x15, 0x29,
-    0x10, 0x05, 0x09, 0x1b, 0x2b, 0x13, 0x33, 0x15,
-    0x14, 0x06, 0x07, 0x06, 0x07, 0x33, 0x3e, 0x01,
-    0x33, 0x32, 0x1e, 0x02, 0x15, 0x11, 0x23, 0x11,
-    0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x11, 0x23,
-    0x58, 0x5a, 0x01, 0x01, 0x02, 0x01, 0x08, 0x0d,
-    0x4f, 0x3b, 0x29, 0x43, 0x2f, 0x1a, 0x5a, 0x40,
-    0x39, 0x39, 0x43, 0x5a, 0x02, 0xda, 0xb4, 0x0e,
-    0x21, 0x0e, 0x11, 0x11, 0x32, 0x37, 0x1c, 0x33,
-    0x47, 0x2c, 0xfe, 0x92, 0x01, 0x5f, 0x3f, 0x46,
-    0x4b, 0x40, 0xfe, 0xa7, 0x00, 0x01, 0x00, 0x5d,
-    0x00, 0x00, 0x02, 0x35, 0x02, 0xda, 0x00, 0x0c,
-    0x00, 0x80, 0xb5, 0x05, 0x01, 0x03, 0x00, 0x01,
-    0x4c, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x1a,
-    0x00, 0x00, 0x00, 0x03, 0x02, 0x00, 0x03, 0x67,
-    0x06, 0x01, 0x05, 0x05, 0x3c, 0x4d, 0x00, 0x01,
-    0x01, 0x3d, 0x4d, 0x04, 0x01, 0x02, 0x02, 0x3b,
-    0x02, 0x4e, 0x1b, 0x4b, 0xb0, 0x31, 0x50, 0x58,
-    0x40, 0x1a, 0x00, 0x00, 0x00, 0x03, 0x02, 0x00,
-    0x03, 0x67, 0x06, 0x01, 0x05, 0x05, 0x3a, 0x4d,
-    0x00, 0x01, 0x01, 0x3d, 0x4d, 0x04, 0x01, 0x02,
-    0x02, 0x3b, 0x02, 0x4e, 0x1b, 0x40, 0x20, 0x00,
-    0x00, 0x00, 0x03, 0x02, 0x00, 0x03, 0x67, 0x06,
-    0x01, 0x05, 0x05, 0x02, 0x5f, 0x04, 0x01, 0x02,
-    0x02, 0x3b, 0x4d, 0x00, 0x01, 0x01, 0x3d, 0x4d,
-    0x04, 0x01, 0x02, 0x02, 0x3b, 0x02, 0x4e, 0x59,
-    0x59, 0x40, 0x0e, 0x00, 0x00, 0x00, 0x0c, 0x00,
-    0x0c, 0x11, 0x11, 0x12, 0x11, 0x11, 0x07, 0x09,
-    0x1b, 0x2b, 0x13, 0x11, 0x33, 0x37, 0x33, 0x03,
-    0x13, 0x23, 0x27, 0x23, 0x15, 0x23, 0x11, 0xb7,
-    0x6c, 0xa8, 0x67, 0xc3, 0xc6, 0x69, 0xa8, 0x6d,
-    0x5a, 0x02, 0xda, 0xfe, 0x66, 0xe6, 0xfe, 0xf6,
-    0xfe, 0xe4, 0xf0, 0xf0, 0x02, 0xda, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x49, 0xff, 0x5b, 0x02, 0x00,
-    0x02, 0x30, 0x00, 0x20, 0x00, 0x2e, 0x00, 0x60,
-    0xb6, 0x17, 0x08, 0x02, 0x05, 0x06, 0x01, 0x4c,
-    0x4b, 0xb0, 0x18, 0x50, 0x58, 0x40, 0x1e, 0x00,
-    0x05, 0x00, 0x04, 0x03, 0x05, 0x04, 0x69, 0x00,
-    0x06, 0x06, 0x00, 0x61, 0x01, 0x01, 0x00, 0x00,
-    0x45, 0x4d, 0x00, 0x03, 0x03, 0x02, 0x5f, 0x00,
-    0x02, 0x02, 0x3f, 0x02, 0x4e, 0x1b, 0x40, 0x22,
-    0x00, 0x05, 0x00, 0x04, 0x03, 0x05, 0x04, 0x69,
-    0x00, 0x01, 0x01, 0x3d, 0x4d, 0x00, 0x06, 0x06,
-    0x00, 0x61, 0x00, 0x00, 0x00, 0x45, 0x4d, 0x00,
-    0x03, 0x03, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x3f,
-    0x02, 0x4e, 0x59, 0x40, 0x0a, 0x25, 0x27, 0x27,
-    0x21, 0x23, 0x14, 0x24, 0x07, 0x09, 0x1d, 0x2b,
-    0x13, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x17,
-    0x33, 0x35, 0x33, 0x11, 0x14, 0x06, 0x2b, 0x01,
-    0x35, 0x33, 0x32, 0x36, 0x3d, 0x01, 0x37, 0x23,
-    0x0e, 0x01, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x33,
-    0x14, 0x16, 0x33, 0x32, 0x36, 0x3d, 0x01, 0x34,
-    0x26, 0x23, 0x22, 0x06, 0x15, 0x49, 0x1a, 0x31,
-    0x46, 0x2b, 0x3c, 0x54, 0x0f, 0x07, 0x55, 0x72,
-    0x67, 0x87, 0x87, 0x3c, 0x43, 0x04, 0x06, 0x0f,
-    0x54, 0x3c, 0x2b, 0x45, 0x31, 0x1b, 0x5c, 0x45,
-    0x3c, 0x3c, 0x44, 0x44, 0x3c, 0x3c, 0x45, 0x01,
-    0x5e, 0x30, 0x4e, 0x36, 0x1e, 0x39, 0x35, 0x64,
-    0xfe, 0x02, 0x61, 0x6c, 0x52, 0x40, 0x3b, 0x14,
-    0x64, 0x35, 0x39, 0x1e, 0x36, 0x4e, 0x30, 0x3e,
-    0x46, 0x46, 0x3e, 0x5a, 0x3e, 0x46, 0x46, 0x3e,
-    0x00, 0x01, 0x00, 0x55, 0x00, 0x41, 0x02, 0x03,
-    0x02, 0x53, 0x00, 0x10, 0x00, 0x06, 0xb3, 0x10,
-    0x0d, 0x01, 0x32, 0x2b, 0x37, 0x25, 0x3e, 0x01,
-    0x37, 0x36, 0x37, 0x35, 0x26, 0x27, 0x26, 0x27,
-    0x25, 0x35, 0x05, 0x15, 0x05, 0x55, 0x01, 0x36,
-    0x0c, 0x14, 0x08, 0x08, 0x07, 0x07, 0x08, 0x11,
-    0x17, 0xfe, 0xca, 0x01, 0xae, 0xfe, 0x52, 0x9b,
-    0x97, 0x06, 0x08, 0x02, 0x03, 0x01, 0x07, 0x01,
-    0x03, 0x03, 0x0c, 0x9a, 0x59, 0xd7, 0x64, 0xd7,
-    0x00, 0x01, 0x00, 0x55, 0xff, 0x92, 0x02, 0x03,
-    0x03, 0x3e, 0x00, 0x31, 0x00, 0x3b, 0x40, 0x38,
-    0x00, 0x01, 0x04, 0x05, 0x04, 0x01, 0x05, 0x80,
-    0x00, 0x03, 0x00, 0x02, 0x04, 0x03, 0x02, 0x69,
-    0x00, 0x04, 0x00, 0x05, 0x00, 0x04, 0x05, 0x67,
-    0x00, 0x00, 0x06, 0x06, 0x00, 0x59, 0x00, 0x00,
-    0x00, 0x06, 0x61, 0x07, 0x01, 0x06, 0x00, 0x06,
-    0x51, 0x00, 0x00, 0x00, 0x31, 0x00, 0x30, 0x21,
-    0x29, 0x21, 0x29, 0x17, 0x21, 0x08, 0x09, 0x1c,
-    0x2b, 0x17, 0x35, 0x33, 0x32, 0x36, 0x2f, 0x01,
-    0x26, 0x3e, 0x02, 0x37, 0x35, 0x2e, 0x03, 0x3f,
-    0x01, 0x36, 0x26, 0x2b, 0x01, 0x35, 0x33, 0x32,
-    0x1e, 0x02, 0x0f, 0x01, 0x06, 0x1e, 0x02, 0x3b,
-    0x01, 0x15, 0x23, 0x22, 0x0e, 0x02, 0x1f, 0x01,
-    0x16, 0x0e, 0x02, 0x23, 0x55, 0x2d, 0x30, 0x31,
-    0x02, 0x0a, 0x01, 0x0d, 0x1d, 0x2c, 0x1e, 0x1e,
-    0x2d, 0x1c, 0x0d, 0x01, 0x0a, 0x02, 0x31, 0x30,
-    0x2d, 0x2d, 0x2c, 0x47, 0x30, 0x18, 0x02, 0x0a,
-    0x01, 0x06, 0x16, 0x28, 0x21, 0x6e, 0x6e, 0x20,
-    0x29, 0x16, 0x06, 0x01, 0x0a, 0x02, 0x18, 0x30,
-    0x47, 0x2c, 0x6e, 0x50, 0x2b, 0x2b, 0xa4, 0x1b,
-    0x31, 0x25, 0x16, 0x01, 0x05, 0x01, 0x17, 0x26,
-    0x32, 0x1b, 0xa4, 0x2b, 0x2b, 0x50, 0x16, 0x2b,
-    0x3e, 0x27, 0xa4, 0x1b, 0x26, 0x18, 0x0b, 0x50,
-    0x0b, 0x18, 0x26, 0x1b, 0xa4, 0x27, 0x3e, 0x2b,
-    0x16, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x2c,
-    0x00, 0x00, 0x02, 0x2c, 0x02, 0xd0, 0x00, 0x07,
-    0x00, 0x15, 0x00, 0x25, 0x40, 0x22, 0x0f, 0x01,
-    0x04, 0x00, 0x01, 0x4c, 0x00, 0x04, 0x00, 0x02,
-    0x01, 0x04, 0x02, 0x68, 0x00, 0x00, 0x00, 0x3a,
-    0x4d, 0x03, 0x01, 0x01, 0x01, 0x3b, 0x01, 0x4e,
-    0x11, 0x11, 0x11, 0x11, 0x10, 0x05, 0x09, 0x1b,
-    0x2b, 0x13, 0x33, 0x13, 0x23, 0x27, 0x23, 0x07,
-    0x23, 0x13, 0x33, 0x03, 0x2e, 0x01, 0x27, 0x26,
-    0x27, 0x23, 0x06, 0x07, 0x0e, 0x01, 0x07, 0xf0,
-    0x7e, 0xbe, 0x60, 0x32, 0xdd, 0x33, 0x5e, 0xa4,
-    0xb8, 0x46, 0x05, 0x08, 0x02, 0x02, 0x02, 0x04,
-    0x02, 0x03, 0x02, 0x08, 0x05, 0x02, 0xd0, 0xfd,
-    0x30, 0xcb, 0xcb, 0x01, 0x16, 0x01, 0x1d, 0x15,
-    0x23, 0x0e, 0x0f, 0x0c, 0x0c, 0x0f, 0x0e, 0x23,
-    0x15, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x5a,
-    0x00, 0x00, 0x02, 0x14, 0x02, 0xd0, 0x00, 0x11,
-    0x00, 0x1a, 0x00, 0x23, 0x00, 0x3f, 0x40, 0x3c,
-    0x06, 0x01, 0x03, 0x04, 0x01, 0x4c, 0x00, 0x04,
-    0x00, 0x03, 0x02, 0x04, 0x03, 0x67, 0x07, 0x01,
-    0x05, 0x05, 0x00, 0x5f, 0x06, 0x01, 0x00, 0x00,
-    0x3a, 0x4d, 0x00, 0x02, 0x02, 0x01, 0x5f, 0x00,
-    0x01, 0x01, 0x3b, 0x01, 0x4e, 0x1b, 0x1b, 0x01,
-    0x00, 0x1b, 0x23, 0x1b, 0x22, 0x1e, 0x1c, 0x1a,
-    0x18, 0x14, 0x12, 0x10, 0x0e, 0x00, 0x11, 0x01,
-    0x11, 0x08, 0x09, 0x16, 0x2b, 0x01, 0x32, 0x16,
-    0x15, 0x14, 0x06, 0x07, 0x15, 0x1e, 0x01, 0x15,
-    0x14, 0x0e, 0x02, 0x2b, 0x01, 0x11, 0x13, 0x33,
-    0x32, 0x36, 0x35, 0x34, 0x26, 0x2b, 0x01, 0x11,
-    0x15, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23,
-    0x01, 0x2d, 0x66, 0x74, 0x49, 0x3c, 0x45, 0x4d,
-    0x1e, 0x39, 0x52, 0x33, 0xde, 0x59, 0x7b, 0x40,
-    0x47, 0x48, 0x3f, 0x7b, 0x79, 0x39, 0x43, 0x42,
-    0x39, 0x02, 0xd0, 0x66, 0x58, 0x40, 0x51, 0x05,
-    0x06, 0x04, 0x5a, 0x4d, 0x2f, 0x4b, 0x35, 0x1c,
-    0x02, 0xd0, 0xfd, 0x82, 0x42, 0x3a, 0x3a, 0x42,
-    0x01, 0x34, 0xe6, 0x3d, 0x36, 0x36, 0x3d, 0x00,
-    0x00, 0x01, 0x00, 0x56, 0xff, 0xf6, 0x02, 0x0e,
-    0x02, 0xda, 0x00, 0x1f, 0x00, 0x3b, 0x40, 0x38,
-    0x00, 0x01, 0x02, 0x04, 0x02, 0x01, 0x04, 0x80,
-    0x00, 0x04, 0x03, 0x02, 0x04, 0x03, 0x7e, 0x00,
-    0x02, 0x02, 0x00, 0x61, 0x06, 0x01, 0x00, 0x00,
-    0x42, 0x4d, 0x00, 0x03, 0x03, 0x05, 0x61, 0x00,
-    0x05, 0x05, 0x43, 0x05, 0x4e, 0x01, 0x00, 0x16,
-    0x14, 0x12, 0x11, 0x0f, 0x0d, 0x08, 0x06, 0x04,
-    0x03, 0x00, 0x1f, 0x01, 0x1f, 0x07, 0x09, 0x16,
-    0x2b, 0x01, 0x32, 0x16, 0x17, 0x23, 0x2e, 0x01,
-    0x23, 0x22, 0x06, 0x15, 0x11, 0x14, 0x16, 0x33,
-    0x32, 0x36, 0x37, 0x33, 0x0e, 0x01, 0x23, 0x22,
-    0x2e, 0x02, 0x35, 0x11, 0x34, 0x3e, 0x02, 0x01,
-    0x32, 0x5e, 0x73, 0x0b, 0x5a, 0x06, 0x45, 0x37,
-    0x3c, 0x46, 0x45, 0x3d, 0x37, 0x45, 0x06, 0x5a,
-    0x0b, 0x73, 0x5e, 0x33, 0x51, 0x39, 0x1f, 0x1f,
-    0x39, 0x51, 0x02, 0xda, 0x67, 0x5c, 0x36, 0x3d,
-    0x48, 0x3f, 0xfe, 0xca, 0x3f, 0x48, 0x3d, 0x36,
-    0x5c, 0x67, 0x1e, 0x38, 0x50, 0x31, 0x01, 0x36,
-    0x31, 0x50, 0x38, 0x1e, 0x00, 0x02, 0x00, 0x58,
-    0x00, 0x00, 0x02, 0x08, 0x02, 0xd0, 0x00, 0x09,
-    0x00, 0x17, 0x00, 0x2d, 0x40, 0x2a, 0x00, 0x01,
-    0x01, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x3a, 0x4d,
-    0x04, 0x01, 0x00, 0x00, 0x03, 0x5f, 0x05, 0x01,
-    0x03, 0x03, 0x3b, 0x03, 0x4e, 0x0a, 0x0a, 0x01,
-    0x00, 0x0a, 0x17, 0x0a, 0x16, 0x0d, 0x0b, 0x08,
-    0x06, 0x00, 0x09, 0x01, 0x09, 0x06, 0x09, 0x16,
-    0x2b, 0x25, 0x32, 0x36, 0x35, 0x11, 0x34, 0x26,
-    0x2b, 0x01, 0x11, 0x07, 0x11, 0x33, 0x32, 0x1e,
-    0x02, 0x15, 0x11, 0x14, 0x0e, 0x02, 0x23, 0x01,
-    0x21, 0x3f, 0x4d, 0x4d, 0x3f, 0x6f, 0x5a, 0xc9,
-    0x34, 0x55, 0x3d, 0x21, 0x21, 0x3d, 0x55, 0x34,
-    0x50, 0x4d, 0x3f, 0x01, 0x19, 0x3f, 0x4c, 0xfd,
-    0xd0, 0x50, 0x02, 0xd0, 0x20, 0x39, 0x51, 0x31,
-    0xfe, 0xe7, 0x31, 0x52, 0x39, 0x20, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x02, 0x08,
-    0x02, 0xd0, 0x00, 0x0b, 0x00, 0x2f, 0x40, 0x2c,
-    0x00, 0x02, 0x00, 0x03, 0x04, 0x02, 0x03, 0x67,
-    0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00,
-    0x3a, 0x4d, 0x00, 0x04, 0x04, 0x05, 0x5f, 0x06,
-    0x01, 0x05, 0x05, 0x3b, 0x05, 0x4e, 0x00, 0x00,
-    0x00, 0x0b, 0x00, 0x0b, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x07, 0x09, 0x1b, 0x2b, 0x33, 0x11, 0x21,
-    0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21,
-    0x15, 0x5f, 0x01, 0xa9, 0xfe, 0xb1, 0x01, 0x2c,
-    0xfe, 0xd4, 0x01, 0x4f, 0x02, 0xd0, 0x52, 0xe2,
-    0x52, 0xf8, 0x52, 0x00, 0x00, 0x01, 0x00, 0x5f,
-    0x00, 0x00, 0x02, 0x0d, 0x02, 0xd1, 0x00, 0x09,
-    0x00, 0x23, 0x40, 0x20, 0x00, 0x02, 0x00, 0x03,
-    0x04, 0x02, 0x03, 0x67, 0x00, 0x01, 0x01, 0x00,
-    0x5f, 0x00, 0x00, 0x00, 0x3a, 0x4d, 0x00, 0x04,
-    0x04, 0x3b, 0x04, 0x4e, 0x11, 0x11, 0x11, 0x11,
-    0x10, 0x05, 0x09, 0x1b, 0x2b, 0x13, 0x21, 0x15,
-    0x21, 0x15, 0x21, 0x15, 0x21, 0x11, 0x23, 0x5f,
-    0x01, 0xae, 0xfe, 0xaa, 0x01, 0x3c, 0xfe, 0xc6,
-    0x5a, 0x02, 0xd1, 0x50, 0xe9, 0x50, 0xfe, 0xb8,
-    0x00, 0x01, 0x00, 0x50, 0xff, 0xf6, 0x02, 0x0d,
-    0x02, 0xda, 0x00, 0x25, 0x00, 0x32, 0x40, 0x2f,
-    0x00, 0x03, 0x04, 0x00, 0x04, 0x03, 0x00, 0x80,
-    0x00, 0x00, 0x00, 0x06, 0x05, 0x00, 0x06, 0x67,
-    0x00, 0x04, 0x04, 0x02, 0x61, 0x00, 0x02, 0x02,
-    0x42, 0x4d, 0x00, 0x05, 0x05, 0x01, 0x61, 0x00,
-    0x01, 0x01, 0x43, 0x01, 0x4e, 0x13, 0x25, 0x22,
-    0x12, 0x29, 0x25, 0x10, 0x07, 0x09, 0x1d, 0x2b,
-    0x01, 0x33, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22,
-    0x2e, 0x02, 0x35, 0x11, 0x34, 0x3e, 0x02, 0x33,
-    0x32, 0x16, 0x17, 0x23, 0x2e, 0x01, 0x23, 0x22,
-    0x06, 0x15, 0x11, 0x14, 0x16, 0x33, 0x32, 0x36,
-    0x3d, 0x01, 0x23, 0x01, 0x1c, 0xec, 0x1f, 0x39,
-    0x51, 0x33, 0x32, 0x52, 0x39, 0x1f, 0x20, 0x39,
-    0x52, 0x31, 0x5b, 0x74, 0x12, 0x5c, 0x0a, 0x46,
-    0x35, 0x3c, 0x46, 0x46, 0x3c, 0x3c, 0x46, 0x92,
-    0x01, 0x72, 0xa5, 0x31, 0x50, 0x38, 0x1e, 0x1e,
-    0x38, 0x50, 0x31, 0x01, 0x36, 0x30, 0x50, 0x38,
-    0x1f, 0x5c, 0x58, 0x2f, 0x35, 0x48, 0x3f, 0xfe,
-    0xca, 0x3f, 0x48, 0x48, 0x3f, 0x55, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x01, 0xf9,
-    0x02, 0xd0, 0x00, 0x0b, 0x00, 0x29, 0x40, 0x26,
-    0x02, 0x01, 0x00, 0x00, 0x01, 0x5f, 0x00, 0x01,
-    0x01, 0x3a, 0x4d, 0x06, 0x05, 0x02, 0x03, 0x03,
-    0x04, 0x5f, 0x00, 0x04, 0x04, 0x3b, 0x04, 0x4e,
-    0x00, 0x00, 0x00, 0x0b, 0x00, 0x0b, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x07, 0x09, 0x1b, 0x2b, 0x37,
-    0x11, 0x23, 0x35, 0x21, 0x15, 0x23, 0x11, 0x33,
-    0x15, 0x21, 0x35, 0xfe, 0x9f, 0x01, 0x9a, 0x9f,
-    0x9f, 0xfe, 0x66, 0x4f, 0x02, 0x32, 0x4f, 0x4f,
-    0xfd, 0xce, 0x4f, 0x4f, 0x00, 0x01, 0x00, 0x2d,
-    0xff, 0xf6, 0x01, 0xf4, 0x02, 0xd0, 0x00, 0x15,
-    0x00, 0x32, 0x40, 0x2f, 0x00, 0x04, 0x01, 0x00,
-    0x01, 0x04, 0x00, 0x80, 0x00, 0x01, 0x01, 0x02,
-    0x5f, 0x00, 0x02, 0x02, 0x3a, 0x4d, 0x05, 0x01,
-    0x00, 0x00, 0x03, 0x61, 0x00, 0x03, 0x03, 0x43,
-    0x03, 0x4e, 0x01, 0x00, 0x13, 0x12, 0x0e, 0x0c,
-    0x07, 0x06, 0x05, 0x04, 0x00, 0x15, 0x01, 0x15,
-    0x06, 0x09, 0x16, 0x2b, 0x25, 0x32, 0x36, 0x35,
-    0x11, 0x21, 0x35, 0x21, 0x11, 0x14, 0x0e, 0x02,
-    0x23, 0x22, 0x2e, 0x02, 0x27, 0x33, 0x1e, 0x01,
-    0x01, 0x0e, 0x40, 0x4c, 0xfe, 0xe8, 0x01, 0x72,
-    0x20, 0x3c, 0x55, 0x35, 0x2c, 0x4c, 0x3b, 0x27,
-    0x07, 0x5a, 0x09, 0x4a, 0x46, 0x49, 0x3e, 0x01,
-    0xb3, 0x50, 0xfd, 0xfd, 0x31, 0x50, 0x38, 0x1e,
-    0x1a, 0x31, 0x44, 0x2a, 0x30, 0x39, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x5a, 0x00, 0x00, 0x02, 0x3f,
-    0x02, 0xd0, 0x00, 0x0c, 0x00, 0x27, 0x40, 0x24,
-    0x06, 0x01, 0x04, 0x01, 0x01, 0x4c, 0x00, 0x01,
-    0x00, 0x04, 0x03, 0x01, 0x04, 0x67, 0x02, 0x01,
-    0x00, 0x00, 0x3a, 0x4d, 0x05, 0x01, 0x03, 0x03,
-    0x3b, 0x03, 0x4e, 0x11, 0x11, 0x12, 0x11, 0x11,
-    0x10, 0x06, 0x09, 0x1c, 0x2b, 0x13, 0x33, 0x11,
-    0x33, 0x13, 0x33, 0x03, 0x13, 0x23, 0x03, 0x23,
-    0x11, 0x23, 0x5a, 0x5a, 0x73, 0xa4, 0x6a, 0xbf,
-    0xc9, 0x6b, 0xad, 0x73, 0x5a, 0x02, 0xd0, 0xfe,
-    0xce, 0x01, 0x32, 0xfe, 0xaa, 0xfe, 0x86, 0x01,
-    0x4f, 0xfe, 0xb1, 0x00, 0x00, 0x01, 0x00, 0x69,
-    0x00, 0x00, 0x02, 0x17, 0x02, 0xd0, 0x00, 0x05,
-    0x00, 0x1f, 0x40, 0x1c, 0x03, 0x01, 0x02, 0x02,
-    0x3a, 0x4d, 0x00, 0x00, 0x00, 0x01, 0x60, 0x00,
-    0x01, 0x01, 0x3b, 0x01, 0x4e, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x05, 0x11, 0x11, 0x04, 0x09, 0x18,
-    0x2b, 0x13, 0x11, 0x21, 0x15, 0x21, 0x11, 0xc3,
-    0x01, 0x54, 0xfe, 0x52, 0x02, 0xd0, 0xfd, 0x82,
-    0x52, 0x02, 0xd0, 0x00, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x00, 0x02, 0x0d, 0x02, 0xd0, 0x00, 0x2d,
-    0x00, 0x2f, 0x40, 0x2c, 0x26, 0x18, 0x16, 0x08,
-    0x04, 0x03, 0x00, 0x01, 0x4c, 0x00, 0x03, 0x00,
-    0x02, 0x00, 0x03, 0x02, 0x80, 0x01, 0x01, 0x00,
-    0x00, 0x3a, 0x4d, 0x05, 0x04, 0x02, 0x02, 0x02,
-    0x3b, 0x02, 0x4e, 0x00, 0x00, 0x00, 0x2d, 0x00,
-    0x2d, 0x1d, 0x11, 0x1d, 0x11, 0x06, 0x09, 0x1a,
-    0x2b, 0x33, 0x11, 0x33, 0x17, 0x1e, 0x01, 0x17,
-    0x16, 0x17, 0x33, 0x36, 0x37, 0x3e, 0x01, 0x3f,
-    0x01, 0x33, 0x11, 0x23, 0x11, 0x34, 0x36, 0x37,
-    0x36, 0x37, 0x23, 0x06, 0x07, 0x0e, 0x01, 0x0f,
-    0x01, 0x23, 0x27, 0x2e, 0x01, 0x27, 0x26, 0x27,
-    0x23, 0x16, 0x17, 0x14, 0x16, 0x15, 0x11, 0x4b,
-    0x70, 0x58, 0x05, 0x08, 0x03, 0x04, 0x04, 0x06,
-    0x04, 0x04, 0x04, 0x09, 0x04, 0x53, 0x70, 0x53,
-    0x01, 0x02, 0x01, 0x01, 0x06, 0x06, 0x06, 0x05,
-    0x0d, 0x06, 0x3e, 0x54, 0x3e, 0x06, 0x0e, 0x05,
-    0x06, 0x06, 0x05, 0x01, 0x01, 0x01, 0x02, 0xd0,
-    0xf4, 0x0b, 0x1d, 0x0c, 0x0f, 0x0e, 0x0e, 0x0f,
-    0x0c, 0x1d, 0x0b, 0xf4, 0xfd, 0x30, 0x01, 0xf9,
-    0x10, 0x28, 0x13, 0x16, 0x16, 0x15, 0x14, 0x12,
-    0x2a, 0x12, 0xb9, 0xb9, 0x13, 0x2a, 0x12, 0x15,
-    0x14, 0x16, 0x16, 0x12, 0x29, 0x11, 0xfe, 0x07,
-    0x00, 0x01, 0x00, 0x55, 0x00, 0x00, 0x02, 0x03,
-    0x02, 0xd0, 0x00, 0x1f, 0x00, 0x1d, 0x40, 0x1a,
-    0x1a, 0x01, 0x02, 0x00, 0x01, 0x4c, 0x01, 0x01,
-    0x00, 0x00, 0x3a, 0x4d, 0x03, 0x01, 0x02, 0x02,
-    0x3b, 0x02, 0x4e, 0x1d, 0x11, 0x1d, 0x10, 0x04,
-    0x09, 0x1a, 0x2b, 0x13, 0x33, 0x13, 0x1e, 0x01,
-    0x17, 0x16, 0x17, 0x33, 0x30, 0x2e, 0x02, 0x35,
-    0x11, 0x33, 0x11, 0x23, 0x03, 0x2e, 0x01, 0x27,
-    0x26, 0x27, 0x23, 0x16, 0x17, 0x1e, 0x01, 0x15,
-    0x11, 0x23, 0x55, 0x72, 0xbf, 0x08, 0x0e, 0x05,
-    0x07, 0x06, 0x08, 0x02, 0x04, 0x03, 0x56, 0x72,
-    0xbc, 0x08, 0x10, 0x05, 0x07, 0x05, 0x08, 0x02,
-    0x02, 0x01, 0x02, 0x56, 0x02, 0xd0, 0xfe, 0x1d,
-    0x12, 0x2f, 0x15, 0x19, 0x1a, 0x15, 0x24, 0x2f,
-    0x1a, 0x01, 0xea, 0xfd, 0x30, 0x01, 0xe4, 0x17,
-    0x30, 0x14, 0x17, 0x17, 0x10, 0x14, 0x11, 0x2f,
-    0x1d, 0xfe, 0x14, 0x00, 0x00, 0x02, 0x00, 0x5a,
-    0x00, 0x00, 0x02, 0x26, 0x02, 0xd0, 0x00, 0x0e,
-    0x00, 0x17, 0x00, 0x32, 0x40, 0x2f, 0x00, 0x03,
-    0x00, 0x01, 0x02, 0x03, 0x01, 0x67, 0x06, 0x01,
-    0x04, 0x04, 0x00, 0x5f, 0x05, 0x01, 0x00, 0x00,
-    0x3a, 0x4d, 0x00, 0x02, 0x02, 0x3b, 0x02, 0x4e,
-    0x0f, 0x0f, 0x01, 0x00, 0x0f, 0x17, 0x0f, 0x16,
-    0x12, 0x10, 0x0d, 0x0c, 0x0b, 0x09, 0x00, 0x0e,
-    0x01, 0x0e, 0x07, 0x09, 0x16, 0x2b, 0x01, 0x32,
-    0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x2b, 0x01,
-    0x11, 0x23, 0x11, 0x17, 0x11, 0x33, 0x32, 0x36,
-    0x35, 0x34, 0x26, 0x23, 0x01, 0x4d, 0x31, 0x50,
-    0x39, 0x1f, 0x20, 0x39, 0x50, 0x30, 0x99, 0x5a,
-    0x5a, 0x99, 0x38, 0x44, 0x44, 0x38, 0x02, 0xd0,
-    0x1e, 0x38, 0x4d, 0x2f, 0x2f, 0x4d, 0x38, 0x1e,
-    0xfe, 0xd4, 0x02, 0xd0, 0x50, 0xfe, 0xfc, 0x47,
-    0x3b, 0x3b, 0x47, 0x00, 0x00, 0x02, 0x00, 0x50,
-    0xff, 0x5b, 0x02, 0x0e, 0x02, 0xda, 0x00, 0x19,
-    0x00, 0x27, 0x00, 0x2b, 0x40, 0x28, 0x0e, 0x01,
-    0x02, 0x03, 0x01, 0x4c, 0x00, 0x04, 0x04, 0x00,
-    0x61, 0x00, 0x00, 0x00, 0x42, 0x4d, 0x00, 0x03,
-    0x03, 0x02, 0x61, 0x00, 0x02, 0x02, 0x43, 0x4d,
-    0x00, 0x01, 0x01, 0x3f, 0x01, 0x4e, 0x25, 0x27,
-    0x23, 0x19, 0x24, 0x05, 0x09, 0x1b, 0x2b, 0x13,
-    0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15,
-    0x11, 0x14, 0x06, 0x07, 0x17, 0x23, 0x27, 0x06,
-    0x22, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x33, 0x14,
-    0x16, 0x33, 0x32, 0x36, 0x35, 0x11, 0x34, 0x26,
-    0x23, 0x22, 0x06, 0x15, 0x50, 0x1f, 0x39, 0x51,
-    0x33, 0x33, 0x51, 0x39, 0x1f, 0x3a, 0x35, 0x75,
-    0x68, 0x67, 0x05, 0x09, 0x05, 0x33, 0x51, 0x39,
-    0x1f, 0x5a, 0x46, 0x3c, 0x3c, 0x46, 0x46, 0x3c,
-    0x3c, 0x46, 0x02, 0x03, 0x31, 0x50, 0x38, 0x1e,
-    0x1e, 0x38, 0x50, 0x31, 0xfe, 0xca, 0x44, 0x63,
-    0x19, 0xb2, 0x9c, 0x01, 0x1e, 0x38, 0x50, 0x31,
-    0x3e, 0x49, 0x49, 0x3e, 0x01, 0x36, 0x3e, 0x49,
-    0x49, 0x3e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x5a,
-    0x00, 0x00, 0x02, 0x23, 0x02, 0xd0, 0x00, 0x0f,
-    0x00, 0x18, 0x00, 0x2b, 0x40, 0x28, 0x09, 0x01,
-    0x02, 0x04, 0x01, 0x4c, 0x00, 0x04, 0x00, 0x02,
-    0x01, 0x04, 0x02, 0x67, 0x00, 0x05, 0x05, 0x00,
-    0x5f, 0x00, 0x00, 0x00, 0x3a, 0x4d, 0x03, 0x01,
-    0x01, 0x01, 0x3b, 0x01, 0x4e, 0x24, 0x21, 0x11,
-    0x11, 0x18, 0x20, 0x06, 0x09, 0x1c, 0x2b, 0x13,
-    0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x06, 0x07,
-    0x13, 0x23, 0x03, 0x23, 0x11, 0x23, 0x13, 0x33,
-    0x32, 0x36, 0x35, 0x34, 0x26, 0x2b, 0x01, 0x5a,
-    0xe6, 0x31, 0x50, 0x39, 0x1f, 0x4d, 0x42, 0x99,
-    0x6a, 0x8c, 0x79, 0x5a, 0x5a, 0x8c, 0x39, 0x43,
-    0x44, 0x38, 0x8c, 0x02, 0xd0, 0x1e, 0x38, 0x4d,
-    0x2f, 0x4b, 0x69, 0x14, 0xfe, 0xca, 0x01, 0x2c,
-    0xfe, 0xd4, 0x01, 0x7c, 0x47, 0x3b, 0x3b, 0x47,
-    0x00, 0x01, 0x00, 0x46, 0xff, 0xf6, 0x02, 0x12,
-    0x02, 0xda, 0x00, 0x2e, 0x00, 0x3b, 0x40, 0x38,
-    0x00, 0x04, 0x05, 0x01, 0x05, 0x04, 0x01, 0x80,
-    0x00, 0x01, 0x02, 0x05, 0x01, 0x02, 0x7e, 0x00,
-    0x05, 0x05, 0x03, 0x61, 0x00, 0x03, 0x03, 0x42,
-    0x4d, 0x00, 0x02, 0x02, 0x00, 0x61, 0x06, 0x01,
-    0x00, 0x00, 0x43, 0x00, 0x4e, 0x01, 0x00, 0x23,
-    0x21, 0x1d, 0x1c, 0x18, 0x16, 0x0c, 0x0a, 0x06,
-    0x05, 0x00, 0x2e, 0x01, 0x2e, 0x07, 0x09, 0x16,
-    0x2b, 0x05, 0x22, 0x2e, 0x02, 0x27, 0x33, 0x14,
-    0x1e, 0x02, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26,
-    0x2f, 0x01, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32,
-    0x1e, 0x02, 0x17, 0x23, 0x34, 0x2e, 0x02, 0x23,
-    0x22, 0x06, 0x15, 0x14, 0x16, 0x1f, 0x01, 0x1e,
-    0x01, 0x15, 0x14, 0x06, 0x01, 0x2c, 0x31, 0x54,
-    0x3d, 0x23, 0x01, 0x5f, 0x15, 0x26, 0x32, 0x1c,
-    0x3f, 0x4a, 0x36, 0x33, 0x4c, 0xa7, 0x72, 0x64,
-    0x2f, 0x4e, 0x39, 0x21, 0x01, 0x5f, 0x14, 0x21,
-    0x2c, 0x19, 0x39, 0x41, 0x31, 0x37, 0x50, 0x50,
-    0x54, 0x7b, 0x0a, 0x1b, 0x33, 0x48, 0x2d, 0x1a,
-    0x2a, 0x1e, 0x11, 0x3b, 0x33, 0x2b, 0x43, 0x13,
-    0x1c, 0x3d, 0x8d, 0x5a, 0x65, 0x1a, 0x32, 0x47,
-    0x2c, 0x19, 0x29, 0x1d, 0x10, 0x36, 0x2e, 0x2d,
-    0x3b, 0x14, 0x1d, 0x1d, 0x6e, 0x4b, 0x5a, 0x67,
-    0x00, 0x01, 0x00, 0x2d, 0x00, 0x00, 0x02, 0x2b,
-    0x02, 0xd0, 0x00, 0x07, 0x00, 0x1b, 0x40, 0x18,
-    0x03, 0x01, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00,
-    0x00, 0x3a, 0x4d, 0x00, 0x02, 0x02, 0x3b, 0x02,
-    0x4e, 0x11, 0x11, 0x11, 0x10, 0x04, 0x09, 0x1a,
-    0x2b, 0x13, 0x21, 0x15, 0x23, 0x11, 0x23, 0x11,
-    0x23, 0x2d, 0x01, 0xfe, 0xd1, 0x5c, 0xd1, 0x02,
-    0xd0, 0x4f, 0xfd, 0x7f, 0x02, 0x81, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x55, 0xff, 0xf6, 0x02, 0x03,
-    0x02, 0xd0, 0x00, 0x11, 0x00, 0x24, 0x40, 0x21,
-    0x03, 0x01, 0x01, 0x01, 0x3a, 0x4d, 0x00, 0x02,
-    0x02, 0x00, 0x61, 0x04, 0x01, 0x00, 0x00, 0x43,
-    0x00, 0x4e, 0x01, 0x00, 0x0e, 0x0d, 0x0a, 0x08,
-    0x05, 0x04, 0x00, 0x11, 0x01, 0x11, 0x05, 0x09,
-    0x16, 0x2b, 0x05, 0x22, 0x26, 0x35, 0x11, 0x33,
-    0x11, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x11,
-    0x33, 0x11, 0x14, 0x06, 0x01, 0x2c, 0x67, 0x70,
-    0x5a, 0x40, 0x3d, 0x3c, 0x41, 0x5a, 0x70, 0x0a,
-    0x70, 0x62, 0x02, 0x08, 0xfd, 0xf8, 0x3c, 0x46,
-    0x46, 0x3c, 0x02, 0x08, 0xfd, 0xf8, 0x63, 0x6f,
-    0x00, 0x01, 0x00, 0x2c, 0x00, 0x00, 0x02, 0x2c,
-    0x02, 0xd0, 0x00, 0x11, 0x00, 0x1b, 0x40, 0x18,
-    0x07, 0x01, 0x02, 0x00, 0x01, 0x4c, 0x01, 0x01,
-    0x00, 0x00, 0x3a, 0x4d, 0x00, 0x02, 0x02, 0x3b,
-    0x02, 0x4e, 0x11, 0x1d, 0x10, 0x03, 0x09, 0x19,
-    0x2b, 0x13, 0x33, 0x13, 0x1e, 0x01, 0x17, 0x16,
-    0x17, 0x33, 0x36, 0x37, 0x3e, 0x01, 0x37, 0x13,
-    0x33, 0x03, 0x23, 0x2c, 0x60, 0x8a, 0x05, 0x08,
-    0x02, 0x02, 0x02, 0x04, 0x02, 0x03, 0x02, 0x08,
-    0x05, 0x8d, 0x5e, 0xc4, 0x7e, 0x02, 0xd0, 0xfd,
-    0xcd, 0x15, 0x23, 0x0d, 0x10, 0x0c, 0x0c, 0x10,
-    0x0d, 0x23, 0x15, 0x02, 0x33, 0xfd, 0x30, 0x00,
-    0x00, 0x01, 0x00, 0x19, 0x00, 0x00, 0x02, 0x3f,
-    0x02, 0xd0, 0x00, 0x2d, 0x00, 0x2d, 0x40, 0x2a,
-    0x00, 0x05, 0x05, 0x01, 0x5f, 0x08, 0x07, 0x03,
-    0x03, 0x01, 0x01, 0x3a, 0x4d, 0x02, 0x01, 0x00,
-    0x00, 0x04, 0x60, 0x06, 0x01, 0x04, 0x04, 0x3b,
-    0x04, 0x4e, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x2d,
-    0x16, 0x16, 0x11, 0x16, 0x16, 0x16, 0x16, 0x09,
-    0x09, 0x1d, 0x2b, 0x1b, 0x01, 0x1e, 0x01, 0x17,
-    0x16, 0x17, 0x33, 0x36, 0x37, 0x3e, 0x01, 0x37,
-    0x13, 0x33, 0x13, 0x1e, 0x01, 0x17, 0x16, 0x17,
-    0x33, 0x36, 0x37, 0x3e, 0x01, 0x37, 0x13, 0x33,
-    0x03, 0x23, 0x03, 0x2e, 0x01, 0x27, 0x34, 0x35,
-    0x23, 0x14, 0x15, 0x0e, 0x01, 0x07, 0x03, 0x23,
-    0x03, 0x66, 0x2e, 0x02, 0x02, 0x01, 0x01, 0x01,
-    0x0b, 0x02, 0x03, 0x02, 0x06, 0x02, 0x46, 0x64,
-    0x42, 0x02, 0x06, 0x02, 0x03, 0x03, 0x0b, 0x01,
-    0x01, 0x01, 0x02, 0x02, 0x2f, 0x4d, 0x4b, 0x7a,
-    0x3f, 0x03, 0x03, 0x01, 0x0d, 0x01, 0x03, 0x04,
-    0x44, 0x7a, 0x48, 0x02, 0xd0, 0xfd, 0xf2, 0x13,
-    0x30, 0x15, 0x19, 0x1a, 0x1a, 0x19, 0x15, 0x30,
-    0x13, 0x02, 0x0e, 0xfd, 0xf2, 0x12, 0x30, 0x16,
-    0x19, 0x1a, 0x1a, 0x19, 0x15, 0x30, 0x13, 0x02,
-    0x0e, 0xfd, 0x30, 0x02, 0x11, 0x1d, 0x31, 0x11,
-    0x15, 0x11, 0x11, 0x15, 0x11, 0x31, 0x1d, 0xfd,
-    0xef, 0x02, 0xd0, 0x00, 0x00, 0x01, 0x00, 0x28,
-    0x00, 0x00, 0x02, 0x30, 0x02, 0xd0, 0x00, 0x1c,
-    0x00, 0x1f, 0x40, 0x1c, 0x14, 0x0e, 0x07, 0x03,
-    0x02, 0x00, 0x01, 0x4c, 0x01, 0x01, 0x00, 0x00,
-    0x3a, 0x4d, 0x03, 0x01, 0x02, 0x02, 0x3b, 0x02,
-    0x4e, 0x1b, 0x12, 0x1a, 0x11, 0x04, 0x09, 0x1a,
-    0x2b, 0x13, 0x03, 0x33, 0x17, 0x16, 0x17, 0x16,
-    0x17, 0x33, 0x36, 0x3f, 0x02, 0x33, 0x03, 0x13,
-    0x23, 0x2f, 0x01, 0x26, 0x27, 0x23, 0x06, 0x07,
-    0x0e, 0x01, 0x0f, 0x01, 0x23, 0xfa, 0xc7, 0x68,
-    0x71, 0x0e, 0x08, 0x06, 0x04, 0x03, 0x04, 0x06,
-    0x16, 0x73, 0x63, 0xc7, 0xd2, 0x67, 0x7d, 0x16,
-    0x06, 0x04, 0x03, 0x04, 0x05, 0x05, 0x0b, 0x06,
-    0x7e, 0x64, 0x01, 0x6f, 0x01, 0x61, 0xd1, 0x18,
-    0x14, 0x0a, 0x0a, 0x09, 0x0b, 0x2c, 0xd1, 0xfe,
-    0xa5, 0xfe, 0x8b, 0xe5, 0x2c, 0x0b, 0x0a, 0x0a,
-    0x0b, 0x09, 0x17, 0x0b, 0xe6, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x02, 0x3a,
-    0x02, 0xd0, 0x00, 0x13, 0x00, 0x1d, 0x40, 0x1a,
-    0x13, 0x10, 0x07, 0x03, 0x02, 0x00, 0x01, 0x4c,
-    0x01, 0x01, 0x00, 0x00, 0x3a, 0x4d, 0x00, 0x02,
-    0x02, 0x3b, 0x02, 0x4e, 0x12, 0x1d, 0x10, 0x03,
-    0x09, 0x19, 0x2b, 0x13, 0x33, 0x13, 0x1e, 0x01,
-    0x17, 0x16, 0x17, 0x33, 0x36, 0x37, 0x3e, 0x01,
-    0x37, 0x13, 0x33, 0x03, 0x15, 0x23, 0x35, 0x1e,
-    0x5f, 0x94, 0x07, 0x09, 0x04, 0x04, 0x03, 0x04,
-    0x03, 0x05, 0x03, 0x0a, 0x06, 0x8f, 0x60, 0xe1,
-    0x5a, 0x02, 0xd0, 0xfe, 0xc3, 0x0e, 0x1c, 0x0b,
-    0x0d, 0x0d, 0x0d, 0x0d, 0x0b, 0x1c, 0x0e, 0x01,
-    0x3d, 0xfe, 0x2a, 0xfa, 0xfa, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x55, 0x00, 0x00, 0x02, 0x03,
-    0x02, 0xd0, 0x00, 0x0d, 0x00, 0x2c, 0x40, 0x29,
-    0x08, 0x01, 0x02, 0x00, 0x02, 0x01, 0x4c, 0x00,
-    0x02, 0x02, 0x03, 0x5f, 0x04, 0x01, 0x03, 0x03,
-    0x3a, 0x4d, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x00,
-    0x01, 0x01, 0x3b, 0x01, 0x4e, 0x00, 0x00, 0x00,
-    0x0d, 0x00, 0x0d, 0x32, 0x11, 0x32, 0x05, 0x09,
-    0x19, 0x2b, 0x01, 0x15, 0x01, 0x15, 0x37, 0x21,
-    0x15, 0x21, 0x35, 0x01, 0x35, 0x07, 0x23, 0x35,
-    0x01, 0xf8, 0xfe, 0xb7, 0x46, 0x01, 0x0e, 0xfe,
-    0x52, 0x01, 0x49, 0x48, 0xf9, 0x02, 0xd0, 0x51,
-    0xfd, 0xce, 0x02, 0x04, 0x4f, 0x50, 0x02, 0x32,
-    0x02, 0x03, 0x4f, 0x00, 0x00, 0x01, 0x00, 0xd6,
-    0xff, 0xf6, 0x01, 0x82, 0x00, 0xa5, 0x00, 0x0b,
-    0x00, 0x13, 0x40, 0x10, 0x00, 0x00, 0x00, 0x01,
-    0x61, 0x00, 0x01, 0x01, 0x43, 0x01, 0x4e, 0x24,
-    0x22, 0x02, 0x09, 0x18, 0x2b, 0x37, 0x34, 0x36,
-    0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22,
-    0x26, 0xd6, 0x2f, 0x27, 0x27, 0x2f, 0x2f, 0x27,
-    0x27, 0x2f, 0x4f, 0x27, 0x2f, 0x2f, 0x27, 0x28,
-    0x31, 0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x3f,
-    0xff, 0xf6, 0x02, 0x00, 0x02, 0x30, 0x00, 0x1d,
-    0x00, 0x2a, 0x00, 0x78, 0xb5, 0x17, 0x01, 0x06,
-    0x07, 0x01, 0x4c, 0x4b, 0xb0, 0x18, 0x50, 0x58,
-    0x40, 0x27, 0x00, 0x02, 0x01, 0x00, 0x01, 0x02,
-    0x00, 0x80, 0x00, 0x00, 0x00, 0x07, 0x06, 0x00,
-    0x07, 0x67, 0x00, 0x01, 0x01, 0x03, 0x61, 0x00,
-    0x03, 0x03, 0x45, 0x4d, 0x08, 0x01, 0x06, 0x06,
-    0x04, 0x61, 0x05, 0x01, 0x04, 0x04, 0x3b, 0x04,
-    0x4e, 0x1b, 0x40, 0x2b, 0x00, 0x02, 0x01, 0x00,
-    0x01, 0x02, 0x00, 0x80, 0x00, 0x00, 0x00, 0x07,
-    0x06, 0x00, 0x07, 0x67, 0x00, 0x01, 0x01, 0x03,
-    0x61, 0x00, 0x03, 0x03, 0x45, 0x4d, 0x00, 0x04,
-    0x04, 0x3b, 0x4d, 0x08, 0x01, 0x06, 0x06, 0x05,
-    0x61, 0x00, 0x05, 0x05, 0x43, 0x05, 0x4e, 0x59,
-    0x40, 0x11, 0x1f, 0x1e, 0x26, 0x24, 0x1e, 0x2a,
-    0x1f, 0x2a, 0x24, 0x13, 0x22, 0x12, 0x23, 0x24,
-    0x09, 0x09, 0x1c, 0x2b, 0x37, 0x34, 0x3e, 0x02,
-    0x3b, 0x01, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06,
-    0x07, 0x23, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x15,
-    0x11, 0x23, 0x35, 0x23, 0x0e, 0x01, 0x23, 0x22,
-    0x26, 0x17, 0x32, 0x3e, 0x02, 0x3d, 0x01, 0x23,
-    0x22, 0x06, 0x15, 0x14, 0x16, 0x3f, 0x1b, 0x33,
-    0x48, 0x2d, 0xa4, 0x43, 0x3f, 0x2e, 0x41, 0x0b,
-    0x5a, 0x0e, 0x73, 0x55, 0x66, 0x74, 0x52, 0x08,
-    0x0d, 0x60, 0x45, 0x53, 0x62, 0xc9, 0x22, 0x3a,
-    0x2a, 0x18, 0xa2, 0x32, 0x39, 0x3a, 0xa0, 0x27,
-    0x3f, 0x2c, 0x18, 0x2d, 0x33, 0x39, 0x22, 0x1e,
-    0x41, 0x4c, 0x5f, 0x55, 0xfe, 0x84, 0x69, 0x35,
-    0x3e, 0x5c, 0x12, 0x12, 0x21, 0x2c, 0x1a, 0x4b,
-    0x34, 0x2e, 0x2e, 0x34, 0x00, 0x02, 0x00, 0x58,
-    0xff, 0xf6, 0x02, 0x08, 0x02, 0xda, 0x00, 0x1c,
-    0x00, 0x2a, 0x00, 0xaa, 0x40, 0x0b, 0x05, 0x01,
-    0x05, 0x01, 0x19, 0x07, 0x02, 0x04, 0x05, 0x02,
-    0x4c, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x1b,
-    0x00, 0x00, 0x00, 0x3c, 0x4d, 0x00, 0x05, 0x05,
-    0x01, 0x61, 0x00, 0x01, 0x01, 0x45, 0x4d, 0x00,
-    0x04, 0x04, 0x02, 0x61, 0x03, 0x01, 0x02, 0x02,
-    0x43, 0x02, 0x4e, 0x1b, 0x4b, 0xb0, 0x18, 0x50,
-    0x58, 0x40, 0x1b, 0x00, 0x00, 0x00, 0x3a, 0x4d,
-    0x00, 0x05, 0x05, 0x01, 0x61, 0x00, 0x01, 0x01,
-    0x45, 0x4d, 0x00, 0x04, 0x04, 0x02, 0x61, 0x03,
-    0x01, 0x02, 0x02, 0x43, 0x02, 0x4e, 0x1b, 0x4b,
-    0xb0, 0x31, 0x50, 0x58, 0x40, 0x1f, 0x00, 0x00,
-    0x00, 0x3a, 0x4d, 0x00, 0x05, 0x05, 0x01, 0x61,
-    0x00, 0x01, 0x01, 0x45, 0x4d, 0x00, 0x03, 0x03,
-    0x3b, 0x4d, 0x00, 0x04, 0x04, 0x02, 0x61, 0x00,
-    0x02, 0x02, 0x43, 0x02, 0x4e, 0x1b, 0x40, 0x1f,
-    0x00, 0x05, 0x05, 0x01, 0x61, 0x00, 0x01, 0x01,
-    0x45, 0x4d, 0x00, 0x00, 0x00, 0x03, 0x5f, 0x00,
-    0x03, 0x03, 0x3b, 0x4d, 0x00, 0x04, 0x04, 0x02,
-    0x61, 0x00, 0x02, 0x02, 0x43, 0x02, 0x4e, 0x59,
-    0x59, 0x59, 0x40, 0x09, 0x25, 0x23, 0x14, 0x29,
-    0x29, 0x10, 0x06, 0x09, 0x1c, 0x2b, 0x13, 0x33,
-    0x15, 0x14, 0x06, 0x07, 0x06, 0x07, 0x33, 0x3e,
-    0x01, 0x33, 0x32, 0x1e, 0x02, 0x1d, 0x01, 0x14,
-    0x0e, 0x02, 0x23, 0x22, 0x26, 0x27, 0x23, 0x15,
-    0x23, 0x37, 0x14, 0x16, 0x33, 0x32, 0x36, 0x3d,
-    0x01, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x58,
-    0x5a, 0x01, 0x01, 0x02, 0x01, 0x08, 0x0d, 0x50,
-    0x3d, 0x2a, 0x44, 0x30, 0x1b, 0x1b, 0x30, 0x44,
-    0x2a, 0x3d, 0x50, 0x0d, 0x08, 0x55, 0x5a, 0x43,
-    0x38, 0x3c, 0x45, 0x44, 0x3d, 0x38, 0x43, 0x02,
-    0xda, 0xaa, 0x0e, 0x25, 0x10, 0x13, 0x13, 0x32,
-    0x37, 0x1e, 0x37, 0x50, 0x32, 0x8c, 0x32, 0x50,
-    0x37, 0x1e, 0x37, 0x32, 0x5f, 0xcd, 0x3f, 0x4a,
-    0x4a, 0x3f, 0x8c, 0x41, 0x48, 0x4a, 0x3f, 0x00,
-    0x00, 0x01, 0x00, 0x58, 0xff, 0xf6, 0x02, 0x10,
-    0x02, 0x30, 0x00, 0x1f, 0x00, 0x3b, 0x40, 0x38,
-    0x00, 0x02, 0x03, 0x05, 0x03, 0x02, 0x05, 0x80,
-    0x00, 0x05, 0x04, 0x03, 0x05, 0x04, 0x7e, 0x00,
-    0x03, 0x03, 0x01, 0x61, 0x00, 0x01, 0x01, 0x45,
-    0x4d, 0x00, 0x04, 0x04, 0x00, 0x61, 0x06, 0x01,
-    0x00, 0x00, 0x43, 0x00, 0x4e, 0x01, 0x00, 0x1d,
-    0x1c, 0x1a, 0x18, 0x13, 0x11, 0x0f, 0x0e, 0x0c,
-    0x0a, 0x00, 0x1f, 0x01, 0x1f, 0x07, 0x09, 0x16,
-    0x2b, 0x05, 0x22, 0x2e, 0x02, 0x3d, 0x01, 0x34,
-    0x3e, 0x02, 0x33, 0x32, 0x16, 0x17, 0x23, 0x2e,
-    0x01, 0x23, 0x22, 0x06, 0x1d, 0x01, 0x14, 0x16,
-    0x33, 0x32, 0x36, 0x37, 0x33, 0x0e, 0x01, 0x01,
-    0x34, 0x33, 0x51, 0x39, 0x1f, 0x1f, 0x39, 0x51,
-    0x33, 0x5b, 0x75, 0x0c, 0x5a, 0x07, 0x47, 0x34,
-    0x3c, 0x46, 0x45, 0x3d, 0x34, 0x47, 0x07, 0x5a,
-    0x0d, 0x75, 0x0a, 0x1e, 0x38, 0x50, 0x31, 0x8c,
-    0x31, 0x50, 0x38, 0x1e, 0x63, 0x56, 0x30, 0x39,
-    0x48, 0x3f, 0x8c, 0x3f, 0x48, 0x39, 0x30, 0x57,
-    0x62, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x50,
-    0xff, 0xf6, 0x02, 0x08, 0x02, 0x30, 0x00, 0x16,
-    0x00, 0x1f, 0x00, 0x43, 0x40, 0x40, 0x00, 0x04,
-    0x02, 0x03, 0x02, 0x04, 0x03, 0x80, 0x08, 0x01,
-    0x06, 0x00, 0x02, 0x04, 0x06, 0x02, 0x67, 0x00,
-    0x05, 0x05, 0x01, 0x61, 0x00, 0x01, 0x01, 0x45,
-    0x4d, 0x00, 0x03, 0x03, 0x00, 0x61, 0x07, 0x01,
-    0x00, 0x00, 0x43, 0x00, 0x4e, 0x17, 0x17, 0x01,
-    0x00, 0x17, 0x1f, 0x17, 0x1f, 0x1c, 0x1a, 0x14,
-    0x13, 0x11, 0x0f, 0x0c, 0x0b, 0x08, 0x06, 0x00,
-    0x16, 0x01, 0x16, 0x09, 0x09, 0x16, 0x2b, 0x05,
-    0x22, 0x26, 0x3d, 0x01, 0x34, 0x36, 0x33, 0x32,
-    0x16, 0x1d, 0x01, 0x21, 0x15, 0x14, 0x16, 0x33,
-    0x32, 0x36, 0x37, 0x33, 0x0e, 0x01, 0x13, 0x35,
-    0x34, 0x26, 0x23, 0x22, 0x06, 0x1d, 0x01, 0x01,
-    0x2c, 0x67, 0x75, 0x75, 0x67, 0x67, 0x75, 0xfe,
-    0xa2, 0x45, 0x3d, 0x2d, 0x42, 0x10, 0x5a, 0x11,
-    0x75, 0x2f, 0x44, 0x3e, 0x3e, 0x44, 0x0a, 0x70,
-    0x62, 0x96, 0x62, 0x70, 0x70, 0x62, 0x65, 0x2c,
-    0x3f, 0x48, 0x1c, 0x1b, 0x3f, 0x48, 0x01, 0x4e,
-    0x1a, 0x3e, 0x44, 0x44, 0x3e, 0x1a, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x3c, 0x00, 0x00, 0x02, 0x17,
-    0x02, 0xda, 0x00, 0x12, 0x00, 0x75, 0x4b, 0xb0,
-    0x17, 0x50, 0x58, 0x40, 0x1b, 0x03, 0x01, 0x00,
-    0x07, 0x06, 0x02, 0x04, 0x05, 0x00, 0x04, 0x67,
-    0x00, 0x02, 0x02, 0x01, 0x5f, 0x00, 0x01, 0x01,
-    0x3c, 0x4d, 0x00, 0x05, 0x05, 0x3b, 0x05, 0x4e,
-    0x1b, 0x4b, 0xb0, 0x31, 0x50, 0x58, 0x40, 0x1b,
-    0x03, 0x01, 0x00, 0x07, 0x06, 0x02, 0x04, 0x05,
-    0x00, 0x04, 0x67, 0x00, 0x02, 0x02, 0x01, 0x5f,
-    0x00, 0x01, 0x01, 0x3a, 0x4d, 0x00, 0x05, 0x05,
-    0x3b, 0x05, 0x4e, 0x1b, 0x40, 0x19, 0x00, 0x01,
-    0x00, 0x02, 0x00, 0x01, 0x02, 0x67, 0x03, 0x01,
-    0x00, 0x07, 0x06, 0x02, 0x04, 0x05, 0x00, 0x04,
-    0x67, 0x00, 0x05, 0x05, 0x3b, 0x05, 0x4e, 0x59,
-    0x59, 0x40, 0x0f, 0x00, 0x00, 0x00, 0x12, 0x00,
-    0x12, 0x11, 0x11, 0x12, 0x21, 0x23, 0x11, 0x08,
-    0x09, 0x1c, 0x2b, 0x13, 0x35, 0x33, 0x35, 0x34,
-    0x36, 0x3b, 0x01, 0x15, 0x23, 0x22, 0x1d, 0x01,
-    0x33, 0x15, 0x23, 0x11, 0x23, 0x11, 0x3c, 0xa0,
-    0x52, 0x48, 0xa1, 0xa1, 0x40, 0xe1, 0xe1, 0x5a,
-    0x01, 0x9d, 0x52, 0x5f, 0x42, 0x4a, 0x52, 0x3a,
-    0x5f, 0x52, 0xfe, 0x63, 0x01, 0x9d, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x55, 0xff, 0x5b, 0x01, 0xc7,
-    0x02, 0xfd, 0x00, 0x0f, 0x00, 0x1d, 0x00, 0x5b,
-    0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x20, 0x00,
-    0x05, 0x05, 0x04, 0x61, 0x06, 0x01, 0x04, 0x04,
-    0x44, 0x4d, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x00,
-    0x01, 0x01, 0x3d, 0x4d, 0x00, 0x03, 0x03, 0x02,
-    0x5f, 0x00, 0x02, 0x02, 0x3f, 0x02, 0x4e, 0x1b,
-    0x40, 0x1e, 0x06, 0x01, 0x04, 0x00, 0x05, 0x01,
-    0x04, 0x05, 0x69, 0x00, 0x00, 0x00, 0x01, 0x5f,
-    0x00, 0x01, 0x01, 0x3d, 0x4d, 0x00, 0x03, 0x03,
-    0x02, 0x5f, 0x00, 0x02, 0x02, 0x3f, 0x02, 0x4e,
-    0x59, 0x40, 0x0f, 0x11, 0x10, 0x18, 0x15, 0x10,
-    0x1d, 0x11, 0x1c, 0x21, 0x25, 0x11, 0x10, 0x07,
-    0x09, 0x1a, 0x2b, 0x01, 0x23, 0x35, 0x21, 0x11,
-    0x14, 0x0e, 0x02, 0x2b, 0x01, 0x35, 0x33, 0x32,
-    0x36, 0x35, 0x13, 0x32, 0x16, 0x15, 0x14, 0x06,
-    0x2b, 0x01, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33,
-    0x01, 0x59, 0xe6, 0x01, 0x40, 0x22, 0x3d, 0x54,
-    0x33, 0x78, 0x78, 0x3f, 0x4d, 0x2d, 0x1d, 0x24,
-    0x24, 0x1d, 0x14, 0x1d, 0x24, 0x24, 0x1d, 0x01,
-    0xd4, 0x52, 0xfe, 0x11, 0x30, 0x51, 0x3b, 0x20,
-    0x53, 0x4c, 0x3d, 0x02, 0xc6, 0x22, 0x1b, 0x1b,
-    0x20, 0x1f, 0x1c, 0x1b, 0x22, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x3e, 0x00, 0x00, 0x02, 0x1a,
-    0x02, 0x30, 0x00, 0x24, 0x00, 0x4f, 0xb6, 0x09,
-    0x02, 0x02, 0x03, 0x04, 0x01, 0x4c, 0x4b, 0xb0,
-    0x18, 0x50, 0x58, 0x40, 0x15, 0x06, 0x01, 0x04,
-    0x04, 0x00, 0x61, 0x02, 0x01, 0x02, 0x00, 0x00,
-    0x3d, 0x4d, 0x07, 0x05, 0x02, 0x03, 0x03, 0x3b,
-    0x03, 0x4e, 0x1b, 0x40, 0x19, 0x00, 0x00, 0x00,
-    0x3d, 0x4d, 0x06, 0x01, 0x04, 0x04, 0x01, 0x61,
-    0x02, 0x01, 0x01, 0x01, 0x45, 0x4d, 0x07, 0x05,
-    0x02, 0x03, 0x03, 0x3b, 0x03, 0x4e, 0x59, 0x40,
-    0x0b, 0x14, 0x23, 0x12, 0x23, 0x13, 0x25, 0x24,
-    0x10, 0x08, 0x09, 0x1e, 0x2b, 0x13, 0x33, 0x15,
-    0x33, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x17, 0x33,
-    0x3e, 0x01, 0x33, 0x32, 0x16, 0x15, 0x11, 0x23,
-    0x11, 0x34, 0x26, 0x23, 0x22, 0x15, 0x11, 0x23,
-    0x11, 0x34, 0x26, 0x23, 0x22, 0x07, 0x06, 0x15,
-    0x11, 0x23, 0x3e, 0x47, 0x07, 0x04, 0x30, 0x28,
-    0x28, 0x34, 0x0a, 0x05, 0x04, 0x30, 0x28, 0x33,
-    0x38, 0x4e, 0x1f, 0x1d, 0x3d, 0x4e, 0x1b, 0x21,
-    0x1e, 0x11, 0x0e, 0x4e, 0x02, 0x26, 0x51, 0x2c,
-    0x2f, 0x2f, 0x2c, 0x2c, 0x2f, 0x4b, 0x42, 0xfe,
-    0x5d, 0x01, 0xa3, 0x23, 0x25, 0x4d, 0xfe, 0x62,
-    0x01, 0xa3, 0x1d, 0x2b, 0x16, 0x14, 0x23, 0xfe,
-    0x62, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70,
-    0x00, 0x00, 0x02, 0x22, 0x02, 0x30, 0x00, 0x14,
-    0x00, 0x52, 0xb5, 0x02, 0x01, 0x02, 0x03, 0x01,
-    0x4c, 0x4b, 0xb0, 0x18, 0x50, 0x58, 0x40, 0x19,
-    0x00, 0x02, 0x03, 0x04, 0x03, 0x02, 0x04, 0x80,
-    0x00, 0x03, 0x03, 0x00, 0x61, 0x01, 0x01, 0x00,
-    0x00, 0x3d, 0x4d, 0x00, 0x04, 0x04, 0x3b, 0x04,
-    0x4e, 0x1b, 0x40, 0x1d, 0x00, 0x02, 0x03, 0x04,
-    0x03, 0x02, 0x04, 0x80, 0x00, 0x00, 0x00, 0x3d,
-    0x4d, 0x00, 0x03, 0x03, 0x01, 0x61, 0x00, 0x01,
-    0x01, 0x45, 0x4d, 0x00, 0x04, 0x04, 0x3b, 0x04,
-    0x4e, 0x59, 0xb7, 0x13, 0x23, 0x13, 0x24, 0x10,
-    0x05, 0x09, 0x1b, 0x2b, 0x13, 0x33, 0x15, 0x33,
-    0x3e, 0x01, 0x33, 0x32, 0x16, 0x1d, 0x01, 0x23,
-    0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x11,
-    0x23, 0x70, 0x55, 0x08, 0x0d, 0x52, 0x3c, 0x57,
-    0x63, 0x5a, 0x41, 0x3c, 0x3b, 0x46, 0x5a, 0x02,
-    0x26, 0x5f, 0x31, 0x38, 0x6d, 0x5f, 0x1f, 0x14,
-    0x41, 0x47, 0x49, 0x3f, 0xfe, 0xa7, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x4d, 0xff, 0xf6, 0x02, 0x06,
-    0x02, 0x30, 0x00, 0x2c, 0x00, 0x3b, 0x40, 0x38,
-    0x00, 0x04, 0x05, 0x01, 0x05, 0x04, 0x01, 0x80,
-    0x00, 0x01, 0x02, 0x05, 0x01, 0x02, 0x7e, 0x00,
-    0x05, 0x05, 0x03, 0x61, 0x00, 0x03, 0x03, 0x45,
-    0x4d, 0x00, 0x02, 0x02, 0x00, 0x61, 0x06, 0x01,
-    0x00, 0x00, 0x43, 0x00, 0x4e, 0x01, 0x00, 0x20,
-    0x1d, 0x1b, 0x1a, 0x16, 0x13, 0x09, 0x06, 0x04,
-    0x03, 0x00, 0x2c, 0x01, 0x2b, 0x07, 0x09, 0x16,
-    0x2b, 0x05, 0x22, 0x26, 0x27, 0x33, 0x1e, 0x01,
-    0x3b, 0x01, 0x32, 0x36, 0x35, 0x34, 0x2f, 0x01,
-    0x2e, 0x01, 0x35, 0x34, 0x36, 0x3b, 0x01, 0x32,
-    0x1e, 0x02, 0x17, 0x23, 0x2e, 0x01, 0x2b, 0x01,
-    0x22, 0x06, 0x15, 0x14, 0x16, 0x1f, 0x01, 0x1e,
-    0x01, 0x15, 0x14, 0x06, 0x23, 0x01, 0x1d, 0x57,
-    0x71, 0x08, 0x5f, 0x06, 0x3e, 0x2d, 0x1c, 0x36,
-    0x3c, 0x5c, 0x53, 0x51, 0x50, 0x69, 0x5e, 0x1c,
-    0x28, 0x44, 0x34, 0x21, 0x05, 0x5f, 0x06, 0x38,
-    0x29, 0x1c, 0x33, 0x39, 0x27, 0x2c, 0x53, 0x59,
-    0x51, 0x6b, 0x62, 0x0a, 0x4f, 0x42, 0x1d, 0x24,
-    0x2d, 0x26, 0x41, 0x0e, 0x0c, 0x0c, 0x4e, 0x46,
-    0x4a, 0x52, 0x14, 0x25, 0x33, 0x1f, 0x1a, 0x21,
-    0x28, 0x28, 0x20, 0x21, 0x06, 0x0c, 0x0d, 0x4e,
-    0x48, 0x4d, 0x57, 0x00, 0x00, 0x01, 0x00, 0x3c,
-    0x00, 0x00, 0x02, 0x0d, 0x02, 0xd0, 0x00, 0x13,
-    0x00, 0x29, 0x40, 0x26, 0x00, 0x01, 0x01, 0x3a,
-    0x4d, 0x06, 0x01, 0x03, 0x03, 0x00, 0x5f, 0x02,
-    0x01, 0x00, 0x00, 0x3d, 0x4d, 0x00, 0x04, 0x04,
-    0x05, 0x60, 0x00, 0x05, 0x05, 0x3b, 0x05, 0x4e,
-    0x13, 0x21, 0x23, 0x11, 0x11, 0x11, 0x10, 0x07,
-    0x09, 0x1d, 0x2b, 0x13, 0x33, 0x35, 0x33, 0x15,
-    0x33, 0x15, 0x23, 0x11, 0x14, 0x16, 0x3b, 0x01,
-    0x15, 0x23, 0x22, 0x26, 0x35, 0x11, 0x23, 0x3c,
-    0xa0, 0x5a, 0xd7, 0xd7, 0x23, 0x1e, 0x8c, 0x8c,
-    0x47, 0x54, 0xa0, 0x02, 0x26, 0xaa, 0xaa, 0x52,
-    0xfe, 0xba, 0x1c, 0x20, 0x52, 0x4e, 0x40, 0x01,
-    0x46, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x32,
-    0x00, 0x00, 0x02, 0x26, 0x02, 0x26, 0x00, 0x11,
-    0x00, 0x1b, 0x40, 0x18, 0x02, 0x01, 0x00, 0x00,
-    0x3d, 0x4d, 0x00, 0x01, 0x01, 0x03, 0x5f, 0x00,
-    0x03, 0x03, 0x3b, 0x03, 0x4e, 0x11, 0x16, 0x16,
-    0x10, 0x04, 0x09, 0x1a, 0x2b, 0x13, 0x33, 0x13,
-    0x1e, 0x01, 0x17, 0x16, 0x15, 0x33, 0x26, 0x37,
-    0x3e, 0x01, 0x37, 0x13, 0x33, 0x03, 0x23, 0x32,
-    0x5f, 0x86, 0x08, 0x08, 0x02, 0x02, 0x09, 0x01,
-    0x02, 0x02, 0x06, 0x08, 0x7f, 0x62, 0xc5, 0x66,
-    0x02, 0x26, 0xfe, 0x7b, 0x17, 0x23, 0x0c, 0x0f,
-    0x0b, 0x0b, 0x0f, 0x0c, 0x23, 0x17, 0x01, 0x85,
-    0xfd, 0xda, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1e,
-    0x00, 0x00, 0x02, 0x3a, 0x02, 0x26, 0x00, 0x2d,
-    0x00, 0x27, 0x40, 0x24, 0x00, 0x06, 0x06, 0x00,
-    0x5f, 0x04, 0x02, 0x02, 0x00, 0x00, 0x3d, 0x4d,
-    0x03, 0x01, 0x01, 0x01, 0x05, 0x5f, 0x07, 0x01,
-    0x05, 0x05, 0x3b, 0x05, 0x4e, 0x16, 0x16, 0x11,
-    0x16, 0x16, 0x16, 0x16, 0x10, 0x08, 0x09, 0x1e,
-    0x2b, 0x13, 0x33, 0x13, 0x1e, 0x01, 0x17, 0x16,
-    0x17, 0x33, 0x36, 0x37, 0x3e, 0x01, 0x37, 0x13,
-    0x33, 0x13, 0x1e, 0x01, 0x17, 0x16, 0x17, 0x33,
-    0x36, 0x37, 0x3e, 0x01, 0x37, 0x13, 0x33, 0x03,
-    0x23, 0x03, 0x2e, 0x01, 0x27, 0x26, 0x35, 0x23,
-    0x06, 0x07, 0x0e, 0x01, 0x07, 0x03, 0x23, 0x1e,
-    0x4b, 0x30, 0x02, 0x04, 0x02, 0x03, 0x02, 0x0a,
-    0x03, 0x03, 0x03, 0x06, 0x02, 0x39, 0x63, 0x38,
-    0x02, 0x06, 0x03, 0x03, 0x03, 0x0b, 0x03, 0x03,
-    0x02, 0x05, 0x02, 0x31, 0x49, 0x4e, 0x7a, 0x3a,
-    0x02, 0x03, 0x01, 0x01, 0x0a, 0x01, 0x01, 0x01,
-    0x03, 0x03, 0x3c, 0x77, 0x02, 0x26, 0xfe, 0x87,
-    0x0f, 0x2a, 0x14, 0x18, 0x18, 0x19, 0x17, 0x14,
-    0x2b, 0x0e, 0x01, 0x79, 0xfe, 0x87, 0x0f, 0x2b,
-    0x14, 0x17, 0x18, 0x18, 0x18, 0x14, 0x2a, 0x0f,
-    0x01, 0x79, 0xfd, 0xda, 0x01, 0x85, 0x11, 0x25,
-    0x10, 0x12, 0x12, 0x12, 0x12, 0x10, 0x25, 0x11,
-    0xfe, 0x7b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x30,
-    0x00, 0x00, 0x02, 0x28, 0x02, 0x26, 0x00, 0x21,
-    0x00, 0x26, 0x40, 0x23, 0x1b, 0x12, 0x0a, 0x01,
-    0x04, 0x02, 0x00, 0x01, 0x4c, 0x01, 0x01, 0x00,
-    0x00, 0x3d, 0x4d, 0x04, 0x03, 0x02, 0x02, 0x02,
-    0x3b, 0x02, 0x4e, 0x00, 0x00, 0x00, 0x21, 0x00,
-    0x21, 0x12, 0x1d, 0x12, 0x05, 0x09, 0x19, 0x2b,
-    0x33, 0x13, 0x03, 0x33, 0x17, 0x1e, 0x01, 0x17,
-    0x16, 0x17, 0x33, 0x36, 0x37, 0x3e, 0x01, 0x3f,
-    0x01, 0x33, 0x03, 0x13, 0x23, 0x27, 0x2e, 0x01,
-    0x27, 0x26, 0x27, 0x23, 0x06, 0x07, 0x0e, 0x01,
-    0x0f, 0x01, 0x30, 0xc7, 0xbb, 0x6c, 0x73, 0x05,
-    0x06, 0x02, 0x02, 0x01, 0x04, 0x01, 0x02, 0x02,
-    0x06, 0x05, 0x73, 0x6b, 0xbb, 0xc6, 0x6c, 0x7b,
-    0x04, 0x07, 0x03, 0x03, 0x02, 0x04, 0x02, 0x03,
-    0x03, 0x06, 0x05, 0x7c, 0x01, 0x1a, 0x01, 0x0c,
-    0xaf, 0x07, 0x0d, 0x05, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x0d, 0x07, 0xaf, 0xfe, 0xf5, 0xfe, 0xe5,
-    0xba, 0x07, 0x0d, 0x06, 0x07, 0x06, 0x07, 0x06,
-    0x06, 0x0e, 0x06, 0xba, 0x00, 0x01, 0x00, 0x32,
-    0xff, 0x5b, 0x02, 0x26, 0x02, 0x26, 0x00, 0x12,
-    0x00, 0x22, 0x40, 0x1f, 0x11, 0x06, 0x02, 0x01,
-    0x00, 0x01, 0x4c, 0x03, 0x02, 0x02, 0x00, 0x00,
-    0x3d, 0x4d, 0x00, 0x01, 0x01, 0x3f, 0x01, 0x4e,
-    0x00, 0x00, 0x00, 0x12, 0x00, 0x12, 0x11, 0x1d,
-    0x04, 0x09, 0x18, 0x2b, 0x1b, 0x01, 0x1e, 0x01,
-    0x17, 0x16, 0x17, 0x33, 0x36, 0x37, 0x3e, 0x01,
-    0x37, 0x13, 0x33, 0x01, 0x23, 0x37, 0x03, 0x96,
-    0x7e, 0x09, 0x0b, 0x03, 0x04, 0x01, 0x07, 0x01,
-    0x04, 0x03, 0x0a, 0x08, 0x74, 0x61, 0xfe, 0xf5,
-    0x60, 0x4c, 0xd5, 0x02, 0x26, 0xfe, 0xc4, 0x17,
-    0x28, 0x0f, 0x13, 0x0f, 0x0f, 0x12, 0x10, 0x28,
-    0x17, 0x01, 0x3c, 0xfd, 0x35, 0xcd, 0x01, 0xfe,
-    0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x02, 0x08,
-    0x02, 0x26, 0x00, 0x13, 0x00, 0x2c, 0x40, 0x29,
-    0x0c, 0x02, 0x02, 0x01, 0x03, 0x03, 0x01, 0x02,
-    0x01, 0x02, 0x4c, 0x04, 0x01, 0x03, 0x03, 0x00,
-    0x5f, 0x00, 0x00, 0x00, 0x3d, 0x4d, 0x00, 0x01,
-    0x01, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x3b, 0x02,
-    0x4e, 0x31, 0x13, 0x11, 0x35, 0x10, 0x05, 0x09,
-    0x1b, 0x2b, 0x13, 0x21, 0x15, 0x01, 0x36, 0x37,
-    0x3e, 0x01, 0x33, 0x21, 0x15, 0x21, 0x35, 0x01,
-    0x06, 0x23, 0x0e, 0x01, 0x2b, 0x01, 0x58, 0x01,
-    0xa5, 0xfe, 0xad, 0x0b, 0x0d, 0x0b, 0x1a, 0x0e,
-    0x01, 0x13, 0xfe, 0x48, 0x01, 0x55, 0x0c, 0x0e,
-    0x0b, 0x1d, 0x0e, 0xfd, 0x02, 0x26, 0x65, 0xfe,
-    0x8b, 0x01, 0x01, 0x01, 0x01, 0x50, 0x64, 0x01,
-    0x75, 0x01, 0x01, 0x01, 0x00, 0x01, 0x00, 0xa5,
-    0xff, 0x60, 0x01, 0x77, 0x00, 0x97, 0x00, 0x03,
-    0x00, 0x19, 0x40, 0x16, 0x02, 0x01, 0x01, 0x00,
-    0x01, 0x85, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x4e,
-    0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x11, 0x03,
-    0x09, 0x17, 0x2b, 0x25, 0x03, 0x23, 0x13, 0x01,
-    0x77, 0x82, 0x50, 0x50, 0x97, 0xfe, 0xc9, 0x01,
-    0x37, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x50,
-    0xff, 0xf6, 0x02, 0x08, 0x02, 0xda, 0x00, 0x0d,
-    0x00, 0x23, 0x00, 0x31, 0x00, 0x29, 0x40, 0x26,
-    0x00, 0x04, 0x00, 0x05, 0x00, 0x04, 0x05, 0x69,
-    0x00, 0x01, 0x01, 0x02, 0x61, 0x00, 0x02, 0x02,
-    0x42, 0x4d, 0x00, 0x00, 0x00, 0x03, 0x61, 0x00,
-    0x03, 0x03, 0x43, 0x03, 0x4e, 0x25, 0x27, 0x29,
-    0x27, 0x25, 0x22, 0x06, 0x09, 0x1c, 0x2b, 0x37,
-    0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x11, 0x34,
-    0x26, 0x23, 0x22, 0x06, 0x15, 0x23, 0x34, 0x3e,
-    0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x11, 0x14,
-    0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x37,
-    0x34, 0x36, 0x33, 0x32, 0x16, 0x1d, 0x01, 0x14,
-    0x06, 0x23, 0x22, 0x26, 0x35, 0xaa, 0x46, 0x3c,
-    0x3c, 0x46, 0x46, 0x3c, 0x3c, 0x46, 0x5a, 0x1f,
-    0x39, 0x51, 0x33, 0x33, 0x51, 0x39, 0x1f, 0x1f,
-    0x39, 0x52, 0x32, 0x33, 0x51, 0x39, 0x1f, 0xaa,
-    0x1b, 0x17, 0x17, 0x1b, 0x1b, 0x17, 0x17, 0x1b,
-    0xcd, 0x3e, 0x49, 0x49, 0x3e, 0x01, 0x36, 0x3e,
-    0x49, 0x49, 0x3e, 0x31, 0x50, 0x38, 0x1e, 0x1e,
-    0x38, 0x50, 0x31, 0xfe, 0xca, 0x31, 0x4f, 0x38,
-    0x1f, 0x1e, 0x38, 0x50, 0x31, 0xbe, 0x19, 0x1e,
-    0x1e, 0x19, 0x50, 0x19, 0x1e, 0x1e, 0x19, 0x00,
-    0x00, 0x01, 0x00, 0x5a, 0x00, 0x00, 0x02, 0x17,
-    0x02, 0xd0, 0x00, 0x15, 0x00, 0x22, 0x40, 0x1f,
-    0x0f, 0x0e, 0x02, 0x00, 0x01, 0x01, 0x4c, 0x00,
-    0x01, 0x01, 0x3a, 0x4d, 0x02, 0x01, 0x00, 0x00,
-    0x03, 0x60, 0x00, 0x03, 0x03, 0x3b, 0x03, 0x4e,
-    0x11, 0x11, 0x1f, 0x10, 0x04, 0x09, 0x1a, 0x2b,
-    0x37, 0x33, 0x11, 0x34, 0x36, 0x34, 0x36, 0x31,
-    0x23, 0x06, 0x07, 0x0e, 0x01, 0x0f, 0x01, 0x35,
-    0x37, 0x33, 0x11, 0x33, 0x15, 0x21, 0x5a, 0xc1,
-    0x01, 0x01, 0x02, 0x07, 0x07, 0x06, 0x0d, 0x06,
-    0x8d, 0x9b, 0x73, 0xa2, 0xfe, 0x43, 0x50, 0x01,
-    0xf9, 0x08, 0x15, 0x12, 0x0d, 0x06, 0x05, 0x05,
-    0x0a, 0x04, 0x60, 0x5b, 0x6e, 0xfd, 0x80, 0x50,
-    0x00, 0x01, 0x00, 0x41, 0x00, 0x00, 0x02, 0x08,
-    0x02, 0xda, 0x00, 0x29, 0x00, 0x30, 0x40, 0x2d,
-    0x13, 0x01, 0x00, 0x04, 0x01, 0x4c, 0x00, 0x04,
-    0x03, 0x00, 0x03, 0x04, 0x00, 0x80, 0x00, 0x03,
-    0x03, 0x05, 0x61, 0x00, 0x05, 0x05, 0x42, 0x4d,
-    0x01, 0x01, 0x00, 0x00, 0x02, 0x5f, 0x00, 0x02,
-    0x02, 0x3b, 0x02, 0x4e, 0x24, 0x12, 0x29, 0x11,
-    0x31, 0x1b, 0x06, 0x09, 0x1c, 0x2b, 0x01, 0x14,
-    0x06, 0x0f, 0x01, 0x0e, 0x01, 0x07, 0x06, 0x07,
-    0x15, 0x36, 0x33, 0x36, 0x32, 0x33, 0x21, 0x15,
-    0x21, 0x35, 0x37, 0x3e, 0x03, 0x35, 0x34, 0x26,
-    0x23, 0x22, 0x06, 0x15, 0x23, 0x3e, 0x03, 0x33,
-    0x32, 0x1e, 0x02, 0x02, 0x01, 0x59, 0x61, 0x79,
-    0x05, 0x0c, 0x06, 0x08, 0x07, 0x10, 0x0f, 0x0e,
-    0x1d, 0x0c, 0x01, 0x0a, 0xfe, 0x3e, 0xbe, 0x2b,
-    0x3d, 0x26, 0x12, 0x43, 0x39, 0x3f, 0x4b, 0x5d,
-    0x02, 0x22, 0x3d, 0x53, 0x33, 0x32, 0x50, 0x38,
-    0x1f, 0x02, 0x12, 0x51, 0x97, 0x54, 0x69, 0x04,
-    0x08, 0x04, 0x05, 0x04, 0x04, 0x01, 0x01, 0x52,
-    0x64, 0xa3, 0x25, 0x42, 0x40, 0x40, 0x23, 0x38,
-    0x41, 0x42, 0x36, 0x2d, 0x4a, 0x34, 0x1d, 0x1c,
-    0x34, 0x4a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x44,
-    0xff, 0xf6, 0x02, 0x0c, 0x02, 0xd0, 0x00, 0x30,
-    0x00, 0x39, 0x40, 0x36, 0x2b, 0x1b, 0x02, 0x00,
-    0x05, 0x01, 0x4c, 0x00, 0x02, 0x04, 0x03, 0x04,
-    0x02, 0x03, 0x80, 0x00, 0x00, 0x00, 0x04, 0x02,
-    0x00, 0x04, 0x67, 0x00, 0x05, 0x05, 0x06, 0x5f,
-    0x00, 0x06, 0x06, 0x3a, 0x4d, 0x00, 0x03, 0x03,
-    0x01, 0x61, 0x00, 0x01, 0x01, 0x43, 0x01, 0x4e,
-    0x11, 0x3b, 0x24, 0x22, 0x14, 0x28, 0x10, 0x07,
-    0x09, 0x1d, 0x2b, 0x01, 0x32, 0x1e, 0x02, 0x15,
-    0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x27,
-    0x33, 0x1e, 0x01, 0x33, 0x32, 0x36, 0x35, 0x34,
-    0x26, 0x2b, 0x01, 0x35, 0x37, 0x3e, 0x01, 0x37,
-    0x36, 0x37, 0x35, 0x06, 0x07, 0x0e, 0x01, 0x2b,
-    0x01, 0x35, 0x21, 0x15, 0x07, 0x0e, 0x01, 0x07,
-    0x06, 0x01, 0x20, 0x36, 0x57, 0x3d, 0x22, 0x20,
-    0x3c, 0x55, 0x35, 0x2f, 0x4f, 0x3b, 0x25, 0x04,
-    0x5a, 0x08, 0x4a, 0x36, 0x3f, 0x4c, 0x4e, 0x41,
-    0x54, 0x8f, 0x0a, 0x16, 0x0a, 0x0b, 0x0c, 0x0b,
-    0x0c, 0x0b, 0x19, 0x0e, 0xfb, 0x01, 0x90, 0xa9,
-    0x06, 0x0c, 0x05, 0x05, 0x01, 0xae, 0x1f, 0x39,
-    0x52, 0x32, 0x33, 0x51, 0x39, 0x1f, 0x1c, 0x33,
-    0x48, 0x2c, 0x34, 0x3f, 0x4d, 0x3f, 0x3f, 0x4d,
-    0x5f, 0x91, 0x0a, 0x12, 0x07, 0x09, 0x08, 0x02,
-    0x01, 0x01, 0x01, 0x01, 0x50, 0x64, 0xa1, 0x06,
-    0x0a, 0x04, 0x05, 0x00, 0x00, 0x01, 0x00, 0x55,
-    0x00, 0x00, 0x01, 0xf4, 0x02, 0xd0, 0x00, 0x0b,
-    0x00, 0x2a, 0x40, 0x27, 0x0b, 0x02, 0x02, 0x01,
-    0x02, 0x01, 0x4c, 0x00, 0x01, 0x00, 0x04, 0x03,
-    0x01, 0x04, 0x68, 0x00, 0x00, 0x00, 0x3a, 0x4d,
-    0x00, 0x02, 0x02, 0x03, 0x5f, 0x00, 0x03, 0x03,
-    0x3b, 0x03, 0x4e, 0x11, 0x11, 0x11, 0x12, 0x10,
-    0x05, 0x09, 0x1b, 0x2b, 0x01, 0x33, 0x01, 0x15,
-    0x33, 0x35, 0x33, 0x11, 0x23, 0x35, 0x21, 0x35,
-    0x01, 0x71, 0x62, 0xfe, 0xdc, 0xeb, 0x5a, 0x5a,
-    0xfe, 0xbb, 0x02, 0xd0, 0xfe, 0x43, 0x28, 0xaf,
-    0xfe, 0x66, 0x9b, 0x82, 0x00, 0x01, 0x00, 0x4b,
-    0xff, 0xf6, 0x02, 0x0d, 0x02, 0xd0, 0x00, 0x24,
-    0x00, 0x4d, 0x40, 0x4a, 0x1f, 0x01, 0x04, 0x00,
-    0x01, 0x4c, 0x00, 0x05, 0x04, 0x02, 0x04, 0x05,
-    0x02, 0x80, 0x00, 0x02, 0x03, 0x04, 0x02, 0x03,
-    0x7e, 0x08, 0x01, 0x00, 0x00, 0x04, 0x05, 0x00,
-    0x04, 0x69, 0x00, 0x07, 0x07, 0x06, 0x5f, 0x00,
-    0x06, 0x06, 0x3a, 0x4d, 0x00, 0x03, 0x03, 0x01,
-    0x61, 0x00, 0x01, 0x01, 0x43, 0x01, 0x4e, 0x01,
-    0x00, 0x1e, 0x1d, 0x1c, 0x1b, 0x1a, 0x19, 0x18,
-    0x16, 0x11, 0x0f, 0x0d, 0x0c, 0x0a, 0x08, 0x00,
-    0x24, 0x01, 0x24, 0x09, 0x09, 0x16, 0x2b, 0x01,
-    0x32, 0x16, 0x1d, 0x01, 0x14, 0x0e, 0x02, 0x23,
-    0x22, 0x26, 0x27, 0x33, 0x1e, 0x01, 0x33, 0x32,
-    0x36, 0x3d, 0x01, 0x34, 0x26, 0x23, 0x22, 0x07,
-    0x23, 0x13, 0x21, 0x15, 0x21, 0x07, 0x33, 0x36,
-    0x37, 0x3e, 0x01, 0x01, 0x4b, 0x5b, 0x67, 0x20,
-    0x3b, 0x54, 0x34, 0x5c, 0x76, 0x0d, 0x5f, 0x0a,
-    0x43, 0x34, 0x3d, 0x48, 0x48, 0x3e, 0x4d, 0x25,
-    0x5c, 0x05, 0x01, 0x8c, 0xfe, 0xcb, 0x03, 0x06,
-    0x09, 0x13, 0x10, 0x37, 0x01, 0xcc, 0x71, 0x61,
-    0x32, 0x30, 0x4e, 0x36, 0x1e, 0x57, 0x49, 0x24,
-    0x2c, 0x46, 0x3c, 0x32, 0x3c, 0x46, 0x37, 0x01,
-    0x8b, 0x52, 0xfe, 0x15, 0x11, 0x0e, 0x18, 0x00,
-    0x00, 0x02, 0x00, 0x46, 0xff, 0xf6, 0x02, 0x12,
-    0x02, 0xd0, 0x00, 0x1f, 0x00, 0x2f, 0x00, 0x37,
-    0x40, 0x34, 0x00, 0x02, 0x03, 0x05, 0x03, 0x02,
-    0x05, 0x80, 0x00, 0x03, 0x00, 0x05, 0x04, 0x03,
-    0x05, 0x6a, 0x00, 0x01, 0x01, 0x3a, 0x4d, 0x00,
-    0x04, 0x04, 0x00, 0x61, 0x06, 0x01, 0x00, 0x00,
-    0x43, 0x00, 0x4e, 0x01, 0x00, 0x2e, 0x2c, 0x24,
-    0x22, 0x17, 0x15, 0x11, 0x10, 0x0a, 0x09, 0x00,
-    0x1f, 0x01, 0x1f, 0x07, 0x09, 0x16, 0x2b, 0x05,
-    0x22, 0x2e, 0x02, 0x35, 0x34, 0x36, 0x3f, 0x01,
-    0x33, 0x07, 0x0e, 0x01, 0x07, 0x06, 0x07, 0x33,
-    0x36, 0x37, 0x3e, 0x01, 0x33, 0x32, 0x1e, 0x02,
-    0x15, 0x14, 0x0e, 0x02, 0x27, 0x14, 0x16, 0x33,
-    0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x23,
-    0x22, 0x06, 0x01, 0x2d, 0x33, 0x55, 0x3d, 0x22,
-    0x37, 0x32, 0x88, 0x6d, 0x98, 0x14, 0x1b, 0x08,
-    0x09, 0x05, 0x0f, 0x08, 0x0f, 0x0e, 0x2c, 0x22,
-    0x2c, 0x4a, 0x35, 0x1e, 0x22, 0x3d, 0x54, 0xbf,
-    0x4e, 0x3f, 0x1e, 0x33, 0x25, 0x15, 0x15, 0x25,
-    0x33, 0x1e, 0x3e, 0x4f, 0x0a, 0x20, 0x3b, 0x53,
-    0x33, 0x3c, 0x88, 0x52, 0xe3, 0xf0, 0x20, 0x28,
-    0x0b, 0x0c, 0x05, 0x10, 0x0c, 0x0b, 0x11, 0x20,
-    0x3a, 0x51, 0x32, 0x32, 0x53, 0x3b, 0x21, 0xe1,
-    0x42, 0x4f, 0x15, 0x26, 0x35, 0x21, 0x21, 0x35,
-    0x26, 0x15, 0x50, 0x00, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x00, 0x02, 0x0d, 0x02, 0xd0, 0x00, 0x13,
-    0x00, 0x52, 0xb5, 0x05, 0x01, 0x00, 0x03, 0x01,
-    0x4c, 0x4b, 0xb0, 0x0c, 0x50, 0x58, 0x40, 0x18,
-    0x00, 0x00, 0x03, 0x02, 0x03, 0x00, 0x72, 0x04,
-    0x01, 0x03, 0x03, 0x01, 0x5f, 0x00, 0x01, 0x01,
-    0x3a, 0x4d, 0x00, 0x02, 0x02, 0x3b, 0x02, 0x4e,
-    0x1b, 0x40, 0x19, 0x00, 0x00, 0x03, 0x02, 0x03,
-    0x00, 0x02, 0x80, 0x04, 0x01, 0x03, 0x03, 0x01,
-    0x5f, 0x00, 0x01, 0x01, 0x3a, 0x4d, 0x00, 0x02,
-    0x02, 0x3b, 0x02, 0x4e, 0x59, 0x40, 0x0c, 0x00,
-    0x00, 0x00, 0x13, 0x00, 0x0f, 0x12, 0x11, 0x11,
-    0x05, 0x09, 0x19, 0x2b, 0x13, 0x15, 0x23, 0x35,
-    0x21, 0x15, 0x03, 0x23, 0x13, 0x3e, 0x01, 0x37,
-    0x36, 0x37, 0x35, 0x06, 0x23, 0x22, 0x06, 0x23,
-    0xa5, 0x5a, 0x01, 0xc2, 0xfd, 0x65, 0xf3, 0x07,
-    0x0b, 0x04, 0x05, 0x04, 0x10, 0x0f, 0x0d, 0x1b,
-    0x0a, 0x02, 0x7e, 0x6c, 0xbe, 0x66, 0xfd, 0x96,
-    0x02, 0x3e, 0x11, 0x16, 0x07, 0x09, 0x05, 0x06,
-    0x01, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x46,
-    0xff, 0xf6, 0x02, 0x12, 0x02, 0xda, 0x00, 0x0b,
-    0x00, 0x17, 0x00, 0x3f, 0x00, 0x45, 0x40, 0x42,
-    0x35, 0x22, 0x02, 0x00, 0x03, 0x01, 0x4c, 0x00,
-    0x03, 0x06, 0x01, 0x00, 0x01, 0x03, 0x00, 0x69,
-    0x07, 0x01, 0x02, 0x02, 0x04, 0x61, 0x08, 0x01,
-    0x04, 0x04, 0x42, 0x4d, 0x00, 0x01, 0x01, 0x05,
-    0x61, 0x00, 0x05, 0x05, 0x43, 0x05, 0x4e, 0x19,
-    0x18, 0x0d, 0x0c, 0x01, 0x00, 0x2c, 0x2a, 0x18,
-    0x3f, 0x19, 0x3f, 0x13, 0x11, 0x0c, 0x17, 0x0d,
-    0x17, 0x07, 0x05, 0x00, 0x0b, 0x01, 0x0b, 0x09,
-    0x09, 0x16, 0x2b, 0x01, 0x22, 0x06, 0x15, 0x14,
-    0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x03,
-    0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36,
-    0x35, 0x34, 0x26, 0x27, 0x32, 0x1e, 0x02, 0x15,
-    0x14, 0x0e, 0x02, 0x07, 0x15, 0x1e, 0x01, 0x15,
-    0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x35,
-    0x34, 0x3e, 0x02, 0x37, 0x35, 0x2e, 0x03, 0x35,
-    0x34, 0x3e, 0x02, 0x01, 0x2c, 0x3e, 0x4b, 0x4b,
-    0x3e, 0x3e, 0x4b, 0x4b, 0x3e, 0x39, 0x41, 0x43,
-    0x37, 0x37, 0x43, 0x41, 0x39, 0x30, 0x4f, 0x39,
-    0x1f, 0x13, 0x22, 0x30, 0x1d, 0x42, 0x4f, 0x20,
-    0x3c, 0x55, 0x35, 0x35, 0x55, 0x3c, 0x20, 0x15,
-    0x26, 0x35, 0x21, 0x1d, 0x30, 0x22, 0x13, 0x1f,
-    0x39, 0x4f, 0x01, 0x56, 0x4b, 0x3e, 0x3d, 0x4f,
-    0x4f, 0x3d, 0x3e, 0x4b, 0x01, 0x39, 0x42, 0x36,
-    0x37, 0x48, 0x48, 0x37, 0x36, 0x42, 0x4b, 0x1c,
-    0x32, 0x46, 0x2b, 0x1e, 0x36, 0x2b, 0x1c, 0x05,
-    0x05, 0x0b, 0x5e, 0x45, 0x2e, 0x4e, 0x37, 0x1f,
-    0x1e, 0x36, 0x4d, 0x2e, 0x23, 0x3c, 0x2e, 0x1f,
-    0x05, 0x05, 0x05, 0x1d, 0x2a, 0x36, 0x1e, 0x2b,
-    0x46, 0x32, 0x1c, 0x00, 0x00, 0x02, 0x00, 0x46,
-    0x00, 0x00, 0x02, 0x12, 0x02, 0xda, 0x00, 0x1f,
-    0x00, 0x2f, 0x00, 0x37, 0x40, 0x34, 0x00, 0x02,
-    0x04, 0x03, 0x04, 0x02, 0x03, 0x80, 0x00, 0x04,
-    0x00, 0x03, 0x01, 0x04, 0x03, 0x69, 0x00, 0x05,
-    0x05, 0x00, 0x61, 0x06, 0x01, 0x00, 0x00, 0x42,
-    0x4d, 0x00, 0x01, 0x01, 0x3b, 0x01, 0x4e, 0x01,
-    0x00, 0x2c, 0x2a, 0x26, 0x24, 0x17, 0x15, 0x11,
-    0x10, 0x0a, 0x09, 0x00, 0x1f, 0x01, 0x1f, 0x07,
-    0x09, 0x16, 0x2b, 0x01, 0x32, 0x1e, 0x02, 0x15,
-    0x14, 0x06, 0x0f, 0x01, 0x23, 0x37, 0x3e, 0x01,
-    0x37, 0x36, 0x37, 0x23, 0x06, 0x07, 0x0e, 0x01,
-    0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x3e, 0x02,
-    0x07, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x35,
-    0x34, 0x26, 0x23, 0x22, 0x0e, 0x02, 0x01, 0x2b,
-    0x33, 0x55, 0x3d, 0x22, 0x37, 0x32, 0x88, 0x6d,
-    0x98, 0x15, 0x1a, 0x08, 0x09, 0x05, 0x0f, 0x08,
-    0x0f, 0x0e, 0x2b, 0x23, 0x2c, 0x4a, 0x35, 0x1e,
-    0x22, 0x3d, 0x54, 0x59, 0x15, 0x25, 0x33, 0x1e,
-    0x3e, 0x4f, 0x4e, 0x3f, 0x1e, 0x33, 0x25, 0x15,
-    0x02, 0xda, 0x20, 0x3b, 0x53, 0x33, 0x3c, 0x88,
-    0x52, 0xe3, 0xf0, 0x21, 0x27, 0x0b, 0x0c, 0x05,
-    0x10, 0x0c, 0x0b, 0x11, 0x20, 0x3a, 0x51, 0x32,
-    0x32, 0x53, 0x3b, 0x21, 0xe1, 0x21, 0x35, 0x26,
-    0x15, 0x50, 0x41, 0x42, 0x4f, 0x15, 0x26, 0x35,
-    0x00, 0x01, 0x00, 0x64, 0x01, 0x22, 0x01, 0xf4,
-    0x01, 0x72, 0x00, 0x03, 0x00, 0x18, 0x40, 0x15,
-    0x00, 0x00, 0x01, 0x01, 0x00, 0x57, 0x00, 0x00,
-    0x00, 0x01, 0x5f, 0x00, 0x01, 0x00, 0x01, 0x4f,
-    0x11, 0x10, 0x02, 0x09, 0x18, 0x2b, 0x13, 0x21,
-    0x15, 0x21, 0x64, 0x01, 0x90, 0xfe, 0x70, 0x01,
-    0x72, 0x50, 0x00, 0x00, 0x00, 0x01, 0x00, 0x41,
-    0x00, 0x5f, 0x02, 0x17, 0x02, 0x35, 0x00, 0x0b,
-    0x00, 0x4d, 0x4b, 0xb0, 0x21, 0x50, 0x58, 0x40,
-    0x16, 0x02, 0x01, 0x00, 0x06, 0x05, 0x02, 0x03,
-    0x04, 0x00, 0x03, 0x67, 0x00, 0x04, 0x04, 0x01,
-    0x5f, 0x00, 0x01, 0x01, 0x3d, 0x04, 0x4e, 0x1b,
-    0x40, 0x1b, 0x00, 0x01, 0x00, 0x04, 0x01, 0x57,
-    0x02, 0x01, 0x00, 0x06, 0x05, 0x02, 0x03, 0x04,
-    0x00, 0x03, 0x67, 0x00, 0x01, 0x01, 0x04, 0x5f,
-    0x00, 0x04, 0x01, 0x04, 0x4f, 0x59, 0x40, 0x0e,
-    0x00, 0x00, 0x00, 0x0b, 0x00, 0x0b, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x07, 0x09, 0x1b, 0x2b, 0x13,
-    0x35, 0x33, 0x35, 0x33, 0x15, 0x33, 0x15, 0x23,
-    0x15, 0x23, 0x35, 0x41, 0xbf, 0x58, 0xbf, 0xbf,
-    0x58, 0x01, 0x22, 0x50, 0xc3, 0xc3, 0x50, 0xc3,
-    0xc3, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x22,
-    0x00, 0x5e, 0x02, 0x35, 0x02, 0x62, 0x00, 0x35,
-    0x00, 0x2d, 0x40, 0x2a, 0x19, 0x18, 0x11, 0x08,
-    0x01, 0x05, 0x01, 0x00, 0x01, 0x4c, 0x2d, 0x2c,
-    0x27, 0x23, 0x22, 0x05, 0x01, 0x49, 0x00, 0x00,
-    0x01, 0x01, 0x00, 0x57, 0x00, 0x00, 0x00, 0x01,
-    0x61, 0x02, 0x01, 0x01, 0x00, 0x01, 0x51, 0x33,
-    0x32, 0x1f, 0x1c, 0x03, 0x09, 0x18, 0x2b, 0x13,
-    0x37, 0x17, 0x1e, 0x03, 0x17, 0x37, 0x2e, 0x01,
-    0x3d, 0x01, 0x33, 0x15, 0x14, 0x06, 0x07, 0x17,
-    0x3e, 0x03, 0x3f, 0x01, 0x17, 0x07, 0x0e, 0x01,
-    0x0f, 0x01, 0x1e, 0x01, 0x1f, 0x01, 0x07, 0x27,
-    0x2e, 0x01, 0x27, 0x23, 0x0e, 0x01, 0x0f, 0x01,
-    0x27, 0x37, 0x3e, 0x01, 0x37, 0x27, 0x2e, 0x01,
-    0x27, 0x22, 0x1e, 0x59, 0x10, 0x21, 0x21, 0x1d,
-    0x0c, 0x05, 0x08, 0x11, 0x58, 0x12, 0x08, 0x05,
-    0x0c, 0x1d, 0x21, 0x21, 0x10, 0x59, 0x1e, 0x59,
-    0x1f, 0x4c, 0x1d, 0x04, 0x17, 0x39, 0x13, 0x37,
-    0x48, 0x37, 0x13, 0x20, 0x09, 0x07, 0x0a, 0x1f,
-    0x14, 0x36, 0x48, 0x36, 0x14, 0x3a, 0x16, 0x03,
-    0x1d, 0x4d, 0x1f, 0x01, 0x83, 0x53, 0x20, 0x06,
-    0x11, 0x13, 0x14, 0x09, 0x04, 0x1c, 0x51, 0x23,
-    0x5f, 0x5f, 0x23, 0x51, 0x1c, 0x04, 0x09, 0x14,
-    0x13, 0x11, 0x06, 0x20, 0x53, 0x20, 0x0b, 0x0c,
-    0x02, 0x08, 0x12, 0x37, 0x1b, 0x4e, 0x32, 0x4e,
-    0x1b, 0x4a, 0x1b, 0x1b, 0x4a, 0x1b, 0x4e, 0x32,
-    0x4e, 0x1c, 0x37, 0x12, 0x07, 0x02, 0x0c, 0x0b,
-    0x00, 0x01, 0x00, 0x4b, 0xff, 0x92, 0x02, 0x0d,
-    0x03, 0x3e, 0x00, 0x03, 0x00, 0x11, 0x40, 0x0e,
-    0x00, 0x00, 0x01, 0x00, 0x85, 0x00, 0x01, 0x01,
-    0x76, 0x11, 0x10, 0x02, 0x09, 0x18, 0x2b, 0x01,
-    0x33, 0x01, 0x23, 0x01, 0xae, 0x5f, 0xfe, 0x9d,
-    0x5f, 0x03, 0x3e, 0xfc, 0x54, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x4b, 0xff, 0x92, 0x02, 0x0d,
-    0x03, 0x3e, 0x11, 0x43, 0x00, 0x47, 0x02, 0x58,
-    0x00, 0x00, 0xc0, 0x01, 0x40, 0x00, 0x00, 0x11,
-    0x40, 0x0e, 0x00, 0x00, 0x01, 0x00, 0x85, 0x00,
-    0x01, 0x01, 0x76, 0x11, 0x11, 0x02, 0x09, 0x23,
-    0x2b, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xda,
-    0xff, 0xf6, 0x01, 0x7e, 0x02, 0x30, 0x00, 0x0b,
-    0x00, 0x17, 0x00, 0x1f, 0x40, 0x1c, 0x00, 0x03,
-    0x03, 0x02, 0x61, 0x00, 0x02, 0x02, 0x45, 0x4d,
-    0x00, 0x00, 0x00, 0x01, 0x61, 0x00, 0x01, 0x01,
-    0x43, 0x01, 0x4e, 0x24, 0x24, 0x24, 0x22, 0x04,
-    0x09, 0x1a, 0x2b, 0x37, 0x34, 0x36, 0x33, 0x32,
-    0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x11,
-    0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06,
-    0x23, 0x22, 0x26, 0xda, 0x2e, 0x24, 0x24, 0x2e,
-    0x2e, 0x24, 0x24, 0x2e, 0x2e, 0x24, 0x24, 0x2e,
-    0x2e, 0x24, 0x24, 0x2e, 0x47, 0x24, 0x2d, 0x2d,
-    0x24, 0x24, 0x2d, 0x2d, 0x01, 0xbc, 0x24, 0x2d,
-    0x2d, 0x24, 0x24, 0x2d, 0x2d, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0xa5, 0xff, 0x60, 0x01, 0x7e,
-    0x02, 0x30, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x2a,
-    0x40, 0x27, 0x04, 0x01, 0x01, 0x03, 0x00, 0x03,
-    0x01, 0x00, 0x80, 0x00, 0x03, 0x03, 0x02, 0x61,
-    0x00, 0x02, 0x02, 0x45, 0x4d, 0x00, 0x00, 0x00,
-    0x3f, 0x00, 0x4e, 0x00, 0x00, 0x0e, 0x0c, 0x08,
-    0x06, 0x00, 0x03, 0x00, 0x03, 0x11, 0x05, 0x09,
-    0x17, 0x2b, 0x25, 0x03, 0x23, 0x13, 0x03, 0x34,
-    0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23,
-    0x22, 0x26, 0x01, 0x77, 0x82, 0x50, 0x50, 0x1b,
-    0x2d, 0x25, 0x25, 0x2d, 0x2e, 0x24, 0x25, 0x2d,
-    0x97, 0xfe, 0xc9, 0x01, 0x37, 0x01, 0x48, 0x23,
-    0x2e, 0x2e, 0x23, 0x25, 0x2c, 0x2d, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x55, 0x00, 0x41, 0x02, 0x03,
-    0x02, 0x53, 0x00, 0x11, 0x00, 0x06, 0xb3, 0x10,
-    0x01, 0x01, 0x32, 0x2b, 0x13, 0x25, 0x15, 0x05,
-    0x0e, 0x01, 0x07, 0x06, 0x07, 0x15, 0x16, 0x17,
-    0x1e, 0x01, 0x17, 0x05, 0x15, 0x25, 0x55, 0x01,
-    0xae, 0xfe, 0xca, 0x0c, 0x14, 0x07, 0x09, 0x07,
-    0x07, 0x09, 0x07, 0x14, 0x0c, 0x01, 0x36, 0xfe,
-    0x52, 0x01, 0x7c, 0xd7, 0x5a, 0x97, 0x06, 0x08,
-    0x02, 0x03, 0x01, 0x07, 0x01, 0x02, 0x02, 0x08,
-    0x06, 0x9a, 0x59, 0xd7, 0x00, 0x02, 0x00, 0x50,
-    0x00, 0xaa, 0x02, 0x08, 0x01, 0xea, 0x00, 0x03,
-    0x00, 0x07, 0x00, 0x28, 0x40, 0x25, 0x00, 0x02,
-    0x04, 0x01, 0x03, 0x00, 0x02, 0x03, 0x67, 0x00,
-    0x00, 0x01, 0x01, 0x00, 0x57, 0x00, 0x00, 0x00,
-    0x01, 0x5f, 0x00, 0x01, 0x00, 0x01, 0x4f, 0x04,
-    0x04, 0x04, 0x07, 0x04, 0x07, 0x12, 0x11, 0x10,
-    0x05, 0x09, 0x19, 0x2b, 0x37, 0x21, 0x15, 0x21,
-    0x3d, 0x01, 0x21, 0x15, 0x50, 0x01, 0xb8, 0xfe,
-    0x48, 0x01, 0xb8, 0xfa, 0x50, 0xf0, 0x50, 0x50,
-    0x00, 0x02, 0x00, 0xe1, 0xff, 0xfb, 0x01, 0x77,
-    0x02, 0xd0, 0x00, 0x05, 0x00, 0x13, 0x00, 0x26,
-    0x40, 0x23, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00,
-    0x00, 0x00, 0x3a, 0x4d, 0x04, 0x01, 0x02, 0x02,
-    0x03, 0x61, 0x00, 0x03, 0x03, 0x3b, 0x03, 0x4e,
-    0x08, 0x06, 0x0f, 0x0c, 0x06, 0x13, 0x08, 0x13,
-    0x12, 0x10, 0x05, 0x09, 0x18, 0x2b, 0x13, 0x33,
-    0x15, 0x03, 0x23, 0x03, 0x13, 0x33, 0x32, 0x16,
-    0x15, 0x14, 0x06, 0x2b, 0x01, 0x22, 0x26, 0x35,
-    0x34, 0x36, 0xf7, 0x6a, 0x15, 0x40, 0x15, 0x2b,
-    0x14, 0x1d, 0x24, 0x24, 0x1d, 0x14, 0x1d, 0x24,
-    0x24, 0x02, 0xd0, 0x78, 0xfe, 0x7f, 0x01, 0x81,
-    0xfe, 0x1b, 0x22, 0x1b, 0x1b, 0x20, 0x1f, 0x1c,
-    0x1b, 0x22, 0x00, 0x00, 0x00, 0x02, 0x00, 0x87,
-    0xff, 0xfb, 0x01, 0xea, 0x02, 0xd0, 0x00, 0x0d,
-    0x00, 0x24, 0x00, 0x6e, 0x4b, 0xb0, 0x0c, 0x50,
-    0x58, 0x40, 0x25, 0x00, 0x03, 0x02, 0x00, 0x02,
-    0x03, 0x72, 0x00, 0x04, 0x00, 0x02, 0x03, 0x04,
-    0x02, 0x69, 0x00, 0x05, 0x05, 0x06, 0x5f, 0x00,
-    0x06, 0x06, 0x3a, 0x4d, 0x07, 0x01, 0x00, 0x00,
-    0x01, 0x61, 0x00, 0x01, 0x01, 0x3b, 0x01, 0x4e,
-    0x1b, 0x40, 0x26, 0x00, 0x03, 0x02, 0x00, 0x02,
-    0x03, 0x00, 0x80, 0x00, 0x04, 0x00, 0x02, 0x03,
-    0x04, 0x02, 0x69, 0x00, 0x05, 0x05, 0x06, 0x5f,
-    0x00, 0x06, 0x06, 0x3a, 0x4d, 0x07, 0x01, 0x00,
-    0x00, 0x01, 0x61, 0x00, 0x01, 0x01, 0x3b, 0x01,
-    0x4e, 0x59, 0x40, 0x15, 0x02, 0x00, 0x21, 0x1f,
-    0x1e, 0x1c, 0x18, 0x16, 0x15, 0x14, 0x13, 0x12,
-    0x09, 0x06, 0x00, 0x0d, 0x02, 0x0d, 0x08, 0x09,
-    0x16, 0x2b, 0x37, 0x33, 0x32, 0x16, 0x15, 0x14,
-    0x06, 0x2b, 0x01, 0x22, 0x26, 0x35, 0x34, 0x36,
-    0x01, 0x14, 0x0e, 0x02, 0x07, 0x15, 0x23, 0x35,
-    0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x2b, 0x01,
-    0x35, 0x33, 0x32, 0x1e, 0x02, 0xf5, 0x14, 0x1d,
-    0x24, 0x24, 0x1d, 0x14, 0x1d, 0x24, 0x24, 0x01,
-    0x12, 0x1b, 0x32, 0x46, 0x2a, 0x5a, 0x32, 0x41,
-    0x4a, 0x4a, 0x42, 0x7d, 0x7d, 0x35, 0x55, 0x3c,
-    0x20, 0x73, 0x22, 0x1b, 0x1b, 0x20, 0x1f, 0x1c,
-    0x1b, 0x22, 0x01, 0x8b, 0x2b, 0x47, 0x35, 0x1f,
-    0x02, 0x69, 0xb4, 0x42, 0x3b, 0x3b, 0x42, 0x55,
-    0x1d, 0x37, 0x4e, 0x00, 0x00, 0x01, 0x00, 0xf6,
-    0x01, 0xae, 0x01, 0x57, 0x02, 0xda, 0x00, 0x05,
-    0x00, 0x49, 0xb6, 0x05, 0x02, 0x02, 0x01, 0x00,
-    0x01, 0x4c, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40,
-    0x0b, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00,
-    0x00, 0x3c, 0x01, 0x4e, 0x1b, 0x4b, 0xb0, 0x31,
-    0x50, 0x58, 0x40, 0x0b, 0x00, 0x01, 0x01, 0x00,
-    0x5f, 0x00, 0x00, 0x00, 0x3a, 0x01, 0x4e, 0x1b,
-    0x40, 0x10, 0x00, 0x00, 0x01, 0x01, 0x00, 0x57,
-    0x00, 0x00, 0x00, 0x01, 0x5f, 0x00, 0x01, 0x00,
-    0x01, 0x4f, 0x59, 0x59, 0xb4, 0x12, 0x10, 0x02,
-    0x09, 0x18, 0x2b, 0x13, 0x33, 0x15, 0x07, 0x23,
-    0x27, 0xf6, 0x61, 0x0b, 0x4a, 0x0c, 0x02, 0xda,
-    0x96, 0x96, 0x96, 0x00, 0x00, 0x02, 0x00, 0x96,
-    0x01, 0xae, 0x01, 0xc2, 0x02, 0xda, 0x00, 0x05,
-    0x00, 0x0b, 0x00, 0x55, 0x40, 0x09, 0x09, 0x06,
-    0x05, 0x02, 0x04, 0x01, 0x00, 0x01, 0x4c, 0x4b,
-    0xb0, 0x17, 0x50, 0x58, 0x40, 0x0d, 0x03, 0x01,
-    0x01, 0x01, 0x00, 0x5f, 0x02, 0x01, 0x00, 0x00,
-    0x3c, 0x01, 0x4e, 0x1b, 0x4b, 0xb0, 0x31, 0x50,
-    0x58, 0x40, 0x0d, 0x03, 0x01, 0x01, 0x01, 0x00,
-    0x5f, 0x02, 0x01, 0x00, 0x00, 0x3a, 0x01, 0x4e,
-    0x1b, 0x40, 0x13, 0x02, 0x01, 0x00, 0x01, 0x01,
-    0x00, 0x57, 0x02, 0x01, 0x00, 0x00, 0x01, 0x5f,
-    0x03, 0x01, 0x01, 0x00, 0x01, 0x4f, 0x59, 0x59,
-    0xb6, 0x12, 0x13, 0x12, 0x10, 0x04, 0x09, 0x1a,
-    0x2b, 0x01, 0x33, 0x15, 0x07, 0x23, 0x27, 0x23,
-    0x35, 0x33, 0x15, 0x07, 0x23, 0x01, 0x61, 0x61,
-    0x0b, 0x4a, 0x0c, 0xcb, 0x61, 0x0b, 0x4a, 0x02,
-    0xda, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x00,
-    0x00, 0x02, 0x00, 0x23, 0x00, 0x00, 0x02, 0x35,
-    0x02, 0xd0, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x4c,
-    0x40, 0x49, 0x0a, 0x08, 0x02, 0x06, 0x0e, 0x0b,
-    0x02, 0x05, 0x04, 0x06, 0x05, 0x68, 0x11, 0x0f,
-    0x0c, 0x03, 0x04, 0x10, 0x0d, 0x03, 0x03, 0x01,
-    0x00, 0x04, 0x01, 0x67, 0x09, 0x01, 0x07, 0x07,
-    0x3a, 0x4d, 0x02, 0x01, 0x00, 0x00, 0x3b, 0x00,
-    0x4e, 0x1c, 0x1c, 0x00, 0x00, 0x1c, 0x1f, 0x1c,
-    0x1f, 0x1e, 0x1d, 0x00, 0x1b, 0x00, 0x1b, 0x1a,
-    0x19, 0x18, 0x17, 0x16, 0x15, 0x14, 0x13, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x12, 0x09, 0x1f, 0x2b, 0x25, 0x07, 0x23, 0x37,
-    0x23, 0x07, 0x23, 0x37, 0x23, 0x35, 0x33, 0x37,
-    0x23, 0x35, 0x33, 0x37, 0x33, 0x07, 0x33, 0x37,
-    0x33, 0x07, 0x33, 0x15, 0x23, 0x07, 0x33, 0x15,
-    0x27, 0x37, 0x23, 0x07, 0x01, 0xa4, 0x25, 0x46,
-    0x25, 0xa0, 0x25, 0x46, 0x25, 0x55, 0x61, 0x24,
-    0x63, 0x6f, 0x25, 0x46, 0x25, 0xa0, 0x25, 0x46,
-    0x25, 0x55, 0x61, 0x24, 0x62, 0xa8, 0x24, 0xa0,
-    0x24, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0x41, 0xbe,
-    0x41, 0xc8, 0xc8, 0xc8, 0xc8, 0x41, 0xbe, 0x41,
-    0x41, 0xbe, 0xbe, 0x00, 0x00, 0x05, 0x00, 0x1e,
-    0xff, 0xfb, 0x02, 0x3a, 0x02, 0xd5, 0x00, 0x03,
-    0x00, 0x11, 0x00, 0x1f, 0x00, 0x2d, 0x00, 0x3b,
-    0x00, 0x5b, 0x40, 0x58, 0x01, 0x00, 0x02, 0x01,
-    0x00, 0x03, 0x02, 0x02, 0x05, 0x04, 0x02, 0x4c,
-    0x00, 0x01, 0x09, 0x01, 0x02, 0x07, 0x01, 0x02,
-    0x69, 0x00, 0x07, 0x0a, 0x01, 0x04, 0x05, 0x07,
-    0x04, 0x69, 0x08, 0x01, 0x00, 0x00, 0x03, 0x61,
-    0x00, 0x03, 0x03, 0x3a, 0x4d, 0x00, 0x05, 0x05,
-    0x06, 0x61, 0x0b, 0x01, 0x06, 0x06, 0x3b, 0x06,
-    0x4e, 0x2f, 0x2e, 0x21, 0x20, 0x13, 0x12, 0x05,
-    0x04, 0x36, 0x34, 0x2e, 0x3b, 0x2f, 0x3b, 0x28,
-    0x26, 0x20, 0x2d, 0x21, 0x2d, 0x1a, 0x18, 0x12,
-    0x1f, 0x13, 0x1f, 0x0c, 0x0a, 0x04, 0x11, 0x05,
-    0x11, 0x0c, 0x09, 0x16, 0x2b, 0x01, 0x15, 0x01,
-    0x35, 0x13, 0x22, 0x06, 0x1d, 0x01, 0x14, 0x16,
-    0x33, 0x32, 0x36, 0x3d, 0x01, 0x34, 0x26, 0x03,
-    0x22, 0x26, 0x3d, 0x01, 0x34, 0x36, 0x33, 0x32,
-    0x16, 0x1d, 0x01, 0x14, 0x06, 0x17, 0x22, 0x06,
-    0x1d, 0x01, 0x14, 0x16, 0x33, 0x32, 0x36, 0x3d,
-    0x01, 0x34, 0x26, 0x03, 0x22, 0x26, 0x3d, 0x01,
-    0x34, 0x36, 0x33, 0x32, 0x16, 0x1d, 0x01, 0x14,
-    0x06, 0x02, 0x3a, 0xfd, 0xe4, 0x87, 0x23, 0x23,
-    0x23, 0x23, 0x26, 0x20, 0x23, 0x23, 0x3f, 0x43,
-    0x43, 0x3f, 0x3f, 0x43, 0x43, 0xcf, 0x23, 0x23,
-    0x23, 0x23, 0x26, 0x20, 0x23, 0x23, 0x3f, 0x43,
-    0x43, 0x3f, 0x3f, 0x43, 0x43, 0x02, 0x39, 0x3f,
-    0xfe, 0x9a, 0x3f, 0x01, 0xcb, 0x2b, 0x25, 0x41,
-    0x25, 0x2b, 0x2f, 0x21, 0x41, 0x25, 0x2b, 0xfe,
-    0xe8, 0x48, 0x3f, 0x41, 0x3f, 0x48, 0x48, 0x3f,
-    0x41, 0x3f, 0x48, 0x73, 0x2b, 0x25, 0x41, 0x25,
-    0x2b, 0x2f, 0x21, 0x41, 0x25, 0x2b, 0xfe, 0xe8,
-    0x48, 0x3f, 0x41, 0x3f, 0x48, 0x48, 0x3f, 0x41,
-    0x3f, 0x48, 0x00, 0x00, 0x00, 0x01, 0x00, 0x55,
-    0xff, 0x92, 0x02, 0x03, 0x03, 0x3e, 0x00, 0x31,
-    0x00, 0x47, 0x40, 0x44, 0x14, 0x07, 0x02, 0x00,
-    0x02, 0x2c, 0x1f, 0x02, 0x04, 0x06, 0x02, 0x4c,
-    0x00, 0x03, 0x00, 0x06, 0x00, 0x03, 0x06, 0x80,
-    0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x02, 0x69,
-    0x00, 0x00, 0x07, 0x01, 0x06, 0x04, 0x00, 0x06,
-    0x67, 0x00, 0x04, 0x05, 0x05, 0x04, 0x59, 0x00,
-    0x04, 0x04, 0x05, 0x61, 0x00, 0x05, 0x04, 0x05,
-    0x51, 0x00, 0x00, 0x00, 0x31, 0x00, 0x30, 0x21,
-    0x29, 0x17, 0x21, 0x29, 0x21, 0x08, 0x09, 0x1c,
-    0x2b, 0x13, 0x35, 0x33, 0x32, 0x3e, 0x02, 0x2f,
-    0x01, 0x26, 0x3e, 0x02, 0x3b, 0x01, 0x15, 0x23,
-    0x22, 0x06, 0x1f, 0x01, 0x16, 0x0e, 0x02, 0x07,
-    0x15, 0x1e, 0x03, 0x0f, 0x01, 0x06, 0x16, 0x3b,
-    0x01, 0x15, 0x23, 0x22, 0x2e, 0x02, 0x3f, 0x01,
-    0x36, 0x2e, 0x02, 0x23, 0x55, 0x6e, 0x20, 0x29,
-    0x16, 0x07, 0x02, 0x0a, 0x02, 0x18, 0x30, 0x47,
-    0x2c, 0x2d, 0x2d, 0x30, 0x31, 0x02, 0x0a, 0x02,
-    0x0e, 0x1d, 0x2c, 0x1e, 0x1e, 0x2d, 0x1c, 0x0e,
-    0x02, 0x0a, 0x02, 0x31, 0x30, 0x2d, 0x2d, 0x2c,
-    0x47, 0x30, 0x18, 0x02, 0x0a, 0x02, 0x07, 0x16,
-    0x28, 0x21, 0x01, 0x3f, 0x50, 0x0b, 0x18, 0x26,
-    0x1b, 0xa5, 0x27, 0x3e, 0x2b, 0x16, 0x50, 0x2b,
-    0x2b, 0xa5, 0x1b, 0x31, 0x25, 0x16, 0x01, 0x05,
-    0x01, 0x17, 0x26, 0x32, 0x1b, 0xa3, 0x2b, 0x2b,
-    0x50, 0x16, 0x2b, 0x3e, 0x27, 0xa3, 0x1b, 0x26,
-    0x18, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff,
-    0xff, 0x92, 0x01, 0x59, 0x03, 0x3e, 0x00, 0x03,
-    0x00, 0x11, 0x40, 0x0e, 0x00, 0x00, 0x01, 0x00,
-    0x85, 0x00, 0x01, 0x01, 0x76, 0x11, 0x10, 0x02,
-    0x09, 0x18, 0x2b, 0x13, 0x33, 0x11, 0x23, 0xff,
-    0x5a, 0x5a, 0x03, 0x3e, 0xfc, 0x54, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0xd2, 0xff, 0x92, 0x01, 0xc7,
-    0x03, 0x3e, 0x00, 0x07, 0x00, 0x28, 0x40, 0x25,
-    0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x01, 0x67,
-    0x00, 0x02, 0x03, 0x03, 0x02, 0x57, 0x00, 0x02,
-    0x02, 0x03, 0x5f, 0x04, 0x01, 0x03, 0x02, 0x03,
-    0x4f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x11,
-    0x11, 0x11, 0x05, 0x09, 0x19, 0x2b, 0x17, 0x11,
-    0x33, 0x15, 0x23, 0x11, 0x33, 0x15, 0xd2, 0xf5,
-    0x9b, 0x9b, 0x6e, 0x03, 0xac, 0x50, 0xfc, 0xf4,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x3c,
-    0xff, 0x9c, 0x02, 0x1c, 0xff, 0xe7, 0x00, 0x03,
-    0x00, 0x20, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x15,
-    0x00, 0x00, 0x01, 0x01, 0x00, 0x57, 0x00, 0x00,
-    0x00, 0x01, 0x5f, 0x00, 0x01, 0x00, 0x01, 0x4f,
-    0x11, 0x10, 0x02, 0x09, 0x18, 0x2b, 0xb1, 0x06,
-    0x00, 0x44, 0x17, 0x21, 0x15, 0x21, 0x3c, 0x01,
-    0xe0, 0xfe, 0x20, 0x19, 0x4b, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x73, 0xff, 0x83, 0x01, 0x9f,
-    0x03, 0x4d, 0x00, 0x17, 0x00, 0x06, 0xb3, 0x17,
-    0x0c, 0x01, 0x32, 0x2b, 0x17, 0x3e, 0x03, 0x3d,
-    0x01, 0x34, 0x2e, 0x02, 0x27, 0x35, 0x1e, 0x03,
-    0x1d, 0x01, 0x14, 0x0e, 0x02, 0x07, 0x73, 0x30,
-    0x4e, 0x37, 0x1d, 0x1e, 0x36, 0x4e, 0x30, 0x45,
-    0x6f, 0x4e, 0x2a, 0x29, 0x4d, 0x6f, 0x47, 0x24,
-    0x0b, 0x36, 0x4e, 0x64, 0x3a, 0xbe, 0x3b, 0x65,
-    0x50, 0x36, 0x0b, 0x55, 0x11, 0x48, 0x65, 0x7f,
-    0x49, 0xbe, 0x4b, 0x7f, 0x64, 0x46, 0x12, 0x00,
-    0x00, 0x02, 0x00, 0x50, 0xff, 0xf6, 0x02, 0x00,
-    0x02, 0xda, 0x00, 0x1c, 0x00, 0x2a, 0x00, 0xb4,
-    0x40, 0x0b, 0x0b, 0x01, 0x05, 0x00, 0x13, 0x08,
-    0x02, 0x04, 0x05, 0x02, 0x4c, 0x4b, 0xb0, 0x17,
-    0x50, 0x58, 0x40, 0x1c, 0x00, 0x01, 0x01, 0x3c,
-    0x4d, 0x00, 0x05, 0x05, 0x00, 0x61, 0x00, 0x00,
-    0x00, 0x45, 0x4d, 0x06, 0x01, 0x04, 0x04, 0x02,
-    0x61, 0x03, 0x01, 0x02, 0x02, 0x3b, 0x02, 0x4e,
-    0x1b, 0x4b, 0xb0, 0x18, 0x50, 0x58, 0x40, 0x1c,
-    0x00, 0x01, 0x01, 0x3a, 0x4d, 0x00, 0x05, 0x05,
-    0x00, 0x61, 0x00, 0x00, 0x00, 0x45, 0x4d, 0x06,
-    0x01, 0x04, 0x04, 0x02, 0x61, 0x03, 0x01, 0x02,
-    0x02, 0x3b, 0x02, 0x4e, 0x1b, 0x4b, 0xb0, 0x31,
-    0x50, 0x58, 0x40, 0x20, 0x00, 0x01, 0x01, 0x3a,
-    0x4d, 0x00, 0x05, 0x05, 0x00, 0x61, 0x00, 0x00,
-    0x00, 0x45, 0x4d, 0x00, 0x02, 0x02, 0x3b, 0x4d,
-    0x06, 0x01, 0x04, 0x04, 0x03, 0x61, 0x00, 0x03,
-    0x03, 0x43, 0x03, 0x4e, 0x1b, 0x40, 0x20, 0x00,
-    0x05, 0x05, 0x00, 0x61, 0x00, 0x00, 0x00, 0x45,
-    0x4d, 0x00, 0x01, 0x01, 0x02, 0x5f, 0x00, 0x02,
-    0x02, 0x3b, 0x4d, 0x06, 0x01, 0x04, 0x04, 0x03,
-    0x61, 0x00, 0x03, 0x03, 0x43, 0x03, 0x4e, 0x59,
-    0x59, 0x59, 0x40, 0x0f, 0x1e, 0x1d, 0x25, 0x23,
-    0x1d, 0x2a, 0x1e, 0x2a, 0x24, 0x11, 0x19, 0x24,
-    0x07, 0x09, 0x1a, 0x2b, 0x13, 0x34, 0x3e, 0x02,
-    0x33, 0x32, 0x16, 0x17, 0x33, 0x26, 0x27, 0x2e,
-    0x01, 0x3d, 0x01, 0x33, 0x11, 0x23, 0x35, 0x23,
-    0x0e, 0x01, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x17,
-    0x32, 0x36, 0x3d, 0x01, 0x34, 0x26, 0x23, 0x22,
-    0x06, 0x1d, 0x01, 0x14, 0x16, 0x50, 0x1b, 0x30,
-    0x44, 0x2a, 0x3d, 0x50, 0x0d, 0x08, 0x01, 0x01,
-    0x02, 0x01, 0x5a, 0x55, 0x08, 0x0d, 0x50, 0x3d,
-    0x2a, 0x44, 0x30, 0x1b, 0xdb, 0x38, 0x43, 0x43,
-    0x38, 0x3d, 0x44, 0x45, 0x01, 0x59, 0x32, 0x50,
-    0x37, 0x1e, 0x37, 0x32, 0x11, 0x11, 0x0f, 0x21,
-    0x0d, 0xb4, 0xfd, 0x26, 0x5f, 0x32, 0x37, 0x1e,
-    0x37, 0x50, 0x32, 0x89, 0x4a, 0x3f, 0x8c, 0x3f,
-    0x4a, 0x48, 0x41, 0x8c, 0x3f, 0x4a, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x58, 0xff, 0x5b, 0x02, 0x08,
-    0x02, 0x30, 0x00, 0x1c, 0x00, 0x2a, 0x00, 0x5e,
-    0x40, 0x0b, 0x13, 0x08, 0x02, 0x04, 0x05, 0x11,
-    0x01, 0x03, 0x04, 0x02, 0x4c, 0x4b, 0xb0, 0x18,
-    0x50, 0x58, 0x40, 0x1b, 0x00, 0x05, 0x05, 0x00,
-    0x61, 0x01, 0x01, 0x00, 0x00, 0x45, 0x4d, 0x00,
-    0x04, 0x04, 0x03, 0x61, 0x00, 0x03, 0x03, 0x43,
-    0x4d, 0x00, 0x02, 0x02, 0x3f, 0x02, 0x4e, 0x1b,
-    0x40, 0x1f, 0x00, 0x01, 0x01, 0x3d, 0x4d, 0x00,
-    0x05, 0x05, 0x00, 0x61, 0x00, 0x00, 0x00, 0x45,
-    0x4d, 0x00, 0x04, 0x04, 0x03, 0x61, 0x00, 0x03,
-    0x03, 0x43, 0x4d, 0x00, 0x02, 0x02, 0x3f, 0x02,
-    0x4e, 0x59, 0x40, 0x09, 0x25, 0x27, 0x29, 0x11,
-    0x14, 0x24, 0x06, 0x09, 0x1c, 0x2b, 0x13, 0x34,
-    0x3e, 0x02, 0x33, 0x32, 0x16, 0x17, 0x33, 0x35,
-    0x33, 0x11, 0x23, 0x35, 0x34, 0x36, 0x37, 0x36,
-    0x37, 0x23, 0x0e, 0x01, 0x23, 0x22, 0x2e, 0x02,
-    0x35, 0x37, 0x14, 0x16, 0x33, 0x32, 0x36, 0x3d,
-    0x01, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x58,
-    0x1b, 0x30, 0x44, 0x2a, 0x3d, 0x50, 0x0d, 0x08,
-    0x55, 0x5a, 0x01, 0x02, 0x01, 0x01, 0x08, 0x0d,
-    0x50, 0x3d, 0x2a, 0x44, 0x30, 0x1b, 0x5a, 0x45,
-    0x3c, 0x38, 0x43, 0x43, 0x38, 0x3d, 0x44, 0x01,
-    0x63, 0x2e, 0x4c, 0x36, 0x1d, 0x37, 0x32, 0x5f,
-    0xfd, 0x35, 0xa5, 0x0e, 0x20, 0x0f, 0x11, 0x11,
-    0x32, 0x37, 0x1d, 0x36, 0x4c, 0x2e, 0x0a, 0x3f,
-    0x4a, 0x4a, 0x3f, 0x8c, 0x3f, 0x4a, 0x48, 0x41,
-    0x00, 0x01, 0x00, 0x5a, 0xff, 0xf6, 0x01, 0xfe,
-    0x02, 0x26, 0x00, 0x0f, 0x00, 0x1b, 0x40, 0x18,
-    0x02, 0x01, 0x00, 0x00, 0x3d, 0x4d, 0x00, 0x01,
-    0x01, 0x03, 0x61, 0x00, 0x03, 0x03, 0x43, 0x03,
-    0x4e, 0x23, 0x12, 0x22, 0x10, 0x04, 0x09, 0x1a,
-    0x2b, 0x13, 0x33, 0x11, 0x14, 0x33, 0x32, 0x35,
-    0x11, 0x33, 0x11, 0x14, 0x06, 0x23, 0x22, 0x26,
-    0x35, 0x5a, 0x5a, 0x77, 0x79, 0x5a, 0x6d, 0x66,
-    0x64, 0x6d, 0x02, 0x26, 0xfe, 0x9c, 0x7d, 0x7d,
-    0x01, 0x64, 0xfe, 0x9c, 0x62, 0x6a, 0x6b, 0x61,
-    0x00, 0x01, 0x00, 0x0f, 0x01, 0x22, 0x02, 0x49,
-    0x01, 0x72, 0x00, 0x03, 0x00, 0x18, 0x40, 0x15,
-    0x00, 0x00, 0x01, 0x01, 0x00, 0x57, 0x00, 0x00,
-    0x00, 0x01, 0x5f, 0x00, 0x01, 0x00, 0x01, 0x4f,
-    0x11, 0x10, 0x02, 0x09, 0x18, 0x2b, 0x13, 0x21,
-    0x15, 0x21, 0x0f, 0x02, 0x3a, 0xfd, 0xc6, 0x01,
-    0x72, 0x50, 0x00, 0x00, 0x00, 0x01, 0x00, 0x50,
-    0x01, 0x4a, 0x02, 0x08, 0x02, 0xd0, 0x00, 0x11,
-    0x00, 0x21, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x16,
-    0x09, 0x01, 0x01, 0x00, 0x01, 0x4c, 0x00, 0x00,
-    0x01, 0x00, 0x85, 0x02, 0x01, 0x01, 0x01, 0x76,
-    0x1d, 0x11, 0x10, 0x03, 0x09, 0x19, 0x2b, 0xb1,
-    0x06, 0x00, 0x44, 0x01, 0x33, 0x13, 0x23, 0x03,
-    0x2e, 0x01, 0x27, 0x26, 0x27, 0x23, 0x06, 0x07,
-    0x0e, 0x01, 0x07, 0x03, 0x23, 0x01, 0x03, 0x54,
-    0xb1, 0x52, 0x71, 0x05, 0x08, 0x03, 0x02, 0x02,
-    0x06, 0x02, 0x03, 0x02, 0x08, 0x06, 0x73, 0x53,
-    0x02, 0xd0, 0xfe, 0x7a, 0x01, 0x04, 0x0e, 0x18,
-    0x0a, 0x0c, 0x0a, 0x0a, 0x0c, 0x0a, 0x18, 0x0e,
-    0xfe, 0xfc, 0x00, 0x00, 0x00, 0x03, 0x00, 0x64,
-    0x00, 0x55, 0x01, 0xf4, 0x02, 0x44, 0x00, 0x03,
-    0x00, 0x11, 0x00, 0x1f, 0x00, 0x62, 0x4b, 0xb0,
-    0x18, 0x50, 0x58, 0x40, 0x1c, 0x00, 0x00, 0x00,
-    0x01, 0x04, 0x00, 0x01, 0x67, 0x07, 0x01, 0x04,
-    0x00, 0x05, 0x04, 0x05, 0x65, 0x00, 0x03, 0x03,
-    0x02, 0x61, 0x06, 0x01, 0x02, 0x02, 0x45, 0x03,
-    0x4e, 0x1b, 0x40, 0x23, 0x06, 0x01, 0x02, 0x00,
-    0x03, 0x00, 0x02, 0x03, 0x69, 0x00, 0x00, 0x00,
-    0x01, 0x04, 0x00, 0x01, 0x67, 0x07, 0x01, 0x04,
-    0x05, 0x05, 0x04, 0x59, 0x07, 0x01, 0x04, 0x04,
-    0x05, 0x61, 0x00, 0x05, 0x04, 0x05, 0x51, 0x59,
-    0x40, 0x15, 0x14, 0x12, 0x06, 0x04, 0x1b, 0x18,
-    0x12, 0x1f, 0x14, 0x1f, 0x0d, 0x0a, 0x04, 0x11,
-    0x06, 0x11, 0x11, 0x10, 0x08, 0x09, 0x18, 0x2b,
-    0x13, 0x21, 0x15, 0x21, 0x13, 0x33, 0x32, 0x16,
-    0x15, 0x14, 0x06, 0x2b, 0x01, 0x22, 0x26, 0x35,
-    0x34, 0x36, 0x13, 0x33, 0x32, 0x16, 0x15, 0x14,
-    0x06, 0x2b, 0x01, 0x22, 0x26, 0x35, 0x34, 0x36,
-    0x64, 0x01, 0x90, 0xfe, 0x70, 0xbe, 0x14, 0x1d,
-    0x24, 0x24, 0x1d, 0x14, 0x1d, 0x24, 0x24, 0x1d,
-    0x14, 0x1d, 0x24, 0x24, 0x1d, 0x14, 0x1d, 0x24,
-    0x24, 0x01, 0x72, 0x4b, 0x01, 0x1d, 0x22, 0x1b,
-    0x1b, 0x20, 0x1f, 0x1c, 0x1b, 0x22, 0xfe, 0x89,
-    0x22, 0x1b, 0x1b, 0x20, 0x1f, 0x1c, 0x1b, 0x22,
-    0x00, 0x01, 0x00, 0x66, 0x00, 0x88, 0x01, 0xeb,
-    0x02, 0x0e, 0x00, 0x0b, 0x00, 0x06, 0xb3, 0x09,
-    0x05, 0x01, 0x32, 0x2b, 0x3f, 0x01, 0x27, 0x37,
-    0x17, 0x37, 0x17, 0x07, 0x17, 0x07, 0x27, 0x07,
-    0x66, 0x8d, 0x8d, 0x33, 0x8e, 0x91, 0x33, 0x91,
-    0x8e, 0x34, 0x8d, 0x8e, 0xbc, 0x8d, 0x8e, 0x33,
-    0x8d, 0x91, 0x34, 0x91, 0x8d, 0x34, 0x8e, 0x8e,
-    0x00, 0x02, 0x00, 0x41, 0x00, 0x00, 0x02, 0x17,
-    0x02, 0x4f, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x33,
-    0x40, 0x30, 0x08, 0x05, 0x02, 0x01, 0x04, 0x01,
-    0x02, 0x03, 0x01, 0x02, 0x67, 0x00, 0x00, 0x00,
-    0x03, 0x06, 0x00, 0x03, 0x67, 0x00, 0x06, 0x06,
-    0x07, 0x5f, 0x00, 0x07, 0x07, 0x3b, 0x07, 0x4e,
-    0x00, 0x00, 0x0f, 0x0e, 0x0d, 0x0c, 0x00, 0x0b,
-    0x00, 0x0b, 0x11, 0x11, 0x11, 0x11, 0x11, 0x09,
-    0x09, 0x1b, 0x2b, 0x01, 0x35, 0x33, 0x15, 0x33,
-    0x15, 0x23, 0x15, 0x23, 0x35, 0x23, 0x35, 0x13,
-    0x21, 0x15, 0x21, 0x01, 0x00, 0x58, 0xbf, 0xbf,
-    0x58, 0xbf, 0x05, 0x01, 0xcc, 0xfe, 0x34, 0x01,
-    0x8c, 0xc3, 0xc3, 0x50, 0xc3, 0xc3, 0x50, 0xfe,
-    0xba, 0x46, 0x00, 0x00, 0xff, 0xff, 0x00, 0x64,
-    0x01, 0x22, 0x01, 0xf4, 0x01, 0x72, 0x11, 0x02,
-    0x00, 0x44, 0x00, 0x00, 0x00, 0x18, 0x40, 0x15,
-    0x00, 0x00, 0x01, 0x01, 0x00, 0x57, 0x00, 0x00,
-    0x00, 0x01, 0x5f, 0x00, 0x01, 0x00, 0x01, 0x4f,
-    0x11, 0x11, 0x02, 0x06, 0x23, 0x2b, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x2d, 0xff, 0x5b, 0x02, 0x30,
-    0x02, 0xda, 0x00, 0x31, 0x00, 0x3d, 0x00, 0x74,
-    0xb5, 0x0b, 0x01, 0x07, 0x08, 0x01, 0x4c, 0x4b,
-    0xb0, 0x18, 0x50, 0x58, 0x40, 0x26, 0x00, 0x03,
-    0x00, 0x08, 0x07, 0x03, 0x08, 0x69, 0x00, 0x07,
-    0x02, 0x01, 0x01, 0x05, 0x07, 0x01, 0x69, 0x00,
-    0x04, 0x04, 0x00, 0x61, 0x00, 0x00, 0x00, 0x42,
-    0x4d, 0x00, 0x05, 0x05, 0x06, 0x61, 0x00, 0x06,
-    0x06, 0x3f, 0x06, 0x4e, 0x1b, 0x40, 0x2d, 0x00,
-    0x01, 0x07, 0x02, 0x07, 0x01, 0x02, 0x80, 0x00,
-    0x03, 0x00, 0x08, 0x07, 0x03, 0x08, 0x69, 0x00,
-    0x07, 0x00, 0x02, 0x05, 0x07, 0x02, 0x69, 0x00,
-    0x04, 0x04, 0x00, 0x61, 0x00, 0x00, 0x00, 0x42,
-    0x4d, 0x00, 0x05, 0x05, 0x06, 0x61, 0x00, 0x06,
-    0x06, 0x3f, 0x06, 0x4e, 0x59, 0x40, 0x0c, 0x23,
-    0x27, 0x21, 0x27, 0x2a, 0x25, 0x22, 0x13, 0x24,
-    0x09, 0x09, 0x1f, 0x2b, 0x13, 0x34, 0x3e, 0x02,
-    0x33, 0x32, 0x16, 0x15, 0x11, 0x23, 0x27, 0x06,
-    0x23, 0x22, 0x26, 0x3d, 0x01, 0x34, 0x36, 0x33,
-    0x32, 0x17, 0x1e, 0x01, 0x17, 0x2e, 0x01, 0x3d,
-    0x01, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x11,
-    0x14, 0x1e, 0x02, 0x3b, 0x01, 0x15, 0x23, 0x22,
-    0x2e, 0x02, 0x35, 0x25, 0x14, 0x16, 0x33, 0x32,
-    0x3d, 0x01, 0x34, 0x23, 0x22, 0x06, 0x15, 0x2d,
-    0x25, 0x46, 0x64, 0x3f, 0x73, 0x82, 0x47, 0x01,
-    0x18, 0x5e, 0x3f, 0x43, 0x44, 0x3e, 0x51, 0x1d,
-    0x01, 0x02, 0x01, 0x01, 0x03, 0x57, 0x4e, 0x5b,
-    0x63, 0x1d, 0x34, 0x4a, 0x2d, 0x46, 0x46, 0x40,
-    0x68, 0x49, 0x27, 0x01, 0x13, 0x25, 0x22, 0x59,
-    0x59, 0x22, 0x25, 0x01, 0xb8, 0x44, 0x6b, 0x4b,
-    0x28, 0x70, 0x6c, 0xfe, 0x4d, 0x62, 0x6c, 0x5b,
-    0x54, 0x50, 0x53, 0x5c, 0x50, 0x03, 0x06, 0x04,
-    0x0d, 0x30, 0x1b, 0x14, 0x4c, 0x4a, 0x73, 0x69,
-    0xfe, 0xc5, 0x30, 0x50, 0x38, 0x1f, 0x4b, 0x29,
-    0x4b, 0x6c, 0x42, 0x73, 0x36, 0x3a, 0x7a, 0x3d,
-    0x79, 0x3a, 0x36, 0x00, 0x00, 0x02, 0x00, 0x37,
-    0xff, 0xf6, 0x02, 0x36, 0x02, 0xda, 0x00, 0x25,
-    0x00, 0x2f, 0x00, 0x7f, 0x40, 0x0e, 0x2a, 0x03,
-    0x02, 0x03, 0x01, 0x29, 0x1f, 0x1c, 0x19, 0x04,
-    0x06, 0x03, 0x02, 0x4c, 0x4b, 0xb0, 0x18, 0x50,
-    0x58, 0x40, 0x2a, 0x00, 0x01, 0x02, 0x03, 0x02,
-    0x01, 0x03, 0x80, 0x00, 0x02, 0x02, 0x00, 0x61,
-    0x00, 0x00, 0x00, 0x42, 0x4d, 0x00, 0x03, 0x03,
-    0x04, 0x61, 0x05, 0x01, 0x04, 0x04, 0x3b, 0x4d,
-    0x07, 0x01, 0x06, 0x06, 0x04, 0x61, 0x05, 0x01,
-    0x04, 0x04, 0x3b, 0x04, 0x4e, 0x1b, 0x40, 0x28,
-    0x00, 0x01, 0x02, 0x03, 0x02, 0x01, 0x03, 0x80,
-    0x00, 0x02, 0x02, 0x00, 0x61, 0x00, 0x00, 0x00,
-    0x42, 0x4d, 0x00, 0x03, 0x03, 0x04, 0x5f, 0x00,
-    0x04, 0x04, 0x3b, 0x4d, 0x07, 0x01, 0x06, 0x06,
-    0x05, 0x61, 0x00, 0x05, 0x05, 0x43, 0x05, 0x4e,
-    0x59, 0x40, 0x0f, 0x27, 0x26, 0x26, 0x2f, 0x27,
-    0x2f, 0x23, 0x12, 0x16, 0x22, 0x12, 0x2b, 0x08,
-    0x09, 0x1c, 0x2b, 0x13, 0x34, 0x36, 0x37, 0x27,
-    0x2e, 0x01, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32,
-    0x16, 0x15, 0x23, 0x34, 0x26, 0x23, 0x22, 0x06,
-    0x15, 0x14, 0x1f, 0x01, 0x37, 0x33, 0x07, 0x17,
-    0x23, 0x27, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x35,
-    0x17, 0x32, 0x36, 0x37, 0x27, 0x06, 0x1d, 0x01,
-    0x14, 0x16, 0x37, 0x37, 0x33, 0x07, 0x1e, 0x18,
-    0x19, 0x2f, 0x42, 0x2a, 0x59, 0x64, 0x5a, 0x35,
-    0x2e, 0x2a, 0x30, 0x23, 0xac, 0x47, 0x5e, 0x71,
-    0x75, 0x63, 0x40, 0x24, 0x58, 0x31, 0x52, 0x5d,
-    0xb4, 0x22, 0x3f, 0x16, 0x9b, 0x36, 0x2f, 0x01,
-    0x18, 0x35, 0x45, 0x0e, 0x0a, 0x2a, 0x41, 0x20,
-    0x24, 0x3d, 0x2c, 0x18, 0x5d, 0x4e, 0x29, 0x34,
-    0x33, 0x26, 0x2c, 0x31, 0xed, 0x7f, 0xc7, 0xa1,
-    0x57, 0x30, 0x31, 0x57, 0x4e, 0x55, 0x2d, 0x27,
-    0xd3, 0x11, 0x44, 0x7d, 0x29, 0x2c, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x96, 0xff, 0x92, 0x01, 0x8b,
-    0x03, 0x3e, 0x00, 0x07, 0x00, 0x28, 0x40, 0x25,
-    0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x01, 0x67,
-    0x00, 0x00, 0x03, 0x03, 0x00, 0x57, 0x00, 0x00,
-    0x00, 0x03, 0x5f, 0x04, 0x01, 0x03, 0x00, 0x03,
-    0x4f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x11,
-    0x11, 0x11, 0x05, 0x09, 0x19, 0x2b, 0x17, 0x35,
-    0x33, 0x11, 0x23, 0x35, 0x33, 0x11, 0x96, 0x9b,
-    0x9b, 0xf5, 0x6e, 0x50, 0x03, 0x0c, 0x50, 0xfc,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x46,
-    0xff, 0x92, 0x02, 0x12, 0x03, 0x34, 0x00, 0x34,
-    0x00, 0x3f, 0x40, 0x3c, 0x16, 0x13, 0x02, 0x04,
-    0x02, 0x31, 0x2e, 0x02, 0x05, 0x01, 0x02, 0x4c,
-    0x00, 0x03, 0x04, 0x00, 0x04, 0x03, 0x00, 0x80,
-    0x00, 0x00, 0x01, 0x04, 0x00, 0x01, 0x7e, 0x00,
-    0x02, 0x00, 0x04, 0x03, 0x02, 0x04, 0x69, 0x00,
-    0x01, 0x05, 0x05, 0x01, 0x59, 0x00, 0x01, 0x01,
-    0x05, 0x5f, 0x00, 0x05, 0x01, 0x05, 0x4f, 0x1e,
-    0x24, 0x15, 0x1d, 0x24, 0x10, 0x06, 0x09, 0x1c,
-    0x2b, 0x37, 0x33, 0x14, 0x1e, 0x02, 0x33, 0x32,
-    0x36, 0x35, 0x34, 0x26, 0x2f, 0x01, 0x26, 0x35,
-    0x34, 0x36, 0x37, 0x27, 0x35, 0x33, 0x15, 0x07,
-    0x1e, 0x01, 0x17, 0x23, 0x34, 0x2e, 0x02, 0x23,
-    0x22, 0x06, 0x15, 0x14, 0x16, 0x1f, 0x01, 0x1e,
-    0x01, 0x15, 0x14, 0x06, 0x07, 0x17, 0x15, 0x23,
-    0x35, 0x37, 0x2e, 0x01, 0x46, 0x5f, 0x15, 0x26,
-    0x32, 0x1c, 0x3f, 0x4a, 0x36, 0x33, 0x4c, 0xa7,
-    0x58, 0x4e, 0x02, 0x5a, 0x02, 0x4e, 0x62, 0x02,
-    0x5f, 0x14, 0x21, 0x2c, 0x19, 0x39, 0x41, 0x31,
-    0x37, 0x50, 0x50, 0x54, 0x63, 0x58, 0x03, 0x5a,
-    0x03, 0x54, 0x67, 0xb9, 0x1a, 0x2a, 0x1e, 0x11,
-    0x3b, 0x33, 0x2b, 0x43, 0x13, 0x1c, 0x3d, 0x8d,
-    0x4e, 0x62, 0x0c, 0x0d, 0x50, 0x50, 0x0c, 0x0b,
-    0x63, 0x4f, 0x19, 0x29, 0x1d, 0x10, 0x36, 0x2e,
-    0x2d, 0x3b, 0x14, 0x1d, 0x1d, 0x6e, 0x4b, 0x50,
-    0x64, 0x0b, 0x16, 0x50, 0x50, 0x17, 0x0b, 0x64,
-    0x00, 0x01, 0x00, 0x46, 0x01, 0x22, 0x02, 0x12,
-    0x01, 0x72, 0x00, 0x03, 0x00, 0x18, 0x40, 0x15,
-    0x00, 0x00, 0x01, 0x01, 0x00, 0x57, 0x00, 0x00,
-    0x00, 0x01, 0x5f, 0x00, 0x01, 0x00, 0x01, 0x4f,
-    0x11, 0x10, 0x02, 0x09, 0x18, 0x2b, 0x13, 0x21,
-    0x15, 0x21, 0x46, 0x01, 0xcc, 0xfe, 0x34, 0x01,
-    0x72, 0x50, 0x00, 0x00, 0xff, 0xff, 0x00, 0xd6,
-    0x01, 0x04, 0x01, 0x82, 0x01, 0xb3, 0x11, 0x03,
-    0x00, 0x29, 0x00, 0x00, 0x01, 0x0e, 0x00, 0x18,
-    0x40, 0x15, 0x00, 0x00, 0x01, 0x01, 0x00, 0x59,
-    0x00, 0x00, 0x00, 0x01, 0x61, 0x00, 0x01, 0x00,
-    0x01, 0x51, 0x24, 0x23, 0x02, 0x09, 0x23, 0x2b,
-    0x00, 0x01, 0xfb, 0xb4, 0x00, 0x23, 0x02, 0x1c,
-    0x02, 0x71, 0x00, 0x0e, 0x00, 0x2a, 0x40, 0x27,
-    0x07, 0x01, 0x03, 0x00, 0x01, 0x4c, 0x00, 0x01,
-    0x00, 0x01, 0x85, 0x00, 0x02, 0x03, 0x02, 0x86,
-    0x00, 0x00, 0x03, 0x03, 0x00, 0x57, 0x00, 0x00,
-    0x00, 0x03, 0x60, 0x00, 0x03, 0x00, 0x03, 0x50,
-    0x23, 0x12, 0x14, 0x10, 0x04, 0x09, 0x1a, 0x2b,
-    0x01, 0x21, 0x2e, 0x01, 0x2f, 0x01, 0x33, 0x13,
-    0x03, 0x23, 0x37, 0x3e, 0x01, 0x37, 0x21, 0xfb,
-    0xb4, 0x05, 0xe2, 0x04, 0x08, 0x05, 0xba, 0x6a,
-    0xe7, 0xe8, 0x69, 0xbe, 0x04, 0x06, 0x03, 0xfa,
-    0x1e, 0x01, 0x72, 0x05, 0x09, 0x06, 0xeb, 0xfe,
-    0xd9, 0xfe, 0xd9, 0xef, 0x05, 0x07, 0x04, 0x00,
-    0xff, 0xff, 0xfe, 0x3e, 0xff, 0x92, 0x01, 0xc2,
-    0x03, 0x3e, 0x10, 0x22, 0x00, 0x47, 0xb5, 0x00,
-    0x11, 0x03, 0x00, 0x47, 0xfd, 0xf3, 0x00, 0x00,
-    0x00, 0x15, 0x40, 0x12, 0x02, 0x01, 0x00, 0x01,
-    0x00, 0x85, 0x03, 0x01, 0x01, 0x01, 0x76, 0x11,
-    0x11, 0x11, 0x11, 0x04, 0x09, 0x25, 0x2b, 0x00,
-    0xff, 0xff, 0xfb, 0x9b, 0xff, 0x92, 0x01, 0xf8,
-    0x03, 0x3e, 0x10, 0x23, 0x00, 0x47, 0xfb, 0x50,
-    0x00, 0x00, 0x10, 0x23, 0x00, 0x46, 0xfd, 0x75,
-    0x00, 0x82, 0x11, 0x03, 0x00, 0x46, 0xff, 0xc3,
-    0x00, 0x82, 0x00, 0x95, 0x40, 0x1c, 0x54, 0x53,
-    0x4c, 0x43, 0x3c, 0x1e, 0x1d, 0x16, 0x0d, 0x06,
-    0x0a, 0x03, 0x02, 0x68, 0x67, 0x62, 0x5e, 0x5d,
-    0x32, 0x31, 0x2c, 0x28, 0x27, 0x0a, 0x01, 0x03,
-    0x02, 0x4c, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40,
-    0x19, 0x00, 0x00, 0x02, 0x00, 0x85, 0x00, 0x01,
-    0x03, 0x01, 0x86, 0x07, 0x06, 0x04, 0x03, 0x03,
-    0x03, 0x02, 0x5f, 0x05, 0x01, 0x02, 0x02, 0x3c,
-    0x03, 0x4e, 0x1b, 0x4b, 0xb0, 0x18, 0x50, 0x58,
-    0x40, 0x19, 0x00, 0x00, 0x02, 0x00, 0x85, 0x00,
-    0x01, 0x03, 0x01, 0x86, 0x07, 0x06, 0x04, 0x03,
-    0x03, 0x03, 0x02, 0x5f, 0x05, 0x01, 0x02, 0x02,
-    0x3a, 0x03, 0x4e, 0x1b, 0x40, 0x1f, 0x00, 0x00,
-    0x02, 0x00, 0x85, 0x00, 0x01, 0x03, 0x01, 0x86,
-    0x05, 0x01, 0x02, 0x03, 0x03, 0x02, 0x57, 0x05,
-    0x01, 0x02, 0x02, 0x03, 0x61, 0x07, 0x06, 0x04,
-    0x03, 0x03, 0x02, 0x03, 0x51, 0x59, 0x59, 0x40,
-    0x0f, 0x6e, 0x6d, 0x58, 0x57, 0x48, 0x47, 0x38,
-    0x37, 0x1f, 0x1d, 0x11, 0x11, 0x08, 0x09, 0x25,
-    0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0xfd, 0xf3,
-    0xff, 0x92, 0x02, 0x02, 0x03, 0x3e, 0x10, 0x23,
-    0x00, 0x47, 0xfd, 0xa8, 0x00, 0x00, 0x11, 0x03,
-    0x00, 0x46, 0xff, 0xcd, 0x00, 0x82, 0x00, 0x7b,
-    0x40, 0x12, 0x1e, 0x1d, 0x16, 0x0d, 0x06, 0x05,
-    0x03, 0x02, 0x32, 0x31, 0x2c, 0x28, 0x27, 0x05,
-    0x01, 0x03, 0x02, 0x4c, 0x4b, 0xb0, 0x17, 0x50,
-    0x58, 0x40, 0x16, 0x00, 0x00, 0x02, 0x00, 0x85,
-    0x00, 0x01, 0x03, 0x01, 0x86, 0x04, 0x01, 0x03,
-    0x03, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x3c, 0x03,
-    0x4e, 0x1b, 0x4b, 0xb0, 0x18, 0x50, 0x58, 0x40,
-    0x16, 0x00, 0x00, 0x02, 0x00, 0x85, 0x00, 0x01,
-    0x03, 0x01, 0x86, 0x04, 0x01, 0x03, 0x03, 0x02,
-    0x5f, 0x00, 0x02, 0x02, 0x3a, 0x03, 0x4e, 0x1b,
-    0x40, 0x1b, 0x00, 0x00, 0x02, 0x00, 0x85, 0x00,
-    0x01, 0x03, 0x01, 0x86, 0x00, 0x02, 0x03, 0x03,
-    0x02, 0x57, 0x00, 0x02, 0x02, 0x03, 0x61, 0x04,
-    0x01, 0x03, 0x02, 0x03, 0x51, 0x59, 0x59, 0x40,
-    0x09, 0x38, 0x37, 0x1f, 0x1d, 0x11, 0x11, 0x05,
-    0x09, 0x25, 0x2b, 0x00, 0xff, 0xff, 0xfd, 0xfd,
-    0xff, 0x92, 0x02, 0x0d, 0x03, 0x3e, 0x10, 0x23,
-    0x00, 0x46, 0xfd, 0xdb, 0xff, 0xb0, 0x11, 0x02,
-    0x00, 0x47, 0x00, 0x00, 0x00, 0x5e, 0x40, 0x12,
-    0x1a, 0x19, 0x12, 0x09, 0x02, 0x05, 0x01, 0x00,
-    0x2e, 0x2d, 0x28, 0x24, 0x23, 0x05, 0x04, 0x01,
-    0x02, 0x4c, 0x4b, 0xb0, 0x18, 0x50, 0x58, 0x40,
-    0x16, 0x00, 0x03, 0x00, 0x03, 0x85, 0x00, 0x04,
-    0x01, 0x04, 0x86, 0x02, 0x01, 0x01, 0x01, 0x00,
-    0x5f, 0x00, 0x00, 0x00, 0x3d, 0x01, 0x4e, 0x1b,
-    0x40, 0x1b, 0x00, 0x03, 0x00, 0x03, 0x85, 0x00,
-    0x04, 0x01, 0x04, 0x86, 0x00, 0x00, 0x01, 0x01,
-    0x00, 0x57, 0x00, 0x00, 0x00, 0x01, 0x61, 0x02,
-    0x01, 0x01, 0x00, 0x01, 0x51, 0x59, 0x40, 0x0b,
-    0x3a, 0x39, 0x38, 0x37, 0x34, 0x33, 0x1f, 0x1d,
-    0x05, 0x09, 0x23, 0x2b, 0x00, 0x04, 0xf9, 0x34,
-    0xff, 0xfb, 0x01, 0xf4, 0x02, 0xd0, 0x00, 0x03,
-    0x00, 0x12, 0x00, 0x18, 0x00, 0x26, 0x00, 0x4d,
-    0x40, 0x4a, 0x00, 0x02, 0x06, 0x00, 0x06, 0x02,
-    0x00, 0x80, 0x00, 0x05, 0x08, 0x09, 0x08, 0x05,
-    0x09, 0x80, 0x03, 0x01, 0x00, 0x04, 0x0a, 0x02,
-    0x01, 0x07, 0x00, 0x01, 0x68, 0x00, 0x07, 0x07,
-    0x06, 0x5f, 0x00, 0x06, 0x06, 0x3a, 0x4d, 0x00,
-    0x08, 0x08, 0x09, 0x61, 0x00, 0x09, 0x09, 0x3b,
-    0x09, 0x4e, 0x00, 0x00, 0x25, 0x22, 0x1e, 0x1b,
-    0x17, 0x16, 0x14, 0x13, 0x12, 0x11, 0x0d, 0x0c,
-    0x0b, 0x0a, 0x06, 0x05, 0x00, 0x03, 0x00, 0x03,
-    0x11, 0x0b, 0x09, 0x17, 0x2b, 0x01, 0x35, 0x21,
-    0x15, 0x25, 0x13, 0x33, 0x07, 0x0e, 0x01, 0x07,
-    0x21, 0x15, 0x21, 0x1e, 0x01, 0x1f, 0x01, 0x23,
-    0x01, 0x33, 0x15, 0x03, 0x23, 0x0b, 0x01, 0x34,
-    0x36, 0x3b, 0x01, 0x32, 0x16, 0x15, 0x14, 0x06,
-    0x2b, 0x01, 0x22, 0x26, 0xfc, 0x7c, 0x05, 0x78,
-    0xf7, 0x40, 0xe7, 0x6a, 0xba, 0x05, 0x07, 0x04,
-    0x01, 0x6d, 0xfe, 0x92, 0x03, 0x07, 0x04, 0xbd,
-    0x69, 0x01, 0x81, 0x6a, 0x15, 0x40, 0x15, 0x16,
-    0x24, 0x1d, 0x14, 0x1d, 0x24, 0x24, 0x1d, 0x14,
-    0x1d, 0x24, 0x01, 0x22, 0x50, 0x50, 0x28, 0x01,
-    0x27, 0xec, 0x05, 0x09, 0x05, 0x50, 0x04, 0x08,
-    0x05, 0xee, 0x02, 0xad, 0x78, 0xfe, 0x7f, 0x01,
-    0x81, 0xfd, 0xde, 0x1b, 0x22, 0x22, 0x1b, 0x1b,
-    0x20, 0x1f, 0x00, 0x00, 0x00, 0x04, 0xfe, 0x52,
-    0x00, 0x64, 0x01, 0xd6, 0x02, 0x30, 0x00, 0x03,
-    0x00, 0x07, 0x00, 0x13, 0x00, 0x1f, 0x00, 0x65,
-    0x4b, 0xb0, 0x18, 0x50, 0x58, 0x40, 0x21, 0x00,
-    0x02, 0x03, 0x03, 0x02, 0x57, 0x00, 0x01, 0x07,
-    0x00, 0x01, 0x57, 0x06, 0x01, 0x00, 0x00, 0x07,
-    0x00, 0x07, 0x65, 0x05, 0x01, 0x03, 0x03, 0x04,
-    0x61, 0x08, 0x01, 0x04, 0x04, 0x45, 0x04, 0x4e,
-    0x1b, 0x40, 0x23, 0x00, 0x02, 0x00, 0x03, 0x05,
-    0x02, 0x03, 0x67, 0x00, 0x00, 0x00, 0x01, 0x07,
-    0x00, 0x01, 0x67, 0x00, 0x06, 0x00, 0x07, 0x06,
-    0x07, 0x65, 0x00, 0x05, 0x05, 0x04, 0x61, 0x08,
-    0x01, 0x04, 0x04, 0x45, 0x05, 0x4e, 0x59, 0x40,
-    0x13, 0x09, 0x08, 0x1e, 0x1c, 0x18, 0x16, 0x0f,
-    0x0d, 0x08, 0x13, 0x09, 0x13, 0x11, 0x11, 0x11,
-    0x10, 0x09, 0x09, 0x1a, 0x2b, 0x27, 0x21, 0x15,
-    0x21, 0x11, 0x21, 0x15, 0x21, 0x25, 0x32, 0x16,
-    0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34,
-    0x36, 0x03, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15,
-    0x14, 0x06, 0x23, 0x22, 0x26, 0x50, 0x02, 0x26,
-    0xfd, 0xda, 0x02, 0x26, 0xfd, 0xda, 0xfe, 0xf2,
-    0x24, 0x2c, 0x2c, 0x24, 0x24, 0x2c, 0x2c, 0x2c,
-    0x2c, 0x24, 0x24, 0x2c, 0x2c, 0x24, 0x24, 0x2c,
-    0xfa, 0x50, 0x01, 0x40, 0x50, 0x96, 0x2c, 0x24,
-    0x25, 0x2b, 0x2b, 0x25, 0x24, 0x2c, 0xfe, 0x85,
-    0x24, 0x2b, 0x2b, 0x24, 0x25, 0x2c, 0x2c, 0x00,
-    0x00, 0x02, 0xfb, 0xb4, 0x00, 0x23, 0x02, 0x1c,
-    0x02, 0x71, 0x00, 0x0e, 0x00, 0x1e, 0x00, 0x37,
-    0x40, 0x34, 0x18, 0x11, 0x08, 0x03, 0x03, 0x00,
-    0x01, 0x4c, 0x04, 0x01, 0x01, 0x00, 0x02, 0x01,
-    0x57, 0x00, 0x00, 0x06, 0x01, 0x03, 0x02, 0x00,
-    0x03, 0x68, 0x04, 0x01, 0x01, 0x01, 0x02, 0x5f,
-    0x05, 0x01, 0x02, 0x01, 0x02, 0x4f, 0x00, 0x00,
-    0x13, 0x12, 0x10, 0x0f, 0x00, 0x0e, 0x00, 0x0d,
-    0x12, 0x14, 0x11, 0x07, 0x09, 0x19, 0x2b, 0x01,
-    0x35, 0x21, 0x2e, 0x01, 0x2f, 0x01, 0x33, 0x13,
-    0x03, 0x23, 0x37, 0x3e, 0x01, 0x37, 0x13, 0x33,
-    0x13, 0x03, 0x23, 0x37, 0x36, 0x37, 0x36, 0x37,
-    0x35, 0x26, 0x27, 0x2e, 0x01, 0x27, 0xfb, 0xb4,
-    0x04, 0xc0, 0x04, 0x08, 0x05, 0xba, 0x6a, 0xe7,
-    0xe8, 0x69, 0xbe, 0x04, 0x06, 0x03, 0x57, 0x6a,
-    0xe7, 0xe8, 0x69, 0xbe, 0x18, 0x0f, 0x08, 0x06,
-    0x06, 0x08, 0x08, 0x15, 0x0e, 0x01, 0x22, 0x50,
-    0x05, 0x09, 0x06, 0xeb, 0xfe, 0xd9, 0xfe, 0xd9,
-    0xef, 0x05, 0x07, 0x04, 0x01, 0x4f, 0xfe, 0xd9,
-    0xfe, 0xd9, 0xef, 0x1e, 0x0d, 0x07, 0x04, 0x03,
-    0x04, 0x08, 0x07, 0x17, 0x11, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xfb, 0x8c, 0x00, 0x23, 0x01, 0xf4,
-    0x02, 0x71, 0x00, 0x0d, 0x00, 0x1e, 0x00, 0x2f,
-    0x40, 0x2c, 0x1e, 0x15, 0x0d, 0x03, 0x02, 0x01,
-    0x01, 0x4c, 0x04, 0x01, 0x00, 0x01, 0x03, 0x00,
-    0x57, 0x00, 0x01, 0x00, 0x02, 0x03, 0x01, 0x02,
-    0x68, 0x04, 0x01, 0x00, 0x00, 0x03, 0x5f, 0x05,
-    0x01, 0x03, 0x00, 0x03, 0x4f, 0x1d, 0x12, 0x13,
-    0x11, 0x14, 0x10, 0x06, 0x09, 0x1c, 0x2b, 0x01,
-    0x33, 0x07, 0x0e, 0x01, 0x07, 0x21, 0x15, 0x21,
-    0x16, 0x1f, 0x01, 0x23, 0x0b, 0x01, 0x33, 0x07,
-    0x0e, 0x01, 0x07, 0x06, 0x07, 0x15, 0x16, 0x17,
-    0x1e, 0x01, 0x1f, 0x01, 0x23, 0x03, 0xfd, 0x95,
-    0x6a, 0xba, 0x05, 0x07, 0x04, 0x04, 0xbf, 0xfb,
-    0x3b, 0x08, 0x0b, 0xbd, 0x69, 0xe8, 0x3b, 0x6a,
-    0xba, 0x0e, 0x15, 0x07, 0x09, 0x06, 0x06, 0x08,
-    0x07, 0x14, 0x0d, 0xbd, 0x69, 0xe8, 0x02, 0x71,
-    0xec, 0x05, 0x09, 0x05, 0x4b, 0x08, 0x0e, 0xee,
-    0x01, 0x27, 0x01, 0x27, 0xec, 0x11, 0x17, 0x07,
-    0x08, 0x04, 0x03, 0x04, 0x07, 0x06, 0x15, 0x10,
-    0xee, 0x01, 0x27, 0x00, 0x00, 0x01, 0xfe, 0x0c,
-    0x00, 0x23, 0x02, 0x1c, 0x02, 0x71, 0x00, 0x0e,
-    0x00, 0x2a, 0x40, 0x27, 0x07, 0x01, 0x03, 0x00,
-    0x01, 0x4c, 0x00, 0x01, 0x00, 0x01, 0x85, 0x00,
-    0x02, 0x03, 0x02, 0x86, 0x00, 0x00, 0x03, 0x03,
-    0x00, 0x57, 0x00, 0x00, 0x00, 0x03, 0x60, 0x00,
-    0x03, 0x00, 0x03, 0x50, 0x23, 0x12, 0x14, 0x10,
-    0x04, 0x09, 0x1a, 0x2b, 0x01, 0x21, 0x2e, 0x01,
-    0x2f, 0x01, 0x33, 0x13, 0x03, 0x23, 0x37, 0x3e,
-    0x01, 0x37, 0x21, 0xfe, 0x0c, 0x03, 0x8a, 0x04,
-    0x08, 0x05, 0xba, 0x6a, 0xe7, 0xe8, 0x69, 0xbe,
-    0x04, 0x06, 0x03, 0xfc, 0x76, 0x01, 0x72, 0x05,
-    0x09, 0x06, 0xeb, 0xfe, 0xd9, 0xfe, 0xd9, 0xef,
-    0x05, 0x07, 0x04, 0x00, 0x00, 0x01, 0xfd, 0xe4,
-    0x00, 0x23, 0x01, 0xf4, 0x02, 0x71, 0x00, 0x0e,
-    0x00, 0x2a, 0x40, 0x27, 0x0e, 0x01, 0x02, 0x01,
-    0x01, 0x4c, 0x00, 0x00, 0x01, 0x00, 0x85, 0x00,
-    0x03, 0x02, 0x03, 0x86, 0x00, 0x01, 0x02, 0x02,
-    0x01, 0x57, 0x00, 0x01, 0x01, 0x02, 0x60, 0x00,
-    0x02, 0x01, 0x02, 0x50, 0x14, 0x11, 0x14, 0x10,
-    0x04, 0x09, 0x1a, 0x2b, 0x01, 0x33, 0x07, 0x0e,
-    0x01, 0x07, 0x21, 0x15, 0x21, 0x1e, 0x01, 0x1f,
-    0x01, 0x23, 0x03, 0xfe, 0xcb, 0x6a, 0xba, 0x05,
-    0x07, 0x04, 0x03, 0x89, 0xfc, 0x76, 0x03, 0x07,
-    0x04, 0xbd, 0x69, 0xe8, 0x02, 0x71, 0xec, 0x05,
-    0x09, 0x05, 0x50, 0x04, 0x08, 0x05, 0xee, 0x01,
-    0x27, 0x00, 0x00, 0x00, 0x00, 0x02, 0xfb, 0x8c,
-    0x00, 0x23, 0x02, 0x1c, 0x02, 0x71, 0x00, 0x0d,
-    0x00, 0x28, 0x00, 0x6e, 0x40, 0x09, 0x1b, 0x0e,
-    0x0d, 0x06, 0x04, 0x06, 0x07, 0x01, 0x4c, 0x4b,
-    0xb0, 0x0a, 0x50, 0x58, 0x40, 0x26, 0x02, 0x01,
-    0x00, 0x01, 0x01, 0x00, 0x70, 0x05, 0x01, 0x03,
-    0x04, 0x04, 0x03, 0x71, 0x00, 0x01, 0x00, 0x07,
-    0x06, 0x01, 0x07, 0x68, 0x00, 0x06, 0x04, 0x04,
-    0x06, 0x57, 0x00, 0x06, 0x06, 0x04, 0x5f, 0x00,
-    0x04, 0x06, 0x04, 0x4f, 0x1b, 0x40, 0x24, 0x02,
-    0x01, 0x00, 0x01, 0x00, 0x85, 0x05, 0x01, 0x03,
-    0x04, 0x03, 0x86, 0x00, 0x01, 0x00, 0x07, 0x06,
-    0x01, 0x07, 0x68, 0x00, 0x06, 0x04, 0x04, 0x06,
-    0x57, 0x00, 0x06, 0x06, 0x04, 0x5f, 0x00, 0x04,
-    0x06, 0x04, 0x4f, 0x59, 0x40, 0x0b, 0x1c, 0x19,
-    0x11, 0x11, 0x12, 0x11, 0x11, 0x10, 0x08, 0x09,
-    0x1e, 0x2b, 0x01, 0x33, 0x07, 0x21, 0x27, 0x33,
-    0x13, 0x03, 0x23, 0x37, 0x21, 0x17, 0x23, 0x03,
-    0x33, 0x15, 0x16, 0x17, 0x1e, 0x01, 0x1f, 0x01,
-    0x21, 0x37, 0x36, 0x37, 0x36, 0x37, 0x35, 0x26,
-    0x27, 0x2e, 0x01, 0x2f, 0x01, 0x21, 0x07, 0x0e,
-    0x01, 0x07, 0x06, 0xfc, 0x73, 0x6a, 0x6a, 0x04,
-    0xc3, 0x6b, 0x6a, 0xe7, 0xe8, 0x69, 0x6b, 0xfb,
-    0x3c, 0x6b, 0x69, 0xe8, 0x5e, 0x06, 0x08, 0x07,
-    0x14, 0x0d, 0x12, 0x05, 0x44, 0x13, 0x18, 0x0f,
-    0x08, 0x06, 0x06, 0x08, 0x08, 0x15, 0x0e, 0x10,
-    0xfa, 0xbf, 0x11, 0x0e, 0x15, 0x07, 0x09, 0x02,
-    0x71, 0x87, 0x87, 0xfe, 0xd9, 0xfe, 0xd9, 0x87,
-    0x87, 0x01, 0x27, 0x03, 0x04, 0x07, 0x06, 0x15,
-    0x10, 0x17, 0x18, 0x1e, 0x0d, 0x07, 0x04, 0x03,
-    0x04, 0x08, 0x07, 0x17, 0x11, 0x14, 0x15, 0x11,
-    0x17, 0x07, 0x08, 0x00, 0x00, 0x02, 0xfd, 0xf8,
-    0x00, 0xaa, 0x02, 0x08, 0x01, 0xea, 0x00, 0x03,
-    0x00, 0x07, 0x00, 0x30, 0x40, 0x2d, 0x00, 0x00,
-    0x04, 0x01, 0x01, 0x03, 0x00, 0x01, 0x67, 0x05,
-    0x01, 0x03, 0x02, 0x02, 0x03, 0x57, 0x05, 0x01,
-    0x03, 0x03, 0x02, 0x5f, 0x00, 0x02, 0x03, 0x02,
-    0x4f, 0x04, 0x04, 0x00, 0x00, 0x04, 0x07, 0x04,
-    0x07, 0x06, 0x05, 0x00, 0x03, 0x00, 0x03, 0x11,
-    0x06, 0x09, 0x17, 0x2b, 0x01, 0x35, 0x21, 0x1d,
-    0x02, 0x21, 0x35, 0xfd, 0xf8, 0x04, 0x10, 0xfb,
-    0xf0, 0x01, 0x9a, 0x50, 0x50, 0xa0, 0x50, 0x50,
-    0x00, 0x01, 0xfd, 0xf8, 0x00, 0x00, 0x02, 0x08,
-    0x02, 0x99, 0x00, 0x13, 0x00, 0x30, 0x40, 0x2d,
-    0x00, 0x03, 0x02, 0x03, 0x85, 0x04, 0x01, 0x02,
-    0x05, 0x01, 0x01, 0x00, 0x02, 0x01, 0x68, 0x06,
-    0x01, 0x00, 0x09, 0x01, 0x07, 0x08, 0x00, 0x07,
-    0x67, 0x00, 0x08, 0x08, 0x3b, 0x08, 0x4e, 0x13,
-    0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x10, 0x0a, 0x09, 0x1f, 0x2b, 0x25, 0x21,
-    0x37, 0x21, 0x35, 0x21, 0x37, 0x33, 0x07, 0x21,
-    0x15, 0x21, 0x07, 0x21, 0x15, 0x21, 0x07, 0x23,
-    0x37, 0x21, 0xfd, 0xf8, 0x01, 0xa6, 0x67, 0xfd,
-    0xf3, 0x02, 0x41, 0x71, 0x5a, 0x71, 0x01, 0x75,
-    0xfe, 0x57, 0x67, 0x02, 0x10, 0xfd, 0xbc, 0x6e,
-    0x5a, 0x6e, 0xfe, 0x8e, 0xfa, 0xa0, 0x50, 0xaf,
-    0xaf, 0x50, 0xa0, 0x50, 0xaa, 0xaa, 0x00, 0x00,
-    0x00, 0x02, 0xfe, 0xcf, 0xff, 0xb6, 0x01, 0x31,
-    0x02, 0xbc, 0x00, 0x11, 0x00, 0x15, 0x00, 0x08,
-    0xb5, 0x15, 0x13, 0x11, 0x02, 0x02, 0x32, 0x2b,
-    0x01, 0x35, 0x25, 0x15, 0x05, 0x0e, 0x01, 0x07,
-    0x06, 0x07, 0x15, 0x32, 0x17, 0x1e, 0x01, 0x17,
-    0x05, 0x15, 0x25, 0x35, 0x05, 0x15, 0xfe, 0xcf,
-    0x02, 0x62, 0xfe, 0x16, 0x0c, 0x14, 0x08, 0x08,
-    0x07, 0x07, 0x08, 0x08, 0x14, 0x0c, 0x01, 0xea,
-    0xfd, 0x9e, 0x02, 0x62, 0x01, 0x77, 0x64, 0xe1,
-    0x5a, 0xa8, 0x04, 0x05, 0x02, 0x01, 0x01, 0x07,
-    0x02, 0x01, 0x04, 0x05, 0xab, 0x59, 0x02, 0x58,
-    0xe2, 0x58, 0x00, 0x00, 0x00, 0x02, 0xfe, 0xcf,
-    0xff, 0xb6, 0x01, 0x31, 0x02, 0xbc, 0x00, 0x11,
-    0x00, 0x15, 0x00, 0x08, 0xb5, 0x15, 0x13, 0x0f,
-    0x00, 0x02, 0x32, 0x2b, 0x25, 0x35, 0x25, 0x3e,
-    0x01, 0x37, 0x36, 0x37, 0x35, 0x26, 0x27, 0x2e,
-    0x01, 0x27, 0x25, 0x35, 0x05, 0x15, 0x01, 0x25,
-    0x15, 0x05, 0xfe, 0xcf, 0x01, 0xea, 0x0c, 0x14,
-    0x08, 0x08, 0x07, 0x07, 0x08, 0x08, 0x14, 0x0c,
-    0xfe, 0x16, 0x02, 0x62, 0xfd, 0x9e, 0x02, 0x62,
-    0xfd, 0x9e, 0x96, 0x5a, 0xa8, 0x05, 0x04, 0x02,
-    0x01, 0x01, 0x07, 0x01, 0x01, 0x02, 0x05, 0x04,
-    0xab, 0x58, 0xe1, 0x64, 0xfe, 0x99, 0xe1, 0x5a,
-    0xe1, 0x00, 0x00, 0x00, 0x00, 0x06, 0xfb, 0xa0,
-    0x00, 0x64, 0x02, 0x08, 0x02, 0x30, 0x00, 0x03,
-    0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x1b,
-    0x00, 0x27, 0x00, 0x90, 0x40, 0x0a, 0x22, 0x1c,
-    0x02, 0x03, 0x16, 0x10, 0x02, 0x00, 0x02, 0x4b,
-    0x4b, 0xb0, 0x18, 0x50, 0x58, 0x40, 0x27, 0x06,
-    0x0d, 0x02, 0x03, 0x02, 0x02, 0x03, 0x57, 0x04,
-    0x01, 0x00, 0x09, 0x01, 0x00, 0x57, 0x08, 0x0e,
-    0x05, 0x0c, 0x04, 0x01, 0x00, 0x09, 0x01, 0x09,
-    0x65, 0x0b, 0x07, 0x02, 0x02, 0x02, 0x0a, 0x61,
-    0x00, 0x0a, 0x0a, 0x45, 0x0a, 0x4e, 0x1b, 0x40,
-    0x29, 0x06, 0x0d, 0x02, 0x03, 0x07, 0x01, 0x02,
-    0x0b, 0x03, 0x02, 0x67, 0x0e, 0x05, 0x0c, 0x03,
-    0x01, 0x04, 0x01, 0x00, 0x09, 0x01, 0x00, 0x67,
-    0x00, 0x08, 0x00, 0x09, 0x08, 0x09, 0x65, 0x00,
-    0x0b, 0x0b, 0x0a, 0x61, 0x00, 0x0a, 0x0a, 0x45,
-    0x0b, 0x4e, 0x59, 0x40, 0x26, 0x08, 0x08, 0x04,
-    0x04, 0x00, 0x00, 0x26, 0x24, 0x20, 0x1e, 0x1a,
-    0x18, 0x14, 0x12, 0x0f, 0x0e, 0x0d, 0x0c, 0x08,
-    0x0b, 0x08, 0x0b, 0x0a, 0x09, 0x04, 0x07, 0x04,
-    0x07, 0x06, 0x05, 0x00, 0x03, 0x00, 0x03, 0x11,
-    0x0f, 0x09, 0x17, 0x2b, 0x25, 0x15, 0x21, 0x35,
-    0x25, 0x15, 0x21, 0x35, 0x05, 0x15, 0x21, 0x3d,
-    0x01, 0x21, 0x15, 0x21, 0x05, 0x34, 0x36, 0x33,
-    0x32, 0x16, 0x15, 0x0e, 0x01, 0x23, 0x22, 0x26,
-    0x03, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x17, 0x14,
-    0x06, 0x23, 0x22, 0x26, 0xfd, 0xc1, 0xfd, 0xdf,
-    0x02, 0x21, 0xfd, 0xdf, 0x06, 0x68, 0xfd, 0xdf,
-    0x02, 0x21, 0xfd, 0xdf, 0xfe, 0x9d, 0x25, 0x2b,
-    0x2a, 0x26, 0x04, 0x2a, 0x22, 0x22, 0x2a, 0x04,
-    0x04, 0x2a, 0x22, 0x22, 0x2a, 0x04, 0x25, 0x2b,
-    0x2a, 0x26, 0xfa, 0x50, 0x50, 0xf0, 0x50, 0x50,
-    0xf0, 0x50, 0x50, 0xf0, 0x50, 0xf0, 0x28, 0x32,
-    0x31, 0x29, 0x20, 0x26, 0x26, 0x01, 0x60, 0x20,
-    0x26, 0x26, 0x20, 0x28, 0x32, 0x31, 0x00, 0x00,
-    0x00, 0x01, 0xfb, 0xa0, 0xff, 0xe7, 0x02, 0x08,
-    0x02, 0xb2, 0x00, 0x1b, 0x00, 0x7b, 0x4b, 0xb0,
-    0x0a, 0x50, 0x58, 0x40, 0x2c, 0x00, 0x03, 0x02,
-    0x03, 0x85, 0x00, 0x0a, 0x09, 0x09, 0x0a, 0x71,
-    0x06, 0x01, 0x00, 0x0d, 0x01, 0x07, 0x08, 0x00,
-    0x07, 0x67, 0x0c, 0x01, 0x08, 0x0b, 0x01, 0x09,
-    0x0a, 0x08, 0x09, 0x67, 0x05, 0x01, 0x01, 0x01,
-    0x02, 0x5f, 0x04, 0x01, 0x02, 0x02, 0x3d, 0x01,
-    0x4e, 0x1b, 0x40, 0x2b, 0x00, 0x03, 0x02, 0x03,
-    0x85, 0x00, 0x0a, 0x09, 0x0a, 0x86, 0x06, 0x01,
-    0x00, 0x0d, 0x01, 0x07, 0x08, 0x00, 0x07, 0x67,
-    0x0c, 0x01, 0x08, 0x0b, 0x01, 0x09, 0x0a, 0x08,
-    0x09, 0x67, 0x05, 0x01, 0x01, 0x01, 0x02, 0x5f,
-    0x04, 0x01, 0x02, 0x02, 0x3d, 0x01, 0x4e, 0x59,
-    0x40, 0x16, 0x1b, 0x1a, 0x19, 0x18, 0x17, 0x16,
-    0x15, 0x14, 0x13, 0x12, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x10, 0x0e, 0x09, 0x1f,
-    0x2b, 0x01, 0x21, 0x37, 0x21, 0x35, 0x21, 0x37,
-    0x33, 0x07, 0x21, 0x15, 0x21, 0x07, 0x21, 0x15,
-    0x21, 0x07, 0x21, 0x15, 0x21, 0x07, 0x23, 0x37,
-    0x21, 0x35, 0x21, 0x37, 0x21, 0xfb, 0xa0, 0x03,
-    0x1f, 0x4a, 0xfc, 0x97, 0x03, 0x96, 0x5b, 0x54,
-    0x5a, 0x02, 0x7d, 0xfd, 0x55, 0x4a, 0x02, 0xf5,
-    0xfc, 0xde, 0x4b, 0x03, 0x6d, 0xfc, 0x66, 0x57,
-    0x55, 0x57, 0xfd, 0x87, 0x02, 0xa7, 0x4a, 0xfd,
-    0x0f, 0x01, 0x6d, 0x73, 0x46, 0x8c, 0x8c, 0x46,
-    0x73, 0x46, 0x73, 0x46, 0x87, 0x87, 0x46, 0x73,
-    0x00, 0x01, 0x00, 0x5a, 0x00, 0x00, 0x02, 0x21,
-    0x02, 0x26, 0x00, 0x09, 0x00, 0x21, 0x40, 0x1e,
-    0x00, 0x01, 0x01, 0x02, 0x5f, 0x00, 0x02, 0x02,
-    0x3d, 0x4d, 0x03, 0x01, 0x00, 0x00, 0x04, 0x5f,
-    0x00, 0x04, 0x04, 0x3b, 0x04, 0x4e, 0x11, 0x11,
-    0x11, 0x11, 0x10, 0x05, 0x09, 0x1b, 0x2b, 0x37,
-    0x33, 0x11, 0x23, 0x35, 0x21, 0x11, 0x33, 0x15,
-    0x21, 0x5a, 0xcd, 0xb4, 0x01, 0x0e, 0xa0, 0xfe,
-    0x39, 0x52, 0x01, 0x82, 0x52, 0xfe, 0x2c, 0x52,
-    0x00, 0x04, 0xfe, 0x11, 0xff, 0xf6, 0x02, 0x0e,
-    0x02, 0xda, 0x00, 0x28, 0x00, 0x4a, 0x00, 0x54,
-    0x00, 0x5e, 0x00, 0x97, 0x40, 0x12, 0x5d, 0x52,
-    0x2c, 0x03, 0x04, 0x03, 0x01, 0x5c, 0x51, 0x44,
-    0x20, 0x1d, 0x1a, 0x06, 0x0b, 0x03, 0x02, 0x4c,
-    0x4b, 0xb0, 0x18, 0x50, 0x58, 0x40, 0x31, 0x07,
-    0x01, 0x01, 0x02, 0x03, 0x02, 0x01, 0x03, 0x80,
-    0x08, 0x01, 0x02, 0x02, 0x00, 0x61, 0x06, 0x01,
-    0x00, 0x00, 0x42, 0x4d, 0x00, 0x03, 0x03, 0x04,
-    0x61, 0x0a, 0x09, 0x05, 0x03, 0x04, 0x04, 0x3b,
-    0x4d, 0x0c, 0x01, 0x0b, 0x0b, 0x04, 0x61, 0x0a,
-    0x09, 0x05, 0x03, 0x04, 0x04, 0x3b, 0x04, 0x4e,
-    0x1b, 0x40, 0x2d, 0x07, 0x01, 0x01, 0x02, 0x03,
-    0x02, 0x01, 0x03, 0x80, 0x08, 0x01, 0x02, 0x02,
-    0x00, 0x61, 0x06, 0x01, 0x00, 0x00, 0x42, 0x4d,
-    0x00, 0x03, 0x03, 0x04, 0x5f, 0x09, 0x01, 0x04,
-    0x04, 0x3b, 0x4d, 0x0c, 0x01, 0x0b, 0x0b, 0x05,
-    0x61, 0x0a, 0x01, 0x05, 0x05, 0x43, 0x05, 0x4e,
-    0x59, 0x40, 0x17, 0x5a, 0x58, 0x4f, 0x4d, 0x48,
-    0x46, 0x43, 0x42, 0x3d, 0x3b, 0x39, 0x38, 0x36,
-    0x34, 0x23, 0x12, 0x17, 0x22, 0x12, 0x2b, 0x0d,
-    0x09, 0x1c, 0x2b, 0x13, 0x34, 0x36, 0x37, 0x27,
-    0x2e, 0x01, 0x27, 0x34, 0x3e, 0x02, 0x33, 0x32,
-    0x16, 0x15, 0x23, 0x34, 0x26, 0x23, 0x22, 0x06,
-    0x15, 0x14, 0x16, 0x1f, 0x01, 0x37, 0x33, 0x07,
-    0x17, 0x23, 0x27, 0x0e, 0x01, 0x23, 0x22, 0x2e,
-    0x02, 0x35, 0x25, 0x34, 0x36, 0x37, 0x27, 0x2e,
-    0x01, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16,
-    0x15, 0x23, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15,
-    0x14, 0x17, 0x01, 0x23, 0x27, 0x0e, 0x01, 0x23,
-    0x22, 0x26, 0x35, 0x21, 0x14, 0x16, 0x33, 0x32,
-    0x36, 0x37, 0x27, 0x06, 0x15, 0x21, 0x15, 0x14,
-    0x16, 0x33, 0x32, 0x36, 0x37, 0x27, 0x06, 0x0f,
-    0x37, 0x33, 0x07, 0x1d, 0x18, 0x01, 0x1a, 0x30,
-    0x42, 0x28, 0x59, 0x64, 0x5a, 0x35, 0x2e, 0x2a,
-    0x30, 0x15, 0x0e, 0xac, 0x47, 0x5e, 0x71, 0x75,
-    0x63, 0x40, 0x20, 0x57, 0x36, 0x26, 0x40, 0x2f,
-    0x1a, 0xfe, 0x02, 0x37, 0x33, 0x07, 0x1e, 0x18,
-    0x19, 0x2f, 0x42, 0x2a, 0x59, 0x64, 0x5a, 0x35,
-    0x2e, 0x2a, 0x30, 0x23, 0x01, 0x55, 0x63, 0x40,
-    0x24, 0x58, 0x31, 0x52, 0x5d, 0x02, 0x58, 0x2f,
-    0x2b, 0x22, 0x3f, 0x16, 0x9b, 0x36, 0xfe, 0x02,
-    0x2f, 0x2b, 0x22, 0x3f, 0x16, 0x9b, 0x36, 0x01,
-    0x18, 0x34, 0x48, 0x0c, 0x0a, 0x27, 0x3f, 0x1f,
-    0x29, 0x40, 0x2b, 0x17, 0x5d, 0x4e, 0x29, 0x34,
-    0x33, 0x26, 0x1a, 0x2f, 0x14, 0xed, 0x7f, 0xc7,
-    0xa1, 0x57, 0x2a, 0x37, 0x15, 0x29, 0x3e, 0x29,
-    0x7d, 0x35, 0x45, 0x0e, 0x0a, 0x2a, 0x41, 0x20,
-    0x24, 0x3d, 0x2c, 0x18, 0x5d, 0x4e, 0x29, 0x34,
-    0x33, 0x26, 0x2c, 0x31, 0xfe, 0x2a, 0x57, 0x30,
-    0x31, 0x57, 0x4e, 0x29, 0x2c, 0x2d, 0x27, 0xd3,
-    0x11, 0x44, 0x7d, 0x29, 0x2c, 0x2d, 0x27, 0xd3,
-    0x11, 0x00, 0x00, 0x00, 0xff, 0xff, 0xfe, 0xe3,
-    0xff, 0x92, 0x01, 0x1d, 0x03, 0x3e, 0x10, 0x22,
-    0x00, 0x54, 0xc4, 0x00, 0x11, 0x03, 0x00, 0x54,
-    0xfd, 0xe4, 0x00, 0x00, 0x00, 0x15, 0x40, 0x12,
-    0x02, 0x01, 0x00, 0x01, 0x00, 0x85, 0x03, 0x01,
-    0x01, 0x01, 0x76, 0x11, 0x11, 0x11, 0x11, 0x04,
-    0x09, 0x25, 0x2b, 0x00, 0xff, 0xff, 0xfc, 0x8b,
-    0xff, 0xf6, 0x01, 0x1d, 0x00, 0xa5, 0x10, 0x23,
-    0x00, 0x29, 0xfb, 0xb5, 0x00, 0x00, 0x10, 0x23,
-    0x00, 0x29, 0xfd, 0xa8, 0x00, 0x00, 0x11, 0x02,
-    0x00, 0x29, 0x9b, 0x00, 0x00, 0x1b, 0x40, 0x18,
-    0x04, 0x02, 0x02, 0x00, 0x00, 0x01, 0x61, 0x05,
-    0x03, 0x02, 0x01, 0x01, 0x43, 0x01, 0x4e, 0x24,
-    0x24, 0x24, 0x24, 0x24, 0x23, 0x06, 0x09, 0x27,
-    0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0xfe, 0xcf,
-    0xff, 0xf6, 0x01, 0x31, 0x00, 0xa5, 0x10, 0x23,
-    0x00, 0x29, 0xfd, 0xf9, 0x00, 0x00, 0x11, 0x02,
-    0x00, 0x29, 0xaf, 0x00, 0x00, 0x17, 0x40, 0x14,
-    0x02, 0x01, 0x00, 0x00, 0x01, 0x61, 0x03, 0x01,
-    0x01, 0x01, 0x43, 0x01, 0x4e, 0x24, 0x24, 0x24,
-    0x23, 0x04, 0x09, 0x25, 0x2b, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x19, 0xff, 0xf6, 0x02, 0x18,
-    0x02, 0xda, 0x00, 0x2f, 0x00, 0x57, 0x40, 0x54,
-    0x00, 0x0b, 0x0c, 0x09, 0x0c, 0x0b, 0x09, 0x80,
-    0x00, 0x04, 0x02, 0x03, 0x02, 0x04, 0x03, 0x80,
-    0x0e, 0x0d, 0x02, 0x09, 0x08, 0x01, 0x00, 0x01,
-    0x09, 0x00, 0x67, 0x07, 0x01, 0x01, 0x06, 0x01,
-    0x02, 0x04, 0x01, 0x02, 0x67, 0x00, 0x0c, 0x0c,
-    0x0a, 0x61, 0x00, 0x0a, 0x0a, 0x42, 0x4d, 0x00,
-    0x03, 0x03, 0x05, 0x61, 0x00, 0x05, 0x05, 0x43,
-    0x05, 0x4e, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x2f,
-    0x2c, 0x2a, 0x28, 0x27, 0x25, 0x23, 0x1e, 0x1d,
-    0x11, 0x11, 0x15, 0x22, 0x12, 0x23, 0x11, 0x11,
-    0x11, 0x0f, 0x09, 0x1f, 0x2b, 0x01, 0x15, 0x23,
-    0x15, 0x33, 0x15, 0x23, 0x15, 0x14, 0x16, 0x33,
-    0x32, 0x36, 0x37, 0x33, 0x0e, 0x01, 0x23, 0x22,
-    0x2e, 0x02, 0x3d, 0x01, 0x23, 0x35, 0x33, 0x35,
-    0x23, 0x35, 0x33, 0x35, 0x34, 0x3e, 0x02, 0x33,
-    0x32, 0x16, 0x17, 0x23, 0x2e, 0x01, 0x23, 0x22,
-    0x06, 0x1d, 0x01, 0x01, 0x5a, 0xa0, 0xa0, 0xa0,
-    0x45, 0x3d, 0x37, 0x45, 0x06, 0x5a, 0x0b, 0x73,
-    0x5e, 0x33, 0x51, 0x39, 0x1f, 0x47, 0x47, 0x47,
-    0x47, 0x1f, 0x39, 0x51, 0x33, 0x5e, 0x73, 0x0b,
-    0x5a, 0x06, 0x45, 0x37, 0x3c, 0x46, 0x01, 0xbd,
-    0x3c, 0x46, 0x3c, 0x32, 0x3f, 0x48, 0x3d, 0x36,
-    0x5c, 0x67, 0x1e, 0x38, 0x50, 0x31, 0x32, 0x3c,
-    0x46, 0x3c, 0x46, 0x31, 0x50, 0x38, 0x1e, 0x67,
-    0x5c, 0x36, 0x3d, 0x48, 0x3f, 0x46, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0xaf, 0x00, 0xe6, 0x01, 0xa9,
-    0x01, 0xe0, 0x00, 0x13, 0x00, 0x18, 0x40, 0x15,
-    0x00, 0x00, 0x01, 0x01, 0x00, 0x59, 0x00, 0x00,
-    0x00, 0x01, 0x61, 0x00, 0x01, 0x00, 0x01, 0x51,
-    0x28, 0x24, 0x02, 0x09, 0x18, 0x2b, 0x13, 0x34,
-    0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14,
-    0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0xaf, 0x13,
-    0x22, 0x2e, 0x1a, 0x1a, 0x2e, 0x22, 0x13, 0x13,
-    0x22, 0x2e, 0x1a, 0x1a, 0x2e, 0x22, 0x13, 0x01,
-    0x63, 0x1a, 0x2e, 0x22, 0x13, 0x13, 0x22, 0x2e,
-    0x1a, 0x1a, 0x2e, 0x22, 0x13, 0x13, 0x22, 0x2e,
-    0x00, 0x02, 0x00, 0xff, 0xff, 0x92, 0x01, 0x59,
-    0x03, 0x3e, 0x00, 0x03, 0x00, 0x07, 0x00, 0x28,
-    0x40, 0x25, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00,
-    0x01, 0x67, 0x00, 0x02, 0x03, 0x03, 0x02, 0x57,
-    0x00, 0x02, 0x02, 0x03, 0x5f, 0x04, 0x01, 0x03,
-    0x02, 0x03, 0x4f, 0x04, 0x04, 0x04, 0x07, 0x04,
-    0x07, 0x12, 0x11, 0x10, 0x05, 0x09, 0x19, 0x2b,
-    0x13, 0x33, 0x11, 0x23, 0x19, 0x01, 0x33, 0x11,
-    0xff, 0x5a, 0x5a, 0x5a, 0x03, 0x3e, 0xfe, 0x84,
-    0xfd, 0xd0, 0x01, 0x7c, 0xfe, 0x84, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x1e, 0x00, 0x28, 0x02, 0x3a,
-    0x02, 0x08, 0x00, 0x10, 0x00, 0x21, 0x00, 0x2e,
-    0x40, 0x2b, 0x1f, 0x17, 0x0f, 0x07, 0x04, 0x01,
-    0x00, 0x01, 0x4c, 0x02, 0x01, 0x00, 0x01, 0x01,
-    0x00, 0x57, 0x02, 0x01, 0x00, 0x00, 0x01, 0x5f,
-    0x03, 0x04, 0x02, 0x01, 0x00, 0x01, 0x4f, 0x00,
-    0x00, 0x21, 0x20, 0x1e, 0x1d, 0x00, 0x10, 0x00,
-    0x10, 0x1d, 0x05, 0x09, 0x17, 0x2b, 0x25, 0x37,
-    0x3e, 0x01, 0x37, 0x36, 0x37, 0x35, 0x26, 0x27,
-    0x2e, 0x01, 0x2f, 0x01, 0x33, 0x17, 0x07, 0x27,
-    0x3e, 0x01, 0x37, 0x36, 0x37, 0x35, 0x26, 0x27,
-    0x2e, 0x01, 0x2f, 0x01, 0x33, 0x17, 0x07, 0x23,
-    0x01, 0x07, 0xb1, 0x08, 0x0c, 0x05, 0x06, 0x04,
-    0x04, 0x06, 0x05, 0x0c, 0x08, 0xb1, 0x6a, 0xc9,
-    0xca, 0xa1, 0x08, 0x0c, 0x05, 0x06, 0x04, 0x04,
-    0x06, 0x05, 0x0c, 0x08, 0xb1, 0x6a, 0xc9, 0xca,
-    0x69, 0x28, 0xcc, 0x09, 0x0d, 0x05, 0x05, 0x03,
-    0x02, 0x03, 0x05, 0x05, 0x0d, 0x09, 0xcc, 0xf0,
-    0xf0, 0xcc, 0x09, 0x0d, 0x05, 0x05, 0x03, 0x02,
-    0x03, 0x05, 0x05, 0x0d, 0x09, 0xcc, 0xf0, 0xf0,
-    0x00, 0x02, 0x00, 0x1e, 0x00, 0x28, 0x02, 0x3a,
-    0x02, 0x08, 0x00, 0x10, 0x00, 0x21, 0x00, 0x25,
-    0x40, 0x22, 0x1a, 0x10, 0x08, 0x03, 0x01, 0x00,
-    0x01, 0x4c, 0x02, 0x01, 0x00, 0x01, 0x01, 0x00,
-    0x57, 0x02, 0x01, 0x00, 0x00, 0x01, 0x5f, 0x03,
-    0x01, 0x01, 0x00, 0x01, 0x4f, 0x1d, 0x13, 0x1d,
-    0x10, 0x04, 0x09, 0x1a, 0x2b, 0x01, 0x33, 0x07,
-    0x0e, 0x01, 0x07, 0x06, 0x07, 0x15, 0x16, 0x17,
-    0x1e, 0x01, 0x1f, 0x01, 0x23, 0x27, 0x23, 0x37,
-    0x33, 0x07, 0x0e, 0x01, 0x07, 0x06, 0x07, 0x15,
-    0x16, 0x17, 0x1e, 0x01, 0x1f, 0x01, 0x23, 0x01,
-    0xd0, 0x6a, 0xb1, 0x08, 0x0c, 0x05, 0x06, 0x04,
-    0x04, 0x06, 0x05, 0x0c, 0x08, 0xb1, 0x69, 0xca,
-    0xe9, 0xc9, 0x6a, 0xb1, 0x08, 0x0c, 0x05, 0x06,
-    0x04, 0x04, 0x06, 0x05, 0x0c, 0x08, 0xb1, 0x69,
-    0x02, 0x08, 0xcc, 0x09, 0x0d, 0x05, 0x05, 0x03,
-    0x02, 0x03, 0x05, 0x05, 0x0d, 0x09, 0xcc, 0xf0,
-    0xf0, 0xcc, 0x09, 0x0d, 0x05, 0x05, 0x03, 0x02,
-    0x03, 0x05, 0x05, 0x0d, 0x09, 0xcc, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x93, 0x00, 0x28, 0x01, 0xc6,
-    0x02, 0x08, 0x00, 0x10, 0x00, 0x1f, 0x40, 0x1c,
-    0x10, 0x08, 0x02, 0x01, 0x00, 0x01, 0x4c, 0x00,
-    0x00, 0x01, 0x01, 0x00, 0x57, 0x00, 0x00, 0x00,
-    0x01, 0x5f, 0x00, 0x01, 0x00, 0x01, 0x4f, 0x1d,
-    0x10, 0x02, 0x09, 0x18, 0x2b, 0x01, 0x33, 0x07,
-    0x0e, 0x01, 0x07, 0x06, 0x07, 0x15, 0x16, 0x17,
-    0x1e, 0x01, 0x1f, 0x01, 0x23, 0x27, 0x01, 0x5c,
-    0x6a, 0xb1, 0x08, 0x0c, 0x05, 0x06, 0x04, 0x04,
-    0x06, 0x05, 0x0c, 0x08, 0xb1, 0x69, 0xca, 0x02,
-    0x08, 0xcc, 0x09, 0x0d, 0x05, 0x05, 0x03, 0x02,
-    0x03, 0x05, 0x05, 0x0d, 0x09, 0xcc, 0xf0, 0x00,
-    0x00, 0x01, 0x00, 0x92, 0x00, 0x28, 0x01, 0xc5,
-    0x02, 0x08, 0x00, 0x10, 0x00, 0x1e, 0x40, 0x1b,
-    0x09, 0x01, 0x00, 0x01, 0x01, 0x4c, 0x00, 0x01,
-    0x00, 0x00, 0x01, 0x57, 0x00, 0x01, 0x01, 0x00,
-    0x5f, 0x00, 0x00, 0x01, 0x00, 0x4f, 0x1d, 0x11,
-    0x02, 0x09, 0x18, 0x2b, 0x01, 0x07, 0x23, 0x37,
-    0x3e, 0x01, 0x37, 0x36, 0x37, 0x35, 0x26, 0x27,
-    0x2e, 0x01, 0x2f, 0x01, 0x33, 0x01, 0xc5, 0xca,
-    0x69, 0xb1, 0x08, 0x0c, 0x05, 0x06, 0x04, 0x04,
-    0x06, 0x05, 0x0c, 0x08, 0xb1, 0x6a, 0x01, 0x18,
-    0xf0, 0xcc, 0x09, 0x0d, 0x05, 0x05, 0x03, 0x02,
-    0x03, 0x05, 0x05, 0x0d, 0x09, 0xcc, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0xe4, 0x01, 0xd0, 0x01, 0xb6,
-    0x03, 0x07, 0x11, 0x0b, 0x00, 0x39, 0x02, 0x5b,
-    0x02, 0x67, 0xc0, 0x01, 0x00, 0x17, 0x40, 0x14,
-    0x00, 0x00, 0x01, 0x00, 0x85, 0x02, 0x01, 0x01,
-    0x01, 0x76, 0x01, 0x01, 0x01, 0x04, 0x01, 0x04,
-    0x12, 0x03, 0x09, 0x22, 0x2b, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0xa3, 0x01, 0xd1, 0x01, 0x75,
-    0x03, 0x08, 0x11, 0x03, 0x00, 0x39, 0xff, 0xfe,
-    0x02, 0x71, 0x00, 0x17, 0x40, 0x14, 0x02, 0x01,
-    0x01, 0x00, 0x01, 0x85, 0x00, 0x00, 0x00, 0x76,
-    0x01, 0x01, 0x01, 0x04, 0x01, 0x04, 0x12, 0x03,
-    0x09, 0x22, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x5a,
-    0x01, 0xd0, 0x02, 0x3f, 0x03, 0x07, 0x10, 0x2b,
-    0x00, 0x39, 0x01, 0xd1, 0x02, 0x67, 0xc0, 0x01,
-    0x11, 0x0b, 0x00, 0x39, 0x02, 0xe4, 0x02, 0x67,
-    0xc0, 0x01, 0x00, 0x22, 0x40, 0x1f, 0x02, 0x01,
-    0x00, 0x01, 0x00, 0x85, 0x05, 0x03, 0x04, 0x03,
-    0x01, 0x01, 0x76, 0x05, 0x05, 0x01, 0x01, 0x05,
-    0x08, 0x05, 0x08, 0x07, 0x06, 0x01, 0x04, 0x01,
-    0x04, 0x12, 0x06, 0x09, 0x22, 0x2b, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x19, 0x01, 0xd1, 0x01, 0xfe,
-    0x03, 0x08, 0x10, 0x23, 0x00, 0x39, 0x00, 0x87,
-    0x02, 0x71, 0x11, 0x03, 0x00, 0x39, 0xff, 0x74,
-    0x02, 0x71, 0x00, 0x22, 0x40, 0x1f, 0x05, 0x03,
-    0x04, 0x03, 0x01, 0x00, 0x01, 0x85, 0x02, 0x01,
-    0x00, 0x00, 0x76, 0x05, 0x05, 0x01, 0x01, 0x05,
-    0x08, 0x05, 0x08, 0x07, 0x06, 0x01, 0x04, 0x01,
-    0x04, 0x12, 0x06, 0x09, 0x22, 0x2b, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0xa5, 0xff, 0x60, 0x01, 0x77,
-    0x00, 0x97, 0x11, 0x02, 0x00, 0x39, 0x00, 0x00,
-    0x00, 0x19, 0x40, 0x16, 0x02, 0x01, 0x01, 0x00,
-    0x01, 0x85, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x4e,
-    0x01, 0x01, 0x01, 0x04, 0x01, 0x04, 0x12, 0x03,
-    0x09, 0x22, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x19,
-    0xff, 0x60, 0x01, 0xfe, 0x00, 0x97, 0x10, 0x23,
-    0x00, 0x39, 0x00, 0x87, 0x00, 0x00, 0x11, 0x03,
-    0x00, 0x39, 0xff, 0x74, 0x00, 0x00, 0x00, 0x24,
-    0x40, 0x21, 0x05, 0x03, 0x04, 0x03, 0x01, 0x00,
-    0x01, 0x85, 0x02, 0x01, 0x00, 0x00, 0x3f, 0x00,
-    0x4e, 0x05, 0x05, 0x01, 0x01, 0x05, 0x08, 0x05,
-    0x08, 0x07, 0x06, 0x01, 0x04, 0x01, 0x04, 0x12,
-    0x06, 0x09, 0x22, 0x2b, 0x00, 0x01, 0x00, 0x69,
-    0x02, 0x8a, 0x01, 0xef, 0x03, 0x1b, 0x00, 0x1b,
-    0x00, 0x6f, 0xb1, 0x06, 0x64, 0x44, 0x4b, 0xb0,
-    0x2e, 0x50, 0x58, 0x40, 0x1c, 0x05, 0x01, 0x01,
-    0x00, 0x03, 0x00, 0x01, 0x03, 0x69, 0x06, 0x01,
-    0x00, 0x02, 0x02, 0x00, 0x59, 0x06, 0x01, 0x00,
-    0x00, 0x02, 0x62, 0x04, 0x01, 0x02, 0x00, 0x02,
-    0x52, 0x1b, 0x40, 0x2a, 0x00, 0x01, 0x05, 0x03,
-    0x05, 0x01, 0x03, 0x80, 0x00, 0x04, 0x00, 0x02,
-    0x00, 0x04, 0x02, 0x80, 0x00, 0x05, 0x00, 0x03,
-    0x00, 0x05, 0x03, 0x69, 0x06, 0x01, 0x00, 0x04,
-    0x02, 0x00, 0x59, 0x06, 0x01, 0x00, 0x00, 0x02,
-    0x62, 0x00, 0x02, 0x00, 0x02, 0x52, 0x59, 0x40,
-    0x13, 0x01, 0x00, 0x18, 0x16, 0x13, 0x12, 0x0f,
-    0x0d, 0x0a, 0x08, 0x05, 0x04, 0x00, 0x1b, 0x01,
-    0x1b, 0x07, 0x09, 0x16, 0x2b, 0xb1, 0x06, 0x00,
-    0x44, 0x01, 0x32, 0x36, 0x3d, 0x01, 0x33, 0x15,
-    0x14, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x23, 0x22,
-    0x06, 0x1d, 0x01, 0x23, 0x35, 0x34, 0x36, 0x33,
-    0x32, 0x1e, 0x02, 0x01, 0x81, 0x15, 0x18, 0x41,
-    0x3a, 0x34, 0x22, 0x2c, 0x24, 0x21, 0x17, 0x15,
-    0x18, 0x41, 0x3a, 0x34, 0x22, 0x2c, 0x24, 0x22,
-    0x02, 0xcb, 0x1d, 0x1a, 0x14, 0x14, 0x3a, 0x3e,
-    0x19, 0x1e, 0x19, 0x1d, 0x1a, 0x14, 0x14, 0x3a,
-    0x3e, 0x19, 0x1e, 0x19, 0x00, 0x01, 0x00, 0xaa,
-    0x02, 0xb7, 0x01, 0xae, 0x03, 0x02, 0x00, 0x03,
-    0x00, 0x20, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x15,
-    0x00, 0x00, 0x01, 0x01, 0x00, 0x57, 0x00, 0x00,
-    0x00, 0x01, 0x5f, 0x00, 0x01, 0x00, 0x01, 0x4f,
-    0x11, 0x10, 0x02, 0x09, 0x18, 0x2b, 0xb1, 0x06,
-    0x00, 0x44, 0x13, 0x21, 0x15, 0x21, 0xaa, 0x01,
-    0x04, 0xfe, 0xfc, 0x03, 0x02, 0x4b, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x41, 0x00, 0xfa, 0x02, 0x17,
-    0x01, 0xc7, 0x00, 0x1d, 0x00, 0x6d, 0xb1, 0x06,
-    0x64, 0x44, 0x4b, 0xb0, 0x2e, 0x50, 0x58, 0x40,
-    0x1b, 0x05, 0x01, 0x03, 0x00, 0x01, 0x04, 0x03,
-    0x01, 0x69, 0x00, 0x04, 0x00, 0x00, 0x04, 0x59,
-    0x00, 0x04, 0x04, 0x00, 0x62, 0x02, 0x06, 0x02,
-    0x00, 0x04, 0x00, 0x52, 0x1b, 0x40, 0x29, 0x00,
-    0x05, 0x03, 0x01, 0x03, 0x05, 0x01, 0x80, 0x00,
-    0x02, 0x04, 0x00, 0x04, 0x02, 0x00, 0x80, 0x00,
-    0x03, 0x00, 0x01, 0x04, 0x03, 0x01, 0x69, 0x00,
-    0x04, 0x02, 0x00, 0x04, 0x59, 0x00, 0x04, 0x04,
-    0x00, 0x62, 0x06, 0x01, 0x00, 0x04, 0x00, 0x52,
-    0x59, 0x40, 0x13, 0x01, 0x00, 0x1a, 0x19, 0x17,
-    0x15, 0x10, 0x0e, 0x0b, 0x0a, 0x08, 0x06, 0x00,
-    0x1d, 0x01, 0x1d, 0x07, 0x09, 0x16, 0x2b, 0xb1,
-    0x06, 0x00, 0x44, 0x25, 0x22, 0x2e, 0x04, 0x23,
-    0x22, 0x1d, 0x01, 0x23, 0x35, 0x34, 0x36, 0x33,
-    0x32, 0x1e, 0x04, 0x33, 0x32, 0x3d, 0x01, 0x33,
-    0x15, 0x14, 0x06, 0x01, 0x95, 0x1f, 0x2e, 0x23,
-    0x1b, 0x19, 0x1b, 0x11, 0x2f, 0x55, 0x47, 0x3b,
-    0x1f, 0x2e, 0x23, 0x1b, 0x19, 0x1b, 0x11, 0x2f,
-    0x55, 0x47, 0xfa, 0x13, 0x1d, 0x22, 0x1d, 0x13,
-    0x37, 0x46, 0x46, 0x3b, 0x47, 0x13, 0x1d, 0x22,
-    0x1d, 0x13, 0x37, 0x46, 0x46, 0x3a, 0x48, 0x00,
-    0x00, 0x01, 0x00, 0x82, 0x02, 0x8f, 0x01, 0xd6,
-    0x03, 0x16, 0x00, 0x11, 0x00, 0x28, 0xb1, 0x06,
-    0x64, 0x44, 0x40, 0x1d, 0x02, 0x01, 0x00, 0x01,
-    0x00, 0x85, 0x00, 0x01, 0x03, 0x03, 0x01, 0x59,
-    0x00, 0x01, 0x01, 0x03, 0x61, 0x00, 0x03, 0x01,
-    0x03, 0x51, 0x24, 0x12, 0x22, 0x10, 0x04, 0x09,
-    0x1a, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x13, 0x33,
-    0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x33, 0x14,
-    0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02, 0x82, 0x4b,
-    0x34, 0x2a, 0x2a, 0x36, 0x4b, 0x1a, 0x2e, 0x3e,
-    0x24, 0x24, 0x3e, 0x2e, 0x1a, 0x03, 0x16, 0x22,
-    0x24, 0x24, 0x22, 0x1e, 0x32, 0x24, 0x13, 0x13,
-    0x24, 0x32, 0x00, 0x00, 0x00, 0x01, 0x00, 0xd7,
-    0x02, 0xad, 0x01, 0x6d, 0x03, 0x25, 0x00, 0x0d,
-    0x00, 0x28, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x1d,
-    0x02, 0x01, 0x00, 0x01, 0x01, 0x00, 0x59, 0x02,
-    0x01, 0x00, 0x00, 0x01, 0x61, 0x00, 0x01, 0x00,
-    0x01, 0x51, 0x02, 0x00, 0x09, 0x06, 0x00, 0x0d,
-    0x02, 0x0d, 0x03, 0x09, 0x16, 0x2b, 0xb1, 0x06,
-    0x00, 0x44, 0x01, 0x33, 0x32, 0x16, 0x15, 0x14,
-    0x06, 0x2b, 0x01, 0x22, 0x26, 0x35, 0x34, 0x36,
-    0x01, 0x18, 0x14, 0x1d, 0x24, 0x24, 0x1d, 0x14,
-    0x1d, 0x24, 0x24, 0x03, 0x25, 0x22, 0x1b, 0x1b,
-    0x20, 0x1f, 0x1c, 0x1b, 0x22, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0xb4, 0x02, 0x67, 0x01, 0xa4,
-    0x03, 0x39, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x2a,
-    0xb1, 0x06, 0x64, 0x44, 0x40, 0x1f, 0x00, 0x00,
-    0x00, 0x03, 0x02, 0x00, 0x03, 0x69, 0x00, 0x02,
-    0x01, 0x01, 0x02, 0x59, 0x00, 0x02, 0x02, 0x01,
-    0x61, 0x00, 0x01, 0x02, 0x01, 0x51, 0x24, 0x24,
-    0x24, 0x22, 0x04, 0x09, 0x1a, 0x2b, 0xb1, 0x06,
-    0x00, 0x44, 0x13, 0x34, 0x36, 0x33, 0x32, 0x16,
-    0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x37, 0x14,
-    0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23,
-    0x22, 0x06, 0xb4, 0x42, 0x36, 0x36, 0x42, 0x42,
-    0x36, 0x36, 0x42, 0x3c, 0x1e, 0x1d, 0x1d, 0x20,
-    0x20, 0x1d, 0x1c, 0x1f, 0x02, 0xd0, 0x30, 0x39,
-    0x39, 0x30, 0x30, 0x39, 0x39, 0x30, 0x1a, 0x1c,
-    0x1c, 0x1a, 0x1a, 0x1d, 0x1d, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0xaa, 0x02, 0x8a, 0x01, 0x86,
-    0x03, 0x1c, 0x00, 0x03, 0x00, 0x19, 0xb1, 0x06,
-    0x64, 0x44, 0x40, 0x0e, 0x00, 0x00, 0x01, 0x00,
-    0x85, 0x00, 0x01, 0x01, 0x76, 0x11, 0x10, 0x02,
-    0x09, 0x18, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x13,
-    0x33, 0x17, 0x23, 0xaa, 0x6e, 0x6e, 0x5a, 0x03,
-    0x1c, 0x92, 0x00, 0x00, 0x00, 0x01, 0x00, 0xe6,
-    0x02, 0x8a, 0x01, 0xc2, 0x03, 0x1c, 0x00, 0x03,
-    0x00, 0x19, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x0e,
-    0x00, 0x01, 0x00, 0x01, 0x85, 0x00, 0x00, 0x00,
-    0x76, 0x11, 0x10, 0x02, 0x09, 0x18, 0x2b, 0xb1,
-    0x06, 0x00, 0x44, 0x01, 0x23, 0x37, 0x33, 0x01,
-    0x40, 0x5a, 0x6e, 0x6e, 0x02, 0x8a, 0x92, 0x00,
-    0xff, 0xff, 0x00, 0x78, 0x02, 0x8a, 0x02, 0x1c,
-    0x03, 0x1c, 0x10, 0x63, 0x00, 0x92, 0x01, 0xfe,
-    0x00, 0x00, 0xc0, 0x01, 0x40, 0x00, 0x11, 0x43,
-    0x00, 0x92, 0x02, 0xc6, 0x00, 0x00, 0xc0, 0x01,
-    0x40, 0x00, 0x00, 0x25, 0xb1, 0x06, 0x64, 0x44,
-    0x40, 0x1a, 0x02, 0x01, 0x00, 0x01, 0x01, 0x00,
-    0x57, 0x02, 0x01, 0x00, 0x00, 0x01, 0x5f, 0x03,
-    0x01, 0x01, 0x00, 0x01, 0x4f, 0x11, 0x11, 0x11,
-    0x11, 0x04, 0x09, 0x25, 0x2b, 0xb1, 0x06, 0x00,
-    0x44, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x3f,
-    0xff, 0xf6, 0x02, 0x00, 0x03, 0x1c, 0x10, 0x22,
-    0x00, 0x2a, 0x00, 0x00, 0x11, 0x02, 0x00, 0x92,
-    0x00, 0x00, 0x00, 0x90, 0xb5, 0x18, 0x01, 0x06,
-    0x07, 0x01, 0x4c, 0x4b, 0xb0, 0x18, 0x50, 0x58,
-    0x40, 0x31, 0x00, 0x08, 0x09, 0x08, 0x85, 0x00,
-    0x09, 0x03, 0x09, 0x85, 0x00, 0x02, 0x01, 0x00,
-    0x01, 0x02, 0x00, 0x80, 0x00, 0x00, 0x00, 0x07,
-    0x06, 0x00, 0x07, 0x67, 0x00, 0x01, 0x01, 0x03,
-    0x61, 0x00, 0x03, 0x03, 0x45, 0x4d, 0x0a, 0x01,
-    0x06, 0x06, 0x04, 0x61, 0x05, 0x01, 0x04, 0x04,
-    0x3b, 0x04, 0x4e, 0x1b, 0x40, 0x35, 0x00, 0x08,
-    0x09, 0x08, 0x85, 0x00, 0x09, 0x03, 0x09, 0x85,
-    0x00, 0x02, 0x01, 0x00, 0x01, 0x02, 0x00, 0x80,
-    0x00, 0x00, 0x00, 0x07, 0x06, 0x00, 0x07, 0x67,
-    0x00, 0x01, 0x01, 0x03, 0x61, 0x00, 0x03, 0x03,
-    0x45, 0x4d, 0x00, 0x04, 0x04, 0x3b, 0x4d, 0x0a,
-    0x01, 0x06, 0x06, 0x05, 0x61, 0x00, 0x05, 0x05,
-    0x43, 0x05, 0x4e, 0x59, 0x40, 0x15, 0x20, 0x1f,
-    0x2f, 0x2e, 0x2d, 0x2c, 0x27, 0x25, 0x1f, 0x2b,
-    0x20, 0x2b, 0x24, 0x13, 0x22, 0x12, 0x23, 0x25,
-    0x0b, 0x09, 0x27, 0x2b, 0xff, 0xff, 0x00, 0x58,
-    0x00, 0x00, 0x02, 0x01, 0x03, 0x1b, 0x10, 0x22,
-    0x00, 0x05, 0x00, 0x00, 0x11, 0x02, 0x00, 0x8c,
-    0x00, 0x00, 0x00, 0xc9, 0xb5, 0x04, 0x01, 0x02,
-    0x03, 0x01, 0x4c, 0x4b, 0xb0, 0x18, 0x50, 0x58,
-    0x40, 0x28, 0x0a, 0x01, 0x06, 0x00, 0x08, 0x05,
-    0x06, 0x08, 0x69, 0x09, 0x01, 0x07, 0x07, 0x05,
-    0x61, 0x0c, 0x01, 0x05, 0x05, 0x3a, 0x4d, 0x00,
-    0x03, 0x03, 0x00, 0x61, 0x01, 0x01, 0x00, 0x00,
-    0x3d, 0x4d, 0x0b, 0x04, 0x02, 0x02, 0x02, 0x3b,
-    0x02, 0x4e, 0x1b, 0x4b, 0xb0, 0x2e, 0x50, 0x58,
-    0x40, 0x2c, 0x0a, 0x01, 0x06, 0x00, 0x08, 0x05,
-    0x06, 0x08, 0x69, 0x09, 0x01, 0x07, 0x07, 0x05,
-    0x61, 0x0c, 0x01, 0x05, 0x05, 0x3a, 0x4d, 0x00,
-    0x00, 0x00, 0x3d, 0x4d, 0x00, 0x03, 0x03, 0x01,
-    0x61, 0x00, 0x01, 0x01, 0x45, 0x4d, 0x0b, 0x04,
-    0x02, 0x02, 0x02, 0x3b, 0x02, 0x4e, 0x1b, 0x40,
-    0x3a, 0x00, 0x06, 0x0a, 0x08, 0x0a, 0x06, 0x08,
-    0x80, 0x00, 0x09, 0x05, 0x07, 0x05, 0x09, 0x07,
-    0x80, 0x00, 0x0a, 0x00, 0x08, 0x05, 0x0a, 0x08,
-    0x69, 0x00, 0x07, 0x07, 0x05, 0x61, 0x0c, 0x01,
-    0x05, 0x05, 0x3a, 0x4d, 0x00, 0x00, 0x00, 0x3d,
-    0x4d, 0x00, 0x03, 0x03, 0x01, 0x61, 0x00, 0x01,
-    0x01, 0x45, 0x4d, 0x0b, 0x04, 0x02, 0x02, 0x02,
-    0x3b, 0x02, 0x4e, 0x59, 0x59, 0x40, 0x1d, 0x19,
-    0x18, 0x01, 0x01, 0x30, 0x2e, 0x2b, 0x2a, 0x27,
-    0x25, 0x22, 0x20, 0x1d, 0x1c, 0x18, 0x33, 0x19,
-    0x33, 0x01, 0x17, 0x01, 0x17, 0x23, 0x15, 0x24,
-    0x12, 0x0d, 0x09, 0x25, 0x2b, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x55, 0xff, 0xf6, 0x02, 0x03,
-    0x03, 0xbc, 0x10, 0x22, 0x00, 0x23, 0x00, 0x00,
-    0x11, 0x03, 0x00, 0x94, 0x00, 0x00, 0x00, 0xa0,
-    0x00, 0x38, 0x40, 0x35, 0x06, 0x01, 0x04, 0x05,
-    0x04, 0x85, 0x07, 0x01, 0x05, 0x01, 0x05, 0x85,
-    0x03, 0x01, 0x01, 0x01, 0x3a, 0x4d, 0x00, 0x02,
-    0x02, 0x00, 0x62, 0x08, 0x01, 0x00, 0x00, 0x43,
-    0x00, 0x4e, 0x02, 0x01, 0x1b, 0x1a, 0x19, 0x18,
-    0x17, 0x16, 0x15, 0x14, 0x0f, 0x0e, 0x0b, 0x09,
-    0x06, 0x05, 0x01, 0x12, 0x02, 0x12, 0x09, 0x09,
-    0x21, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x5a,
-    0xff, 0xf6, 0x01, 0xfe, 0x03, 0x1c, 0x10, 0x22,
-    0x00, 0x5a, 0x00, 0x00, 0x11, 0x02, 0x00, 0x94,
-    0x00, 0x00, 0x00, 0x2b, 0x40, 0x28, 0x06, 0x01,
-    0x04, 0x05, 0x04, 0x85, 0x07, 0x01, 0x05, 0x00,
-    0x05, 0x85, 0x02, 0x01, 0x00, 0x00, 0x3d, 0x4d,
-    0x00, 0x01, 0x01, 0x03, 0x62, 0x00, 0x03, 0x03,
-    0x43, 0x03, 0x4e, 0x11, 0x11, 0x11, 0x14, 0x23,
-    0x12, 0x22, 0x11, 0x08, 0x09, 0x29, 0x2b, 0x00,
-    0x00, 0x02, 0x00, 0x8c, 0x02, 0x9b, 0x01, 0xcc,
-    0x03, 0x13, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x25,
-    0xb1, 0x06, 0x64, 0x44, 0x40, 0x1a, 0x02, 0x01,
-    0x00, 0x01, 0x01, 0x00, 0x59, 0x02, 0x01, 0x00,
-    0x00, 0x01, 0x61, 0x03, 0x01, 0x01, 0x00, 0x01,
-    0x51, 0x24, 0x24, 0x24, 0x22, 0x04, 0x09, 0x1a,
-    0x2b, 0xb1, 0x06, 0x00, 0x44, 0x13, 0x34, 0x36,
-    0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22,
-    0x26, 0x37, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15,
-    0x14, 0x06, 0x23, 0x22, 0x26, 0x8c, 0x21, 0x1b,
-    0x1b, 0x21, 0x21, 0x1b, 0x1b, 0x21, 0xc8, 0x21,
-    0x1b, 0x1b, 0x21, 0x21, 0x1b, 0x1b, 0x21, 0x02,
-    0xd7, 0x1b, 0x21, 0x21, 0x1b, 0x1b, 0x21, 0x21,
-    0x1b, 0x1b, 0x21, 0x21, 0x1b, 0x1b, 0x21, 0x21,
-    0xff, 0xff, 0x00, 0x3f, 0xff, 0xf6, 0x02, 0x00,
-    0x03, 0x13, 0x10, 0x22, 0x00, 0x2a, 0x00, 0x00,
-    0x11, 0x02, 0x00, 0x99, 0x00, 0x00, 0x00, 0xd0,
-    0xb5, 0x18, 0x01, 0x06, 0x07, 0x01, 0x4c, 0x4b,
-    0xb0, 0x17, 0x50, 0x58, 0x40, 0x33, 0x00, 0x02,
-    0x01, 0x00, 0x01, 0x02, 0x00, 0x80, 0x00, 0x00,
-    0x00, 0x07, 0x06, 0x00, 0x07, 0x67, 0x0b, 0x01,
-    0x09, 0x09, 0x08, 0x61, 0x0a, 0x01, 0x08, 0x08,
-    0x44, 0x4d, 0x00, 0x01, 0x01, 0x03, 0x61, 0x00,
-    0x03, 0x03, 0x45, 0x4d, 0x0c, 0x01, 0x06, 0x06,
-    0x04, 0x61, 0x05, 0x01, 0x04, 0x04, 0x3b, 0x04,
-    0x4e, 0x1b, 0x4b, 0xb0, 0x18, 0x50, 0x58, 0x40,
-    0x31, 0x00, 0x02, 0x01, 0x00, 0x01, 0x02, 0x00,
-    0x80, 0x0a, 0x01, 0x08, 0x0b, 0x01, 0x09, 0x03,
-    0x08, 0x09, 0x69, 0x00, 0x00, 0x00, 0x07, 0x06,
-    0x00, 0x07, 0x67, 0x00, 0x01, 0x01, 0x03, 0x61,
-    0x00, 0x03, 0x03, 0x45, 0x4d, 0x0c, 0x01, 0x06,
-    0x06, 0x04, 0x61, 0x05, 0x01, 0x04, 0x04, 0x3b,
-    0x04, 0x4e, 0x1b, 0x40, 0x35, 0x00, 0x02, 0x01,
-    0x00, 0x01, 0x02, 0x00, 0x80, 0x0a, 0x01, 0x08,
-    0x0b, 0x01, 0x09, 0x03, 0x08, 0x09, 0x69, 0x00,
-    0x00, 0x00, 0x07, 0x06, 0x00, 0x07, 0x67, 0x00,
-    0x01, 0x01, 0x03, 0x61, 0x00, 0x03, 0x03, 0x45,
-    0x4d, 0x00, 0x04, 0x04, 0x3b, 0x4d, 0x0c, 0x01,
-    0x06, 0x06, 0x05, 0x61, 0x00, 0x05, 0x05, 0x43,
-    0x05, 0x4e, 0x59, 0x59, 0x40, 0x19, 0x20, 0x1f,
-    0x42, 0x40, 0x3c, 0x3a, 0x36, 0x34, 0x30, 0x2e,
-    0x27, 0x25, 0x1f, 0x2b, 0x20, 0x2b, 0x24, 0x13,
-    0x22, 0x12, 0x23, 0x25, 0x0d, 0x09, 0x27, 0x2b,
-    0x00, 0x01, 0x00, 0x87, 0x02, 0x8a, 0x01, 0xd1,
-    0x03, 0x1b, 0x00, 0x11, 0x00, 0x1b, 0xb1, 0x06,
-    0x64, 0x44, 0x40, 0x10, 0x00, 0x00, 0x01, 0x00,
-    0x85, 0x02, 0x01, 0x01, 0x01, 0x76, 0x1d, 0x11,
-    0x10, 0x03, 0x09, 0x19, 0x2b, 0xb1, 0x06, 0x00,
-    0x44, 0x01, 0x33, 0x17, 0x23, 0x27, 0x2e, 0x01,
-    0x27, 0x26, 0x27, 0x23, 0x06, 0x07, 0x0e, 0x01,
-    0x0f, 0x01, 0x23, 0x01, 0x09, 0x46, 0x82, 0x4e,
-    0x37, 0x09, 0x0b, 0x04, 0x04, 0x02, 0x03, 0x02,
-    0x04, 0x04, 0x0b, 0x09, 0x38, 0x4e, 0x03, 0x1b,
-    0x91, 0x39, 0x0a, 0x0c, 0x04, 0x05, 0x03, 0x03,
-    0x04, 0x05, 0x0c, 0x09, 0x3a, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x87, 0x02, 0x8a, 0x01, 0xd1,
-    0x03, 0x1b, 0x00, 0x11, 0x00, 0x1b, 0xb1, 0x06,
-    0x64, 0x44, 0x40, 0x10, 0x01, 0x01, 0x00, 0x02,
-    0x00, 0x85, 0x00, 0x02, 0x02, 0x76, 0x11, 0x1d,
-    0x10, 0x03, 0x09, 0x19, 0x2b, 0xb1, 0x06, 0x00,
-    0x44, 0x13, 0x33, 0x17, 0x1e, 0x01, 0x17, 0x16,
-    0x17, 0x33, 0x36, 0x37, 0x3e, 0x01, 0x3f, 0x01,
-    0x33, 0x07, 0x23, 0x87, 0x4e, 0x38, 0x09, 0x0b,
-    0x04, 0x04, 0x02, 0x03, 0x02, 0x04, 0x04, 0x0b,
-    0x09, 0x37, 0x4e, 0x82, 0x46, 0x03, 0x1b, 0x3a,
-    0x09, 0x0c, 0x04, 0x05, 0x03, 0x03, 0x05, 0x04,
-    0x0d, 0x09, 0x39, 0x91, 0xff, 0xff, 0x00, 0x58,
-    0xff, 0xf6, 0x02, 0x10, 0x03, 0x1b, 0x10, 0x22,
-    0x00, 0x2c, 0x00, 0x00, 0x11, 0x02, 0x00, 0x9c,
-    0x00, 0x00, 0x00, 0x4b, 0x40, 0x48, 0x00, 0x08,
-    0x06, 0x01, 0x06, 0x08, 0x01, 0x80, 0x00, 0x05,
-    0x02, 0x04, 0x02, 0x05, 0x04, 0x80, 0x07, 0x01,
-    0x06, 0x00, 0x02, 0x05, 0x06, 0x02, 0x67, 0x00,
-    0x03, 0x03, 0x01, 0x61, 0x00, 0x01, 0x01, 0x45,
-    0x4d, 0x00, 0x04, 0x04, 0x00, 0x61, 0x09, 0x01,
-    0x00, 0x00, 0x43, 0x00, 0x4e, 0x02, 0x01, 0x32,
-    0x31, 0x30, 0x2f, 0x22, 0x21, 0x1e, 0x1d, 0x1b,
-    0x19, 0x14, 0x12, 0x10, 0x0f, 0x0d, 0x0b, 0x01,
-    0x20, 0x02, 0x20, 0x0a, 0x09, 0x21, 0x2b, 0x00,
-    0x00, 0x01, 0x00, 0xcd, 0xff, 0x42, 0x01, 0x9a,
-    0x00, 0x1a, 0x00, 0x13, 0x00, 0x30, 0xb1, 0x06,
-    0x64, 0x44, 0x40, 0x25, 0x02, 0x01, 0x03, 0x00,
-    0x01, 0x4c, 0x00, 0x00, 0x00, 0x03, 0x02, 0x00,
-    0x03, 0x69, 0x00, 0x02, 0x01, 0x01, 0x02, 0x59,
-    0x00, 0x02, 0x02, 0x01, 0x5f, 0x00, 0x01, 0x02,
-    0x01, 0x4f, 0x14, 0x21, 0x28, 0x10, 0x04, 0x09,
-    0x1a, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x37, 0x33,
-    0x07, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x14, 0x06,
-    0x2b, 0x01, 0x35, 0x33, 0x32, 0x36, 0x35, 0x34,
-    0x26, 0x23, 0xfe, 0x39, 0x15, 0x22, 0x1a, 0x17,
-    0x25, 0x42, 0x36, 0x55, 0x46, 0x16, 0x1b, 0x36,
-    0x33, 0x1a, 0x3d, 0x03, 0x09, 0x08, 0x20, 0x1a,
-    0x23, 0x2a, 0x37, 0x10, 0x0e, 0x11, 0x13, 0x00,
-    0x00, 0x01, 0x00, 0xb9, 0xff, 0x38, 0x01, 0x81,
-    0x00, 0x0a, 0x00, 0x10, 0x00, 0x2c, 0xb1, 0x06,
-    0x64, 0x44, 0x40, 0x21, 0x03, 0x01, 0x02, 0x00,
-    0x02, 0x85, 0x00, 0x00, 0x01, 0x01, 0x00, 0x59,
-    0x00, 0x00, 0x00, 0x01, 0x60, 0x00, 0x01, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10,
-    0x21, 0x26, 0x04, 0x09, 0x18, 0x2b, 0xb1, 0x06,
-    0x00, 0x44, 0x25, 0x07, 0x0e, 0x01, 0x15, 0x14,
-    0x16, 0x3b, 0x01, 0x15, 0x23, 0x22, 0x26, 0x35,
-    0x34, 0x36, 0x37, 0x01, 0x59, 0x0b, 0x22, 0x1e,
-    0x1d, 0x1a, 0x3c, 0x4e, 0x38, 0x42, 0x25, 0x30,
-    0x0a, 0x09, 0x1c, 0x2d, 0x15, 0x16, 0x19, 0x3c,
-    0x31, 0x29, 0x1d, 0x3a, 0x21, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x55, 0xff, 0x38, 0x02, 0x03,
-    0x02, 0xd0, 0x10, 0x22, 0x00, 0x23, 0x00, 0x00,
-    0x11, 0x02, 0x00, 0x9f, 0x4b, 0x00, 0x00, 0x6a,
-    0x4b, 0xb0, 0x15, 0x50, 0x58, 0x40, 0x21, 0x08,
-    0x01, 0x06, 0x02, 0x00, 0x02, 0x06, 0x72, 0x00,
-    0x04, 0x00, 0x05, 0x04, 0x05, 0x63, 0x03, 0x01,
-    0x01, 0x01, 0x3a, 0x4d, 0x00, 0x02, 0x02, 0x00,
-    0x61, 0x07, 0x01, 0x00, 0x00, 0x43, 0x00, 0x4e,
-    0x1b, 0x40, 0x22, 0x08, 0x01, 0x06, 0x02, 0x00,
-    0x02, 0x06, 0x00, 0x80, 0x00, 0x04, 0x00, 0x05,
-    0x04, 0x05, 0x63, 0x03, 0x01, 0x01, 0x01, 0x3a,
-    0x4d, 0x00, 0x02, 0x02, 0x00, 0x61, 0x07, 0x01,
-    0x00, 0x00, 0x43, 0x00, 0x4e, 0x59, 0x40, 0x19,
-    0x13, 0x13, 0x02, 0x01, 0x13, 0x23, 0x13, 0x23,
-    0x1e, 0x1c, 0x1b, 0x19, 0x0f, 0x0e, 0x0b, 0x09,
-    0x06, 0x05, 0x01, 0x12, 0x02, 0x12, 0x09, 0x09,
-    0x21, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x5a,
-    0xff, 0x38, 0x01, 0xfe, 0x02, 0x26, 0x10, 0x22,
-    0x00, 0x5a, 0x00, 0x00, 0x11, 0x02, 0x00, 0x9f,
-    0x41, 0x00, 0x00, 0x5e, 0x4b, 0xb0, 0x15, 0x50,
-    0x58, 0x40, 0x20, 0x07, 0x01, 0x06, 0x01, 0x03,
-    0x01, 0x06, 0x72, 0x00, 0x04, 0x00, 0x05, 0x04,
-    0x05, 0x64, 0x02, 0x01, 0x00, 0x00, 0x3d, 0x4d,
-    0x00, 0x01, 0x01, 0x03, 0x61, 0x00, 0x03, 0x03,
-    0x43, 0x03, 0x4e, 0x1b, 0x40, 0x21, 0x07, 0x01,
-    0x06, 0x01, 0x03, 0x01, 0x06, 0x03, 0x80, 0x00,
-    0x04, 0x00, 0x05, 0x04, 0x05, 0x64, 0x02, 0x01,
-    0x00, 0x00, 0x3d, 0x4d, 0x00, 0x01, 0x01, 0x03,
-    0x61, 0x00, 0x03, 0x03, 0x43, 0x03, 0x4e, 0x59,
-    0x40, 0x0f, 0x11, 0x11, 0x11, 0x21, 0x11, 0x21,
-    0x21, 0x29, 0x23, 0x12, 0x22, 0x11, 0x08, 0x09,
-    0x27, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x58,
-    0xff, 0x42, 0x02, 0x10, 0x02, 0x30, 0x10, 0x22,
-    0x00, 0x2c, 0x00, 0x00, 0x11, 0x02, 0x00, 0x9e,
-    0x00, 0x00, 0x00, 0xa7, 0xb5, 0x23, 0x01, 0x09,
-    0x00, 0x01, 0x4c, 0x4b, 0xb0, 0x1c, 0x50, 0x58,
-    0x40, 0x3b, 0x00, 0x02, 0x03, 0x05, 0x03, 0x02,
-    0x05, 0x80, 0x00, 0x05, 0x04, 0x03, 0x05, 0x04,
-    0x7e, 0x00, 0x06, 0x04, 0x00, 0x04, 0x06, 0x72,
-    0x00, 0x09, 0x00, 0x08, 0x00, 0x09, 0x08, 0x80,
-    0x00, 0x08, 0x00, 0x07, 0x08, 0x07, 0x63, 0x00,
-    0x03, 0x03, 0x01, 0x61, 0x00, 0x01, 0x01, 0x45,
-    0x4d, 0x00, 0x04, 0x04, 0x00, 0x61, 0x0a, 0x01,
-    0x00, 0x00, 0x43, 0x00, 0x4e, 0x1b, 0x40, 0x3c,
-    0x00, 0x02, 0x03, 0x05, 0x03, 0x02, 0x05, 0x80,
-    0x00, 0x05, 0x04, 0x03, 0x05, 0x04, 0x7e, 0x00,
-    0x06, 0x04, 0x00, 0x04, 0x06, 0x00, 0x80, 0x00,
-    0x09, 0x00, 0x08, 0x00, 0x09, 0x08, 0x80, 0x00,
-    0x08, 0x00, 0x07, 0x08, 0x07, 0x63, 0x00, 0x03,
-    0x03, 0x01, 0x61, 0x00, 0x01, 0x01, 0x45, 0x4d,
-    0x00, 0x04, 0x04, 0x00, 0x61, 0x0a, 0x01, 0x00,
-    0x00, 0x43, 0x00, 0x4e, 0x59, 0x40, 0x1b, 0x02,
-    0x01, 0x34, 0x33, 0x2f, 0x2d, 0x2c, 0x2a, 0x22,
-    0x21, 0x1e, 0x1d, 0x1b, 0x19, 0x14, 0x12, 0x10,
-    0x0f, 0x0d, 0x0b, 0x01, 0x20, 0x02, 0x20, 0x0b,
-    0x09, 0x21, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x2c,
-    0x00, 0x00, 0x02, 0x2c, 0x03, 0xb2, 0x10, 0x22,
-    0x00, 0x11, 0x00, 0x00, 0x11, 0x03, 0x00, 0x92,
-    0x00, 0x00, 0x00, 0x96, 0x00, 0x31, 0x40, 0x2e,
-    0x10, 0x01, 0x04, 0x00, 0x01, 0x4c, 0x00, 0x05,
-    0x06, 0x05, 0x85, 0x00, 0x06, 0x00, 0x06, 0x85,
-    0x00, 0x04, 0x00, 0x02, 0x01, 0x04, 0x02, 0x68,
-    0x00, 0x00, 0x00, 0x3a, 0x4d, 0x03, 0x01, 0x01,
-    0x01, 0x3b, 0x01, 0x4e, 0x11, 0x1d, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x07, 0x09, 0x28, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0x2c, 0x00, 0x00, 0x02, 0x2c,
-    0x03, 0xbc, 0x10, 0x22, 0x00, 0x11, 0x00, 0x00,
-    0x11, 0x03, 0x00, 0x93, 0x00, 0x00, 0x00, 0xa0,
-    0x00, 0x31, 0x40, 0x2e, 0x10, 0x01, 0x04, 0x00,
-    0x01, 0x4c, 0x00, 0x06, 0x05, 0x06, 0x85, 0x00,
-    0x05, 0x00, 0x05, 0x85, 0x00, 0x04, 0x00, 0x02,
-    0x01, 0x04, 0x02, 0x68, 0x00, 0x00, 0x00, 0x3a,
-    0x4d, 0x03, 0x01, 0x01, 0x01, 0x3b, 0x01, 0x4e,
-    0x11, 0x1d, 0x11, 0x11, 0x11, 0x11, 0x11, 0x07,
-    0x09, 0x28, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x2c,
-    0x00, 0x00, 0x02, 0x2c, 0x03, 0xbb, 0x10, 0x22,
-    0x00, 0x11, 0x00, 0x00, 0x11, 0x03, 0x00, 0x9b,
-    0x00, 0x00, 0x00, 0xa0, 0x00, 0x33, 0x40, 0x30,
-    0x10, 0x01, 0x04, 0x00, 0x01, 0x4c, 0x00, 0x05,
-    0x06, 0x05, 0x85, 0x07, 0x01, 0x06, 0x00, 0x06,
-    0x85, 0x00, 0x04, 0x00, 0x02, 0x01, 0x04, 0x02,
-    0x68, 0x00, 0x00, 0x00, 0x3a, 0x4d, 0x03, 0x01,
-    0x01, 0x01, 0x3b, 0x01, 0x4e, 0x1d, 0x11, 0x1d,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x08, 0x09, 0x29,
-    0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x2c,
-    0x00, 0x00, 0x02, 0x2c, 0x03, 0xbb, 0x10, 0x22,
-    0x00, 0x11, 0x00, 0x00, 0x11, 0x03, 0x00, 0x8c,
-    0x00, 0x00, 0x00, 0xa0, 0x00, 0x89, 0xb5, 0x10,
-    0x01, 0x04, 0x00, 0x01, 0x4c, 0x4b, 0xb0, 0x2e,
-    0x50, 0x58, 0x40, 0x27, 0x0a, 0x01, 0x06, 0x00,
-    0x08, 0x05, 0x06, 0x08, 0x69, 0x0b, 0x01, 0x05,
-    0x09, 0x01, 0x07, 0x00, 0x05, 0x07, 0x6a, 0x00,
-    0x04, 0x00, 0x02, 0x01, 0x04, 0x02, 0x68, 0x00,
-    0x00, 0x00, 0x3a, 0x4d, 0x03, 0x01, 0x01, 0x01,
-    0x3b, 0x01, 0x4e, 0x1b, 0x40, 0x35, 0x00, 0x06,
-    0x0a, 0x08, 0x0a, 0x06, 0x08, 0x80, 0x00, 0x09,
-    0x05, 0x07, 0x05, 0x09, 0x07, 0x80, 0x00, 0x0a,
-    0x00, 0x08, 0x05, 0x0a, 0x08, 0x69, 0x0b, 0x01,
-    0x05, 0x00, 0x07, 0x00, 0x05, 0x07, 0x6a, 0x00,
-    0x04, 0x00, 0x02, 0x01, 0x04, 0x02, 0x68, 0x00,
-    0x00, 0x00, 0x3a, 0x4d, 0x03, 0x01, 0x01, 0x01,
-    0x3b, 0x01, 0x4e, 0x59, 0x40, 0x18, 0x18, 0x17,
-    0x2f, 0x2d, 0x2a, 0x29, 0x26, 0x24, 0x21, 0x1f,
-    0x1c, 0x1b, 0x17, 0x32, 0x18, 0x32, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x0c, 0x09, 0x26, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0x2c, 0x00, 0x00, 0x02, 0x2c,
-    0x03, 0xb3, 0x10, 0x22, 0x00, 0x11, 0x00, 0x00,
-    0x11, 0x03, 0x00, 0x99, 0x00, 0x00, 0x00, 0xa0,
-    0x00, 0x33, 0x40, 0x30, 0x10, 0x01, 0x04, 0x00,
-    0x01, 0x4c, 0x07, 0x01, 0x05, 0x08, 0x01, 0x06,
-    0x00, 0x05, 0x06, 0x69, 0x00, 0x04, 0x00, 0x02,
-    0x01, 0x04, 0x02, 0x68, 0x00, 0x00, 0x00, 0x3a,
-    0x4d, 0x03, 0x01, 0x01, 0x01, 0x3b, 0x01, 0x4e,
-    0x24, 0x24, 0x24, 0x2f, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x09, 0x09, 0x2a, 0x2b, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x2c, 0x00, 0x00, 0x02, 0x2c,
-    0x03, 0xd9, 0x10, 0x22, 0x00, 0x11, 0x00, 0x00,
-    0x11, 0x03, 0x00, 0x91, 0x00, 0x00, 0x00, 0xa0,
-    0x00, 0x3b, 0x40, 0x38, 0x10, 0x01, 0x04, 0x00,
-    0x01, 0x4c, 0x00, 0x07, 0x00, 0x06, 0x00, 0x07,
-    0x06, 0x69, 0x00, 0x04, 0x00, 0x02, 0x01, 0x04,
-    0x02, 0x68, 0x00, 0x08, 0x08, 0x05, 0x61, 0x00,
-    0x05, 0x05, 0x40, 0x4d, 0x00, 0x00, 0x00, 0x3a,
-    0x4d, 0x03, 0x01, 0x01, 0x01, 0x3b, 0x01, 0x4e,
-    0x24, 0x24, 0x24, 0x2f, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x09, 0x09, 0x2a, 0x2b, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x56, 0xff, 0x42, 0x02, 0x0e,
-    0x02, 0xda, 0x10, 0x22, 0x00, 0x13, 0x00, 0x00,
-    0x11, 0x02, 0x00, 0x9e, 0x00, 0x00, 0x00, 0xa7,
-    0xb5, 0x23, 0x01, 0x09, 0x05, 0x01, 0x4c, 0x4b,
-    0xb0, 0x1c, 0x50, 0x58, 0x40, 0x3b, 0x00, 0x01,
-    0x02, 0x04, 0x02, 0x01, 0x04, 0x80, 0x00, 0x04,
-    0x03, 0x02, 0x04, 0x03, 0x7e, 0x00, 0x06, 0x03,
-    0x05, 0x03, 0x06, 0x72, 0x00, 0x09, 0x05, 0x08,
-    0x05, 0x09, 0x08, 0x80, 0x00, 0x08, 0x00, 0x07,
-    0x08, 0x07, 0x63, 0x00, 0x02, 0x02, 0x00, 0x61,
-    0x0a, 0x01, 0x00, 0x00, 0x42, 0x4d, 0x00, 0x03,
-    0x03, 0x05, 0x61, 0x00, 0x05, 0x05, 0x43, 0x05,
-    0x4e, 0x1b, 0x40, 0x3c, 0x00, 0x01, 0x02, 0x04,
-    0x02, 0x01, 0x04, 0x80, 0x00, 0x04, 0x03, 0x02,
-    0x04, 0x03, 0x7e, 0x00, 0x06, 0x03, 0x05, 0x03,
-    0x06, 0x05, 0x80, 0x00, 0x09, 0x05, 0x08, 0x05,
-    0x09, 0x08, 0x80, 0x00, 0x08, 0x00, 0x07, 0x08,
-    0x07, 0x63, 0x00, 0x02, 0x02, 0x00, 0x61, 0x0a,
-    0x01, 0x00, 0x00, 0x42, 0x4d, 0x00, 0x03, 0x03,
-    0x05, 0x61, 0x00, 0x05, 0x05, 0x43, 0x05, 0x4e,
-    0x59, 0x40, 0x1b, 0x02, 0x01, 0x34, 0x33, 0x2f,
-    0x2d, 0x2c, 0x2a, 0x22, 0x21, 0x17, 0x15, 0x13,
-    0x12, 0x10, 0x0e, 0x09, 0x07, 0x05, 0x04, 0x01,
-    0x20, 0x02, 0x20, 0x0b, 0x09, 0x21, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0x5f, 0x00, 0x00, 0x02, 0x08,
-    0x03, 0xbc, 0x10, 0x22, 0x00, 0x15, 0x00, 0x00,
-    0x11, 0x03, 0x00, 0x92, 0x00, 0x00, 0x00, 0xa0,
-    0x00, 0x3d, 0x40, 0x3a, 0x00, 0x06, 0x07, 0x06,
-    0x85, 0x00, 0x07, 0x00, 0x07, 0x85, 0x00, 0x02,
-    0x00, 0x03, 0x04, 0x02, 0x03, 0x67, 0x00, 0x01,
-    0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x3a, 0x4d,
-    0x00, 0x04, 0x04, 0x05, 0x5f, 0x08, 0x01, 0x05,
-    0x05, 0x3b, 0x05, 0x4e, 0x01, 0x01, 0x10, 0x0f,
-    0x0e, 0x0d, 0x01, 0x0c, 0x01, 0x0c, 0x11, 0x11,
-    0x11, 0x11, 0x12, 0x09, 0x09, 0x26, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0x5f, 0x00, 0x00, 0x02, 0x08,
-    0x03, 0xbc, 0x10, 0x22, 0x00, 0x15, 0x00, 0x00,
-    0x11, 0x03, 0x00, 0x93, 0x00, 0x00, 0x00, 0xa0,
-    0x00, 0x3d, 0x40, 0x3a, 0x00, 0x07, 0x06, 0x07,
-    0x85, 0x00, 0x06, 0x00, 0x06, 0x85, 0x00, 0x02,
-    0x00, 0x03, 0x04, 0x02, 0x03, 0x67, 0x00, 0x01,
-    0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x3a, 0x4d,
-    0x00, 0x04, 0x04, 0x05, 0x5f, 0x08, 0x01, 0x05,
-    0x05, 0x3b, 0x05, 0x4e, 0x01, 0x01, 0x10, 0x0f,
-    0x0e, 0x0d, 0x01, 0x0c, 0x01, 0x0c, 0x11, 0x11,
-    0x11, 0x11, 0x12, 0x09, 0x09, 0x26, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0x5f, 0x00, 0x00, 0x02, 0x08,
-    0x03, 0xbb, 0x10, 0x22, 0x00, 0x15, 0x00, 0x00,
-    0x11, 0x03, 0x00, 0x9b, 0x00, 0x00, 0x00, 0xa0,
-    0x00, 0x40, 0x40, 0x3d, 0x00, 0x06, 0x07, 0x06,
-    0x85, 0x08, 0x01, 0x07, 0x00, 0x07, 0x85, 0x00,
-    0x02, 0x00, 0x03, 0x04, 0x02, 0x03, 0x67, 0x00,
-    0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x3a,
-    0x4d, 0x00, 0x04, 0x04, 0x05, 0x5f, 0x09, 0x01,
-    0x05, 0x05, 0x3b, 0x05, 0x4e, 0x01, 0x01, 0x1e,
-    0x1d, 0x10, 0x0f, 0x0e, 0x0d, 0x01, 0x0c, 0x01,
-    0x0c, 0x11, 0x11, 0x11, 0x11, 0x12, 0x0a, 0x09,
-    0x26, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x5f,
-    0x00, 0x00, 0x02, 0x08, 0x03, 0xb3, 0x10, 0x22,
-    0x00, 0x15, 0x00, 0x00, 0x11, 0x03, 0x00, 0x99,
-    0x00, 0x00, 0x00, 0xa0, 0x00, 0x41, 0x40, 0x3e,
-    0x08, 0x01, 0x06, 0x09, 0x01, 0x07, 0x00, 0x06,
-    0x07, 0x69, 0x00, 0x02, 0x00, 0x03, 0x04, 0x02,
-    0x03, 0x67, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00,
-    0x00, 0x00, 0x3a, 0x4d, 0x00, 0x04, 0x04, 0x05,
-    0x5f, 0x0a, 0x01, 0x05, 0x05, 0x3b, 0x05, 0x4e,
-    0x01, 0x01, 0x23, 0x21, 0x1d, 0x1b, 0x17, 0x15,
-    0x11, 0x0f, 0x01, 0x0c, 0x01, 0x0c, 0x11, 0x11,
-    0x11, 0x11, 0x12, 0x0b, 0x09, 0x26, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0x5f, 0x00, 0x00, 0x01, 0xf9,
-    0x03, 0xbc, 0x10, 0x22, 0x00, 0x18, 0x00, 0x00,
-    0x11, 0x03, 0x00, 0x92, 0x00, 0x00, 0x00, 0xa0,
-    0x00, 0x37, 0x40, 0x34, 0x00, 0x06, 0x07, 0x06,
-    0x85, 0x00, 0x07, 0x01, 0x07, 0x85, 0x02, 0x01,
-    0x00, 0x00, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x3a,
-    0x4d, 0x08, 0x05, 0x02, 0x03, 0x03, 0x04, 0x5f,
-    0x00, 0x04, 0x04, 0x3b, 0x04, 0x4e, 0x01, 0x01,
-    0x10, 0x0f, 0x0e, 0x0d, 0x01, 0x0c, 0x01, 0x0c,
-    0x11, 0x11, 0x11, 0x11, 0x12, 0x09, 0x09, 0x26,
-    0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x5f,
-    0x00, 0x00, 0x01, 0xf9, 0x03, 0xbc, 0x10, 0x22,
-    0x00, 0x18, 0x00, 0x00, 0x11, 0x03, 0x00, 0x93,
-    0x00, 0x00, 0x00, 0xa0, 0x00, 0x37, 0x40, 0x34,
-    0x00, 0x07, 0x06, 0x07, 0x85, 0x00, 0x06, 0x01,
-    0x06, 0x85, 0x02, 0x01, 0x00, 0x00, 0x01, 0x5f,
-    0x00, 0x01, 0x01, 0x3a, 0x4d, 0x08, 0x05, 0x02,
-    0x03, 0x03, 0x04, 0x5f, 0x00, 0x04, 0x04, 0x3b,
-    0x04, 0x4e, 0x01, 0x01, 0x10, 0x0f, 0x0e, 0x0d,
-    0x01, 0x0c, 0x01, 0x0c, 0x11, 0x11, 0x11, 0x11,
-    0x12, 0x09, 0x09, 0x26, 0x2b, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x5f, 0x00, 0x00, 0x01, 0xf9,
-    0x03, 0xbb, 0x10, 0x22, 0x00, 0x18, 0x00, 0x00,
-    0x11, 0x03, 0x00, 0x9b, 0x00, 0x00, 0x00, 0xa0,
-    0x00, 0x3a, 0x40, 0x37, 0x00, 0x06, 0x07, 0x06,
-    0x85, 0x08, 0x01, 0x07, 0x01, 0x07, 0x85, 0x02,
-    0x01, 0x00, 0x00, 0x01, 0x5f, 0x00, 0x01, 0x01,
-    0x3a, 0x4d, 0x09, 0x05, 0x02, 0x03, 0x03, 0x04,
-    0x5f, 0x00, 0x04, 0x04, 0x3b, 0x04, 0x4e, 0x01,
-    0x01, 0x1e, 0x1d, 0x10, 0x0f, 0x0e, 0x0d, 0x01,
-    0x0c, 0x01, 0x0c, 0x11, 0x11, 0x11, 0x11, 0x12,
-    0x0a, 0x09, 0x26, 0x2b, 0xff, 0xff, 0x00, 0x5f,
-    0x00, 0x00, 0x01, 0xf9, 0x03, 0xb3, 0x10, 0x22,
-    0x00, 0x18, 0x00, 0x00, 0x11, 0x03, 0x00, 0x99,
-    0x00, 0x00, 0x00, 0xa0, 0x00, 0x3b, 0x40, 0x38,
-    0x08, 0x01, 0x06, 0x09, 0x01, 0x07, 0x01, 0x06,
-    0x07, 0x69, 0x02, 0x01, 0x00, 0x00, 0x01, 0x5f,
-    0x00, 0x01, 0x01, 0x3a, 0x4d, 0x0a, 0x05, 0x02,
-    0x03, 0x03, 0x04, 0x5f, 0x00, 0x04, 0x04, 0x3b,
-    0x04, 0x4e, 0x01, 0x01, 0x23, 0x21, 0x1d, 0x1b,
-    0x17, 0x15, 0x11, 0x0f, 0x01, 0x0c, 0x01, 0x0c,
-    0x11, 0x11, 0x11, 0x11, 0x12, 0x0b, 0x09, 0x26,
-    0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x50,
-    0xff, 0xf6, 0x02, 0x08, 0x03, 0xbc, 0x10, 0x22,
-    0x00, 0x0b, 0x00, 0x00, 0x11, 0x03, 0x00, 0x92,
-    0x00, 0x00, 0x00, 0xa0, 0x00, 0x2b, 0x40, 0x28,
-    0x00, 0x04, 0x05, 0x04, 0x85, 0x00, 0x05, 0x02,
-    0x05, 0x85, 0x00, 0x01, 0x01, 0x02, 0x61, 0x00,
-    0x02, 0x02, 0x42, 0x4d, 0x00, 0x00, 0x00, 0x03,
-    0x61, 0x00, 0x03, 0x03, 0x43, 0x03, 0x4e, 0x11,
-    0x15, 0x29, 0x27, 0x25, 0x23, 0x06, 0x09, 0x27,
-    0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x50,
-    0xff, 0xf6, 0x02, 0x08, 0x03, 0xbc, 0x10, 0x22,
-    0x00, 0x0b, 0x00, 0x00, 0x11, 0x03, 0x00, 0x93,
-    0x00, 0x00, 0x00, 0xa0, 0x00, 0x2b, 0x40, 0x28,
-    0x00, 0x05, 0x04, 0x05, 0x85, 0x00, 0x04, 0x02,
-    0x04, 0x85, 0x00, 0x01, 0x01, 0x02, 0x61, 0x00,
-    0x02, 0x02, 0x42, 0x4d, 0x00, 0x00, 0x00, 0x03,
-    0x61, 0x00, 0x03, 0x03, 0x43, 0x03, 0x4e, 0x11,
-    0x15, 0x29, 0x27, 0x25, 0x23, 0x06, 0x09, 0x27,
-    0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x50,
-    0xff, 0xf6, 0x02, 0x08, 0x03, 0xbb, 0x10, 0x22,
-    0x00, 0x0b, 0x00, 0x00, 0x11, 0x03, 0x00, 0x9b,
-    0x00, 0x00, 0x00, 0xa0, 0x00, 0x2d, 0x40, 0x2a,
-    0x00, 0x04, 0x05, 0x04, 0x85, 0x06, 0x01, 0x05,
-    0x02, 0x05, 0x85, 0x00, 0x01, 0x01, 0x02, 0x61,
-    0x00, 0x02, 0x02, 0x42, 0x4d, 0x00, 0x00, 0x00,
-    0x03, 0x61, 0x00, 0x03, 0x03, 0x43, 0x03, 0x4e,
-    0x1d, 0x11, 0x15, 0x29, 0x27, 0x25, 0x23, 0x07,
-    0x09, 0x28, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x50,
-    0xff, 0xf6, 0x02, 0x08, 0x03, 0xbb, 0x10, 0x22,
-    0x00, 0x0b, 0x00, 0x00, 0x11, 0x03, 0x00, 0x8c,
-    0x00, 0x00, 0x00, 0xa0, 0x00, 0x83, 0x4b, 0xb0,
-    0x2e, 0x50, 0x58, 0x40, 0x28, 0x09, 0x01, 0x05,
-    0x00, 0x07, 0x04, 0x05, 0x07, 0x69, 0x0a, 0x01,
-    0x04, 0x08, 0x01, 0x06, 0x02, 0x04, 0x06, 0x6a,
-    0x00, 0x01, 0x01, 0x02, 0x61, 0x00, 0x02, 0x02,
-    0x42, 0x4d, 0x00, 0x00, 0x00, 0x03, 0x61, 0x00,
-    0x03, 0x03, 0x43, 0x03, 0x4e, 0x1b, 0x40, 0x36,
-    0x00, 0x05, 0x09, 0x07, 0x09, 0x05, 0x07, 0x80,
-    0x00, 0x08, 0x04, 0x06, 0x04, 0x08, 0x06, 0x80,
-    0x00, 0x09, 0x00, 0x07, 0x04, 0x09, 0x07, 0x69,
-    0x0a, 0x01, 0x04, 0x00, 0x06, 0x02, 0x04, 0x06,
-    0x6a, 0x00, 0x01, 0x01, 0x02, 0x61, 0x00, 0x02,
-    0x02, 0x42, 0x4d, 0x00, 0x00, 0x00, 0x03, 0x61,
-    0x00, 0x03, 0x03, 0x43, 0x03, 0x4e, 0x59, 0x40,
-    0x17, 0x26, 0x25, 0x3d, 0x3b, 0x38, 0x37, 0x34,
-    0x32, 0x2f, 0x2d, 0x2a, 0x29, 0x25, 0x40, 0x26,
-    0x40, 0x29, 0x27, 0x25, 0x23, 0x0b, 0x09, 0x25,
-    0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x50,
-    0xff, 0xf6, 0x02, 0x08, 0x03, 0xb3, 0x10, 0x22,
-    0x00, 0x0b, 0x00, 0x00, 0x11, 0x03, 0x00, 0x99,
-    0x00, 0x00, 0x00, 0xa0, 0x00, 0x2d, 0x40, 0x2a,
-    0x06, 0x01, 0x04, 0x07, 0x01, 0x05, 0x02, 0x04,
-    0x05, 0x69, 0x00, 0x01, 0x01, 0x02, 0x61, 0x00,
-    0x02, 0x02, 0x42, 0x4d, 0x00, 0x00, 0x00, 0x03,
-    0x61, 0x00, 0x03, 0x03, 0x43, 0x03, 0x4e, 0x24,
-    0x24, 0x24, 0x27, 0x29, 0x27, 0x25, 0x23, 0x08,
-    0x09, 0x29, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x46,
-    0xff, 0xf6, 0x02, 0x12, 0x03, 0xbb, 0x10, 0x22,
-    0x00, 0x21, 0x00, 0x00, 0x11, 0x03, 0x00, 0x9c,
-    0x00, 0x00, 0x00, 0xa0, 0x00, 0x4b, 0x40, 0x48,
-    0x00, 0x08, 0x06, 0x03, 0x06, 0x08, 0x03, 0x80,
-    0x00, 0x01, 0x04, 0x02, 0x04, 0x01, 0x02, 0x80,
-    0x07, 0x01, 0x06, 0x00, 0x04, 0x01, 0x06, 0x04,
-    0x67, 0x00, 0x05, 0x05, 0x03, 0x61, 0x00, 0x03,
-    0x03, 0x42, 0x4d, 0x00, 0x02, 0x02, 0x00, 0x61,
-    0x09, 0x01, 0x00, 0x00, 0x43, 0x00, 0x4e, 0x02,
-    0x01, 0x41, 0x40, 0x3f, 0x3e, 0x31, 0x30, 0x24,
-    0x22, 0x1e, 0x1d, 0x19, 0x17, 0x0d, 0x0b, 0x07,
-    0x06, 0x01, 0x2f, 0x02, 0x2f, 0x0a, 0x09, 0x21,
-    0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x55,
-    0xff, 0xf6, 0x02, 0x03, 0x03, 0xbc, 0x10, 0x22,
-    0x00, 0x23, 0x00, 0x00, 0x11, 0x03, 0x00, 0x92,
-    0x00, 0x00, 0x00, 0xa0, 0x00, 0x32, 0x40, 0x2f,
-    0x00, 0x04, 0x05, 0x04, 0x85, 0x00, 0x05, 0x01,
-    0x05, 0x85, 0x03, 0x01, 0x01, 0x01, 0x3a, 0x4d,
-    0x00, 0x02, 0x02, 0x00, 0x61, 0x06, 0x01, 0x00,
-    0x00, 0x43, 0x00, 0x4e, 0x02, 0x01, 0x16, 0x15,
-    0x14, 0x13, 0x0f, 0x0e, 0x0b, 0x09, 0x06, 0x05,
-    0x01, 0x12, 0x02, 0x12, 0x07, 0x09, 0x21, 0x2b,
-    0xff, 0xff, 0x00, 0x55, 0xff, 0xf6, 0x02, 0x03,
-    0x03, 0xbc, 0x10, 0x22, 0x00, 0x23, 0x00, 0x00,
-    0x11, 0x03, 0x00, 0x93, 0x00, 0x00, 0x00, 0xa0,
-    0x00, 0x32, 0x40, 0x2f, 0x00, 0x05, 0x04, 0x05,
-    0x85, 0x00, 0x04, 0x01, 0x04, 0x85, 0x03, 0x01,
-    0x01, 0x01, 0x3a, 0x4d, 0x00, 0x02, 0x02, 0x00,
-    0x61, 0x06, 0x01, 0x00, 0x00, 0x43, 0x00, 0x4e,
-    0x02, 0x01, 0x16, 0x15, 0x14, 0x13, 0x0f, 0x0e,
-    0x0b, 0x09, 0x06, 0x05, 0x01, 0x12, 0x02, 0x12,
-    0x07, 0x09, 0x21, 0x2b, 0xff, 0xff, 0x00, 0x55,
-    0xff, 0xf6, 0x02, 0x03, 0x03, 0xbb, 0x10, 0x22,
-    0x00, 0x23, 0x00, 0x00, 0x11, 0x03, 0x00, 0x9b,
-    0x00, 0x00, 0x00, 0xa0, 0x00, 0x35, 0x40, 0x32,
-    0x00, 0x04, 0x05, 0x04, 0x85, 0x06, 0x01, 0x05,
-    0x01, 0x05, 0x85, 0x03, 0x01, 0x01, 0x01, 0x3a,
-    0x4d, 0x00, 0x02, 0x02, 0x00, 0x61, 0x07, 0x01,
-    0x00, 0x00, 0x43, 0x00, 0x4e, 0x02, 0x01, 0x24,
-    0x23, 0x16, 0x15, 0x14, 0x13, 0x0f, 0x0e, 0x0b,
-    0x09, 0x06, 0x05, 0x01, 0x12, 0x02, 0x12, 0x08,
-    0x09, 0x21, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x55,
-    0xff, 0xf6, 0x02, 0x03, 0x03, 0xb3, 0x10, 0x22,
-    0x00, 0x23, 0x00, 0x00, 0x11, 0x03, 0x00, 0x99,
-    0x00, 0x00, 0x00, 0xa0, 0x00, 0x36, 0x40, 0x33,
-    0x06, 0x01, 0x04, 0x07, 0x01, 0x05, 0x01, 0x04,
-    0x05, 0x69, 0x03, 0x01, 0x01, 0x01, 0x3a, 0x4d,
-    0x00, 0x02, 0x02, 0x00, 0x61, 0x08, 0x01, 0x00,
-    0x00, 0x43, 0x00, 0x4e, 0x02, 0x01, 0x29, 0x27,
-    0x23, 0x21, 0x1d, 0x1b, 0x17, 0x15, 0x0f, 0x0e,
-    0x0b, 0x09, 0x06, 0x05, 0x01, 0x12, 0x02, 0x12,
-    0x09, 0x09, 0x21, 0x2b, 0xff, 0xff, 0x00, 0x1e,
-    0x00, 0x00, 0x02, 0x3a, 0x03, 0xb3, 0x10, 0x22,
-    0x00, 0x27, 0x00, 0x00, 0x11, 0x03, 0x00, 0x99,
-    0x00, 0x00, 0x00, 0xa0, 0x00, 0x2b, 0x40, 0x28,
-    0x14, 0x11, 0x08, 0x03, 0x02, 0x00, 0x01, 0x4c,
-    0x05, 0x01, 0x03, 0x06, 0x01, 0x04, 0x00, 0x03,
-    0x04, 0x69, 0x01, 0x01, 0x00, 0x00, 0x3a, 0x4d,
-    0x00, 0x02, 0x02, 0x3b, 0x02, 0x4e, 0x24, 0x24,
-    0x24, 0x24, 0x12, 0x1d, 0x11, 0x07, 0x09, 0x28,
-    0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x1e,
-    0x00, 0x00, 0x02, 0x3a, 0x03, 0xbc, 0x10, 0x22,
-    0x00, 0x27, 0x00, 0x00, 0x11, 0x03, 0x00, 0x93,
-    0x00, 0x00, 0x00, 0xa0, 0x00, 0x29, 0x40, 0x26,
-    0x14, 0x11, 0x08, 0x03, 0x02, 0x00, 0x01, 0x4c,
-    0x00, 0x04, 0x03, 0x04, 0x85, 0x00, 0x03, 0x00,
-    0x03, 0x85, 0x01, 0x01, 0x00, 0x00, 0x3a, 0x4d,
-    0x00, 0x02, 0x02, 0x3b, 0x02, 0x4e, 0x11, 0x12,
-    0x12, 0x1d, 0x11, 0x05, 0x09, 0x26, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0x55, 0x00, 0x00, 0x02, 0x03,
-    0x03, 0xbb, 0x10, 0x22, 0x00, 0x28, 0x00, 0x00,
-    0x11, 0x03, 0x00, 0x9c, 0x00, 0x00, 0x00, 0xa0,
-    0x00, 0x3d, 0x40, 0x3a, 0x09, 0x02, 0x02, 0x00,
-    0x02, 0x01, 0x4c, 0x05, 0x01, 0x04, 0x06, 0x04,
-    0x85, 0x00, 0x06, 0x03, 0x06, 0x85, 0x00, 0x02,
-    0x02, 0x03, 0x5f, 0x07, 0x01, 0x03, 0x03, 0x3a,
-    0x4d, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x00, 0x01,
-    0x01, 0x3b, 0x01, 0x4e, 0x01, 0x01, 0x20, 0x1f,
-    0x1e, 0x1d, 0x10, 0x0f, 0x01, 0x0e, 0x01, 0x0e,
-    0x32, 0x11, 0x33, 0x08, 0x09, 0x24, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0x3f, 0xff, 0xf6, 0x02, 0x00,
-    0x03, 0x1c, 0x10, 0x22, 0x00, 0x2a, 0x00, 0x00,
-    0x11, 0x02, 0x00, 0x93, 0x00, 0x00, 0x00, 0x90,
-    0xb5, 0x18, 0x01, 0x06, 0x07, 0x01, 0x4c, 0x4b,
-    0xb0, 0x18, 0x50, 0x58, 0x40, 0x31, 0x00, 0x09,
-    0x08, 0x09, 0x85, 0x00, 0x08, 0x03, 0x08, 0x85,
-    0x00, 0x02, 0x01, 0x00, 0x01, 0x02, 0x00, 0x80,
-    0x00, 0x00, 0x00, 0x07, 0x06, 0x00, 0x07, 0x67,
-    0x00, 0x01, 0x01, 0x03, 0x61, 0x00, 0x03, 0x03,
-    0x45, 0x4d, 0x0a, 0x01, 0x06, 0x06, 0x04, 0x61,
-    0x05, 0x01, 0x04, 0x04, 0x3b, 0x04, 0x4e, 0x1b,
-    0x40, 0x35, 0x00, 0x09, 0x08, 0x09, 0x85, 0x00,
-    0x08, 0x03, 0x08, 0x85, 0x00, 0x02, 0x01, 0x00,
-    0x01, 0x02, 0x00, 0x80, 0x00, 0x00, 0x00, 0x07,
-    0x06, 0x00, 0x07, 0x67, 0x00, 0x01, 0x01, 0x03,
-    0x61, 0x00, 0x03, 0x03, 0x45, 0x4d, 0x00, 0x04,
-    0x04, 0x3b, 0x4d, 0x0a, 0x01, 0x06, 0x06, 0x05,
-    0x61, 0x00, 0x05, 0x05, 0x43, 0x05, 0x4e, 0x59,
-    0x40, 0x15, 0x20, 0x1f, 0x2f, 0x2e, 0x2d, 0x2c,
-    0x27, 0x25, 0x1f, 0x2b, 0x20, 0x2b, 0x24, 0x13,
-    0x22, 0x12, 0x23, 0x25, 0x0b, 0x09, 0x27, 0x2b,
-    0xff, 0xff, 0x00, 0x3f, 0xff, 0xf6, 0x02, 0x00,
-    0x03, 0x1b, 0x10, 0x22, 0x00, 0x2a, 0x00, 0x00,
-    0x11, 0x02, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x94,
-    0xb5, 0x18, 0x01, 0x06, 0x07, 0x01, 0x4c, 0x4b,
-    0xb0, 0x18, 0x50, 0x58, 0x40, 0x32, 0x00, 0x08,
-    0x09, 0x08, 0x85, 0x0a, 0x01, 0x09, 0x03, 0x09,
-    0x85, 0x00, 0x02, 0x01, 0x00, 0x01, 0x02, 0x00,
-    0x80, 0x00, 0x00, 0x00, 0x07, 0x06, 0x00, 0x07,
-    0x67, 0x00, 0x01, 0x01, 0x03, 0x61, 0x00, 0x03,
-    0x03, 0x45, 0x4d, 0x0b, 0x01, 0x06, 0x06, 0x04,
-    0x61, 0x05, 0x01, 0x04, 0x04, 0x3b, 0x04, 0x4e,
-    0x1b, 0x40, 0x36, 0x00, 0x08, 0x09, 0x08, 0x85,
-    0x0a, 0x01, 0x09, 0x03, 0x09, 0x85, 0x00, 0x02,
-    0x01, 0x00, 0x01, 0x02, 0x00, 0x80, 0x00, 0x00,
-    0x00, 0x07, 0x06, 0x00, 0x07, 0x67, 0x00, 0x01,
-    0x01, 0x03, 0x61, 0x00, 0x03, 0x03, 0x45, 0x4d,
-    0x00, 0x04, 0x04, 0x3b, 0x4d, 0x0b, 0x01, 0x06,
-    0x06, 0x05, 0x61, 0x00, 0x05, 0x05, 0x43, 0x05,
-    0x4e, 0x59, 0x40, 0x17, 0x20, 0x1f, 0x3d, 0x3c,
-    0x2f, 0x2e, 0x2d, 0x2c, 0x27, 0x25, 0x1f, 0x2b,
-    0x20, 0x2b, 0x24, 0x13, 0x22, 0x12, 0x23, 0x25,
-    0x0c, 0x09, 0x27, 0x2b, 0xff, 0xff, 0x00, 0x3f,
-    0xff, 0xf6, 0x02, 0x00, 0x03, 0x1b, 0x10, 0x22,
-    0x00, 0x2a, 0x00, 0x00, 0x11, 0x02, 0x00, 0x8c,
-    0x00, 0x00, 0x01, 0x09, 0xb5, 0x18, 0x01, 0x06,
-    0x07, 0x01, 0x4c, 0x4b, 0xb0, 0x18, 0x50, 0x58,
-    0x40, 0x3c, 0x00, 0x02, 0x01, 0x00, 0x01, 0x02,
-    0x00, 0x80, 0x0d, 0x01, 0x09, 0x00, 0x0b, 0x08,
-    0x09, 0x0b, 0x69, 0x00, 0x00, 0x00, 0x07, 0x06,
-    0x00, 0x07, 0x67, 0x0c, 0x01, 0x0a, 0x0a, 0x08,
-    0x61, 0x0f, 0x01, 0x08, 0x08, 0x3a, 0x4d, 0x00,
-    0x01, 0x01, 0x03, 0x61, 0x00, 0x03, 0x03, 0x45,
-    0x4d, 0x0e, 0x01, 0x06, 0x06, 0x04, 0x61, 0x05,
-    0x01, 0x04, 0x04, 0x3b, 0x04, 0x4e, 0x1b, 0x4b,
-    0xb0, 0x2e, 0x50, 0x58, 0x40, 0x40, 0x00, 0x02,
-    0x01, 0x00, 0x01, 0x02, 0x00, 0x80, 0x0d, 0x01,
-    0x09, 0x00, 0x0b, 0x08, 0x09, 0x0b, 0x69, 0x00,
-    0x00, 0x00, 0x07, 0x06, 0x00, 0x07, 0x67, 0x0c,
-    0x01, 0x0a, 0x0a, 0x08, 0x61, 0x0f, 0x01, 0x08,
-    0x08, 0x3a, 0x4d, 0x00, 0x01, 0x01, 0x03, 0x61,
-    0x00, 0x03, 0x03, 0x45, 0x4d, 0x00, 0x04, 0x04,
-    0x3b, 0x4d, 0x0e, 0x01, 0x06, 0x06, 0x05, 0x61,
-    0x00, 0x05, 0x05, 0x43, 0x05, 0x4e, 0x1b, 0x40,
-    0x4e, 0x00, 0x09, 0x0d, 0x0b, 0x0d, 0x09, 0x0b,
-    0x80, 0x00, 0x0c, 0x08, 0x0a, 0x08, 0x0c, 0x0a,
-    0x80, 0x00, 0x02, 0x01, 0x00, 0x01, 0x02, 0x00,
-    0x80, 0x00, 0x0d, 0x00, 0x0b, 0x08, 0x0d, 0x0b,
-    0x69, 0x00, 0x00, 0x00, 0x07, 0x06, 0x00, 0x07,
-    0x67, 0x00, 0x0a, 0x0a, 0x08, 0x61, 0x0f, 0x01,
-    0x08, 0x08, 0x3a, 0x4d, 0x00, 0x01, 0x01, 0x03,
-    0x61, 0x00, 0x03, 0x03, 0x45, 0x4d, 0x00, 0x04,
-    0x04, 0x3b, 0x4d, 0x0e, 0x01, 0x06, 0x06, 0x05,
-    0x61, 0x00, 0x05, 0x05, 0x43, 0x05, 0x4e, 0x59,
-    0x59, 0x40, 0x21, 0x2d, 0x2c, 0x20, 0x1f, 0x44,
-    0x42, 0x3f, 0x3e, 0x3b, 0x39, 0x36, 0x34, 0x31,
-    0x30, 0x2c, 0x47, 0x2d, 0x47, 0x27, 0x25, 0x1f,
-    0x2b, 0x20, 0x2b, 0x24, 0x13, 0x22, 0x12, 0x23,
-    0x25, 0x10, 0x09, 0x27, 0x2b, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x3f, 0xff, 0xf6, 0x02, 0x00,
-    0x03, 0x39, 0x10, 0x22, 0x00, 0x2a, 0x00, 0x00,
-    0x11, 0x02, 0x00, 0x91, 0x00, 0x00, 0x00, 0xa0,
-    0xb5, 0x18, 0x01, 0x06, 0x07, 0x01, 0x4c, 0x4b,
-    0xb0, 0x18, 0x50, 0x58, 0x40, 0x37, 0x00, 0x02,
-    0x01, 0x00, 0x01, 0x02, 0x00, 0x80, 0x00, 0x08,
-    0x00, 0x0b, 0x0a, 0x08, 0x0b, 0x69, 0x00, 0x0a,
-    0x00, 0x09, 0x03, 0x0a, 0x09, 0x69, 0x00, 0x00,
-    0x00, 0x07, 0x06, 0x00, 0x07, 0x67, 0x00, 0x01,
-    0x01, 0x03, 0x61, 0x00, 0x03, 0x03, 0x45, 0x4d,
-    0x0c, 0x01, 0x06, 0x06, 0x04, 0x61, 0x05, 0x01,
-    0x04, 0x04, 0x3b, 0x04, 0x4e, 0x1b, 0x40, 0x3b,
-    0x00, 0x02, 0x01, 0x00, 0x01, 0x02, 0x00, 0x80,
-    0x00, 0x08, 0x00, 0x0b, 0x0a, 0x08, 0x0b, 0x69,
-    0x00, 0x0a, 0x00, 0x09, 0x03, 0x0a, 0x09, 0x69,
-    0x00, 0x00, 0x00, 0x07, 0x06, 0x00, 0x07, 0x67,
-    0x00, 0x01, 0x01, 0x03, 0x61, 0x00, 0x03, 0x03,
-    0x45, 0x4d, 0x00, 0x04, 0x04, 0x3b, 0x4d, 0x0c,
-    0x01, 0x06, 0x06, 0x05, 0x61, 0x00, 0x05, 0x05,
-    0x43, 0x05, 0x4e, 0x59, 0x40, 0x19, 0x20, 0x1f,
-    0x42, 0x40, 0x3c, 0x3a, 0x36, 0x34, 0x30, 0x2e,
-    0x27, 0x25, 0x1f, 0x2b, 0x20, 0x2b, 0x24, 0x13,
-    0x22, 0x12, 0x23, 0x25, 0x0d, 0x09, 0x27, 0x2b,
-    0xff, 0xff, 0x00, 0x50, 0xff, 0xf6, 0x02, 0x08,
-    0x03, 0x1c, 0x10, 0x22, 0x00, 0x2d, 0x00, 0x00,
-    0x11, 0x02, 0x00, 0x92, 0x00, 0x00, 0x00, 0x51,
-    0x40, 0x4e, 0x00, 0x07, 0x08, 0x07, 0x85, 0x00,
-    0x08, 0x01, 0x08, 0x85, 0x00, 0x04, 0x02, 0x03,
-    0x02, 0x04, 0x03, 0x80, 0x0a, 0x01, 0x06, 0x00,
-    0x02, 0x04, 0x06, 0x02, 0x67, 0x00, 0x05, 0x05,
-    0x01, 0x61, 0x00, 0x01, 0x01, 0x45, 0x4d, 0x00,
-    0x03, 0x03, 0x00, 0x61, 0x09, 0x01, 0x00, 0x00,
-    0x43, 0x00, 0x4e, 0x18, 0x18, 0x02, 0x01, 0x24,
-    0x23, 0x22, 0x21, 0x18, 0x20, 0x18, 0x20, 0x1d,
-    0x1b, 0x15, 0x14, 0x12, 0x10, 0x0d, 0x0c, 0x09,
-    0x07, 0x01, 0x17, 0x02, 0x17, 0x0b, 0x09, 0x21,
-    0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x50,
-    0xff, 0xf6, 0x02, 0x08, 0x03, 0x1c, 0x10, 0x22,
-    0x00, 0x2d, 0x00, 0x00, 0x11, 0x02, 0x00, 0x93,
-    0x00, 0x00, 0x00, 0x51, 0x40, 0x4e, 0x00, 0x08,
-    0x07, 0x08, 0x85, 0x00, 0x07, 0x01, 0x07, 0x85,
-    0x00, 0x04, 0x02, 0x03, 0x02, 0x04, 0x03, 0x80,
-    0x0a, 0x01, 0x06, 0x00, 0x02, 0x04, 0x06, 0x02,
-    0x67, 0x00, 0x05, 0x05, 0x01, 0x61, 0x00, 0x01,
-    0x01, 0x45, 0x4d, 0x00, 0x03, 0x03, 0x00, 0x61,
-    0x09, 0x01, 0x00, 0x00, 0x43, 0x00, 0x4e, 0x18,
-    0x18, 0x02, 0x01, 0x24, 0x23, 0x22, 0x21, 0x18,
-    0x20, 0x18, 0x20, 0x1d, 0x1b, 0x15, 0x14, 0x12,
-    0x10, 0x0d, 0x0c, 0x09, 0x07, 0x01, 0x17, 0x02,
-    0x17, 0x0b, 0x09, 0x21, 0x2b, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x50, 0xff, 0xf6, 0x02, 0x08,
-    0x03, 0x1b, 0x10, 0x22, 0x00, 0x2d, 0x00, 0x00,
-    0x11, 0x02, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x54,
-    0x40, 0x51, 0x00, 0x07, 0x08, 0x07, 0x85, 0x09,
-    0x01, 0x08, 0x01, 0x08, 0x85, 0x00, 0x04, 0x02,
-    0x03, 0x02, 0x04, 0x03, 0x80, 0x0b, 0x01, 0x06,
-    0x00, 0x02, 0x04, 0x06, 0x02, 0x67, 0x00, 0x05,
-    0x05, 0x01, 0x61, 0x00, 0x01, 0x01, 0x45, 0x4d,
-    0x00, 0x03, 0x03, 0x00, 0x61, 0x0a, 0x01, 0x00,
-    0x00, 0x43, 0x00, 0x4e, 0x18, 0x18, 0x02, 0x01,
-    0x32, 0x31, 0x24, 0x23, 0x22, 0x21, 0x18, 0x20,
-    0x18, 0x20, 0x1d, 0x1b, 0x15, 0x14, 0x12, 0x10,
-    0x0d, 0x0c, 0x09, 0x07, 0x01, 0x17, 0x02, 0x17,
-    0x0c, 0x09, 0x21, 0x2b, 0xff, 0xff, 0x00, 0x50,
-    0xff, 0xf6, 0x02, 0x08, 0x03, 0x13, 0x10, 0x22,
-    0x00, 0x2d, 0x00, 0x00, 0x11, 0x02, 0x00, 0x99,
-    0x00, 0x00, 0x00, 0x93, 0x4b, 0xb0, 0x17, 0x50,
-    0x58, 0x40, 0x33, 0x00, 0x04, 0x02, 0x03, 0x02,
-    0x04, 0x03, 0x80, 0x0c, 0x01, 0x06, 0x00, 0x02,
-    0x04, 0x06, 0x02, 0x67, 0x0a, 0x01, 0x08, 0x08,
-    0x07, 0x61, 0x09, 0x01, 0x07, 0x07, 0x44, 0x4d,
-    0x00, 0x05, 0x05, 0x01, 0x61, 0x00, 0x01, 0x01,
-    0x45, 0x4d, 0x00, 0x03, 0x03, 0x00, 0x61, 0x0b,
-    0x01, 0x00, 0x00, 0x43, 0x00, 0x4e, 0x1b, 0x40,
-    0x31, 0x00, 0x04, 0x02, 0x03, 0x02, 0x04, 0x03,
-    0x80, 0x09, 0x01, 0x07, 0x0a, 0x01, 0x08, 0x01,
-    0x07, 0x08, 0x69, 0x0c, 0x01, 0x06, 0x00, 0x02,
-    0x04, 0x06, 0x02, 0x67, 0x00, 0x05, 0x05, 0x01,
-    0x61, 0x00, 0x01, 0x01, 0x45, 0x4d, 0x00, 0x03,
-    0x03, 0x00, 0x61, 0x0b, 0x01, 0x00, 0x00, 0x43,
-    0x00, 0x4e, 0x59, 0x40, 0x21, 0x18, 0x18, 0x02,
-    0x01, 0x37, 0x35, 0x31, 0x2f, 0x2b, 0x29, 0x25,
-    0x23, 0x18, 0x20, 0x18, 0x20, 0x1d, 0x1b, 0x15,
-    0x14, 0x12, 0x10, 0x0d, 0x0c, 0x09, 0x07, 0x01,
-    0x17, 0x02, 0x17, 0x0d, 0x09, 0x21, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0x5a, 0x00, 0x00, 0x02, 0x21,
-    0x03, 0x1c, 0x10, 0x22, 0x00, 0x7a, 0x00, 0x00,
-    0x11, 0x02, 0x00, 0x92, 0x00, 0x00, 0x00, 0x2d,
-    0x40, 0x2a, 0x00, 0x05, 0x06, 0x05, 0x85, 0x00,
-    0x06, 0x02, 0x06, 0x85, 0x00, 0x01, 0x01, 0x02,
-    0x5f, 0x00, 0x02, 0x02, 0x3d, 0x4d, 0x03, 0x01,
-    0x00, 0x00, 0x04, 0x5f, 0x00, 0x04, 0x04, 0x3b,
-    0x04, 0x4e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x07, 0x09, 0x28, 0x2b, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x5a, 0x00, 0x00, 0x02, 0x21,
-    0x03, 0x1c, 0x10, 0x22, 0x00, 0x7a, 0x00, 0x00,
-    0x11, 0x02, 0x00, 0x93, 0x00, 0x00, 0x00, 0x2d,
-    0x40, 0x2a, 0x00, 0x06, 0x05, 0x06, 0x85, 0x00,
-    0x05, 0x02, 0x05, 0x85, 0x00, 0x01, 0x01, 0x02,
-    0x5f, 0x00, 0x02, 0x02, 0x3d, 0x4d, 0x03, 0x01,
-    0x00, 0x00, 0x04, 0x60, 0x00, 0x04, 0x04, 0x3b,
-    0x04, 0x4e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x07, 0x09, 0x28, 0x2b, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x5a, 0x00, 0x00, 0x02, 0x21,
-    0x03, 0x1b, 0x10, 0x22, 0x00, 0x7a, 0x00, 0x00,
-    0x11, 0x02, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x2f,
-    0x40, 0x2c, 0x00, 0x05, 0x06, 0x05, 0x85, 0x07,
-    0x01, 0x06, 0x02, 0x06, 0x85, 0x00, 0x01, 0x01,
-    0x02, 0x5f, 0x00, 0x02, 0x02, 0x3d, 0x4d, 0x03,
-    0x01, 0x00, 0x00, 0x04, 0x5f, 0x00, 0x04, 0x04,
-    0x3b, 0x04, 0x4e, 0x1d, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x08, 0x09, 0x29, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0x5a, 0x00, 0x00, 0x02, 0x21,
-    0x03, 0x13, 0x10, 0x22, 0x00, 0x7a, 0x00, 0x00,
-    0x11, 0x02, 0x00, 0x99, 0x00, 0x00, 0x00, 0x5c,
-    0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x22, 0x08,
-    0x01, 0x06, 0x06, 0x05, 0x61, 0x07, 0x01, 0x05,
-    0x05, 0x44, 0x4d, 0x00, 0x01, 0x01, 0x02, 0x5f,
-    0x00, 0x02, 0x02, 0x3d, 0x4d, 0x03, 0x01, 0x00,
-    0x00, 0x04, 0x5f, 0x00, 0x04, 0x04, 0x3b, 0x04,
-    0x4e, 0x1b, 0x40, 0x20, 0x07, 0x01, 0x05, 0x08,
-    0x01, 0x06, 0x02, 0x05, 0x06, 0x69, 0x00, 0x01,
-    0x01, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x3d, 0x4d,
-    0x03, 0x01, 0x00, 0x00, 0x04, 0x5f, 0x00, 0x04,
-    0x04, 0x3b, 0x04, 0x4e, 0x59, 0x40, 0x0c, 0x24,
-    0x24, 0x24, 0x23, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x09, 0x09, 0x2a, 0x2b, 0xff, 0xff, 0x00, 0x50,
-    0xff, 0xf6, 0x02, 0x08, 0x03, 0x1c, 0x10, 0x22,
-    0x00, 0x08, 0x00, 0x00, 0x11, 0x02, 0x00, 0x92,
-    0x00, 0x00, 0x00, 0x2b, 0x40, 0x28, 0x00, 0x04,
-    0x05, 0x04, 0x85, 0x00, 0x05, 0x02, 0x05, 0x85,
-    0x00, 0x01, 0x01, 0x02, 0x61, 0x00, 0x02, 0x02,
-    0x45, 0x4d, 0x00, 0x00, 0x00, 0x03, 0x61, 0x00,
-    0x03, 0x03, 0x43, 0x03, 0x4e, 0x11, 0x15, 0x27,
-    0x27, 0x25, 0x23, 0x06, 0x09, 0x27, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0x50, 0xff, 0xf6, 0x02, 0x08,
-    0x03, 0x1c, 0x10, 0x22, 0x00, 0x08, 0x00, 0x00,
-    0x11, 0x02, 0x00, 0x93, 0x00, 0x00, 0x00, 0x2b,
-    0x40, 0x28, 0x00, 0x05, 0x04, 0x05, 0x85, 0x00,
-    0x04, 0x02, 0x04, 0x85, 0x00, 0x01, 0x01, 0x02,
-    0x61, 0x00, 0x02, 0x02, 0x45, 0x4d, 0x00, 0x00,
-    0x00, 0x03, 0x61, 0x00, 0x03, 0x03, 0x43, 0x03,
-    0x4e, 0x11, 0x15, 0x27, 0x27, 0x25, 0x23, 0x06,
-    0x09, 0x27, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x50,
-    0xff, 0xf6, 0x02, 0x08, 0x03, 0x1b, 0x10, 0x22,
-    0x00, 0x08, 0x00, 0x00, 0x11, 0x02, 0x00, 0x9b,
-    0x00, 0x00, 0x00, 0x2d, 0x40, 0x2a, 0x00, 0x04,
-    0x05, 0x04, 0x85, 0x06, 0x01, 0x05, 0x02, 0x05,
-    0x85, 0x00, 0x01, 0x01, 0x02, 0x61, 0x00, 0x02,
-    0x02, 0x45, 0x4d, 0x00, 0x00, 0x00, 0x03, 0x61,
-    0x00, 0x03, 0x03, 0x43, 0x03, 0x4e, 0x1d, 0x11,
-    0x15, 0x27, 0x27, 0x25, 0x23, 0x07, 0x09, 0x28,
-    0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x50,
-    0xff, 0xf6, 0x02, 0x08, 0x03, 0x1b, 0x10, 0x22,
-    0x00, 0x08, 0x00, 0x00, 0x11, 0x02, 0x00, 0x8c,
-    0x00, 0x00, 0x00, 0x87, 0x4b, 0xb0, 0x2e, 0x50,
-    0x58, 0x40, 0x2a, 0x09, 0x01, 0x05, 0x00, 0x07,
-    0x04, 0x05, 0x07, 0x69, 0x08, 0x01, 0x06, 0x06,
-    0x04, 0x61, 0x0a, 0x01, 0x04, 0x04, 0x3a, 0x4d,
-    0x00, 0x01, 0x01, 0x02, 0x61, 0x00, 0x02, 0x02,
-    0x45, 0x4d, 0x00, 0x00, 0x00, 0x03, 0x61, 0x00,
-    0x03, 0x03, 0x43, 0x03, 0x4e, 0x1b, 0x40, 0x38,
-    0x00, 0x05, 0x09, 0x07, 0x09, 0x05, 0x07, 0x80,
-    0x00, 0x08, 0x04, 0x06, 0x04, 0x08, 0x06, 0x80,
-    0x00, 0x09, 0x00, 0x07, 0x04, 0x09, 0x07, 0x69,
-    0x00, 0x06, 0x06, 0x04, 0x61, 0x0a, 0x01, 0x04,
-    0x04, 0x3a, 0x4d, 0x00, 0x01, 0x01, 0x02, 0x61,
-    0x00, 0x02, 0x02, 0x45, 0x4d, 0x00, 0x00, 0x00,
-    0x03, 0x61, 0x00, 0x03, 0x03, 0x43, 0x03, 0x4e,
-    0x59, 0x40, 0x17, 0x24, 0x23, 0x3b, 0x39, 0x36,
-    0x35, 0x32, 0x30, 0x2d, 0x2b, 0x28, 0x27, 0x23,
-    0x3e, 0x24, 0x3e, 0x27, 0x27, 0x25, 0x23, 0x0b,
-    0x09, 0x25, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x50,
-    0xff, 0xf6, 0x02, 0x08, 0x03, 0x13, 0x10, 0x22,
-    0x00, 0x08, 0x00, 0x00, 0x11, 0x02, 0x00, 0x99,
-    0x00, 0x00, 0x00, 0x59, 0x4b, 0xb0, 0x17, 0x50,
-    0x58, 0x40, 0x21, 0x07, 0x01, 0x05, 0x05, 0x04,
-    0x61, 0x06, 0x01, 0x04, 0x04, 0x44, 0x4d, 0x00,
-    0x01, 0x01, 0x02, 0x61, 0x00, 0x02, 0x02, 0x45,
-    0x4d, 0x00, 0x00, 0x00, 0x03, 0x61, 0x00, 0x03,
-    0x03, 0x43, 0x03, 0x4e, 0x1b, 0x40, 0x1f, 0x06,
-    0x01, 0x04, 0x07, 0x01, 0x05, 0x02, 0x04, 0x05,
-    0x69, 0x00, 0x01, 0x01, 0x02, 0x61, 0x00, 0x02,
-    0x02, 0x45, 0x4d, 0x00, 0x00, 0x00, 0x03, 0x61,
-    0x00, 0x03, 0x03, 0x43, 0x03, 0x4e, 0x59, 0x40,
-    0x0b, 0x24, 0x24, 0x24, 0x27, 0x27, 0x27, 0x25,
-    0x23, 0x08, 0x09, 0x29, 0x2b, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x4d, 0xff, 0xf6, 0x02, 0x06,
-    0x03, 0x1b, 0x10, 0x22, 0x00, 0x32, 0x00, 0x00,
-    0x11, 0x02, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x4b,
-    0x40, 0x48, 0x00, 0x08, 0x06, 0x03, 0x06, 0x08,
-    0x03, 0x80, 0x00, 0x01, 0x04, 0x02, 0x04, 0x01,
-    0x02, 0x80, 0x07, 0x01, 0x06, 0x00, 0x04, 0x01,
-    0x06, 0x04, 0x67, 0x00, 0x05, 0x05, 0x03, 0x61,
-    0x00, 0x03, 0x03, 0x45, 0x4d, 0x00, 0x02, 0x02,
-    0x00, 0x62, 0x09, 0x01, 0x00, 0x00, 0x43, 0x00,
-    0x4e, 0x02, 0x01, 0x3f, 0x3e, 0x3d, 0x3c, 0x2f,
-    0x2e, 0x21, 0x1e, 0x1c, 0x1b, 0x17, 0x14, 0x0a,
-    0x07, 0x05, 0x04, 0x01, 0x2d, 0x02, 0x2c, 0x0a,
-    0x09, 0x21, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x5a,
-    0xff, 0xf6, 0x01, 0xfe, 0x03, 0x1c, 0x10, 0x22,
-    0x00, 0x5a, 0x00, 0x00, 0x11, 0x02, 0x00, 0x92,
-    0x00, 0x00, 0x00, 0x27, 0x40, 0x24, 0x00, 0x04,
-    0x05, 0x04, 0x85, 0x00, 0x05, 0x00, 0x05, 0x85,
-    0x02, 0x01, 0x00, 0x00, 0x3d, 0x4d, 0x00, 0x01,
-    0x01, 0x03, 0x62, 0x00, 0x03, 0x03, 0x43, 0x03,
-    0x4e, 0x11, 0x13, 0x23, 0x12, 0x22, 0x11, 0x06,
-    0x09, 0x27, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x5a,
-    0xff, 0xf6, 0x01, 0xfe, 0x03, 0x1c, 0x10, 0x22,
-    0x00, 0x5a, 0x00, 0x00, 0x11, 0x02, 0x00, 0x93,
-    0x00, 0x00, 0x00, 0x27, 0x40, 0x24, 0x00, 0x05,
-    0x04, 0x05, 0x85, 0x00, 0x04, 0x00, 0x04, 0x85,
-    0x02, 0x01, 0x00, 0x00, 0x3d, 0x4d, 0x00, 0x01,
-    0x01, 0x03, 0x62, 0x00, 0x03, 0x03, 0x43, 0x03,
-    0x4e, 0x11, 0x13, 0x23, 0x12, 0x22, 0x11, 0x06,
-    0x09, 0x27, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x5a,
-    0xff, 0xf6, 0x01, 0xfe, 0x03, 0x1b, 0x10, 0x22,
-    0x00, 0x5a, 0x00, 0x00, 0x11, 0x02, 0x00, 0x9b,
-    0x00, 0x00, 0x00, 0x29, 0x40, 0x26, 0x00, 0x04,
-    0x05, 0x04, 0x85, 0x06, 0x01, 0x05, 0x00, 0x05,
-    0x85, 0x02, 0x01, 0x00, 0x00, 0x3d, 0x4d, 0x00,
-    0x01, 0x01, 0x03, 0x62, 0x00, 0x03, 0x03, 0x43,
-    0x03, 0x4e, 0x1d, 0x11, 0x13, 0x23, 0x12, 0x22,
-    0x11, 0x07, 0x09, 0x28, 0x2b, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x5a, 0xff, 0xf6, 0x01, 0xfe,
-    0x03, 0x13, 0x10, 0x22, 0x00, 0x5a, 0x00, 0x00,
-    0x11, 0x02, 0x00, 0x99, 0x00, 0x00, 0x00, 0x51,
-    0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x1d, 0x07,
-    0x01, 0x05, 0x05, 0x04, 0x61, 0x06, 0x01, 0x04,
-    0x04, 0x44, 0x4d, 0x02, 0x01, 0x00, 0x00, 0x3d,
-    0x4d, 0x00, 0x01, 0x01, 0x03, 0x61, 0x00, 0x03,
-    0x03, 0x43, 0x03, 0x4e, 0x1b, 0x40, 0x1b, 0x06,
-    0x01, 0x04, 0x07, 0x01, 0x05, 0x00, 0x04, 0x05,
-    0x69, 0x02, 0x01, 0x00, 0x00, 0x3d, 0x4d, 0x00,
-    0x01, 0x01, 0x03, 0x61, 0x00, 0x03, 0x03, 0x43,
-    0x03, 0x4e, 0x59, 0x40, 0x0b, 0x24, 0x24, 0x24,
-    0x25, 0x23, 0x12, 0x22, 0x11, 0x08, 0x09, 0x29,
-    0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x32,
-    0xff, 0x5b, 0x02, 0x26, 0x03, 0x1c, 0x10, 0x22,
-    0x00, 0x37, 0x00, 0x00, 0x11, 0x02, 0x00, 0x93,
-    0x00, 0x00, 0x00, 0x30, 0x40, 0x2d, 0x12, 0x07,
-    0x02, 0x01, 0x00, 0x01, 0x4c, 0x00, 0x04, 0x03,
-    0x04, 0x85, 0x00, 0x03, 0x00, 0x03, 0x85, 0x05,
-    0x02, 0x02, 0x00, 0x00, 0x3d, 0x4d, 0x00, 0x01,
-    0x01, 0x3f, 0x01, 0x4e, 0x01, 0x01, 0x17, 0x16,
-    0x15, 0x14, 0x01, 0x13, 0x01, 0x13, 0x11, 0x1e,
-    0x06, 0x09, 0x23, 0x2b, 0xff, 0xff, 0x00, 0x32,
-    0xff, 0x5b, 0x02, 0x26, 0x03, 0x13, 0x10, 0x22,
-    0x00, 0x37, 0x00, 0x00, 0x11, 0x02, 0x00, 0x99,
-    0x00, 0x00, 0x00, 0x59, 0xb6, 0x12, 0x07, 0x02,
-    0x01, 0x00, 0x01, 0x4c, 0x4b, 0xb0, 0x17, 0x50,
-    0x58, 0x40, 0x19, 0x06, 0x01, 0x04, 0x04, 0x03,
-    0x61, 0x05, 0x01, 0x03, 0x03, 0x44, 0x4d, 0x07,
-    0x02, 0x02, 0x00, 0x00, 0x3d, 0x4d, 0x00, 0x01,
-    0x01, 0x3f, 0x01, 0x4e, 0x1b, 0x40, 0x17, 0x05,
-    0x01, 0x03, 0x06, 0x01, 0x04, 0x00, 0x03, 0x04,
-    0x69, 0x07, 0x02, 0x02, 0x00, 0x00, 0x3d, 0x4d,
-    0x00, 0x01, 0x01, 0x3f, 0x01, 0x4e, 0x59, 0x40,
-    0x13, 0x01, 0x01, 0x2a, 0x28, 0x24, 0x22, 0x1e,
-    0x1c, 0x18, 0x16, 0x01, 0x13, 0x01, 0x13, 0x11,
-    0x1e, 0x08, 0x09, 0x23, 0x2b, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x50, 0x00, 0x00, 0x02, 0x08,
-    0x03, 0x1b, 0x10, 0x22, 0x00, 0x38, 0x00, 0x00,
-    0x11, 0x02, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x3a,
-    0x40, 0x37, 0x0d, 0x03, 0x02, 0x01, 0x03, 0x04,
-    0x01, 0x02, 0x01, 0x02, 0x4c, 0x06, 0x01, 0x05,
-    0x07, 0x05, 0x85, 0x00, 0x07, 0x00, 0x07, 0x85,
-    0x04, 0x01, 0x03, 0x03, 0x00, 0x5f, 0x00, 0x00,
-    0x00, 0x3d, 0x4d, 0x00, 0x01, 0x01, 0x02, 0x5f,
-    0x00, 0x02, 0x02, 0x3b, 0x02, 0x4e, 0x11, 0x1d,
-    0x11, 0x31, 0x13, 0x11, 0x35, 0x11, 0x08, 0x09,
-    0x29, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x55,
-    0x00, 0x00, 0x02, 0x03, 0x03, 0xbb, 0x10, 0x22,
-    0x00, 0x1d, 0x00, 0x00, 0x11, 0x03, 0x00, 0x8c,
-    0x00, 0x00, 0x00, 0xa0, 0x00, 0x7a, 0xb5, 0x1b,
-    0x01, 0x02, 0x00, 0x01, 0x4c, 0x4b, 0xb0, 0x2e,
-    0x50, 0x58, 0x40, 0x20, 0x09, 0x01, 0x05, 0x00,
-    0x07, 0x04, 0x05, 0x07, 0x69, 0x0a, 0x01, 0x04,
-    0x08, 0x01, 0x06, 0x00, 0x04, 0x06, 0x6a, 0x01,
-    0x01, 0x00, 0x00, 0x3a, 0x4d, 0x03, 0x01, 0x02,
-    0x02, 0x3b, 0x02, 0x4e, 0x1b, 0x40, 0x2e, 0x00,
-    0x05, 0x09, 0x07, 0x09, 0x05, 0x07, 0x80, 0x00,
-    0x08, 0x04, 0x06, 0x04, 0x08, 0x06, 0x80, 0x00,
-    0x09, 0x00, 0x07, 0x04, 0x09, 0x07, 0x69, 0x0a,
-    0x01, 0x04, 0x00, 0x06, 0x00, 0x04, 0x06, 0x6a,
-    0x01, 0x01, 0x00, 0x00, 0x3a, 0x4d, 0x03, 0x01,
-    0x02, 0x02, 0x3b, 0x02, 0x4e, 0x59, 0x40, 0x17,
-    0x22, 0x21, 0x39, 0x37, 0x34, 0x33, 0x30, 0x2e,
-    0x2b, 0x29, 0x26, 0x25, 0x21, 0x3c, 0x22, 0x3c,
-    0x1d, 0x11, 0x1d, 0x11, 0x0b, 0x09, 0x25, 0x2b,
-    0x00, 0x02, 0x00, 0x23, 0x00, 0x00, 0x02, 0x08,
-    0x02, 0xd0, 0x00, 0x11, 0x00, 0x1f, 0x00, 0x3c,
-    0x40, 0x39, 0x09, 0x07, 0x08, 0x03, 0x03, 0x04,
-    0x01, 0x02, 0x05, 0x03, 0x02, 0x67, 0x00, 0x06,
-    0x06, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x3a, 0x4d,
-    0x00, 0x05, 0x05, 0x01, 0x5f, 0x00, 0x01, 0x01,
-    0x3b, 0x01, 0x4e, 0x12, 0x12, 0x00, 0x00, 0x12,
-    0x1f, 0x12, 0x1f, 0x1e, 0x1c, 0x17, 0x15, 0x14,
-    0x13, 0x00, 0x11, 0x00, 0x11, 0x11, 0x29, 0x21,
-    0x0a, 0x09, 0x19, 0x2b, 0x13, 0x11, 0x33, 0x32,
-    0x1e, 0x02, 0x15, 0x11, 0x14, 0x0e, 0x02, 0x2b,
-    0x01, 0x11, 0x23, 0x35, 0x21, 0x15, 0x23, 0x15,
-    0x33, 0x32, 0x36, 0x35, 0x11, 0x34, 0x26, 0x2b,
-    0x01, 0x15, 0x58, 0xc9, 0x34, 0x55, 0x3d, 0x21,
-    0x21, 0x3d, 0x55, 0x34, 0xc9, 0x35, 0x01, 0x09,
-    0x7a, 0x6f, 0x3f, 0x4d, 0x4d, 0x3f, 0x6f, 0x01,
-    0x8b, 0x01, 0x45, 0x20, 0x39, 0x51, 0x31, 0xfe,
-    0xe7, 0x31, 0x52, 0x39, 0x20, 0x01, 0x40, 0x4b,
-    0x4b, 0xf0, 0x4d, 0x3f, 0x01, 0x19, 0x3f, 0x4c,
-    0xf5, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x23,
-    0x00, 0x00, 0x02, 0x08, 0x02, 0xd0, 0x11, 0x02,
-    0x00, 0xd9, 0x00, 0x00, 0x00, 0x3c, 0x40, 0x39,
-    0x09, 0x07, 0x08, 0x03, 0x03, 0x04, 0x01, 0x02,
-    0x05, 0x03, 0x02, 0x67, 0x00, 0x06, 0x06, 0x00,
-    0x5f, 0x00, 0x00, 0x00, 0x3a, 0x4d, 0x00, 0x05,
-    0x05, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x3b, 0x01,
-    0x4e, 0x13, 0x13, 0x01, 0x01, 0x13, 0x20, 0x13,
-    0x20, 0x1f, 0x1d, 0x18, 0x16, 0x15, 0x14, 0x01,
-    0x12, 0x01, 0x12, 0x11, 0x29, 0x22, 0x0a, 0x09,
-    0x24, 0x2b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x53,
-    0xff, 0x5b, 0x02, 0x03, 0x02, 0xda, 0x00, 0x1c,
-    0x00, 0x2a, 0x00, 0x9b, 0x40, 0x0b, 0x04, 0x01,
-    0x04, 0x00, 0x18, 0x06, 0x02, 0x05, 0x04, 0x02,
-    0x4c, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x21,
-    0x06, 0x01, 0x03, 0x03, 0x3c, 0x4d, 0x07, 0x01,
-    0x04, 0x04, 0x00, 0x61, 0x00, 0x00, 0x00, 0x45,
-    0x4d, 0x00, 0x05, 0x05, 0x01, 0x61, 0x00, 0x01,
-    0x01, 0x43, 0x4d, 0x00, 0x02, 0x02, 0x3f, 0x02,
-    0x4e, 0x1b, 0x4b, 0xb0, 0x31, 0x50, 0x58, 0x40,
-    0x21, 0x06, 0x01, 0x03, 0x03, 0x3a, 0x4d, 0x07,
-    0x01, 0x04, 0x04, 0x00, 0x61, 0x00, 0x00, 0x00,
-    0x45, 0x4d, 0x00, 0x05, 0x05, 0x01, 0x61, 0x00,
-    0x01, 0x01, 0x43, 0x4d, 0x00, 0x02, 0x02, 0x3f,
-    0x02, 0x4e, 0x1b, 0x40, 0x21, 0x06, 0x01, 0x03,
-    0x00, 0x03, 0x85, 0x07, 0x01, 0x04, 0x04, 0x00,
-    0x61, 0x00, 0x00, 0x00, 0x45, 0x4d, 0x00, 0x05,
-    0x05, 0x01, 0x61, 0x00, 0x01, 0x01, 0x43, 0x4d,
-    0x00, 0x02, 0x02, 0x3f, 0x02, 0x4e, 0x59, 0x59,
-    0x40, 0x14, 0x1e, 0x1d, 0x00, 0x00, 0x25, 0x23,
-    0x1d, 0x2a, 0x1e, 0x2a, 0x00, 0x1c, 0x00, 0x1c,
-    0x14, 0x29, 0x29, 0x08, 0x09, 0x19, 0x2b, 0x13,
-    0x15, 0x14, 0x06, 0x07, 0x06, 0x07, 0x33, 0x3e,
-    0x01, 0x33, 0x32, 0x1e, 0x02, 0x1d, 0x01, 0x14,
-    0x0e, 0x02, 0x23, 0x22, 0x26, 0x27, 0x23, 0x11,
-    0x23, 0x11, 0x17, 0x22, 0x06, 0x1d, 0x01, 0x14,
-    0x16, 0x33, 0x32, 0x36, 0x3d, 0x01, 0x34, 0x26,
-    0xad, 0x01, 0x01, 0x02, 0x01, 0x08, 0x0d, 0x50,
-    0x3d, 0x2a, 0x44, 0x30, 0x1b, 0x1b, 0x30, 0x44,
-    0x2a, 0x3d, 0x50, 0x0d, 0x08, 0x55, 0xd5, 0x38,
-    0x43, 0x43, 0x38, 0x3c, 0x45, 0x44, 0x02, 0xda,
-    0xaa, 0x0e, 0x25, 0x10, 0x13, 0x13, 0x32, 0x37,
-    0x1e, 0x37, 0x50, 0x32, 0x8c, 0x32, 0x50, 0x37,
-    0x1e, 0x37, 0x32, 0xfe, 0xfc, 0x03, 0x7f, 0xf8,
-    0x4a, 0x3f, 0x8c, 0x3f, 0x4a, 0x4a, 0x3f, 0x8c,
-    0x41, 0x48, 0x00, 0x00, 0x00, 0x03, 0x00, 0x23,
-    0xff, 0xd8, 0x02, 0x35, 0x02, 0xee, 0x00, 0x1a,
-    0x00, 0x22, 0x00, 0x29, 0x00, 0x71, 0x40, 0x11,
-    0x0c, 0x01, 0x04, 0x00, 0x29, 0x21, 0x0f, 0x01,
-    0x04, 0x05, 0x04, 0x19, 0x01, 0x02, 0x05, 0x03,
-    0x4c, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x20,
-    0x06, 0x01, 0x03, 0x02, 0x03, 0x86, 0x00, 0x01,
-    0x01, 0x3c, 0x4d, 0x00, 0x04, 0x04, 0x00, 0x61,
-    0x00, 0x00, 0x00, 0x42, 0x4d, 0x00, 0x05, 0x05,
-    0x02, 0x61, 0x00, 0x02, 0x02, 0x43, 0x02, 0x4e,
-    0x1b, 0x40, 0x20, 0x00, 0x01, 0x00, 0x01, 0x85,
-    0x06, 0x01, 0x03, 0x02, 0x03, 0x86, 0x00, 0x04,
-    0x04, 0x00, 0x61, 0x00, 0x00, 0x00, 0x42, 0x4d,
-    0x00, 0x05, 0x05, 0x02, 0x61, 0x00, 0x02, 0x02,
-    0x43, 0x02, 0x4e, 0x59, 0x40, 0x10, 0x00, 0x00,
-    0x26, 0x24, 0x1e, 0x1c, 0x00, 0x1a, 0x00, 0x1a,
-    0x28, 0x13, 0x28, 0x07, 0x09, 0x19, 0x2b, 0x17,
-    0x37, 0x26, 0x35, 0x11, 0x34, 0x3e, 0x02, 0x33,
-    0x32, 0x16, 0x17, 0x37, 0x33, 0x07, 0x16, 0x15,
-    0x11, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x27, 0x07,
-    0x01, 0x26, 0x23, 0x22, 0x06, 0x15, 0x11, 0x15,
-    0x17, 0x16, 0x33, 0x32, 0x36, 0x35, 0x11, 0x23,
-    0x49, 0x1c, 0x1f, 0x39, 0x51, 0x33, 0x2b, 0x46,
-    0x1c, 0x22, 0x5a, 0x46, 0x19, 0x1f, 0x39, 0x52,
-    0x32, 0x51, 0x38, 0x26, 0x01, 0x10, 0x22, 0x3f,
-    0x3c, 0x46, 0x24, 0x24, 0x3a, 0x3c, 0x46, 0x28,
-    0x82, 0x32, 0x41, 0x01, 0x36, 0x31, 0x50, 0x38,
-    0x1e, 0x15, 0x14, 0x3d, 0x7d, 0x30, 0x3e, 0xfe,
-    0xca, 0x31, 0x4f, 0x38, 0x1f, 0x27, 0x45, 0x02,
-    0x8a, 0x28, 0x49, 0x3e, 0xfe, 0xca, 0x03, 0x60,
-    0x24, 0x49, 0x3e, 0x01, 0x2f, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x23, 0xff, 0xe2, 0x02, 0x35,
-    0x02, 0x4e, 0x00, 0x1a, 0x00, 0x23, 0x00, 0x2c,
-    0x00, 0x44, 0x40, 0x41, 0x0c, 0x01, 0x05, 0x00,
-    0x2c, 0x23, 0x0f, 0x01, 0x04, 0x04, 0x05, 0x19,
-    0x01, 0x02, 0x04, 0x03, 0x4c, 0x00, 0x01, 0x00,
-    0x01, 0x85, 0x06, 0x01, 0x03, 0x02, 0x03, 0x86,
-    0x00, 0x05, 0x05, 0x00, 0x61, 0x00, 0x00, 0x00,
-    0x45, 0x4d, 0x00, 0x04, 0x04, 0x02, 0x61, 0x00,
-    0x02, 0x02, 0x43, 0x02, 0x4e, 0x00, 0x00, 0x27,
-    0x25, 0x1e, 0x1c, 0x00, 0x1a, 0x00, 0x1a, 0x28,
-    0x12, 0x29, 0x07, 0x09, 0x19, 0x2b, 0x17, 0x37,
-    0x2e, 0x01, 0x3d, 0x01, 0x34, 0x3e, 0x02, 0x33,
-    0x32, 0x17, 0x37, 0x33, 0x07, 0x16, 0x1d, 0x01,
-    0x14, 0x0e, 0x02, 0x23, 0x22, 0x27, 0x07, 0x37,
-    0x16, 0x33, 0x32, 0x36, 0x3d, 0x01, 0x34, 0x2f,
-    0x01, 0x26, 0x23, 0x22, 0x06, 0x1d, 0x01, 0x14,
-    0x17, 0x23, 0x4e, 0x10, 0x11, 0x1f, 0x39, 0x51,
-    0x33, 0x4a, 0x35, 0x2b, 0x5f, 0x51, 0x24, 0x1e,
-    0x39, 0x52, 0x33, 0x4f, 0x35, 0x27, 0x58, 0x21,
-    0x32, 0x3c, 0x46, 0x06, 0x2e, 0x21, 0x2d, 0x3c,
-    0x46, 0x04, 0x1e, 0x6f, 0x19, 0x3e, 0x25, 0x8c,
-    0x32, 0x4f, 0x38, 0x1e, 0x20, 0x3e, 0x73, 0x35,
-    0x4c, 0x8d, 0x32, 0x50, 0x37, 0x1e, 0x23, 0x37,
-    0x7d, 0x19, 0x48, 0x3f, 0x8c, 0x18, 0x15, 0x44,
-    0x16, 0x48, 0x3f, 0x8c, 0x16, 0x0f, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x28, 0x00, 0x00, 0x02, 0x26,
-    0x02, 0xda, 0x00, 0x15, 0x00, 0x69, 0x40, 0x0d,
-    0x13, 0x12, 0x11, 0x10, 0x05, 0x04, 0x03, 0x02,
-    0x08, 0x01, 0x03, 0x01, 0x4c, 0x4b, 0xb0, 0x17,
-    0x50, 0x58, 0x40, 0x15, 0x00, 0x03, 0x03, 0x00,
-    0x5f, 0x00, 0x00, 0x00, 0x3c, 0x4d, 0x00, 0x01,
-    0x01, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x3b, 0x02,
-    0x4e, 0x1b, 0x4b, 0xb0, 0x31, 0x50, 0x58, 0x40,
-    0x15, 0x00, 0x03, 0x03, 0x00, 0x5f, 0x00, 0x00,
-    0x00, 0x3a, 0x4d, 0x00, 0x01, 0x01, 0x02, 0x5f,
-    0x00, 0x02, 0x02, 0x3b, 0x02, 0x4e, 0x1b, 0x40,
-    0x13, 0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x03,
-    0x67, 0x00, 0x01, 0x01, 0x02, 0x5f, 0x00, 0x02,
-    0x02, 0x3b, 0x02, 0x4e, 0x59, 0x59, 0xb6, 0x17,
-    0x21, 0x27, 0x10, 0x04, 0x09, 0x1a, 0x2b, 0x13,
-    0x21, 0x11, 0x37, 0x15, 0x07, 0x15, 0x14, 0x16,
-    0x3b, 0x01, 0x15, 0x23, 0x22, 0x26, 0x3d, 0x01,
-    0x07, 0x35, 0x37, 0x11, 0x23, 0x28, 0x01, 0x10,
-    0x9e, 0x9e, 0x28, 0x23, 0xa3, 0xa3, 0x4d, 0x58,
-    0x7a, 0x7a, 0xb6, 0x02, 0xda, 0xfe, 0xeb, 0x6b,
-    0x50, 0x6b, 0xd5, 0x25, 0x29, 0x52, 0x55, 0x4b,
-    0x98, 0x52, 0x50, 0x52, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x14, 0x00, 0x00, 0x02, 0x17,
-    0x02, 0xd0, 0x00, 0x0d, 0x00, 0x26, 0x40, 0x23,
-    0x0d, 0x0c, 0x07, 0x06, 0x05, 0x04, 0x01, 0x00,
-    0x08, 0x01, 0x00, 0x01, 0x4c, 0x00, 0x00, 0x00,
-    0x3a, 0x4d, 0x00, 0x01, 0x01, 0x02, 0x60, 0x00,
-    0x02, 0x02, 0x3b, 0x02, 0x4e, 0x11, 0x15, 0x12,
-    0x03, 0x09, 0x19, 0x2b, 0x13, 0x37, 0x11, 0x33,
-    0x11, 0x37, 0x15, 0x07, 0x11, 0x21, 0x15, 0x21,
-    0x11, 0x07, 0x14, 0x55, 0x5a, 0xc3, 0xc3, 0x01,
-    0x54, 0xfe, 0x52, 0x55, 0x01, 0x36, 0x39, 0x01,
-    0x61, 0xfe, 0xdc, 0x84, 0x50, 0x84, 0xfe, 0xf6,
-    0x52, 0x01, 0x1f, 0x39, 0xff, 0xff, 0x00, 0x2c,
-    0x00, 0x00, 0x02, 0x2c, 0x03, 0xa2, 0x10, 0x22,
-    0x00, 0x11, 0x00, 0x00, 0x11, 0x03, 0x00, 0x8d,
-    0x00, 0x00, 0x00, 0xa0, 0x00, 0x2f, 0x40, 0x2c,
-    0x10, 0x01, 0x04, 0x00, 0x01, 0x4c, 0x00, 0x05,
-    0x00, 0x06, 0x00, 0x05, 0x06, 0x67, 0x00, 0x04,
-    0x00, 0x02, 0x01, 0x04, 0x02, 0x68, 0x00, 0x00,
-    0x00, 0x3a, 0x4d, 0x03, 0x01, 0x01, 0x01, 0x3b,
-    0x01, 0x4e, 0x11, 0x1d, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x07, 0x09, 0x28, 0x2b, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x3f, 0xff, 0xf6, 0x02, 0x00,
-    0x03, 0x02, 0x10, 0x22, 0x00, 0x2a, 0x00, 0x00,
-    0x11, 0x02, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x8c,
-    0xb5, 0x18, 0x01, 0x06, 0x07, 0x01, 0x4c, 0x4b,
-    0xb0, 0x18, 0x50, 0x58, 0x40, 0x2f, 0x00, 0x02,
-    0x01, 0x00, 0x01, 0x02, 0x00, 0x80, 0x00, 0x08,
-    0x00, 0x09, 0x03, 0x08, 0x09, 0x67, 0x00, 0x00,
-    0x00, 0x07, 0x06, 0x00, 0x07, 0x67, 0x00, 0x01,
-    0x01, 0x03, 0x61, 0x00, 0x03, 0x03, 0x45, 0x4d,
-    0x0a, 0x01, 0x06, 0x06, 0x04, 0x61, 0x05, 0x01,
-    0x04, 0x04, 0x3b, 0x04, 0x4e, 0x1b, 0x40, 0x33,
-    0x00, 0x02, 0x01, 0x00, 0x01, 0x02, 0x00, 0x80,
-    0x00, 0x08, 0x00, 0x09, 0x03, 0x08, 0x09, 0x67,
-    0x00, 0x00, 0x00, 0x07, 0x06, 0x00, 0x07, 0x67,
-    0x00, 0x01, 0x01, 0x03, 0x61, 0x00, 0x03, 0x03,
-    0x45, 0x4d, 0x00, 0x04, 0x04, 0x3b, 0x4d, 0x0a,
-    0x01, 0x06, 0x06, 0x05, 0x61, 0x00, 0x05, 0x05,
-    0x43, 0x05, 0x4e, 0x59, 0x40, 0x15, 0x20, 0x1f,
-    0x2f, 0x2e, 0x2d, 0x2c, 0x27, 0x25, 0x1f, 0x2b,
-    0x20, 0x2b, 0x24, 0x13, 0x22, 0x12, 0x23, 0x25,
-    0x0b, 0x09, 0x27, 0x2b, 0xff, 0xff, 0x00, 0x2c,
-    0x00, 0x00, 0x02, 0x2c, 0x03, 0xb6, 0x10, 0x22,
-    0x00, 0x11, 0x00, 0x00, 0x11, 0x03, 0x00, 0x8f,
-    0x00, 0x00, 0x00, 0xa0, 0x00, 0x37, 0x40, 0x34,
-    0x10, 0x01, 0x04, 0x00, 0x01, 0x4c, 0x07, 0x01,
-    0x05, 0x06, 0x05, 0x85, 0x00, 0x06, 0x00, 0x08,
-    0x00, 0x06, 0x08, 0x69, 0x00, 0x04, 0x00, 0x02,
-    0x01, 0x04, 0x02, 0x68, 0x00, 0x00, 0x00, 0x3a,
-    0x4d, 0x03, 0x01, 0x01, 0x01, 0x3b, 0x01, 0x4e,
-    0x24, 0x12, 0x22, 0x1d, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x09, 0x09, 0x2a, 0x2b, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x3f, 0xff, 0xf6, 0x02, 0x00,
-    0x03, 0x16, 0x10, 0x22, 0x00, 0x2a, 0x00, 0x00,
-    0x11, 0x02, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x96,
-    0xb5, 0x18, 0x01, 0x06, 0x07, 0x01, 0x4c, 0x4b,
-    0xb0, 0x18, 0x50, 0x58, 0x40, 0x32, 0x0a, 0x01,
-    0x08, 0x00, 0x02, 0x00, 0x08, 0x02, 0x67, 0x00,
-    0x00, 0x00, 0x07, 0x06, 0x00, 0x07, 0x68, 0x00,
-    0x0b, 0x0b, 0x09, 0x61, 0x00, 0x09, 0x09, 0x3a,
-    0x4d, 0x00, 0x01, 0x01, 0x03, 0x61, 0x00, 0x03,
-    0x03, 0x45, 0x4d, 0x0c, 0x01, 0x06, 0x06, 0x04,
-    0x61, 0x05, 0x01, 0x04, 0x04, 0x3b, 0x04, 0x4e,
-    0x1b, 0x40, 0x36, 0x0a, 0x01, 0x08, 0x00, 0x02,
-    0x00, 0x08, 0x02, 0x67, 0x00, 0x00, 0x00, 0x07,
-    0x06, 0x00, 0x07, 0x68, 0x00, 0x0b, 0x0b, 0x09,
-    0x61, 0x00, 0x09, 0x09, 0x3a, 0x4d, 0x00, 0x01,
-    0x01, 0x03, 0x61, 0x00, 0x03, 0x03, 0x45, 0x4d,
-    0x00, 0x04, 0x04, 0x3b, 0x4d, 0x0c, 0x01, 0x06,
-    0x06, 0x05, 0x61, 0x00, 0x05, 0x05, 0x43, 0x05,
-    0x4e, 0x59, 0x40, 0x19, 0x20, 0x1f, 0x3a, 0x38,
-    0x34, 0x33, 0x31, 0x2f, 0x2d, 0x2c, 0x27, 0x25,
-    0x1f, 0x2b, 0x20, 0x2b, 0x24, 0x13, 0x22, 0x12,
-    0x23, 0x25, 0x0d, 0x09, 0x27, 0x2b, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x2c, 0xff, 0x38, 0x02, 0x44,
-    0x02, 0xd0, 0x10, 0x22, 0x00, 0x11, 0x00, 0x00,
-    0x11, 0x03, 0x00, 0x9f, 0x00, 0xc3, 0x00, 0x00,
-    0x00, 0x3c, 0x40, 0x39, 0x10, 0x01, 0x04, 0x00,
-    0x01, 0x4c, 0x00, 0x04, 0x00, 0x02, 0x07, 0x04,
-    0x02, 0x68, 0x00, 0x05, 0x00, 0x06, 0x05, 0x06,
-    0x63, 0x00, 0x00, 0x00, 0x3a, 0x4d, 0x08, 0x01,
-    0x07, 0x07, 0x01, 0x5f, 0x03, 0x01, 0x01, 0x01,
-    0x3b, 0x01, 0x4e, 0x17, 0x17, 0x17, 0x27, 0x17,
-    0x27, 0x22, 0x20, 0x1f, 0x1d, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x09, 0x09, 0x26, 0x2b, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x3f, 0xff, 0x38, 0x02, 0x26,
-    0x02, 0x30, 0x10, 0x22, 0x00, 0x2a, 0x00, 0x00,
-    0x11, 0x03, 0x00, 0x9f, 0x00, 0xa5, 0x00, 0x00,
-    0x00, 0xa2, 0xb5, 0x18, 0x01, 0x06, 0x07, 0x01,
-    0x4c, 0x4b, 0xb0, 0x18, 0x50, 0x58, 0x40, 0x3a,
-    0x00, 0x02, 0x01, 0x00, 0x01, 0x02, 0x00, 0x80,
-    0x00, 0x00, 0x00, 0x07, 0x06, 0x00, 0x07, 0x67,
-    0x00, 0x08, 0x00, 0x09, 0x08, 0x09, 0x63, 0x00,
-    0x01, 0x01, 0x03, 0x61, 0x00, 0x03, 0x03, 0x45,
-    0x4d, 0x0b, 0x01, 0x06, 0x06, 0x04, 0x61, 0x05,
-    0x01, 0x04, 0x04, 0x3b, 0x4d, 0x0c, 0x01, 0x0a,
-    0x0a, 0x04, 0x61, 0x05, 0x01, 0x04, 0x04, 0x3b,
-    0x04, 0x4e, 0x1b, 0x40, 0x38, 0x00, 0x02, 0x01,
-    0x00, 0x01, 0x02, 0x00, 0x80, 0x00, 0x00, 0x00,
-    0x07, 0x06, 0x00, 0x07, 0x67, 0x00, 0x08, 0x00,
-    0x09, 0x08, 0x09, 0x63, 0x00, 0x01, 0x01, 0x03,
-    0x61, 0x00, 0x03, 0x03, 0x45, 0x4d, 0x0c, 0x01,
-    0x0a, 0x0a, 0x04, 0x5f, 0x00, 0x04, 0x04, 0x3b,
-    0x4d, 0x0b, 0x01, 0x06, 0x06, 0x05, 0x61, 0x00,
-    0x05, 0x05, 0x43, 0x05, 0x4e, 0x59, 0x40, 0x1b,
-    0x2c, 0x2c, 0x20, 0x1f, 0x2c, 0x3c, 0x2c, 0x3c,
-    0x37, 0x35, 0x34, 0x32, 0x27, 0x25, 0x1f, 0x2b,
-    0x20, 0x2b, 0x24, 0x13, 0x22, 0x12, 0x23, 0x25,
-    0x0d, 0x09, 0x27, 0x2b, 0xff, 0xff, 0x00, 0x56,
-    0xff, 0xf6, 0x02, 0x0e, 0x03, 0xbc, 0x10, 0x22,
-    0x00, 0x13, 0x00, 0x00, 0x11, 0x03, 0x00, 0x93,
-    0x00, 0x00, 0x00, 0xa0, 0x00, 0x82, 0x4b, 0xb0,
-    0x0c, 0x50, 0x58, 0x40, 0x2e, 0x00, 0x07, 0x06,
-    0x07, 0x85, 0x00, 0x06, 0x00, 0x06, 0x85, 0x00,
-    0x01, 0x02, 0x04, 0x02, 0x01, 0x72, 0x00, 0x04,
-    0x03, 0x02, 0x04, 0x03, 0x7e, 0x00, 0x02, 0x02,
-    0x00, 0x61, 0x08, 0x01, 0x00, 0x00, 0x42, 0x4d,
-    0x00, 0x03, 0x03, 0x05, 0x61, 0x00, 0x05, 0x05,
-    0x43, 0x05, 0x4e, 0x1b, 0x40, 0x2f, 0x00, 0x07,
-    0x06, 0x07, 0x85, 0x00, 0x06, 0x00, 0x06, 0x85,
-    0x00, 0x01, 0x02, 0x04, 0x02, 0x01, 0x04, 0x80,
-    0x00, 0x04, 0x03, 0x02, 0x04, 0x03, 0x7e, 0x00,
-    0x02, 0x02, 0x00, 0x61, 0x08, 0x01, 0x00, 0x00,
-    0x42, 0x4d, 0x00, 0x03, 0x03, 0x05, 0x61, 0x00,
-    0x05, 0x05, 0x43, 0x05, 0x4e, 0x59, 0x40, 0x17,
-    0x02, 0x01, 0x24, 0x23, 0x22, 0x21, 0x17, 0x15,
-    0x13, 0x12, 0x10, 0x0e, 0x09, 0x07, 0x05, 0x04,
-    0x01, 0x20, 0x02, 0x20, 0x09, 0x09, 0x21, 0x2b,
-    0xff, 0xff, 0x00, 0x58, 0xff, 0xf6, 0x02, 0x10,
-    0x03, 0x1c, 0x10, 0x22, 0x00, 0x2c, 0x00, 0x00,
-    0x11, 0x02, 0x00, 0x93, 0x00, 0x00, 0x00, 0x82,
-    0x4b, 0xb0, 0x0c, 0x50, 0x58, 0x40, 0x2e, 0x00,
-    0x07, 0x06, 0x07, 0x85, 0x00, 0x06, 0x01, 0x06,
-    0x85, 0x00, 0x02, 0x03, 0x05, 0x03, 0x02, 0x72,
-    0x00, 0x05, 0x04, 0x03, 0x05, 0x04, 0x7e, 0x00,
-    0x03, 0x03, 0x01, 0x61, 0x00, 0x01, 0x01, 0x45,
-    0x4d, 0x00, 0x04, 0x04, 0x00, 0x61, 0x08, 0x01,
-    0x00, 0x00, 0x43, 0x00, 0x4e, 0x1b, 0x40, 0x2f,
-    0x00, 0x07, 0x06, 0x07, 0x85, 0x00, 0x06, 0x01,
-    0x06, 0x85, 0x00, 0x02, 0x03, 0x05, 0x03, 0x02,
-    0x05, 0x80, 0x00, 0x05, 0x04, 0x03, 0x05, 0x04,
-    0x7e, 0x00, 0x03, 0x03, 0x01, 0x61, 0x00, 0x01,
-    0x01, 0x45, 0x4d, 0x00, 0x04, 0x04, 0x00, 0x61,
-    0x08, 0x01, 0x00, 0x00, 0x43, 0x00, 0x4e, 0x59,
-    0x40, 0x17, 0x02, 0x01, 0x24, 0x23, 0x22, 0x21,
-    0x1e, 0x1d, 0x1b, 0x19, 0x14, 0x12, 0x10, 0x0f,
-    0x0d, 0x0b, 0x01, 0x20, 0x02, 0x20, 0x09, 0x09,
-    0x21, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x56,
-    0xff, 0xf6, 0x02, 0x0e, 0x03, 0xbb, 0x10, 0x22,
-    0x00, 0x13, 0x00, 0x00, 0x11, 0x03, 0x00, 0x9b,
-    0x00, 0x00, 0x00, 0xa0, 0x00, 0x4c, 0x40, 0x49,
-    0x00, 0x06, 0x07, 0x06, 0x85, 0x08, 0x01, 0x07,
-    0x00, 0x07, 0x85, 0x00, 0x01, 0x02, 0x04, 0x02,
-    0x01, 0x04, 0x80, 0x00, 0x04, 0x03, 0x02, 0x04,
-    0x03, 0x7e, 0x00, 0x02, 0x02, 0x00, 0x61, 0x09,
-    0x01, 0x00, 0x00, 0x42, 0x4d, 0x00, 0x03, 0x03,
-    0x05, 0x61, 0x00, 0x05, 0x05, 0x43, 0x05, 0x4e,
-    0x02, 0x01, 0x32, 0x31, 0x24, 0x23, 0x22, 0x21,
-    0x17, 0x15, 0x13, 0x12, 0x10, 0x0e, 0x09, 0x07,
-    0x05, 0x04, 0x01, 0x20, 0x02, 0x20, 0x0a, 0x09,
-    0x21, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x58,
-    0xff, 0xf6, 0x02, 0x10, 0x03, 0x1b, 0x10, 0x22,
-    0x00, 0x2c, 0x00, 0x00, 0x11, 0x02, 0x00, 0x9b,
-    0x00, 0x00, 0x00, 0x4c, 0x40, 0x49, 0x00, 0x06,
-    0x07, 0x06, 0x85, 0x08, 0x01, 0x07, 0x01, 0x07,
-    0x85, 0x00, 0x02, 0x03, 0x05, 0x03, 0x02, 0x05,
-    0x80, 0x00, 0x05, 0x04, 0x03, 0x05, 0x04, 0x7e,
-    0x00, 0x03, 0x03, 0x01, 0x61, 0x00, 0x01, 0x01,
-    0x45, 0x4d, 0x00, 0x04, 0x04, 0x00, 0x61, 0x09,
-    0x01, 0x00, 0x00, 0x43, 0x00, 0x4e, 0x02, 0x01,
-    0x32, 0x31, 0x24, 0x23, 0x22, 0x21, 0x1e, 0x1d,
-    0x1b, 0x19, 0x14, 0x12, 0x10, 0x0f, 0x0d, 0x0b,
-    0x01, 0x20, 0x02, 0x20, 0x0a, 0x09, 0x21, 0x2b,
-    0xff, 0xff, 0x00, 0x56, 0xff, 0xf6, 0x02, 0x0e,
-    0x03, 0xc5, 0x10, 0x22, 0x00, 0x13, 0x00, 0x00,
-    0x11, 0x03, 0x00, 0x90, 0x00, 0x00, 0x00, 0xa0,
-    0x00, 0x87, 0x4b, 0xb0, 0x18, 0x50, 0x58, 0x40,
-    0x30, 0x00, 0x01, 0x02, 0x04, 0x02, 0x01, 0x04,
-    0x80, 0x00, 0x04, 0x03, 0x02, 0x04, 0x03, 0x7e,
-    0x00, 0x07, 0x07, 0x06, 0x61, 0x09, 0x01, 0x06,
-    0x06, 0x40, 0x4d, 0x00, 0x02, 0x02, 0x00, 0x61,
-    0x08, 0x01, 0x00, 0x00, 0x42, 0x4d, 0x00, 0x03,
-    0x03, 0x05, 0x61, 0x00, 0x05, 0x05, 0x43, 0x05,
-    0x4e, 0x1b, 0x40, 0x2e, 0x00, 0x01, 0x02, 0x04,
-    0x02, 0x01, 0x04, 0x80, 0x00, 0x04, 0x03, 0x02,
-    0x04, 0x03, 0x7e, 0x09, 0x01, 0x06, 0x00, 0x07,
-    0x00, 0x06, 0x07, 0x69, 0x00, 0x02, 0x02, 0x00,
-    0x61, 0x08, 0x01, 0x00, 0x00, 0x42, 0x4d, 0x00,
-    0x03, 0x03, 0x05, 0x61, 0x00, 0x05, 0x05, 0x43,
-    0x05, 0x4e, 0x59, 0x40, 0x1b, 0x23, 0x21, 0x02,
-    0x01, 0x2a, 0x27, 0x21, 0x2e, 0x23, 0x2e, 0x17,
-    0x15, 0x13, 0x12, 0x10, 0x0e, 0x09, 0x07, 0x05,
-    0x04, 0x01, 0x20, 0x02, 0x20, 0x0a, 0x09, 0x21,
-    0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x58,
-    0xff, 0xf6, 0x02, 0x10, 0x03, 0x25, 0x10, 0x22,
-    0x00, 0x2c, 0x00, 0x00, 0x11, 0x02, 0x00, 0x90,
-    0x00, 0x00, 0x00, 0x4c, 0x40, 0x49, 0x00, 0x02,
-    0x03, 0x05, 0x03, 0x02, 0x05, 0x80, 0x00, 0x05,
-    0x04, 0x03, 0x05, 0x04, 0x7e, 0x09, 0x01, 0x06,
-    0x00, 0x07, 0x01, 0x06, 0x07, 0x69, 0x00, 0x03,
-    0x03, 0x01, 0x61, 0x00, 0x01, 0x01, 0x45, 0x4d,
-    0x00, 0x04, 0x04, 0x00, 0x61, 0x08, 0x01, 0x00,
-    0x00, 0x43, 0x00, 0x4e, 0x23, 0x21, 0x02, 0x01,
-    0x2a, 0x27, 0x21, 0x2e, 0x23, 0x2e, 0x1e, 0x1d,
-    0x1b, 0x19, 0x14, 0x12, 0x10, 0x0f, 0x0d, 0x0b,
-    0x01, 0x20, 0x02, 0x20, 0x0a, 0x09, 0x21, 0x2b,
-    0xff, 0xff, 0x00, 0x56, 0xff, 0xf6, 0x02, 0x0e,
-    0x03, 0xbb, 0x10, 0x22, 0x00, 0x13, 0x00, 0x00,
-    0x11, 0x03, 0x00, 0x9c, 0x00, 0x00, 0x00, 0xa0,
-    0x00, 0x4b, 0x40, 0x48, 0x00, 0x08, 0x06, 0x00,
-    0x06, 0x08, 0x00, 0x80, 0x00, 0x04, 0x01, 0x03,
-    0x01, 0x04, 0x03, 0x80, 0x07, 0x01, 0x06, 0x00,
-    0x01, 0x04, 0x06, 0x01, 0x67, 0x00, 0x02, 0x02,
-    0x00, 0x61, 0x09, 0x01, 0x00, 0x00, 0x42, 0x4d,
-    0x00, 0x03, 0x03, 0x05, 0x61, 0x00, 0x05, 0x05,
-    0x43, 0x05, 0x4e, 0x02, 0x01, 0x32, 0x31, 0x30,
-    0x2f, 0x22, 0x21, 0x17, 0x15, 0x13, 0x12, 0x10,
-    0x0e, 0x09, 0x07, 0x05, 0x04, 0x01, 0x20, 0x02,
-    0x20, 0x0a, 0x09, 0x21, 0x2b, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x58, 0x00, 0x00, 0x02, 0x08,
-    0x03, 0xbb, 0x10, 0x22, 0x00, 0x14, 0x00, 0x00,
-    0x11, 0x03, 0x00, 0x9c, 0x00, 0x00, 0x00, 0xa0,
-    0x00, 0x3e, 0x40, 0x3b, 0x05, 0x01, 0x04, 0x06,
-    0x04, 0x85, 0x00, 0x06, 0x02, 0x06, 0x85, 0x00,
-    0x01, 0x01, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x3a,
-    0x4d, 0x07, 0x01, 0x00, 0x00, 0x03, 0x5f, 0x08,
-    0x01, 0x03, 0x03, 0x3b, 0x03, 0x4e, 0x0b, 0x0b,
-    0x02, 0x01, 0x2a, 0x29, 0x28, 0x27, 0x1a, 0x19,
-    0x0b, 0x18, 0x0b, 0x17, 0x0e, 0x0c, 0x09, 0x07,
-    0x01, 0x0a, 0x02, 0x0a, 0x09, 0x09, 0x21, 0x2b,
-    0x00, 0x03, 0x00, 0x3c, 0xff, 0xf6, 0x02, 0x8e,
-    0x02, 0xf4, 0x00, 0x1c, 0x00, 0x2a, 0x00, 0x2e,
-    0x00, 0xd8, 0x40, 0x0b, 0x0c, 0x01, 0x05, 0x00,
-    0x14, 0x09, 0x02, 0x04, 0x05, 0x02, 0x4c, 0x4b,
-    0xb0, 0x17, 0x50, 0x58, 0x40, 0x24, 0x00, 0x06,
-    0x00, 0x07, 0x00, 0x06, 0x07, 0x67, 0x00, 0x01,
-    0x01, 0x3c, 0x4d, 0x00, 0x05, 0x05, 0x00, 0x61,
-    0x00, 0x00, 0x00, 0x45, 0x4d, 0x08, 0x01, 0x04,
-    0x04, 0x02, 0x61, 0x03, 0x01, 0x02, 0x02, 0x3b,
-    0x02, 0x4e, 0x1b, 0x4b, 0xb0, 0x18, 0x50, 0x58,
-    0x40, 0x24, 0x00, 0x06, 0x00, 0x07, 0x00, 0x06,
-    0x07, 0x67, 0x00, 0x01, 0x01, 0x3a, 0x4d, 0x00,
-    0x05, 0x05, 0x00, 0x61, 0x00, 0x00, 0x00, 0x45,
-    0x4d, 0x08, 0x01, 0x04, 0x04, 0x02, 0x61, 0x03,
-    0x01, 0x02, 0x02, 0x3b, 0x02, 0x4e, 0x1b, 0x4b,
-    0xb0, 0x31, 0x50, 0x58, 0x40, 0x28, 0x00, 0x06,
-    0x00, 0x07, 0x00, 0x06, 0x07, 0x67, 0x00, 0x01,
-    0x01, 0x3a, 0x4d, 0x00, 0x05, 0x05, 0x00, 0x61,
-    0x00, 0x00, 0x00, 0x45, 0x4d, 0x00, 0x02, 0x02,
-    0x3b, 0x4d, 0x08, 0x01, 0x04, 0x04, 0x03, 0x61,
-    0x00, 0x03, 0x03, 0x43, 0x03, 0x4e, 0x1b, 0x40,
-    0x28, 0x00, 0x06, 0x00, 0x07, 0x00, 0x06, 0x07,
-    0x67, 0x00, 0x05, 0x05, 0x00, 0x61, 0x00, 0x00,
-    0x00, 0x45, 0x4d, 0x00, 0x01, 0x01, 0x02, 0x5f,
-    0x00, 0x02, 0x02, 0x3b, 0x4d, 0x08, 0x01, 0x04,
-    0x04, 0x03, 0x61, 0x00, 0x03, 0x03, 0x43, 0x03,
-    0x4e, 0x59, 0x59, 0x59, 0x40, 0x13, 0x1e, 0x1d,
-    0x2e, 0x2d, 0x2c, 0x2b, 0x25, 0x23, 0x1d, 0x2a,
-    0x1e, 0x2a, 0x24, 0x11, 0x19, 0x25, 0x09, 0x09,
-    0x1a, 0x2b, 0x37, 0x35, 0x34, 0x3e, 0x02, 0x33,
-    0x32, 0x16, 0x17, 0x33, 0x26, 0x27, 0x2e, 0x01,
-    0x3d, 0x01, 0x33, 0x11, 0x23, 0x35, 0x23, 0x0e,
-    0x01, 0x23, 0x22, 0x2e, 0x02, 0x17, 0x32, 0x36,
-    0x3d, 0x01, 0x34, 0x26, 0x23, 0x22, 0x06, 0x1d,
-    0x01, 0x14, 0x16, 0x01, 0x33, 0x07, 0x23, 0x3c,
-    0x1b, 0x30, 0x44, 0x2a, 0x3d, 0x50, 0x0d, 0x08,
-    0x01, 0x01, 0x02, 0x01, 0x5a, 0x55, 0x08, 0x0d,
-    0x50, 0x3d, 0x2a, 0x44, 0x30, 0x1b, 0xdb, 0x38,
-    0x43, 0x43, 0x38, 0x3d, 0x44, 0x45, 0x01, 0x59,
-    0x5a, 0x46, 0x46, 0xcd, 0x8c, 0x32, 0x50, 0x37,
-    0x1e, 0x37, 0x32, 0x11, 0x11, 0x0f, 0x21, 0x0d,
-    0xb4, 0xfd, 0x26, 0x5f, 0x32, 0x37, 0x1e, 0x37,
-    0x50, 0x57, 0x4a, 0x3f, 0x8c, 0x3f, 0x4a, 0x48,
-    0x41, 0x8c, 0x3f, 0x4a, 0x02, 0xb0, 0x92, 0x00,
-    0xff, 0xff, 0x00, 0x5f, 0x00, 0x00, 0x02, 0x08,
-    0x03, 0xa2, 0x10, 0x22, 0x00, 0x15, 0x00, 0x00,
-    0x11, 0x03, 0x00, 0x8d, 0x00, 0x00, 0x00, 0xa0,
-    0x00, 0x3b, 0x40, 0x38, 0x00, 0x06, 0x00, 0x07,
-    0x00, 0x06, 0x07, 0x67, 0x00, 0x02, 0x00, 0x03,
-    0x04, 0x02, 0x03, 0x67, 0x00, 0x01, 0x01, 0x00,
-    0x5f, 0x00, 0x00, 0x00, 0x3a, 0x4d, 0x00, 0x04,
-    0x04, 0x05, 0x5f, 0x08, 0x01, 0x05, 0x05, 0x3b,
-    0x05, 0x4e, 0x01, 0x01, 0x10, 0x0f, 0x0e, 0x0d,
-    0x01, 0x0c, 0x01, 0x0c, 0x11, 0x11, 0x11, 0x11,
-    0x12, 0x09, 0x09, 0x26, 0x2b, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x50, 0xff, 0xf6, 0x02, 0x08,
-    0x03, 0x02, 0x10, 0x22, 0x00, 0x2d, 0x00, 0x00,
-    0x11, 0x02, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x4f,
-    0x40, 0x4c, 0x00, 0x04, 0x02, 0x03, 0x02, 0x04,
-    0x03, 0x80, 0x00, 0x07, 0x00, 0x08, 0x01, 0x07,
-    0x08, 0x67, 0x0a, 0x01, 0x06, 0x00, 0x02, 0x04,
-    0x06, 0x02, 0x67, 0x00, 0x05, 0x05, 0x01, 0x61,
-    0x00, 0x01, 0x01, 0x45, 0x4d, 0x00, 0x03, 0x03,
-    0x00, 0x61, 0x09, 0x01, 0x00, 0x00, 0x43, 0x00,
-    0x4e, 0x18, 0x18, 0x02, 0x01, 0x24, 0x23, 0x22,
-    0x21, 0x18, 0x20, 0x18, 0x20, 0x1d, 0x1b, 0x15,
-    0x14, 0x12, 0x10, 0x0d, 0x0c, 0x09, 0x07, 0x01,
-    0x17, 0x02, 0x17, 0x0b, 0x09, 0x21, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0x5f, 0x00, 0x00, 0x02, 0x08,
-    0x03, 0xb6, 0x10, 0x22, 0x00, 0x15, 0x00, 0x00,
-    0x11, 0x03, 0x00, 0x8f, 0x00, 0x00, 0x00, 0xa0,
-    0x00, 0x45, 0x40, 0x42, 0x08, 0x01, 0x06, 0x07,
-    0x06, 0x85, 0x00, 0x07, 0x00, 0x09, 0x00, 0x07,
-    0x09, 0x69, 0x00, 0x02, 0x00, 0x03, 0x04, 0x02,
-    0x03, 0x67, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00,
-    0x00, 0x00, 0x3a, 0x4d, 0x00, 0x04, 0x04, 0x05,
-    0x5f, 0x0a, 0x01, 0x05, 0x05, 0x3b, 0x05, 0x4e,
-    0x01, 0x01, 0x1b, 0x19, 0x15, 0x14, 0x12, 0x10,
-    0x0e, 0x0d, 0x01, 0x0c, 0x01, 0x0c, 0x11, 0x11,
-    0x11, 0x11, 0x12, 0x0b, 0x09, 0x26, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0x50, 0xff, 0xf6, 0x02, 0x08,
-    0x03, 0x16, 0x10, 0x22, 0x00, 0x2d, 0x00, 0x00,
-    0x11, 0x02, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x5b,
-    0x40, 0x58, 0x09, 0x01, 0x07, 0x08, 0x07, 0x85,
-    0x00, 0x04, 0x02, 0x03, 0x02, 0x04, 0x03, 0x80,
-    0x0c, 0x01, 0x06, 0x00, 0x02, 0x04, 0x06, 0x02,
-    0x68, 0x00, 0x0a, 0x0a, 0x08, 0x61, 0x00, 0x08,
-    0x08, 0x3a, 0x4d, 0x00, 0x05, 0x05, 0x01, 0x61,
-    0x00, 0x01, 0x01, 0x45, 0x4d, 0x00, 0x03, 0x03,
-    0x00, 0x61, 0x0b, 0x01, 0x00, 0x00, 0x43, 0x00,
-    0x4e, 0x18, 0x18, 0x02, 0x01, 0x2f, 0x2d, 0x29,
-    0x28, 0x26, 0x24, 0x22, 0x21, 0x18, 0x20, 0x18,
-    0x20, 0x1d, 0x1b, 0x15, 0x14, 0x12, 0x10, 0x0d,
-    0x0c, 0x09, 0x07, 0x01, 0x17, 0x02, 0x17, 0x0d,
-    0x09, 0x21, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x5f,
-    0x00, 0x00, 0x02, 0x08, 0x03, 0xc5, 0x10, 0x22,
-    0x00, 0x15, 0x00, 0x00, 0x11, 0x03, 0x00, 0x90,
-    0x00, 0x00, 0x00, 0xa0, 0x00, 0x74, 0x4b, 0xb0,
-    0x18, 0x50, 0x58, 0x40, 0x29, 0x00, 0x02, 0x00,
-    0x03, 0x04, 0x02, 0x03, 0x67, 0x00, 0x07, 0x07,
-    0x06, 0x61, 0x09, 0x01, 0x06, 0x06, 0x40, 0x4d,
-    0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00,
-    0x3a, 0x4d, 0x00, 0x04, 0x04, 0x05, 0x5f, 0x08,
-    0x01, 0x05, 0x05, 0x3b, 0x05, 0x4e, 0x1b, 0x40,
-    0x27, 0x09, 0x01, 0x06, 0x00, 0x07, 0x00, 0x06,
-    0x07, 0x69, 0x00, 0x02, 0x00, 0x03, 0x04, 0x02,
-    0x03, 0x67, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00,
-    0x00, 0x00, 0x3a, 0x4d, 0x00, 0x04, 0x04, 0x05,
-    0x5f, 0x08, 0x01, 0x05, 0x05, 0x3b, 0x05, 0x4e,
-    0x59, 0x40, 0x16, 0x0f, 0x0d, 0x01, 0x01, 0x16,
-    0x13, 0x0d, 0x1a, 0x0f, 0x1a, 0x01, 0x0c, 0x01,
-    0x0c, 0x11, 0x11, 0x11, 0x11, 0x12, 0x0a, 0x09,
-    0x26, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x50,
-    0xff, 0xf6, 0x02, 0x08, 0x03, 0x25, 0x10, 0x22,
-    0x00, 0x2d, 0x00, 0x00, 0x11, 0x02, 0x00, 0x90,
-    0x00, 0x00, 0x00, 0x54, 0x40, 0x51, 0x00, 0x04,
-    0x02, 0x03, 0x02, 0x04, 0x03, 0x80, 0x0b, 0x01,
-    0x07, 0x00, 0x08, 0x01, 0x07, 0x08, 0x69, 0x0a,
-    0x01, 0x06, 0x00, 0x02, 0x04, 0x06, 0x02, 0x67,
-    0x00, 0x05, 0x05, 0x01, 0x61, 0x00, 0x01, 0x01,
-    0x45, 0x4d, 0x00, 0x03, 0x03, 0x00, 0x61, 0x09,
-    0x01, 0x00, 0x00, 0x43, 0x00, 0x4e, 0x23, 0x21,
-    0x18, 0x18, 0x02, 0x01, 0x2a, 0x27, 0x21, 0x2e,
-    0x23, 0x2e, 0x18, 0x20, 0x18, 0x20, 0x1d, 0x1b,
-    0x15, 0x14, 0x12, 0x10, 0x0d, 0x0c, 0x09, 0x07,
-    0x01, 0x17, 0x02, 0x17, 0x0c, 0x09, 0x21, 0x2b,
-    0xff, 0xff, 0x00, 0x5f, 0xff, 0x38, 0x02, 0x08,
-    0x02, 0xd0, 0x10, 0x22, 0x00, 0x15, 0x00, 0x00,
-    0x11, 0x03, 0x00, 0x9f, 0x00, 0x87, 0x00, 0x00,
-    0x00, 0x81, 0x4b, 0xb0, 0x11, 0x50, 0x58, 0x40,
-    0x2d, 0x0a, 0x01, 0x08, 0x04, 0x05, 0x04, 0x08,
-    0x72, 0x00, 0x02, 0x00, 0x03, 0x04, 0x02, 0x03,
-    0x67, 0x00, 0x06, 0x00, 0x07, 0x06, 0x07, 0x63,
-    0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00,
-    0x3a, 0x4d, 0x00, 0x04, 0x04, 0x05, 0x5f, 0x09,
-    0x01, 0x05, 0x05, 0x3b, 0x05, 0x4e, 0x1b, 0x40,
-    0x2e, 0x0a, 0x01, 0x08, 0x04, 0x05, 0x04, 0x08,
-    0x05, 0x80, 0x00, 0x02, 0x00, 0x03, 0x04, 0x02,
-    0x03, 0x67, 0x00, 0x06, 0x00, 0x07, 0x06, 0x07,
-    0x63, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00,
-    0x00, 0x3a, 0x4d, 0x00, 0x04, 0x04, 0x05, 0x5f,
-    0x09, 0x01, 0x05, 0x05, 0x3b, 0x05, 0x4e, 0x59,
-    0x40, 0x18, 0x0d, 0x0d, 0x01, 0x01, 0x0d, 0x1d,
-    0x0d, 0x1d, 0x18, 0x16, 0x15, 0x13, 0x01, 0x0c,
-    0x01, 0x0c, 0x11, 0x11, 0x11, 0x11, 0x12, 0x0b,
-    0x09, 0x26, 0x2b, 0x00, 0x00, 0x02, 0x00, 0x50,
-    0xff, 0x38, 0x02, 0x08, 0x02, 0x30, 0x00, 0x29,
-    0x00, 0x32, 0x00, 0x54, 0x40, 0x51, 0x28, 0x01,
-    0x00, 0x03, 0x01, 0x4c, 0x00, 0x04, 0x02, 0x03,
-    0x02, 0x04, 0x03, 0x80, 0x0a, 0x01, 0x08, 0x00,
-    0x02, 0x04, 0x08, 0x02, 0x67, 0x00, 0x05, 0x00,
-    0x06, 0x05, 0x06, 0x64, 0x00, 0x07, 0x07, 0x01,
-    0x61, 0x00, 0x01, 0x01, 0x45, 0x4d, 0x00, 0x03,
-    0x03, 0x00, 0x61, 0x09, 0x01, 0x00, 0x00, 0x43,
-    0x00, 0x4e, 0x2a, 0x2a, 0x01, 0x00, 0x2a, 0x32,
-    0x2a, 0x32, 0x2f, 0x2d, 0x21, 0x1f, 0x1e, 0x1c,
-    0x14, 0x13, 0x11, 0x0f, 0x0c, 0x0b, 0x08, 0x06,
-    0x00, 0x29, 0x01, 0x29, 0x0b, 0x09, 0x16, 0x2b,
-    0x05, 0x22, 0x26, 0x3d, 0x01, 0x34, 0x36, 0x33,
-    0x32, 0x16, 0x1d, 0x01, 0x21, 0x15, 0x14, 0x16,
-    0x33, 0x32, 0x36, 0x37, 0x33, 0x06, 0x0f, 0x01,
-    0x0e, 0x01, 0x15, 0x14, 0x16, 0x3b, 0x01, 0x15,
-    0x23, 0x22, 0x2e, 0x02, 0x35, 0x34, 0x3f, 0x01,
-    0x06, 0x13, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06,
-    0x1d, 0x01, 0x01, 0x2c, 0x67, 0x75, 0x75, 0x67,
-    0x67, 0x75, 0xfe, 0xa2, 0x45, 0x3d, 0x2d, 0x42,
-    0x10, 0x5a, 0x0f, 0x2c, 0x27, 0x1a, 0x18, 0x20,
-    0x1d, 0x46, 0x5e, 0x1b, 0x2d, 0x1f, 0x11, 0x2c,
-    0x0b, 0x13, 0x6c, 0x44, 0x3e, 0x3e, 0x44, 0x0a,
-    0x70, 0x62, 0x96, 0x62, 0x70, 0x70, 0x62, 0x65,
-    0x2c, 0x3f, 0x48, 0x1c, 0x1b, 0x34, 0x23, 0x26,
-    0x1a, 0x28, 0x14, 0x19, 0x1d, 0x3c, 0x0f, 0x1a,
-    0x21, 0x12, 0x31, 0x29, 0x0b, 0x03, 0x01, 0x4e,
-    0x1a, 0x3e, 0x44, 0x44, 0x3e, 0x1a, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x5f, 0x00, 0x00, 0x02, 0x08,
-    0x03, 0xbb, 0x10, 0x22, 0x00, 0x15, 0x00, 0x00,
-    0x11, 0x03, 0x00, 0x9c, 0x00, 0x00, 0x00, 0xa0,
-    0x00, 0x40, 0x40, 0x3d, 0x07, 0x01, 0x06, 0x08,
-    0x06, 0x85, 0x00, 0x08, 0x00, 0x08, 0x85, 0x00,
-    0x02, 0x00, 0x03, 0x04, 0x02, 0x03, 0x67, 0x00,
-    0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x3a,
-    0x4d, 0x00, 0x04, 0x04, 0x05, 0x5f, 0x09, 0x01,
-    0x05, 0x05, 0x3b, 0x05, 0x4e, 0x01, 0x01, 0x1e,
-    0x1d, 0x1c, 0x1b, 0x0e, 0x0d, 0x01, 0x0c, 0x01,
-    0x0c, 0x11, 0x11, 0x11, 0x11, 0x12, 0x0a, 0x09,
-    0x26, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x50,
-    0xff, 0xf6, 0x02, 0x08, 0x03, 0x1b, 0x10, 0x22,
-    0x00, 0x2d, 0x00, 0x00, 0x11, 0x02, 0x00, 0x9c,
-    0x00, 0x00, 0x00, 0x54, 0x40, 0x51, 0x08, 0x01,
-    0x07, 0x09, 0x07, 0x85, 0x00, 0x09, 0x01, 0x09,
-    0x85, 0x00, 0x04, 0x02, 0x03, 0x02, 0x04, 0x03,
-    0x80, 0x0b, 0x01, 0x06, 0x00, 0x02, 0x04, 0x06,
-    0x02, 0x68, 0x00, 0x05, 0x05, 0x01, 0x61, 0x00,
-    0x01, 0x01, 0x45, 0x4d, 0x00, 0x03, 0x03, 0x00,
-    0x61, 0x0a, 0x01, 0x00, 0x00, 0x43, 0x00, 0x4e,
-    0x18, 0x18, 0x02, 0x01, 0x32, 0x31, 0x30, 0x2f,
-    0x22, 0x21, 0x18, 0x20, 0x18, 0x20, 0x1d, 0x1b,
-    0x15, 0x14, 0x12, 0x10, 0x0d, 0x0c, 0x09, 0x07,
-    0x01, 0x17, 0x02, 0x17, 0x0c, 0x09, 0x21, 0x2b,
-    0xff, 0xff, 0x00, 0x50, 0xff, 0xf6, 0x02, 0x0d,
-    0x03, 0xbb, 0x10, 0x22, 0x00, 0x17, 0x00, 0x00,
-    0x11, 0x03, 0x00, 0x9b, 0x00, 0x00, 0x00, 0xa0,
-    0x00, 0x41, 0x40, 0x3e, 0x00, 0x07, 0x08, 0x07,
-    0x85, 0x09, 0x01, 0x08, 0x02, 0x08, 0x85, 0x00,
-    0x03, 0x04, 0x00, 0x04, 0x03, 0x00, 0x80, 0x00,
-    0x00, 0x00, 0x06, 0x05, 0x00, 0x06, 0x67, 0x00,
-    0x04, 0x04, 0x02, 0x61, 0x00, 0x02, 0x02, 0x42,
-    0x4d, 0x00, 0x05, 0x05, 0x01, 0x61, 0x00, 0x01,
-    0x01, 0x43, 0x01, 0x4e, 0x38, 0x37, 0x11, 0x11,
-    0x13, 0x25, 0x22, 0x12, 0x29, 0x25, 0x11, 0x0a,
-    0x09, 0x2a, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x49,
-    0xff, 0x5b, 0x02, 0x00, 0x03, 0x1b, 0x10, 0x22,
-    0x00, 0x0e, 0x00, 0x00, 0x11, 0x02, 0x00, 0x9b,
-    0x00, 0x00, 0x00, 0x7a, 0xb6, 0x18, 0x09, 0x02,
-    0x05, 0x06, 0x01, 0x4c, 0x4b, 0xb0, 0x18, 0x50,
-    0x58, 0x40, 0x29, 0x00, 0x07, 0x08, 0x07, 0x85,
-    0x09, 0x01, 0x08, 0x00, 0x08, 0x85, 0x00, 0x05,
-    0x00, 0x04, 0x03, 0x05, 0x04, 0x69, 0x00, 0x06,
-    0x06, 0x00, 0x61, 0x01, 0x01, 0x00, 0x00, 0x45,
-    0x4d, 0x00, 0x03, 0x03, 0x02, 0x5f, 0x00, 0x02,
-    0x02, 0x3f, 0x02, 0x4e, 0x1b, 0x40, 0x2d, 0x00,
-    0x07, 0x08, 0x07, 0x85, 0x09, 0x01, 0x08, 0x00,
-    0x08, 0x85, 0x00, 0x05, 0x00, 0x04, 0x03, 0x05,
-    0x04, 0x69, 0x00, 0x01, 0x01, 0x3d, 0x4d, 0x00,
-    0x06, 0x06, 0x00, 0x61, 0x00, 0x00, 0x00, 0x45,
-    0x4d, 0x00, 0x03, 0x03, 0x02, 0x5f, 0x00, 0x02,
-    0x02, 0x3f, 0x02, 0x4e, 0x59, 0x40, 0x0e, 0x41,
-    0x40, 0x11, 0x13, 0x25, 0x27, 0x27, 0x21, 0x23,
-    0x14, 0x25, 0x0a, 0x09, 0x2a, 0x2b, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x50, 0xff, 0xf6, 0x02, 0x0d,
-    0x03, 0xb6, 0x10, 0x22, 0x00, 0x17, 0x00, 0x00,
-    0x11, 0x03, 0x00, 0x8f, 0x00, 0x00, 0x00, 0xa0,
-    0x00, 0x41, 0x40, 0x3e, 0x00, 0x08, 0x00, 0x0a,
-    0x02, 0x08, 0x0a, 0x69, 0x09, 0x01, 0x07, 0x00,
-    0x03, 0x00, 0x07, 0x03, 0x67, 0x00, 0x00, 0x00,
-    0x06, 0x05, 0x00, 0x06, 0x67, 0x00, 0x04, 0x04,
-    0x02, 0x61, 0x00, 0x02, 0x02, 0x42, 0x4d, 0x00,
-    0x05, 0x05, 0x01, 0x61, 0x00, 0x01, 0x01, 0x43,
-    0x01, 0x4e, 0x35, 0x33, 0x2f, 0x2e, 0x22, 0x11,
-    0x13, 0x25, 0x22, 0x12, 0x29, 0x25, 0x11, 0x0b,
-    0x09, 0x2a, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x49,
-    0xff, 0x5b, 0x02, 0x00, 0x03, 0x16, 0x10, 0x22,
-    0x00, 0x0e, 0x00, 0x00, 0x11, 0x02, 0x00, 0x8f,
-    0x00, 0x00, 0x00, 0x86, 0xb6, 0x18, 0x09, 0x02,
-    0x05, 0x06, 0x01, 0x4c, 0x4b, 0xb0, 0x18, 0x50,
-    0x58, 0x40, 0x2e, 0x09, 0x01, 0x07, 0x08, 0x07,
-    0x85, 0x00, 0x05, 0x00, 0x04, 0x03, 0x05, 0x04,
-    0x69, 0x00, 0x0a, 0x0a, 0x08, 0x61, 0x00, 0x08,
-    0x08, 0x3a, 0x4d, 0x00, 0x06, 0x06, 0x00, 0x61,
-    0x01, 0x01, 0x00, 0x00, 0x45, 0x4d, 0x00, 0x03,
-    0x03, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x3f, 0x02,
-    0x4e, 0x1b, 0x40, 0x32, 0x09, 0x01, 0x07, 0x08,
-    0x07, 0x85, 0x00, 0x05, 0x00, 0x04, 0x03, 0x05,
-    0x04, 0x69, 0x00, 0x0a, 0x0a, 0x08, 0x61, 0x00,
-    0x08, 0x08, 0x3a, 0x4d, 0x00, 0x01, 0x01, 0x3d,
-    0x4d, 0x00, 0x06, 0x06, 0x00, 0x61, 0x00, 0x00,
-    0x00, 0x45, 0x4d, 0x00, 0x03, 0x03, 0x02, 0x5f,
-    0x00, 0x02, 0x02, 0x3f, 0x02, 0x4e, 0x59, 0x40,
-    0x10, 0x3e, 0x3c, 0x38, 0x37, 0x22, 0x13, 0x25,
-    0x27, 0x27, 0x21, 0x23, 0x14, 0x25, 0x0b, 0x09,
-    0x2a, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x50,
-    0xff, 0xf6, 0x02, 0x0d, 0x03, 0xc5, 0x10, 0x22,
-    0x00, 0x17, 0x00, 0x00, 0x11, 0x03, 0x00, 0x90,
-    0x00, 0x00, 0x00, 0xa0, 0x00, 0x7e, 0x4b, 0xb0,
-    0x18, 0x50, 0x58, 0x40, 0x30, 0x00, 0x03, 0x04,
-    0x00, 0x04, 0x03, 0x00, 0x80, 0x00, 0x00, 0x00,
-    0x06, 0x05, 0x00, 0x06, 0x67, 0x00, 0x08, 0x08,
-    0x07, 0x61, 0x09, 0x01, 0x07, 0x07, 0x40, 0x4d,
-    0x00, 0x04, 0x04, 0x02, 0x61, 0x00, 0x02, 0x02,
-    0x42, 0x4d, 0x00, 0x05, 0x05, 0x01, 0x61, 0x00,
-    0x01, 0x01, 0x43, 0x01, 0x4e, 0x1b, 0x40, 0x2e,
-    0x00, 0x03, 0x04, 0x00, 0x04, 0x03, 0x00, 0x80,
-    0x09, 0x01, 0x07, 0x00, 0x08, 0x02, 0x07, 0x08,
-    0x69, 0x00, 0x00, 0x00, 0x06, 0x05, 0x00, 0x06,
-    0x67, 0x00, 0x04, 0x04, 0x02, 0x61, 0x00, 0x02,
-    0x02, 0x42, 0x4d, 0x00, 0x05, 0x05, 0x01, 0x61,
-    0x00, 0x01, 0x01, 0x43, 0x01, 0x4e, 0x59, 0x40,
-    0x12, 0x29, 0x27, 0x30, 0x2d, 0x27, 0x34, 0x29,
-    0x34, 0x13, 0x25, 0x22, 0x12, 0x29, 0x25, 0x11,
-    0x0a, 0x09, 0x28, 0x2b, 0xff, 0xff, 0x00, 0x49,
-    0xff, 0x5b, 0x02, 0x00, 0x03, 0x25, 0x10, 0x22,
-    0x00, 0x0e, 0x00, 0x00, 0x11, 0x02, 0x00, 0x90,
-    0x00, 0x00, 0x00, 0x7a, 0xb6, 0x18, 0x09, 0x02,
-    0x05, 0x06, 0x01, 0x4c, 0x4b, 0xb0, 0x18, 0x50,
-    0x58, 0x40, 0x27, 0x09, 0x01, 0x07, 0x00, 0x08,
-    0x00, 0x07, 0x08, 0x69, 0x00, 0x05, 0x00, 0x04,
-    0x03, 0x05, 0x04, 0x69, 0x00, 0x06, 0x06, 0x00,
-    0x61, 0x01, 0x01, 0x00, 0x00, 0x45, 0x4d, 0x00,
-    0x03, 0x03, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x3f,
-    0x02, 0x4e, 0x1b, 0x40, 0x2b, 0x09, 0x01, 0x07,
-    0x00, 0x08, 0x00, 0x07, 0x08, 0x69, 0x00, 0x05,
-    0x00, 0x04, 0x03, 0x05, 0x04, 0x69, 0x00, 0x01,
-    0x01, 0x3d, 0x4d, 0x00, 0x06, 0x06, 0x00, 0x61,
-    0x00, 0x00, 0x00, 0x45, 0x4d, 0x00, 0x03, 0x03,
-    0x02, 0x5f, 0x00, 0x02, 0x02, 0x3f, 0x02, 0x4e,
-    0x59, 0x40, 0x12, 0x32, 0x30, 0x39, 0x36, 0x30,
-    0x3d, 0x32, 0x3d, 0x25, 0x27, 0x27, 0x21, 0x23,
-    0x14, 0x25, 0x0a, 0x09, 0x28, 0x2b, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x5a, 0x00, 0x00, 0x01, 0xfe,
-    0x03, 0xbb, 0x10, 0x22, 0x00, 0x04, 0x00, 0x00,
-    0x11, 0x03, 0x00, 0x9b, 0x00, 0x00, 0x00, 0xa0,
-    0x00, 0x38, 0x40, 0x35, 0x00, 0x06, 0x07, 0x06,
-    0x85, 0x08, 0x01, 0x07, 0x01, 0x07, 0x85, 0x00,
-    0x00, 0x00, 0x03, 0x02, 0x00, 0x03, 0x68, 0x09,
-    0x05, 0x02, 0x01, 0x01, 0x3a, 0x4d, 0x04, 0x01,
-    0x02, 0x02, 0x3b, 0x02, 0x4e, 0x01, 0x01, 0x1e,
-    0x1d, 0x10, 0x0f, 0x0e, 0x0d, 0x01, 0x0c, 0x01,
-    0x0c, 0x11, 0x11, 0x11, 0x11, 0x12, 0x0a, 0x09,
-    0x26, 0x2b, 0x00, 0x00, 0xff, 0xff, 0xff, 0xf1,
-    0x00, 0x00, 0x02, 0x01, 0x03, 0xbb, 0x10, 0x22,
-    0x00, 0x0c, 0x00, 0x00, 0x11, 0x03, 0x00, 0x9b,
-    0xff, 0x6a, 0x00, 0xa0, 0x00, 0x8c, 0xb5, 0x08,
-    0x01, 0x02, 0x03, 0x01, 0x4c, 0x4b, 0xb0, 0x17,
-    0x50, 0x58, 0x40, 0x21, 0x00, 0x05, 0x06, 0x05,
-    0x85, 0x07, 0x01, 0x06, 0x00, 0x06, 0x85, 0x00,
-    0x00, 0x00, 0x3c, 0x4d, 0x00, 0x03, 0x03, 0x01,
-    0x61, 0x00, 0x01, 0x01, 0x45, 0x4d, 0x04, 0x01,
-    0x02, 0x02, 0x3b, 0x02, 0x4e, 0x1b, 0x4b, 0xb0,
-    0x31, 0x50, 0x58, 0x40, 0x21, 0x00, 0x05, 0x06,
-    0x05, 0x85, 0x07, 0x01, 0x06, 0x00, 0x06, 0x85,
-    0x00, 0x00, 0x00, 0x3a, 0x4d, 0x00, 0x03, 0x03,
-    0x01, 0x61, 0x00, 0x01, 0x01, 0x45, 0x4d, 0x04,
-    0x01, 0x02, 0x02, 0x3b, 0x02, 0x4e, 0x1b, 0x40,
-    0x21, 0x00, 0x05, 0x06, 0x05, 0x85, 0x07, 0x01,
-    0x06, 0x00, 0x06, 0x85, 0x00, 0x03, 0x03, 0x01,
-    0x61, 0x00, 0x01, 0x01, 0x45, 0x4d, 0x00, 0x00,
-    0x00, 0x02, 0x5f, 0x04, 0x01, 0x02, 0x02, 0x3b,
-    0x02, 0x4e, 0x59, 0x59, 0x40, 0x0b, 0x1d, 0x11,
-    0x11, 0x13, 0x23, 0x15, 0x29, 0x11, 0x08, 0x09,
-    0x29, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x5f,
-    0x00, 0x00, 0x01, 0xf9, 0x03, 0xbb, 0x10, 0x22,
-    0x00, 0x18, 0x00, 0x00, 0x11, 0x03, 0x00, 0x8c,
-    0x00, 0x00, 0x00, 0xa0, 0x00, 0x90, 0x4b, 0xb0,
-    0x2e, 0x50, 0x58, 0x40, 0x2b, 0x0b, 0x01, 0x07,
-    0x00, 0x09, 0x06, 0x07, 0x09, 0x69, 0x0d, 0x01,
-    0x06, 0x0a, 0x01, 0x08, 0x01, 0x06, 0x08, 0x6a,
-    0x02, 0x01, 0x00, 0x00, 0x01, 0x5f, 0x00, 0x01,
-    0x01, 0x3a, 0x4d, 0x0c, 0x05, 0x02, 0x03, 0x03,
-    0x04, 0x5f, 0x00, 0x04, 0x04, 0x3b, 0x04, 0x4e,
-    0x1b, 0x40, 0x39, 0x00, 0x07, 0x0b, 0x09, 0x0b,
-    0x07, 0x09, 0x80, 0x00, 0x0a, 0x06, 0x08, 0x06,
-    0x0a, 0x08, 0x80, 0x00, 0x0b, 0x00, 0x09, 0x06,
-    0x0b, 0x09, 0x69, 0x0d, 0x01, 0x06, 0x00, 0x08,
-    0x01, 0x06, 0x08, 0x6a, 0x02, 0x01, 0x00, 0x00,
-    0x01, 0x5f, 0x00, 0x01, 0x01, 0x3a, 0x4d, 0x0c,
-    0x05, 0x02, 0x03, 0x03, 0x04, 0x5f, 0x00, 0x04,
-    0x04, 0x3b, 0x04, 0x4e, 0x59, 0x40, 0x1e, 0x0e,
-    0x0d, 0x01, 0x01, 0x25, 0x23, 0x20, 0x1f, 0x1c,
-    0x1a, 0x17, 0x15, 0x12, 0x11, 0x0d, 0x28, 0x0e,
-    0x28, 0x01, 0x0c, 0x01, 0x0c, 0x11, 0x11, 0x11,
-    0x11, 0x12, 0x0e, 0x09, 0x26, 0x2b, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x5a, 0x00, 0x00, 0x02, 0x21,
-    0x03, 0x1b, 0x10, 0x22, 0x00, 0x7a, 0x00, 0x00,
-    0x11, 0x02, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x8a,
-    0x4b, 0xb0, 0x2e, 0x50, 0x58, 0x40, 0x2b, 0x0a,
-    0x01, 0x06, 0x00, 0x08, 0x05, 0x06, 0x08, 0x69,
-    0x09, 0x01, 0x07, 0x07, 0x05, 0x61, 0x0b, 0x01,
-    0x05, 0x05, 0x3a, 0x4d, 0x00, 0x01, 0x01, 0x02,
-    0x5f, 0x00, 0x02, 0x02, 0x3d, 0x4d, 0x03, 0x01,
-    0x00, 0x00, 0x04, 0x5f, 0x00, 0x04, 0x04, 0x3b,
-    0x04, 0x4e, 0x1b, 0x40, 0x39, 0x00, 0x06, 0x0a,
-    0x08, 0x0a, 0x06, 0x08, 0x80, 0x00, 0x09, 0x05,
-    0x07, 0x05, 0x09, 0x07, 0x80, 0x00, 0x0a, 0x00,
-    0x08, 0x05, 0x0a, 0x08, 0x69, 0x00, 0x07, 0x07,
-    0x05, 0x61, 0x0b, 0x01, 0x05, 0x05, 0x3a, 0x4d,
-    0x00, 0x01, 0x01, 0x02, 0x5f, 0x00, 0x02, 0x02,
-    0x3d, 0x4d, 0x03, 0x01, 0x00, 0x00, 0x04, 0x5f,
-    0x00, 0x04, 0x04, 0x3b, 0x04, 0x4e, 0x59, 0x40,
-    0x18, 0x0c, 0x0b, 0x23, 0x21, 0x1e, 0x1d, 0x1a,
-    0x18, 0x15, 0x13, 0x10, 0x0f, 0x0b, 0x26, 0x0c,
-    0x26, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0c, 0x09,
-    0x26, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x5f,
-    0x00, 0x00, 0x01, 0xf9, 0x03, 0xa2, 0x10, 0x22,
-    0x00, 0x18, 0x00, 0x00, 0x11, 0x03, 0x00, 0x8d,
-    0x00, 0x00, 0x00, 0xa0, 0x00, 0x35, 0x40, 0x32,
-    0x00, 0x06, 0x00, 0x07, 0x01, 0x06, 0x07, 0x67,
-    0x02, 0x01, 0x00, 0x00, 0x01, 0x5f, 0x00, 0x01,
-    0x01, 0x3a, 0x4d, 0x08, 0x05, 0x02, 0x03, 0x03,
-    0x04, 0x5f, 0x00, 0x04, 0x04, 0x3b, 0x04, 0x4e,
-    0x01, 0x01, 0x10, 0x0f, 0x0e, 0x0d, 0x01, 0x0c,
-    0x01, 0x0c, 0x11, 0x11, 0x11, 0x11, 0x12, 0x09,
-    0x09, 0x26, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x5a,
-    0x00, 0x00, 0x02, 0x21, 0x03, 0x02, 0x10, 0x22,
-    0x00, 0x7a, 0x00, 0x00, 0x11, 0x02, 0x00, 0x8d,
-    0x00, 0x00, 0x00, 0x2b, 0x40, 0x28, 0x00, 0x05,
-    0x00, 0x06, 0x02, 0x05, 0x06, 0x67, 0x00, 0x01,
-    0x01, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x3d, 0x4d,
-    0x03, 0x01, 0x00, 0x00, 0x04, 0x5f, 0x00, 0x04,
-    0x04, 0x3b, 0x04, 0x4e, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x07, 0x09, 0x28, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0x5f, 0xff, 0x38, 0x01, 0xf9,
-    0x02, 0xd0, 0x10, 0x22, 0x00, 0x18, 0x00, 0x00,
-    0x11, 0x02, 0x00, 0x9f, 0x01, 0x00, 0x00, 0x75,
-    0x4b, 0xb0, 0x13, 0x50, 0x58, 0x40, 0x27, 0x0a,
-    0x01, 0x08, 0x03, 0x04, 0x03, 0x08, 0x72, 0x00,
-    0x06, 0x00, 0x07, 0x06, 0x07, 0x63, 0x02, 0x01,
-    0x00, 0x00, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x3a,
-    0x4d, 0x09, 0x05, 0x02, 0x03, 0x03, 0x04, 0x5f,
-    0x00, 0x04, 0x04, 0x3b, 0x04, 0x4e, 0x1b, 0x40,
-    0x28, 0x0a, 0x01, 0x08, 0x03, 0x04, 0x03, 0x08,
-    0x04, 0x80, 0x00, 0x06, 0x00, 0x07, 0x06, 0x07,
-    0x63, 0x02, 0x01, 0x00, 0x00, 0x01, 0x5f, 0x00,
-    0x01, 0x01, 0x3a, 0x4d, 0x09, 0x05, 0x02, 0x03,
-    0x03, 0x04, 0x5f, 0x00, 0x04, 0x04, 0x3b, 0x04,
-    0x4e, 0x59, 0x40, 0x18, 0x0d, 0x0d, 0x01, 0x01,
-    0x0d, 0x1d, 0x0d, 0x1d, 0x18, 0x16, 0x15, 0x13,
-    0x01, 0x0c, 0x01, 0x0c, 0x11, 0x11, 0x11, 0x11,
-    0x12, 0x0b, 0x09, 0x26, 0x2b, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x5f, 0xff, 0x38, 0x02, 0x26,
-    0x02, 0xfd, 0x10, 0x22, 0x00, 0x09, 0x00, 0x00,
-    0x11, 0x02, 0x00, 0x9f, 0x27, 0x00, 0x00, 0xc9,
-    0x4b, 0xb0, 0x11, 0x50, 0x58, 0x40, 0x31, 0x0c,
-    0x01, 0x09, 0x00, 0x04, 0x00, 0x09, 0x72, 0x00,
-    0x07, 0x00, 0x08, 0x07, 0x08, 0x63, 0x00, 0x06,
-    0x06, 0x05, 0x61, 0x0b, 0x01, 0x05, 0x05, 0x44,
-    0x4d, 0x00, 0x01, 0x01, 0x02, 0x5f, 0x00, 0x02,
-    0x02, 0x3d, 0x4d, 0x03, 0x01, 0x00, 0x00, 0x04,
-    0x5f, 0x0a, 0x01, 0x04, 0x04, 0x3b, 0x04, 0x4e,
-    0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x32,
-    0x0c, 0x01, 0x09, 0x00, 0x04, 0x00, 0x09, 0x04,
-    0x80, 0x00, 0x07, 0x00, 0x08, 0x07, 0x08, 0x63,
-    0x00, 0x06, 0x06, 0x05, 0x61, 0x0b, 0x01, 0x05,
-    0x05, 0x44, 0x4d, 0x00, 0x01, 0x01, 0x02, 0x5f,
-    0x00, 0x02, 0x02, 0x3d, 0x4d, 0x03, 0x01, 0x00,
-    0x00, 0x04, 0x5f, 0x0a, 0x01, 0x04, 0x04, 0x3b,
-    0x04, 0x4e, 0x1b, 0x40, 0x30, 0x0c, 0x01, 0x09,
-    0x00, 0x04, 0x00, 0x09, 0x04, 0x80, 0x0b, 0x01,
-    0x05, 0x00, 0x06, 0x02, 0x05, 0x06, 0x69, 0x00,
-    0x07, 0x00, 0x08, 0x07, 0x08, 0x63, 0x00, 0x01,
-    0x01, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x3d, 0x4d,
-    0x03, 0x01, 0x00, 0x00, 0x04, 0x5f, 0x0a, 0x01,
-    0x04, 0x04, 0x3b, 0x04, 0x4e, 0x59, 0x59, 0x40,
-    0x1f, 0x19, 0x19, 0x0d, 0x0b, 0x01, 0x01, 0x19,
-    0x29, 0x19, 0x29, 0x24, 0x22, 0x21, 0x1f, 0x14,
-    0x11, 0x0b, 0x18, 0x0d, 0x18, 0x01, 0x0a, 0x01,
-    0x0a, 0x11, 0x11, 0x11, 0x12, 0x0d, 0x09, 0x25,
-    0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x5f,
-    0x00, 0x00, 0x01, 0xf9, 0x03, 0xc5, 0x10, 0x22,
-    0x00, 0x18, 0x00, 0x00, 0x11, 0x03, 0x00, 0x90,
-    0x00, 0x00, 0x00, 0xa0, 0x00, 0x68, 0x4b, 0xb0,
-    0x18, 0x50, 0x58, 0x40, 0x23, 0x00, 0x07, 0x07,
-    0x06, 0x61, 0x09, 0x01, 0x06, 0x06, 0x40, 0x4d,
-    0x02, 0x01, 0x00, 0x00, 0x01, 0x5f, 0x00, 0x01,
-    0x01, 0x3a, 0x4d, 0x08, 0x05, 0x02, 0x03, 0x03,
-    0x04, 0x5f, 0x00, 0x04, 0x04, 0x3b, 0x04, 0x4e,
-    0x1b, 0x40, 0x21, 0x09, 0x01, 0x06, 0x00, 0x07,
-    0x01, 0x06, 0x07, 0x69, 0x02, 0x01, 0x00, 0x00,
-    0x01, 0x5f, 0x00, 0x01, 0x01, 0x3a, 0x4d, 0x08,
-    0x05, 0x02, 0x03, 0x03, 0x04, 0x5f, 0x00, 0x04,
-    0x04, 0x3b, 0x04, 0x4e, 0x59, 0x40, 0x16, 0x0f,
-    0x0d, 0x01, 0x01, 0x16, 0x13, 0x0d, 0x1a, 0x0f,
-    0x1a, 0x01, 0x0c, 0x01, 0x0c, 0x11, 0x11, 0x11,
-    0x11, 0x12, 0x0a, 0x09, 0x26, 0x2b, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x55, 0x00, 0x00, 0x02, 0x03,
-    0x03, 0xbc, 0x10, 0x22, 0x00, 0x1d, 0x00, 0x00,
-    0x11, 0x03, 0x00, 0x93, 0x00, 0x00, 0x00, 0xa0,
-    0x00, 0x29, 0x40, 0x26, 0x1b, 0x01, 0x02, 0x00,
-    0x01, 0x4c, 0x00, 0x05, 0x04, 0x05, 0x85, 0x00,
-    0x04, 0x00, 0x04, 0x85, 0x01, 0x01, 0x00, 0x00,
-    0x3a, 0x4d, 0x03, 0x01, 0x02, 0x02, 0x3b, 0x02,
-    0x4e, 0x11, 0x11, 0x1d, 0x11, 0x1d, 0x11, 0x06,
-    0x09, 0x27, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x58,
-    0x00, 0x00, 0x02, 0x01, 0x03, 0x1c, 0x10, 0x22,
-    0x00, 0x05, 0x00, 0x00, 0x11, 0x02, 0x00, 0x93,
-    0x00, 0x00, 0x00, 0x64, 0xb5, 0x04, 0x01, 0x02,
-    0x03, 0x01, 0x4c, 0x4b, 0xb0, 0x18, 0x50, 0x58,
-    0x40, 0x1d, 0x00, 0x06, 0x05, 0x06, 0x85, 0x00,
-    0x05, 0x00, 0x05, 0x85, 0x00, 0x03, 0x03, 0x00,
-    0x61, 0x01, 0x01, 0x00, 0x00, 0x3d, 0x4d, 0x07,
-    0x04, 0x02, 0x02, 0x02, 0x3b, 0x02, 0x4e, 0x1b,
-    0x40, 0x21, 0x00, 0x06, 0x05, 0x06, 0x85, 0x00,
-    0x05, 0x01, 0x05, 0x85, 0x00, 0x00, 0x00, 0x3d,
-    0x4d, 0x00, 0x03, 0x03, 0x01, 0x61, 0x00, 0x01,
-    0x01, 0x45, 0x4d, 0x07, 0x04, 0x02, 0x02, 0x02,
-    0x3b, 0x02, 0x4e, 0x59, 0x40, 0x11, 0x01, 0x01,
-    0x1b, 0x1a, 0x19, 0x18, 0x01, 0x17, 0x01, 0x17,
-    0x23, 0x15, 0x24, 0x12, 0x08, 0x09, 0x25, 0x2b,
-    0xff, 0xff, 0x00, 0x55, 0x00, 0x00, 0x02, 0x03,
-    0x03, 0xbb, 0x10, 0x22, 0x00, 0x1d, 0x00, 0x00,
-    0x11, 0x03, 0x00, 0x9c, 0x00, 0x00, 0x00, 0xa0,
-    0x00, 0x2b, 0x40, 0x28, 0x1b, 0x01, 0x02, 0x00,
-    0x01, 0x4c, 0x05, 0x01, 0x04, 0x06, 0x04, 0x85,
-    0x00, 0x06, 0x00, 0x06, 0x85, 0x01, 0x01, 0x00,
-    0x00, 0x3a, 0x4d, 0x03, 0x01, 0x02, 0x02, 0x3b,
-    0x02, 0x4e, 0x11, 0x1d, 0x11, 0x1d, 0x11, 0x1d,
-    0x11, 0x07, 0x09, 0x28, 0x2b, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x58, 0x00, 0x00, 0x02, 0x01,
-    0x03, 0x1b, 0x10, 0x22, 0x00, 0x05, 0x00, 0x00,
-    0x11, 0x02, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x7c,
-    0xb5, 0x04, 0x01, 0x02, 0x03, 0x01, 0x4c, 0x4b,
-    0xb0, 0x18, 0x50, 0x58, 0x40, 0x28, 0x00, 0x07,
-    0x05, 0x00, 0x05, 0x07, 0x00, 0x80, 0x06, 0x01,
-    0x05, 0x05, 0x02, 0x5f, 0x08, 0x04, 0x02, 0x02,
-    0x02, 0x3b, 0x4d, 0x00, 0x03, 0x03, 0x00, 0x61,
-    0x01, 0x01, 0x00, 0x00, 0x3d, 0x4d, 0x08, 0x04,
-    0x02, 0x02, 0x02, 0x3b, 0x02, 0x4e, 0x1b, 0x40,
-    0x2c, 0x00, 0x07, 0x05, 0x01, 0x05, 0x07, 0x01,
-    0x80, 0x06, 0x01, 0x05, 0x05, 0x02, 0x5f, 0x08,
-    0x04, 0x02, 0x02, 0x02, 0x3b, 0x4d, 0x00, 0x00,
-    0x00, 0x3d, 0x4d, 0x00, 0x03, 0x03, 0x01, 0x61,
-    0x00, 0x01, 0x01, 0x45, 0x4d, 0x08, 0x04, 0x02,
-    0x02, 0x02, 0x3b, 0x02, 0x4e, 0x59, 0x40, 0x13,
-    0x01, 0x01, 0x29, 0x28, 0x27, 0x26, 0x19, 0x18,
-    0x01, 0x17, 0x01, 0x17, 0x23, 0x15, 0x24, 0x12,
-    0x09, 0x09, 0x25, 0x2b, 0xff, 0xff, 0x00, 0x50,
-    0xff, 0xf6, 0x02, 0x08, 0x03, 0xa2, 0x10, 0x22,
-    0x00, 0x0b, 0x00, 0x00, 0x11, 0x03, 0x00, 0x8d,
-    0x00, 0x00, 0x00, 0xa0, 0x00, 0x29, 0x40, 0x26,
-    0x00, 0x04, 0x00, 0x05, 0x02, 0x04, 0x05, 0x67,
-    0x00, 0x01, 0x01, 0x02, 0x61, 0x00, 0x02, 0x02,
-    0x42, 0x4d, 0x00, 0x00, 0x00, 0x03, 0x61, 0x00,
-    0x03, 0x03, 0x43, 0x03, 0x4e, 0x11, 0x15, 0x29,
-    0x27, 0x25, 0x23, 0x06, 0x09, 0x27, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0x50, 0xff, 0xf6, 0x02, 0x08,
-    0x03, 0x02, 0x10, 0x22, 0x00, 0x08, 0x00, 0x00,
-    0x11, 0x02, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x29,
-    0x40, 0x26, 0x00, 0x04, 0x00, 0x05, 0x02, 0x04,
-    0x05, 0x67, 0x00, 0x01, 0x01, 0x02, 0x61, 0x00,
-    0x02, 0x02, 0x45, 0x4d, 0x00, 0x00, 0x00, 0x03,
-    0x61, 0x00, 0x03, 0x03, 0x43, 0x03, 0x4e, 0x11,
-    0x15, 0x27, 0x27, 0x25, 0x23, 0x06, 0x09, 0x27,
-    0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x50,
-    0xff, 0xf6, 0x02, 0x08, 0x03, 0xb6, 0x10, 0x22,
-    0x00, 0x0b, 0x00, 0x00, 0x11, 0x03, 0x00, 0x8f,
-    0x00, 0x00, 0x00, 0xa0, 0x00, 0x31, 0x40, 0x2e,
-    0x06, 0x01, 0x04, 0x05, 0x04, 0x85, 0x00, 0x05,
-    0x00, 0x07, 0x02, 0x05, 0x07, 0x69, 0x00, 0x01,
-    0x01, 0x02, 0x61, 0x00, 0x02, 0x02, 0x42, 0x4d,
-    0x00, 0x00, 0x00, 0x03, 0x61, 0x00, 0x03, 0x03,
-    0x43, 0x03, 0x4e, 0x24, 0x12, 0x22, 0x15, 0x29,
-    0x27, 0x25, 0x23, 0x08, 0x09, 0x29, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0x50, 0xff, 0xf6, 0x02, 0x08,
-    0x03, 0x16, 0x10, 0x22, 0x00, 0x08, 0x00, 0x00,
-    0x11, 0x02, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x33,
-    0x40, 0x30, 0x06, 0x01, 0x04, 0x05, 0x04, 0x85,
-    0x00, 0x07, 0x07, 0x05, 0x61, 0x00, 0x05, 0x05,
-    0x3a, 0x4d, 0x00, 0x01, 0x01, 0x02, 0x61, 0x00,
-    0x02, 0x02, 0x45, 0x4d, 0x00, 0x00, 0x00, 0x03,
-    0x61, 0x00, 0x03, 0x03, 0x43, 0x03, 0x4e, 0x24,
-    0x12, 0x22, 0x15, 0x27, 0x27, 0x25, 0x23, 0x08,
-    0x09, 0x29, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x50,
-    0xff, 0xf6, 0x02, 0x08, 0x03, 0xbc, 0x10, 0x22,
-    0x00, 0x0b, 0x00, 0x00, 0x11, 0x03, 0x00, 0x94,
-    0x00, 0x00, 0x00, 0xa0, 0x00, 0x5c, 0x4b, 0xb0,
-    0x0f, 0x50, 0x58, 0x40, 0x22, 0x06, 0x01, 0x04,
-    0x05, 0x04, 0x85, 0x07, 0x01, 0x05, 0x02, 0x02,
-    0x05, 0x70, 0x00, 0x01, 0x01, 0x02, 0x61, 0x00,
-    0x02, 0x02, 0x42, 0x4d, 0x00, 0x00, 0x00, 0x03,
-    0x61, 0x00, 0x03, 0x03, 0x43, 0x03, 0x4e, 0x1b,
-    0x40, 0x21, 0x06, 0x01, 0x04, 0x05, 0x04, 0x85,
-    0x07, 0x01, 0x05, 0x02, 0x05, 0x85, 0x00, 0x01,
-    0x01, 0x02, 0x61, 0x00, 0x02, 0x02, 0x42, 0x4d,
-    0x00, 0x00, 0x00, 0x03, 0x61, 0x00, 0x03, 0x03,
-    0x43, 0x03, 0x4e, 0x59, 0x40, 0x0b, 0x11, 0x11,
-    0x11, 0x16, 0x29, 0x27, 0x25, 0x23, 0x08, 0x09,
-    0x29, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x50,
-    0xff, 0xf6, 0x02, 0x08, 0x03, 0x1c, 0x10, 0x22,
-    0x00, 0x08, 0x00, 0x00, 0x11, 0x02, 0x00, 0x94,
-    0x00, 0x00, 0x00, 0x5c, 0x4b, 0xb0, 0x0e, 0x50,
-    0x58, 0x40, 0x22, 0x06, 0x01, 0x04, 0x05, 0x04,
-    0x85, 0x07, 0x01, 0x05, 0x02, 0x02, 0x05, 0x70,
-    0x00, 0x01, 0x01, 0x02, 0x61, 0x00, 0x02, 0x02,
-    0x45, 0x4d, 0x00, 0x00, 0x00, 0x03, 0x61, 0x00,
-    0x03, 0x03, 0x43, 0x03, 0x4e, 0x1b, 0x40, 0x21,
-    0x06, 0x01, 0x04, 0x05, 0x04, 0x85, 0x07, 0x01,
-    0x05, 0x02, 0x05, 0x85, 0x00, 0x01, 0x01, 0x02,
-    0x61, 0x00, 0x02, 0x02, 0x45, 0x4d, 0x00, 0x00,
-    0x00, 0x03, 0x61, 0x00, 0x03, 0x03, 0x43, 0x03,
-    0x4e, 0x59, 0x40, 0x0b, 0x11, 0x11, 0x11, 0x16,
-    0x27, 0x27, 0x25, 0x23, 0x08, 0x09, 0x29, 0x2b,
-    0xff, 0xff, 0x00, 0x5a, 0x00, 0x00, 0x02, 0x23,
-    0x03, 0xbc, 0x10, 0x22, 0x00, 0x20, 0x00, 0x00,
-    0x11, 0x03, 0x00, 0x93, 0x00, 0x00, 0x00, 0xa0,
-    0x00, 0x37, 0x40, 0x34, 0x0a, 0x01, 0x02, 0x04,
-    0x01, 0x4c, 0x00, 0x07, 0x06, 0x07, 0x85, 0x00,
-    0x06, 0x00, 0x06, 0x85, 0x00, 0x04, 0x00, 0x02,
-    0x01, 0x04, 0x02, 0x67, 0x00, 0x05, 0x05, 0x00,
-    0x5f, 0x00, 0x00, 0x00, 0x3a, 0x4d, 0x03, 0x01,
-    0x01, 0x01, 0x3b, 0x01, 0x4e, 0x11, 0x11, 0x24,
-    0x21, 0x11, 0x11, 0x18, 0x21, 0x08, 0x09, 0x29,
-    0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x70,
-    0x00, 0x00, 0x02, 0x22, 0x03, 0x1c, 0x10, 0x22,
-    0x00, 0x31, 0x00, 0x00, 0x11, 0x02, 0x00, 0x93,
-    0x00, 0x00, 0x00, 0x69, 0xb5, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x4c, 0x4b, 0xb0, 0x18, 0x50, 0x58,
-    0x40, 0x23, 0x00, 0x06, 0x05, 0x06, 0x85, 0x00,
-    0x05, 0x00, 0x05, 0x85, 0x00, 0x02, 0x03, 0x04,
-    0x03, 0x02, 0x04, 0x80, 0x00, 0x03, 0x03, 0x00,
-    0x61, 0x01, 0x01, 0x00, 0x00, 0x3d, 0x4d, 0x00,
-    0x04, 0x04, 0x3b, 0x04, 0x4e, 0x1b, 0x40, 0x27,
-    0x00, 0x06, 0x05, 0x06, 0x85, 0x00, 0x05, 0x01,
-    0x05, 0x85, 0x00, 0x02, 0x03, 0x04, 0x03, 0x02,
-    0x04, 0x80, 0x00, 0x00, 0x00, 0x3d, 0x4d, 0x00,
-    0x03, 0x03, 0x01, 0x61, 0x00, 0x01, 0x01, 0x45,
-    0x4d, 0x00, 0x04, 0x04, 0x3b, 0x04, 0x4e, 0x59,
-    0x40, 0x0a, 0x11, 0x11, 0x13, 0x23, 0x13, 0x24,
-    0x11, 0x07, 0x09, 0x28, 0x2b, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x5a, 0x00, 0x00, 0x02, 0x23,
-    0x03, 0xbb, 0x10, 0x22, 0x00, 0x20, 0x00, 0x00,
-    0x11, 0x03, 0x00, 0x9c, 0x00, 0x00, 0x00, 0xa0,
-    0x00, 0x39, 0x40, 0x36, 0x0a, 0x01, 0x02, 0x04,
-    0x01, 0x4c, 0x07, 0x01, 0x06, 0x08, 0x06, 0x85,
-    0x00, 0x08, 0x00, 0x08, 0x85, 0x00, 0x04, 0x00,
-    0x02, 0x01, 0x04, 0x02, 0x67, 0x00, 0x05, 0x05,
-    0x00, 0x5f, 0x00, 0x00, 0x00, 0x3a, 0x4d, 0x03,
-    0x01, 0x01, 0x01, 0x3b, 0x01, 0x4e, 0x11, 0x1d,
-    0x11, 0x24, 0x21, 0x11, 0x11, 0x18, 0x21, 0x09,
-    0x09, 0x2a, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x70,
-    0x00, 0x00, 0x02, 0x22, 0x03, 0x1b, 0x10, 0x22,
-    0x00, 0x31, 0x00, 0x00, 0x11, 0x02, 0x00, 0x9c,
-    0x00, 0x00, 0x00, 0x6c, 0xb5, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x4c, 0x4b, 0xb0, 0x18, 0x50, 0x58,
-    0x40, 0x24, 0x06, 0x01, 0x05, 0x07, 0x05, 0x85,
-    0x00, 0x07, 0x00, 0x07, 0x85, 0x00, 0x02, 0x03,
-    0x04, 0x03, 0x02, 0x04, 0x80, 0x00, 0x03, 0x03,
-    0x00, 0x61, 0x01, 0x01, 0x00, 0x00, 0x3d, 0x4d,
-    0x00, 0x04, 0x04, 0x3b, 0x04, 0x4e, 0x1b, 0x40,
-    0x28, 0x06, 0x01, 0x05, 0x07, 0x05, 0x85, 0x00,
-    0x07, 0x01, 0x07, 0x85, 0x00, 0x02, 0x03, 0x04,
-    0x03, 0x02, 0x04, 0x80, 0x00, 0x00, 0x00, 0x3d,
-    0x4d, 0x00, 0x03, 0x03, 0x01, 0x61, 0x00, 0x01,
-    0x01, 0x45, 0x4d, 0x00, 0x04, 0x04, 0x3b, 0x04,
-    0x4e, 0x59, 0x40, 0x0b, 0x11, 0x1d, 0x11, 0x13,
-    0x23, 0x13, 0x24, 0x11, 0x08, 0x09, 0x29, 0x2b,
-    0xff, 0xff, 0x00, 0x46, 0xff, 0xf6, 0x02, 0x12,
-    0x03, 0xbc, 0x10, 0x22, 0x00, 0x21, 0x00, 0x00,
-    0x11, 0x03, 0x00, 0x93, 0x00, 0x00, 0x00, 0xa0,
-    0x00, 0x48, 0x40, 0x45, 0x00, 0x06, 0x07, 0x03,
-    0x07, 0x06, 0x03, 0x80, 0x00, 0x01, 0x04, 0x02,
-    0x04, 0x01, 0x02, 0x80, 0x00, 0x07, 0x00, 0x04,
-    0x01, 0x07, 0x04, 0x67, 0x00, 0x05, 0x05, 0x03,
-    0x61, 0x00, 0x03, 0x03, 0x42, 0x4d, 0x00, 0x02,
-    0x02, 0x00, 0x61, 0x08, 0x01, 0x00, 0x00, 0x43,
-    0x00, 0x4e, 0x02, 0x01, 0x33, 0x32, 0x31, 0x30,
-    0x24, 0x22, 0x1e, 0x1d, 0x19, 0x17, 0x0d, 0x0b,
-    0x07, 0x06, 0x01, 0x2f, 0x02, 0x2f, 0x09, 0x09,
-    0x21, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x4d,
-    0xff, 0xf6, 0x02, 0x06, 0x03, 0x1c, 0x10, 0x22,
-    0x00, 0x32, 0x00, 0x00, 0x11, 0x02, 0x00, 0x93,
-    0x00, 0x00, 0x00, 0x82, 0x4b, 0xb0, 0x15, 0x50,
-    0x58, 0x40, 0x2e, 0x00, 0x07, 0x06, 0x07, 0x85,
-    0x00, 0x06, 0x03, 0x06, 0x85, 0x00, 0x04, 0x05,
-    0x01, 0x05, 0x04, 0x72, 0x00, 0x01, 0x02, 0x05,
-    0x01, 0x02, 0x7e, 0x00, 0x05, 0x05, 0x03, 0x61,
-    0x00, 0x03, 0x03, 0x45, 0x4d, 0x00, 0x02, 0x02,
-    0x00, 0x61, 0x08, 0x01, 0x00, 0x00, 0x43, 0x00,
-    0x4e, 0x1b, 0x40, 0x2f, 0x00, 0x07, 0x06, 0x07,
-    0x85, 0x00, 0x06, 0x03, 0x06, 0x85, 0x00, 0x04,
-    0x05, 0x01, 0x05, 0x04, 0x01, 0x80, 0x00, 0x01,
-    0x02, 0x05, 0x01, 0x02, 0x7e, 0x00, 0x05, 0x05,
-    0x03, 0x61, 0x00, 0x03, 0x03, 0x45, 0x4d, 0x00,
-    0x02, 0x02, 0x00, 0x61, 0x08, 0x01, 0x00, 0x00,
-    0x43, 0x00, 0x4e, 0x59, 0x40, 0x17, 0x02, 0x01,
-    0x31, 0x30, 0x2f, 0x2e, 0x21, 0x1e, 0x1c, 0x1b,
-    0x17, 0x14, 0x0a, 0x07, 0x05, 0x04, 0x01, 0x2d,
-    0x02, 0x2c, 0x09, 0x09, 0x21, 0x2b, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x46, 0xff, 0xf6, 0x02, 0x12,
-    0x03, 0xbb, 0x10, 0x22, 0x00, 0x21, 0x00, 0x00,
-    0x11, 0x03, 0x00, 0x9b, 0x00, 0x00, 0x00, 0xa0,
-    0x00, 0x4c, 0x40, 0x49, 0x00, 0x06, 0x07, 0x06,
-    0x85, 0x08, 0x01, 0x07, 0x03, 0x07, 0x85, 0x00,
-    0x04, 0x05, 0x01, 0x05, 0x04, 0x01, 0x80, 0x00,
-    0x01, 0x02, 0x05, 0x01, 0x02, 0x7e, 0x00, 0x05,
-    0x05, 0x03, 0x61, 0x00, 0x03, 0x03, 0x42, 0x4d,
-    0x00, 0x02, 0x02, 0x00, 0x61, 0x09, 0x01, 0x00,
-    0x00, 0x43, 0x00, 0x4e, 0x02, 0x01, 0x41, 0x40,
-    0x33, 0x32, 0x31, 0x30, 0x24, 0x22, 0x1e, 0x1d,
-    0x19, 0x17, 0x0d, 0x0b, 0x07, 0x06, 0x01, 0x2f,
-    0x02, 0x2f, 0x0a, 0x09, 0x21, 0x2b, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x4d, 0xff, 0xf6, 0x02, 0x06,
-    0x03, 0x1b, 0x10, 0x22, 0x00, 0x32, 0x00, 0x00,
-    0x11, 0x02, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x4c,
-    0x40, 0x49, 0x00, 0x06, 0x07, 0x06, 0x85, 0x08,
-    0x01, 0x07, 0x03, 0x07, 0x85, 0x00, 0x04, 0x05,
-    0x01, 0x05, 0x04, 0x01, 0x80, 0x00, 0x01, 0x02,
-    0x05, 0x01, 0x02, 0x7e, 0x00, 0x05, 0x05, 0x03,
-    0x61, 0x00, 0x03, 0x03, 0x45, 0x4d, 0x00, 0x02,
-    0x02, 0x00, 0x61, 0x09, 0x01, 0x00, 0x00, 0x43,
-    0x00, 0x4e, 0x02, 0x01, 0x3f, 0x3e, 0x31, 0x30,
-    0x2f, 0x2e, 0x21, 0x1e, 0x1c, 0x1b, 0x17, 0x14,
-    0x0a, 0x07, 0x05, 0x04, 0x01, 0x2d, 0x02, 0x2c,
-    0x0a, 0x09, 0x21, 0x2b, 0xff, 0xff, 0x00, 0x46,
-    0xff, 0x42, 0x02, 0x12, 0x02, 0xda, 0x10, 0x22,
-    0x00, 0x21, 0x00, 0x00, 0x11, 0x02, 0x00, 0x9e,
-    0x00, 0x00, 0x00, 0xa7, 0xb5, 0x32, 0x01, 0x09,
-    0x00, 0x01, 0x4c, 0x4b, 0xb0, 0x1c, 0x50, 0x58,
-    0x40, 0x3b, 0x00, 0x04, 0x05, 0x01, 0x05, 0x04,
-    0x01, 0x80, 0x00, 0x01, 0x02, 0x05, 0x01, 0x02,
-    0x7e, 0x00, 0x06, 0x02, 0x00, 0x02, 0x06, 0x72,
-    0x00, 0x09, 0x00, 0x08, 0x00, 0x09, 0x08, 0x80,
-    0x00, 0x08, 0x00, 0x07, 0x08, 0x07, 0x63, 0x00,
-    0x05, 0x05, 0x03, 0x61, 0x00, 0x03, 0x03, 0x42,
-    0x4d, 0x00, 0x02, 0x02, 0x00, 0x61, 0x0a, 0x01,
-    0x00, 0x00, 0x43, 0x00, 0x4e, 0x1b, 0x40, 0x3c,
-    0x00, 0x04, 0x05, 0x01, 0x05, 0x04, 0x01, 0x80,
-    0x00, 0x01, 0x02, 0x05, 0x01, 0x02, 0x7e, 0x00,
-    0x06, 0x02, 0x00, 0x02, 0x06, 0x00, 0x80, 0x00,
-    0x09, 0x00, 0x08, 0x00, 0x09, 0x08, 0x80, 0x00,
-    0x08, 0x00, 0x07, 0x08, 0x07, 0x63, 0x00, 0x05,
-    0x05, 0x03, 0x61, 0x00, 0x03, 0x03, 0x42, 0x4d,
-    0x00, 0x02, 0x02, 0x00, 0x61, 0x0a, 0x01, 0x00,
-    0x00, 0x43, 0x00, 0x4e, 0x59, 0x40, 0x1b, 0x02,
-    0x01, 0x43, 0x42, 0x3e, 0x3c, 0x3b, 0x39, 0x31,
-    0x30, 0x24, 0x22, 0x1e, 0x1d, 0x19, 0x17, 0x0d,
-    0x0b, 0x07, 0x06, 0x01, 0x2f, 0x02, 0x2f, 0x0b,
-    0x09, 0x21, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x4d,
-    0xff, 0x42, 0x02, 0x06, 0x02, 0x30, 0x10, 0x22,
-    0x00, 0x32, 0x00, 0x00, 0x11, 0x02, 0x00, 0x9e,
-    0x00, 0x00, 0x00, 0xa7, 0xb5, 0x30, 0x01, 0x09,
-    0x00, 0x01, 0x4c, 0x4b, 0xb0, 0x1c, 0x50, 0x58,
-    0x40, 0x3b, 0x00, 0x04, 0x05, 0x01, 0x05, 0x04,
-    0x01, 0x80, 0x00, 0x01, 0x02, 0x05, 0x01, 0x02,
-    0x7e, 0x00, 0x06, 0x02, 0x00, 0x02, 0x06, 0x72,
-    0x00, 0x09, 0x00, 0x08, 0x00, 0x09, 0x08, 0x80,
-    0x00, 0x08, 0x00, 0x07, 0x08, 0x07, 0x63, 0x00,
-    0x05, 0x05, 0x03, 0x61, 0x00, 0x03, 0x03, 0x45,
-    0x4d, 0x00, 0x02, 0x02, 0x00, 0x61, 0x0a, 0x01,
-    0x00, 0x00, 0x43, 0x00, 0x4e, 0x1b, 0x40, 0x3c,
-    0x00, 0x04, 0x05, 0x01, 0x05, 0x04, 0x01, 0x80,
-    0x00, 0x01, 0x02, 0x05, 0x01, 0x02, 0x7e, 0x00,
-    0x06, 0x02, 0x00, 0x02, 0x06, 0x00, 0x80, 0x00,
-    0x09, 0x00, 0x08, 0x00, 0x09, 0x08, 0x80, 0x00,
-    0x08, 0x00, 0x07, 0x08, 0x07, 0x63, 0x00, 0x05,
-    0x05, 0x03, 0x61, 0x00, 0x03, 0x03, 0x45, 0x4d,
-    0x00, 0x02, 0x02, 0x00, 0x61, 0x0a, 0x01, 0x00,
-    0x00, 0x43, 0x00, 0x4e, 0x59, 0x40, 0x1b, 0x02,
-    0x01, 0x41, 0x40, 0x3c, 0x3a, 0x39, 0x37, 0x2f,
-    0x2e, 0x21, 0x1e, 0x1c, 0x1b, 0x17, 0x14, 0x0a,
-    0x07, 0x05, 0x04, 0x01, 0x2d, 0x02, 0x2c, 0x0b,
-    0x09, 0x21, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x2d,
-    0x00, 0x00, 0x02, 0x2b, 0x03, 0xbb, 0x10, 0x22,
-    0x00, 0x22, 0x00, 0x00, 0x11, 0x03, 0x00, 0x9c,
-    0x00, 0x00, 0x00, 0xa0, 0x00, 0x29, 0x40, 0x26,
-    0x05, 0x01, 0x04, 0x06, 0x04, 0x85, 0x00, 0x06,
-    0x00, 0x06, 0x85, 0x03, 0x01, 0x01, 0x01, 0x00,
-    0x5f, 0x00, 0x00, 0x00, 0x3a, 0x4d, 0x00, 0x02,
-    0x02, 0x3b, 0x02, 0x4e, 0x11, 0x1d, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x07, 0x09, 0x28, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0x55, 0xff, 0xf6, 0x02, 0x03,
-    0x03, 0xbb, 0x10, 0x22, 0x00, 0x23, 0x00, 0x00,
-    0x11, 0x03, 0x00, 0x8c, 0x00, 0x00, 0x00, 0xa0,
-    0x00, 0x85, 0x4b, 0xb0, 0x2e, 0x50, 0x58, 0x40,
-    0x25, 0x09, 0x01, 0x05, 0x00, 0x07, 0x04, 0x05,
-    0x07, 0x69, 0x0b, 0x01, 0x04, 0x08, 0x01, 0x06,
-    0x01, 0x04, 0x06, 0x6a, 0x03, 0x01, 0x01, 0x01,
-    0x3a, 0x4d, 0x00, 0x02, 0x02, 0x00, 0x61, 0x0a,
-    0x01, 0x00, 0x00, 0x43, 0x00, 0x4e, 0x1b, 0x40,
-    0x33, 0x00, 0x05, 0x09, 0x07, 0x09, 0x05, 0x07,
-    0x80, 0x00, 0x08, 0x04, 0x06, 0x04, 0x08, 0x06,
-    0x80, 0x00, 0x09, 0x00, 0x07, 0x04, 0x09, 0x07,
-    0x69, 0x0b, 0x01, 0x04, 0x00, 0x06, 0x01, 0x04,
-    0x06, 0x6a, 0x03, 0x01, 0x01, 0x01, 0x3a, 0x4d,
-    0x00, 0x02, 0x02, 0x00, 0x61, 0x0a, 0x01, 0x00,
-    0x00, 0x43, 0x00, 0x4e, 0x59, 0x40, 0x1f, 0x14,
-    0x13, 0x02, 0x01, 0x2b, 0x29, 0x26, 0x25, 0x22,
-    0x20, 0x1d, 0x1b, 0x18, 0x17, 0x13, 0x2e, 0x14,
-    0x2e, 0x0f, 0x0e, 0x0b, 0x09, 0x06, 0x05, 0x01,
-    0x12, 0x02, 0x12, 0x0c, 0x09, 0x21, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0x5a, 0xff, 0xf6, 0x01, 0xfe,
-    0x03, 0x1b, 0x10, 0x22, 0x00, 0x5a, 0x00, 0x00,
-    0x11, 0x02, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x7f,
-    0x4b, 0xb0, 0x2e, 0x50, 0x58, 0x40, 0x26, 0x09,
-    0x01, 0x05, 0x00, 0x07, 0x04, 0x05, 0x07, 0x69,
-    0x08, 0x01, 0x06, 0x06, 0x04, 0x61, 0x0a, 0x01,
-    0x04, 0x04, 0x3a, 0x4d, 0x02, 0x01, 0x00, 0x00,
-    0x3d, 0x4d, 0x00, 0x01, 0x01, 0x03, 0x61, 0x00,
-    0x03, 0x03, 0x43, 0x03, 0x4e, 0x1b, 0x40, 0x34,
-    0x00, 0x05, 0x09, 0x07, 0x09, 0x05, 0x07, 0x80,
-    0x00, 0x08, 0x04, 0x06, 0x04, 0x08, 0x06, 0x80,
-    0x00, 0x09, 0x00, 0x07, 0x04, 0x09, 0x07, 0x69,
-    0x00, 0x06, 0x06, 0x04, 0x61, 0x0a, 0x01, 0x04,
-    0x04, 0x3a, 0x4d, 0x02, 0x01, 0x00, 0x00, 0x3d,
-    0x4d, 0x00, 0x01, 0x01, 0x03, 0x61, 0x00, 0x03,
-    0x03, 0x43, 0x03, 0x4e, 0x59, 0x40, 0x17, 0x12,
-    0x11, 0x29, 0x27, 0x24, 0x23, 0x20, 0x1e, 0x1b,
-    0x19, 0x16, 0x15, 0x11, 0x2c, 0x12, 0x2c, 0x23,
-    0x12, 0x22, 0x11, 0x0b, 0x09, 0x25, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0x55, 0xff, 0xf6, 0x02, 0x03,
-    0x03, 0xa2, 0x10, 0x22, 0x00, 0x23, 0x00, 0x00,
-    0x11, 0x03, 0x00, 0x8d, 0x00, 0x00, 0x00, 0xa0,
-    0x00, 0x30, 0x40, 0x2d, 0x00, 0x04, 0x00, 0x05,
-    0x01, 0x04, 0x05, 0x67, 0x03, 0x01, 0x01, 0x01,
-    0x3a, 0x4d, 0x00, 0x02, 0x02, 0x00, 0x61, 0x06,
-    0x01, 0x00, 0x00, 0x43, 0x00, 0x4e, 0x02, 0x01,
-    0x16, 0x15, 0x14, 0x13, 0x0f, 0x0e, 0x0b, 0x09,
-    0x06, 0x05, 0x01, 0x12, 0x02, 0x12, 0x07, 0x09,
-    0x21, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x5a,
-    0xff, 0xf6, 0x01, 0xfe, 0x03, 0x02, 0x10, 0x22,
-    0x00, 0x5a, 0x00, 0x00, 0x11, 0x02, 0x00, 0x8d,
-    0x00, 0x00, 0x00, 0x25, 0x40, 0x22, 0x00, 0x04,
-    0x00, 0x05, 0x00, 0x04, 0x05, 0x67, 0x02, 0x01,
-    0x00, 0x00, 0x3d, 0x4d, 0x00, 0x01, 0x01, 0x03,
-    0x61, 0x00, 0x03, 0x03, 0x43, 0x03, 0x4e, 0x11,
-    0x13, 0x23, 0x12, 0x22, 0x11, 0x06, 0x09, 0x27,
-    0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x55,
-    0xff, 0xf6, 0x02, 0x03, 0x03, 0xb6, 0x10, 0x22,
-    0x00, 0x23, 0x00, 0x00, 0x11, 0x03, 0x00, 0x8f,
-    0x00, 0x00, 0x00, 0xa0, 0x00, 0x3a, 0x40, 0x37,
-    0x06, 0x01, 0x04, 0x05, 0x04, 0x85, 0x00, 0x05,
-    0x00, 0x07, 0x01, 0x05, 0x07, 0x69, 0x03, 0x01,
-    0x01, 0x01, 0x3a, 0x4d, 0x00, 0x02, 0x02, 0x00,
-    0x61, 0x08, 0x01, 0x00, 0x00, 0x43, 0x00, 0x4e,
-    0x02, 0x01, 0x21, 0x1f, 0x1b, 0x1a, 0x18, 0x16,
-    0x14, 0x13, 0x0f, 0x0e, 0x0b, 0x09, 0x06, 0x05,
-    0x01, 0x12, 0x02, 0x12, 0x09, 0x09, 0x21, 0x2b,
-    0xff, 0xff, 0x00, 0x5a, 0xff, 0xf6, 0x01, 0xfe,
-    0x03, 0x16, 0x10, 0x22, 0x00, 0x5a, 0x00, 0x00,
-    0x11, 0x02, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x2f,
-    0x40, 0x2c, 0x06, 0x01, 0x04, 0x05, 0x04, 0x85,
-    0x00, 0x07, 0x07, 0x05, 0x61, 0x00, 0x05, 0x05,
-    0x3a, 0x4d, 0x02, 0x01, 0x00, 0x00, 0x3d, 0x4d,
-    0x00, 0x01, 0x01, 0x03, 0x62, 0x00, 0x03, 0x03,
-    0x43, 0x03, 0x4e, 0x24, 0x12, 0x22, 0x13, 0x23,
-    0x12, 0x22, 0x11, 0x08, 0x09, 0x29, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0x55, 0xff, 0xf6, 0x02, 0x03,
-    0x03, 0xd9, 0x10, 0x22, 0x00, 0x23, 0x00, 0x00,
-    0x11, 0x03, 0x00, 0x91, 0x00, 0x00, 0x00, 0xa0,
-    0x00, 0x3e, 0x40, 0x3b, 0x00, 0x06, 0x00, 0x05,
-    0x01, 0x06, 0x05, 0x69, 0x00, 0x07, 0x07, 0x04,
-    0x61, 0x00, 0x04, 0x04, 0x40, 0x4d, 0x03, 0x01,
-    0x01, 0x01, 0x3a, 0x4d, 0x00, 0x02, 0x02, 0x00,
-    0x61, 0x08, 0x01, 0x00, 0x00, 0x43, 0x00, 0x4e,
-    0x02, 0x01, 0x29, 0x27, 0x23, 0x21, 0x1d, 0x1b,
-    0x17, 0x15, 0x0f, 0x0e, 0x0b, 0x09, 0x06, 0x05,
-    0x01, 0x12, 0x02, 0x12, 0x09, 0x09, 0x21, 0x2b,
-    0xff, 0xff, 0x00, 0x5a, 0xff, 0xf6, 0x01, 0xfe,
-    0x03, 0x39, 0x10, 0x22, 0x00, 0x5a, 0x00, 0x00,
-    0x11, 0x02, 0x00, 0x91, 0x00, 0x00, 0x00, 0x2f,
-    0x40, 0x2c, 0x00, 0x04, 0x00, 0x07, 0x06, 0x04,
-    0x07, 0x69, 0x00, 0x06, 0x00, 0x05, 0x00, 0x06,
-    0x05, 0x69, 0x02, 0x01, 0x00, 0x00, 0x3d, 0x4d,
-    0x00, 0x01, 0x01, 0x03, 0x61, 0x00, 0x03, 0x03,
-    0x43, 0x03, 0x4e, 0x24, 0x24, 0x24, 0x25, 0x23,
-    0x12, 0x22, 0x11, 0x08, 0x09, 0x29, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0x19, 0x00, 0x00, 0x02, 0x3f,
-    0x03, 0xbb, 0x10, 0x22, 0x00, 0x25, 0x00, 0x00,
-    0x11, 0x03, 0x00, 0x9b, 0x00, 0x00, 0x00, 0xa0,
-    0x00, 0x3e, 0x40, 0x3b, 0x00, 0x08, 0x09, 0x08,
-    0x85, 0x0a, 0x01, 0x09, 0x01, 0x09, 0x85, 0x00,
-    0x05, 0x05, 0x01, 0x5f, 0x0b, 0x07, 0x03, 0x03,
-    0x01, 0x01, 0x3a, 0x4d, 0x02, 0x01, 0x00, 0x00,
-    0x04, 0x60, 0x06, 0x01, 0x04, 0x04, 0x3b, 0x04,
-    0x4e, 0x01, 0x01, 0x40, 0x3f, 0x32, 0x31, 0x30,
-    0x2f, 0x01, 0x2e, 0x01, 0x2e, 0x16, 0x16, 0x11,
-    0x16, 0x16, 0x16, 0x17, 0x0c, 0x09, 0x28, 0x2b,
-    0xff, 0xff, 0x00, 0x1e, 0x00, 0x00, 0x02, 0x3a,
-    0x03, 0x1b, 0x10, 0x22, 0x00, 0x35, 0x00, 0x00,
-    0x11, 0x02, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x37,
-    0x40, 0x34, 0x00, 0x08, 0x09, 0x08, 0x85, 0x0a,
-    0x01, 0x09, 0x00, 0x09, 0x85, 0x00, 0x06, 0x06,
-    0x00, 0x5f, 0x04, 0x02, 0x02, 0x00, 0x00, 0x3d,
-    0x4d, 0x03, 0x01, 0x01, 0x01, 0x05, 0x5f, 0x07,
-    0x01, 0x05, 0x05, 0x3b, 0x05, 0x4e, 0x40, 0x3f,
-    0x32, 0x31, 0x11, 0x16, 0x16, 0x11, 0x16, 0x16,
-    0x16, 0x16, 0x11, 0x0b, 0x09, 0x2a, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0x1e, 0x00, 0x00, 0x02, 0x3a,
-    0x03, 0xbb, 0x10, 0x22, 0x00, 0x27, 0x00, 0x00,
-    0x11, 0x03, 0x00, 0x9b, 0x00, 0x00, 0x00, 0xa0,
-    0x00, 0x2b, 0x40, 0x28, 0x14, 0x11, 0x08, 0x03,
-    0x02, 0x00, 0x01, 0x4c, 0x00, 0x03, 0x04, 0x03,
-    0x85, 0x05, 0x01, 0x04, 0x00, 0x04, 0x85, 0x01,
-    0x01, 0x00, 0x00, 0x3a, 0x4d, 0x00, 0x02, 0x02,
-    0x3b, 0x02, 0x4e, 0x1d, 0x11, 0x12, 0x12, 0x1d,
-    0x11, 0x06, 0x09, 0x27, 0x2b, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x32, 0xff, 0x5b, 0x02, 0x26,
-    0x03, 0x1b, 0x10, 0x22, 0x00, 0x37, 0x00, 0x00,
-    0x11, 0x02, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x33,
-    0x40, 0x30, 0x12, 0x07, 0x02, 0x01, 0x00, 0x01,
-    0x4c, 0x00, 0x03, 0x04, 0x03, 0x85, 0x05, 0x01,
-    0x04, 0x00, 0x04, 0x85, 0x06, 0x02, 0x02, 0x00,
-    0x00, 0x3d, 0x4d, 0x00, 0x01, 0x01, 0x3f, 0x01,
-    0x4e, 0x01, 0x01, 0x25, 0x24, 0x17, 0x16, 0x15,
-    0x14, 0x01, 0x13, 0x01, 0x13, 0x11, 0x1e, 0x07,
-    0x09, 0x23, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x55,
-    0x00, 0x00, 0x02, 0x03, 0x03, 0xbc, 0x10, 0x22,
-    0x00, 0x28, 0x00, 0x00, 0x11, 0x03, 0x00, 0x93,
-    0x00, 0x00, 0x00, 0xa0, 0x00, 0x3a, 0x40, 0x37,
-    0x09, 0x02, 0x02, 0x00, 0x02, 0x01, 0x4c, 0x00,
-    0x05, 0x04, 0x05, 0x85, 0x00, 0x04, 0x03, 0x04,
-    0x85, 0x00, 0x02, 0x02, 0x03, 0x5f, 0x06, 0x01,
-    0x03, 0x03, 0x3a, 0x4d, 0x00, 0x00, 0x00, 0x01,
-    0x5f, 0x00, 0x01, 0x01, 0x3b, 0x01, 0x4e, 0x01,
-    0x01, 0x12, 0x11, 0x10, 0x0f, 0x01, 0x0e, 0x01,
-    0x0e, 0x32, 0x11, 0x33, 0x07, 0x09, 0x24, 0x2b,
-    0xff, 0xff, 0x00, 0x50, 0x00, 0x00, 0x02, 0x08,
-    0x03, 0x1c, 0x10, 0x22, 0x00, 0x38, 0x00, 0x00,
-    0x11, 0x02, 0x00, 0x93, 0x00, 0x00, 0x00, 0x38,
-    0x40, 0x35, 0x0d, 0x03, 0x02, 0x01, 0x03, 0x04,
-    0x01, 0x02, 0x01, 0x02, 0x4c, 0x00, 0x06, 0x05,
-    0x06, 0x85, 0x00, 0x05, 0x00, 0x05, 0x85, 0x04,
-    0x01, 0x03, 0x03, 0x00, 0x5f, 0x00, 0x00, 0x00,
-    0x3d, 0x4d, 0x00, 0x01, 0x01, 0x02, 0x5f, 0x00,
-    0x02, 0x02, 0x3b, 0x02, 0x4e, 0x11, 0x11, 0x31,
-    0x13, 0x11, 0x35, 0x11, 0x07, 0x09, 0x28, 0x2b,
-    0xff, 0xff, 0x00, 0x55, 0x00, 0x00, 0x02, 0x03,
-    0x03, 0xc5, 0x10, 0x22, 0x00, 0x28, 0x00, 0x00,
-    0x11, 0x03, 0x00, 0x90, 0x00, 0x0a, 0x00, 0xa0,
-    0x00, 0x6a, 0xb6, 0x09, 0x02, 0x02, 0x00, 0x02,
-    0x01, 0x4c, 0x4b, 0xb0, 0x18, 0x50, 0x58, 0x40,
-    0x21, 0x00, 0x05, 0x05, 0x04, 0x61, 0x07, 0x01,
-    0x04, 0x04, 0x40, 0x4d, 0x00, 0x02, 0x02, 0x03,
-    0x5f, 0x06, 0x01, 0x03, 0x03, 0x3a, 0x4d, 0x00,
-    0x00, 0x00, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x3b,
-    0x01, 0x4e, 0x1b, 0x40, 0x1f, 0x07, 0x01, 0x04,
-    0x00, 0x05, 0x03, 0x04, 0x05, 0x69, 0x00, 0x02,
-    0x02, 0x03, 0x5f, 0x06, 0x01, 0x03, 0x03, 0x3a,
-    0x4d, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x00, 0x01,
-    0x01, 0x3b, 0x01, 0x4e, 0x59, 0x40, 0x14, 0x11,
-    0x0f, 0x01, 0x01, 0x18, 0x15, 0x0f, 0x1c, 0x11,
-    0x1c, 0x01, 0x0e, 0x01, 0x0e, 0x32, 0x11, 0x33,
-    0x08, 0x09, 0x24, 0x2b, 0xff, 0xff, 0x00, 0x50,
-    0x00, 0x00, 0x02, 0x08, 0x03, 0x25, 0x10, 0x22,
-    0x00, 0x38, 0x00, 0x00, 0x11, 0x02, 0x00, 0x90,
-    0x0a, 0x00, 0x00, 0x3d, 0x40, 0x3a, 0x0d, 0x03,
-    0x02, 0x01, 0x03, 0x04, 0x01, 0x02, 0x01, 0x02,
-    0x4c, 0x07, 0x01, 0x05, 0x00, 0x06, 0x00, 0x05,
-    0x06, 0x69, 0x04, 0x01, 0x03, 0x03, 0x00, 0x5f,
-    0x00, 0x00, 0x00, 0x3d, 0x4d, 0x00, 0x01, 0x01,
-    0x02, 0x5f, 0x00, 0x02, 0x02, 0x3b, 0x02, 0x4e,
-    0x17, 0x15, 0x1e, 0x1b, 0x15, 0x22, 0x17, 0x22,
-    0x31, 0x13, 0x11, 0x35, 0x11, 0x08, 0x09, 0x26,
-    0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x19,
-    0x00, 0x00, 0x02, 0x3f, 0x03, 0xbc, 0x10, 0x22,
-    0x00, 0x25, 0x00, 0x00, 0x11, 0x03, 0x00, 0x92,
-    0x00, 0x00, 0x00, 0xa0, 0x00, 0x3b, 0x40, 0x38,
-    0x00, 0x08, 0x09, 0x08, 0x85, 0x00, 0x09, 0x01,
-    0x09, 0x85, 0x00, 0x05, 0x05, 0x01, 0x5f, 0x0a,
-    0x07, 0x03, 0x03, 0x01, 0x01, 0x3a, 0x4d, 0x02,
-    0x01, 0x00, 0x00, 0x04, 0x60, 0x06, 0x01, 0x04,
-    0x04, 0x3b, 0x04, 0x4e, 0x01, 0x01, 0x32, 0x31,
-    0x30, 0x2f, 0x01, 0x2e, 0x01, 0x2e, 0x16, 0x16,
-    0x11, 0x16, 0x16, 0x16, 0x17, 0x0b, 0x09, 0x28,
-    0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x1e,
-    0x00, 0x00, 0x02, 0x3a, 0x03, 0x1c, 0x10, 0x22,
-    0x00, 0x35, 0x00, 0x00, 0x11, 0x02, 0x00, 0x92,
-    0x00, 0x00, 0x00, 0x34, 0x40, 0x31, 0x00, 0x08,
-    0x09, 0x08, 0x85, 0x00, 0x09, 0x00, 0x09, 0x85,
-    0x00, 0x06, 0x06, 0x00, 0x5f, 0x04, 0x02, 0x02,
-    0x00, 0x00, 0x3d, 0x4d, 0x03, 0x01, 0x01, 0x01,
-    0x05, 0x60, 0x07, 0x01, 0x05, 0x05, 0x3b, 0x05,
-    0x4e, 0x32, 0x31, 0x11, 0x16, 0x16, 0x11, 0x16,
-    0x16, 0x16, 0x16, 0x11, 0x0a, 0x09, 0x2a, 0x2b,
-    0xff, 0xff, 0x00, 0x19, 0x00, 0x00, 0x02, 0x3f,
-    0x03, 0xbc, 0x10, 0x22, 0x00, 0x25, 0x00, 0x00,
-    0x11, 0x03, 0x00, 0x93, 0x00, 0x00, 0x00, 0xa0,
-    0x00, 0x3b, 0x40, 0x38, 0x00, 0x09, 0x08, 0x09,
-    0x85, 0x00, 0x08, 0x01, 0x08, 0x85, 0x00, 0x05,
-    0x05, 0x01, 0x5f, 0x0a, 0x07, 0x03, 0x03, 0x01,
-    0x01, 0x3a, 0x4d, 0x02, 0x01, 0x00, 0x00, 0x04,
-    0x60, 0x06, 0x01, 0x04, 0x04, 0x3b, 0x04, 0x4e,
-    0x01, 0x01, 0x32, 0x31, 0x30, 0x2f, 0x01, 0x2e,
-    0x01, 0x2e, 0x16, 0x16, 0x11, 0x16, 0x16, 0x16,
-    0x17, 0x0b, 0x09, 0x28, 0x2b, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x1e, 0x00, 0x00, 0x02, 0x3a,
-    0x03, 0x1c, 0x10, 0x22, 0x00, 0x35, 0x00, 0x00,
-    0x11, 0x02, 0x00, 0x93, 0x00, 0x00, 0x00, 0x34,
-    0x40, 0x31, 0x00, 0x09, 0x08, 0x09, 0x85, 0x00,
-    0x08, 0x00, 0x08, 0x85, 0x00, 0x06, 0x06, 0x00,
-    0x5f, 0x04, 0x02, 0x02, 0x00, 0x00, 0x3d, 0x4d,
-    0x03, 0x01, 0x01, 0x01, 0x05, 0x60, 0x07, 0x01,
-    0x05, 0x05, 0x3b, 0x05, 0x4e, 0x32, 0x31, 0x11,
-    0x16, 0x16, 0x11, 0x16, 0x16, 0x16, 0x16, 0x11,
-    0x0a, 0x09, 0x2a, 0x2b, 0xff, 0xff, 0x00, 0x19,
-    0x00, 0x00, 0x02, 0x3f, 0x03, 0xb3, 0x10, 0x22,
-    0x00, 0x25, 0x00, 0x00, 0x11, 0x03, 0x00, 0x99,
-    0x00, 0x00, 0x00, 0xa0, 0x00, 0x3f, 0x40, 0x3c,
-    0x0a, 0x01, 0x08, 0x0b, 0x01, 0x09, 0x01, 0x08,
-    0x09, 0x69, 0x00, 0x05, 0x05, 0x01, 0x5f, 0x0c,
-    0x07, 0x03, 0x03, 0x01, 0x01, 0x3a, 0x4d, 0x02,
-    0x01, 0x00, 0x00, 0x04, 0x60, 0x06, 0x01, 0x04,
-    0x04, 0x3b, 0x04, 0x4e, 0x01, 0x01, 0x45, 0x43,
-    0x3f, 0x3d, 0x39, 0x37, 0x33, 0x31, 0x01, 0x2e,
-    0x01, 0x2e, 0x16, 0x16, 0x11, 0x16, 0x16, 0x16,
-    0x17, 0x0d, 0x09, 0x28, 0x2b, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x1e, 0x00, 0x00, 0x02, 0x3a,
-    0x03, 0x13, 0x10, 0x22, 0x00, 0x35, 0x00, 0x00,
-    0x11, 0x02, 0x00, 0x99, 0x00, 0x00, 0x00, 0x68,
-    0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x25, 0x0b,
-    0x01, 0x09, 0x09, 0x08, 0x61, 0x0a, 0x01, 0x08,
-    0x08, 0x44, 0x4d, 0x00, 0x06, 0x06, 0x00, 0x5f,
-    0x04, 0x02, 0x02, 0x00, 0x00, 0x3d, 0x4d, 0x03,
-    0x01, 0x01, 0x01, 0x05, 0x5f, 0x07, 0x01, 0x05,
-    0x05, 0x3b, 0x05, 0x4e, 0x1b, 0x40, 0x23, 0x0a,
-    0x01, 0x08, 0x0b, 0x01, 0x09, 0x00, 0x08, 0x09,
-    0x69, 0x00, 0x06, 0x06, 0x00, 0x5f, 0x04, 0x02,
-    0x02, 0x00, 0x00, 0x3d, 0x4d, 0x03, 0x01, 0x01,
-    0x01, 0x05, 0x5f, 0x07, 0x01, 0x05, 0x05, 0x3b,
-    0x05, 0x4e, 0x59, 0x40, 0x12, 0x45, 0x43, 0x3f,
-    0x3d, 0x39, 0x37, 0x23, 0x16, 0x16, 0x11, 0x16,
-    0x16, 0x16, 0x16, 0x11, 0x0c, 0x09, 0x2a, 0x2b,
-    0xff, 0xff, 0x00, 0xaa, 0x03, 0x2a, 0x01, 0x86,
-    0x03, 0xbc, 0x11, 0x03, 0x00, 0x92, 0x00, 0x00,
-    0x00, 0xa0, 0x00, 0x11, 0x40, 0x0e, 0x00, 0x00,
-    0x01, 0x00, 0x85, 0x00, 0x01, 0x01, 0x76, 0x11,
-    0x11, 0x02, 0x06, 0x23, 0x2b, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x8c, 0x03, 0x3b, 0x01, 0xcc,
-    0x03, 0xb3, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x1d,
-    0x40, 0x1a, 0x02, 0x01, 0x00, 0x01, 0x01, 0x00,
-    0x59, 0x02, 0x01, 0x00, 0x00, 0x01, 0x61, 0x03,
-    0x01, 0x01, 0x00, 0x01, 0x51, 0x24, 0x24, 0x24,
-    0x22, 0x04, 0x07, 0x1a, 0x2b, 0x13, 0x34, 0x36,
-    0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22,
-    0x26, 0x37, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15,
-    0x14, 0x06, 0x23, 0x22, 0x26, 0x8c, 0x21, 0x1b,
-    0x1b, 0x21, 0x21, 0x1b, 0x1b, 0x21, 0xc8, 0x21,
-    0x1b, 0x1b, 0x21, 0x21, 0x1b, 0x1b, 0x21, 0x03,
-    0x77, 0x1b, 0x21, 0x21, 0x1b, 0x1b, 0x21, 0x21,
-    0x1b, 0x1b, 0x21, 0x21, 0x1b, 0x1b, 0x21, 0x21,
-    0xff, 0xff, 0x00, 0xaa, 0x03, 0x57, 0x01, 0xae,
-    0x03, 0xa2, 0x11, 0x03, 0x00, 0x8d, 0x00, 0x00,
-    0x00, 0xa0, 0x00, 0x18, 0x40, 0x15, 0x00, 0x00,
-    0x01, 0x01, 0x00, 0x57, 0x00, 0x00, 0x00, 0x01,
-    0x5f, 0x00, 0x01, 0x00, 0x01, 0x4f, 0x11, 0x11,
-    0x02, 0x06, 0x23, 0x2b, 0x00, 0x01, 0x00, 0xbe,
-    0x03, 0x20, 0x01, 0x9a, 0x03, 0xb2, 0x00, 0x03,
-    0x00, 0x11, 0x40, 0x0e, 0x00, 0x01, 0x00, 0x01,
-    0x85, 0x00, 0x00, 0x00, 0x76, 0x11, 0x10, 0x02,
-    0x09, 0x18, 0x2b, 0x01, 0x23, 0x37, 0x33, 0x01,
-    0x18, 0x5a, 0x6e, 0x6e, 0x03, 0x20, 0x92, 0x00,
-    0xff, 0xff, 0x00, 0x87, 0x03, 0x2a, 0x01, 0xd1,
-    0x03, 0xbb, 0x11, 0x03, 0x00, 0x9b, 0x00, 0x00,
-    0x00, 0xa0, 0x00, 0x13, 0x40, 0x10, 0x00, 0x00,
-    0x01, 0x00, 0x85, 0x02, 0x01, 0x01, 0x01, 0x76,
-    0x1d, 0x11, 0x11, 0x03, 0x09, 0x24, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0x87, 0x03, 0x2a, 0x01, 0xd1,
-    0x03, 0xbb, 0x11, 0x03, 0x00, 0x9c, 0x00, 0x00,
-    0x00, 0xa0, 0x00, 0x13, 0x40, 0x10, 0x01, 0x01,
-    0x00, 0x02, 0x00, 0x85, 0x00, 0x02, 0x02, 0x76,
-    0x11, 0x1d, 0x11, 0x03, 0x06, 0x24, 0x2b, 0x00,
-    0x00, 0x01, 0x00, 0x8c, 0x03, 0x25, 0x01, 0xcc,
-    0x03, 0xac, 0x00, 0x0c, 0x00, 0x20, 0x40, 0x1d,
-    0x02, 0x01, 0x00, 0x01, 0x00, 0x85, 0x00, 0x01,
-    0x03, 0x03, 0x01, 0x59, 0x00, 0x01, 0x01, 0x03,
-    0x61, 0x00, 0x03, 0x01, 0x03, 0x51, 0x22, 0x12,
-    0x21, 0x10, 0x04, 0x09, 0x1a, 0x2b, 0x13, 0x33,
-    0x14, 0x33, 0x32, 0x36, 0x35, 0x33, 0x14, 0x06,
-    0x23, 0x22, 0x26, 0x8c, 0x4b, 0x54, 0x2a, 0x2c,
-    0x4b, 0x58, 0x48, 0x48, 0x58, 0x03, 0xac, 0x46,
-    0x24, 0x22, 0x3d, 0x4a, 0x4a, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0xd7, 0x03, 0x4d, 0x01, 0x6d,
-    0x03, 0xc5, 0x11, 0x03, 0x00, 0x90, 0x00, 0x00,
-    0x00, 0xa0, 0x00, 0x37, 0x4b, 0xb0, 0x19, 0x50,
-    0x58, 0x40, 0x0c, 0x00, 0x01, 0x01, 0x00, 0x61,
-    0x02, 0x01, 0x00, 0x00, 0x64, 0x01, 0x4e, 0x1b,
-    0x40, 0x12, 0x02, 0x01, 0x00, 0x01, 0x01, 0x00,
-    0x59, 0x02, 0x01, 0x00, 0x00, 0x01, 0x61, 0x00,
-    0x01, 0x00, 0x01, 0x51, 0x59, 0x40, 0x0b, 0x03,
-    0x01, 0x0a, 0x07, 0x01, 0x0e, 0x03, 0x0e, 0x03,
-    0x06, 0x21, 0x2b, 0x00, 0xff, 0xff, 0x00, 0xb4,
-    0x03, 0x07, 0x01, 0xa4, 0x03, 0xd9, 0x11, 0x03,
-    0x00, 0x91, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x1c,
-    0x40, 0x19, 0x00, 0x02, 0x00, 0x01, 0x02, 0x01,
-    0x65, 0x00, 0x03, 0x03, 0x00, 0x61, 0x00, 0x00,
-    0x00, 0x64, 0x03, 0x4e, 0x24, 0x24, 0x24, 0x23,
-    0x04, 0x06, 0x25, 0x2b, 0xff, 0xff, 0x00, 0x69,
-    0x03, 0x2a, 0x01, 0xef, 0x03, 0xbb, 0x11, 0x03,
-    0x00, 0x8c, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x73,
-    0x4b, 0xb0, 0x11, 0x50, 0x58, 0x40, 0x28, 0x00,
-    0x01, 0x05, 0x03, 0x00, 0x01, 0x72, 0x00, 0x04,
-    0x00, 0x02, 0x03, 0x04, 0x72, 0x00, 0x05, 0x00,
-    0x03, 0x00, 0x05, 0x03, 0x69, 0x06, 0x01, 0x00,
-    0x04, 0x02, 0x00, 0x59, 0x06, 0x01, 0x00, 0x00,
-    0x02, 0x62, 0x00, 0x02, 0x00, 0x02, 0x52, 0x1b,
-    0x40, 0x2a, 0x00, 0x01, 0x05, 0x03, 0x05, 0x01,
-    0x03, 0x80, 0x00, 0x04, 0x00, 0x02, 0x00, 0x04,
-    0x02, 0x80, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05,
-    0x03, 0x69, 0x06, 0x01, 0x00, 0x04, 0x02, 0x00,
-    0x59, 0x06, 0x01, 0x00, 0x00, 0x02, 0x62, 0x00,
-    0x02, 0x00, 0x02, 0x52, 0x59, 0x40, 0x13, 0x02,
-    0x01, 0x19, 0x17, 0x14, 0x13, 0x10, 0x0e, 0x0b,
-    0x09, 0x06, 0x05, 0x01, 0x1c, 0x02, 0x1c, 0x07,
-    0x06, 0x21, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x78,
-    0x03, 0x2a, 0x02, 0x1c, 0x03, 0xbc, 0x11, 0x03,
-    0x00, 0x94, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x1d,
-    0x40, 0x1a, 0x02, 0x01, 0x00, 0x01, 0x01, 0x00,
-    0x57, 0x02, 0x01, 0x00, 0x00, 0x01, 0x5f, 0x03,
-    0x01, 0x01, 0x00, 0x01, 0x4f, 0x11, 0x11, 0x11,
-    0x12, 0x04, 0x06, 0x25, 0x2b, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x87, 0x02, 0x8a, 0x01, 0xd1,
-    0x03, 0x1b, 0x11, 0x02, 0x00, 0x9c, 0x00, 0x00,
-    0x00, 0x13, 0x40, 0x10, 0x01, 0x01, 0x00, 0x02,
-    0x00, 0x85, 0x00, 0x02, 0x02, 0x76, 0x11, 0x1d,
-    0x11, 0x03, 0x06, 0x24, 0x2b, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0xd7, 0xff, 0x10, 0x01, 0x81,
-    0xff, 0xa2, 0x00, 0x03, 0x00, 0x19, 0x40, 0x16,
-    0x02, 0x01, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00,
-    0x00, 0x41, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x03,
-    0x00, 0x03, 0x11, 0x03, 0x09, 0x17, 0x2b, 0x05,
-    0x07, 0x23, 0x37, 0x01, 0x81, 0x50, 0x5a, 0x3c,
-    0x5e, 0x92, 0x92, 0x00, 0xff, 0xff, 0x00, 0xd7,
-    0xff, 0x10, 0x01, 0x81, 0xff, 0xa2, 0x11, 0x02,
-    0x01, 0x3f, 0x00, 0x00, 0x00, 0x19, 0x40, 0x16,
-    0x02, 0x01, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00,
-    0x00, 0x65, 0x00, 0x4e, 0x01, 0x01, 0x01, 0x04,
-    0x01, 0x04, 0x12, 0x03, 0x06, 0x22, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0x69, 0x00, 0x00, 0x02, 0x17,
-    0x02, 0xd0, 0x10, 0x22, 0x00, 0x1b, 0x00, 0x00,
-    0x11, 0x02, 0x00, 0x67, 0x5f, 0x00, 0x00, 0x2b,
-    0x40, 0x28, 0x00, 0x03, 0x00, 0x04, 0x00, 0x03,
-    0x04, 0x69, 0x05, 0x01, 0x02, 0x02, 0x3a, 0x4d,
-    0x00, 0x00, 0x00, 0x01, 0x60, 0x00, 0x01, 0x01,
-    0x3b, 0x01, 0x4e, 0x01, 0x01, 0x12, 0x10, 0x0c,
-    0x0a, 0x01, 0x06, 0x01, 0x06, 0x11, 0x12, 0x06,
-    0x09, 0x23, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x14,
-    0x00, 0x00, 0x02, 0x22, 0x02, 0xda, 0x10, 0x22,
-    0x00, 0x0a, 0xec, 0x00, 0x11, 0x03, 0x00, 0x67,
-    0x00, 0xa0, 0x00, 0x00, 0x00, 0x7f, 0x4b, 0xb0,
-    0x17, 0x50, 0x58, 0x40, 0x1e, 0x00, 0x04, 0x00,
-    0x05, 0x00, 0x04, 0x05, 0x69, 0x00, 0x02, 0x02,
-    0x03, 0x5f, 0x06, 0x01, 0x03, 0x03, 0x3c, 0x4d,
-    0x00, 0x00, 0x00, 0x01, 0x5f, 0x00, 0x01, 0x01,
-    0x3b, 0x01, 0x4e, 0x1b, 0x4b, 0xb0, 0x31, 0x50,
-    0x58, 0x40, 0x1e, 0x00, 0x04, 0x00, 0x05, 0x00,
-    0x04, 0x05, 0x69, 0x00, 0x02, 0x02, 0x03, 0x5f,
-    0x06, 0x01, 0x03, 0x03, 0x3a, 0x4d, 0x00, 0x00,
-    0x00, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x3b, 0x01,
-    0x4e, 0x1b, 0x40, 0x1c, 0x06, 0x01, 0x03, 0x00,
-    0x02, 0x04, 0x03, 0x02, 0x67, 0x00, 0x04, 0x00,
-    0x05, 0x00, 0x04, 0x05, 0x69, 0x00, 0x00, 0x00,
-    0x01, 0x5f, 0x00, 0x01, 0x01, 0x3b, 0x01, 0x4e,
-    0x59, 0x59, 0x40, 0x10, 0x01, 0x01, 0x1a, 0x18,
-    0x14, 0x12, 0x01, 0x0e, 0x01, 0x0e, 0x13, 0x21,
-    0x24, 0x07, 0x09, 0x24, 0x2b, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x96, 0x01, 0xc2, 0x01, 0xc2,
-    0x02, 0xe4, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x2a,
-    0xb1, 0x06, 0x64, 0x44, 0x40, 0x1f, 0x00, 0x00,
-    0x00, 0x03, 0x02, 0x00, 0x03, 0x69, 0x00, 0x02,
-    0x01, 0x01, 0x02, 0x59, 0x00, 0x02, 0x02, 0x01,
-    0x61, 0x00, 0x01, 0x02, 0x01, 0x51, 0x24, 0x24,
-    0x24, 0x22, 0x04, 0x09, 0x1a, 0x2b, 0xb1, 0x06,
-    0x00, 0x44, 0x13, 0x34, 0x36, 0x33, 0x32, 0x16,
-    0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x37, 0x14,
-    0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23,
-    0x22, 0x06, 0x96, 0x52, 0x44, 0x44, 0x52, 0x52,
-    0x44, 0x44, 0x52, 0x3c, 0x31, 0x28, 0x2a, 0x31,
-    0x31, 0x2a, 0x28, 0x31, 0x02, 0x53, 0x42, 0x4f,
-    0x4f, 0x42, 0x42, 0x4f, 0x4f, 0x42, 0x2a, 0x34,
-    0x34, 0x2a, 0x2b, 0x34, 0x34, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x3c, 0xff, 0x10, 0x02, 0x0d,
-    0x02, 0xd0, 0x10, 0x22, 0x00, 0x33, 0x00, 0x00,
-    0x11, 0x02, 0x01, 0x3f, 0x00, 0x00, 0x00, 0x3b,
-    0x40, 0x38, 0x00, 0x01, 0x01, 0x3a, 0x4d, 0x06,
-    0x01, 0x03, 0x03, 0x00, 0x5f, 0x02, 0x01, 0x00,
-    0x00, 0x3d, 0x4d, 0x00, 0x04, 0x04, 0x05, 0x60,
-    0x00, 0x05, 0x05, 0x3b, 0x4d, 0x09, 0x01, 0x08,
-    0x08, 0x07, 0x5f, 0x00, 0x07, 0x07, 0x41, 0x07,
-    0x4e, 0x15, 0x15, 0x15, 0x18, 0x15, 0x18, 0x12,
-    0x13, 0x21, 0x23, 0x11, 0x11, 0x11, 0x11, 0x0a,
-    0x09, 0x29, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x69,
-    0xff, 0x10, 0x02, 0x17, 0x02, 0xd0, 0x10, 0x22,
-    0x00, 0x1b, 0x00, 0x00, 0x11, 0x02, 0x01, 0x3f,
-    0x00, 0x00, 0x00, 0x32, 0x40, 0x2f, 0x05, 0x01,
-    0x02, 0x02, 0x3a, 0x4d, 0x00, 0x00, 0x00, 0x01,
-    0x60, 0x00, 0x01, 0x01, 0x3b, 0x4d, 0x06, 0x01,
-    0x04, 0x04, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x41,
-    0x03, 0x4e, 0x07, 0x07, 0x01, 0x01, 0x07, 0x0a,
-    0x07, 0x0a, 0x09, 0x08, 0x01, 0x06, 0x01, 0x06,
-    0x11, 0x12, 0x07, 0x09, 0x23, 0x2b, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x4d, 0xff, 0x10, 0x02, 0x06,
-    0x02, 0x30, 0x10, 0x22, 0x00, 0x32, 0x00, 0x00,
-    0x11, 0x02, 0x01, 0x3f, 0xf5, 0x00, 0x00, 0x4e,
-    0x40, 0x4b, 0x00, 0x04, 0x05, 0x01, 0x05, 0x04,
-    0x01, 0x80, 0x00, 0x01, 0x02, 0x05, 0x01, 0x02,
-    0x7e, 0x00, 0x05, 0x05, 0x03, 0x61, 0x00, 0x03,
-    0x03, 0x45, 0x4d, 0x00, 0x02, 0x02, 0x00, 0x61,
-    0x08, 0x01, 0x00, 0x00, 0x43, 0x4d, 0x09, 0x01,
-    0x07, 0x07, 0x06, 0x5f, 0x00, 0x06, 0x06, 0x41,
-    0x06, 0x4e, 0x2e, 0x2e, 0x02, 0x01, 0x2e, 0x31,
-    0x2e, 0x31, 0x30, 0x2f, 0x21, 0x1e, 0x1c, 0x1b,
-    0x17, 0x14, 0x0a, 0x07, 0x05, 0x04, 0x01, 0x2d,
-    0x02, 0x2c, 0x0a, 0x09, 0x21, 0x2b, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x58, 0xff, 0x10, 0x02, 0x01,
-    0x02, 0x30, 0x10, 0x22, 0x00, 0x05, 0x00, 0x00,
-    0x11, 0x02, 0x01, 0x3f, 0xf5, 0x00, 0x00, 0x6a,
-    0xb5, 0x04, 0x01, 0x02, 0x03, 0x01, 0x4c, 0x4b,
-    0xb0, 0x18, 0x50, 0x58, 0x40, 0x1e, 0x00, 0x03,
-    0x03, 0x00, 0x61, 0x01, 0x01, 0x00, 0x00, 0x3d,
-    0x4d, 0x07, 0x04, 0x02, 0x02, 0x02, 0x3b, 0x4d,
-    0x08, 0x01, 0x06, 0x06, 0x05, 0x5f, 0x00, 0x05,
-    0x05, 0x41, 0x05, 0x4e, 0x1b, 0x40, 0x22, 0x00,
-    0x00, 0x00, 0x3d, 0x4d, 0x00, 0x03, 0x03, 0x01,
-    0x61, 0x00, 0x01, 0x01, 0x45, 0x4d, 0x07, 0x04,
-    0x02, 0x02, 0x02, 0x3b, 0x4d, 0x08, 0x01, 0x06,
-    0x06, 0x05, 0x5f, 0x00, 0x05, 0x05, 0x41, 0x05,
-    0x4e, 0x59, 0x40, 0x15, 0x18, 0x18, 0x01, 0x01,
-    0x18, 0x1b, 0x18, 0x1b, 0x1a, 0x19, 0x01, 0x17,
-    0x01, 0x17, 0x23, 0x15, 0x24, 0x12, 0x09, 0x09,
-    0x25, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x2d,
-    0xff, 0x10, 0x02, 0x2b, 0x02, 0xd0, 0x10, 0x22,
-    0x00, 0x22, 0x00, 0x00, 0x11, 0x02, 0x01, 0x3f,
-    0x00, 0x00, 0x00, 0x2d, 0x40, 0x2a, 0x03, 0x01,
-    0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x3a,
-    0x4d, 0x00, 0x02, 0x02, 0x3b, 0x4d, 0x06, 0x01,
-    0x05, 0x05, 0x04, 0x5f, 0x00, 0x04, 0x04, 0x41,
-    0x04, 0x4e, 0x09, 0x09, 0x09, 0x0c, 0x09, 0x0c,
-    0x12, 0x11, 0x11, 0x11, 0x11, 0x07, 0x09, 0x26,
-    0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x55,
-    0xff, 0x10, 0x02, 0x03, 0x02, 0xd0, 0x10, 0x22,
-    0x00, 0x1d, 0x00, 0x00, 0x11, 0x02, 0x01, 0x3f,
-    0x00, 0x00, 0x00, 0x2f, 0x40, 0x2c, 0x1b, 0x01,
-    0x02, 0x00, 0x01, 0x4c, 0x01, 0x01, 0x00, 0x00,
-    0x3a, 0x4d, 0x03, 0x01, 0x02, 0x02, 0x3b, 0x4d,
-    0x06, 0x01, 0x05, 0x05, 0x04, 0x5f, 0x00, 0x04,
-    0x04, 0x41, 0x04, 0x4e, 0x21, 0x21, 0x21, 0x24,
-    0x21, 0x24, 0x12, 0x1d, 0x11, 0x1d, 0x11, 0x07,
-    0x09, 0x26, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x5a,
-    0xff, 0x10, 0x02, 0x3f, 0x02, 0xd0, 0x10, 0x22,
-    0x00, 0x1a, 0x00, 0x00, 0x11, 0x02, 0x01, 0x3f,
-    0x00, 0x00, 0x00, 0x39, 0x40, 0x36, 0x07, 0x01,
-    0x04, 0x01, 0x01, 0x4c, 0x00, 0x01, 0x00, 0x04,
-    0x03, 0x01, 0x04, 0x67, 0x02, 0x01, 0x00, 0x00,
-    0x3a, 0x4d, 0x05, 0x01, 0x03, 0x03, 0x3b, 0x4d,
-    0x08, 0x01, 0x07, 0x07, 0x06, 0x5f, 0x00, 0x06,
-    0x06, 0x41, 0x06, 0x4e, 0x0e, 0x0e, 0x0e, 0x11,
-    0x0e, 0x11, 0x12, 0x11, 0x11, 0x12, 0x11, 0x11,
-    0x11, 0x09, 0x09, 0x28, 0x2b, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x5d, 0xff, 0x10, 0x02, 0x35,
-    0x02, 0xda, 0x10, 0x22, 0x00, 0x0d, 0x00, 0x00,
-    0x11, 0x02, 0x01, 0x3f, 0x00, 0x00, 0x00, 0xa9,
-    0xb5, 0x06, 0x01, 0x03, 0x00, 0x01, 0x4c, 0x4b,
-    0xb0, 0x17, 0x50, 0x58, 0x40, 0x25, 0x00, 0x00,
-    0x00, 0x03, 0x02, 0x00, 0x03, 0x67, 0x08, 0x01,
-    0x05, 0x05, 0x3c, 0x4d, 0x00, 0x01, 0x01, 0x3d,
-    0x4d, 0x04, 0x01, 0x02, 0x02, 0x3b, 0x4d, 0x09,
-    0x01, 0x07, 0x07, 0x06, 0x5f, 0x00, 0x06, 0x06,
-    0x41, 0x06, 0x4e, 0x1b, 0x4b, 0xb0, 0x31, 0x50,
-    0x58, 0x40, 0x25, 0x00, 0x00, 0x00, 0x03, 0x02,
-    0x00, 0x03, 0x67, 0x08, 0x01, 0x05, 0x05, 0x3a,
-    0x4d, 0x00, 0x01, 0x01, 0x3d, 0x4d, 0x04, 0x01,
-    0x02, 0x02, 0x3b, 0x4d, 0x09, 0x01, 0x07, 0x07,
-    0x06, 0x5f, 0x00, 0x06, 0x06, 0x41, 0x06, 0x4e,
-    0x1b, 0x40, 0x2b, 0x00, 0x00, 0x00, 0x03, 0x02,
-    0x00, 0x03, 0x67, 0x08, 0x01, 0x05, 0x05, 0x02,
-    0x5f, 0x04, 0x01, 0x02, 0x02, 0x3b, 0x4d, 0x00,
-    0x01, 0x01, 0x3d, 0x4d, 0x04, 0x01, 0x02, 0x02,
-    0x3b, 0x4d, 0x09, 0x01, 0x07, 0x07, 0x06, 0x5f,
-    0x00, 0x06, 0x06, 0x41, 0x06, 0x4e, 0x59, 0x59,
-    0x40, 0x16, 0x0e, 0x0e, 0x01, 0x01, 0x0e, 0x11,
-    0x0e, 0x11, 0x10, 0x0f, 0x01, 0x0d, 0x01, 0x0d,
-    0x11, 0x11, 0x12, 0x11, 0x12, 0x0a, 0x09, 0x26,
-    0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x50,
-    0xff, 0x10, 0x02, 0x0d, 0x02, 0xda, 0x10, 0x22,
-    0x00, 0x17, 0x00, 0x00, 0x11, 0x02, 0x01, 0x3f,
-    0x00, 0x00, 0x00, 0x44, 0x40, 0x41, 0x00, 0x03,
-    0x04, 0x00, 0x04, 0x03, 0x00, 0x80, 0x00, 0x00,
-    0x00, 0x06, 0x05, 0x00, 0x06, 0x67, 0x00, 0x04,
-    0x04, 0x02, 0x61, 0x00, 0x02, 0x02, 0x42, 0x4d,
-    0x00, 0x05, 0x05, 0x01, 0x61, 0x00, 0x01, 0x01,
-    0x43, 0x4d, 0x09, 0x01, 0x08, 0x08, 0x07, 0x5f,
-    0x00, 0x07, 0x07, 0x41, 0x07, 0x4e, 0x27, 0x27,
-    0x27, 0x2a, 0x27, 0x2a, 0x12, 0x13, 0x25, 0x22,
-    0x12, 0x29, 0x25, 0x11, 0x0a, 0x09, 0x29, 0x2b,
-    0xff, 0xff, 0x00, 0x28, 0x00, 0x00, 0x02, 0x26,
-    0x03, 0xbc, 0x10, 0x22, 0x00, 0x0a, 0x00, 0x00,
-    0x11, 0x03, 0x00, 0x93, 0x00, 0x00, 0x00, 0xa0,
-    0x00, 0x85, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40,
-    0x20, 0x00, 0x05, 0x04, 0x05, 0x85, 0x00, 0x04,
-    0x03, 0x04, 0x85, 0x00, 0x02, 0x02, 0x03, 0x5f,
-    0x06, 0x01, 0x03, 0x03, 0x3c, 0x4d, 0x00, 0x00,
-    0x00, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x3b, 0x01,
-    0x4e, 0x1b, 0x4b, 0xb0, 0x31, 0x50, 0x58, 0x40,
-    0x20, 0x00, 0x05, 0x04, 0x05, 0x85, 0x00, 0x04,
-    0x03, 0x04, 0x85, 0x00, 0x02, 0x02, 0x03, 0x5f,
-    0x06, 0x01, 0x03, 0x03, 0x3a, 0x4d, 0x00, 0x00,
-    0x00, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x3b, 0x01,
-    0x4e, 0x1b, 0x40, 0x1e, 0x00, 0x05, 0x04, 0x05,
-    0x85, 0x00, 0x04, 0x03, 0x04, 0x85, 0x06, 0x01,
-    0x03, 0x00, 0x02, 0x00, 0x03, 0x02, 0x67, 0x00,
-    0x00, 0x00, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x3b,
-    0x01, 0x4e, 0x59, 0x59, 0x40, 0x10, 0x01, 0x01,
-    0x12, 0x11, 0x10, 0x0f, 0x01, 0x0e, 0x01, 0x0e,
-    0x13, 0x21, 0x24, 0x07, 0x09, 0x24, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0x28, 0xff, 0x10, 0x02, 0x26,
-    0x02, 0xda, 0x10, 0x22, 0x00, 0x0a, 0x00, 0x00,
-    0x11, 0x02, 0x01, 0x3f, 0x00, 0x00, 0x00, 0x8c,
-    0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x21, 0x00,
-    0x02, 0x02, 0x03, 0x5f, 0x06, 0x01, 0x03, 0x03,
-    0x3c, 0x4d, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x00,
-    0x01, 0x01, 0x3b, 0x4d, 0x07, 0x01, 0x05, 0x05,
-    0x04, 0x5f, 0x00, 0x04, 0x04, 0x41, 0x04, 0x4e,
-    0x1b, 0x4b, 0xb0, 0x31, 0x50, 0x58, 0x40, 0x21,
-    0x00, 0x02, 0x02, 0x03, 0x5f, 0x06, 0x01, 0x03,
-    0x03, 0x3a, 0x4d, 0x00, 0x00, 0x00, 0x01, 0x5f,
-    0x00, 0x01, 0x01, 0x3b, 0x4d, 0x07, 0x01, 0x05,
-    0x05, 0x04, 0x5f, 0x00, 0x04, 0x04, 0x41, 0x04,
-    0x4e, 0x1b, 0x40, 0x1f, 0x06, 0x01, 0x03, 0x00,
-    0x02, 0x00, 0x03, 0x02, 0x67, 0x00, 0x00, 0x00,
-    0x01, 0x5f, 0x00, 0x01, 0x01, 0x3b, 0x4d, 0x07,
-    0x01, 0x05, 0x05, 0x04, 0x5f, 0x00, 0x04, 0x04,
-    0x41, 0x04, 0x4e, 0x59, 0x59, 0x40, 0x14, 0x0f,
-    0x0f, 0x01, 0x01, 0x0f, 0x12, 0x0f, 0x12, 0x11,
-    0x10, 0x01, 0x0e, 0x01, 0x0e, 0x13, 0x21, 0x24,
-    0x08, 0x09, 0x24, 0x2b, 0xff, 0xff, 0x00, 0x70,
-    0xff, 0x10, 0x02, 0x22, 0x02, 0x30, 0x10, 0x22,
-    0x00, 0x31, 0x00, 0x00, 0x11, 0x02, 0x01, 0x3f,
-    0x00, 0x00, 0x00, 0x70, 0xb5, 0x03, 0x01, 0x02,
-    0x03, 0x01, 0x4c, 0x4b, 0xb0, 0x18, 0x50, 0x58,
-    0x40, 0x24, 0x00, 0x02, 0x03, 0x04, 0x03, 0x02,
-    0x04, 0x80, 0x00, 0x03, 0x03, 0x00, 0x61, 0x01,
-    0x01, 0x00, 0x00, 0x3d, 0x4d, 0x00, 0x04, 0x04,
-    0x3b, 0x4d, 0x07, 0x01, 0x06, 0x06, 0x05, 0x5f,
-    0x00, 0x05, 0x05, 0x41, 0x05, 0x4e, 0x1b, 0x40,
-    0x28, 0x00, 0x02, 0x03, 0x04, 0x03, 0x02, 0x04,
-    0x80, 0x00, 0x00, 0x00, 0x3d, 0x4d, 0x00, 0x03,
-    0x03, 0x01, 0x61, 0x00, 0x01, 0x01, 0x45, 0x4d,
-    0x00, 0x04, 0x04, 0x3b, 0x4d, 0x07, 0x01, 0x06,
-    0x06, 0x05, 0x5f, 0x00, 0x05, 0x05, 0x41, 0x05,
-    0x4e, 0x59, 0x40, 0x0f, 0x16, 0x16, 0x16, 0x19,
-    0x16, 0x19, 0x12, 0x13, 0x23, 0x13, 0x24, 0x11,
-    0x08, 0x09, 0x27, 0x2b, 0xff, 0xff, 0x00, 0x5a,
-    0xff, 0x10, 0x02, 0x23, 0x02, 0xd0, 0x10, 0x22,
-    0x00, 0x20, 0x00, 0x00, 0x11, 0x02, 0x01, 0x3f,
-    0x00, 0x00, 0x00, 0x3d, 0x40, 0x3a, 0x0a, 0x01,
-    0x02, 0x04, 0x01, 0x4c, 0x00, 0x04, 0x00, 0x02,
-    0x01, 0x04, 0x02, 0x67, 0x00, 0x05, 0x05, 0x00,
-    0x5f, 0x00, 0x00, 0x00, 0x3a, 0x4d, 0x03, 0x01,
-    0x01, 0x01, 0x3b, 0x4d, 0x08, 0x01, 0x07, 0x07,
-    0x06, 0x5f, 0x00, 0x06, 0x06, 0x41, 0x06, 0x4e,
-    0x1a, 0x1a, 0x1a, 0x1d, 0x1a, 0x1d, 0x12, 0x24,
-    0x21, 0x11, 0x11, 0x18, 0x21, 0x09, 0x09, 0x28,
-    0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x69,
-    0x00, 0x00, 0x02, 0x3e, 0x02, 0xfe, 0x10, 0x22,
-    0x00, 0x1b, 0x00, 0x00, 0x11, 0x02, 0x00, 0x93,
-    0x7c, 0xe2, 0x00, 0x30, 0x40, 0x2d, 0x00, 0x04,
-    0x02, 0x04, 0x85, 0x00, 0x03, 0x02, 0x00, 0x02,
-    0x03, 0x00, 0x80, 0x05, 0x01, 0x02, 0x02, 0x3a,
-    0x4d, 0x00, 0x00, 0x00, 0x01, 0x60, 0x00, 0x01,
-    0x01, 0x3b, 0x01, 0x4e, 0x01, 0x01, 0x0a, 0x09,
-    0x08, 0x07, 0x01, 0x06, 0x01, 0x06, 0x11, 0x12,
-    0x06, 0x09, 0x23, 0x2b, 0xff, 0xff, 0x00, 0x28,
-    0x00, 0x00, 0x02, 0x80, 0x02, 0xfe, 0x10, 0x22,
-    0x00, 0x0a, 0x00, 0x00, 0x11, 0x03, 0x00, 0x93,
-    0x00, 0xbe, 0xff, 0xe2, 0x00, 0x8e, 0x4b, 0xb0,
-    0x17, 0x50, 0x58, 0x40, 0x23, 0x00, 0x05, 0x03,
-    0x05, 0x85, 0x00, 0x04, 0x02, 0x00, 0x02, 0x04,
-    0x00, 0x80, 0x00, 0x02, 0x02, 0x03, 0x5f, 0x06,
-    0x01, 0x03, 0x03, 0x3c, 0x4d, 0x00, 0x00, 0x00,
-    0x01, 0x60, 0x00, 0x01, 0x01, 0x3b, 0x01, 0x4e,
-    0x1b, 0x4b, 0xb0, 0x31, 0x50, 0x58, 0x40, 0x23,
-    0x00, 0x05, 0x03, 0x05, 0x85, 0x00, 0x04, 0x02,
-    0x00, 0x02, 0x04, 0x00, 0x80, 0x00, 0x02, 0x02,
-    0x03, 0x5f, 0x06, 0x01, 0x03, 0x03, 0x3a, 0x4d,
-    0x00, 0x00, 0x00, 0x01, 0x60, 0x00, 0x01, 0x01,
-    0x3b, 0x01, 0x4e, 0x1b, 0x40, 0x21, 0x00, 0x05,
-    0x03, 0x05, 0x85, 0x00, 0x04, 0x02, 0x00, 0x02,
-    0x04, 0x00, 0x80, 0x06, 0x01, 0x03, 0x00, 0x02,
-    0x04, 0x03, 0x02, 0x67, 0x00, 0x00, 0x00, 0x01,
-    0x60, 0x00, 0x01, 0x01, 0x3b, 0x01, 0x4e, 0x59,
-    0x59, 0x40, 0x10, 0x01, 0x01, 0x12, 0x11, 0x10,
-    0x0f, 0x01, 0x0e, 0x01, 0x0e, 0x13, 0x21, 0x24,
-    0x07, 0x09, 0x24, 0x2b, 0xff, 0xff, 0x00, 0x2d,
-    0x00, 0x00, 0x02, 0x2b, 0x02, 0xd0, 0x10, 0x22,
-    0x00, 0x22, 0x00, 0x00, 0x11, 0x03, 0x00, 0x8d,
-    0x00, 0x00, 0xfe, 0x8e, 0x00, 0x25, 0x40, 0x22,
-    0x00, 0x04, 0x00, 0x05, 0x02, 0x04, 0x05, 0x67,
-    0x03, 0x01, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00,
-    0x00, 0x3a, 0x4d, 0x00, 0x02, 0x02, 0x3b, 0x02,
-    0x4e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x06,
-    0x09, 0x27, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x3c,
-    0x00, 0x00, 0x02, 0x0d, 0x02, 0xd0, 0x10, 0x22,
-    0x00, 0x33, 0x00, 0x00, 0x11, 0x03, 0x00, 0x8d,
-    0xff, 0xe2, 0xfe, 0x48, 0x00, 0x33, 0x40, 0x30,
-    0x00, 0x07, 0x00, 0x08, 0x04, 0x07, 0x08, 0x68,
-    0x00, 0x01, 0x01, 0x3a, 0x4d, 0x06, 0x01, 0x03,
-    0x03, 0x00, 0x5f, 0x02, 0x01, 0x00, 0x00, 0x3d,
-    0x4d, 0x00, 0x04, 0x04, 0x05, 0x5f, 0x00, 0x05,
-    0x05, 0x3b, 0x05, 0x4e, 0x11, 0x11, 0x13, 0x21,
-    0x23, 0x11, 0x11, 0x11, 0x11, 0x09, 0x09, 0x2a,
-    0x2b, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x14,
-    0x00, 0x00, 0x02, 0x01, 0x02, 0xda, 0x00, 0x23,
-    0x00, 0x92, 0xb5, 0x06, 0x01, 0x01, 0x02, 0x01,
-    0x4c, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x21,
-    0x07, 0x01, 0x05, 0x09, 0x08, 0x02, 0x04, 0x00,
-    0x05, 0x04, 0x67, 0x00, 0x06, 0x06, 0x3c, 0x4d,
-    0x00, 0x02, 0x02, 0x00, 0x61, 0x00, 0x00, 0x00,
-    0x45, 0x4d, 0x03, 0x01, 0x01, 0x01, 0x3b, 0x01,
-    0x4e, 0x1b, 0x4b, 0xb0, 0x31, 0x50, 0x58, 0x40,
-    0x21, 0x07, 0x01, 0x05, 0x09, 0x08, 0x02, 0x04,
-    0x00, 0x05, 0x04, 0x67, 0x00, 0x06, 0x06, 0x3a,
-    0x4d, 0x00, 0x02, 0x02, 0x00, 0x61, 0x00, 0x00,
-    0x00, 0x45, 0x4d, 0x03, 0x01, 0x01, 0x01, 0x3b,
-    0x01, 0x4e, 0x1b, 0x40, 0x21, 0x07, 0x01, 0x05,
-    0x09, 0x08, 0x02, 0x04, 0x00, 0x05, 0x04, 0x67,
-    0x00, 0x02, 0x02, 0x00, 0x61, 0x00, 0x00, 0x00,
-    0x45, 0x4d, 0x00, 0x06, 0x06, 0x01, 0x5f, 0x03,
-    0x01, 0x01, 0x01, 0x3b, 0x01, 0x4e, 0x59, 0x59,
-    0x40, 0x11, 0x00, 0x00, 0x00, 0x23, 0x00, 0x23,
-    0x11, 0x11, 0x11, 0x11, 0x13, 0x23, 0x15, 0x29,
-    0x0a, 0x09, 0x1e, 0x2b, 0x13, 0x15, 0x14, 0x06,
-    0x07, 0x06, 0x07, 0x33, 0x3e, 0x01, 0x33, 0x32,
-    0x1e, 0x02, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26,
-    0x23, 0x22, 0x06, 0x15, 0x11, 0x23, 0x11, 0x23,
-    0x35, 0x33, 0x35, 0x33, 0x15, 0x33, 0x15, 0xb2,
-    0x01, 0x01, 0x02, 0x01, 0x08, 0x0d, 0x4f, 0x3b,
-    0x29, 0x43, 0x2f, 0x1a, 0x5a, 0x40, 0x39, 0x39,
-    0x43, 0x5a, 0x44, 0x44, 0x5a, 0x66, 0x02, 0x58,
-    0x32, 0x0e, 0x21, 0x0e, 0x11, 0x11, 0x32, 0x37,
-    0x1c, 0x33, 0x47, 0x2c, 0xfe, 0x92, 0x01, 0x5f,
-    0x3f, 0x46, 0x4b, 0x40, 0xfe, 0xa7, 0x02, 0x58,
-    0x4b, 0x37, 0x37, 0x4b, 0xff, 0xff, 0x00, 0x64,
-    0x00, 0x00, 0x02, 0x17, 0x03, 0xb2, 0x10, 0x22,
-    0x00, 0x1b, 0x00, 0x00, 0x11, 0x02, 0x01, 0x36,
-    0xa6, 0x00, 0x00, 0x2d, 0x40, 0x2a, 0x00, 0x04,
-    0x03, 0x04, 0x85, 0x00, 0x03, 0x02, 0x03, 0x85,
-    0x05, 0x01, 0x02, 0x02, 0x3a, 0x4d, 0x00, 0x00,
-    0x00, 0x01, 0x60, 0x00, 0x01, 0x01, 0x3b, 0x01,
-    0x4e, 0x01, 0x01, 0x0a, 0x09, 0x08, 0x07, 0x01,
-    0x06, 0x01, 0x06, 0x11, 0x12, 0x06, 0x09, 0x23,
-    0x2b, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x2d,
-    0x00, 0x6e, 0x02, 0x2b, 0x02, 0xe4, 0x00, 0x15,
-    0x00, 0x2b, 0x00, 0x45, 0x00, 0x90, 0xb1, 0x06,
-    0x64, 0x44, 0x4b, 0xb0, 0x20, 0x50, 0x58, 0x40,
-    0x35, 0x00, 0x08, 0x09, 0x05, 0x09, 0x08, 0x72,
-    0x00, 0x05, 0x04, 0x04, 0x05, 0x70, 0x00, 0x02,
-    0x00, 0x01, 0x07, 0x02, 0x01, 0x69, 0x00, 0x07,
-    0x00, 0x09, 0x08, 0x07, 0x09, 0x69, 0x00, 0x04,
-    0x00, 0x06, 0x00, 0x04, 0x06, 0x6a, 0x00, 0x00,
-    0x03, 0x03, 0x00, 0x59, 0x00, 0x00, 0x00, 0x03,
-    0x61, 0x00, 0x03, 0x00, 0x03, 0x51, 0x1b, 0x40,
-    0x37, 0x00, 0x08, 0x09, 0x05, 0x09, 0x08, 0x05,
-    0x80, 0x00, 0x05, 0x04, 0x09, 0x05, 0x04, 0x7e,
-    0x00, 0x02, 0x00, 0x01, 0x07, 0x02, 0x01, 0x69,
-    0x00, 0x07, 0x00, 0x09, 0x08, 0x07, 0x09, 0x69,
-    0x00, 0x04, 0x00, 0x06, 0x00, 0x04, 0x06, 0x6a,
-    0x00, 0x00, 0x03, 0x03, 0x00, 0x59, 0x00, 0x00,
-    0x00, 0x03, 0x61, 0x00, 0x03, 0x00, 0x03, 0x51,
-    0x59, 0x40, 0x0e, 0x43, 0x41, 0x11, 0x25, 0x21,
-    0x12, 0x27, 0x29, 0x29, 0x29, 0x24, 0x0a, 0x09,
-    0x1f, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x13, 0x14,
-    0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x3d, 0x01,
-    0x34, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x02, 0x15,
-    0x23, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02,
-    0x1d, 0x01, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e,
-    0x02, 0x35, 0x37, 0x14, 0x16, 0x33, 0x32, 0x36,
-    0x37, 0x33, 0x06, 0x23, 0x22, 0x26, 0x3d, 0x01,
-    0x34, 0x36, 0x33, 0x32, 0x17, 0x23, 0x2e, 0x01,
-    0x23, 0x22, 0x06, 0x15, 0x64, 0x1d, 0x35, 0x49,
-    0x2d, 0x2d, 0x4a, 0x34, 0x1d, 0x1d, 0x34, 0x4a,
-    0x2d, 0x2d, 0x49, 0x35, 0x1d, 0x37, 0x25, 0x43,
-    0x5e, 0x39, 0x39, 0x5e, 0x43, 0x25, 0x25, 0x43,
-    0x5e, 0x39, 0x39, 0x5e, 0x43, 0x25, 0xc8, 0x21,
-    0x1b, 0x15, 0x1f, 0x07, 0x41, 0x1a, 0x62, 0x39,
-    0x44, 0x44, 0x39, 0x62, 0x1a, 0x41, 0x07, 0x1f,
-    0x15, 0x1b, 0x21, 0x01, 0x5e, 0x2b, 0x46, 0x32,
-    0x1b, 0x1b, 0x32, 0x46, 0x2b, 0x96, 0x2b, 0x46,
-    0x32, 0x1b, 0x1b, 0x32, 0x46, 0x2b, 0x36, 0x59,
-    0x3f, 0x22, 0x22, 0x3f, 0x59, 0x36, 0x96, 0x36,
-    0x58, 0x3f, 0x23, 0x23, 0x3f, 0x58, 0x36, 0x0a,
-    0x1b, 0x21, 0x15, 0x13, 0x5f, 0x3f, 0x34, 0x82,
-    0x34, 0x3f, 0x5f, 0x13, 0x15, 0x21, 0x1b, 0x00,
-    0x00, 0x04, 0x00, 0x2d, 0x00, 0x6e, 0x02, 0x2b,
-    0x02, 0xe4, 0x00, 0x15, 0x00, 0x2b, 0x00, 0x3a,
-    0x00, 0x43, 0x00, 0x63, 0xb1, 0x06, 0x64, 0x44,
-    0x40, 0x58, 0x33, 0x01, 0x06, 0x08, 0x01, 0x4c,
-    0x07, 0x01, 0x05, 0x06, 0x02, 0x06, 0x05, 0x02,
-    0x80, 0x0a, 0x01, 0x00, 0x00, 0x03, 0x04, 0x00,
-    0x03, 0x69, 0x00, 0x04, 0x00, 0x09, 0x08, 0x04,
-    0x09, 0x69, 0x0b, 0x01, 0x08, 0x00, 0x06, 0x05,
-    0x08, 0x06, 0x67, 0x00, 0x02, 0x01, 0x01, 0x02,
-    0x59, 0x00, 0x02, 0x02, 0x01, 0x61, 0x00, 0x01,
-    0x02, 0x01, 0x51, 0x3c, 0x3b, 0x01, 0x00, 0x42,
-    0x40, 0x3b, 0x43, 0x3c, 0x43, 0x3a, 0x39, 0x38,
-    0x36, 0x35, 0x34, 0x2e, 0x2c, 0x27, 0x25, 0x1c,
-    0x1a, 0x0c, 0x0a, 0x00, 0x15, 0x01, 0x15, 0x0c,
-    0x09, 0x16, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x01,
-    0x32, 0x1e, 0x02, 0x1d, 0x01, 0x14, 0x0e, 0x02,
-    0x23, 0x22, 0x2e, 0x02, 0x3d, 0x01, 0x34, 0x3e,
-    0x02, 0x03, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e,
-    0x02, 0x3d, 0x01, 0x34, 0x2e, 0x02, 0x23, 0x22,
-    0x0e, 0x02, 0x15, 0x37, 0x33, 0x32, 0x16, 0x15,
-    0x14, 0x06, 0x07, 0x17, 0x23, 0x27, 0x31, 0x23,
-    0x15, 0x23, 0x37, 0x32, 0x36, 0x35, 0x34, 0x26,
-    0x2b, 0x01, 0x15, 0x01, 0x2c, 0x39, 0x5e, 0x43,
-    0x25, 0x25, 0x43, 0x5e, 0x39, 0x39, 0x5e, 0x43,
-    0x25, 0x25, 0x43, 0x5e, 0x8f, 0x1d, 0x35, 0x49,
-    0x2d, 0x2d, 0x4a, 0x34, 0x1d, 0x1d, 0x34, 0x4a,
-    0x2d, 0x2d, 0x49, 0x35, 0x1d, 0x5a, 0x72, 0x36,
-    0x3f, 0x1f, 0x1d, 0x42, 0x40, 0x3b, 0x36, 0x3c,
-    0x72, 0x1a, 0x1e, 0x1e, 0x1a, 0x36, 0x02, 0xe4,
-    0x22, 0x3f, 0x59, 0x36, 0x96, 0x36, 0x58, 0x3f,
-    0x23, 0x23, 0x3f, 0x58, 0x36, 0x96, 0x36, 0x59,
-    0x3f, 0x22, 0xfe, 0x7a, 0x2b, 0x46, 0x32, 0x1b,
-    0x1b, 0x32, 0x46, 0x2b, 0x96, 0x2b, 0x46, 0x32,
-    0x1b, 0x1b, 0x32, 0x46, 0x2b, 0x64, 0x39, 0x30,
-    0x22, 0x30, 0x0c, 0x97, 0x8c, 0x8c, 0xbe, 0x1d,
-    0x1a, 0x1a, 0x1d, 0x6e, 0x00, 0x02, 0x00, 0xe1,
-    0xff, 0x5b, 0x01, 0x77, 0x02, 0x30, 0x00, 0x05,
-    0x00, 0x13, 0x00, 0x26, 0x40, 0x23, 0x04, 0x01,
-    0x02, 0x02, 0x03, 0x61, 0x00, 0x03, 0x03, 0x45,
-    0x4d, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00,
-    0x00, 0x3f, 0x00, 0x4e, 0x08, 0x06, 0x0f, 0x0c,
-    0x06, 0x13, 0x08, 0x13, 0x12, 0x10, 0x05, 0x09,
-    0x18, 0x2b, 0x05, 0x23, 0x35, 0x13, 0x33, 0x13,
-    0x03, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x3b,
-    0x01, 0x32, 0x16, 0x15, 0x14, 0x06, 0x01, 0x61,
-    0x6a, 0x15, 0x40, 0x15, 0x2b, 0x14, 0x1d, 0x24,
-    0x24, 0x1d, 0x14, 0x1d, 0x24, 0x24, 0xa5, 0x78,
-    0x01, 0x81, 0xfe, 0x7f, 0x01, 0xe5, 0x22, 0x1b,
-    0x1b, 0x20, 0x1f, 0x1b, 0x1c, 0x22, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x6e, 0xff, 0x5b, 0x01, 0xd1,
-    0x02, 0x30, 0x00, 0x16, 0x00, 0x24, 0x00, 0x69,
-    0x4b, 0xb0, 0x0c, 0x50, 0x58, 0x40, 0x25, 0x00,
-    0x01, 0x05, 0x00, 0x00, 0x01, 0x72, 0x00, 0x00,
-    0x00, 0x02, 0x03, 0x00, 0x02, 0x6a, 0x07, 0x01,
-    0x05, 0x05, 0x06, 0x61, 0x00, 0x06, 0x06, 0x45,
-    0x4d, 0x00, 0x03, 0x03, 0x04, 0x5f, 0x00, 0x04,
-    0x04, 0x3f, 0x04, 0x4e, 0x1b, 0x40, 0x26, 0x00,
-    0x01, 0x05, 0x00, 0x05, 0x01, 0x00, 0x80, 0x00,
-    0x00, 0x00, 0x02, 0x03, 0x00, 0x02, 0x6a, 0x07,
-    0x01, 0x05, 0x05, 0x06, 0x61, 0x00, 0x06, 0x06,
-    0x45, 0x4d, 0x00, 0x03, 0x03, 0x04, 0x5f, 0x00,
-    0x04, 0x04, 0x3f, 0x04, 0x4e, 0x59, 0x40, 0x10,
-    0x19, 0x17, 0x20, 0x1d, 0x17, 0x24, 0x19, 0x24,
-    0x21, 0x24, 0x21, 0x11, 0x14, 0x08, 0x09, 0x1b,
-    0x2b, 0x37, 0x34, 0x3e, 0x02, 0x37, 0x35, 0x33,
-    0x15, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x3b,
-    0x01, 0x15, 0x23, 0x22, 0x2e, 0x02, 0x13, 0x23,
-    0x22, 0x26, 0x35, 0x34, 0x36, 0x3b, 0x01, 0x32,
-    0x16, 0x15, 0x14, 0x06, 0x6e, 0x1b, 0x32, 0x46,
-    0x2a, 0x5a, 0x32, 0x41, 0x4a, 0x4a, 0x42, 0x7d,
-    0x7d, 0x35, 0x55, 0x3c, 0x20, 0xf5, 0x14, 0x1d,
-    0x24, 0x24, 0x1d, 0x14, 0x1d, 0x24, 0x24, 0x2d,
-    0x2b, 0x47, 0x35, 0x1f, 0x02, 0x69, 0xb4, 0x42,
-    0x3b, 0x3b, 0x42, 0x55, 0x1d, 0x37, 0x4e, 0x01,
-    0xbb, 0x22, 0x1b, 0x1b, 0x20, 0x1f, 0x1b, 0x1c,
-    0x22, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xf1,
-    0x00, 0x00, 0x02, 0x01, 0x02, 0xdb, 0x10, 0x22,
-    0x00, 0x05, 0x00, 0x00, 0x11, 0x03, 0x01, 0x3f,
-    0xff, 0x1a, 0x03, 0x39, 0x00, 0xba, 0xb5, 0x04,
-    0x01, 0x02, 0x03, 0x01, 0x4c, 0x4b, 0xb0, 0x17,
-    0x50, 0x58, 0x40, 0x1e, 0x00, 0x05, 0x05, 0x06,
-    0x5f, 0x08, 0x01, 0x06, 0x06, 0x3c, 0x4d, 0x00,
-    0x03, 0x03, 0x00, 0x61, 0x01, 0x01, 0x00, 0x00,
-    0x3d, 0x4d, 0x07, 0x04, 0x02, 0x02, 0x02, 0x3b,
-    0x02, 0x4e, 0x1b, 0x4b, 0xb0, 0x18, 0x50, 0x58,
-    0x40, 0x1e, 0x00, 0x05, 0x05, 0x06, 0x5f, 0x08,
-    0x01, 0x06, 0x06, 0x3a, 0x4d, 0x00, 0x03, 0x03,
-    0x00, 0x61, 0x01, 0x01, 0x00, 0x00, 0x3d, 0x4d,
-    0x07, 0x04, 0x02, 0x02, 0x02, 0x3b, 0x02, 0x4e,
-    0x1b, 0x4b, 0xb0, 0x2e, 0x50, 0x58, 0x40, 0x22,
-    0x00, 0x05, 0x05, 0x06, 0x5f, 0x08, 0x01, 0x06,
-    0x06, 0x3a, 0x4d, 0x00, 0x00, 0x00, 0x3d, 0x4d,
-    0x00, 0x03, 0x03, 0x01, 0x61, 0x00, 0x01, 0x01,
-    0x45, 0x4d, 0x07, 0x04, 0x02, 0x02, 0x02, 0x3b,
-    0x02, 0x4e, 0x1b, 0x40, 0x20, 0x08, 0x01, 0x06,
-    0x00, 0x05, 0x01, 0x06, 0x05, 0x67, 0x00, 0x00,
-    0x00, 0x3d, 0x4d, 0x00, 0x03, 0x03, 0x01, 0x61,
-    0x00, 0x01, 0x01, 0x45, 0x4d, 0x07, 0x04, 0x02,
-    0x02, 0x02, 0x3b, 0x02, 0x4e, 0x59, 0x59, 0x59,
-    0x40, 0x15, 0x18, 0x18, 0x01, 0x01, 0x18, 0x1b,
-    0x18, 0x1b, 0x1a, 0x19, 0x01, 0x17, 0x01, 0x17,
-    0x23, 0x15, 0x24, 0x12, 0x09, 0x09, 0x25, 0x2b,
-    0xff, 0xff, 0x00, 0x46, 0xff, 0x10, 0x02, 0x12,
-    0x02, 0xda, 0x10, 0x22, 0x00, 0x21, 0x00, 0x00,
-    0x11, 0x02, 0x01, 0x3f, 0x00, 0x00, 0x00, 0x4e,
-    0x40, 0x4b, 0x00, 0x04, 0x05, 0x01, 0x05, 0x04,
-    0x01, 0x80, 0x00, 0x01, 0x02, 0x05, 0x01, 0x02,
-    0x7e, 0x00, 0x05, 0x05, 0x03, 0x61, 0x00, 0x03,
-    0x03, 0x42, 0x4d, 0x00, 0x02, 0x02, 0x00, 0x61,
-    0x08, 0x01, 0x00, 0x00, 0x43, 0x4d, 0x09, 0x01,
-    0x07, 0x07, 0x06, 0x5f, 0x00, 0x06, 0x06, 0x41,
-    0x06, 0x4e, 0x30, 0x30, 0x02, 0x01, 0x30, 0x33,
-    0x30, 0x33, 0x32, 0x31, 0x24, 0x22, 0x1e, 0x1d,
-    0x19, 0x17, 0x0d, 0x0b, 0x07, 0x06, 0x01, 0x2f,
-    0x02, 0x2f, 0x0a, 0x09, 0x21, 0x2b, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x5a, 0x00, 0x00, 0x02, 0x26,
-    0x02, 0xc6, 0x00, 0x10, 0x00, 0x19, 0x00, 0x54,
-    0x4b, 0xb0, 0x31, 0x50, 0x58, 0x40, 0x1c, 0x00,
-    0x01, 0x06, 0x01, 0x05, 0x04, 0x01, 0x05, 0x67,
-    0x00, 0x04, 0x00, 0x02, 0x03, 0x04, 0x02, 0x67,
-    0x00, 0x00, 0x00, 0x3a, 0x4d, 0x00, 0x03, 0x03,
-    0x3b, 0x03, 0x4e, 0x1b, 0x40, 0x1c, 0x00, 0x01,
-    0x06, 0x01, 0x05, 0x04, 0x01, 0x05, 0x67, 0x00,
-    0x04, 0x00, 0x02, 0x03, 0x04, 0x02, 0x67, 0x00,
-    0x00, 0x00, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x3b,
-    0x03, 0x4e, 0x59, 0x40, 0x0e, 0x11, 0x11, 0x11,
-    0x19, 0x11, 0x18, 0x22, 0x11, 0x28, 0x21, 0x10,
-    0x07, 0x09, 0x1b, 0x2b, 0x13, 0x33, 0x15, 0x33,
-    0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x2b,
-    0x01, 0x15, 0x23, 0x13, 0x15, 0x33, 0x32, 0x36,
-    0x35, 0x34, 0x26, 0x23, 0x5a, 0x5a, 0x99, 0x31,
-    0x50, 0x39, 0x1f, 0x1f, 0x38, 0x50, 0x32, 0x99,
-    0x5a, 0x5a, 0x99, 0x3a, 0x42, 0x43, 0x39, 0x02,
-    0xc6, 0x87, 0x1d, 0x34, 0x4a, 0x2d, 0x2e, 0x4a,
-    0x34, 0x1c, 0xaf, 0x01, 0xef, 0xf0, 0x40, 0x38,
-    0x38, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x55,
-    0xff, 0x5b, 0x01, 0xb3, 0x02, 0x26, 0x00, 0x0f,
-    0x00, 0x1f, 0x40, 0x1c, 0x00, 0x00, 0x00, 0x01,
-    0x5f, 0x00, 0x01, 0x01, 0x3d, 0x4d, 0x00, 0x03,
-    0x03, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x3f, 0x02,
-    0x4e, 0x21, 0x25, 0x11, 0x10, 0x04, 0x09, 0x1a,
-    0x2b, 0x01, 0x23, 0x35, 0x21, 0x11, 0x14, 0x0e,
-    0x02, 0x2b, 0x01, 0x35, 0x33, 0x32, 0x36, 0x35,
-    0x01, 0x59, 0xe6, 0x01, 0x40, 0x22, 0x3d, 0x54,
-    0x33, 0x78, 0x78, 0x3f, 0x4d, 0x01, 0xd4, 0x52,
-    0xfe, 0x11, 0x30, 0x51, 0x3b, 0x20, 0x53, 0x4c,
-    0x3d, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x2d,
-    0xff, 0x42, 0x02, 0x2b, 0x02, 0xd0, 0x10, 0x22,
-    0x00, 0x22, 0x00, 0x00, 0x11, 0x02, 0x00, 0x9e,
-    0x14, 0x00, 0x00, 0x69, 0xb5, 0x0b, 0x01, 0x07,
-    0x02, 0x01, 0x4c, 0x4b, 0xb0, 0x13, 0x50, 0x58,
-    0x40, 0x24, 0x00, 0x07, 0x02, 0x06, 0x02, 0x07,
-    0x72, 0x00, 0x06, 0x00, 0x05, 0x06, 0x05, 0x63,
-    0x03, 0x01, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00,
-    0x00, 0x3a, 0x4d, 0x00, 0x04, 0x04, 0x02, 0x5f,
-    0x00, 0x02, 0x02, 0x3b, 0x02, 0x4e, 0x1b, 0x40,
-    0x25, 0x00, 0x07, 0x02, 0x06, 0x02, 0x07, 0x06,
-    0x80, 0x00, 0x06, 0x00, 0x05, 0x06, 0x05, 0x63,
-    0x03, 0x01, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00,
-    0x00, 0x3a, 0x4d, 0x00, 0x04, 0x04, 0x02, 0x5f,
-    0x00, 0x02, 0x02, 0x3b, 0x02, 0x4e, 0x59, 0x40,
-    0x0b, 0x14, 0x21, 0x28, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x08, 0x09, 0x29, 0x2b, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x3c, 0xff, 0x42, 0x02, 0x0d,
-    0x02, 0xd0, 0x10, 0x22, 0x00, 0x33, 0x00, 0x00,
-    0x11, 0x02, 0x00, 0x9e, 0x32, 0x00, 0x00, 0x8a,
-    0xb5, 0x17, 0x01, 0x0a, 0x05, 0x01, 0x4c, 0x4b,
-    0xb0, 0x17, 0x50, 0x58, 0x40, 0x32, 0x00, 0x07,
-    0x04, 0x05, 0x04, 0x07, 0x72, 0x00, 0x0a, 0x05,
-    0x09, 0x05, 0x0a, 0x09, 0x80, 0x00, 0x09, 0x00,
-    0x08, 0x09, 0x08, 0x63, 0x00, 0x01, 0x01, 0x3a,
-    0x4d, 0x06, 0x01, 0x03, 0x03, 0x00, 0x5f, 0x02,
-    0x01, 0x00, 0x00, 0x3d, 0x4d, 0x00, 0x04, 0x04,
-    0x05, 0x60, 0x00, 0x05, 0x05, 0x3b, 0x05, 0x4e,
-    0x1b, 0x40, 0x33, 0x00, 0x07, 0x04, 0x05, 0x04,
-    0x07, 0x05, 0x80, 0x00, 0x0a, 0x05, 0x09, 0x05,
-    0x0a, 0x09, 0x80, 0x00, 0x09, 0x00, 0x08, 0x09,
-    0x08, 0x63, 0x00, 0x01, 0x01, 0x3a, 0x4d, 0x06,
-    0x01, 0x03, 0x03, 0x00, 0x5f, 0x02, 0x01, 0x00,
-    0x00, 0x3d, 0x4d, 0x00, 0x04, 0x04, 0x05, 0x60,
-    0x00, 0x05, 0x05, 0x3b, 0x05, 0x4e, 0x59, 0x40,
-    0x10, 0x28, 0x27, 0x23, 0x21, 0x28, 0x11, 0x13,
-    0x21, 0x23, 0x11, 0x11, 0x11, 0x11, 0x0b, 0x09,
-    0x2a, 0x2b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x50,
-    0xff, 0xf6, 0x02, 0x44, 0x02, 0xda, 0x00, 0x24,
-    0x00, 0x32, 0x00, 0xe0, 0x40, 0x0b, 0x0b, 0x01,
-    0x09, 0x00, 0x1b, 0x08, 0x02, 0x08, 0x09, 0x02,
-    0x4c, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x26,
-    0x04, 0x01, 0x02, 0x05, 0x01, 0x01, 0x00, 0x02,
-    0x01, 0x67, 0x00, 0x03, 0x03, 0x3c, 0x4d, 0x00,
-    0x09, 0x09, 0x00, 0x61, 0x00, 0x00, 0x00, 0x45,
-    0x4d, 0x0a, 0x01, 0x08, 0x08, 0x06, 0x61, 0x07,
-    0x01, 0x06, 0x06, 0x3b, 0x06, 0x4e, 0x1b, 0x4b,
-    0xb0, 0x18, 0x50, 0x58, 0x40, 0x26, 0x04, 0x01,
-    0x02, 0x05, 0x01, 0x01, 0x00, 0x02, 0x01, 0x67,
-    0x00, 0x03, 0x03, 0x3a, 0x4d, 0x00, 0x09, 0x09,
-    0x00, 0x61, 0x00, 0x00, 0x00, 0x45, 0x4d, 0x0a,
-    0x01, 0x08, 0x08, 0x06, 0x61, 0x07, 0x01, 0x06,
-    0x06, 0x3b, 0x06, 0x4e, 0x1b, 0x4b, 0xb0, 0x31,
-    0x50, 0x58, 0x40, 0x2a, 0x04, 0x01, 0x02, 0x05,
-    0x01, 0x01, 0x00, 0x02, 0x01, 0x67, 0x00, 0x03,
-    0x03, 0x3a, 0x4d, 0x00, 0x09, 0x09, 0x00, 0x61,
-    0x00, 0x00, 0x00, 0x45, 0x4d, 0x00, 0x06, 0x06,
-    0x3b, 0x4d, 0x0a, 0x01, 0x08, 0x08, 0x07, 0x61,
-    0x00, 0x07, 0x07, 0x43, 0x07, 0x4e, 0x1b, 0x40,
-    0x2a, 0x04, 0x01, 0x02, 0x05, 0x01, 0x01, 0x00,
-    0x02, 0x01, 0x67, 0x00, 0x09, 0x09, 0x00, 0x61,
-    0x00, 0x00, 0x00, 0x45, 0x4d, 0x00, 0x03, 0x03,
-    0x06, 0x5f, 0x00, 0x06, 0x06, 0x3b, 0x4d, 0x0a,
-    0x01, 0x08, 0x08, 0x07, 0x61, 0x00, 0x07, 0x07,
-    0x43, 0x07, 0x4e, 0x59, 0x59, 0x59, 0x40, 0x13,
-    0x26, 0x25, 0x2d, 0x2b, 0x25, 0x32, 0x26, 0x32,
-    0x24, 0x11, 0x11, 0x11, 0x11, 0x11, 0x19, 0x24,
-    0x0b, 0x09, 0x1e, 0x2b, 0x13, 0x34, 0x3e, 0x02,
-    0x33, 0x32, 0x16, 0x17, 0x33, 0x26, 0x27, 0x2e,
-    0x01, 0x3d, 0x01, 0x23, 0x35, 0x33, 0x35, 0x33,
-    0x15, 0x33, 0x15, 0x23, 0x11, 0x23, 0x35, 0x23,
-    0x0e, 0x01, 0x23, 0x22, 0x2e, 0x02, 0x35, 0x17,
-    0x32, 0x36, 0x3d, 0x01, 0x34, 0x26, 0x23, 0x22,
-    0x06, 0x1d, 0x01, 0x14, 0x16, 0x50, 0x1b, 0x30,
-    0x44, 0x2a, 0x3d, 0x50, 0x0d, 0x08, 0x01, 0x01,
-    0x02, 0x01, 0x66, 0x66, 0x5a, 0x44, 0x44, 0x55,
-    0x08, 0x0d, 0x50, 0x3d, 0x2a, 0x44, 0x30, 0x1b,
-    0xdb, 0x38, 0x43, 0x43, 0x38, 0x3d, 0x44, 0x45,
-    0x01, 0x59, 0x32, 0x50, 0x37, 0x1e, 0x37, 0x32,
-    0x11, 0x11, 0x0f, 0x21, 0x0d, 0x32, 0x4b, 0x37,
-    0x37, 0x4b, 0xfd, 0xa8, 0x5f, 0x32, 0x37, 0x1e,
-    0x37, 0x50, 0x32, 0x89, 0x4a, 0x3f, 0x8c, 0x3f,
-    0x4a, 0x48, 0x41, 0x8c, 0x3f, 0x4a, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x49, 0xff, 0x5b, 0x02, 0x00,
-    0x02, 0xa6, 0x10, 0x22, 0x00, 0x0e, 0x00, 0x00,
-    0x11, 0x0b, 0x01, 0x40, 0x02, 0x58, 0x02, 0x48,
-    0xc0, 0x01, 0x00, 0x79, 0xb6, 0x18, 0x09, 0x02,
-    0x05, 0x06, 0x01, 0x4c, 0x4b, 0xb0, 0x18, 0x50,
-    0x58, 0x40, 0x27, 0x00, 0x07, 0x09, 0x01, 0x08,
-    0x00, 0x07, 0x08, 0x67, 0x00, 0x05, 0x00, 0x04,
-    0x03, 0x05, 0x04, 0x69, 0x00, 0x06, 0x06, 0x00,
-    0x61, 0x01, 0x01, 0x00, 0x00, 0x45, 0x4d, 0x00,
-    0x03, 0x03, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x3f,
-    0x02, 0x4e, 0x1b, 0x40, 0x2b, 0x00, 0x07, 0x09,
-    0x01, 0x08, 0x00, 0x07, 0x08, 0x67, 0x00, 0x05,
-    0x00, 0x04, 0x03, 0x05, 0x04, 0x69, 0x00, 0x01,
-    0x01, 0x3d, 0x4d, 0x00, 0x06, 0x06, 0x00, 0x61,
-    0x00, 0x00, 0x00, 0x45, 0x4d, 0x00, 0x03, 0x03,
-    0x02, 0x5f, 0x00, 0x02, 0x02, 0x3f, 0x02, 0x4e,
-    0x59, 0x40, 0x11, 0x31, 0x31, 0x31, 0x34, 0x31,
-    0x34, 0x15, 0x25, 0x27, 0x27, 0x21, 0x23, 0x14,
-    0x25, 0x0a, 0x09, 0x29, 0x2b, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x2d, 0x00, 0x00, 0x02, 0x2b,
-    0x02, 0xd0, 0x00, 0x13, 0x00, 0x17, 0x00, 0x40,
-    0x40, 0x3d, 0x0c, 0x09, 0x07, 0x03, 0x05, 0x0d,
-    0x0b, 0x04, 0x03, 0x00, 0x0a, 0x05, 0x00, 0x67,
-    0x00, 0x0a, 0x00, 0x02, 0x01, 0x0a, 0x02, 0x67,
-    0x08, 0x01, 0x06, 0x06, 0x3a, 0x4d, 0x03, 0x01,
-    0x01, 0x01, 0x3b, 0x01, 0x4e, 0x14, 0x14, 0x00,
-    0x00, 0x14, 0x17, 0x14, 0x17, 0x16, 0x15, 0x00,
-    0x13, 0x00, 0x13, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x0e, 0x09, 0x1f, 0x2b,
-    0x01, 0x15, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11,
-    0x23, 0x11, 0x23, 0x35, 0x33, 0x35, 0x33, 0x15,
-    0x33, 0x35, 0x33, 0x15, 0x05, 0x15, 0x33, 0x35,
-    0x02, 0x2b, 0x2d, 0x5a, 0xf0, 0x5a, 0x2d, 0x2d,
-    0x5a, 0xf0, 0x5a, 0xfe, 0xb6, 0xf0, 0x02, 0x58,
-    0x50, 0xfd, 0xf8, 0x01, 0x4e, 0xfe, 0xb2, 0x02,
-    0x08, 0x50, 0x78, 0x78, 0x78, 0x78, 0x50, 0x68,
-    0x68, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x2d,
-    0xff, 0xf6, 0x01, 0xf9, 0x03, 0xbb, 0x10, 0x22,
-    0x00, 0x19, 0x00, 0x00, 0x11, 0x02, 0x01, 0x37,
-    0x28, 0x00, 0x00, 0x43, 0x40, 0x40, 0x00, 0x05,
-    0x06, 0x05, 0x85, 0x07, 0x01, 0x06, 0x02, 0x06,
-    0x85, 0x00, 0x04, 0x01, 0x00, 0x01, 0x04, 0x00,
-    0x80, 0x00, 0x01, 0x01, 0x02, 0x5f, 0x00, 0x02,
-    0x02, 0x3a, 0x4d, 0x08, 0x01, 0x00, 0x00, 0x03,
-    0x61, 0x00, 0x03, 0x03, 0x43, 0x03, 0x4e, 0x02,
-    0x01, 0x29, 0x28, 0x1b, 0x1a, 0x19, 0x18, 0x14,
-    0x13, 0x0f, 0x0d, 0x08, 0x07, 0x06, 0x05, 0x01,
-    0x16, 0x02, 0x16, 0x09, 0x09, 0x21, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0x55, 0xff, 0x5b, 0x01, 0xdb,
-    0x03, 0x1b, 0x10, 0x22, 0x00, 0x9b, 0x0a, 0x00,
-    0x11, 0x02, 0x01, 0x5e, 0x00, 0x00, 0x00, 0x2d,
-    0x40, 0x2a, 0x00, 0x00, 0x01, 0x00, 0x85, 0x02,
-    0x01, 0x01, 0x04, 0x01, 0x85, 0x00, 0x03, 0x03,
-    0x04, 0x5f, 0x00, 0x04, 0x04, 0x3d, 0x4d, 0x00,
-    0x06, 0x06, 0x05, 0x5f, 0x00, 0x05, 0x05, 0x3f,
-    0x05, 0x4e, 0x21, 0x25, 0x11, 0x11, 0x1d, 0x11,
-    0x11, 0x07, 0x09, 0x28, 0x2b, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x3c, 0x00, 0x00, 0x02, 0x44,
-    0x02, 0xf4, 0x00, 0x13, 0x00, 0x17, 0x00, 0x40,
-    0x40, 0x3d, 0x00, 0x07, 0x0a, 0x01, 0x08, 0x00,
-    0x07, 0x08, 0x67, 0x00, 0x01, 0x01, 0x3a, 0x4d,
-    0x09, 0x06, 0x02, 0x03, 0x03, 0x00, 0x5f, 0x02,
-    0x01, 0x00, 0x00, 0x3d, 0x4d, 0x00, 0x04, 0x04,
-    0x05, 0x60, 0x00, 0x05, 0x05, 0x3b, 0x05, 0x4e,
-    0x14, 0x14, 0x00, 0x00, 0x14, 0x17, 0x14, 0x17,
-    0x16, 0x15, 0x00, 0x13, 0x00, 0x13, 0x21, 0x23,
-    0x11, 0x11, 0x11, 0x11, 0x0b, 0x09, 0x1c, 0x2b,
-    0x13, 0x35, 0x33, 0x35, 0x33, 0x15, 0x33, 0x15,
-    0x23, 0x11, 0x14, 0x16, 0x3b, 0x01, 0x15, 0x23,
-    0x22, 0x26, 0x35, 0x11, 0x3f, 0x01, 0x33, 0x07,
-    0x3c, 0xa0, 0x5a, 0xd7, 0xd7, 0x23, 0x1e, 0x8c,
-    0x8c, 0x47, 0x54, 0xdc, 0x32, 0x5a, 0x46, 0x01,
-    0xd4, 0x52, 0xaa, 0xaa, 0x52, 0xfe, 0xba, 0x1c,
-    0x20, 0x52, 0x4e, 0x40, 0x01, 0x46, 0x8e, 0x92,
-    0x92, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x3c,
-    0xff, 0xf6, 0x02, 0x1c, 0x00, 0xaa, 0x00, 0x0d,
-    0x00, 0x1b, 0x00, 0x29, 0x00, 0x1b, 0x40, 0x18,
-    0x04, 0x02, 0x02, 0x00, 0x00, 0x01, 0x61, 0x05,
-    0x03, 0x02, 0x01, 0x01, 0x43, 0x01, 0x4e, 0x25,
-    0x25, 0x25, 0x25, 0x25, 0x22, 0x06, 0x09, 0x1c,
-    0x2b, 0x37, 0x34, 0x36, 0x33, 0x32, 0x16, 0x1d,
-    0x01, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x37,
-    0x34, 0x36, 0x33, 0x32, 0x16, 0x1d, 0x01, 0x14,
-    0x06, 0x23, 0x22, 0x26, 0x35, 0x37, 0x34, 0x36,
-    0x33, 0x32, 0x16, 0x1d, 0x01, 0x14, 0x06, 0x23,
-    0x22, 0x26, 0x35, 0x3c, 0x1b, 0x17, 0x17, 0x1b,
-    0x1b, 0x17, 0x17, 0x1b, 0xbe, 0x1b, 0x17, 0x17,
-    0x1b, 0x1b, 0x17, 0x17, 0x1b, 0xbe, 0x1b, 0x17,
-    0x17, 0x1b, 0x1b, 0x17, 0x17, 0x1b, 0x73, 0x19,
-    0x1e, 0x1e, 0x19, 0x46, 0x19, 0x1e, 0x1e, 0x19,
-    0x46, 0x19, 0x1e, 0x1e, 0x19, 0x46, 0x19, 0x1e,
-    0x1e, 0x19, 0x46, 0x19, 0x1e, 0x1e, 0x19, 0x46,
-    0x19, 0x1e, 0x1e, 0x19, 0x00, 0x01, 0x00, 0x41,
-    0x00, 0x00, 0x01, 0xf9, 0x02, 0xd0, 0x00, 0x12,
-    0x00, 0x24, 0x40, 0x21, 0x00, 0x04, 0x02, 0x01,
-    0x02, 0x04, 0x01, 0x80, 0x00, 0x02, 0x02, 0x00,
-    0x5f, 0x00, 0x00, 0x00, 0x3a, 0x4d, 0x03, 0x01,
-    0x01, 0x01, 0x3b, 0x01, 0x4e, 0x11, 0x11, 0x11,
-    0x11, 0x24, 0x05, 0x09, 0x1b, 0x2b, 0x13, 0x34,
-    0x3e, 0x02, 0x3b, 0x01, 0x11, 0x23, 0x11, 0x23,
-    0x11, 0x23, 0x11, 0x22, 0x2e, 0x02, 0x35, 0x41,
-    0x1b, 0x32, 0x46, 0x2b, 0xfa, 0x50, 0x5a, 0x50,
-    0x2b, 0x46, 0x32, 0x1b, 0x02, 0x26, 0x26, 0x3f,
-    0x2d, 0x18, 0xfd, 0x30, 0x02, 0x89, 0xfd, 0x77,
-    0x01, 0x2c, 0x18, 0x2d, 0x3f, 0x26, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x5a, 0xff, 0x5b, 0x01, 0xfe,
-    0x02, 0x26, 0x00, 0x1b, 0x00, 0x2d, 0x40, 0x2a,
-    0x12, 0x01, 0x02, 0x00, 0x01, 0x4c, 0x05, 0x04,
-    0x02, 0x01, 0x01, 0x3d, 0x4d, 0x00, 0x00, 0x00,
-    0x02, 0x61, 0x00, 0x02, 0x02, 0x43, 0x4d, 0x00,
-    0x03, 0x03, 0x3f, 0x03, 0x4e, 0x00, 0x00, 0x00,
-    0x1b, 0x00, 0x1b, 0x1b, 0x23, 0x13, 0x23, 0x06,
-    0x09, 0x1a, 0x2b, 0x13, 0x11, 0x14, 0x16, 0x33,
-    0x32, 0x36, 0x35, 0x11, 0x33, 0x11, 0x14, 0x06,
-    0x23, 0x22, 0x26, 0x27, 0x26, 0x27, 0x23, 0x32,
-    0x1e, 0x02, 0x1f, 0x01, 0x23, 0x11, 0xb4, 0x38,
-    0x3f, 0x3f, 0x3a, 0x5a, 0x69, 0x60, 0x31, 0x3c,
-    0x11, 0x13, 0x09, 0x04, 0x01, 0x05, 0x05, 0x05,
-    0x01, 0x0b, 0x59, 0x02, 0x26, 0xfe, 0x9c, 0x3c,
-    0x41, 0x41, 0x3c, 0x01, 0x64, 0xfe, 0x9c, 0x61,
-    0x6b, 0x18, 0x0f, 0x10, 0x16, 0x10, 0x18, 0x1c,
-    0x0c, 0x98, 0x02, 0xcb, 0x00, 0x02, 0x00, 0x28,
-    0xff, 0xf6, 0x02, 0x3f, 0x02, 0xda, 0x00, 0x1f,
-    0x00, 0x2d, 0x00, 0xdc, 0x4b, 0xb0, 0x15, 0x50,
-    0x58, 0x40, 0x0a, 0x0c, 0x01, 0x03, 0x01, 0x1a,
-    0x01, 0x00, 0x06, 0x02, 0x4c, 0x1b, 0x40, 0x0a,
-    0x0c, 0x01, 0x03, 0x09, 0x1a, 0x01, 0x08, 0x06,
-    0x02, 0x4c, 0x59, 0x4b, 0xb0, 0x15, 0x50, 0x58,
-    0x40, 0x22, 0x00, 0x04, 0x00, 0x05, 0x06, 0x04,
-    0x05, 0x67, 0x09, 0x01, 0x03, 0x03, 0x01, 0x61,
-    0x02, 0x01, 0x01, 0x01, 0x42, 0x4d, 0x08, 0x01,
-    0x06, 0x06, 0x00, 0x61, 0x07, 0x0a, 0x02, 0x00,
-    0x00, 0x43, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x18,
-    0x50, 0x58, 0x40, 0x37, 0x00, 0x04, 0x00, 0x05,
-    0x06, 0x04, 0x05, 0x67, 0x00, 0x09, 0x09, 0x01,
-    0x61, 0x02, 0x01, 0x01, 0x01, 0x42, 0x4d, 0x00,
-    0x03, 0x03, 0x01, 0x61, 0x02, 0x01, 0x01, 0x01,
-    0x42, 0x4d, 0x00, 0x06, 0x06, 0x00, 0x61, 0x07,
-    0x0a, 0x02, 0x00, 0x00, 0x43, 0x4d, 0x00, 0x08,
-    0x08, 0x00, 0x61, 0x07, 0x0a, 0x02, 0x00, 0x00,
-    0x43, 0x00, 0x4e, 0x1b, 0x40, 0x32, 0x00, 0x04,
-    0x00, 0x05, 0x06, 0x04, 0x05, 0x67, 0x00, 0x09,
-    0x09, 0x01, 0x61, 0x00, 0x01, 0x01, 0x42, 0x4d,
-    0x00, 0x03, 0x03, 0x02, 0x5f, 0x00, 0x02, 0x02,
-    0x3a, 0x4d, 0x00, 0x06, 0x06, 0x07, 0x5f, 0x00,
-    0x07, 0x07, 0x3b, 0x4d, 0x00, 0x08, 0x08, 0x00,
-    0x61, 0x0a, 0x01, 0x00, 0x00, 0x43, 0x00, 0x4e,
-    0x59, 0x59, 0x40, 0x1b, 0x01, 0x00, 0x2b, 0x29,
-    0x24, 0x22, 0x19, 0x18, 0x17, 0x16, 0x15, 0x14,
-    0x13, 0x12, 0x11, 0x10, 0x0f, 0x0e, 0x08, 0x06,
-    0x00, 0x1f, 0x01, 0x1f, 0x0b, 0x09, 0x16, 0x2b,
-    0x17, 0x22, 0x26, 0x35, 0x11, 0x34, 0x36, 0x33,
-    0x32, 0x16, 0x17, 0x16, 0x17, 0x33, 0x35, 0x21,
-    0x15, 0x23, 0x15, 0x33, 0x15, 0x23, 0x15, 0x33,
-    0x15, 0x21, 0x35, 0x23, 0x06, 0x07, 0x0e, 0x01,
-    0x27, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x11,
-    0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0xc3, 0x48,
-    0x53, 0x53, 0x48, 0x24, 0x2b, 0x0c, 0x0d, 0x06,
-    0x05, 0x01, 0x09, 0xb1, 0x98, 0x98, 0xb1, 0xfe,
-    0xf7, 0x05, 0x06, 0x0d, 0x0c, 0x2b, 0x65, 0x30,
-    0x2a, 0x2a, 0x30, 0x30, 0x2a, 0x2a, 0x30, 0x0a,
-    0x66, 0x58, 0x01, 0x68, 0x58, 0x66, 0x1c, 0x11,
-    0x14, 0x19, 0x50, 0x52, 0xe1, 0x52, 0xf9, 0x52,
-    0x50, 0x19, 0x14, 0x11, 0x1c, 0xbe, 0x33, 0x3b,
-    0x3b, 0x33, 0x01, 0x68, 0x33, 0x3b, 0x3b, 0x33,
-    0x00, 0x03, 0x00, 0x23, 0xff, 0xf6, 0x02, 0x35,
-    0x02, 0x30, 0x00, 0x2c, 0x00, 0x3a, 0x00, 0x43,
-    0x00, 0x4d, 0x40, 0x4a, 0x08, 0x01, 0x09, 0x07,
-    0x23, 0x01, 0x03, 0x04, 0x02, 0x4c, 0x00, 0x04,
-    0x02, 0x03, 0x02, 0x04, 0x03, 0x80, 0x00, 0x09,
-    0x00, 0x02, 0x04, 0x09, 0x02, 0x67, 0x0a, 0x0b,
-    0x02, 0x07, 0x07, 0x00, 0x61, 0x01, 0x01, 0x00,
-    0x00, 0x45, 0x4d, 0x08, 0x01, 0x03, 0x03, 0x05,
-    0x61, 0x06, 0x01, 0x05, 0x05, 0x43, 0x05, 0x4e,
-    0x2e, 0x2d, 0x41, 0x3f, 0x3c, 0x3b, 0x35, 0x33,
-    0x2d, 0x3a, 0x2e, 0x3a, 0x29, 0x22, 0x12, 0x23,
-    0x13, 0x29, 0x22, 0x0c, 0x09, 0x1d, 0x2b, 0x13,
-    0x34, 0x36, 0x33, 0x32, 0x16, 0x17, 0x16, 0x17,
-    0x33, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x32, 0x16,
-    0x1d, 0x01, 0x23, 0x15, 0x14, 0x16, 0x33, 0x32,
-    0x36, 0x37, 0x33, 0x0e, 0x01, 0x23, 0x22, 0x26,
-    0x27, 0x26, 0x27, 0x23, 0x06, 0x07, 0x0e, 0x01,
-    0x23, 0x22, 0x26, 0x35, 0x13, 0x22, 0x06, 0x1d,
-    0x01, 0x14, 0x16, 0x33, 0x32, 0x36, 0x3d, 0x01,
-    0x34, 0x26, 0x17, 0x33, 0x35, 0x34, 0x26, 0x23,
-    0x22, 0x06, 0x15, 0x23, 0x4e, 0x43, 0x2a, 0x2f,
-    0x0b, 0x0e, 0x04, 0x04, 0x04, 0x0e, 0x0c, 0x2e,
-    0x2a, 0x43, 0x4e, 0xde, 0x24, 0x1f, 0x1a, 0x24,
-    0x05, 0x55, 0x0a, 0x4c, 0x38, 0x2a, 0x2e, 0x0c,
-    0x0e, 0x04, 0x04, 0x04, 0x0e, 0x0b, 0x2f, 0x2a,
-    0x43, 0x4e, 0x9b, 0x20, 0x26, 0x26, 0x20, 0x1f,
-    0x24, 0x24, 0x7a, 0x89, 0x26, 0x20, 0x1f, 0x24,
-    0x01, 0x90, 0x4a, 0x56, 0x19, 0x0f, 0x12, 0x16,
-    0x16, 0x12, 0x0f, 0x19, 0x56, 0x4a, 0x96, 0x64,
-    0x26, 0x2d, 0x20, 0x1a, 0x3f, 0x48, 0x19, 0x0f,
-    0x12, 0x16, 0x16, 0x12, 0x0f, 0x19, 0x56, 0x4a,
-    0x01, 0x4d, 0x2d, 0x26, 0xfa, 0x26, 0x2d, 0x2d,
-    0x26, 0xfa, 0x26, 0x2d, 0xa0, 0x4d, 0x26, 0x2d,
-    0x2d, 0x26, 0x00, 0x00, 0x00, 0x02, 0x00, 0x1e,
-    0x00, 0x00, 0x02, 0x3a, 0x02, 0xd0, 0x00, 0x0f,
-    0x00, 0x13, 0x00, 0x38, 0x40, 0x35, 0x00, 0x02,
-    0x00, 0x03, 0x08, 0x02, 0x03, 0x67, 0x00, 0x08,
-    0x00, 0x06, 0x04, 0x08, 0x06, 0x67, 0x09, 0x01,
-    0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x3a,
-    0x4d, 0x00, 0x04, 0x04, 0x05, 0x5f, 0x07, 0x01,
-    0x05, 0x05, 0x3b, 0x05, 0x4e, 0x13, 0x12, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10,
-    0x0a, 0x09, 0x1f, 0x2b, 0x13, 0x21, 0x15, 0x23,
-    0x15, 0x33, 0x15, 0x23, 0x15, 0x33, 0x15, 0x21,
-    0x35, 0x23, 0x07, 0x23, 0x13, 0x33, 0x11, 0x23,
-    0xaf, 0x01, 0x8b, 0xb6, 0x9d, 0x9d, 0xb6, 0xfe,
-    0xf2, 0x8d, 0x28, 0x59, 0x8f, 0x7f, 0x38, 0x02,
-    0xd0, 0x52, 0xe2, 0x52, 0xf8, 0x52, 0xcb, 0xcb,
-    0x01, 0x16, 0x01, 0x68, 0x00, 0x03, 0x00, 0x23,
-    0xff, 0xf6, 0x02, 0x35, 0x02, 0x30, 0x00, 0x37,
-    0x00, 0x43, 0x00, 0x4c, 0x00, 0x9b, 0x40, 0x0a,
-    0x14, 0x01, 0x02, 0x01, 0x2f, 0x01, 0x06, 0x07,
-    0x02, 0x4c, 0x4b, 0xb0, 0x16, 0x50, 0x58, 0x40,
-    0x33, 0x00, 0x02, 0x01, 0x00, 0x01, 0x02, 0x72,
-    0x00, 0x07, 0x05, 0x06, 0x05, 0x07, 0x06, 0x80,
-    0x0c, 0x01, 0x00, 0x0b, 0x01, 0x05, 0x07, 0x00,
-    0x05, 0x67, 0x0d, 0x01, 0x01, 0x01, 0x03, 0x61,
-    0x04, 0x01, 0x03, 0x03, 0x45, 0x4d, 0x0e, 0x0a,
-    0x02, 0x06, 0x06, 0x08, 0x61, 0x09, 0x01, 0x08,
-    0x08, 0x43, 0x08, 0x4e, 0x1b, 0x40, 0x34, 0x00,
-    0x02, 0x01, 0x00, 0x01, 0x02, 0x00, 0x80, 0x00,
-    0x07, 0x05, 0x06, 0x05, 0x07, 0x06, 0x80, 0x0c,
-    0x01, 0x00, 0x0b, 0x01, 0x05, 0x07, 0x00, 0x05,
-    0x67, 0x0d, 0x01, 0x01, 0x01, 0x03, 0x61, 0x04,
-    0x01, 0x03, 0x03, 0x45, 0x4d, 0x0e, 0x0a, 0x02,
-    0x06, 0x06, 0x08, 0x61, 0x09, 0x01, 0x08, 0x08,
-    0x43, 0x08, 0x4e, 0x59, 0x40, 0x1a, 0x39, 0x38,
-    0x4a, 0x48, 0x45, 0x44, 0x3e, 0x3c, 0x38, 0x43,
-    0x39, 0x43, 0x36, 0x34, 0x22, 0x12, 0x23, 0x13,
-    0x29, 0x22, 0x11, 0x23, 0x23, 0x0f, 0x09, 0x1f,
-    0x2b, 0x37, 0x35, 0x34, 0x36, 0x3b, 0x01, 0x35,
-    0x34, 0x26, 0x23, 0x22, 0x07, 0x23, 0x3e, 0x01,
-    0x33, 0x32, 0x16, 0x17, 0x16, 0x17, 0x33, 0x36,
-    0x37, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x1d, 0x01,
-    0x23, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37,
-    0x33, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x27, 0x26,
-    0x27, 0x23, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x22,
-    0x26, 0x37, 0x32, 0x36, 0x3d, 0x01, 0x23, 0x22,
-    0x06, 0x1d, 0x01, 0x14, 0x16, 0x13, 0x33, 0x35,
-    0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x23, 0x53,
-    0x46, 0x4a, 0x20, 0x23, 0x39, 0x06, 0x55, 0x07,
-    0x46, 0x38, 0x29, 0x2f, 0x0d, 0x0e, 0x06, 0x04,
-    0x05, 0x0f, 0x0c, 0x2d, 0x26, 0x44, 0x4d, 0xde,
-    0x25, 0x1e, 0x1b, 0x26, 0x05, 0x55, 0x07, 0x4f,
-    0x3b, 0x26, 0x2e, 0x0c, 0x0e, 0x05, 0x04, 0x06,
-    0x10, 0x0e, 0x32, 0x2d, 0x3f, 0x48, 0x9b, 0x20,
-    0x28, 0x48, 0x1f, 0x22, 0x23, 0xb7, 0x89, 0x25,
-    0x21, 0x20, 0x23, 0x82, 0x3c, 0x3e, 0x49, 0x4a,
-    0x2c, 0x28, 0x3a, 0x40, 0x47, 0x19, 0x0f, 0x12,
-    0x16, 0x16, 0x12, 0x0f, 0x19, 0x55, 0x4b, 0x91,
-    0x69, 0x26, 0x2d, 0x20, 0x1a, 0x3d, 0x4a, 0x19,
-    0x0f, 0x12, 0x16, 0x16, 0x12, 0x0f, 0x19, 0x4b,
-    0x02, 0x2d, 0x26, 0x69, 0x23, 0x1e, 0x3c, 0x1d,
-    0x22, 0x01, 0x02, 0x4b, 0x26, 0x2d, 0x2d, 0x26,
-    0x00, 0x01, 0x00, 0x37, 0xff, 0xf6, 0x02, 0x3f,
-    0x02, 0xda, 0x00, 0x32, 0x00, 0xd1, 0x4b, 0xb0,
-    0x17, 0x50, 0x58, 0x40, 0x28, 0x00, 0x03, 0x01,
-    0x04, 0x01, 0x03, 0x04, 0x80, 0x00, 0x06, 0x06,
-    0x00, 0x5f, 0x00, 0x00, 0x00, 0x3c, 0x4d, 0x00,
-    0x01, 0x01, 0x05, 0x61, 0x00, 0x05, 0x05, 0x3d,
-    0x4d, 0x00, 0x04, 0x04, 0x02, 0x61, 0x07, 0x01,
-    0x02, 0x02, 0x43, 0x02, 0x4e, 0x1b, 0x4b, 0xb0,
-    0x18, 0x50, 0x58, 0x40, 0x28, 0x00, 0x03, 0x01,
-    0x04, 0x01, 0x03, 0x04, 0x80, 0x00, 0x06, 0x06,
-    0x00, 0x5f, 0x00, 0x00, 0x00, 0x3a, 0x4d, 0x00,
-    0x01, 0x01, 0x05, 0x61, 0x00, 0x05, 0x05, 0x3d,
-    0x4d, 0x00, 0x04, 0x04, 0x02, 0x61, 0x07, 0x01,
-    0x02, 0x02, 0x43, 0x02, 0x4e, 0x1b, 0x4b, 0xb0,
-    0x31, 0x50, 0x58, 0x40, 0x2c, 0x00, 0x03, 0x01,
-    0x04, 0x01, 0x03, 0x04, 0x80, 0x00, 0x06, 0x06,
-    0x00, 0x5f, 0x00, 0x00, 0x00, 0x3a, 0x4d, 0x00,
-    0x01, 0x01, 0x05, 0x61, 0x00, 0x05, 0x05, 0x3d,
-    0x4d, 0x00, 0x07, 0x07, 0x3b, 0x4d, 0x00, 0x04,
-    0x04, 0x02, 0x61, 0x00, 0x02, 0x02, 0x43, 0x02,
-    0x4e, 0x1b, 0x40, 0x2a, 0x00, 0x03, 0x01, 0x04,
-    0x01, 0x03, 0x04, 0x80, 0x00, 0x00, 0x00, 0x06,
-    0x05, 0x00, 0x06, 0x67, 0x00, 0x01, 0x01, 0x05,
-    0x61, 0x00, 0x05, 0x05, 0x3d, 0x4d, 0x00, 0x07,
-    0x07, 0x3b, 0x4d, 0x00, 0x04, 0x04, 0x02, 0x61,
-    0x00, 0x02, 0x02, 0x43, 0x02, 0x4e, 0x59, 0x59,
-    0x59, 0x40, 0x0b, 0x13, 0x32, 0x18, 0x22, 0x12,
-    0x29, 0x25, 0x34, 0x08, 0x09, 0x1e, 0x2b, 0x13,
-    0x34, 0x3e, 0x02, 0x3b, 0x01, 0x32, 0x1e, 0x02,
-    0x1d, 0x01, 0x23, 0x22, 0x15, 0x14, 0x1f, 0x01,
-    0x1e, 0x01, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26,
-    0x27, 0x33, 0x1e, 0x01, 0x33, 0x32, 0x35, 0x34,
-    0x2f, 0x01, 0x26, 0x35, 0x34, 0x36, 0x33, 0x34,
-    0x26, 0x2b, 0x01, 0x22, 0x06, 0x15, 0x11, 0x23,
-    0x37, 0x1b, 0x32, 0x46, 0x2a, 0x49, 0x2b, 0x47,
-    0x32, 0x1b, 0x5a, 0x59, 0x44, 0x22, 0x46, 0x4a,
-    0x59, 0x51, 0x4c, 0x60, 0x08, 0x5f, 0x05, 0x2d,
-    0x23, 0x50, 0x45, 0x21, 0x91, 0x5e, 0x56, 0x37,
-    0x2e, 0x49, 0x2d, 0x36, 0x5a, 0x02, 0x27, 0x28,
-    0x42, 0x2f, 0x1a, 0x1a, 0x2f, 0x42, 0x28, 0x51,
-    0x46, 0x3d, 0x0d, 0x07, 0x0e, 0x58, 0x42, 0x4c,
-    0x55, 0x4a, 0x42, 0x1d, 0x1f, 0x4f, 0x47, 0x0f,
-    0x07, 0x1e, 0x7f, 0x48, 0x4f, 0x2d, 0x37, 0x37,
-    0x2d, 0xfd, 0xda, 0x00, 0x00, 0x02, 0x00, 0x46,
-    0xff, 0xf6, 0x02, 0x12, 0x02, 0xdf, 0x00, 0x26,
-    0x00, 0x32, 0x00, 0x92, 0x40, 0x10, 0x1a, 0x19,
-    0x17, 0x14, 0x13, 0x12, 0x11, 0x07, 0x00, 0x02,
-    0x01, 0x4c, 0x18, 0x01, 0x02, 0x4a, 0x4b, 0xb0,
-    0x17, 0x50, 0x58, 0x40, 0x20, 0x00, 0x01, 0x00,
-    0x05, 0x00, 0x01, 0x05, 0x80, 0x00, 0x00, 0x00,
-    0x05, 0x04, 0x00, 0x05, 0x6a, 0x00, 0x02, 0x02,
-    0x3c, 0x4d, 0x00, 0x04, 0x04, 0x03, 0x61, 0x00,
-    0x03, 0x03, 0x43, 0x03, 0x4e, 0x1b, 0x4b, 0xb0,
-    0x31, 0x50, 0x58, 0x40, 0x20, 0x00, 0x01, 0x00,
-    0x05, 0x00, 0x01, 0x05, 0x80, 0x00, 0x00, 0x00,
-    0x05, 0x04, 0x00, 0x05, 0x6a, 0x00, 0x02, 0x02,
-    0x3a, 0x4d, 0x00, 0x04, 0x04, 0x03, 0x61, 0x00,
-    0x03, 0x03, 0x43, 0x03, 0x4e, 0x1b, 0x40, 0x20,
-    0x00, 0x02, 0x00, 0x02, 0x85, 0x00, 0x01, 0x00,
-    0x05, 0x00, 0x01, 0x05, 0x80, 0x00, 0x00, 0x00,
-    0x05, 0x04, 0x00, 0x05, 0x6a, 0x00, 0x04, 0x04,
-    0x03, 0x61, 0x00, 0x03, 0x03, 0x43, 0x03, 0x4e,
-    0x59, 0x59, 0x40, 0x09, 0x24, 0x26, 0x2b, 0x1a,
-    0x14, 0x24, 0x06, 0x09, 0x1c, 0x2b, 0x37, 0x34,
-    0x3e, 0x02, 0x33, 0x32, 0x16, 0x17, 0x16, 0x17,
-    0x33, 0x26, 0x27, 0x2e, 0x01, 0x2f, 0x01, 0x07,
-    0x35, 0x37, 0x27, 0x33, 0x17, 0x37, 0x15, 0x07,
-    0x17, 0x16, 0x15, 0x14, 0x0e, 0x02, 0x23, 0x22,
-    0x2e, 0x02, 0x37, 0x14, 0x16, 0x33, 0x32, 0x36,
-    0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x46, 0x1e,
-    0x38, 0x4d, 0x30, 0x1e, 0x2a, 0x0e, 0x10, 0x0a,
-    0x0e, 0x08, 0x0b, 0x0a, 0x1c, 0x12, 0x3c, 0x9b,
-    0x71, 0x46, 0x6d, 0x2a, 0x96, 0x6d, 0x49, 0x69,
-    0x21, 0x3d, 0x55, 0x34, 0x34, 0x54, 0x3c, 0x21,
-    0x5a, 0x4c, 0x3f, 0x40, 0x4d, 0x4d, 0x40, 0x3f,
-    0x4c, 0xd7, 0x32, 0x51, 0x3a, 0x20, 0x11, 0x0b,
-    0x0c, 0x10, 0x09, 0x0f, 0x0c, 0x26, 0x1a, 0x57,
-    0x48, 0x50, 0x35, 0x66, 0x41, 0x46, 0x50, 0x33,
-    0x6f, 0xa0, 0x76, 0x32, 0x53, 0x3b, 0x21, 0x20,
-    0x3b, 0x53, 0x33, 0x42, 0x4f, 0x4f, 0x42, 0x42,
-    0x4f, 0x4f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x46,
-    0x00, 0xcd, 0x02, 0x12, 0x01, 0x9f, 0x00, 0x05,
-    0x00, 0x3e, 0x4b, 0xb0, 0x0a, 0x50, 0x58, 0x40,
-    0x16, 0x00, 0x01, 0x02, 0x02, 0x01, 0x71, 0x00,
-    0x00, 0x02, 0x02, 0x00, 0x57, 0x00, 0x00, 0x00,
-    0x02, 0x5f, 0x00, 0x02, 0x00, 0x02, 0x4f, 0x1b,
-    0x40, 0x15, 0x00, 0x01, 0x02, 0x01, 0x86, 0x00,
-    0x00, 0x02, 0x02, 0x00, 0x57, 0x00, 0x00, 0x00,
-    0x02, 0x5f, 0x00, 0x02, 0x00, 0x02, 0x4f, 0x59,
-    0xb5, 0x11, 0x11, 0x10, 0x03, 0x09, 0x19, 0x2b,
-    0x13, 0x21, 0x15, 0x23, 0x35, 0x21, 0x46, 0x01,
-    0xcc, 0x55, 0xfe, 0x89, 0x01, 0x9f, 0xd2, 0x82,
-    0x00, 0x02, 0x00, 0x0f, 0x01, 0x72, 0x02, 0x35,
-    0x02, 0xda, 0x00, 0x2d, 0x00, 0x35, 0x00, 0x50,
-    0x40, 0x4d, 0x08, 0x01, 0x04, 0x06, 0x01, 0x4c,
-    0x26, 0x01, 0x03, 0x01, 0x4b, 0x00, 0x04, 0x06,
-    0x02, 0x06, 0x04, 0x02, 0x80, 0x07, 0x0a, 0x05,
-    0x03, 0x02, 0x02, 0x84, 0x0b, 0x09, 0x01, 0x03,
-    0x00, 0x00, 0x03, 0x06, 0x00, 0x03, 0x67, 0x0b,
-    0x09, 0x01, 0x03, 0x00, 0x00, 0x06, 0x5f, 0x08,
-    0x01, 0x06, 0x00, 0x06, 0x4f, 0x2e, 0x2e, 0x00,
-    0x00, 0x2e, 0x35, 0x2e, 0x35, 0x34, 0x33, 0x32,
-    0x31, 0x30, 0x2f, 0x00, 0x2d, 0x00, 0x2d, 0x16,
-    0x16, 0x11, 0x1d, 0x11, 0x0c, 0x06, 0x1b, 0x2b,
-    0x01, 0x11, 0x33, 0x17, 0x1e, 0x01, 0x17, 0x16,
-    0x17, 0x33, 0x36, 0x37, 0x3e, 0x01, 0x3f, 0x01,
-    0x33, 0x11, 0x23, 0x35, 0x34, 0x36, 0x37, 0x36,
-    0x37, 0x23, 0x06, 0x07, 0x0e, 0x01, 0x0f, 0x01,
-    0x23, 0x27, 0x2e, 0x01, 0x27, 0x26, 0x27, 0x23,
-    0x16, 0x17, 0x1e, 0x01, 0x1d, 0x01, 0x03, 0x15,
-    0x23, 0x11, 0x23, 0x11, 0x23, 0x35, 0x01, 0x36,
-    0x50, 0x22, 0x04, 0x04, 0x01, 0x02, 0x01, 0x06,
-    0x01, 0x02, 0x02, 0x04, 0x03, 0x21, 0x4e, 0x37,
-    0x02, 0x02, 0x01, 0x02, 0x09, 0x02, 0x03, 0x02,
-    0x05, 0x02, 0x1e, 0x34, 0x20, 0x02, 0x06, 0x02,
-    0x03, 0x02, 0x08, 0x02, 0x02, 0x02, 0x02, 0x5a,
-    0x64, 0x3c, 0x64, 0x01, 0x72, 0x01, 0x68, 0x66,
-    0x0a, 0x17, 0x0b, 0x0c, 0x0c, 0x0c, 0x0c, 0x0b,
-    0x17, 0x0a, 0x66, 0xfe, 0x98, 0xfb, 0x09, 0x17,
-    0x0b, 0x0d, 0x0d, 0x0e, 0x0c, 0x0b, 0x18, 0x09,
-    0x6e, 0x6f, 0x09, 0x17, 0x0b, 0x0d, 0x0d, 0x0d,
-    0x0d, 0x0b, 0x17, 0x09, 0xfb, 0x01, 0x68, 0x32,
-    0xfe, 0xca, 0x01, 0x36, 0x32, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0xff, 0x5b, 0x02, 0x17,
-    0x02, 0xda, 0x00, 0x1c, 0x00, 0x8c, 0x4b, 0xb0,
-    0x17, 0x50, 0x58, 0x40, 0x20, 0x05, 0x01, 0x02,
-    0x06, 0x01, 0x01, 0x00, 0x02, 0x01, 0x67, 0x00,
-    0x04, 0x04, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x3c,
-    0x4d, 0x08, 0x01, 0x00, 0x00, 0x07, 0x5f, 0x00,
-    0x07, 0x07, 0x3f, 0x07, 0x4e, 0x1b, 0x4b, 0xb0,
-    0x31, 0x50, 0x58, 0x40, 0x20, 0x05, 0x01, 0x02,
-    0x06, 0x01, 0x01, 0x00, 0x02, 0x01, 0x67, 0x00,
-    0x04, 0x04, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x3a,
-    0x4d, 0x08, 0x01, 0x00, 0x00, 0x07, 0x5f, 0x00,
-    0x07, 0x07, 0x3f, 0x07, 0x4e, 0x1b, 0x40, 0x1e,
-    0x00, 0x03, 0x00, 0x04, 0x02, 0x03, 0x04, 0x67,
-    0x05, 0x01, 0x02, 0x06, 0x01, 0x01, 0x00, 0x02,
-    0x01, 0x67, 0x08, 0x01, 0x00, 0x00, 0x07, 0x5f,
-    0x00, 0x07, 0x07, 0x3f, 0x07, 0x4e, 0x59, 0x59,
-    0x40, 0x17, 0x01, 0x00, 0x1b, 0x19, 0x14, 0x13,
-    0x12, 0x11, 0x0f, 0x0d, 0x0c, 0x0a, 0x07, 0x06,
-    0x05, 0x04, 0x00, 0x1c, 0x01, 0x1c, 0x09, 0x09,
-    0x16, 0x2b, 0x17, 0x32, 0x36, 0x35, 0x11, 0x23,
-    0x35, 0x33, 0x35, 0x34, 0x36, 0x3b, 0x01, 0x15,
-    0x23, 0x22, 0x1d, 0x01, 0x33, 0x15, 0x23, 0x11,
-    0x14, 0x0e, 0x02, 0x2b, 0x01, 0x35, 0x69, 0x36,
-    0x3d, 0xa0, 0xa0, 0x51, 0x49, 0xa1, 0xa1, 0x40,
-    0xe1, 0xe1, 0x1d, 0x36, 0x4b, 0x2f, 0x69, 0x53,
-    0x3c, 0x35, 0x01, 0x7f, 0x52, 0x60, 0x42, 0x49,
-    0x50, 0x3c, 0x5f, 0x52, 0xfe, 0x81, 0x2c, 0x48,
-    0x33, 0x1c, 0x52, 0x00, 0x00, 0x02, 0x00, 0x4d,
-    0xff, 0x5c, 0x02, 0x0b, 0x02, 0xda, 0x00, 0x4a,
-    0x00, 0x5f, 0x00, 0x55, 0x40, 0x52, 0x15, 0x01,
-    0x08, 0x03, 0x01, 0x4c, 0x00, 0x03, 0x04, 0x08,
-    0x04, 0x03, 0x08, 0x80, 0x00, 0x08, 0x07, 0x04,
-    0x08, 0x07, 0x7e, 0x00, 0x07, 0x05, 0x04, 0x07,
-    0x05, 0x7e, 0x00, 0x05, 0x00, 0x04, 0x05, 0x00,
-    0x7e, 0x00, 0x00, 0x01, 0x04, 0x00, 0x01, 0x7e,
-    0x00, 0x04, 0x04, 0x02, 0x61, 0x00, 0x02, 0x02,
-    0x42, 0x4d, 0x00, 0x01, 0x01, 0x06, 0x62, 0x00,
-    0x06, 0x06, 0x3f, 0x06, 0x4e, 0x5e, 0x5c, 0x52,
-    0x50, 0x47, 0x44, 0x3a, 0x39, 0x2a, 0x27, 0x25,
-    0x24, 0x20, 0x1d, 0x32, 0x10, 0x09, 0x09, 0x18,
-    0x2b, 0x17, 0x33, 0x1e, 0x01, 0x3b, 0x01, 0x32,
-    0x36, 0x35, 0x34, 0x2f, 0x01, 0x2e, 0x03, 0x35,
-    0x34, 0x3e, 0x02, 0x37, 0x35, 0x26, 0x27, 0x2e,
-    0x01, 0x35, 0x34, 0x36, 0x3b, 0x01, 0x32, 0x1e,
-    0x02, 0x17, 0x23, 0x2e, 0x01, 0x2b, 0x01, 0x22,
-    0x06, 0x15, 0x14, 0x16, 0x1f, 0x01, 0x1e, 0x03,
-    0x15, 0x14, 0x0e, 0x02, 0x23, 0x15, 0x16, 0x17,
-    0x1e, 0x03, 0x15, 0x14, 0x06, 0x2b, 0x01, 0x22,
-    0x2e, 0x02, 0x13, 0x14, 0x16, 0x1f, 0x01, 0x16,
-    0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x26, 0x2f,
-    0x01, 0x2e, 0x01, 0x23, 0x22, 0x06, 0x4d, 0x5f,
-    0x09, 0x3e, 0x2a, 0x1e, 0x39, 0x3c, 0x65, 0x4c,
-    0x26, 0x3e, 0x2d, 0x18, 0x14, 0x22, 0x2f, 0x1c,
-    0x23, 0x1b, 0x18, 0x27, 0x69, 0x5e, 0x1e, 0x27,
-    0x44, 0x34, 0x22, 0x05, 0x5f, 0x08, 0x38, 0x27,
-    0x1e, 0x33, 0x39, 0x33, 0x2e, 0x4a, 0x26, 0x3e,
-    0x2d, 0x18, 0x13, 0x23, 0x31, 0x1e, 0x26, 0x1e,
-    0x0c, 0x18, 0x13, 0x0c, 0x6d, 0x63, 0x1e, 0x29,
-    0x47, 0x37, 0x23, 0x5e, 0x2a, 0x23, 0x4c, 0x0a,
-    0x06, 0x13, 0x1f, 0x16, 0x0c, 0x2c, 0x23, 0x4a,
-    0x05, 0x07, 0x04, 0x26, 0x2e, 0x0a, 0x21, 0x29,
-    0x2f, 0x27, 0x49, 0x14, 0x0f, 0x08, 0x1f, 0x2b,
-    0x35, 0x1e, 0x1d, 0x32, 0x26, 0x18, 0x03, 0x07,
-    0x02, 0x0f, 0x0e, 0x3a, 0x36, 0x4a, 0x57, 0x15,
-    0x26, 0x35, 0x21, 0x1d, 0x24, 0x2c, 0x26, 0x20,
-    0x30, 0x09, 0x0f, 0x07, 0x20, 0x2c, 0x35, 0x1e,
-    0x1d, 0x32, 0x26, 0x15, 0x07, 0x04, 0x11, 0x07,
-    0x16, 0x1f, 0x29, 0x1a, 0x4e, 0x5b, 0x16, 0x29,
-    0x38, 0x01, 0x4f, 0x26, 0x37, 0x07, 0x0f, 0x02,
-    0x12, 0x20, 0x2a, 0x18, 0x23, 0x34, 0x08, 0x0f,
-    0x01, 0x01, 0x41, 0x00, 0x00, 0x02, 0x00, 0x2a,
-    0x00, 0x5f, 0x02, 0x2d, 0x02, 0x69, 0x00, 0x1e,
-    0x00, 0x2a, 0x00, 0x43, 0x40, 0x40, 0x08, 0x06,
-    0x02, 0x03, 0x03, 0x00, 0x1e, 0x19, 0x0e, 0x09,
-    0x04, 0x02, 0x03, 0x18, 0x16, 0x11, 0x0f, 0x04,
-    0x01, 0x02, 0x03, 0x4c, 0x07, 0x01, 0x02, 0x00,
-    0x4a, 0x17, 0x10, 0x02, 0x01, 0x49, 0x04, 0x01,
-    0x02, 0x00, 0x01, 0x02, 0x01, 0x65, 0x00, 0x03,
-    0x03, 0x00, 0x61, 0x00, 0x00, 0x00, 0x45, 0x03,
-    0x4e, 0x20, 0x1f, 0x26, 0x24, 0x1f, 0x2a, 0x20,
-    0x2a, 0x2e, 0x23, 0x05, 0x09, 0x18, 0x2b, 0x13,
-    0x37, 0x17, 0x36, 0x33, 0x32, 0x17, 0x37, 0x17,
-    0x07, 0x1e, 0x01, 0x15, 0x14, 0x07, 0x17, 0x07,
-    0x27, 0x0e, 0x01, 0x23, 0x22, 0x27, 0x07, 0x27,
-    0x37, 0x26, 0x35, 0x34, 0x36, 0x37, 0x17, 0x32,
-    0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15,
-    0x14, 0x16, 0x2a, 0x3f, 0x58, 0x2f, 0x3b, 0x3e,
-    0x30, 0x55, 0x3f, 0x55, 0x0e, 0x0f, 0x1f, 0x57,
-    0x3f, 0x57, 0x17, 0x37, 0x1e, 0x3d, 0x2e, 0x57,
-    0x3f, 0x56, 0x20, 0x11, 0x0f, 0xab, 0x3a, 0x46,
-    0x46, 0x3a, 0x3a, 0x47, 0x47, 0x02, 0x2a, 0x3f,
-    0x58, 0x1c, 0x1f, 0x55, 0x3f, 0x55, 0x17, 0x37,
-    0x1e, 0x3e, 0x30, 0x57, 0x3f, 0x57, 0x0e, 0x0f,
-    0x1d, 0x57, 0x3f, 0x56, 0x2f, 0x40, 0x20, 0x39,
-    0x18, 0xf2, 0x47, 0x3a, 0x3a, 0x47, 0x47, 0x3a,
-    0x3a, 0x47, 0x00, 0x00, 0x00, 0x01, 0x00, 0x58,
-    0xff, 0xa5, 0x02, 0x10, 0x02, 0x80, 0x00, 0x23,
-    0x00, 0x3f, 0x40, 0x3c, 0x0a, 0x07, 0x02, 0x02,
-    0x00, 0x21, 0x00, 0x02, 0x05, 0x03, 0x02, 0x4c,
-    0x00, 0x01, 0x02, 0x04, 0x02, 0x01, 0x04, 0x80,
-    0x00, 0x04, 0x03, 0x02, 0x04, 0x03, 0x7e, 0x00,
-    0x00, 0x00, 0x02, 0x01, 0x00, 0x02, 0x69, 0x00,
-    0x03, 0x05, 0x05, 0x03, 0x59, 0x00, 0x03, 0x03,
-    0x05, 0x5f, 0x00, 0x05, 0x03, 0x05, 0x4f, 0x14,
-    0x12, 0x25, 0x24, 0x14, 0x18, 0x06, 0x09, 0x1c,
-    0x2b, 0x05, 0x2e, 0x01, 0x3d, 0x01, 0x34, 0x36,
-    0x37, 0x35, 0x33, 0x15, 0x1e, 0x01, 0x17, 0x23,
-    0x2e, 0x03, 0x23, 0x22, 0x06, 0x1d, 0x01, 0x14,
-    0x16, 0x33, 0x32, 0x36, 0x37, 0x33, 0x0e, 0x01,
-    0x07, 0x15, 0x23, 0x01, 0x04, 0x51, 0x5b, 0x5b,
-    0x51, 0x5a, 0x49, 0x5e, 0x0b, 0x5a, 0x03, 0x18,
-    0x23, 0x2c, 0x18, 0x3d, 0x45, 0x45, 0x3d, 0x30,
-    0x4b, 0x07, 0x5a, 0x0b, 0x5e, 0x49, 0x5a, 0x06,
-    0x0e, 0x6e, 0x57, 0x8c, 0x57, 0x6e, 0x0e, 0x54,
-    0x53, 0x0b, 0x60, 0x4b, 0x19, 0x27, 0x1b, 0x0e,
-    0x48, 0x3f, 0x8c, 0x3f, 0x48, 0x38, 0x31, 0x4c,
-    0x5f, 0x0b, 0x54, 0x00, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x00, 0x02, 0x17, 0x02, 0xd0, 0x00, 0x2f,
-    0x00, 0x3c, 0x40, 0x39, 0x27, 0x01, 0x06, 0x05,
-    0x01, 0x4c, 0x00, 0x02, 0x03, 0x00, 0x03, 0x02,
-    0x00, 0x80, 0x04, 0x01, 0x00, 0x08, 0x01, 0x05,
-    0x06, 0x00, 0x05, 0x67, 0x00, 0x03, 0x03, 0x01,
-    0x61, 0x00, 0x01, 0x01, 0x3a, 0x4d, 0x00, 0x06,
-    0x06, 0x07, 0x5f, 0x00, 0x07, 0x07, 0x3b, 0x07,
-    0x4e, 0x18, 0x11, 0x18, 0x11, 0x17, 0x22, 0x12,
-    0x27, 0x10, 0x09, 0x09, 0x1f, 0x2b, 0x13, 0x33,
-    0x2e, 0x03, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16,
-    0x17, 0x23, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15,
-    0x14, 0x1e, 0x02, 0x17, 0x33, 0x15, 0x23, 0x1e,
-    0x01, 0x15, 0x14, 0x06, 0x07, 0x06, 0x07, 0x21,
-    0x15, 0x21, 0x35, 0x36, 0x37, 0x3e, 0x01, 0x35,
-    0x34, 0x27, 0x23, 0x4b, 0x4c, 0x0a, 0x17, 0x14,
-    0x0c, 0x72, 0x64, 0x64, 0x72, 0x02, 0x5f, 0x43,
-    0x37, 0x38, 0x42, 0x0e, 0x16, 0x19, 0x0b, 0xba,
-    0xa2, 0x01, 0x01, 0x22, 0x15, 0x18, 0x1f, 0x01,
-    0x72, 0xfe, 0x34, 0x1f, 0x18, 0x14, 0x22, 0x04,
-    0x69, 0x01, 0x68, 0x13, 0x22, 0x25, 0x2a, 0x1b,
-    0x61, 0x68, 0x65, 0x5a, 0x33, 0x3c, 0x3b, 0x38,
-    0x1f, 0x2b, 0x24, 0x22, 0x15, 0x50, 0x08, 0x13,
-    0x0a, 0x2d, 0x3d, 0x14, 0x17, 0x0e, 0x50, 0x64,
-    0x14, 0x16, 0x13, 0x2f, 0x1a, 0x1b, 0x13, 0x00,
-    0x00, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x02, 0x3a,
-    0x02, 0xd0, 0x00, 0x21, 0x00, 0x38, 0x40, 0x35,
-    0x09, 0x01, 0x01, 0x08, 0x01, 0x02, 0x03, 0x01,
-    0x02, 0x68, 0x07, 0x01, 0x03, 0x06, 0x01, 0x04,
-    0x05, 0x03, 0x04, 0x67, 0x0b, 0x0a, 0x02, 0x00,
-    0x00, 0x3a, 0x4d, 0x00, 0x05, 0x05, 0x3b, 0x05,
-    0x4e, 0x00, 0x00, 0x00, 0x21, 0x00, 0x21, 0x20,
-    0x1f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x1d, 0x0c, 0x09, 0x1f, 0x2b, 0x1b, 0x01,
-    0x1e, 0x03, 0x17, 0x33, 0x3e, 0x03, 0x37, 0x13,
-    0x33, 0x03, 0x33, 0x15, 0x23, 0x15, 0x33, 0x15,
-    0x23, 0x15, 0x23, 0x35, 0x23, 0x35, 0x33, 0x35,
-    0x23, 0x35, 0x33, 0x03, 0x7d, 0x94, 0x06, 0x09,
-    0x07, 0x04, 0x01, 0x04, 0x01, 0x04, 0x07, 0x09,
-    0x06, 0x8f, 0x60, 0xbb, 0x9d, 0xc3, 0xc3, 0xc3,
-    0x5a, 0xc3, 0xc3, 0xc3, 0x9e, 0xbc, 0x02, 0xd0,
-    0xfe, 0xd7, 0x0c, 0x1a, 0x16, 0x0f, 0x03, 0x03,
-    0x0f, 0x16, 0x1a, 0x0c, 0x01, 0x29, 0xfe, 0x89,
-    0x4b, 0x4b, 0x4b, 0x78, 0x78, 0x4b, 0x4b, 0x4b,
-    0x01, 0x77, 0x00, 0x00, 0x00, 0x02, 0x00, 0xaf,
-    0x01, 0xc2, 0x01, 0xa4, 0x02, 0xe4, 0x00, 0x1b,
-    0x00, 0x26, 0x00, 0xe6, 0xb5, 0x15, 0x01, 0x06,
-    0x07, 0x01, 0x4c, 0x4b, 0xb0, 0x21, 0x50, 0x58,
-    0x40, 0x25, 0x00, 0x02, 0x01, 0x00, 0x01, 0x02,
-    0x00, 0x80, 0x00, 0x03, 0x00, 0x01, 0x02, 0x03,
-    0x01, 0x69, 0x00, 0x00, 0x00, 0x07, 0x06, 0x00,
-    0x07, 0x67, 0x08, 0x01, 0x06, 0x06, 0x04, 0x61,
-    0x05, 0x01, 0x04, 0x04, 0x5b, 0x04, 0x4e, 0x1b,
-    0x4b, 0xb0, 0x2e, 0x50, 0x58, 0x40, 0x2b, 0x00,
-    0x02, 0x01, 0x00, 0x01, 0x02, 0x00, 0x80, 0x00,
-    0x03, 0x00, 0x01, 0x02, 0x03, 0x01, 0x69, 0x00,
-    0x00, 0x00, 0x07, 0x06, 0x00, 0x07, 0x67, 0x08,
-    0x01, 0x06, 0x04, 0x04, 0x06, 0x59, 0x08, 0x01,
-    0x06, 0x06, 0x04, 0x61, 0x05, 0x01, 0x04, 0x06,
-    0x04, 0x51, 0x1b, 0x4b, 0xb0, 0x32, 0x50, 0x58,
-    0x40, 0x2c, 0x00, 0x02, 0x01, 0x00, 0x01, 0x02,
-    0x00, 0x80, 0x00, 0x04, 0x06, 0x05, 0x06, 0x04,
-    0x05, 0x80, 0x00, 0x03, 0x00, 0x01, 0x02, 0x03,
-    0x01, 0x69, 0x00, 0x00, 0x00, 0x07, 0x06, 0x00,
-    0x07, 0x67, 0x08, 0x01, 0x06, 0x06, 0x05, 0x61,
-    0x00, 0x05, 0x05, 0x5b, 0x05, 0x4e, 0x1b, 0x40,
-    0x32, 0x00, 0x02, 0x01, 0x00, 0x01, 0x02, 0x00,
-    0x80, 0x00, 0x04, 0x06, 0x05, 0x06, 0x04, 0x05,
-    0x80, 0x00, 0x03, 0x00, 0x01, 0x02, 0x03, 0x01,
-    0x69, 0x00, 0x00, 0x00, 0x07, 0x06, 0x00, 0x07,
-    0x67, 0x08, 0x01, 0x06, 0x04, 0x05, 0x06, 0x59,
-    0x08, 0x01, 0x06, 0x06, 0x05, 0x61, 0x00, 0x05,
-    0x06, 0x05, 0x51, 0x59, 0x59, 0x59, 0x40, 0x11,
-    0x1d, 0x1c, 0x22, 0x20, 0x1c, 0x26, 0x1d, 0x26,
-    0x24, 0x13, 0x22, 0x12, 0x23, 0x22, 0x09, 0x0b,
-    0x1c, 0x2b, 0x13, 0x34, 0x36, 0x3b, 0x01, 0x35,
-    0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x23, 0x3e,
-    0x01, 0x33, 0x32, 0x16, 0x1d, 0x01, 0x23, 0x35,
-    0x23, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x17, 0x32,
-    0x36, 0x3d, 0x01, 0x23, 0x22, 0x06, 0x15, 0x14,
-    0x16, 0xaf, 0x38, 0x31, 0x5a, 0x23, 0x1e, 0x1a,
-    0x24, 0x03, 0x32, 0x05, 0x3c, 0x32, 0x36, 0x3d,
-    0x2f, 0x03, 0x0b, 0x32, 0x23, 0x2d, 0x36, 0x70,
-    0x27, 0x2c, 0x5a, 0x1a, 0x1d, 0x21, 0x02, 0x18,
-    0x27, 0x2e, 0x1d, 0x17, 0x1b, 0x16, 0x12, 0x26,
-    0x2a, 0x30, 0x2a, 0xc3, 0x37, 0x1c, 0x20, 0x2f,
-    0x09, 0x23, 0x20, 0x1a, 0x18, 0x15, 0x17, 0x19,
-    0x00, 0x02, 0x00, 0xb9, 0x01, 0xbd, 0x01, 0x9f,
-    0x02, 0xdf, 0x00, 0x0d, 0x00, 0x1b, 0x00, 0x1d,
-    0x40, 0x1a, 0x00, 0x03, 0x00, 0x01, 0x00, 0x03,
-    0x01, 0x69, 0x00, 0x00, 0x00, 0x02, 0x61, 0x00,
-    0x02, 0x02, 0x5b, 0x02, 0x4e, 0x25, 0x25, 0x25,
-    0x22, 0x04, 0x0b, 0x1a, 0x2b, 0x13, 0x14, 0x16,
-    0x33, 0x32, 0x36, 0x3d, 0x01, 0x34, 0x26, 0x23,
-    0x22, 0x06, 0x15, 0x17, 0x14, 0x06, 0x23, 0x22,
-    0x26, 0x3d, 0x01, 0x34, 0x36, 0x33, 0x32, 0x16,
-    0x15, 0xeb, 0x24, 0x1d, 0x1d, 0x24, 0x24, 0x1d,
-    0x1d, 0x24, 0xb4, 0x3f, 0x34, 0x34, 0x3f, 0x3f,
-    0x34, 0x34, 0x3f, 0x02, 0x26, 0x1d, 0x24, 0x24,
-    0x1d, 0x50, 0x1d, 0x24, 0x24, 0x1d, 0x50, 0x30,
-    0x39, 0x39, 0x30, 0x50, 0x30, 0x39, 0x39, 0x30,
-    0x00, 0x01, 0x00, 0xb4, 0x01, 0xb8, 0x01, 0xc7,
-    0x02, 0xfd, 0x00, 0x13, 0x00, 0x28, 0x40, 0x25,
-    0x0e, 0x0d, 0x02, 0x00, 0x01, 0x01, 0x4c, 0x00,
-    0x01, 0x01, 0x5a, 0x4d, 0x02, 0x01, 0x00, 0x00,
-    0x03, 0x60, 0x04, 0x01, 0x03, 0x03, 0x5b, 0x03,
-    0x4e, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x11,
-    0x1d, 0x11, 0x05, 0x0b, 0x19, 0x2b, 0x13, 0x35,
-    0x33, 0x35, 0x34, 0x36, 0x35, 0x23, 0x06, 0x07,
-    0x0e, 0x01, 0x0f, 0x01, 0x35, 0x37, 0x33, 0x11,
-    0x33, 0x15, 0xb4, 0x76, 0x06, 0x06, 0x04, 0x05,
-    0x05, 0x0b, 0x08, 0x3e, 0x46, 0x55, 0x61, 0x01,
-    0xb8, 0x32, 0xb7, 0x18, 0x17, 0x01, 0x04, 0x06,
-    0x05, 0x0b, 0x07, 0x36, 0x46, 0x3d, 0xfe, 0xed,
-    0x32, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x9b,
-    0x01, 0xb8, 0x01, 0x9a, 0x03, 0x02, 0x00, 0x1d,
-    0x00, 0x33, 0x40, 0x30, 0x0e, 0x04, 0x02, 0x00,
-    0x03, 0x05, 0x01, 0x01, 0x00, 0x02, 0x4c, 0x00,
-    0x03, 0x02, 0x00, 0x02, 0x03, 0x00, 0x80, 0x00,
-    0x02, 0x02, 0x04, 0x61, 0x00, 0x04, 0x04, 0x5e,
-    0x4d, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x00, 0x01,
-    0x01, 0x5b, 0x01, 0x4e, 0x22, 0x12, 0x26, 0x11,
-    0x29, 0x05, 0x0b, 0x1b, 0x2b, 0x01, 0x14, 0x06,
-    0x0f, 0x01, 0x15, 0x36, 0x37, 0x3e, 0x01, 0x3b,
-    0x01, 0x15, 0x23, 0x35, 0x37, 0x36, 0x35, 0x34,
-    0x26, 0x23, 0x22, 0x06, 0x15, 0x23, 0x3e, 0x01,
-    0x33, 0x32, 0x16, 0x01, 0x95, 0x2c, 0x2a, 0x5d,
-    0x0a, 0x0d, 0x0a, 0x1b, 0x0f, 0x6d, 0xff, 0x78,
-    0x46, 0x24, 0x1d, 0x1d, 0x24, 0x3c, 0x02, 0x45,
-    0x36, 0x39, 0x44, 0x02, 0x92, 0x1f, 0x3c, 0x17,
-    0x34, 0x0a, 0x02, 0x02, 0x02, 0x02, 0x32, 0x40,
-    0x45, 0x28, 0x2b, 0x1d, 0x23, 0x23, 0x1d, 0x34,
-    0x3e, 0x3d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x9b,
-    0x01, 0xb3, 0x01, 0x9a, 0x02, 0xfd, 0x00, 0x23,
-    0x00, 0x78, 0x40, 0x0c, 0x10, 0x01, 0x04, 0x05,
-    0x1e, 0x1a, 0x0f, 0x03, 0x03, 0x04, 0x02, 0x4c,
-    0x4b, 0xb0, 0x0b, 0x50, 0x58, 0x40, 0x24, 0x00,
-    0x03, 0x04, 0x01, 0x04, 0x03, 0x72, 0x00, 0x01,
-    0x02, 0x04, 0x01, 0x02, 0x7e, 0x00, 0x04, 0x04,
-    0x05, 0x5f, 0x00, 0x05, 0x05, 0x5a, 0x4d, 0x00,
-    0x02, 0x02, 0x00, 0x61, 0x06, 0x01, 0x00, 0x00,
-    0x5f, 0x00, 0x4e, 0x1b, 0x40, 0x25, 0x00, 0x03,
-    0x04, 0x01, 0x04, 0x03, 0x01, 0x80, 0x00, 0x01,
-    0x02, 0x04, 0x01, 0x02, 0x7e, 0x00, 0x04, 0x04,
-    0x05, 0x5f, 0x00, 0x05, 0x05, 0x5a, 0x4d, 0x00,
-    0x02, 0x02, 0x00, 0x61, 0x06, 0x01, 0x00, 0x00,
-    0x5f, 0x00, 0x4e, 0x59, 0x40, 0x13, 0x01, 0x00,
-    0x19, 0x18, 0x17, 0x15, 0x0e, 0x0c, 0x08, 0x06,
-    0x04, 0x03, 0x00, 0x23, 0x01, 0x23, 0x07, 0x0b,
-    0x16, 0x2b, 0x01, 0x22, 0x26, 0x35, 0x33, 0x14,
-    0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x2b,
-    0x01, 0x35, 0x37, 0x35, 0x06, 0x07, 0x0e, 0x01,
-    0x2b, 0x01, 0x35, 0x33, 0x15, 0x07, 0x0e, 0x01,
-    0x07, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x01, 0x1c,
-    0x3a, 0x47, 0x3c, 0x26, 0x1f, 0x1e, 0x24, 0x24,
-    0x1d, 0x1e, 0x5d, 0x09, 0x0b, 0x0a, 0x18, 0x0e,
-    0x64, 0xd7, 0x39, 0x07, 0x11, 0x08, 0x30, 0x38,
-    0x45, 0x01, 0xb3, 0x39, 0x30, 0x19, 0x1e, 0x1e,
-    0x19, 0x19, 0x1e, 0x3c, 0x40, 0x07, 0x03, 0x02,
-    0x02, 0x04, 0x32, 0x3c, 0x2c, 0x05, 0x09, 0x03,
-    0x05, 0x37, 0x2c, 0x30, 0x39, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0xaa, 0x01, 0xb3, 0x01, 0xae,
-    0x03, 0x02, 0x00, 0x0d, 0x00, 0x1b, 0x00, 0x2d,
-    0x40, 0x2a, 0x04, 0x01, 0x00, 0x00, 0x03, 0x61,
-    0x00, 0x03, 0x03, 0x5e, 0x4d, 0x00, 0x01, 0x01,
-    0x02, 0x61, 0x05, 0x01, 0x02, 0x02, 0x5f, 0x02,
-    0x4e, 0x0f, 0x0e, 0x01, 0x00, 0x16, 0x14, 0x0e,
-    0x1b, 0x0f, 0x1b, 0x08, 0x06, 0x00, 0x0d, 0x01,
-    0x0d, 0x06, 0x0b, 0x16, 0x2b, 0x01, 0x22, 0x06,
-    0x1d, 0x01, 0x14, 0x16, 0x33, 0x32, 0x36, 0x3d,
-    0x01, 0x34, 0x26, 0x03, 0x22, 0x26, 0x3d, 0x01,
-    0x34, 0x36, 0x33, 0x32, 0x16, 0x1d, 0x01, 0x14,
-    0x06, 0x01, 0x2c, 0x23, 0x23, 0x23, 0x23, 0x26,
-    0x20, 0x23, 0x23, 0x3f, 0x43, 0x43, 0x3f, 0x3f,
-    0x43, 0x43, 0x02, 0xcb, 0x2b, 0x25, 0x41, 0x25,
-    0x2b, 0x2f, 0x21, 0x41, 0x25, 0x2b, 0xfe, 0xe8,
-    0x48, 0x3f, 0x41, 0x3f, 0x48, 0x48, 0x3f, 0x41,
-    0x3f, 0x48, 0x00, 0x00, 0x00, 0x01, 0x00, 0xaf,
-    0x01, 0xb8, 0x01, 0x9b, 0x02, 0xfd, 0x00, 0x0b,
-    0x00, 0x2a, 0x40, 0x27, 0x0b, 0x02, 0x02, 0x01,
-    0x02, 0x01, 0x4c, 0x00, 0x01, 0x00, 0x04, 0x03,
-    0x01, 0x04, 0x68, 0x00, 0x00, 0x00, 0x5a, 0x4d,
-    0x00, 0x02, 0x02, 0x03, 0x5f, 0x00, 0x03, 0x03,
-    0x5b, 0x03, 0x4e, 0x11, 0x11, 0x11, 0x12, 0x10,
-    0x05, 0x0b, 0x1b, 0x2b, 0x01, 0x33, 0x07, 0x15,
-    0x33, 0x35, 0x33, 0x15, 0x23, 0x35, 0x23, 0x35,
-    0x01, 0x2d, 0x45, 0x87, 0x74, 0x3c, 0x3c, 0xb0,
-    0x02, 0xfd, 0xbd, 0x10, 0x59, 0xd1, 0x46, 0x50,
-    0xff, 0xff, 0x00, 0xaa, 0xff, 0xce, 0x01, 0xae,
-    0x01, 0x1d, 0x11, 0x03, 0x01, 0x7d, 0x00, 0x00,
-    0xfe, 0x1b, 0x00, 0x2d, 0x40, 0x2a, 0x04, 0x01,
-    0x00, 0x00, 0x03, 0x61, 0x00, 0x03, 0x03, 0x52,
-    0x4d, 0x00, 0x01, 0x01, 0x02, 0x61, 0x05, 0x01,
-    0x02, 0x02, 0x53, 0x02, 0x4e, 0x10, 0x0f, 0x02,
-    0x01, 0x17, 0x15, 0x0f, 0x1c, 0x10, 0x1c, 0x09,
-    0x07, 0x01, 0x0e, 0x02, 0x0e, 0x06, 0x0a, 0x21,
-    0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xb4,
-    0xff, 0xd2, 0x01, 0xc7, 0x01, 0x17, 0x11, 0x03,
-    0x01, 0x7a, 0x00, 0x00, 0xfe, 0x1a, 0x00, 0x28,
-    0x40, 0x25, 0x0f, 0x0e, 0x02, 0x00, 0x01, 0x01,
-    0x4c, 0x00, 0x01, 0x01, 0x4e, 0x4d, 0x02, 0x01,
-    0x00, 0x00, 0x03, 0x60, 0x04, 0x01, 0x03, 0x03,
-    0x4f, 0x03, 0x4e, 0x01, 0x01, 0x01, 0x14, 0x01,
-    0x14, 0x11, 0x1d, 0x12, 0x05, 0x0a, 0x24, 0x2b,
-    0xff, 0xff, 0x00, 0x9b, 0xff, 0xd3, 0x01, 0x9a,
-    0x01, 0x1d, 0x11, 0x03, 0x01, 0x7b, 0x00, 0x00,
-    0xfe, 0x1b, 0x00, 0x33, 0x40, 0x30, 0x0f, 0x05,
-    0x02, 0x00, 0x03, 0x06, 0x01, 0x01, 0x00, 0x02,
-    0x4c, 0x00, 0x03, 0x02, 0x00, 0x02, 0x03, 0x00,
-    0x80, 0x00, 0x02, 0x02, 0x04, 0x61, 0x00, 0x04,
-    0x04, 0x52, 0x4d, 0x00, 0x00, 0x00, 0x01, 0x5f,
-    0x00, 0x01, 0x01, 0x4f, 0x01, 0x4e, 0x22, 0x12,
-    0x26, 0x11, 0x2a, 0x05, 0x0a, 0x26, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0x9b, 0xff, 0xce, 0x01, 0x9a,
-    0x01, 0x18, 0x11, 0x03, 0x01, 0x7c, 0x00, 0x00,
-    0xfe, 0x1b, 0x00, 0x78, 0x40, 0x0c, 0x11, 0x01,
-    0x04, 0x05, 0x1f, 0x1b, 0x10, 0x03, 0x03, 0x04,
-    0x02, 0x4c, 0x4b, 0xb0, 0x0b, 0x50, 0x58, 0x40,
-    0x24, 0x00, 0x03, 0x04, 0x01, 0x04, 0x03, 0x72,
-    0x00, 0x01, 0x02, 0x04, 0x01, 0x02, 0x7e, 0x00,
-    0x04, 0x04, 0x05, 0x5f, 0x00, 0x05, 0x05, 0x4e,
-    0x4d, 0x00, 0x02, 0x02, 0x00, 0x61, 0x06, 0x01,
-    0x00, 0x00, 0x53, 0x00, 0x4e, 0x1b, 0x40, 0x25,
-    0x00, 0x03, 0x04, 0x01, 0x04, 0x03, 0x01, 0x80,
-    0x00, 0x01, 0x02, 0x04, 0x01, 0x02, 0x7e, 0x00,
-    0x04, 0x04, 0x05, 0x5f, 0x00, 0x05, 0x05, 0x4e,
-    0x4d, 0x00, 0x02, 0x02, 0x00, 0x61, 0x06, 0x01,
-    0x00, 0x00, 0x53, 0x00, 0x4e, 0x59, 0x40, 0x13,
-    0x02, 0x01, 0x1a, 0x19, 0x18, 0x16, 0x0f, 0x0d,
-    0x09, 0x07, 0x05, 0x04, 0x01, 0x24, 0x02, 0x24,
-    0x07, 0x0a, 0x21, 0x2b, 0xff, 0xff, 0x00, 0xaf,
-    0xff, 0xd3, 0x01, 0x9b, 0x01, 0x18, 0x11, 0x03,
-    0x01, 0x7e, 0x00, 0x00, 0xfe, 0x1b, 0x00, 0x2a,
-    0x40, 0x27, 0x0c, 0x03, 0x02, 0x01, 0x02, 0x01,
-    0x4c, 0x00, 0x01, 0x00, 0x04, 0x03, 0x01, 0x04,
-    0x68, 0x00, 0x00, 0x00, 0x4e, 0x4d, 0x00, 0x02,
-    0x02, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x4f, 0x03,
-    0x4e, 0x11, 0x11, 0x11, 0x12, 0x11, 0x05, 0x0a,
-    0x26, 0x2b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x5c,
-    0x00, 0x00, 0x01, 0xfc, 0x02, 0xc6, 0x00, 0x03,
-    0x00, 0x28, 0x4b, 0xb0, 0x31, 0x50, 0x58, 0x40,
-    0x0b, 0x00, 0x00, 0x00, 0x3a, 0x4d, 0x00, 0x01,
-    0x01, 0x3b, 0x01, 0x4e, 0x1b, 0x40, 0x0b, 0x00,
-    0x00, 0x01, 0x00, 0x85, 0x00, 0x01, 0x01, 0x3b,
-    0x01, 0x4e, 0x59, 0xb4, 0x11, 0x10, 0x02, 0x09,
-    0x18, 0x2b, 0x01, 0x33, 0x01, 0x23, 0x01, 0xbf,
-    0x3d, 0xfe, 0x9d, 0x3d, 0x02, 0xc6, 0xfd, 0x3a,
-    0x00, 0x02, 0x00, 0x1e, 0x00, 0x00, 0x02, 0x1d,
-    0x02, 0xd0, 0x00, 0x18, 0x00, 0x24, 0x00, 0xbf,
-    0xb1, 0x06, 0x64, 0x44, 0x4b, 0xb0, 0x18, 0x50,
-    0x58, 0x40, 0x10, 0x0c, 0x0b, 0x02, 0x01, 0x00,
-    0x11, 0x01, 0x04, 0x01, 0x24, 0x1b, 0x02, 0x07,
-    0x08, 0x03, 0x4c, 0x1b, 0x40, 0x10, 0x0c, 0x0b,
-    0x02, 0x01, 0x02, 0x11, 0x01, 0x04, 0x01, 0x24,
-    0x1b, 0x02, 0x07, 0x08, 0x03, 0x4c, 0x59, 0x4b,
-    0xb0, 0x18, 0x50, 0x58, 0x40, 0x31, 0x02, 0x01,
-    0x00, 0x01, 0x00, 0x85, 0x00, 0x06, 0x04, 0x08,
-    0x04, 0x06, 0x08, 0x80, 0x0b, 0x05, 0x02, 0x01,
-    0x00, 0x04, 0x06, 0x01, 0x04, 0x68, 0x00, 0x08,
-    0x07, 0x03, 0x08, 0x57, 0x00, 0x07, 0x00, 0x0a,
-    0x03, 0x07, 0x0a, 0x68, 0x00, 0x08, 0x08, 0x03,
-    0x5f, 0x09, 0x01, 0x03, 0x08, 0x03, 0x4f, 0x1b,
-    0x40, 0x35, 0x00, 0x00, 0x02, 0x00, 0x85, 0x00,
-    0x02, 0x01, 0x02, 0x85, 0x00, 0x06, 0x04, 0x08,
-    0x04, 0x06, 0x08, 0x80, 0x0b, 0x05, 0x02, 0x01,
-    0x00, 0x04, 0x06, 0x01, 0x04, 0x68, 0x00, 0x08,
-    0x07, 0x03, 0x08, 0x57, 0x00, 0x07, 0x00, 0x0a,
-    0x03, 0x07, 0x0a, 0x68, 0x00, 0x08, 0x08, 0x03,
-    0x5f, 0x09, 0x01, 0x03, 0x08, 0x03, 0x4f, 0x59,
-    0x40, 0x18, 0x00, 0x00, 0x23, 0x22, 0x21, 0x20,
-    0x1f, 0x1e, 0x1d, 0x1c, 0x1a, 0x19, 0x00, 0x18,
-    0x00, 0x18, 0x11, 0x11, 0x12, 0x11, 0x1d, 0x0c,
-    0x09, 0x1b, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x13,
-    0x35, 0x34, 0x36, 0x35, 0x23, 0x06, 0x07, 0x0e,
-    0x01, 0x0f, 0x01, 0x35, 0x37, 0x33, 0x11, 0x33,
-    0x15, 0x13, 0x33, 0x01, 0x23, 0x13, 0x21, 0x35,
-    0x05, 0x33, 0x07, 0x15, 0x33, 0x35, 0x33, 0x15,
-    0x23, 0x35, 0x23, 0x35, 0x94, 0x06, 0x06, 0x04,
-    0x05, 0x05, 0x0b, 0x08, 0x3e, 0x46, 0x55, 0x61,
-    0x8e, 0x3d, 0xfe, 0x9d, 0x3d, 0xc6, 0xfe, 0xfc,
-    0x01, 0x91, 0x45, 0x87, 0x74, 0x3c, 0x3c, 0xb0,
-    0x01, 0xbd, 0xb7, 0x18, 0x17, 0x01, 0x04, 0x06,
-    0x05, 0x0b, 0x07, 0x36, 0x46, 0x3d, 0xfe, 0xed,
-    0x13, 0x01, 0x1c, 0xfd, 0x3a, 0x01, 0x8b, 0x32,
-    0x78, 0xbd, 0x10, 0x59, 0xd1, 0x46, 0x50, 0x00,
-    0x00, 0x02, 0x00, 0x1e, 0x00, 0x00, 0x02, 0x3a,
-    0x02, 0xd0, 0x00, 0x18, 0x00, 0x36, 0x00, 0xcd,
-    0xb1, 0x06, 0x64, 0x44, 0x4b, 0xb0, 0x18, 0x50,
-    0x58, 0x40, 0x14, 0x0c, 0x0b, 0x02, 0x01, 0x00,
-    0x11, 0x01, 0x04, 0x01, 0x2e, 0x1a, 0x02, 0x09,
-    0x07, 0x2f, 0x01, 0x03, 0x09, 0x04, 0x4c, 0x1b,
-    0x40, 0x14, 0x0c, 0x0b, 0x02, 0x01, 0x02, 0x11,
-    0x01, 0x04, 0x01, 0x2e, 0x1a, 0x02, 0x09, 0x07,
-    0x2f, 0x01, 0x03, 0x09, 0x04, 0x4c, 0x59, 0x4b,
-    0xb0, 0x18, 0x50, 0x58, 0x40, 0x32, 0x02, 0x01,
-    0x00, 0x01, 0x00, 0x85, 0x00, 0x07, 0x06, 0x09,
-    0x06, 0x07, 0x09, 0x80, 0x0b, 0x05, 0x02, 0x01,
-    0x00, 0x04, 0x08, 0x01, 0x04, 0x68, 0x00, 0x08,
-    0x00, 0x06, 0x07, 0x08, 0x06, 0x69, 0x00, 0x09,
-    0x03, 0x03, 0x09, 0x57, 0x00, 0x09, 0x09, 0x03,
-    0x5f, 0x0c, 0x0a, 0x02, 0x03, 0x09, 0x03, 0x4f,
-    0x1b, 0x40, 0x36, 0x00, 0x00, 0x02, 0x00, 0x85,
-    0x00, 0x02, 0x01, 0x02, 0x85, 0x00, 0x07, 0x06,
-    0x09, 0x06, 0x07, 0x09, 0x80, 0x0b, 0x05, 0x02,
-    0x01, 0x00, 0x04, 0x08, 0x01, 0x04, 0x68, 0x00,
-    0x08, 0x00, 0x06, 0x07, 0x08, 0x06, 0x6a, 0x00,
-    0x09, 0x03, 0x03, 0x09, 0x57, 0x00, 0x09, 0x09,
-    0x03, 0x5f, 0x0c, 0x0a, 0x02, 0x03, 0x09, 0x03,
-    0x4f, 0x59, 0x40, 0x1c, 0x19, 0x19, 0x00, 0x00,
-    0x19, 0x36, 0x19, 0x36, 0x35, 0x33, 0x28, 0x26,
-    0x24, 0x23, 0x21, 0x1f, 0x00, 0x18, 0x00, 0x18,
-    0x11, 0x11, 0x12, 0x11, 0x1d, 0x0d, 0x09, 0x1b,
-    0x2b, 0xb1, 0x06, 0x00, 0x44, 0x13, 0x35, 0x34,
-    0x36, 0x35, 0x23, 0x06, 0x07, 0x0e, 0x01, 0x0f,
-    0x01, 0x35, 0x37, 0x33, 0x11, 0x33, 0x15, 0x13,
-    0x33, 0x01, 0x23, 0x13, 0x21, 0x35, 0x01, 0x35,
-    0x37, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06,
-    0x15, 0x23, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x15,
-    0x14, 0x06, 0x0f, 0x01, 0x15, 0x36, 0x37, 0x3e,
-    0x01, 0x3b, 0x01, 0x15, 0x94, 0x06, 0x06, 0x04,
-    0x05, 0x05, 0x0b, 0x08, 0x3e, 0x46, 0x55, 0x61,
-    0x8e, 0x3d, 0xfe, 0x9d, 0x3d, 0xc6, 0xfe, 0xfc,
-    0x01, 0x1d, 0x78, 0x46, 0x24, 0x1d, 0x1d, 0x24,
-    0x3c, 0x02, 0x45, 0x36, 0x39, 0x44, 0x2c, 0x2a,
-    0x5d, 0x0a, 0x0d, 0x0a, 0x1b, 0x0f, 0x6d, 0x01,
-    0xbd, 0xb7, 0x18, 0x17, 0x01, 0x04, 0x06, 0x05,
-    0x0b, 0x07, 0x36, 0x46, 0x3d, 0xfe, 0xed, 0x13,
-    0x01, 0x1c, 0xfd, 0x3a, 0x01, 0x8b, 0x32, 0xfe,
-    0x43, 0x40, 0x45, 0x28, 0x2b, 0x1d, 0x23, 0x23,
-    0x1d, 0x34, 0x3e, 0x3d, 0x33, 0x1f, 0x3c, 0x17,
-    0x34, 0x0a, 0x02, 0x02, 0x02, 0x02, 0x32, 0x00,
-    0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x02, 0x1d,
-    0x02, 0xd0, 0x00, 0x03, 0x00, 0x27, 0x00, 0x33,
-    0x01, 0x0f, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x11,
-    0x11, 0x01, 0x05, 0x00, 0x1f, 0x1b, 0x10, 0x03,
-    0x04, 0x05, 0x33, 0x2a, 0x02, 0x09, 0x0a, 0x03,
-    0x4c, 0x4b, 0xb0, 0x0a, 0x50, 0x58, 0x40, 0x40,
-    0x00, 0x04, 0x05, 0x02, 0x05, 0x04, 0x72, 0x00,
-    0x02, 0x03, 0x05, 0x02, 0x03, 0x7e, 0x00, 0x08,
-    0x07, 0x0a, 0x07, 0x08, 0x0a, 0x80, 0x06, 0x01,
-    0x00, 0x00, 0x05, 0x04, 0x00, 0x05, 0x67, 0x00,
-    0x03, 0x00, 0x07, 0x08, 0x03, 0x07, 0x69, 0x00,
-    0x0a, 0x09, 0x01, 0x0a, 0x57, 0x00, 0x09, 0x00,
-    0x0c, 0x01, 0x09, 0x0c, 0x68, 0x00, 0x0a, 0x0a,
-    0x01, 0x5f, 0x0b, 0x01, 0x01, 0x0a, 0x01, 0x4f,
-    0x1b, 0x4b, 0xb0, 0x18, 0x50, 0x58, 0x40, 0x41,
-    0x00, 0x04, 0x05, 0x02, 0x05, 0x04, 0x02, 0x80,
-    0x00, 0x02, 0x03, 0x05, 0x02, 0x03, 0x7e, 0x00,
-    0x08, 0x07, 0x0a, 0x07, 0x08, 0x0a, 0x80, 0x06,
-    0x01, 0x00, 0x00, 0x05, 0x04, 0x00, 0x05, 0x67,
-    0x00, 0x03, 0x00, 0x07, 0x08, 0x03, 0x07, 0x69,
-    0x00, 0x0a, 0x09, 0x01, 0x0a, 0x57, 0x00, 0x09,
-    0x00, 0x0c, 0x01, 0x09, 0x0c, 0x68, 0x00, 0x0a,
-    0x0a, 0x01, 0x5f, 0x0b, 0x01, 0x01, 0x0a, 0x01,
-    0x4f, 0x1b, 0x40, 0x48, 0x00, 0x00, 0x06, 0x05,
-    0x06, 0x00, 0x05, 0x80, 0x00, 0x04, 0x05, 0x02,
-    0x05, 0x04, 0x02, 0x80, 0x00, 0x02, 0x03, 0x05,
-    0x02, 0x03, 0x7e, 0x00, 0x08, 0x07, 0x0a, 0x07,
-    0x08, 0x0a, 0x80, 0x00, 0x06, 0x00, 0x05, 0x04,
-    0x06, 0x05, 0x67, 0x00, 0x03, 0x00, 0x07, 0x08,
-    0x03, 0x07, 0x69, 0x00, 0x0a, 0x09, 0x01, 0x0a,
-    0x57, 0x00, 0x09, 0x00, 0x0c, 0x01, 0x09, 0x0c,
-    0x68, 0x00, 0x0a, 0x0a, 0x01, 0x5f, 0x0b, 0x01,
-    0x01, 0x0a, 0x01, 0x4f, 0x59, 0x59, 0x40, 0x14,
-    0x32, 0x31, 0x30, 0x2f, 0x2e, 0x2d, 0x2c, 0x2b,
-    0x12, 0x2a, 0x11, 0x27, 0x24, 0x22, 0x11, 0x11,
-    0x10, 0x0d, 0x09, 0x1f, 0x2b, 0xb1, 0x06, 0x00,
-    0x44, 0x01, 0x33, 0x01, 0x23, 0x03, 0x33, 0x14,
-    0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x2b,
-    0x01, 0x35, 0x37, 0x35, 0x06, 0x07, 0x0e, 0x01,
-    0x2b, 0x01, 0x35, 0x33, 0x15, 0x07, 0x0e, 0x01,
-    0x07, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x23, 0x22,
-    0x26, 0x05, 0x33, 0x07, 0x15, 0x33, 0x35, 0x33,
-    0x15, 0x23, 0x35, 0x23, 0x35, 0x01, 0xbf, 0x3d,
-    0xfe, 0x9d, 0x3d, 0x57, 0x3c, 0x26, 0x1f, 0x1e,
-    0x24, 0x24, 0x1d, 0x1e, 0x5d, 0x09, 0x0b, 0x0a,
-    0x18, 0x0e, 0x64, 0xd7, 0x39, 0x07, 0x11, 0x08,
-    0x30, 0x38, 0x45, 0x39, 0x3a, 0x47, 0x01, 0xaa,
-    0x45, 0x87, 0x74, 0x3c, 0x3c, 0xb0, 0x02, 0xc6,
-    0xfd, 0x3a, 0x01, 0xef, 0x19, 0x1e, 0x1e, 0x19,
-    0x19, 0x1e, 0x3c, 0x40, 0x07, 0x03, 0x02, 0x02,
-    0x04, 0x32, 0x3c, 0x2c, 0x05, 0x09, 0x03, 0x05,
-    0x37, 0x2c, 0x30, 0x39, 0x39, 0x7a, 0xbd, 0x10,
-    0x59, 0xd1, 0x46, 0x50, 0x00, 0x06, 0x00, 0x1e,
-    0xff, 0xfb, 0x02, 0x53, 0x02, 0xd5, 0x00, 0x21,
-    0x00, 0x2f, 0x00, 0x3d, 0x00, 0x41, 0x00, 0x51,
-    0x00, 0x5f, 0x00, 0x67, 0x40, 0x64, 0x3e, 0x01,
-    0x09, 0x08, 0x3f, 0x01, 0x0a, 0x09, 0x41, 0x01,
-    0x00, 0x0a, 0x40, 0x01, 0x05, 0x00, 0x1a, 0x09,
-    0x02, 0x04, 0x05, 0x05, 0x4c, 0x00, 0x09, 0x0e,
-    0x01, 0x0a, 0x00, 0x09, 0x0a, 0x69, 0x01, 0x01,
-    0x00, 0x07, 0x01, 0x05, 0x04, 0x00, 0x05, 0x69,
-    0x0d, 0x01, 0x08, 0x08, 0x0b, 0x61, 0x00, 0x0b,
-    0x0b, 0x3a, 0x4d, 0x0c, 0x06, 0x02, 0x04, 0x04,
-    0x02, 0x61, 0x03, 0x01, 0x02, 0x02, 0x3b, 0x02,
-    0x4e, 0x53, 0x52, 0x43, 0x42, 0x31, 0x30, 0x5a,
-    0x58, 0x52, 0x5f, 0x53, 0x5f, 0x4a, 0x48, 0x42,
-    0x51, 0x43, 0x51, 0x38, 0x36, 0x30, 0x3d, 0x31,
-    0x3d, 0x25, 0x25, 0x28, 0x25, 0x28, 0x23, 0x0f,
-    0x09, 0x1c, 0x2b, 0x37, 0x35, 0x34, 0x36, 0x33,
-    0x32, 0x16, 0x17, 0x16, 0x17, 0x36, 0x37, 0x3e,
-    0x01, 0x33, 0x32, 0x16, 0x1d, 0x01, 0x14, 0x06,
-    0x23, 0x22, 0x26, 0x27, 0x26, 0x27, 0x06, 0x07,
-    0x0e, 0x01, 0x23, 0x22, 0x26, 0x37, 0x15, 0x14,
-    0x16, 0x33, 0x32, 0x36, 0x3d, 0x01, 0x34, 0x26,
-    0x23, 0x22, 0x06, 0x07, 0x32, 0x36, 0x3d, 0x01,
-    0x34, 0x26, 0x23, 0x22, 0x06, 0x1d, 0x01, 0x14,
-    0x16, 0x01, 0x15, 0x05, 0x35, 0x13, 0x22, 0x06,
-    0x1d, 0x01, 0x14, 0x16, 0x33, 0x32, 0x3e, 0x02,
-    0x3d, 0x01, 0x34, 0x26, 0x07, 0x22, 0x26, 0x3d,
-    0x01, 0x34, 0x36, 0x33, 0x32, 0x16, 0x1d, 0x01,
-    0x14, 0x06, 0xd0, 0x3a, 0x31, 0x1d, 0x21, 0x09,
-    0x0b, 0x04, 0x04, 0x0b, 0x0a, 0x22, 0x1c, 0x31,
-    0x3a, 0x3a, 0x31, 0x1c, 0x22, 0x09, 0x0b, 0x04,
-    0x04, 0x0b, 0x0a, 0x21, 0x1d, 0x31, 0x3a, 0xdd,
-    0x1d, 0x1a, 0x19, 0x1d, 0x1d, 0x19, 0x1a, 0x1d,
-    0x6e, 0x1a, 0x1d, 0x1d, 0x1a, 0x19, 0x1d, 0x1d,
-    0x01, 0x14, 0xfd, 0xe4, 0x79, 0x23, 0x19, 0x19,
-    0x23, 0x13, 0x18, 0x0d, 0x04, 0x19, 0x23, 0x3f,
-    0x39, 0x39, 0x3f, 0x3f, 0x39, 0x39, 0x69, 0x5a,
-    0x35, 0x39, 0x14, 0x0c, 0x0e, 0x12, 0x12, 0x0e,
-    0x0c, 0x14, 0x39, 0x35, 0x5a, 0x35, 0x39, 0x14,
-    0x0c, 0x0e, 0x12, 0x12, 0x0e, 0x0c, 0x14, 0x39,
-    0x8f, 0x5a, 0x1d, 0x1e, 0x1d, 0x1e, 0x5a, 0x1e,
-    0x1d, 0x1e, 0xb2, 0x1e, 0x1d, 0x5a, 0x1d, 0x1e,
-    0x1d, 0x1e, 0x5a, 0x1e, 0x1d, 0x01, 0xc1, 0x37,
-    0xa0, 0x37, 0x01, 0x4f, 0x29, 0x1d, 0x2d, 0x1d,
-    0x29, 0x0c, 0x14, 0x19, 0x0d, 0x2d, 0x1d, 0x29,
-    0xf0, 0x45, 0x38, 0x2d, 0x38, 0x45, 0x45, 0x38,
-    0x2d, 0x38, 0x45, 0x00, 0xff, 0xff, 0x00, 0x64,
-    0xff, 0x92, 0x01, 0xf4, 0x03, 0x3e, 0x10, 0x22,
-    0x00, 0x54, 0x00, 0x00, 0x11, 0x02, 0x00, 0x44,
-    0x00, 0x28, 0x00, 0x24, 0x40, 0x21, 0x00, 0x00,
-    0x02, 0x00, 0x85, 0x00, 0x01, 0x03, 0x01, 0x86,
-    0x00, 0x02, 0x03, 0x03, 0x02, 0x57, 0x00, 0x02,
-    0x02, 0x03, 0x60, 0x00, 0x03, 0x02, 0x03, 0x50,
-    0x11, 0x11, 0x11, 0x11, 0x04, 0x09, 0x25, 0x2b,
-    0xff, 0xff, 0x00, 0x50, 0xff, 0x92, 0x02, 0x08,
-    0x03, 0x3e, 0x10, 0x22, 0x00, 0x54, 0x00, 0x00,
-    0x11, 0x02, 0x00, 0x4c, 0x00, 0x28, 0x00, 0x5d,
-    0x4b, 0xb0, 0x18, 0x50, 0x58, 0x40, 0x1e, 0x00,
-    0x00, 0x04, 0x00, 0x85, 0x00, 0x01, 0x03, 0x01,
-    0x86, 0x00, 0x02, 0x00, 0x03, 0x01, 0x02, 0x03,
-    0x67, 0x06, 0x01, 0x05, 0x05, 0x04, 0x5f, 0x00,
-    0x04, 0x04, 0x3d, 0x05, 0x4e, 0x1b, 0x40, 0x23,
-    0x00, 0x00, 0x04, 0x00, 0x85, 0x00, 0x01, 0x03,
-    0x01, 0x86, 0x00, 0x04, 0x06, 0x01, 0x05, 0x02,
-    0x04, 0x05, 0x68, 0x00, 0x02, 0x03, 0x03, 0x02,
-    0x57, 0x00, 0x02, 0x02, 0x03, 0x5f, 0x00, 0x03,
-    0x02, 0x03, 0x4f, 0x59, 0x40, 0x0e, 0x09, 0x09,
-    0x09, 0x0c, 0x09, 0x0c, 0x12, 0x11, 0x11, 0x11,
-    0x11, 0x07, 0x09, 0x26, 0x2b, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x5d, 0x00, 0x00, 0x02, 0x35,
-    0x02, 0x26, 0x11, 0x02, 0x01, 0xca, 0x00, 0x00,
-    0x00, 0x2d, 0x40, 0x2a, 0x08, 0x01, 0x04, 0x01,
-    0x01, 0x4c, 0x00, 0x01, 0x00, 0x04, 0x03, 0x01,
-    0x04, 0x67, 0x02, 0x01, 0x00, 0x00, 0x3d, 0x4d,
-    0x06, 0x05, 0x02, 0x03, 0x03, 0x3b, 0x03, 0x4e,
-    0x01, 0x01, 0x01, 0x0d, 0x01, 0x0d, 0x11, 0x12,
-    0x11, 0x11, 0x12, 0x07, 0x09, 0x26, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0x5a, 0x00, 0x00, 0x02, 0x21,
-    0x03, 0x16, 0x10, 0x22, 0x00, 0x7a, 0x00, 0x00,
-    0x11, 0x02, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x35,
-    0x40, 0x32, 0x07, 0x01, 0x05, 0x06, 0x05, 0x85,
-    0x00, 0x08, 0x08, 0x06, 0x61, 0x00, 0x06, 0x06,
-    0x3a, 0x4d, 0x00, 0x01, 0x01, 0x02, 0x5f, 0x00,
-    0x02, 0x02, 0x3d, 0x4d, 0x03, 0x01, 0x00, 0x00,
-    0x04, 0x5f, 0x00, 0x04, 0x04, 0x3b, 0x04, 0x4e,
-    0x24, 0x12, 0x22, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x09, 0x09, 0x2a, 0x2b, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x5f, 0x00, 0x00, 0x01, 0xf9,
-    0x03, 0xac, 0x10, 0x22, 0x00, 0x18, 0x00, 0x00,
-    0x11, 0x02, 0x01, 0x39, 0x00, 0x00, 0x00, 0x3f,
-    0x40, 0x3c, 0x08, 0x01, 0x06, 0x07, 0x06, 0x85,
-    0x00, 0x07, 0x00, 0x09, 0x01, 0x07, 0x09, 0x69,
-    0x02, 0x01, 0x00, 0x00, 0x01, 0x5f, 0x00, 0x01,
-    0x01, 0x3a, 0x4d, 0x0a, 0x05, 0x02, 0x03, 0x03,
-    0x04, 0x5f, 0x00, 0x04, 0x04, 0x3b, 0x04, 0x4e,
-    0x01, 0x01, 0x18, 0x16, 0x14, 0x13, 0x11, 0x0f,
-    0x0e, 0x0d, 0x01, 0x0c, 0x01, 0x0c, 0x11, 0x11,
-    0x11, 0x11, 0x12, 0x0b, 0x09, 0x26, 0x2b, 0x00,
-    0x00, 0x01, 0x00, 0xa5, 0x00, 0x00, 0x01, 0xfe,
-    0x02, 0xda, 0x00, 0x0d, 0x00, 0x53, 0x4b, 0xb0,
-    0x17, 0x50, 0x58, 0x40, 0x11, 0x00, 0x00, 0x00,
-    0x02, 0x5f, 0x03, 0x01, 0x02, 0x02, 0x3c, 0x4d,
-    0x00, 0x01, 0x01, 0x3b, 0x01, 0x4e, 0x1b, 0x4b,
-    0xb0, 0x31, 0x50, 0x58, 0x40, 0x11, 0x00, 0x00,
-    0x00, 0x02, 0x5f, 0x03, 0x01, 0x02, 0x02, 0x3a,
-    0x4d, 0x00, 0x01, 0x01, 0x3b, 0x01, 0x4e, 0x1b,
-    0x40, 0x0f, 0x03, 0x01, 0x02, 0x00, 0x00, 0x01,
-    0x02, 0x00, 0x67, 0x00, 0x01, 0x01, 0x3b, 0x01,
-    0x4e, 0x59, 0x59, 0x40, 0x0b, 0x00, 0x00, 0x00,
-    0x0d, 0x00, 0x0c, 0x13, 0x21, 0x04, 0x09, 0x18,
-    0x2b, 0x01, 0x15, 0x23, 0x22, 0x06, 0x15, 0x11,
-    0x23, 0x11, 0x34, 0x3e, 0x02, 0x33, 0x01, 0xfe,
-    0xb0, 0x23, 0x2c, 0x5a, 0x18, 0x2d, 0x3e, 0x26,
-    0x02, 0xda, 0x50, 0x2c, 0x24, 0xfd, 0xc6, 0x02,
-    0x3b, 0x24, 0x3a, 0x2a, 0x17, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x58, 0xff, 0x5b, 0x02, 0x01,
-    0x02, 0x30, 0x00, 0x1e, 0x00, 0x5f, 0xb5, 0x01,
-    0x01, 0x04, 0x03, 0x01, 0x4c, 0x4b, 0xb0, 0x18,
-    0x50, 0x58, 0x40, 0x1c, 0x00, 0x03, 0x03, 0x00,
-    0x61, 0x06, 0x05, 0x02, 0x00, 0x00, 0x45, 0x4d,
-    0x00, 0x04, 0x04, 0x3b, 0x4d, 0x00, 0x02, 0x02,
-    0x01, 0x61, 0x00, 0x01, 0x01, 0x3f, 0x01, 0x4e,
-    0x1b, 0x40, 0x20, 0x06, 0x01, 0x05, 0x05, 0x3d,
-    0x4d, 0x00, 0x03, 0x03, 0x00, 0x61, 0x00, 0x00,
-    0x00, 0x45, 0x4d, 0x00, 0x04, 0x04, 0x3b, 0x4d,
-    0x00, 0x02, 0x02, 0x01, 0x61, 0x00, 0x01, 0x01,
-    0x3f, 0x01, 0x4e, 0x59, 0x40, 0x0e, 0x00, 0x00,
-    0x00, 0x1e, 0x00, 0x1e, 0x13, 0x25, 0x21, 0x27,
-    0x24, 0x07, 0x09, 0x1b, 0x2b, 0x13, 0x15, 0x33,
-    0x3e, 0x01, 0x33, 0x32, 0x16, 0x15, 0x11, 0x14,
-    0x0e, 0x02, 0x2b, 0x01, 0x35, 0x33, 0x32, 0x36,
-    0x35, 0x11, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15,
-    0x11, 0x23, 0x11, 0xad, 0x08, 0x0d, 0x4f, 0x39,
-    0x55, 0x62, 0x1d, 0x36, 0x4b, 0x2f, 0x3f, 0x3f,
-    0x36, 0x3d, 0x41, 0x39, 0x39, 0x42, 0x5a, 0x02,
-    0x26, 0x5f, 0x32, 0x37, 0x66, 0x57, 0xfe, 0xab,
-    0x2c, 0x48, 0x33, 0x1c, 0x52, 0x3c, 0x35, 0x01,
-    0x46, 0x3b, 0x43, 0x41, 0x39, 0xfe, 0x98, 0x02,
-    0x26, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x55,
-    0xff, 0x5b, 0x02, 0x03, 0x02, 0xc6, 0x00, 0x29,
-    0x00, 0x49, 0xb6, 0x1b, 0x07, 0x02, 0x04, 0x00,
-    0x01, 0x4c, 0x4b, 0xb0, 0x31, 0x50, 0x58, 0x40,
-    0x16, 0x01, 0x01, 0x00, 0x00, 0x3a, 0x4d, 0x00,
-    0x04, 0x04, 0x3b, 0x4d, 0x00, 0x03, 0x03, 0x02,
-    0x61, 0x00, 0x02, 0x02, 0x3f, 0x02, 0x4e, 0x1b,
-    0x40, 0x16, 0x01, 0x01, 0x00, 0x00, 0x04, 0x5f,
-    0x00, 0x04, 0x04, 0x3b, 0x4d, 0x00, 0x03, 0x03,
-    0x02, 0x61, 0x00, 0x02, 0x02, 0x3f, 0x02, 0x4e,
-    0x59, 0xb7, 0x1f, 0x21, 0x25, 0x1d, 0x10, 0x05,
-    0x09, 0x1b, 0x2b, 0x13, 0x33, 0x13, 0x1e, 0x01,
-    0x17, 0x16, 0x17, 0x33, 0x30, 0x2e, 0x02, 0x35,
-    0x11, 0x33, 0x11, 0x14, 0x0e, 0x02, 0x2b, 0x01,
-    0x35, 0x33, 0x32, 0x36, 0x35, 0x03, 0x2e, 0x01,
-    0x27, 0x26, 0x27, 0x23, 0x16, 0x17, 0x14, 0x16,
-    0x15, 0x11, 0x23, 0x55, 0x82, 0xb7, 0x07, 0x0b,
-    0x04, 0x06, 0x04, 0x07, 0x02, 0x03, 0x03, 0x56,
-    0x1d, 0x36, 0x4b, 0x2f, 0x46, 0x46, 0x36, 0x3d,
-    0xdb, 0x08, 0x0c, 0x04, 0x04, 0x03, 0x07, 0x01,
-    0x01, 0x01, 0x56, 0x02, 0xc6, 0xfe, 0x55, 0x0f,
-    0x25, 0x11, 0x14, 0x13, 0x18, 0x28, 0x33, 0x1a,
-    0x01, 0x8a, 0xfd, 0x58, 0x2c, 0x48, 0x33, 0x1c,
-    0x52, 0x3c, 0x35, 0x01, 0xe4, 0x12, 0x26, 0x0f,
-    0x12, 0x11, 0x13, 0x16, 0x13, 0x31, 0x1d, 0xfe,
-    0x1e, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfc, 0xc7,
-    0xff, 0x88, 0x00, 0xe1, 0x03, 0x34, 0x00, 0x03,
-    0x00, 0x07, 0x00, 0x0b, 0x00, 0x2d, 0x40, 0x2a,
-    0x04, 0x07, 0x03, 0x06, 0x04, 0x01, 0x00, 0x01,
-    0x85, 0x08, 0x05, 0x02, 0x03, 0x00, 0x00, 0x76,
-    0x08, 0x08, 0x04, 0x04, 0x00, 0x00, 0x08, 0x0b,
-    0x08, 0x0b, 0x0a, 0x09, 0x04, 0x07, 0x04, 0x07,
-    0x06, 0x05, 0x00, 0x03, 0x00, 0x03, 0x11, 0x09,
-    0x06, 0x17, 0x2b, 0x13, 0x11, 0x23, 0x11, 0x21,
-    0x11, 0x23, 0x11, 0x01, 0x11, 0x33, 0x11, 0xe1,
-    0x5a, 0xfe, 0x7a, 0x5a, 0xfe, 0x20, 0x5a, 0x03,
-    0x34, 0xfc, 0x54, 0x03, 0xac, 0xfc, 0x54, 0x03,
-    0xac, 0xfc, 0x54, 0x03, 0xac, 0xfc, 0x54, 0x00,
-    0xff, 0xff, 0xfc, 0x13, 0xff, 0x92, 0x01, 0x95,
-    0x03, 0x3e, 0x10, 0x23, 0x00, 0x47, 0xfb, 0xc8,
-    0x00, 0x00, 0x10, 0x23, 0x00, 0x47, 0xfd, 0xa8,
-    0x00, 0x00, 0x11, 0x02, 0x00, 0x47, 0x88, 0x00,
-    0x00, 0x19, 0x40, 0x16, 0x04, 0x02, 0x02, 0x00,
-    0x01, 0x00, 0x85, 0x05, 0x03, 0x02, 0x01, 0x01,
-    0x76, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x06,
-    0x09, 0x27, 0x2b, 0x00, 0x00, 0x06, 0xfb, 0xd7,
-    0xff, 0xf6, 0x01, 0xd2, 0x02, 0xda, 0x00, 0x09,
-    0x00, 0x13, 0x00, 0x1d, 0x00, 0x3f, 0x00, 0x61,
-    0x00, 0x87, 0x00, 0xaf, 0x40, 0x13, 0x65, 0x43,
-    0x21, 0x03, 0x10, 0x04, 0x81, 0x7e, 0x7b, 0x5b,
-    0x39, 0x1d, 0x13, 0x09, 0x08, 0x00, 0x10, 0x02,
-    0x4c, 0x4b, 0xb0, 0x18, 0x50, 0x58, 0x40, 0x39,
-    0x0e, 0x09, 0x02, 0x04, 0x05, 0x10, 0x05, 0x04,
-    0x10, 0x80, 0x0f, 0x0a, 0x02, 0x05, 0x05, 0x03,
-    0x61, 0x0d, 0x08, 0x02, 0x03, 0x03, 0x42, 0x4d,
-    0x00, 0x10, 0x10, 0x06, 0x61, 0x12, 0x11, 0x0c,
-    0x0b, 0x07, 0x05, 0x06, 0x06, 0x3b, 0x4d, 0x02,
-    0x01, 0x02, 0x00, 0x00, 0x06, 0x61, 0x12, 0x11,
-    0x0c, 0x0b, 0x07, 0x05, 0x06, 0x06, 0x3b, 0x06,
-    0x4e, 0x1b, 0x40, 0x33, 0x0e, 0x09, 0x02, 0x04,
-    0x05, 0x10, 0x05, 0x04, 0x10, 0x80, 0x0f, 0x0a,
-    0x02, 0x05, 0x05, 0x03, 0x61, 0x0d, 0x08, 0x02,
-    0x03, 0x03, 0x42, 0x4d, 0x00, 0x10, 0x10, 0x06,
-    0x5f, 0x11, 0x0b, 0x02, 0x06, 0x06, 0x3b, 0x4d,
-    0x02, 0x01, 0x02, 0x00, 0x00, 0x07, 0x61, 0x12,
-    0x0c, 0x02, 0x07, 0x07, 0x43, 0x07, 0x4e, 0x59,
-    0x40, 0x20, 0x85, 0x83, 0x80, 0x7f, 0x7d, 0x7c,
-    0x76, 0x74, 0x72, 0x71, 0x6f, 0x6d, 0x5f, 0x5d,
-    0x5a, 0x59, 0x54, 0x52, 0x50, 0x4f, 0x2e, 0x23,
-    0x15, 0x22, 0x12, 0x2e, 0x28, 0x28, 0x25, 0x13,
-    0x09, 0x1f, 0x2b, 0x01, 0x06, 0x1d, 0x01, 0x14,
-    0x16, 0x33, 0x32, 0x36, 0x37, 0x25, 0x06, 0x1d,
-    0x01, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x25,
-    0x06, 0x1d, 0x01, 0x14, 0x16, 0x33, 0x32, 0x36,
-    0x37, 0x25, 0x34, 0x36, 0x37, 0x27, 0x2e, 0x01,
-    0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x15,
-    0x23, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14,
-    0x17, 0x01, 0x23, 0x27, 0x0e, 0x01, 0x23, 0x22,
-    0x26, 0x35, 0x25, 0x34, 0x36, 0x37, 0x27, 0x2e,
-    0x01, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x16,
-    0x15, 0x23, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15,
-    0x14, 0x17, 0x01, 0x23, 0x27, 0x0e, 0x01, 0x23,
-    0x22, 0x26, 0x35, 0x25, 0x34, 0x36, 0x37, 0x27,
-    0x2e, 0x01, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32,
-    0x16, 0x15, 0x23, 0x34, 0x26, 0x23, 0x22, 0x06,
-    0x15, 0x14, 0x1f, 0x01, 0x37, 0x33, 0x07, 0x17,
-    0x23, 0x27, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x35,
-    0xfc, 0x67, 0x36, 0x2f, 0x2b, 0x22, 0x3f, 0x16,
-    0x01, 0x63, 0x36, 0x2f, 0x2b, 0x22, 0x3f, 0x16,
-    0x01, 0x63, 0x36, 0x2f, 0x2b, 0x22, 0x3f, 0x16,
-    0xfa, 0xd9, 0x37, 0x33, 0x07, 0x1e, 0x18, 0x19,
-    0x2f, 0x42, 0x2a, 0x59, 0x64, 0x5a, 0x35, 0x2e,
-    0x2a, 0x30, 0x23, 0x01, 0x55, 0x63, 0x40, 0x24,
-    0x58, 0x31, 0x52, 0x5d, 0x01, 0xfe, 0x37, 0x33,
-    0x07, 0x1e, 0x18, 0x19, 0x2f, 0x42, 0x2a, 0x59,
-    0x64, 0x5a, 0x35, 0x2e, 0x2a, 0x30, 0x23, 0x01,
-    0x55, 0x63, 0x40, 0x24, 0x58, 0x31, 0x52, 0x5d,
-    0x01, 0xfe, 0x37, 0x33, 0x07, 0x1e, 0x18, 0x19,
-    0x2f, 0x42, 0x2a, 0x59, 0x64, 0x5a, 0x35, 0x2e,
-    0x2a, 0x30, 0x23, 0xac, 0x47, 0x5e, 0x71, 0x75,
-    0x63, 0x40, 0x24, 0x58, 0x31, 0x52, 0x5d, 0x01,
-    0x6d, 0x11, 0x44, 0x7d, 0x29, 0x2c, 0x2d, 0x27,
-    0xd3, 0x11, 0x44, 0x7d, 0x29, 0x2c, 0x2d, 0x27,
-    0xd3, 0x11, 0x44, 0x7d, 0x29, 0x2c, 0x2d, 0x27,
-    0x7e, 0x35, 0x45, 0x0e, 0x0a, 0x2a, 0x41, 0x20,
-    0x24, 0x3d, 0x2c, 0x18, 0x5d, 0x4e, 0x29, 0x34,
-    0x33, 0x26, 0x2c, 0x31, 0xfe, 0x2a, 0x57, 0x30,
-    0x31, 0x57, 0x4e, 0x7d, 0x35, 0x45, 0x0e, 0x0a,
-    0x2a, 0x41, 0x20, 0x24, 0x3d, 0x2c, 0x18, 0x5d,
-    0x4e, 0x29, 0x34, 0x33, 0x26, 0x2c, 0x31, 0xfe,
-    0x2a, 0x57, 0x30, 0x31, 0x57, 0x4e, 0x7d, 0x35,
-    0x45, 0x0e, 0x0a, 0x2a, 0x41, 0x20, 0x24, 0x3d,
-    0x2c, 0x18, 0x5d, 0x4e, 0x29, 0x34, 0x33, 0x26,
-    0x2c, 0x31, 0xed, 0x7f, 0xc7, 0xa1, 0x57, 0x30,
-    0x31, 0x57, 0x4e, 0x00, 0x00, 0x03, 0xfb, 0xa0,
-    0x00, 0x6e, 0x02, 0x08, 0x02, 0x26, 0x00, 0x03,
-    0x00, 0x07, 0x00, 0x0b, 0x00, 0x30, 0x40, 0x2d,
-    0x00, 0x04, 0x00, 0x05, 0x01, 0x04, 0x05, 0x67,
-    0x06, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x63,
-    0x00, 0x03, 0x03, 0x02, 0x5f, 0x00, 0x02, 0x02,
-    0x3d, 0x03, 0x4e, 0x00, 0x00, 0x0b, 0x0a, 0x09,
-    0x08, 0x07, 0x06, 0x05, 0x04, 0x00, 0x03, 0x00,
-    0x03, 0x11, 0x07, 0x09, 0x17, 0x2b, 0x25, 0x15,
-    0x21, 0x35, 0x11, 0x21, 0x15, 0x21, 0x15, 0x21,
-    0x15, 0x21, 0x02, 0x08, 0xf9, 0x98, 0x06, 0x68,
-    0xf9, 0x98, 0x06, 0x68, 0xf9, 0x98, 0xb4, 0x46,
-    0x46, 0x01, 0x72, 0x46, 0x73, 0x46, 0x00, 0x00,
-    0x00, 0x01, 0xfe, 0x20, 0x00, 0x5f, 0x01, 0xe0,
-    0x02, 0x35, 0x00, 0x13, 0x00, 0x5a, 0x4b, 0xb0,
-    0x21, 0x50, 0x58, 0x40, 0x1a, 0x04, 0x02, 0x02,
-    0x00, 0x0a, 0x09, 0x07, 0x03, 0x05, 0x06, 0x00,
-    0x05, 0x67, 0x08, 0x01, 0x06, 0x06, 0x01, 0x5f,
-    0x03, 0x01, 0x01, 0x01, 0x3d, 0x06, 0x4e, 0x1b,
-    0x40, 0x20, 0x03, 0x01, 0x01, 0x00, 0x06, 0x01,
-    0x57, 0x04, 0x02, 0x02, 0x00, 0x0a, 0x09, 0x07,
-    0x03, 0x05, 0x06, 0x00, 0x05, 0x67, 0x03, 0x01,
-    0x01, 0x01, 0x06, 0x5f, 0x08, 0x01, 0x06, 0x01,
-    0x06, 0x4f, 0x59, 0x40, 0x12, 0x00, 0x00, 0x00,
-    0x13, 0x00, 0x13, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x0b, 0x09, 0x1f, 0x2b,
-    0x01, 0x35, 0x33, 0x35, 0x33, 0x15, 0x21, 0x35,
-    0x33, 0x15, 0x33, 0x15, 0x23, 0x15, 0x23, 0x35,
-    0x21, 0x15, 0x23, 0x35, 0xfe, 0x20, 0xbf, 0x58,
-    0x01, 0x92, 0x58, 0xbf, 0xbf, 0x58, 0xfe, 0x6e,
-    0x58, 0x01, 0x22, 0x50, 0xc3, 0xc3, 0xc3, 0xc3,
-    0x50, 0xc3, 0xc3, 0xc3, 0xc3, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xfe, 0x0c, 0x01, 0x22, 0x01, 0xf4,
-    0x01, 0x72, 0x00, 0x03, 0x00, 0x07, 0x00, 0x24,
-    0x40, 0x21, 0x04, 0x03, 0x02, 0x00, 0x01, 0x01,
-    0x00, 0x57, 0x04, 0x03, 0x02, 0x00, 0x00, 0x01,
-    0x5f, 0x02, 0x01, 0x01, 0x00, 0x01, 0x4f, 0x04,
-    0x04, 0x04, 0x07, 0x04, 0x07, 0x12, 0x11, 0x10,
-    0x05, 0x09, 0x19, 0x2b, 0x13, 0x21, 0x15, 0x21,
-    0x27, 0x15, 0x21, 0x35, 0x2d, 0x01, 0xc7, 0xfe,
-    0x39, 0x5a, 0xfe, 0x39, 0x01, 0x72, 0x50, 0x50,
-    0x50, 0x50, 0x00, 0x00, 0x00, 0x01, 0xfd, 0xf8,
-    0x00, 0x23, 0x02, 0x1c, 0x02, 0x71, 0x00, 0x1e,
-    0x00, 0x6d, 0xb6, 0x13, 0x03, 0x02, 0x03, 0x04,
-    0x01, 0x4c, 0x4b, 0xb0, 0x0a, 0x50, 0x58, 0x40,
-    0x25, 0x00, 0x00, 0x05, 0x05, 0x00, 0x70, 0x00,
-    0x01, 0x02, 0x02, 0x01, 0x71, 0x06, 0x01, 0x05,
-    0x00, 0x04, 0x03, 0x05, 0x04, 0x68, 0x00, 0x03,
-    0x02, 0x02, 0x03, 0x57, 0x00, 0x03, 0x03, 0x02,
-    0x5f, 0x00, 0x02, 0x03, 0x02, 0x4f, 0x1b, 0x40,
-    0x23, 0x00, 0x00, 0x05, 0x00, 0x85, 0x00, 0x01,
-    0x02, 0x01, 0x86, 0x06, 0x01, 0x05, 0x00, 0x04,
-    0x03, 0x05, 0x04, 0x68, 0x00, 0x03, 0x02, 0x02,
-    0x03, 0x57, 0x00, 0x03, 0x03, 0x02, 0x5f, 0x00,
-    0x02, 0x03, 0x02, 0x4f, 0x59, 0x40, 0x0f, 0x00,
-    0x00, 0x00, 0x1e, 0x00, 0x1e, 0x1d, 0x1c, 0x11,
-    0x11, 0x12, 0x11, 0x07, 0x09, 0x1a, 0x2b, 0x01,
-    0x27, 0x33, 0x13, 0x03, 0x23, 0x37, 0x21, 0x35,
-    0x21, 0x37, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x37,
-    0x36, 0x37, 0x35, 0x26, 0x27, 0x2e, 0x01, 0x27,
-    0x2e, 0x01, 0x2f, 0x01, 0x21, 0x35, 0x01, 0x36,
-    0x6b, 0x6a, 0xe7, 0xe8, 0x69, 0x6b, 0xfc, 0xc2,
-    0x03, 0x7e, 0x13, 0x02, 0x03, 0x02, 0x0b, 0x12,
-    0x05, 0x07, 0x05, 0x05, 0x06, 0x06, 0x11, 0x0c,
-    0x02, 0x06, 0x03, 0x10, 0xfc, 0x83, 0x01, 0xea,
-    0x87, 0xfe, 0xd9, 0xfe, 0xd9, 0x87, 0x50, 0x18,
-    0x02, 0x04, 0x02, 0x0e, 0x12, 0x05, 0x06, 0x03,
-    0x03, 0x03, 0x07, 0x05, 0x11, 0x0e, 0x03, 0x06,
-    0x04, 0x14, 0x50, 0x00, 0xff, 0xff, 0x00, 0x5a,
-    0x00, 0x00, 0x01, 0xfe, 0x02, 0xd0, 0x11, 0x02,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x27, 0x40, 0x24,
-    0x00, 0x00, 0x00, 0x03, 0x02, 0x00, 0x03, 0x67,
-    0x06, 0x05, 0x02, 0x01, 0x01, 0x1a, 0x4d, 0x04,
-    0x01, 0x02, 0x02, 0x1b, 0x02, 0x4e, 0x01, 0x01,
-    0x01, 0x0c, 0x01, 0x0c, 0x11, 0x11, 0x11, 0x11,
-    0x12, 0x07, 0x07, 0x26, 0x2b, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x50, 0xff, 0xf6, 0x02, 0x08,
-    0x02, 0xda, 0x11, 0x02, 0x00, 0x0b, 0x00, 0x00,
-    0x00, 0x1f, 0x40, 0x1c, 0x00, 0x01, 0x01, 0x02,
-    0x61, 0x00, 0x02, 0x02, 0x21, 0x4d, 0x00, 0x00,
-    0x00, 0x03, 0x61, 0x00, 0x03, 0x03, 0x22, 0x03,
-    0x4e, 0x29, 0x27, 0x25, 0x23, 0x04, 0x07, 0x25,
-    0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x2c,
-    0x00, 0x00, 0x02, 0x2c, 0x02, 0xd0, 0x11, 0x02,
-    0x00, 0x11, 0x00, 0x00, 0x00, 0x25, 0x40, 0x22,
-    0x10, 0x01, 0x04, 0x00, 0x01, 0x4c, 0x00, 0x04,
-    0x00, 0x02, 0x01, 0x04, 0x02, 0x68, 0x00, 0x00,
-    0x00, 0x1a, 0x4d, 0x03, 0x01, 0x01, 0x01, 0x1b,
-    0x01, 0x4e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x05,
-    0x07, 0x26, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x5a,
-    0x00, 0x00, 0x02, 0x14, 0x02, 0xd0, 0x11, 0x02,
-    0x00, 0x12, 0x00, 0x00, 0x00, 0x3f, 0x40, 0x3c,
-    0x07, 0x01, 0x03, 0x04, 0x01, 0x4c, 0x00, 0x04,
-    0x00, 0x03, 0x02, 0x04, 0x03, 0x67, 0x07, 0x01,
-    0x05, 0x05, 0x00, 0x5f, 0x06, 0x01, 0x00, 0x00,
-    0x1a, 0x4d, 0x00, 0x02, 0x02, 0x01, 0x5f, 0x00,
-    0x01, 0x01, 0x1b, 0x01, 0x4e, 0x1c, 0x1c, 0x02,
-    0x01, 0x1c, 0x24, 0x1c, 0x23, 0x1f, 0x1d, 0x1b,
-    0x19, 0x15, 0x13, 0x11, 0x0f, 0x01, 0x12, 0x02,
-    0x12, 0x08, 0x07, 0x21, 0x2b, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x5a, 0x00, 0x00, 0x02, 0x26,
-    0x02, 0xd0, 0x11, 0x02, 0x00, 0x1e, 0x00, 0x00,
-    0x00, 0x32, 0x40, 0x2f, 0x00, 0x03, 0x00, 0x01,
-    0x02, 0x03, 0x01, 0x67, 0x06, 0x01, 0x04, 0x04,
-    0x00, 0x5f, 0x05, 0x01, 0x00, 0x00, 0x1a, 0x4d,
-    0x00, 0x02, 0x02, 0x1b, 0x02, 0x4e, 0x10, 0x10,
-    0x02, 0x01, 0x10, 0x18, 0x10, 0x17, 0x13, 0x11,
-    0x0e, 0x0d, 0x0c, 0x0a, 0x01, 0x0f, 0x02, 0x0f,
-    0x07, 0x07, 0x21, 0x2b, 0xff, 0xff, 0x00, 0x56,
-    0xff, 0xf6, 0x02, 0x0e, 0x02, 0xda, 0x11, 0x02,
-    0x00, 0x13, 0x00, 0x00, 0x00, 0x3b, 0x40, 0x38,
-    0x00, 0x01, 0x02, 0x04, 0x02, 0x01, 0x04, 0x80,
-    0x00, 0x04, 0x03, 0x02, 0x04, 0x03, 0x7e, 0x00,
-    0x02, 0x02, 0x00, 0x61, 0x06, 0x01, 0x00, 0x00,
-    0x21, 0x4d, 0x00, 0x03, 0x03, 0x05, 0x61, 0x00,
-    0x05, 0x05, 0x22, 0x05, 0x4e, 0x02, 0x01, 0x17,
-    0x15, 0x13, 0x12, 0x10, 0x0e, 0x09, 0x07, 0x05,
-    0x04, 0x01, 0x20, 0x02, 0x20, 0x07, 0x07, 0x21,
-    0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x5f,
-    0x00, 0x00, 0x02, 0x08, 0x02, 0xd0, 0x11, 0x02,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x2f, 0x40, 0x2c,
-    0x00, 0x02, 0x00, 0x03, 0x04, 0x02, 0x03, 0x67,
-    0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00,
-    0x1a, 0x4d, 0x00, 0x04, 0x04, 0x05, 0x5f, 0x06,
-    0x01, 0x05, 0x05, 0x1b, 0x05, 0x4e, 0x01, 0x01,
-    0x01, 0x0c, 0x01, 0x0c, 0x11, 0x11, 0x11, 0x11,
-    0x12, 0x07, 0x07, 0x26, 0x2b, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x5a, 0x00, 0x00, 0x02, 0x3f,
-    0x02, 0xd0, 0x11, 0x02, 0x00, 0x1a, 0x00, 0x00,
-    0x00, 0x27, 0x40, 0x24, 0x07, 0x01, 0x04, 0x01,
-    0x01, 0x4c, 0x00, 0x01, 0x00, 0x04, 0x03, 0x01,
-    0x04, 0x67, 0x02, 0x01, 0x00, 0x00, 0x1a, 0x4d,
-    0x05, 0x01, 0x03, 0x03, 0x1b, 0x03, 0x4e, 0x11,
-    0x11, 0x12, 0x11, 0x11, 0x11, 0x06, 0x07, 0x27,
-    0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x4b,
-    0x00, 0x00, 0x02, 0x0d, 0x02, 0xd0, 0x11, 0x02,
-    0x00, 0x1c, 0x00, 0x00, 0x00, 0x2f, 0x40, 0x2c,
-    0x27, 0x19, 0x17, 0x09, 0x04, 0x03, 0x00, 0x01,
-    0x4c, 0x00, 0x03, 0x00, 0x02, 0x00, 0x03, 0x02,
-    0x80, 0x01, 0x01, 0x00, 0x00, 0x1a, 0x4d, 0x05,
-    0x04, 0x02, 0x02, 0x02, 0x1b, 0x02, 0x4e, 0x01,
-    0x01, 0x01, 0x2e, 0x01, 0x2e, 0x1d, 0x11, 0x1d,
-    0x12, 0x06, 0x07, 0x25, 0x2b, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x28, 0x00, 0x00, 0x02, 0x30,
-    0x02, 0xd0, 0x11, 0x02, 0x00, 0x26, 0x00, 0x00,
-    0x00, 0x1f, 0x40, 0x1c, 0x15, 0x0f, 0x08, 0x03,
-    0x02, 0x00, 0x01, 0x4c, 0x01, 0x01, 0x00, 0x00,
-    0x1a, 0x4d, 0x03, 0x01, 0x02, 0x02, 0x1b, 0x02,
-    0x4e, 0x1b, 0x12, 0x1a, 0x12, 0x04, 0x07, 0x25,
-    0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x3f,
-    0xff, 0xf6, 0x02, 0x00, 0x02, 0x30, 0x11, 0x02,
-    0x00, 0x2a, 0x00, 0x00, 0x00, 0x78, 0xb5, 0x18,
-    0x01, 0x06, 0x07, 0x01, 0x4c, 0x4b, 0xb0, 0x18,
-    0x50, 0x58, 0x40, 0x27, 0x00, 0x02, 0x01, 0x00,
-    0x01, 0x02, 0x00, 0x80, 0x00, 0x00, 0x00, 0x07,
-    0x06, 0x00, 0x07, 0x67, 0x00, 0x01, 0x01, 0x03,
-    0x61, 0x00, 0x03, 0x03, 0x23, 0x4d, 0x08, 0x01,
-    0x06, 0x06, 0x04, 0x61, 0x05, 0x01, 0x04, 0x04,
-    0x1b, 0x04, 0x4e, 0x1b, 0x40, 0x2b, 0x00, 0x02,
-    0x01, 0x00, 0x01, 0x02, 0x00, 0x80, 0x00, 0x00,
-    0x00, 0x07, 0x06, 0x00, 0x07, 0x67, 0x00, 0x01,
-    0x01, 0x03, 0x61, 0x00, 0x03, 0x03, 0x23, 0x4d,
-    0x00, 0x04, 0x04, 0x1b, 0x4d, 0x08, 0x01, 0x06,
-    0x06, 0x05, 0x61, 0x00, 0x05, 0x05, 0x22, 0x05,
-    0x4e, 0x59, 0x40, 0x11, 0x20, 0x1f, 0x27, 0x25,
-    0x1f, 0x2b, 0x20, 0x2b, 0x24, 0x13, 0x22, 0x12,
-    0x23, 0x25, 0x09, 0x07, 0x27, 0x2b, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x50, 0xff, 0xf6, 0x02, 0x08,
-    0x02, 0x30, 0x11, 0x02, 0x00, 0x2d, 0x00, 0x00,
-    0x00, 0x43, 0x40, 0x40, 0x00, 0x04, 0x02, 0x03,
-    0x02, 0x04, 0x03, 0x80, 0x08, 0x01, 0x06, 0x00,
-    0x02, 0x04, 0x06, 0x02, 0x67, 0x00, 0x05, 0x05,
-    0x01, 0x61, 0x00, 0x01, 0x01, 0x23, 0x4d, 0x00,
-    0x03, 0x03, 0x00, 0x61, 0x07, 0x01, 0x00, 0x00,
-    0x22, 0x00, 0x4e, 0x18, 0x18, 0x02, 0x01, 0x18,
-    0x20, 0x18, 0x20, 0x1d, 0x1b, 0x15, 0x14, 0x12,
-    0x10, 0x0d, 0x0c, 0x09, 0x07, 0x01, 0x17, 0x02,
-    0x17, 0x09, 0x07, 0x21, 0x2b, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x50, 0xff, 0xf6, 0x02, 0x08,
-    0x02, 0x30, 0x11, 0x02, 0x00, 0x08, 0x00, 0x00,
-    0x00, 0x1f, 0x40, 0x1c, 0x00, 0x01, 0x01, 0x02,
-    0x61, 0x00, 0x02, 0x02, 0x23, 0x4d, 0x00, 0x00,
-    0x00, 0x03, 0x61, 0x00, 0x03, 0x03, 0x22, 0x03,
-    0x4e, 0x27, 0x27, 0x25, 0x23, 0x04, 0x07, 0x25,
-    0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x56,
-    0xff, 0xf6, 0x02, 0x0e, 0x02, 0x30, 0x11, 0x02,
-    0x00, 0x2c, 0xfe, 0x00, 0x00, 0x3b, 0x40, 0x38,
-    0x00, 0x02, 0x03, 0x05, 0x03, 0x02, 0x05, 0x80,
-    0x00, 0x05, 0x04, 0x03, 0x05, 0x04, 0x7e, 0x00,
-    0x03, 0x03, 0x01, 0x61, 0x00, 0x01, 0x01, 0x23,
-    0x4d, 0x00, 0x04, 0x04, 0x00, 0x61, 0x06, 0x01,
-    0x00, 0x00, 0x22, 0x00, 0x4e, 0x02, 0x01, 0x1e,
-    0x1d, 0x1b, 0x19, 0x14, 0x12, 0x10, 0x0f, 0x0d,
-    0x0b, 0x01, 0x20, 0x02, 0x20, 0x07, 0x07, 0x21,
-    0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x32,
-    0xff, 0x5b, 0x02, 0x26, 0x02, 0x26, 0x11, 0x02,
-    0x00, 0x37, 0x00, 0x00, 0x00, 0x22, 0x40, 0x1f,
-    0x12, 0x07, 0x02, 0x01, 0x00, 0x01, 0x4c, 0x03,
-    0x02, 0x02, 0x00, 0x00, 0x1c, 0x4d, 0x00, 0x01,
-    0x01, 0x1e, 0x01, 0x4e, 0x01, 0x01, 0x01, 0x13,
-    0x01, 0x13, 0x11, 0x1e, 0x04, 0x07, 0x23, 0x2b,
-    0xff, 0xff, 0x00, 0x30, 0x00, 0x00, 0x02, 0x28,
-    0x02, 0x26, 0x11, 0x02, 0x00, 0x36, 0x00, 0x00,
-    0x00, 0x26, 0x40, 0x23, 0x1c, 0x13, 0x0b, 0x02,
-    0x04, 0x02, 0x00, 0x01, 0x4c, 0x01, 0x01, 0x00,
-    0x00, 0x1c, 0x4d, 0x04, 0x03, 0x02, 0x02, 0x02,
-    0x1b, 0x02, 0x4e, 0x01, 0x01, 0x01, 0x22, 0x01,
-    0x22, 0x12, 0x1d, 0x13, 0x05, 0x07, 0x24, 0x2b,
-    0xff, 0xff, 0x00, 0x58, 0xff, 0x5b, 0x02, 0x08,
-    0x02, 0x30, 0x11, 0x02, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x67, 0x40, 0x0b, 0x14, 0x02, 0x02, 0x04,
-    0x05, 0x17, 0x01, 0x01, 0x04, 0x02, 0x4c, 0x4b,
-    0xb0, 0x18, 0x50, 0x58, 0x40, 0x1c, 0x00, 0x05,
-    0x05, 0x00, 0x61, 0x06, 0x03, 0x02, 0x00, 0x00,
-    0x23, 0x4d, 0x00, 0x04, 0x04, 0x01, 0x61, 0x00,
-    0x01, 0x01, 0x22, 0x4d, 0x00, 0x02, 0x02, 0x1e,
-    0x02, 0x4e, 0x1b, 0x40, 0x20, 0x06, 0x01, 0x03,
-    0x03, 0x1c, 0x4d, 0x00, 0x05, 0x05, 0x00, 0x61,
-    0x00, 0x00, 0x00, 0x23, 0x4d, 0x00, 0x04, 0x04,
-    0x01, 0x61, 0x00, 0x01, 0x01, 0x22, 0x4d, 0x00,
-    0x02, 0x02, 0x1e, 0x02, 0x4e, 0x59, 0x40, 0x10,
-    0x01, 0x01, 0x29, 0x27, 0x22, 0x20, 0x01, 0x1d,
-    0x01, 0x1d, 0x19, 0x29, 0x25, 0x07, 0x07, 0x24,
-    0x2b, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x5a,
-    0x00, 0x00, 0x01, 0xfe, 0x02, 0xd0, 0x00, 0x07,
-    0x00, 0x21, 0x40, 0x1e, 0x00, 0x02, 0x02, 0x00,
-    0x5f, 0x00, 0x00, 0x00, 0x1a, 0x4d, 0x04, 0x03,
-    0x02, 0x01, 0x01, 0x1b, 0x01, 0x4e, 0x00, 0x00,
-    0x00, 0x07, 0x00, 0x07, 0x11, 0x11, 0x11, 0x05,
-    0x07, 0x19, 0x2b, 0x33, 0x11, 0x21, 0x11, 0x23,
-    0x11, 0x23, 0x11, 0x5a, 0x01, 0xa4, 0x5a, 0xf0,
-    0x02, 0xd0, 0xfd, 0x30, 0x02, 0x7e, 0xfd, 0x82,
-    0x00, 0x02, 0x00, 0x5a, 0x00, 0x00, 0x02, 0x17,
-    0x02, 0xd0, 0x00, 0x10, 0x00, 0x19, 0x00, 0x30,
-    0x40, 0x2d, 0x00, 0x02, 0x00, 0x05, 0x04, 0x02,
-    0x05, 0x67, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00,
-    0x00, 0x00, 0x1a, 0x4d, 0x06, 0x01, 0x04, 0x04,
-    0x03, 0x5f, 0x00, 0x03, 0x03, 0x1b, 0x03, 0x4e,
-    0x12, 0x11, 0x18, 0x16, 0x11, 0x19, 0x12, 0x19,
-    0x28, 0x21, 0x11, 0x10, 0x07, 0x07, 0x1a, 0x2b,
-    0x13, 0x21, 0x15, 0x21, 0x15, 0x33, 0x32, 0x1e,
-    0x02, 0x15, 0x14, 0x0e, 0x02, 0x2b, 0x01, 0x37,
-    0x32, 0x36, 0x35, 0x34, 0x26, 0x2b, 0x01, 0x11,
-    0x5a, 0x01, 0x9f, 0xfe, 0xbb, 0x87, 0x32, 0x51,
-    0x39, 0x20, 0x20, 0x39, 0x51, 0x32, 0xe1, 0xdc,
-    0x3b, 0x49, 0x48, 0x3c, 0x82, 0x02, 0xd0, 0x52,
-    0xd2, 0x1f, 0x38, 0x4f, 0x30, 0x30, 0x4f, 0x38,
-    0x1f, 0x52, 0x49, 0x3b, 0x3c, 0x48, 0xfe, 0xf8,
-    0x00, 0x01, 0x00, 0x55, 0x00, 0x00, 0x02, 0x03,
-    0x02, 0xd0, 0x00, 0x1f, 0x00, 0x1d, 0x40, 0x1a,
-    0x15, 0x01, 0x02, 0x00, 0x01, 0x4c, 0x01, 0x01,
-    0x00, 0x00, 0x1a, 0x4d, 0x03, 0x01, 0x02, 0x02,
-    0x1b, 0x02, 0x4e, 0x1d, 0x11, 0x1d, 0x10, 0x04,
-    0x07, 0x1a, 0x2b, 0x13, 0x33, 0x11, 0x14, 0x0e,
-    0x02, 0x31, 0x33, 0x36, 0x37, 0x3e, 0x01, 0x37,
-    0x13, 0x33, 0x11, 0x23, 0x11, 0x34, 0x36, 0x37,
-    0x36, 0x37, 0x23, 0x06, 0x07, 0x0e, 0x01, 0x07,
-    0x03, 0x23, 0x55, 0x56, 0x03, 0x04, 0x02, 0x07,
-    0x07, 0x07, 0x06, 0x0f, 0x07, 0xbd, 0x73, 0x56,
-    0x02, 0x02, 0x01, 0x02, 0x07, 0x06, 0x07, 0x06,
-    0x0f, 0x09, 0xba, 0x73, 0x02, 0xd0, 0xfe, 0x16,
-    0x1a, 0x2f, 0x24, 0x15, 0x1a, 0x19, 0x15, 0x2f,
-    0x12, 0x01, 0xe3, 0xfd, 0x30, 0x01, 0xec, 0x1d,
-    0x2f, 0x11, 0x14, 0x10, 0x17, 0x17, 0x14, 0x30,
-    0x17, 0xfe, 0x1c, 0x00, 0xff, 0xff, 0x00, 0x2d,
-    0x00, 0x00, 0x02, 0x2b, 0x02, 0xd0, 0x11, 0x02,
-    0x00, 0x22, 0x00, 0x00, 0x00, 0x1b, 0x40, 0x18,
-    0x03, 0x01, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00,
-    0x00, 0x1a, 0x4d, 0x00, 0x02, 0x02, 0x1b, 0x02,
-    0x4e, 0x11, 0x11, 0x11, 0x11, 0x04, 0x07, 0x25,
-    0x2b, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x69,
-    0x00, 0x00, 0x02, 0x17, 0x02, 0xd0, 0x00, 0x05,
-    0x00, 0x1f, 0x40, 0x1c, 0x00, 0x00, 0x00, 0x02,
-    0x5f, 0x03, 0x01, 0x02, 0x02, 0x1a, 0x4d, 0x00,
-    0x01, 0x01, 0x1b, 0x01, 0x4e, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x05, 0x11, 0x11, 0x04, 0x07, 0x18,
-    0x2b, 0x01, 0x15, 0x21, 0x11, 0x23, 0x11, 0x02,
-    0x17, 0xfe, 0xac, 0x5a, 0x02, 0xd0, 0x52, 0xfd,
-    0x82, 0x02, 0xd0, 0x00, 0x00, 0x01, 0x00, 0x05,
-    0x00, 0x00, 0x02, 0x53, 0x02, 0xd0, 0x00, 0x15,
-    0x00, 0x36, 0x40, 0x33, 0x0c, 0x01, 0x02, 0x06,
-    0x01, 0x01, 0x4c, 0x03, 0x01, 0x01, 0x08, 0x01,
-    0x06, 0x05, 0x01, 0x06, 0x67, 0x04, 0x02, 0x02,
-    0x00, 0x00, 0x1a, 0x4d, 0x0a, 0x09, 0x07, 0x03,
-    0x05, 0x05, 0x1b, 0x05, 0x4e, 0x00, 0x00, 0x00,
-    0x15, 0x00, 0x15, 0x11, 0x11, 0x11, 0x12, 0x11,
-    0x11, 0x11, 0x11, 0x12, 0x0b, 0x07, 0x1f, 0x2b,
-    0x33, 0x13, 0x03, 0x33, 0x13, 0x33, 0x11, 0x33,
-    0x11, 0x33, 0x13, 0x33, 0x03, 0x13, 0x23, 0x03,
-    0x23, 0x11, 0x23, 0x11, 0x23, 0x03, 0x05, 0x84,
-    0x7a, 0x5e, 0x69, 0x2e, 0x50, 0x2f, 0x68, 0x5e,
-    0x78, 0x82, 0x5d, 0x71, 0x31, 0x50, 0x31, 0x72,
-    0x01, 0x78, 0x01, 0x58, 0xfe, 0xc7, 0x01, 0x39,
-    0xfe, 0xc7, 0x01, 0x39, 0xfe, 0xa7, 0xfe, 0x89,
-    0x01, 0x55, 0xfe, 0xab, 0x01, 0x55, 0xfe, 0xab,
-    0x00, 0x01, 0x00, 0x5a, 0xff, 0x74, 0x02, 0x3f,
-    0x02, 0xd0, 0x00, 0x0b, 0x00, 0x29, 0x40, 0x26,
-    0x00, 0x03, 0x00, 0x03, 0x54, 0x06, 0x05, 0x02,
-    0x01, 0x01, 0x1a, 0x4d, 0x02, 0x01, 0x00, 0x00,
-    0x04, 0x60, 0x00, 0x04, 0x04, 0x1b, 0x04, 0x4e,
-    0x00, 0x00, 0x00, 0x0b, 0x00, 0x0b, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x07, 0x07, 0x1b, 0x2b, 0x13,
-    0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x15, 0x23,
-    0x35, 0x21, 0x11, 0xb4, 0xe6, 0x5a, 0x4b, 0x50,
-    0xfe, 0x6b, 0x02, 0xd0, 0xfd, 0x80, 0x02, 0x80,
-    0xfd, 0x80, 0xdc, 0x8c, 0x02, 0xd0, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x35, 0xff, 0x74, 0x02, 0x3f,
-    0x02, 0xd0, 0x00, 0x0f, 0x00, 0x2d, 0x40, 0x2a,
-    0x00, 0x05, 0x00, 0x05, 0x54, 0x08, 0x07, 0x03,
-    0x03, 0x01, 0x01, 0x1a, 0x4d, 0x04, 0x02, 0x02,
-    0x00, 0x00, 0x06, 0x60, 0x00, 0x06, 0x06, 0x1b,
-    0x06, 0x4e, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x0f,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x09,
-    0x07, 0x1d, 0x2b, 0x13, 0x11, 0x33, 0x11, 0x33,
-    0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x15, 0x23,
-    0x35, 0x21, 0x11, 0x8f, 0x6b, 0x5a, 0x6b, 0x5a,
-    0x26, 0x50, 0xfe, 0x46, 0x02, 0xd0, 0xfd, 0x7e,
-    0x02, 0x82, 0xfd, 0x7e, 0x02, 0x82, 0xfd, 0x7e,
-    0xda, 0x8c, 0x02, 0xd0, 0x00, 0x01, 0x00, 0x3e,
-    0x00, 0x00, 0x02, 0x1a, 0x02, 0xd0, 0x00, 0x0b,
-    0x00, 0x25, 0x40, 0x22, 0x06, 0x05, 0x03, 0x03,
-    0x01, 0x01, 0x1a, 0x4d, 0x02, 0x01, 0x00, 0x00,
-    0x04, 0x60, 0x00, 0x04, 0x04, 0x1b, 0x04, 0x4e,
-    0x00, 0x00, 0x00, 0x0b, 0x00, 0x0b, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x07, 0x07, 0x1b, 0x2b, 0x13,
-    0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33,
-    0x11, 0x21, 0x03, 0x8e, 0x78, 0x4e, 0x78, 0x4e,
-    0xfe, 0x26, 0x02, 0x02, 0xd0, 0xfd, 0x76, 0x02,
-    0x8a, 0xfd, 0x76, 0x02, 0x8a, 0xfd, 0x30, 0x02,
-    0xd0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x35,
-    0xff, 0xf6, 0x02, 0x14, 0x02, 0xda, 0x00, 0x31,
-    0x00, 0x47, 0x40, 0x44, 0x0d, 0x01, 0x04, 0x05,
-    0x01, 0x4c, 0x08, 0x01, 0x07, 0x06, 0x05, 0x06,
-    0x07, 0x05, 0x80, 0x00, 0x02, 0x04, 0x03, 0x04,
-    0x02, 0x03, 0x80, 0x00, 0x05, 0x00, 0x04, 0x02,
-    0x05, 0x04, 0x67, 0x00, 0x06, 0x06, 0x00, 0x61,
-    0x00, 0x00, 0x00, 0x21, 0x4d, 0x00, 0x03, 0x03,
-    0x01, 0x61, 0x00, 0x01, 0x01, 0x22, 0x01, 0x4e,
-    0x00, 0x00, 0x00, 0x31, 0x00, 0x31, 0x24, 0x21,
-    0x24, 0x22, 0x14, 0x2f, 0x24, 0x09, 0x07, 0x1d,
-    0x2b, 0x13, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e,
-    0x02, 0x15, 0x14, 0x06, 0x07, 0x15, 0x1e, 0x01,
-    0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02,
-    0x27, 0x33, 0x1e, 0x01, 0x33, 0x32, 0x36, 0x35,
-    0x34, 0x26, 0x2b, 0x01, 0x35, 0x33, 0x32, 0x36,
-    0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x40,
-    0x20, 0x3b, 0x53, 0x33, 0x35, 0x55, 0x3c, 0x20,
-    0x49, 0x3c, 0x43, 0x4f, 0x22, 0x3f, 0x59, 0x38,
-    0x33, 0x55, 0x3e, 0x24, 0x03, 0x5a, 0x06, 0x4f,
-    0x3e, 0x44, 0x4f, 0x50, 0x43, 0x5f, 0x5e, 0x3d,
-    0x4a, 0x49, 0x3e, 0x3d, 0x4a, 0x02, 0x0d, 0x2f,
-    0x4b, 0x36, 0x1d, 0x1b, 0x33, 0x48, 0x2d, 0x43,
-    0x56, 0x05, 0x06, 0x04, 0x5d, 0x4d, 0x2f, 0x4d,
-    0x36, 0x1d, 0x1b, 0x33, 0x48, 0x2d, 0x36, 0x3d,
-    0x45, 0x3a, 0x3b, 0x45, 0x52, 0x43, 0x37, 0x38,
-    0x41, 0x44, 0x39, 0x00, 0xff, 0xff, 0x00, 0x55,
-    0x00, 0x00, 0x02, 0x03, 0x03, 0xac, 0x10, 0x22,
-    0x01, 0xab, 0x00, 0x00, 0x11, 0x02, 0x01, 0x39,
-    0x00, 0x00, 0x00, 0x2f, 0x40, 0x2c, 0x16, 0x01,
-    0x02, 0x00, 0x01, 0x4c, 0x06, 0x01, 0x04, 0x05,
-    0x04, 0x85, 0x00, 0x05, 0x00, 0x07, 0x00, 0x05,
-    0x07, 0x69, 0x01, 0x01, 0x00, 0x00, 0x1a, 0x4d,
-    0x03, 0x01, 0x02, 0x02, 0x1b, 0x02, 0x4e, 0x22,
-    0x12, 0x21, 0x11, 0x1d, 0x11, 0x1d, 0x11, 0x08,
-    0x07, 0x29, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x46,
-    0xff, 0xf6, 0x02, 0x12, 0x02, 0xda, 0x11, 0x02,
-    0x00, 0x21, 0x00, 0x00, 0x00, 0x3b, 0x40, 0x38,
-    0x00, 0x04, 0x05, 0x01, 0x05, 0x04, 0x01, 0x80,
-    0x00, 0x01, 0x02, 0x05, 0x01, 0x02, 0x7e, 0x00,
-    0x05, 0x05, 0x03, 0x61, 0x00, 0x03, 0x03, 0x21,
-    0x4d, 0x00, 0x02, 0x02, 0x00, 0x61, 0x06, 0x01,
-    0x00, 0x00, 0x22, 0x00, 0x4e, 0x02, 0x01, 0x24,
-    0x22, 0x1e, 0x1d, 0x19, 0x17, 0x0d, 0x0b, 0x07,
-    0x06, 0x01, 0x2f, 0x02, 0x2f, 0x07, 0x07, 0x21,
-    0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x4d,
-    0xff, 0xf6, 0x02, 0x06, 0x02, 0x30, 0x11, 0x02,
-    0x00, 0x32, 0x00, 0x00, 0x00, 0x3b, 0x40, 0x38,
-    0x00, 0x04, 0x05, 0x01, 0x05, 0x04, 0x01, 0x80,
-    0x00, 0x01, 0x02, 0x05, 0x01, 0x02, 0x7e, 0x00,
-    0x05, 0x05, 0x03, 0x61, 0x00, 0x03, 0x03, 0x23,
-    0x4d, 0x00, 0x02, 0x02, 0x00, 0x61, 0x06, 0x01,
-    0x00, 0x00, 0x22, 0x00, 0x4e, 0x02, 0x01, 0x21,
-    0x1e, 0x1c, 0x1b, 0x17, 0x14, 0x0a, 0x07, 0x05,
-    0x04, 0x01, 0x2d, 0x02, 0x2c, 0x07, 0x07, 0x21,
-    0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x5f,
-    0x00, 0x00, 0x02, 0x26, 0x02, 0xfd, 0x11, 0x02,
-    0x00, 0x09, 0x00, 0x00, 0x00, 0x38, 0x40, 0x35,
-    0x08, 0x01, 0x05, 0x00, 0x06, 0x02, 0x05, 0x06,
-    0x69, 0x00, 0x01, 0x01, 0x02, 0x5f, 0x00, 0x02,
-    0x02, 0x1c, 0x4d, 0x03, 0x01, 0x00, 0x00, 0x04,
-    0x5f, 0x07, 0x01, 0x04, 0x04, 0x1b, 0x04, 0x4e,
-    0x0d, 0x0b, 0x01, 0x01, 0x14, 0x11, 0x0b, 0x18,
-    0x0d, 0x18, 0x01, 0x0a, 0x01, 0x0a, 0x11, 0x11,
-    0x11, 0x12, 0x09, 0x07, 0x25, 0x2b, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x14, 0xff, 0xf6, 0x02, 0x44,
-    0x02, 0xda, 0x00, 0x1d, 0x00, 0x2b, 0x00, 0x68,
-    0x4b, 0xb0, 0x18, 0x50, 0x58, 0x40, 0x20, 0x00,
-    0x00, 0x00, 0x03, 0x06, 0x00, 0x03, 0x67, 0x00,
-    0x07, 0x07, 0x01, 0x61, 0x08, 0x05, 0x02, 0x01,
-    0x01, 0x21, 0x4d, 0x00, 0x06, 0x06, 0x02, 0x61,
-    0x04, 0x01, 0x02, 0x02, 0x22, 0x02, 0x4e, 0x1b,
-    0x40, 0x28, 0x00, 0x00, 0x00, 0x03, 0x06, 0x00,
-    0x03, 0x67, 0x08, 0x01, 0x05, 0x05, 0x1a, 0x4d,
-    0x00, 0x07, 0x07, 0x01, 0x61, 0x00, 0x01, 0x01,
-    0x21, 0x4d, 0x00, 0x04, 0x04, 0x1b, 0x4d, 0x00,
-    0x06, 0x06, 0x02, 0x61, 0x00, 0x02, 0x02, 0x22,
-    0x02, 0x4e, 0x59, 0x40, 0x12, 0x00, 0x00, 0x29,
-    0x27, 0x22, 0x20, 0x00, 0x1d, 0x00, 0x1d, 0x11,
-    0x15, 0x29, 0x25, 0x11, 0x09, 0x07, 0x1b, 0x2b,
-    0x13, 0x11, 0x33, 0x35, 0x34, 0x3e, 0x02, 0x33,
-    0x32, 0x1e, 0x02, 0x15, 0x11, 0x14, 0x0e, 0x02,
-    0x23, 0x22, 0x2e, 0x02, 0x3d, 0x01, 0x23, 0x11,
-    0x23, 0x11, 0x01, 0x14, 0x16, 0x33, 0x32, 0x36,
-    0x35, 0x11, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15,
-    0x6e, 0x64, 0x1b, 0x30, 0x44, 0x2a, 0x2a, 0x44,
-    0x30, 0x1b, 0x1b, 0x30, 0x44, 0x2a, 0x2a, 0x44,
-    0x30, 0x1b, 0x64, 0x5a, 0x01, 0x18, 0x34, 0x2b,
-    0x2b, 0x34, 0x34, 0x2b, 0x2b, 0x34, 0x02, 0xd0,
-    0xfe, 0xd0, 0x7c, 0x2b, 0x46, 0x32, 0x1b, 0x1b,
-    0x32, 0x46, 0x2b, 0xfe, 0x98, 0x2b, 0x46, 0x32,
-    0x1b, 0x1b, 0x32, 0x46, 0x2b, 0x9a, 0xfe, 0xb2,
-    0x02, 0xd0, 0xfd, 0xe4, 0x36, 0x38, 0x38, 0x36,
-    0x01, 0x68, 0x36, 0x38, 0x38, 0x36, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x5a, 0x00, 0x00, 0x02, 0x26,
-    0x02, 0xd0, 0x00, 0x0e, 0x00, 0x17, 0x00, 0x2a,
-    0x40, 0x27, 0x00, 0x01, 0x00, 0x04, 0x03, 0x01,
-    0x04, 0x67, 0x00, 0x00, 0x00, 0x1a, 0x4d, 0x05,
-    0x01, 0x03, 0x03, 0x02, 0x60, 0x00, 0x02, 0x02,
-    0x1b, 0x02, 0x4e, 0x10, 0x0f, 0x16, 0x14, 0x0f,
-    0x17, 0x10, 0x17, 0x28, 0x21, 0x10, 0x06, 0x07,
-    0x19, 0x2b, 0x13, 0x33, 0x11, 0x33, 0x32, 0x1e,
-    0x02, 0x15, 0x14, 0x0e, 0x02, 0x2b, 0x01, 0x37,
-    0x32, 0x36, 0x35, 0x34, 0x26, 0x2b, 0x01, 0x11,
-    0x5a, 0x5a, 0x96, 0x31, 0x51, 0x3a, 0x20, 0x20,
-    0x3a, 0x51, 0x31, 0xf0, 0xeb, 0x3c, 0x48, 0x48,
-    0x3c, 0x91, 0x02, 0xd0, 0xfe, 0xde, 0x1f, 0x38,
-    0x50, 0x30, 0x30, 0x4f, 0x39, 0x1f, 0x52, 0x49,
-    0x3c, 0x3c, 0x49, 0xfe, 0xf6, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x3e, 0x00, 0x00, 0x02, 0x1a,
-    0x02, 0xd0, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x1b,
-    0x00, 0x2f, 0x40, 0x2c, 0x00, 0x01, 0x00, 0x06,
-    0x05, 0x01, 0x06, 0x69, 0x03, 0x01, 0x00, 0x00,
-    0x1a, 0x4d, 0x00, 0x05, 0x05, 0x02, 0x60, 0x07,
-    0x04, 0x02, 0x02, 0x02, 0x1b, 0x02, 0x4e, 0x0e,
-    0x0e, 0x1b, 0x19, 0x14, 0x12, 0x0e, 0x11, 0x0e,
-    0x11, 0x12, 0x27, 0x21, 0x10, 0x08, 0x07, 0x1a,
-    0x2b, 0x13, 0x33, 0x11, 0x33, 0x32, 0x16, 0x1d,
-    0x01, 0x14, 0x0e, 0x02, 0x2b, 0x01, 0x21, 0x11,
-    0x33, 0x11, 0x25, 0x33, 0x32, 0x36, 0x3d, 0x01,
-    0x34, 0x26, 0x2b, 0x01, 0x3e, 0x54, 0x2f, 0x5f,
-    0x65, 0x1a, 0x32, 0x49, 0x2f, 0x83, 0x01, 0x88,
-    0x54, 0xfe, 0x78, 0x2f, 0x36, 0x38, 0x38, 0x36,
-    0x2f, 0x02, 0xd0, 0xfe, 0xdc, 0x6e, 0x5a, 0x1d,
-    0x2d, 0x49, 0x34, 0x1d, 0x02, 0xd0, 0xfd, 0x30,
-    0x50, 0x42, 0x36, 0x1c, 0x36, 0x42, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x0a, 0x00, 0x00, 0x02, 0x35,
-    0x02, 0xd0, 0x00, 0x10, 0x00, 0x19, 0x00, 0x36,
-    0x40, 0x33, 0x00, 0x01, 0x07, 0x01, 0x05, 0x04,
-    0x01, 0x05, 0x67, 0x06, 0x01, 0x03, 0x03, 0x00,
-    0x5f, 0x00, 0x00, 0x00, 0x1a, 0x4d, 0x00, 0x04,
-    0x04, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x1b, 0x02,
-    0x4e, 0x11, 0x11, 0x00, 0x00, 0x11, 0x19, 0x11,
-    0x18, 0x14, 0x12, 0x00, 0x10, 0x00, 0x10, 0x28,
-    0x21, 0x11, 0x08, 0x07, 0x19, 0x2b, 0x13, 0x35,
-    0x33, 0x11, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x14,
-    0x0e, 0x02, 0x2b, 0x01, 0x11, 0x13, 0x11, 0x33,
-    0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x0a, 0xc8,
-    0x87, 0x32, 0x51, 0x39, 0x20, 0x20, 0x39, 0x51,
-    0x32, 0xe1, 0x5a, 0x82, 0x3b, 0x49, 0x48, 0x3c,
-    0x02, 0x7e, 0x52, 0xfe, 0xdc, 0x1f, 0x38, 0x4f,
-    0x30, 0x30, 0x4f, 0x38, 0x1f, 0x02, 0x7e, 0xfe,
-    0xdc, 0xfe, 0xf8, 0x49, 0x3b, 0x3c, 0x48, 0x00,
-    0x00, 0x02, 0x00, 0x35, 0x00, 0x00, 0x01, 0xfe,
-    0x02, 0xd0, 0x00, 0x0f, 0x00, 0x18, 0x00, 0x2c,
-    0x40, 0x29, 0x06, 0x01, 0x04, 0x00, 0x02, 0x01,
-    0x04, 0x02, 0x67, 0x00, 0x05, 0x05, 0x00, 0x5f,
-    0x00, 0x00, 0x00, 0x1a, 0x4d, 0x03, 0x01, 0x01,
-    0x01, 0x1b, 0x01, 0x4e, 0x11, 0x10, 0x14, 0x12,
-    0x10, 0x18, 0x11, 0x18, 0x11, 0x11, 0x11, 0x27,
-    0x07, 0x07, 0x1a, 0x2b, 0x13, 0x2e, 0x01, 0x35,
-    0x34, 0x3e, 0x02, 0x3b, 0x01, 0x11, 0x23, 0x11,
-    0x23, 0x03, 0x23, 0x13, 0x33, 0x11, 0x23, 0x22,
-    0x06, 0x15, 0x14, 0x16, 0xcb, 0x41, 0x4b, 0x1f,
-    0x39, 0x50, 0x31, 0xe6, 0x5a, 0x7c, 0x8d, 0x66,
-    0xe3, 0x8c, 0x8c, 0x38, 0x44, 0x43, 0x01, 0x37,
-    0x14, 0x69, 0x4a, 0x2f, 0x4d, 0x38, 0x1e, 0xfd,
-    0x30, 0x01, 0x2c, 0xfe, 0xd4, 0x01, 0x7c, 0x01,
-    0x04, 0x47, 0x3b, 0x3b, 0x47, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x4a, 0xff, 0xf6, 0x02, 0x02,
-    0x02, 0xda, 0x00, 0x1f, 0x00, 0x41, 0x40, 0x3e,
-    0x00, 0x04, 0x03, 0x02, 0x03, 0x04, 0x02, 0x80,
-    0x08, 0x01, 0x07, 0x01, 0x00, 0x01, 0x07, 0x00,
-    0x80, 0x00, 0x02, 0x00, 0x01, 0x07, 0x02, 0x01,
-    0x67, 0x00, 0x03, 0x03, 0x05, 0x61, 0x00, 0x05,
-    0x05, 0x21, 0x4d, 0x00, 0x00, 0x00, 0x06, 0x61,
-    0x00, 0x06, 0x06, 0x22, 0x06, 0x4e, 0x00, 0x00,
-    0x00, 0x1f, 0x00, 0x1f, 0x25, 0x22, 0x12, 0x23,
-    0x11, 0x13, 0x22, 0x09, 0x07, 0x1d, 0x2b, 0x37,
-    0x1e, 0x01, 0x33, 0x32, 0x36, 0x3d, 0x01, 0x23,
-    0x35, 0x33, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06,
-    0x07, 0x23, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x15,
-    0x11, 0x14, 0x06, 0x23, 0x22, 0x26, 0x27, 0xa4,
-    0x06, 0x45, 0x37, 0x3d, 0x45, 0xf8, 0xf8, 0x46,
-    0x3c, 0x37, 0x45, 0x06, 0x5a, 0x0b, 0x73, 0x5e,
-    0x67, 0x75, 0x75, 0x67, 0x5e, 0x73, 0x0b, 0xb9,
-    0x36, 0x3d, 0x48, 0x3f, 0x78, 0x50, 0x6e, 0x3f,
-    0x48, 0x3d, 0x36, 0x5c, 0x67, 0x70, 0x62, 0xfe,
-    0xc0, 0x62, 0x70, 0x67, 0x5c, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x14, 0xff, 0xfb, 0x01, 0xfe,
-    0x02, 0xd0, 0x00, 0x0f, 0x00, 0x45, 0x4b, 0xb0,
-    0x2e, 0x50, 0x58, 0x40, 0x16, 0x00, 0x02, 0x02,
-    0x00, 0x5f, 0x00, 0x00, 0x00, 0x1a, 0x4d, 0x00,
-    0x04, 0x04, 0x01, 0x61, 0x03, 0x01, 0x01, 0x01,
-    0x1b, 0x01, 0x4e, 0x1b, 0x40, 0x1a, 0x00, 0x02,
-    0x02, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x1a, 0x4d,
-    0x00, 0x01, 0x01, 0x1b, 0x4d, 0x00, 0x04, 0x04,
-    0x03, 0x61, 0x00, 0x03, 0x03, 0x1b, 0x03, 0x4e,
-    0x59, 0xb7, 0x21, 0x23, 0x11, 0x11, 0x10, 0x05,
-    0x07, 0x1b, 0x2b, 0x13, 0x21, 0x11, 0x23, 0x11,
-    0x23, 0x03, 0x0e, 0x01, 0x2b, 0x01, 0x35, 0x33,
-    0x32, 0x36, 0x37, 0x80, 0x01, 0x7e, 0x5a, 0xcb,
-    0x05, 0x02, 0x50, 0x57, 0x17, 0x12, 0x2c, 0x27,
-    0x01, 0x02, 0xd0, 0xfd, 0x30, 0x02, 0x7e, 0xfe,
-    0x80, 0x87, 0x7c, 0x54, 0x4f, 0x60, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x19, 0xff, 0x74, 0x02, 0x3f,
-    0x02, 0xd0, 0x00, 0x10, 0x00, 0x1a, 0x00, 0x38,
-    0x40, 0x35, 0x08, 0x05, 0x02, 0x03, 0x00, 0x03,
-    0x53, 0x00, 0x06, 0x06, 0x01, 0x5f, 0x00, 0x01,
-    0x01, 0x1a, 0x4d, 0x09, 0x07, 0x02, 0x03, 0x00,
-    0x00, 0x04, 0x5f, 0x00, 0x04, 0x04, 0x1b, 0x04,
-    0x4e, 0x11, 0x11, 0x00, 0x00, 0x11, 0x1a, 0x11,
-    0x19, 0x13, 0x12, 0x00, 0x10, 0x00, 0x10, 0x11,
-    0x11, 0x11, 0x16, 0x11, 0x0a, 0x07, 0x1b, 0x2b,
-    0x17, 0x35, 0x33, 0x36, 0x37, 0x3e, 0x01, 0x37,
-    0x13, 0x21, 0x11, 0x33, 0x15, 0x23, 0x35, 0x21,
-    0x15, 0x25, 0x11, 0x23, 0x03, 0x0e, 0x01, 0x07,
-    0x06, 0x07, 0x15, 0x19, 0x2d, 0x0e, 0x0c, 0x0a,
-    0x11, 0x02, 0x06, 0x01, 0x76, 0x46, 0x50, 0xfe,
-    0x7a, 0x01, 0x36, 0xc6, 0x04, 0x01, 0x10, 0x09,
-    0x0a, 0x0d, 0x8c, 0xd9, 0x1d, 0x2b, 0x26, 0x72,
-    0x4f, 0x01, 0x54, 0xfd, 0x7d, 0xd9, 0x8c, 0x8c,
-    0xd9, 0x02, 0x33, 0xfe, 0xfc, 0x54, 0x71, 0x23,
-    0x28, 0x18, 0x07, 0x00, 0x00, 0x01, 0x00, 0x28,
-    0x00, 0x00, 0x02, 0x30, 0x02, 0xd0, 0x00, 0x12,
-    0x00, 0x22, 0x40, 0x1f, 0x11, 0x06, 0x02, 0x01,
-    0x00, 0x01, 0x4c, 0x03, 0x02, 0x02, 0x00, 0x00,
-    0x1a, 0x4d, 0x00, 0x01, 0x01, 0x1b, 0x01, 0x4e,
-    0x00, 0x00, 0x00, 0x12, 0x00, 0x12, 0x11, 0x1d,
-    0x04, 0x07, 0x18, 0x2b, 0x1b, 0x01, 0x1e, 0x01,
-    0x17, 0x16, 0x17, 0x33, 0x36, 0x37, 0x3e, 0x01,
-    0x37, 0x13, 0x33, 0x01, 0x23, 0x37, 0x03, 0x8c,
-    0x89, 0x09, 0x0b, 0x03, 0x03, 0x02, 0x07, 0x01,
-    0x03, 0x03, 0x0a, 0x08, 0x7d, 0x62, 0xfe, 0xef,
-    0x60, 0x4a, 0xe1, 0x02, 0xd0, 0xfe, 0xa5, 0x16,
-    0x28, 0x10, 0x12, 0x10, 0x0f, 0x13, 0x0f, 0x28,
-    0x17, 0x01, 0x5b, 0xfd, 0x30, 0xbd, 0x02, 0x13,
-    0x00, 0x03, 0x00, 0x32, 0xff, 0xec, 0x02, 0x26,
-    0x02, 0xfd, 0x00, 0x1b, 0x00, 0x23, 0x00, 0x2b,
-    0x00, 0x61, 0x4b, 0xb0, 0x18, 0x50, 0x58, 0x40,
-    0x21, 0x08, 0x01, 0x06, 0x05, 0x01, 0x03, 0x04,
-    0x06, 0x03, 0x69, 0x09, 0x01, 0x07, 0x07, 0x00,
-    0x61, 0x02, 0x01, 0x00, 0x00, 0x1a, 0x4d, 0x00,
-    0x01, 0x01, 0x04, 0x5f, 0x00, 0x04, 0x04, 0x1b,
-    0x04, 0x4e, 0x1b, 0x40, 0x24, 0x00, 0x01, 0x00,
-    0x04, 0x01, 0x57, 0x02, 0x01, 0x00, 0x09, 0x01,
-    0x07, 0x06, 0x00, 0x07, 0x69, 0x08, 0x01, 0x06,
-    0x05, 0x01, 0x03, 0x04, 0x06, 0x03, 0x69, 0x00,
-    0x01, 0x01, 0x04, 0x5f, 0x00, 0x04, 0x01, 0x04,
-    0x4f, 0x59, 0x40, 0x0e, 0x29, 0x28, 0x13, 0x15,
-    0x15, 0x11, 0x11, 0x19, 0x11, 0x11, 0x14, 0x0a,
-    0x07, 0x1f, 0x2b, 0x13, 0x34, 0x3e, 0x02, 0x33,
-    0x35, 0x33, 0x15, 0x32, 0x1e, 0x02, 0x1d, 0x01,
-    0x14, 0x0e, 0x02, 0x23, 0x15, 0x23, 0x35, 0x22,
-    0x2e, 0x02, 0x35, 0x05, 0x32, 0x36, 0x3d, 0x01,
-    0x34, 0x26, 0x23, 0x03, 0x14, 0x16, 0x33, 0x11,
-    0x22, 0x06, 0x15, 0x32, 0x1e, 0x36, 0x4d, 0x2f,
-    0x54, 0x2f, 0x4d, 0x36, 0x1e, 0x1e, 0x37, 0x4c,
-    0x2f, 0x54, 0x2e, 0x4d, 0x37, 0x1e, 0x01, 0x24,
-    0x38, 0x44, 0x44, 0x38, 0xd0, 0x44, 0x38, 0x38,
-    0x44, 0x01, 0xe7, 0x30, 0x4f, 0x37, 0x1f, 0x41,
-    0x41, 0x1f, 0x37, 0x4f, 0x30, 0xea, 0x2f, 0x4d,
-    0x36, 0x1e, 0x41, 0x41, 0x1e, 0x36, 0x4d, 0x2f,
-    0x84, 0x48, 0x3c, 0xea, 0x3e, 0x4b, 0xfe, 0x8d,
-    0x3c, 0x48, 0x01, 0xf7, 0x4b, 0x3e, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x4b, 0x00, 0x00, 0x01, 0xfe,
-    0x02, 0xd0, 0x00, 0x1e, 0x00, 0x2f, 0x40, 0x2c,
-    0x09, 0x01, 0x00, 0x01, 0x13, 0x01, 0x03, 0x00,
-    0x02, 0x4c, 0x00, 0x00, 0x00, 0x03, 0x02, 0x00,
-    0x03, 0x69, 0x05, 0x04, 0x02, 0x01, 0x01, 0x1a,
-    0x4d, 0x00, 0x02, 0x02, 0x1b, 0x02, 0x4e, 0x00,
-    0x00, 0x00, 0x1e, 0x00, 0x1e, 0x2c, 0x11, 0x15,
-    0x23, 0x06, 0x07, 0x1a, 0x2b, 0x13, 0x11, 0x14,
-    0x16, 0x33, 0x32, 0x36, 0x37, 0x36, 0x37, 0x11,
-    0x33, 0x11, 0x23, 0x35, 0x34, 0x36, 0x35, 0x34,
-    0x37, 0x22, 0x07, 0x0e, 0x03, 0x23, 0x22, 0x26,
-    0x35, 0x11, 0xa5, 0x46, 0x3c, 0x23, 0x30, 0x0f,
-    0x11, 0x0a, 0x5a, 0x5a, 0x01, 0x01, 0x01, 0x01,
-    0x03, 0x14, 0x23, 0x31, 0x21, 0x5f, 0x6e, 0x02,
-    0xd0, 0xfe, 0xf7, 0x37, 0x41, 0x0a, 0x05, 0x07,
-    0x08, 0x01, 0x63, 0xfd, 0x30, 0xe1, 0x0b, 0x16,
-    0x09, 0x0a, 0x09, 0x01, 0x02, 0x0a, 0x0a, 0x08,
-    0x6c, 0x5c, 0x01, 0x09, 0x00, 0x01, 0x00, 0x5a,
-    0x00, 0x00, 0x01, 0xfe, 0x02, 0x26, 0x00, 0x0b,
-    0x00, 0x27, 0x40, 0x24, 0x00, 0x00, 0x00, 0x03,
-    0x02, 0x00, 0x03, 0x67, 0x06, 0x05, 0x02, 0x01,
-    0x01, 0x1c, 0x4d, 0x04, 0x01, 0x02, 0x02, 0x1b,
-    0x02, 0x4e, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x0b,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x07, 0x07, 0x1b,
-    0x2b, 0x13, 0x15, 0x33, 0x35, 0x33, 0x11, 0x23,
-    0x35, 0x23, 0x15, 0x23, 0x11, 0xb4, 0xf0, 0x5a,
-    0x5a, 0xf0, 0x5a, 0x02, 0x26, 0xe8, 0xe8, 0xfd,
-    0xda, 0xec, 0xec, 0x02, 0x26, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x50, 0xff, 0xf6, 0x02, 0x08,
-    0x03, 0x13, 0x10, 0x22, 0x01, 0xa3, 0x00, 0x00,
-    0x11, 0x02, 0x00, 0x99, 0x00, 0x00, 0x00, 0x55,
-    0x40, 0x52, 0x00, 0x04, 0x02, 0x03, 0x02, 0x04,
-    0x03, 0x80, 0x09, 0x01, 0x07, 0x0a, 0x01, 0x08,
-    0x01, 0x07, 0x08, 0x69, 0x0c, 0x01, 0x06, 0x00,
-    0x02, 0x04, 0x06, 0x02, 0x67, 0x00, 0x05, 0x05,
-    0x01, 0x61, 0x00, 0x01, 0x01, 0x23, 0x4d, 0x00,
-    0x03, 0x03, 0x00, 0x61, 0x0b, 0x01, 0x00, 0x00,
-    0x22, 0x00, 0x4e, 0x19, 0x19, 0x03, 0x02, 0x38,
-    0x36, 0x32, 0x30, 0x2c, 0x2a, 0x26, 0x24, 0x19,
-    0x21, 0x19, 0x21, 0x1e, 0x1c, 0x16, 0x15, 0x13,
-    0x11, 0x0e, 0x0d, 0x0a, 0x08, 0x02, 0x18, 0x03,
-    0x18, 0x0d, 0x07, 0x21, 0x2b, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x5a, 0x00, 0x00, 0x01, 0xfe,
-    0x02, 0x26, 0x00, 0x1e, 0x00, 0x1e, 0x40, 0x1b,
-    0x16, 0x14, 0x02, 0x02, 0x00, 0x01, 0x4c, 0x01,
-    0x01, 0x00, 0x00, 0x1c, 0x4d, 0x03, 0x01, 0x02,
-    0x02, 0x1b, 0x02, 0x4e, 0x1c, 0x11, 0x1d, 0x10,
-    0x04, 0x07, 0x1a, 0x2b, 0x13, 0x33, 0x11, 0x14,
-    0x0e, 0x02, 0x31, 0x33, 0x36, 0x37, 0x3e, 0x01,
-    0x37, 0x13, 0x33, 0x11, 0x23, 0x11, 0x34, 0x37,
-    0x36, 0x37, 0x23, 0x06, 0x07, 0x0e, 0x01, 0x07,
-    0x03, 0x23, 0x5a, 0x56, 0x02, 0x03, 0x02, 0x07,
-    0x08, 0x08, 0x08, 0x11, 0x09, 0xa9, 0x73, 0x56,
-    0x03, 0x01, 0x01, 0x07, 0x07, 0x08, 0x07, 0x12,
-    0x0b, 0xa6, 0x73, 0x02, 0x26, 0xfe, 0xc0, 0x1a,
-    0x33, 0x27, 0x18, 0x14, 0x15, 0x11, 0x29, 0x12,
-    0x01, 0x57, 0xfd, 0xda, 0x01, 0x42, 0x3b, 0x27,
-    0x16, 0x13, 0x11, 0x13, 0x11, 0x29, 0x17, 0xfe,
-    0xa8, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x37,
-    0x00, 0x00, 0x01, 0xfe, 0x02, 0x26, 0x00, 0x0d,
-    0x00, 0x16, 0x00, 0x2c, 0x40, 0x29, 0x00, 0x05,
-    0x00, 0x02, 0x01, 0x05, 0x02, 0x67, 0x06, 0x01,
-    0x04, 0x04, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x1c,
-    0x4d, 0x03, 0x01, 0x01, 0x01, 0x1b, 0x01, 0x4e,
-    0x0f, 0x0e, 0x15, 0x13, 0x0e, 0x16, 0x0f, 0x16,
-    0x11, 0x11, 0x11, 0x25, 0x07, 0x07, 0x1a, 0x2b,
-    0x37, 0x2e, 0x01, 0x35, 0x34, 0x36, 0x3b, 0x01,
-    0x11, 0x23, 0x35, 0x23, 0x07, 0x23, 0x13, 0x22,
-    0x06, 0x15, 0x14, 0x16, 0x3b, 0x01, 0x35, 0xc7,
-    0x3f, 0x47, 0x6a, 0x5e, 0xf5, 0x5a, 0x80, 0x83,
-    0x6a, 0xd2, 0x33, 0x39, 0x39, 0x33, 0x9b, 0xd4,
-    0x0f, 0x55, 0x41, 0x51, 0x5c, 0xfd, 0xda, 0xcd,
-    0xcd, 0x01, 0xd6, 0x31, 0x2c, 0x2b, 0x31, 0xb9,
-    0x00, 0x01, 0x00, 0x5a, 0x00, 0x00, 0x01, 0xfe,
-    0x02, 0x26, 0x00, 0x07, 0x00, 0x21, 0x40, 0x1e,
-    0x00, 0x02, 0x02, 0x00, 0x5f, 0x00, 0x00, 0x00,
-    0x1c, 0x4d, 0x04, 0x03, 0x02, 0x01, 0x01, 0x1b,
-    0x01, 0x4e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07,
-    0x11, 0x11, 0x11, 0x05, 0x07, 0x19, 0x2b, 0x33,
-    0x11, 0x21, 0x11, 0x23, 0x11, 0x23, 0x11, 0x5a,
-    0x01, 0xa4, 0x5a, 0xf0, 0x02, 0x26, 0xfd, 0xda,
-    0x01, 0xd4, 0xfe, 0x2c, 0x00, 0x01, 0x00, 0x14,
-    0xff, 0xfb, 0x01, 0xfe, 0x02, 0x26, 0x00, 0x13,
-    0x00, 0x45, 0x4b, 0xb0, 0x2e, 0x50, 0x58, 0x40,
-    0x16, 0x00, 0x02, 0x02, 0x00, 0x5f, 0x00, 0x00,
-    0x00, 0x1c, 0x4d, 0x00, 0x04, 0x04, 0x01, 0x61,
-    0x03, 0x01, 0x01, 0x01, 0x1b, 0x01, 0x4e, 0x1b,
-    0x40, 0x1a, 0x00, 0x02, 0x02, 0x00, 0x5f, 0x00,
-    0x00, 0x00, 0x1c, 0x4d, 0x00, 0x01, 0x01, 0x1b,
-    0x4d, 0x00, 0x04, 0x04, 0x03, 0x61, 0x00, 0x03,
-    0x03, 0x1b, 0x03, 0x4e, 0x59, 0xb7, 0x21, 0x25,
-    0x11, 0x11, 0x10, 0x05, 0x07, 0x1b, 0x2b, 0x13,
-    0x21, 0x11, 0x23, 0x11, 0x23, 0x07, 0x0e, 0x03,
-    0x2b, 0x01, 0x35, 0x33, 0x32, 0x3e, 0x02, 0x37,
-    0x80, 0x01, 0x7e, 0x5a, 0xcb, 0x05, 0x01, 0x15,
-    0x28, 0x3f, 0x2c, 0x17, 0x12, 0x17, 0x1f, 0x14,
-    0x09, 0x01, 0x02, 0x26, 0xfd, 0xda, 0x01, 0xd4,
-    0xe4, 0x42, 0x5d, 0x3b, 0x1b, 0x54, 0x11, 0x26,
-    0x40, 0x2e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x19,
-    0xff, 0x74, 0x02, 0x3f, 0x02, 0x26, 0x00, 0x10,
-    0x00, 0x1a, 0x00, 0x38, 0x40, 0x35, 0x08, 0x05,
-    0x02, 0x03, 0x00, 0x03, 0x53, 0x00, 0x06, 0x06,
-    0x01, 0x5f, 0x00, 0x01, 0x01, 0x1c, 0x4d, 0x09,
-    0x07, 0x02, 0x03, 0x00, 0x00, 0x04, 0x5f, 0x00,
-    0x04, 0x04, 0x1b, 0x04, 0x4e, 0x11, 0x11, 0x00,
-    0x00, 0x11, 0x1a, 0x11, 0x19, 0x13, 0x12, 0x00,
-    0x10, 0x00, 0x10, 0x11, 0x11, 0x11, 0x16, 0x11,
-    0x0a, 0x07, 0x1b, 0x2b, 0x17, 0x35, 0x33, 0x36,
-    0x37, 0x3e, 0x01, 0x3f, 0x01, 0x21, 0x11, 0x33,
-    0x15, 0x23, 0x35, 0x21, 0x15, 0x25, 0x11, 0x23,
-    0x07, 0x0e, 0x01, 0x07, 0x06, 0x07, 0x15, 0x19,
-    0x2d, 0x0e, 0x0c, 0x0a, 0x11, 0x02, 0x06, 0x01,
-    0x76, 0x46, 0x50, 0xfe, 0x7a, 0x01, 0x36, 0xc6,
-    0x04, 0x02, 0x0e, 0x08, 0x0a, 0x0c, 0x8c, 0xd9,
-    0x17, 0x22, 0x1c, 0x55, 0x39, 0xf6, 0xfe, 0x27,
-    0xd9, 0x8c, 0x8c, 0xd9, 0x01, 0x89, 0xa0, 0x40,
-    0x56, 0x1b, 0x1f, 0x12, 0x07, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x69, 0x00, 0x00, 0x02, 0x17,
-    0x02, 0x26, 0x00, 0x05, 0x00, 0x1f, 0x40, 0x1c,
-    0x00, 0x00, 0x00, 0x02, 0x5f, 0x03, 0x01, 0x02,
-    0x02, 0x1c, 0x4d, 0x00, 0x01, 0x01, 0x1b, 0x01,
-    0x4e, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x11,
-    0x11, 0x04, 0x07, 0x18, 0x2b, 0x01, 0x15, 0x21,
-    0x11, 0x23, 0x11, 0x02, 0x17, 0xfe, 0xac, 0x5a,
-    0x02, 0x26, 0x52, 0xfe, 0x2c, 0x02, 0x26, 0x00,
-    0x00, 0x01, 0x00, 0x5d, 0x00, 0x00, 0x02, 0x35,
-    0x02, 0x26, 0x00, 0x0c, 0x00, 0x2d, 0x40, 0x2a,
-    0x07, 0x01, 0x04, 0x01, 0x01, 0x4c, 0x00, 0x01,
-    0x00, 0x04, 0x03, 0x01, 0x04, 0x67, 0x02, 0x01,
-    0x00, 0x00, 0x1c, 0x4d, 0x06, 0x05, 0x02, 0x03,
-    0x03, 0x1b, 0x03, 0x4e, 0x00, 0x00, 0x00, 0x0c,
-    0x00, 0x0c, 0x11, 0x12, 0x11, 0x11, 0x11, 0x07,
-    0x07, 0x1b, 0x2b, 0x33, 0x11, 0x33, 0x15, 0x33,
-    0x37, 0x33, 0x03, 0x13, 0x23, 0x27, 0x23, 0x15,
-    0x5d, 0x5a, 0x6c, 0xa8, 0x67, 0xc4, 0xc7, 0x6a,
-    0xa7, 0x6d, 0x02, 0x26, 0xe6, 0xe6, 0xfe, 0xf7,
-    0xfe, 0xe3, 0xf0, 0xf0, 0x00, 0x01, 0x00, 0x46,
-    0x00, 0x00, 0x02, 0x12, 0x02, 0x26, 0x00, 0x2d,
-    0x00, 0x30, 0x40, 0x2d, 0x27, 0x24, 0x16, 0x14,
-    0x06, 0x05, 0x02, 0x00, 0x01, 0x4c, 0x00, 0x02,
-    0x00, 0x01, 0x00, 0x02, 0x01, 0x80, 0x05, 0x04,
-    0x02, 0x00, 0x00, 0x1c, 0x4d, 0x03, 0x01, 0x01,
-    0x01, 0x1b, 0x01, 0x4e, 0x00, 0x00, 0x00, 0x2d,
-    0x00, 0x2d, 0x1d, 0x1d, 0x11, 0x1d, 0x06, 0x07,
-    0x1a, 0x2b, 0x13, 0x17, 0x1e, 0x01, 0x17, 0x16,
-    0x17, 0x33, 0x36, 0x37, 0x3e, 0x01, 0x3f, 0x01,
-    0x33, 0x11, 0x23, 0x11, 0x34, 0x36, 0x37, 0x36,
-    0x37, 0x23, 0x06, 0x07, 0x0e, 0x01, 0x0f, 0x01,
-    0x23, 0x27, 0x2e, 0x01, 0x27, 0x26, 0x27, 0x23,
-    0x16, 0x17, 0x1e, 0x01, 0x15, 0x11, 0x23, 0x11,
-    0xb6, 0x5c, 0x05, 0x09, 0x03, 0x04, 0x04, 0x06,
-    0x04, 0x05, 0x04, 0x08, 0x05, 0x57, 0x70, 0x53,
-    0x03, 0x02, 0x01, 0x03, 0x06, 0x08, 0x07, 0x07,
-    0x0f, 0x06, 0x40, 0x54, 0x40, 0x06, 0x0f, 0x07,
-    0x08, 0x08, 0x05, 0x02, 0x02, 0x01, 0x02, 0x53,
-    0x02, 0x26, 0xdb, 0x0b, 0x1d, 0x0c, 0x0f, 0x0e,
-    0x0e, 0x0f, 0x0c, 0x1d, 0x0b, 0xdb, 0xfd, 0xda,
-    0x01, 0x4f, 0x10, 0x28, 0x13, 0x16, 0x16, 0x17,
-    0x16, 0x13, 0x28, 0x0f, 0xa0, 0xa0, 0x10, 0x29,
-    0x12, 0x16, 0x17, 0x16, 0x16, 0x12, 0x29, 0x11,
-    0xfe, 0xb1, 0x02, 0x26, 0x00, 0x03, 0x00, 0x32,
-    0xff, 0x5b, 0x02, 0x26, 0x02, 0xd6, 0x00, 0x1b,
-    0x00, 0x23, 0x00, 0x2b, 0x00, 0x34, 0x40, 0x31,
-    0x00, 0x02, 0x02, 0x1a, 0x4d, 0x09, 0x01, 0x06,
-    0x06, 0x01, 0x61, 0x03, 0x01, 0x01, 0x01, 0x1c,
-    0x4d, 0x08, 0x01, 0x07, 0x07, 0x00, 0x61, 0x04,
-    0x01, 0x00, 0x00, 0x1b, 0x4d, 0x00, 0x05, 0x05,
-    0x1e, 0x05, 0x4e, 0x29, 0x28, 0x15, 0x11, 0x13,
-    0x11, 0x19, 0x11, 0x11, 0x19, 0x10, 0x0a, 0x07,
-    0x1f, 0x2b, 0x21, 0x22, 0x2e, 0x02, 0x3d, 0x01,
-    0x34, 0x3e, 0x02, 0x33, 0x35, 0x33, 0x15, 0x32,
-    0x1e, 0x02, 0x1d, 0x01, 0x14, 0x0e, 0x02, 0x23,
-    0x15, 0x23, 0x13, 0x34, 0x26, 0x23, 0x11, 0x32,
-    0x36, 0x35, 0x21, 0x14, 0x16, 0x33, 0x11, 0x22,
-    0x06, 0x15, 0x01, 0x04, 0x30, 0x4e, 0x37, 0x1d,
-    0x1d, 0x37, 0x4e, 0x30, 0x50, 0x30, 0x4e, 0x37,
-    0x1d, 0x1d, 0x37, 0x4e, 0x30, 0x50, 0xd2, 0x46,
-    0x3c, 0x3d, 0x45, 0xfe, 0xac, 0x45, 0x3d, 0x3c,
-    0x46, 0x1c, 0x35, 0x4b, 0x2e, 0x94, 0x2e, 0x4a,
-    0x34, 0x1c, 0xb0, 0xb0, 0x1c, 0x34, 0x4a, 0x2e,
-    0x94, 0x2e, 0x4b, 0x35, 0x1c, 0xa5, 0x02, 0x03,
-    0x3d, 0x45, 0xfe, 0x66, 0x46, 0x3e, 0x3e, 0x46,
-    0x01, 0x9a, 0x45, 0x3d, 0xff, 0xff, 0x00, 0x5a,
-    0x00, 0x00, 0x01, 0xfe, 0x03, 0x11, 0x10, 0x22,
-    0x01, 0xc4, 0x00, 0x00, 0x11, 0x02, 0x00, 0x8f,
-    0x00, 0xfb, 0x00, 0x32, 0x40, 0x2f, 0x17, 0x15,
-    0x02, 0x02, 0x00, 0x01, 0x4c, 0x06, 0x01, 0x04,
-    0x05, 0x04, 0x85, 0x00, 0x07, 0x07, 0x05, 0x61,
-    0x00, 0x05, 0x05, 0x1a, 0x4d, 0x01, 0x01, 0x00,
-    0x00, 0x1c, 0x4d, 0x03, 0x01, 0x02, 0x02, 0x1b,
-    0x02, 0x4e, 0x24, 0x12, 0x22, 0x11, 0x1c, 0x11,
-    0x1d, 0x11, 0x08, 0x07, 0x29, 0x2b, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x2d, 0x00, 0x00, 0x02, 0x2b,
-    0x02, 0x26, 0x00, 0x07, 0x00, 0x1b, 0x40, 0x18,
-    0x03, 0x01, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00,
-    0x00, 0x1c, 0x4d, 0x00, 0x02, 0x02, 0x1b, 0x02,
-    0x4e, 0x11, 0x11, 0x11, 0x10, 0x04, 0x07, 0x1a,
-    0x2b, 0x13, 0x21, 0x15, 0x23, 0x11, 0x23, 0x11,
-    0x23, 0x2d, 0x01, 0xfe, 0xd1, 0x5c, 0xd1, 0x02,
-    0x26, 0x4f, 0xfe, 0x29, 0x01, 0xd7, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x05, 0x00, 0x00, 0x02, 0x53,
-    0x02, 0x26, 0x00, 0x15, 0x00, 0x30, 0x40, 0x2d,
-    0x0b, 0x01, 0x06, 0x01, 0x01, 0x4c, 0x03, 0x01,
-    0x01, 0x08, 0x01, 0x06, 0x05, 0x01, 0x06, 0x67,
-    0x04, 0x02, 0x02, 0x00, 0x00, 0x1c, 0x4d, 0x09,
-    0x07, 0x02, 0x05, 0x05, 0x1b, 0x05, 0x4e, 0x15,
-    0x14, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x0a, 0x07, 0x1f, 0x2b, 0x13, 0x03,
-    0x33, 0x17, 0x33, 0x35, 0x33, 0x15, 0x33, 0x37,
-    0x33, 0x03, 0x13, 0x23, 0x27, 0x23, 0x15, 0x23,
-    0x35, 0x23, 0x07, 0x23, 0x7f, 0x72, 0x5b, 0x5d,
-    0x3f, 0x50, 0x3f, 0x5d, 0x5b, 0x72, 0x7a, 0x5f,
-    0x60, 0x40, 0x50, 0x40, 0x60, 0x5f, 0x01, 0x1a,
-    0x01, 0x0c, 0xec, 0xec, 0xec, 0xec, 0xfe, 0xf7,
-    0xfe, 0xe3, 0xf6, 0xf6, 0xf6, 0xf6, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x5a, 0x00, 0x00, 0x02, 0x12,
-    0x02, 0x26, 0x00, 0x0f, 0x00, 0x18, 0x00, 0x21,
-    0x00, 0x48, 0x40, 0x45, 0x00, 0x01, 0x05, 0x04,
-    0x05, 0x01, 0x04, 0x80, 0x09, 0x01, 0x05, 0x08,
-    0x01, 0x04, 0x03, 0x05, 0x04, 0x67, 0x00, 0x06,
-    0x06, 0x00, 0x5f, 0x07, 0x01, 0x00, 0x00, 0x1c,
-    0x4d, 0x00, 0x03, 0x03, 0x02, 0x5f, 0x00, 0x02,
-    0x02, 0x1b, 0x02, 0x4e, 0x1a, 0x19, 0x10, 0x10,
-    0x01, 0x00, 0x20, 0x1e, 0x19, 0x21, 0x1a, 0x21,
-    0x10, 0x18, 0x10, 0x17, 0x13, 0x11, 0x0e, 0x0c,
-    0x06, 0x05, 0x00, 0x0f, 0x01, 0x0f, 0x0a, 0x07,
-    0x16, 0x2b, 0x01, 0x32, 0x16, 0x15, 0x14, 0x06,
-    0x07, 0x15, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x2b,
-    0x01, 0x11, 0x13, 0x15, 0x33, 0x32, 0x36, 0x35,
-    0x34, 0x26, 0x23, 0x27, 0x32, 0x36, 0x35, 0x34,
-    0x26, 0x2b, 0x01, 0x15, 0x01, 0x51, 0x56, 0x5e,
-    0x3d, 0x38, 0x3f, 0x43, 0x63, 0x5b, 0xfa, 0x59,
-    0xa1, 0x30, 0x34, 0x34, 0x30, 0x03, 0x2a, 0x30,
-    0x2f, 0x2b, 0x9e, 0x02, 0x26, 0x4d, 0x45, 0x33,
-    0x3c, 0x03, 0x06, 0x01, 0x41, 0x3d, 0x4b, 0x52,
-    0x02, 0x26, 0xfe, 0xca, 0xa1, 0x2a, 0x26, 0x27,
-    0x2a, 0x4e, 0x28, 0x24, 0x24, 0x29, 0x99, 0x00,
-    0x00, 0x01, 0x00, 0x3e, 0x00, 0x00, 0x02, 0x1a,
-    0x02, 0x26, 0x00, 0x0b, 0x00, 0x25, 0x40, 0x22,
-    0x06, 0x05, 0x03, 0x03, 0x01, 0x01, 0x1c, 0x4d,
-    0x02, 0x01, 0x00, 0x00, 0x04, 0x60, 0x00, 0x04,
-    0x04, 0x1b, 0x04, 0x4e, 0x00, 0x00, 0x00, 0x0b,
-    0x00, 0x0b, 0x11, 0x11, 0x11, 0x11, 0x11, 0x07,
-    0x07, 0x1b, 0x2b, 0x13, 0x11, 0x33, 0x11, 0x33,
-    0x11, 0x33, 0x11, 0x33, 0x11, 0x21, 0x03, 0x8e,
-    0x78, 0x4e, 0x78, 0x4e, 0xfe, 0x26, 0x02, 0x02,
-    0x26, 0xfe, 0x20, 0x01, 0xe0, 0xfe, 0x20, 0x01,
-    0xe0, 0xfd, 0xda, 0x02, 0x26, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x3c, 0xff, 0x74, 0x02, 0x35,
-    0x02, 0x26, 0x00, 0x0f, 0x00, 0x2d, 0x40, 0x2a,
-    0x00, 0x06, 0x01, 0x06, 0x54, 0x04, 0x02, 0x02,
-    0x00, 0x00, 0x1c, 0x4d, 0x05, 0x03, 0x02, 0x01,
-    0x01, 0x07, 0x60, 0x08, 0x01, 0x07, 0x07, 0x1b,
-    0x07, 0x4e, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x0f,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x09,
-    0x07, 0x1d, 0x2b, 0x33, 0x11, 0x33, 0x11, 0x33,
-    0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33,
-    0x15, 0x23, 0x35, 0x3c, 0x50, 0x77, 0x50, 0x6d,
-    0x50, 0x25, 0x50, 0x02, 0x26, 0xfe, 0x24, 0x01,
-    0xdc, 0xfe, 0x24, 0x01, 0xdc, 0xfe, 0x24, 0xd6,
-    0x8c, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x5a,
-    0x00, 0x00, 0x02, 0x26, 0x02, 0x26, 0x00, 0x0a,
-    0x00, 0x13, 0x00, 0x2a, 0x40, 0x27, 0x00, 0x01,
-    0x00, 0x04, 0x03, 0x01, 0x04, 0x67, 0x00, 0x00,
-    0x00, 0x1c, 0x4d, 0x05, 0x01, 0x03, 0x03, 0x02,
-    0x60, 0x00, 0x02, 0x02, 0x1b, 0x02, 0x4e, 0x0c,
-    0x0b, 0x12, 0x10, 0x0b, 0x13, 0x0c, 0x13, 0x24,
-    0x21, 0x10, 0x06, 0x07, 0x19, 0x2b, 0x13, 0x33,
-    0x15, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23,
-    0x21, 0x25, 0x32, 0x36, 0x35, 0x34, 0x26, 0x2b,
-    0x01, 0x15, 0x5a, 0x5a, 0xaf, 0x5e, 0x65, 0x65,
-    0x5e, 0xfe, 0xf7, 0x01, 0x04, 0x34, 0x37, 0x37,
-    0x34, 0xaa, 0x02, 0x26, 0xca, 0x5a, 0x54, 0x53,
-    0x5b, 0x52, 0x2f, 0x2d, 0x2d, 0x2f, 0xb8, 0x00,
-    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x35,
-    0x02, 0x26, 0x00, 0x0c, 0x00, 0x15, 0x00, 0x2f,
-    0x40, 0x2c, 0x00, 0x01, 0x06, 0x01, 0x05, 0x04,
-    0x01, 0x05, 0x67, 0x00, 0x03, 0x03, 0x00, 0x5f,
-    0x00, 0x00, 0x00, 0x1c, 0x4d, 0x00, 0x04, 0x04,
-    0x02, 0x5f, 0x00, 0x02, 0x02, 0x1b, 0x02, 0x4e,
-    0x0d, 0x0d, 0x0d, 0x15, 0x0d, 0x14, 0x22, 0x11,
-    0x24, 0x21, 0x10, 0x07, 0x07, 0x1b, 0x2b, 0x11,
-    0x33, 0x15, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06,
-    0x2b, 0x01, 0x11, 0x23, 0x17, 0x15, 0x33, 0x32,
-    0x36, 0x35, 0x34, 0x26, 0x23, 0xe6, 0x8b, 0x5d,
-    0x67, 0x66, 0x5e, 0xe5, 0x8c, 0xe6, 0x8a, 0x31,
-    0x37, 0x37, 0x31, 0x02, 0x26, 0xca, 0x5c, 0x52,
-    0x53, 0x5b, 0x01, 0xd6, 0xcc, 0xb8, 0x30, 0x2c,
-    0x2c, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x48,
-    0xff, 0xf6, 0x02, 0x00, 0x02, 0x30, 0x00, 0x1f,
-    0x00, 0x41, 0x40, 0x3e, 0x08, 0x01, 0x07, 0x06,
-    0x05, 0x06, 0x07, 0x05, 0x80, 0x00, 0x02, 0x04,
-    0x03, 0x04, 0x02, 0x03, 0x80, 0x00, 0x05, 0x00,
-    0x04, 0x02, 0x05, 0x04, 0x67, 0x00, 0x06, 0x06,
-    0x00, 0x61, 0x00, 0x00, 0x00, 0x23, 0x4d, 0x00,
-    0x03, 0x03, 0x01, 0x61, 0x00, 0x01, 0x01, 0x22,
-    0x01, 0x4e, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f,
-    0x23, 0x11, 0x13, 0x22, 0x12, 0x25, 0x22, 0x09,
-    0x07, 0x1d, 0x2b, 0x13, 0x3e, 0x01, 0x33, 0x32,
-    0x16, 0x1d, 0x01, 0x14, 0x06, 0x23, 0x22, 0x26,
-    0x27, 0x33, 0x1e, 0x01, 0x33, 0x32, 0x36, 0x3d,
-    0x01, 0x23, 0x35, 0x33, 0x35, 0x34, 0x26, 0x23,
-    0x22, 0x06, 0x07, 0x48, 0x0f, 0x72, 0x5b, 0x67,
-    0x75, 0x75, 0x67, 0x5b, 0x72, 0x0f, 0x5a, 0x0a,
-    0x45, 0x33, 0x3d, 0x45, 0xc5, 0xc5, 0x46, 0x3c,
-    0x33, 0x45, 0x0a, 0x01, 0x81, 0x55, 0x5a, 0x70,
-    0x62, 0x96, 0x62, 0x70, 0x5a, 0x55, 0x2d, 0x32,
-    0x48, 0x3f, 0x23, 0x50, 0x19, 0x3f, 0x48, 0x32,
-    0x2d, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x5a,
-    0xff, 0x74, 0x02, 0x3f, 0x02, 0x26, 0x00, 0x0b,
-    0x00, 0x29, 0x40, 0x26, 0x00, 0x03, 0x00, 0x03,
-    0x54, 0x06, 0x05, 0x02, 0x01, 0x01, 0x1c, 0x4d,
-    0x02, 0x01, 0x00, 0x00, 0x04, 0x60, 0x00, 0x04,
-    0x04, 0x1b, 0x04, 0x4e, 0x00, 0x00, 0x00, 0x0b,
-    0x00, 0x0b, 0x11, 0x11, 0x11, 0x11, 0x11, 0x07,
-    0x07, 0x1b, 0x2b, 0x13, 0x11, 0x33, 0x11, 0x33,
-    0x11, 0x33, 0x15, 0x23, 0x35, 0x21, 0x11, 0xb4,
-    0xe6, 0x5a, 0x4b, 0x50, 0xfe, 0x6b, 0x02, 0x26,
-    0xfe, 0x2a, 0x01, 0xd6, 0xfe, 0x2a, 0xdc, 0x8c,
-    0x02, 0x26, 0x00, 0x00, 0x00, 0x02, 0x00, 0x3e,
-    0xff, 0xf6, 0x02, 0x1c, 0x02, 0x30, 0x00, 0x15,
-    0x00, 0x23, 0x00, 0x68, 0x4b, 0xb0, 0x18, 0x50,
-    0x58, 0x40, 0x20, 0x00, 0x00, 0x00, 0x03, 0x06,
-    0x00, 0x03, 0x67, 0x00, 0x07, 0x07, 0x01, 0x61,
-    0x08, 0x05, 0x02, 0x01, 0x01, 0x23, 0x4d, 0x00,
-    0x06, 0x06, 0x02, 0x61, 0x04, 0x01, 0x02, 0x02,
-    0x22, 0x02, 0x4e, 0x1b, 0x40, 0x28, 0x00, 0x00,
-    0x00, 0x03, 0x06, 0x00, 0x03, 0x67, 0x08, 0x01,
-    0x05, 0x05, 0x1c, 0x4d, 0x00, 0x07, 0x07, 0x01,
-    0x61, 0x00, 0x01, 0x01, 0x23, 0x4d, 0x00, 0x04,
-    0x04, 0x1b, 0x4d, 0x00, 0x06, 0x06, 0x02, 0x61,
-    0x00, 0x02, 0x02, 0x22, 0x02, 0x4e, 0x59, 0x40,
-    0x12, 0x00, 0x00, 0x21, 0x1f, 0x1a, 0x18, 0x00,
-    0x15, 0x00, 0x15, 0x11, 0x13, 0x25, 0x23, 0x11,
-    0x09, 0x07, 0x1b, 0x2b, 0x13, 0x15, 0x33, 0x35,
-    0x34, 0x36, 0x33, 0x32, 0x16, 0x1d, 0x01, 0x14,
-    0x06, 0x23, 0x22, 0x26, 0x3d, 0x01, 0x23, 0x15,
-    0x23, 0x11, 0x13, 0x14, 0x16, 0x33, 0x32, 0x36,
-    0x3d, 0x01, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15,
-    0x8e, 0x58, 0x52, 0x48, 0x49, 0x53, 0x53, 0x49,
-    0x48, 0x52, 0x58, 0x50, 0xf8, 0x27, 0x23, 0x24,
-    0x28, 0x28, 0x24, 0x23, 0x27, 0x02, 0x26, 0xeb,
-    0x4b, 0x4f, 0x5b, 0x5b, 0x4f, 0xe6, 0x4f, 0x5b,
-    0x5b, 0x4f, 0x53, 0xf3, 0x02, 0x26, 0xfe, 0x7a,
-    0x30, 0x34, 0x34, 0x30, 0xe6, 0x30, 0x34, 0x34,
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x4b,
-    0x00, 0x00, 0x01, 0xfe, 0x02, 0x26, 0x00, 0x1e,
-    0x00, 0x33, 0x40, 0x30, 0x0e, 0x01, 0x02, 0x01,
-    0x18, 0x01, 0x00, 0x02, 0x02, 0x4c, 0x00, 0x02,
-    0x05, 0x01, 0x00, 0x04, 0x02, 0x00, 0x69, 0x03,
-    0x01, 0x01, 0x01, 0x1c, 0x4d, 0x00, 0x04, 0x04,
-    0x1b, 0x04, 0x4e, 0x01, 0x00, 0x12, 0x11, 0x10,
-    0x0f, 0x0a, 0x08, 0x05, 0x04, 0x00, 0x1e, 0x01,
-    0x1e, 0x06, 0x07, 0x16, 0x2b, 0x25, 0x22, 0x26,
-    0x3d, 0x01, 0x33, 0x15, 0x14, 0x16, 0x33, 0x32,
-    0x36, 0x37, 0x36, 0x37, 0x11, 0x33, 0x11, 0x23,
-    0x35, 0x34, 0x36, 0x35, 0x34, 0x37, 0x22, 0x07,
-    0x0e, 0x03, 0x01, 0x18, 0x5f, 0x6e, 0x5a, 0x46,
-    0x3c, 0x23, 0x30, 0x0f, 0x11, 0x0a, 0x5a, 0x5a,
-    0x01, 0x01, 0x01, 0x01, 0x03, 0x14, 0x23, 0x31,
-    0x9b, 0x6c, 0x5c, 0xc3, 0xc3, 0x37, 0x41, 0x0a,
-    0x05, 0x07, 0x08, 0x01, 0x1d, 0xfd, 0xda, 0x7d,
-    0x0b, 0x16, 0x09, 0x0a, 0x09, 0x01, 0x02, 0x0a,
-    0x0a, 0x08, 0x00, 0x00, 0x00, 0x03, 0x00, 0x3e,
-    0x00, 0x00, 0x02, 0x1a, 0x02, 0x26, 0x00, 0x0a,
-    0x00, 0x0e, 0x00, 0x17, 0x00, 0x31, 0x40, 0x2e,
-    0x00, 0x00, 0x00, 0x06, 0x05, 0x00, 0x06, 0x69,
-    0x03, 0x07, 0x02, 0x02, 0x02, 0x1c, 0x4d, 0x00,
-    0x05, 0x05, 0x01, 0x60, 0x04, 0x01, 0x01, 0x01,
-    0x1b, 0x01, 0x4e, 0x00, 0x00, 0x17, 0x15, 0x11,
-    0x0f, 0x0e, 0x0d, 0x0c, 0x0b, 0x00, 0x0a, 0x00,
-    0x0a, 0x24, 0x21, 0x08, 0x07, 0x18, 0x2b, 0x13,
-    0x15, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x2b,
-    0x01, 0x11, 0x21, 0x33, 0x11, 0x23, 0x25, 0x33,
-    0x32, 0x36, 0x35, 0x34, 0x26, 0x2b, 0x01, 0x92,
-    0x30, 0x5e, 0x65, 0x66, 0x5d, 0x84, 0x01, 0x88,
-    0x54, 0x54, 0xfe, 0xcc, 0x30, 0x33, 0x3c, 0x3c,
-    0x33, 0x30, 0x02, 0x26, 0xca, 0x5b, 0x53, 0x52,
-    0x5c, 0x02, 0x26, 0xfd, 0xda, 0x48, 0x37, 0x2f,
-    0x2e, 0x38, 0x00, 0x00, 0x00, 0x01, 0x00, 0x3c,
-    0xff, 0xf9, 0x02, 0x0d, 0x02, 0x2d, 0x00, 0x2f,
-    0x00, 0x4a, 0x40, 0x47, 0x09, 0x01, 0x08, 0x07,
-    0x06, 0x07, 0x08, 0x06, 0x80, 0x00, 0x01, 0x06,
-    0x05, 0x06, 0x01, 0x05, 0x80, 0x00, 0x03, 0x05,
-    0x04, 0x05, 0x03, 0x04, 0x80, 0x00, 0x06, 0x00,
-    0x05, 0x03, 0x06, 0x05, 0x67, 0x00, 0x07, 0x07,
-    0x00, 0x61, 0x00, 0x00, 0x00, 0x23, 0x4d, 0x00,
-    0x04, 0x04, 0x02, 0x61, 0x00, 0x02, 0x02, 0x22,
-    0x02, 0x4e, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x2f,
-    0x34, 0x21, 0x24, 0x32, 0x12, 0x36, 0x14, 0x34,
-    0x0a, 0x07, 0x1e, 0x2b, 0x13, 0x3e, 0x03, 0x3b,
-    0x01, 0x32, 0x16, 0x15, 0x14, 0x06, 0x07, 0x15,
-    0x1e, 0x01, 0x15, 0x14, 0x06, 0x2b, 0x01, 0x22,
-    0x26, 0x27, 0x33, 0x1e, 0x01, 0x3b, 0x01, 0x32,
-    0x36, 0x35, 0x34, 0x26, 0x2b, 0x01, 0x35, 0x33,
-    0x32, 0x36, 0x35, 0x34, 0x26, 0x2b, 0x01, 0x22,
-    0x06, 0x07, 0x41, 0x05, 0x21, 0x35, 0x44, 0x28,
-    0x3c, 0x59, 0x63, 0x40, 0x3a, 0x47, 0x40, 0x6c,
-    0x5b, 0x39, 0x58, 0x6e, 0x0b, 0x5f, 0x07, 0x3c,
-    0x2f, 0x39, 0x31, 0x37, 0x35, 0x33, 0x89, 0x86,
-    0x2e, 0x30, 0x30, 0x2d, 0x3c, 0x29, 0x39, 0x06,
-    0x01, 0x9f, 0x1f, 0x34, 0x26, 0x15, 0x51, 0x47,
-    0x32, 0x3e, 0x04, 0x04, 0x05, 0x42, 0x3e, 0x4a,
-    0x55, 0x4a, 0x3f, 0x1a, 0x1f, 0x2e, 0x25, 0x28,
-    0x2e, 0x4e, 0x2c, 0x24, 0x25, 0x28, 0x24, 0x1a,
-    0x00, 0x02, 0x00, 0x50, 0xff, 0xf6, 0x02, 0x08,
-    0x02, 0xda, 0x00, 0x1e, 0x00, 0x2c, 0x00, 0x60,
-    0x4b, 0xb0, 0x31, 0x50, 0x58, 0x40, 0x25, 0x00,
-    0x02, 0x06, 0x05, 0x06, 0x02, 0x05, 0x80, 0x00,
-    0x03, 0x00, 0x06, 0x02, 0x03, 0x06, 0x69, 0x00,
-    0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x1a,
-    0x4d, 0x00, 0x05, 0x05, 0x04, 0x61, 0x00, 0x04,
-    0x04, 0x22, 0x04, 0x4e, 0x1b, 0x40, 0x23, 0x00,
-    0x02, 0x06, 0x05, 0x06, 0x02, 0x05, 0x80, 0x00,
-    0x00, 0x00, 0x01, 0x03, 0x00, 0x01, 0x67, 0x00,
-    0x03, 0x00, 0x06, 0x02, 0x03, 0x06, 0x69, 0x00,
-    0x05, 0x05, 0x04, 0x61, 0x00, 0x04, 0x04, 0x22,
-    0x04, 0x4e, 0x59, 0x40, 0x0a, 0x25, 0x25, 0x27,
-    0x24, 0x13, 0x21, 0x24, 0x07, 0x07, 0x1d, 0x2b,
-    0x13, 0x34, 0x3e, 0x02, 0x3b, 0x01, 0x15, 0x23,
-    0x22, 0x06, 0x1d, 0x01, 0x33, 0x36, 0x37, 0x3e,
-    0x01, 0x33, 0x32, 0x16, 0x1d, 0x01, 0x14, 0x0e,
-    0x02, 0x23, 0x22, 0x26, 0x35, 0x33, 0x14, 0x16,
-    0x33, 0x32, 0x36, 0x3d, 0x01, 0x34, 0x26, 0x23,
-    0x22, 0x06, 0x15, 0x50, 0x25, 0x44, 0x63, 0x3d,
-    0x96, 0x96, 0x51, 0x5e, 0x0a, 0x08, 0x12, 0x11,
-    0x3a, 0x31, 0x59, 0x65, 0x1e, 0x39, 0x52, 0x33,
-    0x67, 0x75, 0x5a, 0x46, 0x3c, 0x3d, 0x45, 0x45,
-    0x3d, 0x3c, 0x46, 0x01, 0xbd, 0x42, 0x6a, 0x49,
-    0x28, 0x5a, 0x69, 0x5a, 0x2d, 0x1c, 0x16, 0x13,
-    0x1f, 0x6f, 0x63, 0x55, 0x32, 0x50, 0x37, 0x1e,
-    0x72, 0x65, 0x3f, 0x48, 0x48, 0x3f, 0x55, 0x3f,
-    0x48, 0x48, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x50,
-    0x00, 0x00, 0x02, 0x08, 0x02, 0x99, 0x00, 0x13,
-    0x00, 0x38, 0x40, 0x35, 0x00, 0x03, 0x02, 0x03,
-    0x85, 0x00, 0x08, 0x07, 0x08, 0x86, 0x04, 0x01,
-    0x02, 0x05, 0x01, 0x01, 0x00, 0x02, 0x01, 0x67,
-    0x06, 0x01, 0x00, 0x07, 0x07, 0x00, 0x57, 0x06,
-    0x01, 0x00, 0x00, 0x07, 0x5f, 0x09, 0x01, 0x07,
-    0x00, 0x07, 0x4f, 0x13, 0x12, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x0a, 0x06,
-    0x1f, 0x2b, 0x37, 0x33, 0x37, 0x23, 0x35, 0x33,
-    0x37, 0x33, 0x07, 0x33, 0x15, 0x23, 0x07, 0x33,
-    0x15, 0x23, 0x07, 0x23, 0x37, 0x23, 0x50, 0x89,
-    0x4a, 0xd3, 0xf8, 0x52, 0x5a, 0x52, 0x66, 0x8b,
-    0x4a, 0xd5, 0xfb, 0x4f, 0x5a, 0x4f, 0x63, 0xfa,
-    0xa0, 0x50, 0xaf, 0xaf, 0x50, 0xa0, 0x50, 0xaa,
-    0xaa, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x5f,
-    0x00, 0x00, 0x02, 0x08, 0x03, 0xb3, 0x10, 0x22,
-    0x01, 0x9e, 0x00, 0x00, 0x11, 0x02, 0x01, 0x34,
-    0x00, 0x00, 0x00, 0x41, 0x40, 0x3e, 0x08, 0x01,
-    0x06, 0x09, 0x01, 0x07, 0x00, 0x06, 0x07, 0x69,
-    0x00, 0x02, 0x00, 0x03, 0x04, 0x02, 0x03, 0x67,
-    0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00,
-    0x1a, 0x4d, 0x00, 0x04, 0x04, 0x05, 0x5f, 0x0a,
-    0x01, 0x05, 0x05, 0x1b, 0x05, 0x4e, 0x02, 0x02,
-    0x24, 0x22, 0x1e, 0x1c, 0x18, 0x16, 0x12, 0x10,
-    0x02, 0x0d, 0x02, 0x0d, 0x11, 0x11, 0x11, 0x11,
-    0x13, 0x0b, 0x07, 0x26, 0x2b, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x5f, 0x00, 0x00, 0x01, 0xf9,
-    0x02, 0xd0, 0x11, 0x02, 0x00, 0x18, 0x00, 0x00,
-    0x00, 0x29, 0x40, 0x26, 0x02, 0x01, 0x00, 0x00,
-    0x01, 0x5f, 0x00, 0x01, 0x01, 0x1a, 0x4d, 0x06,
-    0x05, 0x02, 0x03, 0x03, 0x04, 0x5f, 0x00, 0x04,
-    0x04, 0x1b, 0x04, 0x4e, 0x01, 0x01, 0x01, 0x0c,
-    0x01, 0x0c, 0x11, 0x11, 0x11, 0x11, 0x12, 0x07,
-    0x07, 0x26, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x5f,
-    0x00, 0x00, 0x01, 0xf9, 0x03, 0xb3, 0x10, 0x22,
-    0x01, 0xde, 0x00, 0x00, 0x11, 0x02, 0x01, 0x34,
-    0x00, 0x00, 0x00, 0x3b, 0x40, 0x38, 0x08, 0x01,
-    0x06, 0x09, 0x01, 0x07, 0x01, 0x06, 0x07, 0x69,
-    0x02, 0x01, 0x00, 0x00, 0x01, 0x5f, 0x00, 0x01,
-    0x01, 0x1a, 0x4d, 0x0a, 0x05, 0x02, 0x03, 0x03,
-    0x04, 0x5f, 0x00, 0x04, 0x04, 0x1b, 0x04, 0x4e,
-    0x02, 0x02, 0x24, 0x22, 0x1e, 0x1c, 0x18, 0x16,
-    0x12, 0x10, 0x02, 0x0d, 0x02, 0x0d, 0x11, 0x11,
-    0x11, 0x11, 0x13, 0x0b, 0x07, 0x26, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0x2d, 0xff, 0xf6, 0x01, 0xf4,
-    0x02, 0xd0, 0x11, 0x02, 0x00, 0x19, 0x00, 0x00,
-    0x00, 0x32, 0x40, 0x2f, 0x00, 0x04, 0x01, 0x00,
-    0x01, 0x04, 0x00, 0x80, 0x00, 0x01, 0x01, 0x02,
-    0x5f, 0x00, 0x02, 0x02, 0x1a, 0x4d, 0x05, 0x01,
-    0x00, 0x00, 0x03, 0x61, 0x00, 0x03, 0x03, 0x22,
-    0x03, 0x4e, 0x02, 0x01, 0x14, 0x13, 0x0f, 0x0d,
-    0x08, 0x07, 0x06, 0x05, 0x01, 0x16, 0x02, 0x16,
-    0x06, 0x07, 0x21, 0x2b, 0xff, 0xff, 0x00, 0x5a,
-    0x00, 0x00, 0x02, 0x21, 0x03, 0x13, 0x10, 0x22,
-    0x00, 0x99, 0x00, 0x00, 0x11, 0x02, 0x00, 0x7a,
-    0x00, 0x00, 0x00, 0x2f, 0x40, 0x2c, 0x02, 0x01,
-    0x00, 0x03, 0x01, 0x01, 0x06, 0x00, 0x01, 0x69,
-    0x00, 0x05, 0x05, 0x06, 0x5f, 0x00, 0x06, 0x06,
-    0x1c, 0x4d, 0x07, 0x01, 0x04, 0x04, 0x08, 0x5f,
-    0x00, 0x08, 0x08, 0x1b, 0x08, 0x4e, 0x11, 0x11,
-    0x11, 0x11, 0x12, 0x24, 0x24, 0x24, 0x23, 0x09,
-    0x07, 0x2a, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x55,
-    0xff, 0x5b, 0x01, 0xc7, 0x02, 0xfd, 0x11, 0x02,
-    0x00, 0x2f, 0x00, 0x00, 0x00, 0x30, 0x40, 0x2d,
-    0x06, 0x01, 0x04, 0x00, 0x05, 0x01, 0x04, 0x05,
-    0x69, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x00, 0x01,
-    0x01, 0x1c, 0x4d, 0x00, 0x03, 0x03, 0x02, 0x5f,
-    0x00, 0x02, 0x02, 0x1e, 0x02, 0x4e, 0x12, 0x11,
-    0x19, 0x16, 0x11, 0x1e, 0x12, 0x1d, 0x21, 0x25,
-    0x11, 0x11, 0x07, 0x07, 0x25, 0x2b, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x69, 0x00, 0x00, 0x02, 0x17,
-    0x03, 0x39, 0x00, 0x07, 0x00, 0x47, 0x4b, 0xb0,
-    0x0c, 0x50, 0x58, 0x40, 0x17, 0x00, 0x00, 0x03,
-    0x03, 0x00, 0x70, 0x00, 0x01, 0x01, 0x03, 0x5f,
-    0x04, 0x01, 0x03, 0x03, 0x1a, 0x4d, 0x00, 0x02,
-    0x02, 0x1b, 0x02, 0x4e, 0x1b, 0x40, 0x16, 0x00,
-    0x00, 0x03, 0x00, 0x85, 0x00, 0x01, 0x01, 0x03,
-    0x5f, 0x04, 0x01, 0x03, 0x03, 0x1a, 0x4d, 0x00,
-    0x02, 0x02, 0x1b, 0x02, 0x4e, 0x59, 0x40, 0x0c,
-    0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x11, 0x11,
-    0x11, 0x05, 0x07, 0x19, 0x2b, 0x01, 0x35, 0x33,
-    0x15, 0x21, 0x11, 0x23, 0x11, 0x01, 0xc2, 0x55,
-    0xfe, 0xac, 0x5a, 0x02, 0xd0, 0x69, 0xbb, 0xfd,
-    0x82, 0x02, 0xd0, 0x00, 0x00, 0x01, 0x00, 0x69,
-    0x00, 0x00, 0x02, 0x17, 0x02, 0x8f, 0x00, 0x07,
-    0x00, 0x47, 0x4b, 0xb0, 0x0c, 0x50, 0x58, 0x40,
-    0x17, 0x00, 0x00, 0x03, 0x03, 0x00, 0x70, 0x00,
-    0x01, 0x01, 0x03, 0x5f, 0x04, 0x01, 0x03, 0x03,
-    0x1c, 0x4d, 0x00, 0x02, 0x02, 0x1b, 0x02, 0x4e,
-    0x1b, 0x40, 0x16, 0x00, 0x00, 0x03, 0x00, 0x85,
-    0x00, 0x01, 0x01, 0x03, 0x5f, 0x04, 0x01, 0x03,
-    0x03, 0x1c, 0x4d, 0x00, 0x02, 0x02, 0x1b, 0x02,
-    0x4e, 0x59, 0x40, 0x0c, 0x00, 0x00, 0x00, 0x07,
-    0x00, 0x07, 0x11, 0x11, 0x11, 0x05, 0x07, 0x19,
-    0x2b, 0x01, 0x35, 0x33, 0x15, 0x21, 0x11, 0x23,
-    0x11, 0x01, 0xc2, 0x55, 0xfe, 0xac, 0x5a, 0x02,
-    0x26, 0x69, 0xbb, 0xfe, 0x2c, 0x02, 0x26, 0x00,
-    0xff, 0xff, 0x00, 0x69, 0x00, 0x00, 0x02, 0x17,
-    0x03, 0xb2, 0x10, 0x22, 0x01, 0xad, 0x00, 0x00,
-    0x11, 0x02, 0x01, 0x36, 0x00, 0x00, 0x00, 0x2d,
-    0x40, 0x2a, 0x00, 0x04, 0x03, 0x04, 0x85, 0x00,
-    0x03, 0x02, 0x03, 0x85, 0x00, 0x00, 0x00, 0x02,
-    0x5f, 0x05, 0x01, 0x02, 0x02, 0x1a, 0x4d, 0x00,
-    0x01, 0x01, 0x1b, 0x01, 0x4e, 0x01, 0x01, 0x0a,
-    0x09, 0x08, 0x07, 0x01, 0x06, 0x01, 0x06, 0x11,
-    0x12, 0x06, 0x07, 0x23, 0x2b, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x69, 0x00, 0x00, 0x02, 0x17,
-    0x03, 0x1c, 0x10, 0x22, 0x01, 0xc9, 0x00, 0x00,
-    0x11, 0x02, 0x00, 0x93, 0xd8, 0x00, 0x00, 0x2d,
-    0x40, 0x2a, 0x00, 0x04, 0x03, 0x04, 0x85, 0x00,
-    0x03, 0x02, 0x03, 0x85, 0x00, 0x00, 0x00, 0x02,
-    0x5f, 0x05, 0x01, 0x02, 0x02, 0x1c, 0x4d, 0x00,
-    0x01, 0x01, 0x1b, 0x01, 0x4e, 0x01, 0x01, 0x0a,
-    0x09, 0x08, 0x07, 0x01, 0x06, 0x01, 0x06, 0x11,
-    0x12, 0x06, 0x07, 0x23, 0x2b, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x5a, 0x00, 0x00, 0x02, 0x3f,
-    0x03, 0xb2, 0x10, 0x22, 0x01, 0x9f, 0x00, 0x00,
-    0x11, 0x02, 0x01, 0x36, 0x00, 0x00, 0x00, 0x33,
-    0x40, 0x30, 0x08, 0x01, 0x04, 0x01, 0x01, 0x4c,
-    0x00, 0x07, 0x06, 0x07, 0x85, 0x00, 0x06, 0x00,
-    0x06, 0x85, 0x00, 0x01, 0x00, 0x04, 0x03, 0x01,
-    0x04, 0x67, 0x02, 0x01, 0x00, 0x00, 0x1a, 0x4d,
-    0x05, 0x01, 0x03, 0x03, 0x1b, 0x03, 0x4e, 0x11,
-    0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x12, 0x08,
-    0x07, 0x29, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x5d,
-    0x00, 0x00, 0x02, 0x35, 0x03, 0x1c, 0x10, 0x22,
-    0x01, 0xca, 0x00, 0x00, 0x11, 0x02, 0x00, 0x93,
-    0xd8, 0x00, 0x00, 0x3b, 0x40, 0x38, 0x08, 0x01,
-    0x04, 0x01, 0x01, 0x4c, 0x00, 0x07, 0x06, 0x07,
-    0x85, 0x00, 0x06, 0x00, 0x06, 0x85, 0x00, 0x01,
-    0x00, 0x04, 0x03, 0x01, 0x04, 0x67, 0x02, 0x01,
-    0x00, 0x00, 0x1c, 0x4d, 0x08, 0x05, 0x02, 0x03,
-    0x03, 0x1b, 0x03, 0x4e, 0x01, 0x01, 0x11, 0x10,
-    0x0f, 0x0e, 0x01, 0x0d, 0x01, 0x0d, 0x11, 0x12,
-    0x11, 0x11, 0x12, 0x09, 0x07, 0x26, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0x28, 0x00, 0x00, 0x02, 0x30,
-    0x03, 0xac, 0x10, 0x22, 0x01, 0xbf, 0x00, 0x00,
-    0x11, 0x02, 0x01, 0x39, 0x00, 0x00, 0x00, 0x38,
-    0x40, 0x35, 0x12, 0x07, 0x02, 0x01, 0x00, 0x01,
-    0x4c, 0x05, 0x01, 0x03, 0x04, 0x03, 0x85, 0x00,
-    0x04, 0x00, 0x06, 0x00, 0x04, 0x06, 0x69, 0x07,
-    0x02, 0x02, 0x00, 0x00, 0x1a, 0x4d, 0x00, 0x01,
-    0x01, 0x1b, 0x01, 0x4e, 0x01, 0x01, 0x1f, 0x1d,
-    0x1b, 0x1a, 0x18, 0x16, 0x15, 0x14, 0x01, 0x13,
-    0x01, 0x13, 0x11, 0x1e, 0x08, 0x07, 0x23, 0x2b,
-    0xff, 0xff, 0x00, 0x32, 0xff, 0x5b, 0x02, 0x26,
-    0x03, 0x16, 0x10, 0x22, 0x01, 0xa6, 0x00, 0x00,
-    0x11, 0x02, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x3a,
-    0x40, 0x37, 0x13, 0x08, 0x02, 0x01, 0x00, 0x01,
-    0x4c, 0x05, 0x01, 0x03, 0x04, 0x03, 0x85, 0x00,
-    0x06, 0x06, 0x04, 0x61, 0x00, 0x04, 0x04, 0x1a,
-    0x4d, 0x07, 0x02, 0x02, 0x00, 0x00, 0x1c, 0x4d,
-    0x00, 0x01, 0x01, 0x1e, 0x01, 0x4e, 0x02, 0x02,
-    0x23, 0x21, 0x1d, 0x1c, 0x1a, 0x18, 0x16, 0x15,
-    0x02, 0x14, 0x02, 0x14, 0x11, 0x1f, 0x08, 0x07,
-    0x23, 0x2b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x5a,
-    0xff, 0x83, 0x01, 0xfe, 0x02, 0xd0, 0x00, 0x0b,
-    0x00, 0x4d, 0x4b, 0xb0, 0x0a, 0x50, 0x58, 0x40,
-    0x19, 0x00, 0x03, 0x02, 0x02, 0x03, 0x71, 0x06,
-    0x05, 0x02, 0x01, 0x01, 0x1a, 0x4d, 0x00, 0x00,
-    0x00, 0x02, 0x60, 0x04, 0x01, 0x02, 0x02, 0x1b,
-    0x02, 0x4e, 0x1b, 0x40, 0x18, 0x00, 0x03, 0x02,
-    0x03, 0x86, 0x06, 0x05, 0x02, 0x01, 0x01, 0x1a,
-    0x4d, 0x00, 0x00, 0x00, 0x02, 0x60, 0x04, 0x01,
-    0x02, 0x02, 0x1b, 0x02, 0x4e, 0x59, 0x40, 0x0e,
-    0x00, 0x00, 0x00, 0x0b, 0x00, 0x0b, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x07, 0x07, 0x1b, 0x2b, 0x13,
-    0x11, 0x33, 0x11, 0x33, 0x11, 0x23, 0x15, 0x23,
-    0x35, 0x23, 0x11, 0xb4, 0xf0, 0x5a, 0xa5, 0x5a,
-    0xa5, 0x02, 0xd0, 0xfd, 0x82, 0x02, 0x7e, 0xfd,
-    0x30, 0x7d, 0x7d, 0x02, 0xd0, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x5a, 0xff, 0x83, 0x01, 0xfe,
-    0x02, 0x26, 0x00, 0x0b, 0x00, 0x4d, 0x4b, 0xb0,
-    0x0a, 0x50, 0x58, 0x40, 0x19, 0x00, 0x03, 0x02,
-    0x02, 0x03, 0x71, 0x06, 0x05, 0x02, 0x01, 0x01,
-    0x1c, 0x4d, 0x00, 0x00, 0x00, 0x02, 0x60, 0x04,
-    0x01, 0x02, 0x02, 0x1b, 0x02, 0x4e, 0x1b, 0x40,
-    0x18, 0x00, 0x03, 0x02, 0x03, 0x86, 0x06, 0x05,
-    0x02, 0x01, 0x01, 0x1c, 0x4d, 0x00, 0x00, 0x00,
-    0x02, 0x60, 0x04, 0x01, 0x02, 0x02, 0x1b, 0x02,
-    0x4e, 0x59, 0x40, 0x0e, 0x00, 0x00, 0x00, 0x0b,
-    0x00, 0x0b, 0x11, 0x11, 0x11, 0x11, 0x11, 0x07,
-    0x07, 0x1b, 0x2b, 0x13, 0x11, 0x33, 0x11, 0x33,
-    0x11, 0x23, 0x15, 0x23, 0x35, 0x23, 0x11, 0xb4,
-    0xf0, 0x5a, 0xa5, 0x5a, 0xa5, 0x02, 0x26, 0xfe,
-    0x2c, 0x01, 0xd4, 0xfd, 0xda, 0x7d, 0x7d, 0x02,
-    0x26, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x35,
-    0x00, 0x00, 0x02, 0x44, 0x02, 0xd0, 0x00, 0x17,
-    0x00, 0x21, 0x00, 0x33, 0x40, 0x30, 0x03, 0x01,
-    0x01, 0x08, 0x01, 0x05, 0x07, 0x01, 0x05, 0x69,
-    0x02, 0x01, 0x00, 0x00, 0x1a, 0x4d, 0x00, 0x07,
-    0x07, 0x04, 0x60, 0x09, 0x06, 0x02, 0x04, 0x04,
-    0x1b, 0x04, 0x4e, 0x00, 0x00, 0x21, 0x1f, 0x1a,
-    0x18, 0x00, 0x17, 0x00, 0x17, 0x11, 0x29, 0x21,
-    0x11, 0x11, 0x11, 0x0a, 0x07, 0x1c, 0x2b, 0x33,
-    0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33,
-    0x32, 0x1e, 0x02, 0x1d, 0x01, 0x14, 0x0e, 0x02,
-    0x2b, 0x01, 0x11, 0x23, 0x11, 0x37, 0x33, 0x32,
-    0x36, 0x3d, 0x01, 0x34, 0x26, 0x2b, 0x01, 0x35,
-    0x50, 0x93, 0x50, 0x3c, 0x24, 0x3b, 0x2a, 0x17,
-    0x17, 0x2a, 0x3b, 0x24, 0x8c, 0x93, 0xe3, 0x3c,
-    0x24, 0x2c, 0x2c, 0x24, 0x3c, 0x02, 0xd0, 0xfe,
-    0xde, 0x01, 0x22, 0xfe, 0xde, 0x16, 0x29, 0x39,
-    0x23, 0x78, 0x23, 0x39, 0x29, 0x16, 0x01, 0x63,
-    0xfe, 0x9d, 0x4b, 0x2c, 0x24, 0x78, 0x24, 0x2c,
-    0x00, 0x02, 0x00, 0x35, 0x00, 0x00, 0x02, 0x44,
-    0x02, 0x26, 0x00, 0x17, 0x00, 0x21, 0x00, 0x32,
-    0x40, 0x2f, 0x03, 0x01, 0x01, 0x08, 0x01, 0x05,
-    0x07, 0x01, 0x05, 0x69, 0x02, 0x01, 0x00, 0x00,
-    0x1c, 0x4d, 0x09, 0x01, 0x07, 0x07, 0x04, 0x60,
-    0x06, 0x01, 0x04, 0x04, 0x1b, 0x04, 0x4e, 0x19,
-    0x18, 0x20, 0x1e, 0x18, 0x21, 0x19, 0x21, 0x11,
-    0x11, 0x29, 0x21, 0x11, 0x11, 0x10, 0x0a, 0x07,
-    0x1d, 0x2b, 0x13, 0x33, 0x15, 0x33, 0x35, 0x33,
-    0x15, 0x33, 0x32, 0x1e, 0x02, 0x1d, 0x01, 0x14,
-    0x0e, 0x02, 0x2b, 0x01, 0x11, 0x23, 0x11, 0x23,
-    0x25, 0x32, 0x36, 0x3d, 0x01, 0x34, 0x26, 0x2b,
-    0x01, 0x15, 0x35, 0x50, 0x93, 0x50, 0x3c, 0x24,
-    0x3b, 0x2a, 0x17, 0x17, 0x2a, 0x3b, 0x24, 0x8c,
-    0x93, 0x50, 0x01, 0x6f, 0x24, 0x2c, 0x2c, 0x24,
-    0x3c, 0x02, 0x26, 0xc8, 0xc8, 0xc8, 0x16, 0x29,
-    0x39, 0x23, 0x28, 0x23, 0x39, 0x29, 0x16, 0x01,
-    0x13, 0xfe, 0xed, 0x4b, 0x2c, 0x24, 0x28, 0x24,
-    0x2c, 0xc8, 0x00, 0x00, 0x00, 0x02, 0xff, 0xfb,
-    0xff, 0xfb, 0x02, 0x44, 0x02, 0xd0, 0x00, 0x1d,
-    0x00, 0x27, 0x00, 0x6a, 0x4b, 0xb0, 0x2e, 0x50,
-    0x58, 0x40, 0x20, 0x00, 0x02, 0x00, 0x07, 0x00,
-    0x02, 0x07, 0x69, 0x00, 0x04, 0x04, 0x01, 0x5f,
-    0x00, 0x01, 0x01, 0x1a, 0x4d, 0x06, 0x01, 0x00,
-    0x00, 0x03, 0x61, 0x08, 0x05, 0x02, 0x03, 0x03,
-    0x1b, 0x03, 0x4e, 0x1b, 0x40, 0x2a, 0x00, 0x02,
-    0x00, 0x07, 0x00, 0x02, 0x07, 0x69, 0x00, 0x04,
-    0x04, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x1a, 0x4d,
-    0x06, 0x01, 0x00, 0x00, 0x03, 0x5f, 0x00, 0x03,
-    0x03, 0x1b, 0x4d, 0x06, 0x01, 0x00, 0x00, 0x05,
-    0x61, 0x08, 0x01, 0x05, 0x05, 0x1b, 0x05, 0x4e,
-    0x59, 0x40, 0x12, 0x00, 0x00, 0x27, 0x25, 0x20,
-    0x1e, 0x00, 0x1d, 0x00, 0x1c, 0x11, 0x29, 0x21,
-    0x13, 0x21, 0x09, 0x07, 0x1b, 0x2b, 0x07, 0x35,
-    0x33, 0x32, 0x36, 0x37, 0x13, 0x21, 0x11, 0x33,
-    0x32, 0x1e, 0x02, 0x1d, 0x01, 0x14, 0x0e, 0x02,
-    0x2b, 0x01, 0x11, 0x23, 0x03, 0x14, 0x0e, 0x02,
-    0x23, 0x25, 0x33, 0x32, 0x36, 0x3d, 0x01, 0x34,
-    0x26, 0x2b, 0x01, 0x05, 0x12, 0x19, 0x1e, 0x01,
-    0x05, 0x01, 0x1e, 0x3c, 0x24, 0x3b, 0x2a, 0x17,
-    0x17, 0x2a, 0x3b, 0x24, 0x8c, 0x7f, 0x05, 0x0d,
-    0x20, 0x35, 0x28, 0x01, 0x5e, 0x3c, 0x24, 0x2c,
-    0x2c, 0x24, 0x3c, 0x05, 0x50, 0x43, 0x34, 0x02,
-    0x0e, 0xfe, 0xde, 0x16, 0x29, 0x39, 0x23, 0x78,
-    0x23, 0x39, 0x29, 0x16, 0x02, 0x85, 0xfe, 0x3d,
-    0x21, 0x46, 0x3a, 0x26, 0x50, 0x2c, 0x24, 0x78,
-    0x24, 0x2c, 0x00, 0x00, 0x00, 0x02, 0xff, 0xfb,
-    0xff, 0xfb, 0x02, 0x44, 0x02, 0x26, 0x00, 0x1b,
-    0x00, 0x25, 0x00, 0xa3, 0x4b, 0xb0, 0x27, 0x50,
-    0x58, 0x40, 0x21, 0x00, 0x02, 0x00, 0x07, 0x00,
-    0x02, 0x07, 0x69, 0x00, 0x04, 0x04, 0x01, 0x5f,
-    0x00, 0x01, 0x01, 0x1c, 0x4d, 0x09, 0x06, 0x02,
-    0x00, 0x00, 0x03, 0x61, 0x08, 0x05, 0x02, 0x03,
-    0x03, 0x1b, 0x03, 0x4e, 0x1b, 0x4b, 0xb0, 0x2e,
-    0x50, 0x58, 0x40, 0x2c, 0x00, 0x02, 0x00, 0x07,
-    0x00, 0x02, 0x07, 0x69, 0x00, 0x04, 0x04, 0x01,
-    0x5f, 0x00, 0x01, 0x01, 0x1c, 0x4d, 0x00, 0x00,
-    0x00, 0x03, 0x61, 0x08, 0x05, 0x02, 0x03, 0x03,
-    0x1b, 0x4d, 0x09, 0x01, 0x06, 0x06, 0x03, 0x61,
-    0x08, 0x05, 0x02, 0x03, 0x03, 0x1b, 0x03, 0x4e,
-    0x1b, 0x40, 0x29, 0x00, 0x02, 0x00, 0x07, 0x00,
-    0x02, 0x07, 0x69, 0x00, 0x04, 0x04, 0x01, 0x5f,
-    0x00, 0x01, 0x01, 0x1c, 0x4d, 0x09, 0x01, 0x06,
-    0x06, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x1b, 0x4d,
-    0x00, 0x00, 0x00, 0x05, 0x61, 0x08, 0x01, 0x05,
-    0x05, 0x1b, 0x05, 0x4e, 0x59, 0x59, 0x40, 0x16,
-    0x1d, 0x1c, 0x00, 0x00, 0x24, 0x22, 0x1c, 0x25,
-    0x1d, 0x25, 0x00, 0x1b, 0x00, 0x1a, 0x11, 0x29,
-    0x21, 0x13, 0x21, 0x0a, 0x07, 0x1b, 0x2b, 0x07,
-    0x35, 0x33, 0x32, 0x36, 0x37, 0x13, 0x21, 0x15,
-    0x33, 0x32, 0x1e, 0x02, 0x1d, 0x01, 0x14, 0x0e,
-    0x02, 0x2b, 0x01, 0x11, 0x23, 0x03, 0x0e, 0x01,
-    0x23, 0x25, 0x32, 0x36, 0x3d, 0x01, 0x34, 0x26,
-    0x2b, 0x01, 0x15, 0x05, 0x12, 0x19, 0x1e, 0x01,
-    0x04, 0x01, 0x1f, 0x3c, 0x24, 0x3b, 0x2a, 0x17,
-    0x17, 0x2a, 0x3b, 0x24, 0x8c, 0x7f, 0x03, 0x01,
-    0x4a, 0x41, 0x01, 0x9a, 0x24, 0x2c, 0x2c, 0x24,
-    0x3c, 0x05, 0x55, 0x3e, 0x34, 0x01, 0x64, 0xc8,
-    0x16, 0x29, 0x38, 0x23, 0x2a, 0x22, 0x39, 0x29,
-    0x16, 0x01, 0xd9, 0xfe, 0xe9, 0x5b, 0x6c, 0x4f,
-    0x2c, 0x24, 0x2a, 0x24, 0x2c, 0xca, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x58, 0xff, 0xf6, 0x02, 0x10,
-    0x02, 0x30, 0x11, 0x43, 0x01, 0xd5, 0x02, 0x58,
-    0x00, 0x00, 0xc0, 0x01, 0x40, 0x00, 0x00, 0x41,
-    0x40, 0x3e, 0x08, 0x01, 0x07, 0x06, 0x05, 0x06,
-    0x07, 0x05, 0x80, 0x00, 0x02, 0x04, 0x03, 0x04,
-    0x02, 0x03, 0x80, 0x00, 0x05, 0x00, 0x04, 0x02,
-    0x05, 0x04, 0x67, 0x00, 0x06, 0x06, 0x00, 0x61,
-    0x00, 0x00, 0x00, 0x23, 0x4d, 0x00, 0x03, 0x03,
-    0x01, 0x61, 0x00, 0x01, 0x01, 0x22, 0x01, 0x4e,
-    0x01, 0x01, 0x01, 0x20, 0x01, 0x20, 0x23, 0x11,
-    0x13, 0x22, 0x12, 0x25, 0x23, 0x09, 0x07, 0x28,
-    0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x56,
-    0xff, 0xf6, 0x02, 0x0e, 0x02, 0xda, 0x11, 0x43,
-    0x01, 0xbc, 0x02, 0x58, 0x00, 0x00, 0xc0, 0x01,
-    0x40, 0x00, 0x00, 0x41, 0x40, 0x3e, 0x00, 0x04,
-    0x03, 0x02, 0x03, 0x04, 0x02, 0x80, 0x08, 0x01,
-    0x07, 0x01, 0x00, 0x01, 0x07, 0x00, 0x80, 0x00,
-    0x02, 0x00, 0x01, 0x07, 0x02, 0x01, 0x67, 0x00,
-    0x03, 0x03, 0x05, 0x61, 0x00, 0x05, 0x05, 0x21,
-    0x4d, 0x00, 0x00, 0x00, 0x06, 0x61, 0x00, 0x06,
-    0x06, 0x22, 0x06, 0x4e, 0x01, 0x01, 0x01, 0x20,
-    0x01, 0x20, 0x25, 0x22, 0x12, 0x23, 0x11, 0x13,
-    0x23, 0x09, 0x07, 0x28, 0x2b, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x14, 0x00, 0x00, 0x02, 0x01,
-    0x02, 0xda, 0x00, 0x23, 0x00, 0x68, 0xb5, 0x06,
-    0x01, 0x01, 0x02, 0x01, 0x4c, 0x4b, 0xb0, 0x31,
-    0x50, 0x58, 0x40, 0x21, 0x07, 0x01, 0x05, 0x09,
-    0x08, 0x02, 0x04, 0x00, 0x05, 0x04, 0x67, 0x00,
-    0x06, 0x06, 0x1a, 0x4d, 0x00, 0x02, 0x02, 0x00,
-    0x61, 0x00, 0x00, 0x00, 0x23, 0x4d, 0x03, 0x01,
-    0x01, 0x01, 0x1b, 0x01, 0x4e, 0x1b, 0x40, 0x21,
-    0x07, 0x01, 0x05, 0x09, 0x08, 0x02, 0x04, 0x00,
-    0x05, 0x04, 0x67, 0x00, 0x02, 0x02, 0x00, 0x61,
-    0x00, 0x00, 0x00, 0x23, 0x4d, 0x00, 0x06, 0x06,
-    0x01, 0x5f, 0x03, 0x01, 0x01, 0x01, 0x1b, 0x01,
-    0x4e, 0x59, 0x40, 0x11, 0x00, 0x00, 0x00, 0x23,
-    0x00, 0x23, 0x11, 0x11, 0x11, 0x11, 0x13, 0x23,
-    0x15, 0x29, 0x0a, 0x07, 0x1e, 0x2b, 0x13, 0x15,
-    0x14, 0x06, 0x07, 0x06, 0x07, 0x33, 0x3e, 0x01,
-    0x33, 0x32, 0x1e, 0x02, 0x15, 0x11, 0x23, 0x11,
-    0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x11, 0x23,
-    0x11, 0x23, 0x35, 0x33, 0x35, 0x33, 0x15, 0x33,
-    0x15, 0xb2, 0x01, 0x01, 0x02, 0x01, 0x08, 0x0d,
-    0x4f, 0x3b, 0x29, 0x43, 0x2f, 0x1a, 0x5a, 0x40,
-    0x39, 0x39, 0x43, 0x5a, 0x44, 0x44, 0x5a, 0x66,
-    0x02, 0x58, 0x32, 0x0e, 0x21, 0x0e, 0x11, 0x11,
-    0x32, 0x37, 0x1c, 0x33, 0x47, 0x2c, 0xfe, 0x92,
-    0x01, 0x5f, 0x3f, 0x46, 0x4b, 0x40, 0xfe, 0xa7,
-    0x02, 0x58, 0x4b, 0x37, 0x37, 0x4b, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x14, 0xff, 0x5b, 0x02, 0x01,
-    0x02, 0xda, 0x00, 0x2b, 0x00, 0x7b, 0xb5, 0x0e,
-    0x01, 0x08, 0x07, 0x01, 0x4c, 0x4b, 0xb0, 0x31,
-    0x50, 0x58, 0x40, 0x2a, 0x02, 0x01, 0x00, 0x0a,
-    0x09, 0x02, 0x03, 0x04, 0x00, 0x03, 0x67, 0x00,
-    0x01, 0x01, 0x1a, 0x4d, 0x00, 0x07, 0x07, 0x04,
-    0x61, 0x00, 0x04, 0x04, 0x23, 0x4d, 0x00, 0x08,
-    0x08, 0x1b, 0x4d, 0x00, 0x06, 0x06, 0x05, 0x61,
-    0x00, 0x05, 0x05, 0x1e, 0x05, 0x4e, 0x1b, 0x40,
-    0x2a, 0x02, 0x01, 0x00, 0x0a, 0x09, 0x02, 0x03,
-    0x04, 0x00, 0x03, 0x67, 0x00, 0x07, 0x07, 0x04,
-    0x61, 0x00, 0x04, 0x04, 0x23, 0x4d, 0x00, 0x01,
-    0x01, 0x08, 0x5f, 0x00, 0x08, 0x08, 0x1b, 0x4d,
-    0x00, 0x06, 0x06, 0x05, 0x61, 0x00, 0x05, 0x05,
-    0x1e, 0x05, 0x4e, 0x59, 0x40, 0x12, 0x00, 0x00,
-    0x00, 0x2b, 0x00, 0x2b, 0x13, 0x25, 0x21, 0x27,
-    0x29, 0x11, 0x11, 0x11, 0x11, 0x0b, 0x07, 0x1f,
-    0x2b, 0x13, 0x35, 0x33, 0x35, 0x33, 0x15, 0x33,
-    0x15, 0x23, 0x15, 0x14, 0x06, 0x07, 0x06, 0x07,
-    0x33, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x17, 0x11,
-    0x14, 0x0e, 0x02, 0x2b, 0x01, 0x35, 0x33, 0x32,
-    0x36, 0x35, 0x11, 0x34, 0x26, 0x23, 0x22, 0x06,
-    0x15, 0x11, 0x23, 0x11, 0x14, 0x44, 0x5a, 0x66,
-    0x66, 0x01, 0x01, 0x02, 0x01, 0x08, 0x0d, 0x4f,
-    0x3b, 0x52, 0x60, 0x03, 0x1d, 0x36, 0x4b, 0x2f,
-    0x46, 0x46, 0x36, 0x3d, 0x40, 0x39, 0x39, 0x43,
-    0x5a, 0x02, 0x58, 0x4b, 0x37, 0x37, 0x4b, 0x32,
-    0x0e, 0x21, 0x0e, 0x11, 0x11, 0x32, 0x37, 0x67,
-    0x56, 0xfe, 0xab, 0x2c, 0x48, 0x33, 0x1c, 0x52,
-    0x3c, 0x35, 0x01, 0x41, 0x3f, 0x46, 0x45, 0x3c,
-    0xfe, 0x9d, 0x02, 0x58, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x17, 0x02, 0xd0, 0x00, 0x19,
-    0x00, 0x2e, 0x40, 0x2b, 0x15, 0x04, 0x02, 0x03,
-    0x04, 0x01, 0x4c, 0x00, 0x02, 0x00, 0x04, 0x03,
-    0x02, 0x04, 0x69, 0x06, 0x01, 0x01, 0x01, 0x00,
-    0x5f, 0x00, 0x00, 0x00, 0x1a, 0x4d, 0x05, 0x01,
-    0x03, 0x03, 0x1b, 0x03, 0x4e, 0x11, 0x13, 0x22,
-    0x15, 0x24, 0x11, 0x10, 0x07, 0x07, 0x1d, 0x2b,
-    0x11, 0x21, 0x15, 0x23, 0x15, 0x37, 0x3e, 0x01,
-    0x33, 0x32, 0x1e, 0x02, 0x15, 0x11, 0x23, 0x11,
-    0x34, 0x23, 0x22, 0x0f, 0x01, 0x11, 0x23, 0x11,
-    0x23, 0x01, 0x40, 0x78, 0x10, 0x20, 0x4d, 0x28,
-    0x26, 0x3e, 0x2d, 0x19, 0x5a, 0x5b, 0x3c, 0x32,
-    0x2c, 0x5a, 0x6e, 0x02, 0xd0, 0x4f, 0xf4, 0x13,
-    0x26, 0x29, 0x1a, 0x2f, 0x42, 0x28, 0xfe, 0xc4,
-    0x01, 0x28, 0x7b, 0x39, 0x33, 0xfe, 0xc9, 0x02,
-    0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0xff, 0x5b, 0x02, 0x17, 0x02, 0xd0, 0x00, 0x23,
-    0x00, 0x38, 0x40, 0x35, 0x1f, 0x04, 0x02, 0x06,
-    0x05, 0x01, 0x4c, 0x00, 0x02, 0x00, 0x05, 0x06,
-    0x02, 0x05, 0x69, 0x07, 0x01, 0x01, 0x01, 0x00,
-    0x5f, 0x00, 0x00, 0x00, 0x1a, 0x4d, 0x00, 0x06,
-    0x06, 0x1b, 0x4d, 0x00, 0x04, 0x04, 0x03, 0x61,
-    0x00, 0x03, 0x03, 0x1e, 0x03, 0x4e, 0x11, 0x13,
-    0x24, 0x21, 0x29, 0x24, 0x11, 0x10, 0x08, 0x07,
-    0x1e, 0x2b, 0x11, 0x21, 0x15, 0x23, 0x15, 0x37,
-    0x3e, 0x01, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x11,
-    0x14, 0x0e, 0x02, 0x2b, 0x01, 0x35, 0x33, 0x32,
-    0x36, 0x35, 0x11, 0x34, 0x23, 0x22, 0x0f, 0x01,
-    0x11, 0x23, 0x11, 0x23, 0x01, 0x40, 0x78, 0x10,
-    0x20, 0x4d, 0x28, 0x26, 0x3e, 0x2d, 0x19, 0x1d,
-    0x36, 0x4b, 0x2f, 0x46, 0x46, 0x36, 0x3d, 0x5b,
-    0x3c, 0x32, 0x2c, 0x5a, 0x6e, 0x02, 0xd0, 0x4f,
-    0xf4, 0x13, 0x26, 0x29, 0x1a, 0x2f, 0x42, 0x28,
-    0xfe, 0xe2, 0x2c, 0x48, 0x33, 0x1c, 0x52, 0x3c,
-    0x35, 0x01, 0x0a, 0x7b, 0x39, 0x33, 0xfe, 0xc9,
-    0x02, 0x81, 0x00, 0x00, 0x00, 0x04, 0x00, 0x4b,
-    0xff, 0x5b, 0x02, 0x0d, 0x02, 0xfd, 0x00, 0x0d,
-    0x00, 0x11, 0x00, 0x1f, 0x00, 0x2d, 0x00, 0x6d,
-    0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x24, 0x08,
-    0x0a, 0x02, 0x05, 0x05, 0x06, 0x61, 0x07, 0x01,
-    0x06, 0x06, 0x44, 0x4d, 0x09, 0x04, 0x02, 0x01,
-    0x01, 0x3d, 0x4d, 0x00, 0x03, 0x03, 0x3b, 0x4d,
-    0x00, 0x00, 0x00, 0x02, 0x5f, 0x00, 0x02, 0x02,
-    0x3f, 0x02, 0x4e, 0x1b, 0x40, 0x22, 0x07, 0x01,
-    0x06, 0x08, 0x0a, 0x02, 0x05, 0x01, 0x06, 0x05,
-    0x69, 0x09, 0x04, 0x02, 0x01, 0x01, 0x3d, 0x4d,
-    0x00, 0x03, 0x03, 0x3b, 0x4d, 0x00, 0x00, 0x00,
-    0x02, 0x5f, 0x00, 0x02, 0x02, 0x3f, 0x02, 0x4e,
-    0x59, 0x40, 0x19, 0x13, 0x12, 0x0e, 0x0e, 0x2c,
-    0x29, 0x25, 0x22, 0x1a, 0x17, 0x12, 0x1f, 0x13,
-    0x1e, 0x0e, 0x11, 0x0e, 0x11, 0x12, 0x25, 0x13,
-    0x20, 0x0b, 0x09, 0x1a, 0x2b, 0x17, 0x33, 0x32,
-    0x36, 0x35, 0x11, 0x33, 0x11, 0x14, 0x0e, 0x02,
-    0x2b, 0x01, 0x03, 0x11, 0x23, 0x11, 0x25, 0x22,
-    0x26, 0x35, 0x34, 0x36, 0x3b, 0x01, 0x32, 0x16,
-    0x15, 0x14, 0x06, 0x23, 0x25, 0x34, 0x36, 0x3b,
-    0x01, 0x32, 0x16, 0x15, 0x14, 0x06, 0x2b, 0x01,
-    0x22, 0x26, 0xd2, 0x55, 0x36, 0x3d, 0x5a, 0x1d,
-    0x36, 0x4b, 0x2f, 0x55, 0x0f, 0x5a, 0x01, 0x4f,
-    0x1d, 0x24, 0x24, 0x1d, 0x14, 0x1d, 0x24, 0x24,
-    0x1d, 0xfe, 0x7f, 0x24, 0x1d, 0x14, 0x1d, 0x24,
-    0x24, 0x1d, 0x14, 0x1d, 0x24, 0x53, 0x3c, 0x35,
-    0x02, 0x08, 0xfd, 0xf8, 0x2c, 0x48, 0x33, 0x1c,
-    0x02, 0xcb, 0xfd, 0xda, 0x02, 0x26, 0x5f, 0x1f,
-    0x1c, 0x1b, 0x22, 0x22, 0x1b, 0x1b, 0x20, 0x3b,
-    0x1b, 0x22, 0x22, 0x1b, 0x1b, 0x20, 0x1f, 0x00,
-    0x00, 0x02, 0x00, 0x46, 0x00, 0x00, 0x02, 0x17,
-    0x02, 0xd0, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x29,
-    0x40, 0x26, 0x00, 0x01, 0x01, 0x02, 0x5f, 0x04,
-    0x01, 0x02, 0x02, 0x3a, 0x4d, 0x00, 0x00, 0x00,
-    0x03, 0x61, 0x06, 0x05, 0x02, 0x03, 0x03, 0x3b,
-    0x03, 0x4e, 0x0e, 0x0e, 0x0e, 0x11, 0x0e, 0x11,
-    0x12, 0x23, 0x11, 0x13, 0x20, 0x07, 0x09, 0x1b,
-    0x2b, 0x25, 0x33, 0x32, 0x36, 0x35, 0x11, 0x23,
-    0x35, 0x33, 0x11, 0x14, 0x06, 0x2b, 0x02, 0x11,
-    0x33, 0x11, 0x01, 0x04, 0x3c, 0x3c, 0x41, 0x91,
-    0xeb, 0x70, 0x67, 0x3c, 0xbe, 0x5c, 0x50, 0x3f,
-    0x3a, 0x01, 0xb7, 0x50, 0xfd, 0xf9, 0x61, 0x68,
-    0x02, 0xd0, 0xfd, 0x30, 0x00, 0x02, 0xfe, 0xbb,
-    0xff, 0xab, 0x01, 0x68, 0x02, 0xee, 0x00, 0x05,
-    0x00, 0x12, 0x00, 0x39, 0x40, 0x0a, 0x0c, 0x07,
-    0x06, 0x03, 0x02, 0x05, 0x01, 0x00, 0x01, 0x4c,
-    0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x0b, 0x00,
-    0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x3c,
-    0x01, 0x4e, 0x1b, 0x40, 0x10, 0x00, 0x00, 0x01,
-    0x01, 0x00, 0x57, 0x00, 0x00, 0x00, 0x01, 0x5f,
-    0x00, 0x01, 0x00, 0x01, 0x4f, 0x59, 0xb4, 0x13,
-    0x10, 0x02, 0x09, 0x18, 0x2b, 0x01, 0x33, 0x01,
-    0x15, 0x01, 0x23, 0x13, 0x11, 0x01, 0x36, 0x37,
-    0x36, 0x37, 0x35, 0x26, 0x27, 0x2e, 0x01, 0x27,
-    0xfe, 0xbb, 0x5a, 0x02, 0x53, 0xfd, 0xad, 0x5a,
-    0x5a, 0x01, 0xbd, 0x1c, 0x17, 0x0c, 0x0b, 0x0b,
-    0x0c, 0x0b, 0x1a, 0x0e, 0x02, 0xee, 0xfe, 0x8e,
-    0x64, 0xfe, 0x93, 0x02, 0xd8, 0xfd, 0x90, 0x01,
-    0x0e, 0x11, 0x0a, 0x06, 0x05, 0x07, 0x04, 0x05,
-    0x05, 0x0d, 0x08, 0x00, 0x00, 0x02, 0xfe, 0x98,
-    0xff, 0xab, 0x01, 0x45, 0x02, 0xee, 0x00, 0x05,
-    0x00, 0x13, 0x00, 0x42, 0x40, 0x0a, 0x13, 0x0c,
-    0x06, 0x04, 0x03, 0x05, 0x00, 0x01, 0x01, 0x4c,
-    0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x0c, 0x00,
-    0x00, 0x00, 0x01, 0x5f, 0x02, 0x01, 0x01, 0x01,
-    0x3c, 0x00, 0x4e, 0x1b, 0x40, 0x12, 0x02, 0x01,
-    0x01, 0x00, 0x00, 0x01, 0x57, 0x02, 0x01, 0x01,
-    0x01, 0x00, 0x5f, 0x00, 0x00, 0x01, 0x00, 0x4f,
-    0x59, 0x40, 0x0a, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x05, 0x11, 0x03, 0x09, 0x17, 0x2b, 0x01, 0x11,
-    0x23, 0x01, 0x35, 0x01, 0x15, 0x01, 0x0e, 0x01,
-    0x07, 0x06, 0x07, 0x15, 0x16, 0x17, 0x1e, 0x01,
-    0x17, 0x01, 0x01, 0x45, 0x5a, 0xfd, 0xad, 0x02,
-    0x53, 0xfe, 0x43, 0x0e, 0x1a, 0x0b, 0x0c, 0x0b,
-    0x0b, 0x0c, 0x0b, 0x1a, 0x0e, 0x01, 0xbd, 0x02,
-    0xee, 0xfc, 0xbd, 0x01, 0x6d, 0x64, 0x01, 0x72,
-    0x68, 0xfe, 0xed, 0x08, 0x0e, 0x05, 0x06, 0x05,
-    0x07, 0x04, 0x05, 0x05, 0x0d, 0x08, 0xfe, 0xf3,
-    0x00, 0x03, 0xfc, 0xd6, 0xff, 0xab, 0x01, 0x31,
-    0x02, 0xee, 0x00, 0x05, 0x00, 0x12, 0x00, 0x16,
-    0x00, 0x48, 0x40, 0x0a, 0x12, 0x11, 0x0a, 0x03,
-    0x02, 0x05, 0x01, 0x00, 0x01, 0x4c, 0x4b, 0xb0,
-    0x17, 0x50, 0x58, 0x40, 0x0e, 0x04, 0x03, 0x02,
-    0x01, 0x01, 0x00, 0x5f, 0x02, 0x01, 0x00, 0x00,
-    0x3c, 0x01, 0x4e, 0x1b, 0x40, 0x14, 0x02, 0x01,
-    0x00, 0x01, 0x01, 0x00, 0x57, 0x02, 0x01, 0x00,
-    0x00, 0x01, 0x5f, 0x04, 0x03, 0x02, 0x01, 0x00,
-    0x01, 0x4f, 0x59, 0x40, 0x0c, 0x13, 0x13, 0x13,
-    0x16, 0x13, 0x16, 0x1f, 0x13, 0x10, 0x05, 0x09,
-    0x19, 0x2b, 0x01, 0x33, 0x01, 0x15, 0x01, 0x23,
-    0x01, 0x36, 0x37, 0x36, 0x37, 0x35, 0x26, 0x27,
-    0x2e, 0x01, 0x27, 0x01, 0x11, 0x05, 0x11, 0x33,
-    0x11, 0xfe, 0x84, 0x5a, 0x02, 0x53, 0xfd, 0xad,
-    0x5a, 0x02, 0x17, 0x1c, 0x17, 0x0c, 0x0b, 0x0b,
-    0x0c, 0x0b, 0x1a, 0x0e, 0xfe, 0x43, 0xfd, 0xf8,
-    0x5a, 0x02, 0xee, 0xfe, 0x8e, 0x64, 0xfe, 0x93,
-    0x01, 0x76, 0x11, 0x0a, 0x06, 0x05, 0x07, 0x04,
-    0x05, 0x05, 0x0d, 0x08, 0x01, 0x12, 0xfd, 0x90,
-    0x68, 0x03, 0x43, 0xfc, 0xbd, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xfc, 0x77, 0xff, 0xab, 0x00, 0xd2,
-    0x02, 0xee, 0x00, 0x05, 0x00, 0x13, 0x00, 0x17,
-    0x00, 0x48, 0x40, 0x09, 0x0e, 0x0d, 0x05, 0x00,
-    0x04, 0x01, 0x00, 0x01, 0x4c, 0x4b, 0xb0, 0x17,
-    0x50, 0x58, 0x40, 0x0e, 0x04, 0x03, 0x02, 0x01,
-    0x01, 0x00, 0x5f, 0x02, 0x01, 0x00, 0x00, 0x3c,
-    0x01, 0x4e, 0x1b, 0x40, 0x14, 0x02, 0x01, 0x00,
-    0x01, 0x01, 0x00, 0x57, 0x02, 0x01, 0x00, 0x00,
-    0x01, 0x5f, 0x04, 0x03, 0x02, 0x01, 0x00, 0x01,
-    0x4f, 0x59, 0x40, 0x0d, 0x14, 0x14, 0x14, 0x17,
-    0x14, 0x17, 0x16, 0x15, 0x11, 0x11, 0x05, 0x09,
-    0x18, 0x2b, 0x09, 0x01, 0x33, 0x11, 0x23, 0x01,
-    0x37, 0x15, 0x16, 0x17, 0x1e, 0x01, 0x17, 0x01,
-    0x11, 0x01, 0x0e, 0x01, 0x07, 0x06, 0x01, 0x11,
-    0x33, 0x11, 0xfc, 0x77, 0x02, 0x53, 0x5a, 0x5a,
-    0xfd, 0xad, 0x4c, 0x0b, 0x0c, 0x0b, 0x1a, 0x0e,
-    0x01, 0xbd, 0xfe, 0x43, 0x0e, 0x1a, 0x0b, 0x0c,
-    0x03, 0xaa, 0x5a, 0x01, 0x7c, 0x01, 0x72, 0xfc,
-    0xbd, 0x01, 0x6d, 0x35, 0x07, 0x04, 0x05, 0x05,
-    0x0d, 0x08, 0xfe, 0xf3, 0x02, 0x70, 0xfe, 0xed,
-    0x08, 0x0e, 0x05, 0x06, 0xfe, 0x59, 0x03, 0x43,
-    0xfc, 0xbd, 0x00, 0x00, 0x00, 0x04, 0xfa, 0xc9,
-    0xff, 0xab, 0x00, 0xd2, 0x02, 0xee, 0x00, 0x05,
-    0x00, 0x12, 0x00, 0x16, 0x00, 0x1a, 0x00, 0x58,
-    0x40, 0x0a, 0x12, 0x0b, 0x06, 0x03, 0x02, 0x05,
-    0x01, 0x00, 0x01, 0x4c, 0x4b, 0xb0, 0x17, 0x50,
-    0x58, 0x40, 0x11, 0x04, 0x06, 0x03, 0x03, 0x01,
-    0x01, 0x00, 0x5f, 0x07, 0x05, 0x02, 0x03, 0x00,
-    0x00, 0x3c, 0x01, 0x4e, 0x1b, 0x40, 0x19, 0x07,
-    0x05, 0x02, 0x03, 0x00, 0x01, 0x01, 0x00, 0x57,
-    0x07, 0x05, 0x02, 0x03, 0x00, 0x00, 0x01, 0x5f,
-    0x04, 0x06, 0x03, 0x03, 0x01, 0x00, 0x01, 0x4f,
-    0x59, 0x40, 0x14, 0x17, 0x17, 0x13, 0x13, 0x17,
-    0x1a, 0x17, 0x1a, 0x19, 0x18, 0x13, 0x16, 0x13,
-    0x16, 0x1f, 0x13, 0x10, 0x08, 0x09, 0x19, 0x2b,
-    0x01, 0x33, 0x01, 0x15, 0x01, 0x23, 0x37, 0x01,
-    0x36, 0x37, 0x36, 0x37, 0x35, 0x26, 0x27, 0x2e,
-    0x01, 0x27, 0x09, 0x01, 0x11, 0x33, 0x11, 0x01,
-    0x11, 0x23, 0x11, 0xfe, 0x25, 0x5a, 0x02, 0x53,
-    0xfd, 0xad, 0x5a, 0x5a, 0x01, 0xbd, 0x1c, 0x17,
-    0x0c, 0x0b, 0x0b, 0x0c, 0x0b, 0x1a, 0x0e, 0xfe,
-    0x43, 0xfd, 0xf8, 0x5a, 0xfe, 0x52, 0x5a, 0x02,
-    0xee, 0xfe, 0x8e, 0x64, 0xfe, 0x93, 0x68, 0x01,
-    0x0e, 0x11, 0x0a, 0x06, 0x05, 0x07, 0x04, 0x05,
-    0x05, 0x0d, 0x08, 0x01, 0x12, 0xfd, 0x28, 0x03,
-    0x43, 0xfc, 0xbd, 0x03, 0x43, 0xfc, 0xbd, 0x03,
-    0x43, 0x00, 0x00, 0x00, 0x00, 0x04, 0xfa, 0x7e,
-    0xff, 0xab, 0x00, 0x87, 0x02, 0xee, 0x00, 0x05,
-    0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x58,
-    0x40, 0x09, 0x0d, 0x0c, 0x05, 0x00, 0x04, 0x01,
-    0x00, 0x01, 0x4c, 0x4b, 0xb0, 0x17, 0x50, 0x58,
-    0x40, 0x11, 0x04, 0x06, 0x03, 0x03, 0x01, 0x01,
-    0x00, 0x5f, 0x07, 0x05, 0x02, 0x03, 0x00, 0x00,
-    0x3c, 0x01, 0x4e, 0x1b, 0x40, 0x19, 0x07, 0x05,
-    0x02, 0x03, 0x00, 0x01, 0x01, 0x00, 0x57, 0x07,
-    0x05, 0x02, 0x03, 0x00, 0x00, 0x01, 0x5f, 0x04,
-    0x06, 0x03, 0x03, 0x01, 0x00, 0x01, 0x4f, 0x59,
-    0x40, 0x15, 0x18, 0x18, 0x14, 0x14, 0x18, 0x1b,
-    0x18, 0x1b, 0x1a, 0x19, 0x14, 0x17, 0x14, 0x17,
-    0x16, 0x15, 0x11, 0x11, 0x08, 0x09, 0x18, 0x2b,
-    0x09, 0x01, 0x33, 0x11, 0x23, 0x01, 0x37, 0x16,
-    0x17, 0x1e, 0x01, 0x17, 0x01, 0x11, 0x01, 0x0e,
-    0x01, 0x07, 0x06, 0x07, 0x01, 0x11, 0x33, 0x11,
-    0x01, 0x11, 0x23, 0x11, 0xfa, 0x7e, 0x02, 0x53,
-    0x5a, 0x5a, 0xfd, 0xad, 0x4c, 0x0b, 0x0c, 0x0b,
-    0x1a, 0x0e, 0x01, 0xbd, 0xfe, 0x43, 0x0e, 0x1a,
-    0x0b, 0x0c, 0x0b, 0x05, 0x63, 0x5a, 0xfe, 0x52,
-    0x5a, 0x01, 0x7c, 0x01, 0x72, 0xfc, 0xbd, 0x01,
-    0x6d, 0x2e, 0x04, 0x05, 0x05, 0x0d, 0x08, 0xfe,
-    0xf3, 0x02, 0x70, 0xfe, 0xed, 0x08, 0x0e, 0x05,
-    0x06, 0x05, 0xfe, 0x5e, 0x03, 0x43, 0xfc, 0xbd,
-    0x03, 0x43, 0xfc, 0xbd, 0x03, 0x43, 0x00, 0x00,
-    0x00, 0x02, 0xfe, 0x1b, 0x00, 0x41, 0x01, 0xe5,
-    0x02, 0x53, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x1f,
-    0x40, 0x1c, 0x1d, 0x1c, 0x1b, 0x0f, 0x01, 0x00,
-    0x06, 0x00, 0x4a, 0x1f, 0x1e, 0x10, 0x04, 0x03,
-    0x02, 0x06, 0x00, 0x49, 0x01, 0x01, 0x00, 0x00,
-    0x76, 0x1b, 0x1b, 0x02, 0x09, 0x18, 0x2b, 0x13,
-    0x05, 0x15, 0x05, 0x35, 0x25, 0x3e, 0x01, 0x37,
-    0x36, 0x33, 0x35, 0x22, 0x26, 0x27, 0x25, 0x01,
-    0x25, 0x3e, 0x01, 0x37, 0x36, 0x33, 0x35, 0x22,
-    0x26, 0x27, 0x25, 0x35, 0x05, 0x15, 0x05, 0x28,
-    0x01, 0xbd, 0xfe, 0x43, 0x01, 0x45, 0x0e, 0x14,
-    0x07, 0x08, 0x06, 0x0e, 0x1c, 0x0d, 0xfe, 0xbb,
-    0xfd, 0xf3, 0x01, 0x45, 0x0e, 0x14, 0x07, 0x08,
-    0x06, 0x0e, 0x1c, 0x0d, 0xfe, 0xbb, 0x01, 0xbd,
-    0xfe, 0x43, 0x02, 0x53, 0xd7, 0x64, 0xd7, 0x5b,
-    0x9a, 0x07, 0x06, 0x01, 0x02, 0x07, 0x09, 0x06,
-    0x9e, 0xfe, 0xa2, 0x9a, 0x07, 0x06, 0x01, 0x02,
-    0x07, 0x09, 0x06, 0x9e, 0x59, 0xd7, 0x64, 0xd7,
-    0x00, 0x02, 0xfe, 0x1b, 0x00, 0x41, 0x01, 0xe5,
-    0x02, 0x53, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x20,
-    0x40, 0x1d, 0x12, 0x11, 0x10, 0x0f, 0x01, 0x00,
-    0x06, 0x00, 0x4a, 0x1f, 0x1e, 0x1d, 0x0e, 0x0d,
-    0x0c, 0x06, 0x00, 0x49, 0x01, 0x01, 0x00, 0x00,
-    0x76, 0x1a, 0x19, 0x18, 0x02, 0x09, 0x17, 0x2b,
-    0x01, 0x15, 0x05, 0x0e, 0x01, 0x07, 0x06, 0x23,
-    0x15, 0x32, 0x16, 0x17, 0x05, 0x15, 0x25, 0x35,
-    0x21, 0x25, 0x15, 0x05, 0x0e, 0x01, 0x07, 0x06,
-    0x23, 0x15, 0x32, 0x16, 0x17, 0x05, 0x15, 0x25,
-    0x01, 0xe5, 0xfe, 0xbb, 0x0e, 0x14, 0x07, 0x08,
-    0x06, 0x0f, 0x1b, 0x0d, 0x01, 0x45, 0xfe, 0x43,
-    0xfd, 0xf3, 0x01, 0xbd, 0xfe, 0xbb, 0x0e, 0x14,
-    0x07, 0x08, 0x06, 0x0f, 0x1b, 0x0d, 0x01, 0x45,
-    0xfe, 0x43, 0x02, 0x53, 0x5b, 0x9a, 0x06, 0x06,
-    0x02, 0x02, 0x07, 0x08, 0x07, 0x9e, 0x59, 0xd7,
-    0x64, 0xd7, 0x5b, 0x9a, 0x06, 0x06, 0x02, 0x02,
-    0x07, 0x08, 0x07, 0x9e, 0x59, 0xd7, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x50, 0xff, 0xf6, 0x02, 0x00,
-    0x02, 0x30, 0x00, 0x17, 0x00, 0x25, 0x00, 0x43,
-    0x40, 0x40, 0x0e, 0x08, 0x02, 0x04, 0x05, 0x01,
-    0x4c, 0x00, 0x01, 0x00, 0x05, 0x00, 0x01, 0x05,
-    0x80, 0x00, 0x02, 0x04, 0x03, 0x04, 0x02, 0x03,
-    0x80, 0x00, 0x00, 0x00, 0x05, 0x04, 0x00, 0x05,
-    0x69, 0x06, 0x01, 0x04, 0x02, 0x03, 0x04, 0x59,
-    0x06, 0x01, 0x04, 0x04, 0x03, 0x61, 0x00, 0x03,
-    0x04, 0x03, 0x51, 0x19, 0x18, 0x20, 0x1e, 0x18,
-    0x25, 0x19, 0x25, 0x24, 0x11, 0x14, 0x24, 0x07,
-    0x06, 0x1a, 0x2b, 0x13, 0x34, 0x3e, 0x02, 0x33,
-    0x32, 0x16, 0x17, 0x33, 0x35, 0x33, 0x11, 0x23,
-    0x35, 0x23, 0x0e, 0x01, 0x23, 0x22, 0x2e, 0x02,
-    0x35, 0x17, 0x32, 0x36, 0x3d, 0x01, 0x34, 0x26,
-    0x23, 0x22, 0x06, 0x1d, 0x01, 0x14, 0x16, 0x50,
-    0x1b, 0x30, 0x44, 0x2a, 0x3d, 0x50, 0x0d, 0x08,
-    0x55, 0x55, 0x08, 0x0d, 0x50, 0x3d, 0x2a, 0x44,
-    0x30, 0x1b, 0xdb, 0x38, 0x43, 0x43, 0x38, 0x3d,
-    0x44, 0x45, 0x01, 0x59, 0x32, 0x50, 0x37, 0x1e,
-    0x37, 0x32, 0x5f, 0xfd, 0xda, 0x5f, 0x32, 0x37,
-    0x1e, 0x37, 0x50, 0x32, 0x89, 0x4a, 0x3f, 0x8c,
-    0x3f, 0x4a, 0x48, 0x41, 0x8c, 0x3f, 0x4a, 0x00,
-    0xff, 0xff, 0xfc, 0x45, 0x00, 0x2d, 0x01, 0x86,
-    0x02, 0x67, 0x10, 0x23, 0x00, 0x49, 0xfb, 0x6b,
-    0x00, 0x37, 0x10, 0x23, 0x00, 0x49, 0xfd, 0x2f,
-    0x00, 0x37, 0x11, 0x03, 0x00, 0x4c, 0xff, 0x7e,
-    0x00, 0x00, 0x00, 0x47, 0x40, 0x44, 0x06, 0x01,
-    0x02, 0x07, 0x01, 0x03, 0x0b, 0x02, 0x03, 0x69,
-    0x00, 0x0a, 0x0c, 0x01, 0x0b, 0x08, 0x0a, 0x0b,
-    0x67, 0x04, 0x01, 0x00, 0x09, 0x01, 0x00, 0x59,
-    0x00, 0x08, 0x00, 0x09, 0x01, 0x08, 0x09, 0x67,
-    0x04, 0x01, 0x00, 0x00, 0x01, 0x61, 0x05, 0x01,
-    0x01, 0x00, 0x01, 0x51, 0x35, 0x35, 0x35, 0x38,
-    0x35, 0x38, 0x37, 0x36, 0x34, 0x33, 0x12, 0x24,
-    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x23, 0x0d,
-    0x09, 0x2a, 0x2b, 0x00, 0x00, 0x02, 0xfe, 0xbb,
-    0xff, 0x92, 0x01, 0x45, 0x03, 0x3e, 0x00, 0x07,
-    0x00, 0x0b, 0x00, 0x2c, 0x40, 0x29, 0x04, 0x01,
-    0x00, 0x00, 0x03, 0x02, 0x00, 0x03, 0x67, 0x00,
-    0x02, 0x01, 0x01, 0x02, 0x57, 0x00, 0x02, 0x02,
-    0x01, 0x5f, 0x06, 0x05, 0x02, 0x01, 0x02, 0x01,
-    0x4f, 0x08, 0x08, 0x08, 0x0b, 0x08, 0x0b, 0x12,
-    0x11, 0x11, 0x11, 0x10, 0x07, 0x09, 0x1b, 0x2b,
-    0x03, 0x21, 0x11, 0x21, 0x35, 0x21, 0x11, 0x21,
-    0x01, 0x11, 0x33, 0x11, 0x3c, 0x01, 0x81, 0xfe,
-    0x7f, 0x01, 0x27, 0xfe, 0xd9, 0xfe, 0xf7, 0x5a,
-    0x03, 0x3e, 0xfc, 0x54, 0x50, 0x03, 0x0c, 0xfc,
-    0xa4, 0x03, 0xac, 0xfc, 0x54, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0xfe, 0xbb, 0xff, 0x92, 0x01, 0x45,
-    0x03, 0x3e, 0x11, 0x42, 0x02, 0x04, 0x00, 0x00,
-    0xc0, 0x01, 0x40, 0x00, 0x00, 0x2c, 0x40, 0x29,
-    0x04, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x03,
-    0x67, 0x00, 0x02, 0x01, 0x01, 0x02, 0x57, 0x00,
-    0x02, 0x02, 0x01, 0x5f, 0x06, 0x05, 0x02, 0x01,
-    0x02, 0x01, 0x4f, 0x09, 0x09, 0x09, 0x0c, 0x09,
-    0x0c, 0x12, 0x11, 0x11, 0x11, 0x11, 0x07, 0x09,
-    0x26, 0x2b, 0x00, 0x00, 0xff, 0xff, 0xfe, 0x4d,
-    0xff, 0x91, 0x01, 0x45, 0x03, 0x3e, 0x11, 0x42,
-    0x02, 0x07, 0x00, 0x00, 0xc0, 0x01, 0x40, 0x00,
-    0x00, 0x47, 0x40, 0x44, 0x00, 0x05, 0x01, 0x02,
-    0x01, 0x05, 0x02, 0x80, 0x07, 0x09, 0x02, 0x00,
-    0x00, 0x06, 0x01, 0x00, 0x06, 0x67, 0x00, 0x01,
-    0x00, 0x02, 0x04, 0x01, 0x02, 0x67, 0x00, 0x04,
-    0x03, 0x03, 0x04, 0x57, 0x00, 0x04, 0x04, 0x03,
-    0x5f, 0x08, 0x01, 0x03, 0x04, 0x03, 0x4f, 0x02,
-    0x01, 0x30, 0x2f, 0x2e, 0x2d, 0x2b, 0x29, 0x21,
-    0x20, 0x1a, 0x18, 0x17, 0x15, 0x0e, 0x0c, 0x0b,
-    0x09, 0x01, 0x2c, 0x02, 0x2c, 0x0a, 0x09, 0x21,
-    0x2b, 0x00, 0x00, 0x00, 0x00, 0x02, 0xfe, 0xbb,
-    0xff, 0x91, 0x01, 0xb3, 0x03, 0x3e, 0x00, 0x2b,
-    0x00, 0x2f, 0x00, 0x47, 0x40, 0x44, 0x00, 0x05,
-    0x01, 0x02, 0x01, 0x05, 0x02, 0x80, 0x07, 0x09,
-    0x02, 0x00, 0x00, 0x06, 0x01, 0x00, 0x06, 0x67,
-    0x00, 0x01, 0x00, 0x02, 0x04, 0x01, 0x02, 0x67,
-    0x00, 0x04, 0x03, 0x03, 0x04, 0x57, 0x00, 0x04,
-    0x04, 0x03, 0x5f, 0x08, 0x01, 0x03, 0x04, 0x03,
-    0x4f, 0x01, 0x00, 0x2f, 0x2e, 0x2d, 0x2c, 0x2a,
-    0x28, 0x20, 0x1f, 0x19, 0x17, 0x16, 0x14, 0x0d,
-    0x0b, 0x0a, 0x08, 0x00, 0x2b, 0x01, 0x2b, 0x0a,
-    0x09, 0x16, 0x2b, 0x13, 0x32, 0x16, 0x1d, 0x01,
-    0x14, 0x1e, 0x02, 0x3b, 0x01, 0x15, 0x23, 0x22,
-    0x0e, 0x02, 0x1d, 0x01, 0x14, 0x06, 0x2b, 0x01,
-    0x35, 0x33, 0x32, 0x3d, 0x01, 0x34, 0x3e, 0x02,
-    0x33, 0x35, 0x22, 0x2e, 0x02, 0x3d, 0x01, 0x34,
-    0x2b, 0x01, 0x35, 0x21, 0x33, 0x11, 0x23, 0x3c,
-    0x59, 0x60, 0x07, 0x15, 0x27, 0x21, 0x5a, 0x5a,
-    0x20, 0x28, 0x15, 0x07, 0x60, 0x59, 0x78, 0x78,
-    0x5f, 0x0e, 0x1d, 0x2b, 0x1d, 0x1d, 0x2b, 0x1d,
-    0x0e, 0x5f, 0x78, 0xfe, 0xf7, 0x5a, 0x5a, 0x03,
-    0x3e, 0x57, 0x4f, 0xa4, 0x1b, 0x26, 0x18, 0x0b,
-    0x50, 0x0b, 0x18, 0x26, 0x1b, 0xa5, 0x4f, 0x57,
-    0x50, 0x56, 0xa5, 0x1b, 0x31, 0x25, 0x17, 0x05,
-    0x17, 0x27, 0x32, 0x1b, 0xa4, 0x56, 0x50, 0xfc,
-    0x54, 0x00, 0x00, 0x00, 0xff, 0xff, 0xfe, 0x93,
-    0xff, 0x92, 0x01, 0x9f, 0x03, 0x3e, 0x10, 0x23,
-    0x00, 0x55, 0xfd, 0xc1, 0x00, 0x00, 0x11, 0x02,
-    0x00, 0x4b, 0x9c, 0x0f, 0x00, 0x34, 0x40, 0x31,
-    0x1a, 0x19, 0x18, 0x12, 0x0b, 0x0a, 0x09, 0x07,
-    0x02, 0x01, 0x01, 0x4c, 0x00, 0x00, 0x00, 0x01,
-    0x02, 0x00, 0x01, 0x67, 0x00, 0x02, 0x03, 0x03,
-    0x02, 0x57, 0x00, 0x02, 0x02, 0x03, 0x5f, 0x04,
-    0x01, 0x03, 0x02, 0x03, 0x4f, 0x01, 0x01, 0x01,
-    0x08, 0x01, 0x08, 0x11, 0x11, 0x12, 0x05, 0x09,
-    0x24, 0x2b, 0x00, 0x00, 0xff, 0xff, 0xfe, 0x61,
-    0xff, 0x92, 0x01, 0x59, 0x03, 0x3e, 0x10, 0x23,
-    0x00, 0x0f, 0xfe, 0x0c, 0x00, 0x0f, 0x11, 0x02,
-    0x00, 0x63, 0xce, 0x00, 0x00, 0x37, 0x40, 0x34,
-    0x11, 0x10, 0x0f, 0x0e, 0x0d, 0x08, 0x01, 0x07,
-    0x00, 0x01, 0x01, 0x4c, 0x00, 0x02, 0x00, 0x01,
-    0x00, 0x02, 0x01, 0x67, 0x00, 0x00, 0x03, 0x03,
-    0x00, 0x57, 0x00, 0x00, 0x00, 0x03, 0x5f, 0x04,
-    0x01, 0x03, 0x00, 0x03, 0x4f, 0x12, 0x12, 0x12,
-    0x19, 0x12, 0x19, 0x18, 0x17, 0x16, 0x15, 0x14,
-    0x13, 0x05, 0x09, 0x21, 0x2b, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0xfc, 0x2a, 0xff, 0xf6, 0x01, 0xb8,
-    0x02, 0xd0, 0x00, 0x16, 0x00, 0x27, 0x00, 0x33,
-    0x00, 0x3f, 0x00, 0x4d, 0x01, 0x21, 0x4b, 0xb0,
-    0x2e, 0x50, 0x58, 0x40, 0x1b, 0x23, 0x01, 0x05,
-    0x04, 0x22, 0x01, 0x06, 0x05, 0x24, 0x1d, 0x02,
-    0x01, 0x03, 0x25, 0x01, 0x02, 0x01, 0x27, 0x01,
-    0x07, 0x02, 0x26, 0x01, 0x08, 0x09, 0x06, 0x4c,
-    0x1b, 0x40, 0x1b, 0x23, 0x01, 0x05, 0x04, 0x22,
-    0x01, 0x06, 0x05, 0x24, 0x1d, 0x02, 0x01, 0x03,
-    0x25, 0x01, 0x02, 0x01, 0x27, 0x01, 0x07, 0x02,
-    0x26, 0x01, 0x0a, 0x09, 0x06, 0x4c, 0x59, 0x4b,
-    0xb0, 0x0c, 0x50, 0x58, 0x40, 0x3b, 0x00, 0x02,
-    0x01, 0x07, 0x01, 0x02, 0x72, 0x00, 0x03, 0x00,
-    0x01, 0x02, 0x03, 0x01, 0x69, 0x00, 0x04, 0x04,
-    0x00, 0x5f, 0x00, 0x00, 0x00, 0x3a, 0x4d, 0x00,
-    0x06, 0x06, 0x05, 0x61, 0x0b, 0x01, 0x05, 0x05,
-    0x45, 0x4d, 0x00, 0x07, 0x07, 0x08, 0x61, 0x0a,
-    0x01, 0x08, 0x08, 0x43, 0x4d, 0x00, 0x09, 0x09,
-    0x08, 0x61, 0x0a, 0x01, 0x08, 0x08, 0x43, 0x08,
-    0x4e, 0x1b, 0x4b, 0xb0, 0x2e, 0x50, 0x58, 0x40,
-    0x3c, 0x00, 0x02, 0x01, 0x07, 0x01, 0x02, 0x07,
-    0x80, 0x00, 0x03, 0x00, 0x01, 0x02, 0x03, 0x01,
-    0x69, 0x00, 0x04, 0x04, 0x00, 0x5f, 0x00, 0x00,
-    0x00, 0x3a, 0x4d, 0x00, 0x06, 0x06, 0x05, 0x61,
-    0x0b, 0x01, 0x05, 0x05, 0x45, 0x4d, 0x00, 0x07,
-    0x07, 0x08, 0x61, 0x0a, 0x01, 0x08, 0x08, 0x43,
-    0x4d, 0x00, 0x09, 0x09, 0x08, 0x61, 0x0a, 0x01,
-    0x08, 0x08, 0x43, 0x08, 0x4e, 0x1b, 0x40, 0x3a,
-    0x00, 0x02, 0x01, 0x07, 0x01, 0x02, 0x07, 0x80,
-    0x00, 0x03, 0x00, 0x01, 0x02, 0x03, 0x01, 0x69,
-    0x00, 0x04, 0x04, 0x00, 0x5f, 0x00, 0x00, 0x00,
-    0x3a, 0x4d, 0x00, 0x06, 0x06, 0x05, 0x61, 0x0b,
-    0x01, 0x05, 0x05, 0x45, 0x4d, 0x00, 0x09, 0x09,
-    0x0a, 0x61, 0x00, 0x0a, 0x0a, 0x3b, 0x4d, 0x00,
-    0x07, 0x07, 0x08, 0x61, 0x00, 0x08, 0x08, 0x43,
-    0x08, 0x4e, 0x59, 0x59, 0x40, 0x18, 0x29, 0x28,
-    0x4c, 0x49, 0x45, 0x42, 0x3e, 0x3c, 0x38, 0x36,
-    0x2f, 0x2d, 0x28, 0x33, 0x29, 0x33, 0x24, 0x21,
-    0x11, 0x18, 0x20, 0x0c, 0x09, 0x1b, 0x2b, 0x01,
-    0x33, 0x32, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02,
-    0x07, 0x15, 0x23, 0x35, 0x33, 0x32, 0x36, 0x35,
-    0x34, 0x26, 0x2b, 0x01, 0x01, 0x3e, 0x01, 0x37,
-    0x36, 0x37, 0x35, 0x26, 0x27, 0x26, 0x27, 0x25,
-    0x35, 0x05, 0x15, 0x05, 0x35, 0x01, 0x32, 0x16,
-    0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34,
-    0x36, 0x03, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15,
-    0x14, 0x06, 0x23, 0x22, 0x26, 0x25, 0x34, 0x36,
-    0x3b, 0x01, 0x32, 0x16, 0x15, 0x14, 0x06, 0x2b,
-    0x01, 0x22, 0x26, 0xfd, 0xc1, 0x7d, 0x35, 0x55,
-    0x3c, 0x20, 0x1b, 0x32, 0x46, 0x2a, 0x5a, 0x32,
-    0x41, 0x4a, 0x4a, 0x42, 0x7d, 0x03, 0x7f, 0x0c,
-    0x14, 0x08, 0x08, 0x07, 0x07, 0x08, 0x11, 0x17,
-    0xfe, 0xca, 0x01, 0xae, 0xfe, 0x52, 0xfc, 0x72,
-    0x24, 0x2e, 0x2e, 0x24, 0x24, 0x2e, 0x2e, 0x2e,
-    0x2e, 0x24, 0x24, 0x2e, 0x2e, 0x24, 0x24, 0x2e,
-    0x01, 0xc4, 0x24, 0x1d, 0x14, 0x1d, 0x24, 0x24,
-    0x1d, 0x14, 0x1d, 0x24, 0x02, 0xd0, 0x1d, 0x37,
-    0x4e, 0x30, 0x2b, 0x47, 0x35, 0x1f, 0x02, 0x69,
-    0xb4, 0x42, 0x3b, 0x3b, 0x42, 0xfe, 0xb7, 0x06,
-    0x08, 0x02, 0x03, 0x01, 0x07, 0x01, 0x03, 0x03,
-    0x0c, 0x9a, 0x59, 0xd7, 0x64, 0xd7, 0x5a, 0x01,
-    0x95, 0x2d, 0x24, 0x24, 0x2d, 0x2d, 0x24, 0x24,
-    0x2d, 0xfe, 0x17, 0x24, 0x2d, 0x2d, 0x24, 0x24,
-    0x2d, 0x2d, 0x13, 0x1b, 0x22, 0x22, 0x1b, 0x1b,
-    0x20, 0x1f, 0x00, 0x00, 0xff, 0xff, 0xfe, 0xb4,
-    0xff, 0xf6, 0x01, 0x90, 0x02, 0xd0, 0x10, 0x23,
-    0x00, 0x49, 0xfd, 0xda, 0x00, 0x00, 0x11, 0x02,
-    0x00, 0x4e, 0xa6, 0x00, 0x00, 0xe1, 0x4b, 0xb0,
-    0x0c, 0x50, 0x58, 0x40, 0x3b, 0x00, 0x07, 0x06,
-    0x00, 0x06, 0x07, 0x72, 0x00, 0x08, 0x00, 0x06,
-    0x07, 0x08, 0x06, 0x69, 0x00, 0x09, 0x09, 0x0a,
-    0x5f, 0x00, 0x0a, 0x0a, 0x3a, 0x4d, 0x00, 0x03,
-    0x03, 0x02, 0x61, 0x00, 0x02, 0x02, 0x45, 0x4d,
-    0x00, 0x00, 0x00, 0x01, 0x61, 0x05, 0x01, 0x01,
-    0x01, 0x43, 0x4d, 0x0b, 0x01, 0x04, 0x04, 0x01,
-    0x61, 0x05, 0x01, 0x01, 0x01, 0x43, 0x01, 0x4e,
-    0x1b, 0x4b, 0xb0, 0x2e, 0x50, 0x58, 0x40, 0x3c,
-    0x00, 0x07, 0x06, 0x00, 0x06, 0x07, 0x00, 0x80,
-    0x00, 0x08, 0x00, 0x06, 0x07, 0x08, 0x06, 0x69,
-    0x00, 0x09, 0x09, 0x0a, 0x5f, 0x00, 0x0a, 0x0a,
-    0x3a, 0x4d, 0x00, 0x03, 0x03, 0x02, 0x61, 0x00,
-    0x02, 0x02, 0x45, 0x4d, 0x00, 0x00, 0x00, 0x01,
-    0x61, 0x05, 0x01, 0x01, 0x01, 0x43, 0x4d, 0x0b,
-    0x01, 0x04, 0x04, 0x01, 0x61, 0x05, 0x01, 0x01,
-    0x01, 0x43, 0x01, 0x4e, 0x1b, 0x40, 0x3a, 0x00,
-    0x07, 0x06, 0x00, 0x06, 0x07, 0x00, 0x80, 0x00,
-    0x08, 0x00, 0x06, 0x07, 0x08, 0x06, 0x69, 0x00,
-    0x09, 0x09, 0x0a, 0x5f, 0x00, 0x0a, 0x0a, 0x3a,
-    0x4d, 0x00, 0x03, 0x03, 0x02, 0x61, 0x00, 0x02,
-    0x02, 0x45, 0x4d, 0x0b, 0x01, 0x04, 0x04, 0x05,
-    0x61, 0x00, 0x05, 0x05, 0x3b, 0x4d, 0x00, 0x00,
-    0x00, 0x01, 0x61, 0x00, 0x01, 0x01, 0x43, 0x01,
-    0x4e, 0x59, 0x59, 0x40, 0x19, 0x1b, 0x19, 0x3a,
-    0x38, 0x37, 0x35, 0x31, 0x2f, 0x2e, 0x2d, 0x2c,
-    0x2b, 0x22, 0x1f, 0x19, 0x26, 0x1b, 0x26, 0x24,
-    0x24, 0x24, 0x23, 0x0c, 0x09, 0x25, 0x2b, 0x00,
-    0x00, 0x03, 0x00, 0x50, 0xff, 0xf6, 0x02, 0x08,
-    0x02, 0xda, 0x00, 0x15, 0x00, 0x1d, 0x00, 0x25,
-    0x00, 0x2f, 0x40, 0x2c, 0x25, 0x1d, 0x02, 0x02,
-    0x03, 0x01, 0x4c, 0x00, 0x03, 0x03, 0x01, 0x61,
-    0x00, 0x01, 0x01, 0x42, 0x4d, 0x00, 0x02, 0x02,
-    0x00, 0x61, 0x04, 0x01, 0x00, 0x00, 0x43, 0x00,
-    0x4e, 0x01, 0x00, 0x22, 0x20, 0x1a, 0x18, 0x0c,
-    0x0a, 0x00, 0x15, 0x01, 0x15, 0x05, 0x09, 0x16,
-    0x2b, 0x05, 0x22, 0x2e, 0x02, 0x35, 0x11, 0x34,
-    0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x11,
-    0x14, 0x0e, 0x02, 0x27, 0x1e, 0x01, 0x33, 0x32,
-    0x36, 0x3d, 0x01, 0x27, 0x2e, 0x01, 0x23, 0x22,
-    0x06, 0x1d, 0x01, 0x01, 0x2c, 0x33, 0x51, 0x39,
-    0x1f, 0x1f, 0x39, 0x51, 0x33, 0x33, 0x51, 0x39,
-    0x1f, 0x1f, 0x39, 0x52, 0xb3, 0x04, 0x45, 0x38,
-    0x3c, 0x46, 0x01, 0x04, 0x45, 0x38, 0x3c, 0x46,
-    0x0a, 0x1e, 0x38, 0x50, 0x31, 0x01, 0x36, 0x31,
-    0x50, 0x38, 0x1e, 0x1e, 0x38, 0x50, 0x31, 0xfe,
-    0xca, 0x31, 0x4f, 0x38, 0x1f, 0xc9, 0x38, 0x41,
-    0x49, 0x3e, 0xf1, 0x53, 0x38, 0x41, 0x49, 0x3e,
-    0xf1, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x11,
-    0xff, 0x92, 0x01, 0xea, 0x03, 0x3e, 0x00, 0x0b,
-    0x00, 0x34, 0x40, 0x31, 0x00, 0x00, 0x01, 0x00,
-    0x85, 0x06, 0x01, 0x05, 0x04, 0x05, 0x86, 0x00,
-    0x01, 0x00, 0x02, 0x03, 0x01, 0x02, 0x68, 0x00,
-    0x03, 0x04, 0x04, 0x03, 0x57, 0x00, 0x03, 0x03,
-    0x04, 0x5f, 0x00, 0x04, 0x03, 0x04, 0x4f, 0x00,
-    0x00, 0x00, 0x0b, 0x00, 0x0b, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x07, 0x09, 0x1b, 0x2b, 0x05, 0x01,
-    0x33, 0x03, 0x21, 0x15, 0x21, 0x07, 0x21, 0x15,
-    0x21, 0x03, 0xfe, 0x11, 0x01, 0x63, 0x5f, 0x80,
-    0x02, 0x97, 0xfd, 0x4a, 0x3c, 0x02, 0xf2, 0xfc,
-    0xf0, 0x6a, 0x6e, 0x03, 0xac, 0xfe, 0xac, 0x50,
-    0xa0, 0x50, 0xfe, 0xe8, 0x00, 0x04, 0xf9, 0xfc,
-    0xff, 0x92, 0x01, 0x54, 0x03, 0x3e, 0x00, 0x07,
-    0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x4b,
-    0x40, 0x48, 0x0e, 0x0b, 0x08, 0x04, 0x04, 0x00,
-    0x05, 0x0c, 0x02, 0x03, 0x02, 0x00, 0x03, 0x67,
-    0x06, 0x01, 0x02, 0x01, 0x01, 0x02, 0x57, 0x06,
-    0x01, 0x02, 0x02, 0x01, 0x5f, 0x0a, 0x0d, 0x09,
-    0x07, 0x04, 0x01, 0x02, 0x01, 0x4f, 0x14, 0x14,
-    0x10, 0x10, 0x00, 0x00, 0x14, 0x17, 0x14, 0x17,
-    0x16, 0x15, 0x10, 0x13, 0x10, 0x13, 0x12, 0x11,
-    0x0f, 0x0e, 0x0d, 0x0c, 0x0b, 0x0a, 0x09, 0x08,
-    0x00, 0x07, 0x00, 0x07, 0x11, 0x11, 0x11, 0x0f,
-    0x09, 0x19, 0x2b, 0x13, 0x35, 0x33, 0x11, 0x23,
-    0x35, 0x33, 0x11, 0x25, 0x33, 0x15, 0x23, 0x11,
-    0x33, 0x15, 0x23, 0x21, 0x11, 0x33, 0x11, 0x01,
-    0x11, 0x23, 0x11, 0x5f, 0xf5, 0xf5, 0x9b, 0xf9,
-    0x02, 0xf5, 0x9b, 0x9b, 0xf5, 0x04, 0xa1, 0x5a,
-    0xfd, 0xbc, 0x5a, 0x02, 0xee, 0x50, 0xfc, 0x54,
-    0x50, 0x03, 0x0c, 0x50, 0x50, 0xfc, 0xf4, 0x50,
-    0x03, 0xac, 0xfc, 0x54, 0x03, 0xac, 0xfc, 0x54,
-    0x03, 0xac, 0x00, 0x00, 0xff, 0xff, 0x00, 0x5a,
-    0xff, 0x5b, 0x01, 0xfe, 0x02, 0x26, 0x11, 0x02,
-    0x01, 0x69, 0x00, 0x00, 0x00, 0x2d, 0x40, 0x2a,
-    0x13, 0x01, 0x02, 0x00, 0x01, 0x4c, 0x05, 0x04,
-    0x02, 0x01, 0x01, 0x2c, 0x4d, 0x00, 0x00, 0x00,
-    0x02, 0x61, 0x00, 0x02, 0x02, 0x2d, 0x4d, 0x00,
-    0x03, 0x03, 0x2e, 0x03, 0x4e, 0x01, 0x01, 0x01,
-    0x1c, 0x01, 0x1c, 0x1b, 0x23, 0x13, 0x24, 0x06,
-    0x08, 0x25, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x5a,
-    0x00, 0x00, 0x01, 0xfe, 0x02, 0xd0, 0x11, 0x02,
-    0x01, 0xa9, 0x00, 0x00, 0x00, 0x26, 0x40, 0x23,
-    0x04, 0x03, 0x02, 0x01, 0x02, 0x01, 0x86, 0x00,
-    0x00, 0x02, 0x02, 0x00, 0x57, 0x00, 0x00, 0x00,
-    0x02, 0x5f, 0x00, 0x02, 0x00, 0x02, 0x4f, 0x01,
-    0x01, 0x01, 0x08, 0x01, 0x08, 0x11, 0x11, 0x12,
-    0x05, 0x06, 0x24, 0x2b, 0x00, 0x01, 0x00, 0x1e,
-    0xff, 0x5b, 0x02, 0x3a, 0x02, 0xda, 0x00, 0x17,
-    0x00, 0x28, 0x40, 0x25, 0x04, 0x01, 0x03, 0x00,
-    0x00, 0x02, 0x03, 0x00, 0x67, 0x00, 0x02, 0x01,
-    0x01, 0x02, 0x57, 0x00, 0x02, 0x02, 0x01, 0x5f,
-    0x00, 0x01, 0x02, 0x01, 0x4f, 0x00, 0x00, 0x00,
-    0x17, 0x00, 0x16, 0x21, 0x27, 0x21, 0x05, 0x06,
-    0x19, 0x2b, 0x01, 0x15, 0x23, 0x22, 0x06, 0x15,
-    0x11, 0x14, 0x0e, 0x02, 0x2b, 0x01, 0x35, 0x33,
-    0x32, 0x36, 0x35, 0x11, 0x34, 0x3e, 0x02, 0x33,
-    0x02, 0x3a, 0x6e, 0x36, 0x3d, 0x1d, 0x36, 0x4b,
-    0x2f, 0x6e, 0x6e, 0x36, 0x3d, 0x1d, 0x36, 0x4c,
-    0x2e, 0x02, 0xda, 0x52, 0x3b, 0x36, 0xfe, 0x07,
-    0x2c, 0x48, 0x33, 0x1c, 0x52, 0x3c, 0x35, 0x01,
-    0xfa, 0x2c, 0x48, 0x33, 0x1b, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x32, 0x00, 0x00, 0x02, 0x27,
-    0x02, 0xda, 0x00, 0x2d, 0x00, 0xc5, 0x4b, 0xb0,
-    0x09, 0x50, 0x58, 0x40, 0x24, 0x06, 0x01, 0x04,
-    0x05, 0x00, 0x00, 0x04, 0x72, 0x00, 0x01, 0x00,
-    0x05, 0x04, 0x01, 0x05, 0x69, 0x02, 0x01, 0x00,
-    0x03, 0x03, 0x00, 0x57, 0x02, 0x01, 0x00, 0x00,
-    0x03, 0x60, 0x08, 0x07, 0x02, 0x03, 0x00, 0x03,
-    0x50, 0x1b, 0x4b, 0xb0, 0x0a, 0x50, 0x58, 0x40,
-    0x28, 0x06, 0x01, 0x04, 0x05, 0x02, 0x02, 0x04,
-    0x72, 0x00, 0x01, 0x00, 0x05, 0x04, 0x01, 0x05,
-    0x69, 0x00, 0x02, 0x00, 0x03, 0x02, 0x57, 0x00,
-    0x00, 0x03, 0x03, 0x00, 0x57, 0x00, 0x00, 0x00,
-    0x03, 0x5f, 0x08, 0x07, 0x02, 0x03, 0x00, 0x03,
-    0x4f, 0x1b, 0x4b, 0xb0, 0x2a, 0x50, 0x58, 0x40,
-    0x24, 0x06, 0x01, 0x04, 0x05, 0x00, 0x00, 0x04,
-    0x72, 0x00, 0x01, 0x00, 0x05, 0x04, 0x01, 0x05,
-    0x69, 0x02, 0x01, 0x00, 0x03, 0x03, 0x00, 0x57,
-    0x02, 0x01, 0x00, 0x00, 0x03, 0x60, 0x08, 0x07,
-    0x02, 0x03, 0x00, 0x03, 0x50, 0x1b, 0x40, 0x25,
-    0x06, 0x01, 0x04, 0x05, 0x00, 0x05, 0x04, 0x00,
-    0x80, 0x00, 0x01, 0x00, 0x05, 0x04, 0x01, 0x05,
-    0x69, 0x02, 0x01, 0x00, 0x03, 0x03, 0x00, 0x57,
-    0x02, 0x01, 0x00, 0x00, 0x03, 0x60, 0x08, 0x07,
-    0x02, 0x03, 0x00, 0x03, 0x50, 0x59, 0x59, 0x59,
-    0x40, 0x10, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x2d,
-    0x15, 0x25, 0x11, 0x11, 0x2a, 0x2b, 0x11, 0x09,
-    0x06, 0x1d, 0x2b, 0x33, 0x35, 0x33, 0x35, 0x26,
-    0x27, 0x2e, 0x01, 0x35, 0x11, 0x34, 0x3e, 0x02,
-    0x33, 0x32, 0x1e, 0x02, 0x15, 0x11, 0x14, 0x06,
-    0x07, 0x06, 0x07, 0x15, 0x33, 0x15, 0x23, 0x35,
-    0x32, 0x36, 0x35, 0x11, 0x34, 0x26, 0x23, 0x22,
-    0x06, 0x15, 0x11, 0x14, 0x16, 0x33, 0x15, 0x32,
-    0x91, 0x20, 0x19, 0x16, 0x24, 0x1f, 0x39, 0x51,
-    0x33, 0x33, 0x51, 0x39, 0x1f, 0x24, 0x15, 0x1a,
-    0x20, 0x92, 0xd3, 0x28, 0x32, 0x46, 0x3c, 0x3c,
-    0x46, 0x32, 0x28, 0x50, 0x05, 0x06, 0x14, 0x11,
-    0x3f, 0x36, 0x01, 0x0e, 0x31, 0x50, 0x38, 0x1e,
-    0x1e, 0x38, 0x50, 0x31, 0xfe, 0xf2, 0x36, 0x3f,
-    0x11, 0x13, 0x06, 0x06, 0x50, 0x6e, 0x49, 0x39,
-    0x01, 0x13, 0x3e, 0x49, 0x49, 0x3e, 0xfe, 0xed,
-    0x39, 0x49, 0x6e, 0x00, 0x00, 0x02, 0x00, 0x3c,
-    0x00, 0x00, 0x02, 0x1c, 0x02, 0xd0, 0x00, 0x05,
-    0x00, 0x13, 0x00, 0x2a, 0x40, 0x27, 0x0d, 0x01,
-    0x02, 0x00, 0x01, 0x4c, 0x05, 0x02, 0x02, 0x02,
-    0x01, 0x4b, 0x00, 0x00, 0x02, 0x00, 0x85, 0x00,
-    0x02, 0x01, 0x01, 0x02, 0x57, 0x00, 0x02, 0x02,
-    0x01, 0x5f, 0x00, 0x01, 0x02, 0x01, 0x4f, 0x12,
-    0x12, 0x10, 0x03, 0x06, 0x19, 0x2b, 0x13, 0x33,
-    0x13, 0x15, 0x21, 0x35, 0x33, 0x21, 0x03, 0x2e,
-    0x01, 0x27, 0x26, 0x27, 0x23, 0x06, 0x07, 0x0e,
-    0x01, 0x07, 0xf0, 0x7e, 0xae, 0xfe, 0x20, 0x5a,
-    0x01, 0x2c, 0x80, 0x05, 0x08, 0x02, 0x02, 0x02,
-    0x04, 0x02, 0x02, 0x02, 0x08, 0x06, 0x02, 0xd0,
-    0xfd, 0x7b, 0x4b, 0x4b, 0x01, 0xe8, 0x15, 0x23,
-    0x0d, 0x0f, 0x0d, 0x0c, 0x0f, 0x0e, 0x23, 0x15,
-    0x00, 0x01, 0x00, 0x37, 0xff, 0x5b, 0x02, 0x1c,
-    0x02, 0xd0, 0x00, 0x10, 0x00, 0x2c, 0x40, 0x29,
-    0x10, 0x0f, 0x08, 0x07, 0x00, 0x05, 0x02, 0x01,
-    0x01, 0x4c, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00,
-    0x01, 0x67, 0x00, 0x02, 0x03, 0x03, 0x02, 0x57,
-    0x00, 0x02, 0x02, 0x03, 0x5f, 0x00, 0x03, 0x02,
-    0x03, 0x4f, 0x11, 0x34, 0x21, 0x11, 0x04, 0x06,
-    0x1a, 0x2b, 0x13, 0x35, 0x21, 0x15, 0x21, 0x27,
-    0x15, 0x01, 0x15, 0x01, 0x15, 0x37, 0x21, 0x15,
-    0x21, 0x35, 0x01, 0x37, 0x01, 0xe5, 0xfe, 0xd1,
-    0x48, 0x01, 0x12, 0xfe, 0xe8, 0x48, 0x01, 0x35,
-    0xfe, 0x1b, 0x01, 0x3e, 0x02, 0x7e, 0x52, 0x50,
-    0x03, 0x02, 0xfe, 0xc6, 0x67, 0xfe, 0xca, 0x02,
-    0x03, 0x50, 0x52, 0x01, 0x65, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x14, 0xff, 0xfb, 0x02, 0x3f,
-    0x02, 0x26, 0x00, 0x12, 0x00, 0x2f, 0x40, 0x2c,
-    0x04, 0x01, 0x02, 0x06, 0x00, 0x06, 0x02, 0x72,
-    0x00, 0x06, 0x06, 0x05, 0x5f, 0x00, 0x05, 0x05,
-    0x2c, 0x4d, 0x00, 0x03, 0x03, 0x2d, 0x4d, 0x00,
-    0x00, 0x00, 0x01, 0x61, 0x00, 0x01, 0x01, 0x2d,
-    0x01, 0x4e, 0x11, 0x11, 0x11, 0x11, 0x13, 0x21,
-    0x21, 0x07, 0x08, 0x1d, 0x2b, 0x25, 0x14, 0x3b,
-    0x01, 0x15, 0x23, 0x22, 0x26, 0x35, 0x11, 0x23,
-    0x11, 0x23, 0x11, 0x23, 0x35, 0x21, 0x15, 0x23,
-    0x01, 0xdb, 0x48, 0x1c, 0x17, 0x4c, 0x5b, 0xc3,
-    0x5a, 0x50, 0x02, 0x17, 0x50, 0xa4, 0x55, 0x54,
-    0x5f, 0x50, 0x01, 0x2a, 0xfe, 0x2c, 0x01, 0xd5,
-    0x51, 0x4e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1e,
-    0x00, 0x00, 0x02, 0x49, 0x02, 0xda, 0x00, 0x13,
-    0x00, 0x34, 0x40, 0x31, 0x0b, 0x01, 0x01, 0x04,
-    0x01, 0x4c, 0x00, 0x02, 0x00, 0x02, 0x85, 0x00,
-    0x00, 0x05, 0x01, 0x04, 0x01, 0x00, 0x04, 0x67,
-    0x00, 0x01, 0x03, 0x03, 0x01, 0x57, 0x00, 0x01,
-    0x01, 0x03, 0x5f, 0x00, 0x03, 0x01, 0x03, 0x4f,
-    0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x11, 0x16,
-    0x16, 0x11, 0x06, 0x06, 0x1a, 0x2b, 0x13, 0x35,
-    0x33, 0x13, 0x1e, 0x01, 0x17, 0x16, 0x15, 0x33,
-    0x34, 0x37, 0x3e, 0x01, 0x37, 0x13, 0x33, 0x03,
-    0x23, 0x03, 0x1e, 0xaf, 0x63, 0x06, 0x05, 0x01,
-    0x01, 0x09, 0x01, 0x02, 0x06, 0x06, 0xa0, 0x54,
-    0xd4, 0x69, 0x7f, 0x01, 0xd6, 0x50, 0xfe, 0x7b,
-    0x17, 0x23, 0x0d, 0x0e, 0x0b, 0x0b, 0x0f, 0x0c,
-    0x23, 0x17, 0x02, 0x39, 0xfd, 0x26, 0x01, 0xd6,
-    0x00, 0x03, 0x00, 0x23, 0x00, 0xa0, 0x02, 0x35,
-    0x01, 0xf9, 0x00, 0x1f, 0x00, 0x2e, 0x00, 0x3d,
-    0x00, 0x49, 0x40, 0x46, 0x13, 0x03, 0x02, 0x05,
-    0x04, 0x01, 0x4c, 0x01, 0x08, 0x02, 0x00, 0x0a,
-    0x06, 0x09, 0x03, 0x04, 0x05, 0x00, 0x04, 0x69,
-    0x07, 0x01, 0x05, 0x02, 0x02, 0x05, 0x59, 0x07,
-    0x01, 0x05, 0x05, 0x02, 0x61, 0x03, 0x01, 0x02,
-    0x05, 0x02, 0x51, 0x30, 0x2f, 0x21, 0x20, 0x01,
-    0x00, 0x37, 0x35, 0x2f, 0x3d, 0x30, 0x3d, 0x29,
-    0x27, 0x20, 0x2e, 0x21, 0x2e, 0x1a, 0x18, 0x11,
-    0x0f, 0x0a, 0x08, 0x00, 0x1f, 0x01, 0x1f, 0x0b,
-    0x06, 0x16, 0x2b, 0x13, 0x32, 0x16, 0x17, 0x33,
-    0x36, 0x37, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x1d,
-    0x01, 0x14, 0x06, 0x23, 0x22, 0x26, 0x27, 0x23,
-    0x06, 0x07, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x3d,
-    0x01, 0x34, 0x36, 0x05, 0x22, 0x0e, 0x02, 0x07,
-    0x17, 0x16, 0x33, 0x32, 0x36, 0x3d, 0x01, 0x34,
-    0x26, 0x21, 0x22, 0x06, 0x1d, 0x01, 0x14, 0x16,
-    0x33, 0x32, 0x3e, 0x02, 0x37, 0x27, 0x26, 0xac,
-    0x33, 0x46, 0x11, 0x03, 0x07, 0x10, 0x0e, 0x2e,
-    0x26, 0x3c, 0x47, 0x4b, 0x3e, 0x33, 0x46, 0x11,
-    0x03, 0x07, 0x10, 0x0e, 0x2e, 0x26, 0x3c, 0x47,
-    0x4b, 0x01, 0x3b, 0x1c, 0x25, 0x16, 0x09, 0x01,
-    0x1f, 0x16, 0x2c, 0x20, 0x26, 0x26, 0xfe, 0xe6,
-    0x20, 0x26, 0x26, 0x20, 0x1d, 0x24, 0x16, 0x09,
-    0x01, 0x1f, 0x16, 0x01, 0xf9, 0x33, 0x30, 0x1c,
-    0x16, 0x12, 0x1f, 0x4a, 0x3d, 0x4b, 0x3d, 0x4a,
-    0x33, 0x30, 0x1c, 0x15, 0x13, 0x1f, 0x4a, 0x3d,
-    0x4b, 0x3d, 0x4a, 0x3c, 0x18, 0x1e, 0x1d, 0x06,
-    0x54, 0x34, 0x29, 0x22, 0x4b, 0x22, 0x29, 0x29,
-    0x22, 0x4b, 0x22, 0x29, 0x18, 0x1e, 0x1d, 0x06,
-    0x54, 0x34, 0x00, 0x00, 0x00, 0x02, 0x00, 0x50,
-    0xff, 0xf6, 0x02, 0x08, 0x02, 0xda, 0x00, 0x0d,
-    0x00, 0x29, 0x00, 0x31, 0x40, 0x2e, 0x00, 0x05,
-    0x03, 0x05, 0x85, 0x00, 0x04, 0x00, 0x01, 0x00,
-    0x04, 0x01, 0x80, 0x00, 0x03, 0x00, 0x00, 0x04,
-    0x03, 0x00, 0x69, 0x00, 0x01, 0x02, 0x02, 0x01,
-    0x59, 0x00, 0x01, 0x01, 0x02, 0x61, 0x00, 0x02,
-    0x01, 0x02, 0x51, 0x16, 0x14, 0x25, 0x25, 0x25,
-    0x22, 0x06, 0x06, 0x1c, 0x2b, 0x01, 0x34, 0x26,
-    0x23, 0x22, 0x06, 0x1d, 0x01, 0x14, 0x16, 0x33,
-    0x32, 0x36, 0x35, 0x33, 0x14, 0x06, 0x23, 0x22,
-    0x26, 0x3d, 0x01, 0x34, 0x36, 0x33, 0x32, 0x16,
-    0x17, 0x16, 0x17, 0x33, 0x26, 0x27, 0x2e, 0x01,
-    0x2f, 0x01, 0x33, 0x17, 0x1e, 0x01, 0x15, 0x01,
-    0xae, 0x46, 0x3c, 0x3d, 0x45, 0x45, 0x3d, 0x3d,
-    0x45, 0x5a, 0x75, 0x67, 0x66, 0x76, 0x63, 0x5b,
-    0x2e, 0x38, 0x10, 0x12, 0x09, 0x0f, 0x05, 0x0e,
-    0x0b, 0x2b, 0x23, 0x8e, 0x6b, 0x82, 0x33, 0x34,
-    0x01, 0x19, 0x42, 0x4d, 0x4d, 0x43, 0x50, 0x3d,
-    0x45, 0x45, 0x3d, 0x62, 0x70, 0x70, 0x62, 0x51,
-    0x72, 0x69, 0x1b, 0x11, 0x14, 0x19, 0x13, 0x1a,
-    0x16, 0x3d, 0x26, 0x99, 0x8c, 0x36, 0x8c, 0x51,
-    0xff, 0xff, 0x00, 0x41, 0x00, 0x69, 0x02, 0x17,
-    0x02, 0x2b, 0x10, 0x22, 0x00, 0x8e, 0x00, 0x64,
-    0x11, 0x03, 0x00, 0x8e, 0x00, 0x00, 0xff, 0x6f,
-    0x00, 0xc1, 0x4b, 0xb0, 0x0a, 0x50, 0x58, 0x40,
-    0x46, 0x00, 0x05, 0x03, 0x01, 0x04, 0x05, 0x72,
-    0x00, 0x02, 0x04, 0x00, 0x01, 0x02, 0x72, 0x00,
-    0x0b, 0x09, 0x07, 0x0a, 0x0b, 0x72, 0x00, 0x08,
-    0x0a, 0x06, 0x07, 0x08, 0x72, 0x00, 0x03, 0x00,
-    0x01, 0x04, 0x03, 0x01, 0x69, 0x00, 0x04, 0x0c,
-    0x01, 0x00, 0x09, 0x04, 0x00, 0x6a, 0x00, 0x09,
-    0x00, 0x07, 0x0a, 0x09, 0x07, 0x69, 0x00, 0x0a,
-    0x08, 0x06, 0x0a, 0x59, 0x00, 0x0a, 0x0a, 0x06,
-    0x62, 0x0d, 0x01, 0x06, 0x0a, 0x06, 0x52, 0x1b,
-    0x40, 0x4a, 0x00, 0x05, 0x03, 0x01, 0x03, 0x05,
-    0x01, 0x80, 0x00, 0x02, 0x04, 0x00, 0x04, 0x02,
-    0x00, 0x80, 0x00, 0x0b, 0x09, 0x07, 0x09, 0x0b,
-    0x07, 0x80, 0x00, 0x08, 0x0a, 0x06, 0x0a, 0x08,
-    0x06, 0x80, 0x00, 0x03, 0x00, 0x01, 0x04, 0x03,
-    0x01, 0x69, 0x00, 0x04, 0x0c, 0x01, 0x00, 0x09,
-    0x04, 0x00, 0x6a, 0x00, 0x09, 0x00, 0x07, 0x0a,
-    0x09, 0x07, 0x69, 0x00, 0x0a, 0x08, 0x06, 0x0a,
-    0x59, 0x00, 0x0a, 0x0a, 0x06, 0x62, 0x0d, 0x01,
-    0x06, 0x0a, 0x06, 0x52, 0x59, 0x40, 0x23, 0x20,
-    0x1f, 0x02, 0x01, 0x39, 0x38, 0x36, 0x34, 0x2f,
-    0x2d, 0x2a, 0x29, 0x27, 0x25, 0x1f, 0x3c, 0x20,
-    0x3c, 0x1b, 0x1a, 0x18, 0x16, 0x11, 0x0f, 0x0c,
-    0x0b, 0x09, 0x07, 0x01, 0x1e, 0x02, 0x1e, 0x0e,
-    0x06, 0x21, 0x2b, 0x00, 0x00, 0x02, 0x00, 0x3c,
-    0x00, 0x00, 0x02, 0x1c, 0x02, 0xd0, 0x00, 0x07,
-    0x00, 0x23, 0x00, 0x20, 0x40, 0x1d, 0x23, 0x1c,
-    0x16, 0x15, 0x0e, 0x08, 0x07, 0x04, 0x03, 0x00,
-    0x0a, 0x01, 0x00, 0x01, 0x4c, 0x00, 0x00, 0x01,
-    0x00, 0x85, 0x00, 0x01, 0x01, 0x76, 0x13, 0x11,
-    0x02, 0x06, 0x18, 0x2b, 0x1b, 0x01, 0x33, 0x13,
-    0x15, 0x03, 0x23, 0x03, 0x25, 0x27, 0x2e, 0x01,
-    0x27, 0x26, 0x27, 0x23, 0x06, 0x07, 0x0e, 0x01,
-    0x0f, 0x01, 0x15, 0x17, 0x1e, 0x01, 0x17, 0x16,
-    0x17, 0x33, 0x36, 0x37, 0x3e, 0x01, 0x3f, 0x01,
-    0x3c, 0xb4, 0x7e, 0xae, 0xae, 0x7e, 0xb4, 0x01,
-    0x86, 0x62, 0x0b, 0x11, 0x07, 0x08, 0x06, 0x04,
-    0x07, 0x07, 0x07, 0x12, 0x0b, 0x63, 0x63, 0x0b,
-    0x12, 0x07, 0x08, 0x06, 0x04, 0x06, 0x08, 0x07,
-    0x11, 0x0b, 0x62, 0x01, 0x8b, 0x01, 0x45, 0xfe,
-    0xbb, 0x47, 0xfe, 0xbc, 0x01, 0x44, 0x33, 0xbc,
-    0x14, 0x23, 0x0d, 0x10, 0x0d, 0x0d, 0x10, 0x0d,
-    0x23, 0x14, 0xbc, 0x1f, 0xbb, 0x14, 0x24, 0x0d,
-    0x0f, 0x0d, 0x0d, 0x0f, 0x0e, 0x23, 0x14, 0xbb,
-    0x00, 0x02, 0x00, 0x41, 0x00, 0x00, 0x01, 0xef,
-    0x02, 0xe4, 0x00, 0x23, 0x00, 0x31, 0x00, 0x2f,
-    0x40, 0x2c, 0x31, 0x23, 0x22, 0x21, 0x18, 0x17,
-    0x0e, 0x00, 0x08, 0x01, 0x03, 0x01, 0x4c, 0x00,
-    0x00, 0x00, 0x03, 0x01, 0x00, 0x03, 0x69, 0x00,
-    0x01, 0x02, 0x02, 0x01, 0x59, 0x00, 0x01, 0x01,
-    0x02, 0x61, 0x00, 0x02, 0x01, 0x02, 0x51, 0x2e,
-    0x29, 0x2c, 0x23, 0x04, 0x06, 0x1a, 0x2b, 0x13,
-    0x11, 0x34, 0x36, 0x33, 0x32, 0x16, 0x1d, 0x01,
-    0x14, 0x0e, 0x02, 0x0f, 0x01, 0x15, 0x14, 0x16,
-    0x33, 0x32, 0x36, 0x37, 0x36, 0x37, 0x17, 0x06,
-    0x07, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x3d, 0x01,
-    0x07, 0x27, 0x37, 0x3e, 0x03, 0x35, 0x27, 0x2e,
-    0x01, 0x23, 0x22, 0x06, 0x1d, 0x01, 0xa7, 0x55,
-    0x46, 0x46, 0x55, 0x18, 0x2d, 0x3e, 0x26, 0x33,
-    0x28, 0x23, 0x15, 0x23, 0x0d, 0x0e, 0x0c, 0x44,
-    0x10, 0x17, 0x14, 0x3e, 0x2a, 0x4d, 0x58, 0x48,
-    0x1e, 0xd7, 0x19, 0x28, 0x1c, 0x0f, 0x01, 0x01,
-    0x23, 0x1d, 0x1d, 0x24, 0x01, 0x46, 0x01, 0x03,
-    0x46, 0x55, 0x55, 0x46, 0x36, 0x27, 0x4b, 0x3f,
-    0x31, 0x0f, 0x14, 0x6e, 0x25, 0x29, 0x13, 0x0c,
-    0x0d, 0x11, 0x2a, 0x1c, 0x16, 0x14, 0x1f, 0x55,
-    0x4b, 0x4b, 0x1c, 0x51, 0x51, 0x09, 0x21, 0x2a,
-    0x32, 0x1b, 0x37, 0x21, 0x28, 0x28, 0x21, 0xe1,
-    0x00, 0x02, 0x00, 0x3c, 0xff, 0xf6, 0x02, 0x1c,
-    0x02, 0xda, 0x00, 0x22, 0x00, 0x2f, 0x00, 0x51,
-    0x40, 0x4e, 0x2e, 0x24, 0x02, 0x06, 0x05, 0x13,
-    0x01, 0x03, 0x04, 0x02, 0x4c, 0x00, 0x04, 0x02,
-    0x03, 0x02, 0x04, 0x03, 0x80, 0x00, 0x01, 0x00,
-    0x05, 0x06, 0x01, 0x05, 0x69, 0x08, 0x01, 0x06,
-    0x00, 0x02, 0x04, 0x06, 0x02, 0x67, 0x00, 0x03,
-    0x00, 0x00, 0x03, 0x59, 0x00, 0x03, 0x03, 0x00,
-    0x61, 0x07, 0x01, 0x00, 0x03, 0x00, 0x51, 0x23,
-    0x23, 0x01, 0x00, 0x23, 0x2f, 0x23, 0x2f, 0x2a,
-    0x28, 0x1e, 0x1d, 0x19, 0x17, 0x12, 0x11, 0x0c,
-    0x0a, 0x00, 0x22, 0x01, 0x22, 0x09, 0x06, 0x16,
-    0x2b, 0x05, 0x22, 0x2e, 0x02, 0x3d, 0x01, 0x34,
-    0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x1d, 0x01,
-    0x21, 0x11, 0x16, 0x17, 0x1e, 0x01, 0x33, 0x32,
-    0x3e, 0x02, 0x37, 0x33, 0x0e, 0x03, 0x13, 0x35,
-    0x26, 0x27, 0x2e, 0x01, 0x23, 0x22, 0x06, 0x07,
-    0x06, 0x07, 0x15, 0x01, 0x2c, 0x36, 0x58, 0x3f,
-    0x23, 0x23, 0x3f, 0x58, 0x36, 0x36, 0x59, 0x3f,
-    0x22, 0xfe, 0x84, 0x0c, 0x14, 0x11, 0x35, 0x26,
-    0x1e, 0x37, 0x2e, 0x24, 0x0a, 0x32, 0x0c, 0x2d,
-    0x3b, 0x48, 0x65, 0x0c, 0x14, 0x11, 0x35, 0x26,
-    0x26, 0x35, 0x11, 0x14, 0x0c, 0x0a, 0x26, 0x44,
-    0x60, 0x3a, 0xdc, 0x3a, 0x60, 0x44, 0x26, 0x25,
-    0x44, 0x60, 0x3b, 0x6f, 0xfe, 0xfd, 0x12, 0x0e,
-    0x0d, 0x14, 0x10, 0x1d, 0x28, 0x19, 0x23, 0x39,
-    0x29, 0x16, 0x01, 0xa3, 0xd3, 0x12, 0x0f, 0x0c,
-    0x14, 0x14, 0x0c, 0x0f, 0x12, 0xd3, 0x00, 0x00,
-    0xff, 0xff, 0xfe, 0xc5, 0xff, 0xfb, 0x01, 0x3b,
-    0x02, 0xd0, 0x10, 0x23, 0x00, 0x4d, 0xfd, 0xe4,
-    0x00, 0x00, 0x11, 0x02, 0x00, 0x4d, 0xc4, 0x00,
-    0x00, 0x37, 0x40, 0x34, 0x05, 0x01, 0x01, 0x01,
-    0x00, 0x5f, 0x04, 0x01, 0x00, 0x00, 0x3a, 0x4d,
-    0x09, 0x06, 0x08, 0x03, 0x02, 0x02, 0x03, 0x61,
-    0x07, 0x01, 0x03, 0x03, 0x3b, 0x03, 0x4e, 0x1d,
-    0x1b, 0x09, 0x07, 0x24, 0x21, 0x1b, 0x28, 0x1d,
-    0x28, 0x19, 0x18, 0x16, 0x15, 0x10, 0x0d, 0x07,
-    0x14, 0x09, 0x14, 0x12, 0x11, 0x0a, 0x09, 0x23,
-    0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0xfe, 0x95,
-    0xff, 0xf6, 0x01, 0x4c, 0x02, 0xd0, 0x10, 0x23,
-    0x00, 0x4e, 0xfe, 0x0e, 0x00, 0x00, 0x11, 0x02,
-    0x00, 0x49, 0xce, 0x00, 0x00, 0xe5, 0x4b, 0xb0,
-    0x0c, 0x50, 0x58, 0x40, 0x3b, 0x00, 0x03, 0x02,
-    0x07, 0x02, 0x03, 0x72, 0x00, 0x04, 0x00, 0x02,
-    0x03, 0x04, 0x02, 0x69, 0x00, 0x05, 0x05, 0x06,
-    0x5f, 0x00, 0x06, 0x06, 0x3a, 0x4d, 0x00, 0x0a,
-    0x0a, 0x09, 0x61, 0x00, 0x09, 0x09, 0x45, 0x4d,
-    0x00, 0x07, 0x07, 0x01, 0x61, 0x08, 0x01, 0x01,
-    0x01, 0x3b, 0x4d, 0x0b, 0x01, 0x00, 0x00, 0x01,
-    0x61, 0x08, 0x01, 0x01, 0x01, 0x3b, 0x01, 0x4e,
-    0x1b, 0x4b, 0xb0, 0x2e, 0x50, 0x58, 0x40, 0x3c,
-    0x00, 0x03, 0x02, 0x07, 0x02, 0x03, 0x07, 0x80,
-    0x00, 0x04, 0x00, 0x02, 0x03, 0x04, 0x02, 0x69,
-    0x00, 0x05, 0x05, 0x06, 0x5f, 0x00, 0x06, 0x06,
-    0x3a, 0x4d, 0x00, 0x0a, 0x0a, 0x09, 0x61, 0x00,
-    0x09, 0x09, 0x45, 0x4d, 0x00, 0x07, 0x07, 0x01,
-    0x61, 0x08, 0x01, 0x01, 0x01, 0x3b, 0x4d, 0x0b,
-    0x01, 0x00, 0x00, 0x01, 0x61, 0x08, 0x01, 0x01,
-    0x01, 0x3b, 0x01, 0x4e, 0x1b, 0x40, 0x3a, 0x00,
-    0x03, 0x02, 0x07, 0x02, 0x03, 0x07, 0x80, 0x00,
-    0x04, 0x00, 0x02, 0x03, 0x04, 0x02, 0x69, 0x00,
-    0x05, 0x05, 0x06, 0x5f, 0x00, 0x06, 0x06, 0x3a,
-    0x4d, 0x00, 0x0a, 0x0a, 0x09, 0x61, 0x00, 0x09,
-    0x09, 0x45, 0x4d, 0x0b, 0x01, 0x00, 0x00, 0x01,
-    0x61, 0x00, 0x01, 0x01, 0x3b, 0x4d, 0x00, 0x07,
-    0x07, 0x08, 0x61, 0x00, 0x08, 0x08, 0x43, 0x08,
-    0x4e, 0x59, 0x59, 0x40, 0x1d, 0x03, 0x01, 0x3c,
-    0x3a, 0x36, 0x34, 0x30, 0x2e, 0x2a, 0x28, 0x22,
-    0x20, 0x1f, 0x1d, 0x19, 0x17, 0x16, 0x15, 0x14,
-    0x13, 0x0a, 0x07, 0x01, 0x0e, 0x03, 0x0e, 0x0c,
-    0x09, 0x21, 0x2b, 0x00, 0xff, 0xff, 0xfe, 0x95,
-    0xff, 0xf6, 0x01, 0x31, 0x02, 0xd0, 0x10, 0x23,
-    0x00, 0x4e, 0xfe, 0x0e, 0x00, 0x00, 0x11, 0x02,
-    0x00, 0x29, 0xaf, 0x00, 0x00, 0xc3, 0x4b, 0xb0,
-    0x0c, 0x50, 0x58, 0x40, 0x31, 0x00, 0x03, 0x02,
-    0x07, 0x02, 0x03, 0x72, 0x00, 0x04, 0x00, 0x02,
-    0x03, 0x04, 0x02, 0x69, 0x00, 0x05, 0x05, 0x06,
-    0x5f, 0x00, 0x06, 0x06, 0x3a, 0x4d, 0x00, 0x07,
-    0x07, 0x01, 0x61, 0x08, 0x01, 0x01, 0x01, 0x3b,
-    0x4d, 0x09, 0x01, 0x00, 0x00, 0x01, 0x61, 0x08,
-    0x01, 0x01, 0x01, 0x3b, 0x01, 0x4e, 0x1b, 0x4b,
-    0xb0, 0x2e, 0x50, 0x58, 0x40, 0x32, 0x00, 0x03,
-    0x02, 0x07, 0x02, 0x03, 0x07, 0x80, 0x00, 0x04,
-    0x00, 0x02, 0x03, 0x04, 0x02, 0x69, 0x00, 0x05,
-    0x05, 0x06, 0x5f, 0x00, 0x06, 0x06, 0x3a, 0x4d,
-    0x00, 0x07, 0x07, 0x01, 0x61, 0x08, 0x01, 0x01,
-    0x01, 0x3b, 0x4d, 0x09, 0x01, 0x00, 0x00, 0x01,
-    0x61, 0x08, 0x01, 0x01, 0x01, 0x3b, 0x01, 0x4e,
-    0x1b, 0x40, 0x30, 0x00, 0x03, 0x02, 0x07, 0x02,
-    0x03, 0x07, 0x80, 0x00, 0x04, 0x00, 0x02, 0x03,
-    0x04, 0x02, 0x69, 0x00, 0x05, 0x05, 0x06, 0x5f,
-    0x00, 0x06, 0x06, 0x3a, 0x4d, 0x09, 0x01, 0x00,
-    0x00, 0x01, 0x61, 0x00, 0x01, 0x01, 0x3b, 0x4d,
-    0x00, 0x07, 0x07, 0x08, 0x61, 0x00, 0x08, 0x08,
-    0x43, 0x08, 0x4e, 0x59, 0x59, 0x40, 0x19, 0x03,
-    0x01, 0x30, 0x2e, 0x2a, 0x28, 0x22, 0x20, 0x1f,
-    0x1d, 0x19, 0x17, 0x16, 0x15, 0x14, 0x13, 0x0a,
-    0x07, 0x01, 0x0e, 0x03, 0x0e, 0x0a, 0x09, 0x21,
-    0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0xfe, 0xd2,
-    0xff, 0xf6, 0x01, 0x2e, 0x02, 0x30, 0x10, 0x23,
-    0x00, 0x49, 0xfd, 0xf8, 0x00, 0x00, 0x11, 0x02,
-    0x00, 0x49, 0xb0, 0x00, 0x00, 0x27, 0x40, 0x24,
-    0x07, 0x01, 0x03, 0x03, 0x02, 0x61, 0x06, 0x01,
-    0x02, 0x02, 0x45, 0x4d, 0x04, 0x01, 0x00, 0x00,
-    0x01, 0x61, 0x05, 0x01, 0x01, 0x01, 0x43, 0x01,
-    0x4e, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
-    0x23, 0x08, 0x09, 0x29, 0x2b, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xfb, 0xff, 0x00, 0x5f, 0x01, 0xa9,
-    0x02, 0x35, 0x00, 0x1b, 0x00, 0x6b, 0x4b, 0xb0,
-    0x21, 0x50, 0x58, 0x40, 0x1e, 0x06, 0x04, 0x02,
-    0x03, 0x00, 0x0e, 0x0d, 0x0b, 0x09, 0x04, 0x07,
-    0x08, 0x00, 0x07, 0x67, 0x0c, 0x0a, 0x02, 0x08,
-    0x08, 0x01, 0x5f, 0x05, 0x03, 0x02, 0x01, 0x01,
-    0x3d, 0x08, 0x4e, 0x1b, 0x40, 0x25, 0x05, 0x03,
-    0x02, 0x01, 0x00, 0x08, 0x01, 0x57, 0x06, 0x04,
-    0x02, 0x03, 0x00, 0x0e, 0x0d, 0x0b, 0x09, 0x04,
-    0x07, 0x08, 0x00, 0x07, 0x67, 0x05, 0x03, 0x02,
-    0x01, 0x01, 0x08, 0x5f, 0x0c, 0x0a, 0x02, 0x08,
-    0x01, 0x08, 0x4f, 0x59, 0x40, 0x1a, 0x00, 0x00,
-    0x00, 0x1b, 0x00, 0x1b, 0x1a, 0x19, 0x18, 0x17,
-    0x16, 0x15, 0x14, 0x13, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x0f, 0x09, 0x1f,
-    0x2b, 0x01, 0x35, 0x33, 0x35, 0x33, 0x15, 0x21,
-    0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x33,
-    0x15, 0x23, 0x15, 0x23, 0x35, 0x21, 0x15, 0x23,
-    0x35, 0x21, 0x15, 0x23, 0x35, 0xfb, 0xff, 0xbf,
-    0x58, 0x01, 0x92, 0x58, 0x01, 0x92, 0x58, 0xbf,
-    0xbf, 0x58, 0xfe, 0x6e, 0x58, 0xfe, 0x6e, 0x58,
-    0x01, 0x22, 0x50, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0x50, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xff, 0xff, 0xfe, 0x61, 0xff, 0xfb, 0x01, 0xbd,
-    0x02, 0xd0, 0x10, 0x23, 0x00, 0x4e, 0xfd, 0xda,
-    0x00, 0x00, 0x11, 0x02, 0x00, 0x4e, 0xd3, 0x00,
-    0x00, 0x90, 0x4b, 0xb0, 0x0c, 0x50, 0x58, 0x40,
-    0x2d, 0x0a, 0x01, 0x03, 0x02, 0x00, 0x02, 0x03,
-    0x72, 0x0b, 0x01, 0x04, 0x09, 0x01, 0x02, 0x03,
-    0x04, 0x02, 0x69, 0x0c, 0x01, 0x05, 0x05, 0x06,
-    0x5f, 0x0d, 0x01, 0x06, 0x06, 0x3a, 0x4d, 0x0f,
-    0x07, 0x0e, 0x03, 0x00, 0x00, 0x01, 0x61, 0x08,
-    0x01, 0x01, 0x01, 0x3b, 0x01, 0x4e, 0x1b, 0x40,
-    0x2e, 0x0a, 0x01, 0x03, 0x02, 0x00, 0x02, 0x03,
-    0x00, 0x80, 0x0b, 0x01, 0x04, 0x09, 0x01, 0x02,
-    0x03, 0x04, 0x02, 0x69, 0x0c, 0x01, 0x05, 0x05,
-    0x06, 0x5f, 0x0d, 0x01, 0x06, 0x06, 0x3a, 0x4d,
-    0x0f, 0x07, 0x0e, 0x03, 0x00, 0x00, 0x01, 0x61,
-    0x08, 0x01, 0x01, 0x01, 0x3b, 0x01, 0x4e, 0x59,
-    0x40, 0x27, 0x28, 0x26, 0x03, 0x01, 0x47, 0x45,
-    0x44, 0x42, 0x3e, 0x3c, 0x3b, 0x3a, 0x39, 0x38,
-    0x2f, 0x2c, 0x26, 0x33, 0x28, 0x33, 0x22, 0x20,
-    0x1f, 0x1d, 0x19, 0x17, 0x16, 0x15, 0x14, 0x13,
-    0x0a, 0x07, 0x01, 0x0e, 0x03, 0x0e, 0x10, 0x09,
-    0x21, 0x2b, 0x00, 0x00, 0x00, 0x06, 0xfb, 0x91,
-    0x00, 0x00, 0x02, 0x17, 0x02, 0xd0, 0x00, 0x3b,
-    0x00, 0x3f, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4b,
-    0x00, 0x4f, 0x00, 0xa3, 0x40, 0xa0, 0x0e, 0x0c,
-    0x0a, 0x08, 0x06, 0x04, 0x06, 0x02, 0x26, 0x24,
-    0x22, 0x20, 0x1e, 0x0f, 0x06, 0x01, 0x00, 0x02,
-    0x01, 0x68, 0x2c, 0x27, 0x2b, 0x25, 0x2a, 0x23,
-    0x29, 0x21, 0x28, 0x1f, 0x10, 0x0b, 0x00, 0x1d,
-    0x1b, 0x19, 0x17, 0x15, 0x13, 0x06, 0x11, 0x12,
-    0x00, 0x11, 0x67, 0x0d, 0x0b, 0x09, 0x07, 0x05,
-    0x05, 0x03, 0x03, 0x3a, 0x4d, 0x1c, 0x1a, 0x18,
-    0x16, 0x14, 0x05, 0x12, 0x12, 0x3b, 0x12, 0x4e,
-    0x4c, 0x4c, 0x48, 0x48, 0x44, 0x44, 0x40, 0x40,
-    0x3c, 0x3c, 0x4c, 0x4f, 0x4c, 0x4f, 0x4e, 0x4d,
-    0x48, 0x4b, 0x48, 0x4b, 0x4a, 0x49, 0x44, 0x47,
-    0x44, 0x47, 0x46, 0x45, 0x40, 0x43, 0x40, 0x43,
-    0x42, 0x41, 0x3c, 0x3f, 0x3c, 0x3f, 0x3e, 0x3d,
-    0x3b, 0x3a, 0x39, 0x38, 0x37, 0x36, 0x35, 0x34,
-    0x33, 0x32, 0x31, 0x30, 0x2f, 0x2e, 0x2d, 0x2c,
-    0x2b, 0x2a, 0x29, 0x28, 0x27, 0x26, 0x25, 0x24,
-    0x23, 0x22, 0x21, 0x20, 0x1f, 0x1e, 0x1d, 0x1c,
-    0x1b, 0x1a, 0x19, 0x18, 0x17, 0x16, 0x15, 0x14,
-    0x13, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x10, 0x2d, 0x09, 0x1f, 0x2b, 0x01,
-    0x33, 0x37, 0x23, 0x35, 0x33, 0x37, 0x33, 0x07,
-    0x33, 0x37, 0x33, 0x07, 0x21, 0x37, 0x33, 0x07,
-    0x33, 0x37, 0x33, 0x07, 0x21, 0x37, 0x33, 0x07,
-    0x33, 0x37, 0x33, 0x07, 0x33, 0x15, 0x23, 0x07,
-    0x33, 0x15, 0x23, 0x07, 0x23, 0x37, 0x23, 0x07,
-    0x23, 0x37, 0x21, 0x07, 0x23, 0x37, 0x23, 0x07,
-    0x23, 0x37, 0x21, 0x07, 0x23, 0x37, 0x23, 0x07,
-    0x23, 0x37, 0x23, 0x25, 0x37, 0x21, 0x07, 0x21,
-    0x37, 0x21, 0x07, 0x21, 0x37, 0x23, 0x07, 0x21,
-    0x37, 0x23, 0x07, 0x21, 0x37, 0x23, 0x07, 0xfb,
-    0x91, 0x60, 0x25, 0x63, 0x6f, 0x25, 0x46, 0x25,
-    0xa0, 0x25, 0x46, 0x25, 0x01, 0x0e, 0x25, 0x46,
-    0x25, 0xa0, 0x25, 0x46, 0x25, 0x01, 0x0e, 0x25,
-    0x46, 0x25, 0xa0, 0x25, 0x46, 0x25, 0x55, 0x61,
-    0x25, 0x63, 0x6f, 0x24, 0x46, 0x24, 0xa0, 0x24,
-    0x46, 0x24, 0xfe, 0xf2, 0x24, 0x46, 0x24, 0xa0,
-    0x24, 0x46, 0x24, 0xfe, 0xf2, 0x24, 0x46, 0x24,
-    0xa0, 0x24, 0x46, 0x24, 0x54, 0x04, 0xd4, 0x25,
-    0xfe, 0xf2, 0x25, 0xfe, 0xd4, 0x25, 0xfe, 0xf2,
-    0x25, 0x01, 0xf4, 0x25, 0xa0, 0x25, 0x02, 0xda,
-    0x25, 0xa0, 0x25, 0xfc, 0x2c, 0x25, 0xa0, 0x25,
-    0x01, 0x04, 0xc3, 0x41, 0xc8, 0xc8, 0xc8, 0xc8,
-    0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8,
-    0x41, 0xc3, 0x41, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x41,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0x00, 0x00, 0x00, 0x04, 0xfd, 0xe9,
-    0x00, 0x00, 0x02, 0x17, 0x02, 0xd0, 0x00, 0x2b,
-    0x00, 0x2f, 0x00, 0x33, 0x00, 0x37, 0x00, 0x7a,
-    0x40, 0x77, 0x12, 0x10, 0x0e, 0x0c, 0x04, 0x0a,
-    0x1a, 0x18, 0x16, 0x13, 0x04, 0x09, 0x08, 0x0a,
-    0x09, 0x68, 0x1f, 0x1b, 0x1e, 0x19, 0x1d, 0x17,
-    0x14, 0x07, 0x08, 0x1c, 0x15, 0x07, 0x05, 0x03,
-    0x05, 0x01, 0x00, 0x08, 0x01, 0x67, 0x11, 0x0f,
-    0x0d, 0x03, 0x0b, 0x0b, 0x3a, 0x4d, 0x06, 0x04,
-    0x02, 0x03, 0x00, 0x00, 0x3b, 0x00, 0x4e, 0x34,
-    0x34, 0x30, 0x30, 0x2c, 0x2c, 0x00, 0x00, 0x34,
-    0x37, 0x34, 0x37, 0x36, 0x35, 0x30, 0x33, 0x30,
-    0x33, 0x32, 0x31, 0x2c, 0x2f, 0x2c, 0x2f, 0x2e,
-    0x2d, 0x00, 0x2b, 0x00, 0x2b, 0x2a, 0x29, 0x28,
-    0x27, 0x26, 0x25, 0x24, 0x23, 0x22, 0x21, 0x20,
-    0x1f, 0x1e, 0x1d, 0x1c, 0x1b, 0x1a, 0x19, 0x18,
-    0x17, 0x16, 0x15, 0x14, 0x13, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x20, 0x09,
-    0x1f, 0x2b, 0x25, 0x07, 0x23, 0x37, 0x23, 0x07,
-    0x23, 0x37, 0x23, 0x07, 0x23, 0x37, 0x23, 0x07,
-    0x23, 0x37, 0x23, 0x35, 0x33, 0x37, 0x23, 0x35,
-    0x33, 0x37, 0x33, 0x07, 0x33, 0x37, 0x33, 0x07,
-    0x33, 0x37, 0x33, 0x07, 0x33, 0x37, 0x33, 0x07,
-    0x33, 0x15, 0x23, 0x07, 0x33, 0x15, 0x25, 0x37,
-    0x23, 0x07, 0x21, 0x37, 0x23, 0x07, 0x21, 0x37,
-    0x23, 0x07, 0x01, 0x85, 0x24, 0x46, 0x24, 0xa0,
-    0x24, 0x46, 0x24, 0xf0, 0x24, 0x46, 0x24, 0xa0,
-    0x24, 0x46, 0x24, 0x54, 0x60, 0x25, 0x63, 0x6f,
-    0x25, 0x46, 0x25, 0xa0, 0x25, 0x46, 0x25, 0xf0,
-    0x25, 0x46, 0x25, 0xa0, 0x25, 0x46, 0x25, 0x55,
-    0x61, 0x25, 0x63, 0xfe, 0x71, 0x25, 0xf0, 0x25,
-    0x01, 0xd6, 0x25, 0xa0, 0x25, 0xfe, 0x84, 0x25,
-    0xa0, 0x25, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0x41, 0xc3, 0x41, 0xc8, 0xc8,
-    0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0x41, 0xc3,
-    0x41, 0x41, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xff, 0xff, 0xfc, 0xca, 0xff, 0xf6, 0x00, 0xde,
-    0x02, 0x30, 0x10, 0x23, 0x00, 0x49, 0xfb, 0xf0,
-    0x00, 0x00, 0x10, 0x23, 0x00, 0x49, 0xfd, 0xa8,
-    0x00, 0x00, 0x11, 0x03, 0x00, 0x49, 0xff, 0x60,
-    0x00, 0x00, 0x00, 0x32, 0x40, 0x2f, 0x0b, 0x07,
-    0x02, 0x03, 0x03, 0x02, 0x61, 0x0a, 0x06, 0x02,
-    0x02, 0x02, 0x45, 0x4d, 0x08, 0x04, 0x02, 0x00,
-    0x00, 0x01, 0x61, 0x09, 0x05, 0x02, 0x01, 0x01,
-    0x43, 0x01, 0x4e, 0x47, 0x45, 0x41, 0x3f, 0x3b,
-    0x39, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
-    0x24, 0x23, 0x0c, 0x09, 0x2a, 0x2b, 0x00, 0x00,
-    0x00, 0x08, 0xf9, 0x39, 0x00, 0x00, 0x02, 0x17,
-    0x02, 0xd0, 0x00, 0x4b, 0x00, 0x4f, 0x00, 0x53,
-    0x00, 0x57, 0x00, 0x5b, 0x00, 0x5f, 0x00, 0x63,
-    0x00, 0x67, 0x00, 0xd6, 0x40, 0xd3, 0x11, 0x0f,
-    0x0d, 0x0b, 0x09, 0x07, 0x05, 0x03, 0x08, 0x01,
-    0x32, 0x30, 0x2e, 0x2c, 0x2a, 0x28, 0x26, 0x12,
-    0x08, 0x00, 0x13, 0x01, 0x00, 0x68, 0x3b, 0x33,
-    0x3a, 0x31, 0x39, 0x2f, 0x38, 0x2d, 0x37, 0x2b,
-    0x36, 0x29, 0x35, 0x27, 0x34, 0x25, 0x10, 0x13,
-    0x24, 0x22, 0x20, 0x1e, 0x1c, 0x1a, 0x18, 0x16,
-    0x08, 0x14, 0x15, 0x13, 0x14, 0x67, 0x10, 0x0e,
-    0x0c, 0x0a, 0x08, 0x06, 0x04, 0x07, 0x02, 0x02,
-    0x3a, 0x4d, 0x23, 0x21, 0x1f, 0x1d, 0x1b, 0x19,
-    0x17, 0x07, 0x15, 0x15, 0x3b, 0x15, 0x4e, 0x64,
-    0x64, 0x60, 0x60, 0x5c, 0x5c, 0x58, 0x58, 0x54,
-    0x54, 0x50, 0x50, 0x4c, 0x4c, 0x00, 0x00, 0x64,
-    0x67, 0x64, 0x67, 0x66, 0x65, 0x60, 0x63, 0x60,
-    0x63, 0x62, 0x61, 0x5c, 0x5f, 0x5c, 0x5f, 0x5e,
-    0x5d, 0x58, 0x5b, 0x58, 0x5b, 0x5a, 0x59, 0x54,
-    0x57, 0x54, 0x57, 0x56, 0x55, 0x50, 0x53, 0x50,
-    0x53, 0x52, 0x51, 0x4c, 0x4f, 0x4c, 0x4f, 0x4e,
-    0x4d, 0x00, 0x4b, 0x00, 0x4b, 0x4a, 0x49, 0x48,
-    0x47, 0x46, 0x45, 0x44, 0x43, 0x42, 0x41, 0x40,
-    0x3f, 0x3e, 0x3d, 0x3c, 0x3b, 0x3a, 0x39, 0x38,
-    0x37, 0x36, 0x35, 0x34, 0x33, 0x32, 0x31, 0x30,
-    0x2f, 0x2e, 0x2d, 0x2c, 0x2b, 0x2a, 0x29, 0x28,
-    0x27, 0x26, 0x25, 0x24, 0x23, 0x22, 0x21, 0x20,
-    0x1f, 0x1e, 0x1d, 0x1c, 0x1b, 0x1a, 0x19, 0x18,
-    0x17, 0x16, 0x15, 0x14, 0x13, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x3c, 0x09,
-    0x1f, 0x2b, 0x01, 0x37, 0x23, 0x35, 0x33, 0x37,
-    0x33, 0x07, 0x33, 0x37, 0x33, 0x07, 0x21, 0x37,
-    0x33, 0x07, 0x33, 0x37, 0x33, 0x07, 0x21, 0x37,
-    0x33, 0x07, 0x33, 0x37, 0x33, 0x07, 0x21, 0x37,
-    0x33, 0x07, 0x33, 0x37, 0x33, 0x07, 0x33, 0x15,
-    0x23, 0x07, 0x33, 0x15, 0x23, 0x07, 0x23, 0x37,
-    0x23, 0x07, 0x23, 0x37, 0x21, 0x07, 0x23, 0x37,
-    0x23, 0x07, 0x23, 0x37, 0x21, 0x07, 0x23, 0x37,
-    0x23, 0x07, 0x23, 0x37, 0x21, 0x07, 0x23, 0x37,
-    0x23, 0x07, 0x23, 0x37, 0x23, 0x35, 0x21, 0x37,
-    0x21, 0x07, 0x21, 0x37, 0x21, 0x07, 0x21, 0x37,
-    0x21, 0x07, 0x21, 0x37, 0x23, 0x07, 0x21, 0x37,
-    0x23, 0x07, 0x21, 0x37, 0x23, 0x07, 0x21, 0x37,
-    0x23, 0x07, 0xf9, 0x99, 0x25, 0x63, 0x6f, 0x25,
-    0x46, 0x25, 0xa0, 0x25, 0x46, 0x25, 0x01, 0x18,
-    0x25, 0x46, 0x25, 0xa0, 0x25, 0x46, 0x25, 0x01,
-    0x18, 0x25, 0x46, 0x25, 0xa0, 0x25, 0x46, 0x25,
-    0x01, 0x18, 0x25, 0x46, 0x25, 0xa0, 0x25, 0x46,
-    0x25, 0x55, 0x61, 0x25, 0x63, 0x6f, 0x24, 0x46,
-    0x24, 0xa0, 0x24, 0x46, 0x24, 0xfe, 0xe8, 0x24,
-    0x46, 0x24, 0xa0, 0x24, 0x46, 0x24, 0xfe, 0xe8,
-    0x24, 0x46, 0x24, 0xa0, 0x24, 0x46, 0x24, 0xfe,
-    0xe8, 0x24, 0x46, 0x24, 0xa0, 0x24, 0x46, 0x24,
-    0x54, 0x07, 0x2c, 0x25, 0xfe, 0xe8, 0x25, 0xfc,
-    0x90, 0x25, 0xfe, 0xe8, 0x25, 0x03, 0x5c, 0x25,
-    0xfe, 0xe8, 0x25, 0x01, 0xfe, 0x25, 0xa0, 0x25,
-    0xfe, 0x5c, 0x25, 0xa0, 0x25, 0xfe, 0x5c, 0x25,
-    0xa0, 0x25, 0x07, 0x6c, 0x25, 0xa0, 0x25, 0x01,
-    0x04, 0xc3, 0x41, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8,
-    0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8,
-    0xc8, 0xc8, 0xc8, 0x41, 0xc3, 0x41, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x41, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0xfe, 0x7e, 0xff, 0xf6, 0x01, 0x86,
-    0x02, 0xd0, 0x10, 0x23, 0x00, 0x29, 0xfd, 0xa8,
-    0x00, 0x00, 0x11, 0x02, 0x00, 0x4e, 0x9c, 0x00,
-    0x00, 0xc1, 0x4b, 0xb0, 0x0c, 0x50, 0x58, 0x40,
-    0x31, 0x00, 0x05, 0x04, 0x00, 0x04, 0x05, 0x72,
-    0x00, 0x06, 0x00, 0x04, 0x05, 0x06, 0x04, 0x69,
-    0x00, 0x07, 0x07, 0x08, 0x5f, 0x00, 0x08, 0x08,
-    0x3a, 0x4d, 0x00, 0x00, 0x00, 0x01, 0x61, 0x03,
-    0x01, 0x01, 0x01, 0x43, 0x4d, 0x09, 0x01, 0x02,
-    0x02, 0x01, 0x61, 0x03, 0x01, 0x01, 0x01, 0x43,
-    0x01, 0x4e, 0x1b, 0x4b, 0xb0, 0x2e, 0x50, 0x58,
-    0x40, 0x32, 0x00, 0x05, 0x04, 0x00, 0x04, 0x05,
-    0x00, 0x80, 0x00, 0x06, 0x00, 0x04, 0x05, 0x06,
-    0x04, 0x69, 0x00, 0x07, 0x07, 0x08, 0x5f, 0x00,
-    0x08, 0x08, 0x3a, 0x4d, 0x00, 0x00, 0x00, 0x01,
-    0x61, 0x03, 0x01, 0x01, 0x01, 0x43, 0x4d, 0x09,
-    0x01, 0x02, 0x02, 0x01, 0x61, 0x03, 0x01, 0x01,
-    0x01, 0x43, 0x01, 0x4e, 0x1b, 0x40, 0x30, 0x00,
-    0x05, 0x04, 0x00, 0x04, 0x05, 0x00, 0x80, 0x00,
-    0x06, 0x00, 0x04, 0x05, 0x06, 0x04, 0x69, 0x00,
-    0x07, 0x07, 0x08, 0x5f, 0x00, 0x08, 0x08, 0x3a,
-    0x4d, 0x09, 0x01, 0x02, 0x02, 0x03, 0x61, 0x00,
-    0x03, 0x03, 0x3b, 0x4d, 0x00, 0x00, 0x00, 0x01,
-    0x61, 0x00, 0x01, 0x01, 0x43, 0x01, 0x4e, 0x59,
-    0x59, 0x40, 0x17, 0x0f, 0x0d, 0x2e, 0x2c, 0x2b,
-    0x29, 0x25, 0x23, 0x22, 0x21, 0x20, 0x1f, 0x16,
-    0x13, 0x0d, 0x1a, 0x0f, 0x1a, 0x24, 0x23, 0x0a,
-    0x09, 0x23, 0x2b, 0x00, 0x00, 0x04, 0xfe, 0x57,
-    0xff, 0xfb, 0x01, 0xc2, 0x02, 0xd0, 0x00, 0x16,
-    0x00, 0x1c, 0x00, 0x20, 0x00, 0x2e, 0x00, 0x5b,
-    0x40, 0x58, 0x17, 0x01, 0x02, 0x05, 0x01, 0x4c,
-    0x0c, 0x01, 0x08, 0x00, 0x07, 0x03, 0x08, 0x07,
-    0x67, 0x00, 0x03, 0x00, 0x01, 0x05, 0x03, 0x01,
-    0x69, 0x00, 0x05, 0x06, 0x01, 0x02, 0x09, 0x05,
-    0x02, 0x67, 0x0b, 0x01, 0x04, 0x04, 0x00, 0x5f,
-    0x00, 0x00, 0x00, 0x3a, 0x4d, 0x0d, 0x01, 0x09,
-    0x09, 0x0a, 0x61, 0x00, 0x0a, 0x0a, 0x3b, 0x0a,
-    0x4e, 0x23, 0x21, 0x1d, 0x1d, 0x00, 0x00, 0x2a,
-    0x27, 0x21, 0x2e, 0x23, 0x2e, 0x1d, 0x20, 0x1d,
-    0x20, 0x1f, 0x1e, 0x1c, 0x1b, 0x1a, 0x19, 0x00,
-    0x16, 0x00, 0x15, 0x21, 0x11, 0x18, 0x21, 0x0e,
-    0x09, 0x1a, 0x2b, 0x01, 0x35, 0x33, 0x32, 0x1e,
-    0x02, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x15, 0x23,
-    0x35, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23,
-    0x13, 0x36, 0x37, 0x21, 0x15, 0x21, 0x01, 0x15,
-    0x21, 0x35, 0x01, 0x33, 0x32, 0x16, 0x15, 0x14,
-    0x06, 0x2b, 0x01, 0x22, 0x26, 0x35, 0x34, 0x36,
-    0xfe, 0x57, 0x7d, 0x35, 0x55, 0x3c, 0x20, 0x1b,
-    0x32, 0x46, 0x2a, 0x5a, 0x32, 0x41, 0x4a, 0x4a,
-    0x42, 0xa0, 0x27, 0x09, 0x02, 0x1e, 0xfd, 0xb2,
-    0x02, 0x4e, 0xfe, 0x52, 0xfe, 0xb1, 0x14, 0x1d,
-    0x24, 0x24, 0x1d, 0x14, 0x1d, 0x24, 0x24, 0x02,
-    0x7b, 0x55, 0x1d, 0x37, 0x4e, 0x30, 0x2b, 0x47,
-    0x35, 0x1f, 0x02, 0x69, 0xb4, 0x42, 0x3b, 0x3b,
-    0x42, 0xfe, 0x76, 0x13, 0x19, 0x50, 0x01, 0x40,
-    0x50, 0x50, 0xfe, 0x66, 0x22, 0x1b, 0x1b, 0x20,
-    0x1f, 0x1c, 0x1b, 0x22, 0x00, 0x06, 0xfb, 0xa0,
-    0xff, 0xfb, 0x02, 0x08, 0x02, 0xd0, 0x00, 0x05,
-    0x00, 0x09, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x15,
-    0x00, 0x23, 0x00, 0x5a, 0x40, 0x57, 0x08, 0x01,
-    0x06, 0x0f, 0x09, 0x02, 0x07, 0x02, 0x06, 0x07,
-    0x67, 0x0e, 0x05, 0x02, 0x02, 0x04, 0x0d, 0x02,
-    0x03, 0x0a, 0x02, 0x03, 0x67, 0x00, 0x00, 0x00,
-    0x01, 0x5f, 0x0c, 0x01, 0x01, 0x01, 0x3a, 0x4d,
-    0x00, 0x0a, 0x0a, 0x0b, 0x61, 0x00, 0x0b, 0x0b,
-    0x3b, 0x0b, 0x4e, 0x12, 0x12, 0x0a, 0x0a, 0x06,
-    0x06, 0x00, 0x00, 0x22, 0x1f, 0x1b, 0x18, 0x12,
-    0x15, 0x12, 0x15, 0x14, 0x13, 0x11, 0x10, 0x0f,
-    0x0e, 0x0a, 0x0d, 0x0a, 0x0d, 0x0c, 0x0b, 0x06,
-    0x09, 0x06, 0x09, 0x08, 0x07, 0x00, 0x05, 0x00,
-    0x05, 0x12, 0x10, 0x09, 0x17, 0x2b, 0x03, 0x15,
-    0x03, 0x23, 0x03, 0x35, 0x01, 0x35, 0x21, 0x15,
-    0x25, 0x15, 0x21, 0x35, 0x25, 0x21, 0x15, 0x29,
-    0x01, 0x35, 0x21, 0x15, 0x01, 0x34, 0x36, 0x3b,
-    0x01, 0x32, 0x16, 0x15, 0x14, 0x06, 0x2b, 0x01,
-    0x22, 0x26, 0xf7, 0x15, 0x40, 0x15, 0xfd, 0x01,
-    0x02, 0x21, 0x04, 0x47, 0xfd, 0xdf, 0xfb, 0xb9,
-    0x02, 0x21, 0xfd, 0xdf, 0x04, 0x47, 0x02, 0x21,
-    0xfc, 0x81, 0x24, 0x1d, 0x14, 0x1d, 0x24, 0x24,
-    0x1d, 0x14, 0x1d, 0x24, 0x02, 0xd0, 0x78, 0xfe,
-    0x7f, 0x01, 0x81, 0x78, 0xfd, 0xda, 0x50, 0x50,
-    0x50, 0x50, 0x50, 0xf0, 0x50, 0x50, 0x50, 0xfe,
-    0x9c, 0x1b, 0x22, 0x22, 0x1b, 0x1b, 0x20, 0x1f,
-    0x00, 0x03, 0xfb, 0xe6, 0xff, 0x92, 0x01, 0xc2,
-    0x03, 0x0c, 0x00, 0x11, 0x00, 0x22, 0x00, 0x26,
-    0x00, 0x26, 0x40, 0x23, 0x22, 0x21, 0x20, 0x1f,
-    0x18, 0x13, 0x12, 0x11, 0x10, 0x09, 0x03, 0x02,
-    0x01, 0x00, 0x0e, 0x01, 0x00, 0x01, 0x4c, 0x00,
-    0x00, 0x01, 0x00, 0x85, 0x00, 0x01, 0x01, 0x76,
-    0x26, 0x25, 0x24, 0x23, 0x02, 0x09, 0x16, 0x2b,
-    0x01, 0x35, 0x01, 0x15, 0x01, 0x0e, 0x01, 0x07,
-    0x06, 0x07, 0x15, 0x16, 0x17, 0x1e, 0x01, 0x17,
-    0x01, 0x15, 0x25, 0x35, 0x01, 0x36, 0x37, 0x36,
-    0x37, 0x35, 0x26, 0x27, 0x2e, 0x01, 0x27, 0x01,
-    0x35, 0x01, 0x15, 0x01, 0x33, 0x11, 0x23, 0xfb,
-    0xe6, 0x02, 0x53, 0xfe, 0x43, 0x0e, 0x18, 0x0a,
-    0x0b, 0x09, 0x09, 0x0b, 0x0a, 0x18, 0x0e, 0x01,
-    0xbd, 0x01, 0x36, 0x01, 0xbd, 0x1b, 0x16, 0x0b,
-    0x0a, 0x0a, 0x0b, 0x0a, 0x19, 0x0e, 0xfe, 0x43,
-    0x02, 0x53, 0xfc, 0xe5, 0x5a, 0x5a, 0x01, 0x18,
-    0x64, 0x01, 0x72, 0x6b, 0xfe, 0xeb, 0x08, 0x0e,
-    0x05, 0x05, 0x05, 0x07, 0x03, 0x05, 0x04, 0x0c,
-    0x08, 0xfe, 0xee, 0x67, 0x01, 0x6b, 0x01, 0x10,
-    0x11, 0x08, 0x05, 0x04, 0x07, 0x04, 0x05, 0x05,
-    0x0d, 0x08, 0x01, 0x16, 0x67, 0xfe, 0x8e, 0x64,
-    0x01, 0xf4, 0xfc, 0x86, 0xff, 0xff, 0xfe, 0x89,
-    0x00, 0x2d, 0x01, 0x7e, 0x02, 0x67, 0x10, 0x23,
-    0x00, 0x4b, 0xfe, 0x34, 0x00, 0x00, 0x11, 0x02,
-    0x00, 0x49, 0x00, 0x37, 0x00, 0x38, 0x40, 0x35,
-    0x03, 0x02, 0x02, 0x03, 0x02, 0x12, 0x0a, 0x01,
-    0x03, 0x00, 0x03, 0x11, 0x10, 0x02, 0x01, 0x00,
-    0x03, 0x4c, 0x00, 0x02, 0x00, 0x03, 0x00, 0x02,
-    0x03, 0x69, 0x00, 0x00, 0x01, 0x01, 0x00, 0x59,
-    0x00, 0x00, 0x00, 0x01, 0x61, 0x00, 0x01, 0x00,
-    0x01, 0x51, 0x29, 0x27, 0x23, 0x21, 0x1d, 0x1b,
-    0x17, 0x15, 0x04, 0x09, 0x21, 0x2b, 0x00, 0x00,
-    0xff, 0xff, 0xfe, 0x82, 0x00, 0x2d, 0x01, 0x77,
-    0x02, 0x67, 0x10, 0x23, 0x00, 0x49, 0xfd, 0xa8,
-    0x00, 0x37, 0x11, 0x03, 0x00, 0x4b, 0xff, 0x74,
-    0x00, 0x00, 0x00, 0x34, 0x40, 0x31, 0x1b, 0x1a,
-    0x02, 0x03, 0x02, 0x2a, 0x22, 0x19, 0x03, 0x00,
-    0x03, 0x29, 0x28, 0x02, 0x01, 0x00, 0x03, 0x4c,
-    0x00, 0x02, 0x00, 0x03, 0x00, 0x02, 0x03, 0x69,
-    0x00, 0x00, 0x01, 0x01, 0x00, 0x59, 0x00, 0x00,
-    0x00, 0x01, 0x61, 0x00, 0x01, 0x00, 0x01, 0x51,
-    0x24, 0x24, 0x24, 0x23, 0x04, 0x09, 0x25, 0x2b,
-    0xff, 0xff, 0xfe, 0x82, 0x00, 0x2d, 0x01, 0x9f,
-    0x02, 0x67, 0x10, 0x22, 0x00, 0x0f, 0x9c, 0x00,
-    0x11, 0x03, 0x00, 0x49, 0xfd, 0xa8, 0x00, 0x37,
-    0x00, 0x38, 0x40, 0x35, 0x0e, 0x0d, 0x02, 0x03,
-    0x02, 0x10, 0x0f, 0x08, 0x03, 0x00, 0x03, 0x11,
-    0x01, 0x02, 0x01, 0x00, 0x03, 0x4c, 0x00, 0x02,
-    0x00, 0x03, 0x00, 0x02, 0x03, 0x69, 0x00, 0x00,
-    0x01, 0x01, 0x00, 0x59, 0x00, 0x00, 0x00, 0x01,
-    0x61, 0x00, 0x01, 0x00, 0x01, 0x51, 0x28, 0x26,
-    0x22, 0x20, 0x1c, 0x1a, 0x16, 0x14, 0x04, 0x09,
-    0x21, 0x2b, 0x00, 0x00, 0xff, 0xff, 0xfe, 0x89,
-    0x00, 0x2d, 0x01, 0x7e, 0x02, 0x67, 0x10, 0x23,
-    0x00, 0x0f, 0xfe, 0x34, 0x00, 0x00, 0x11, 0x02,
-    0x00, 0x49, 0x00, 0x37, 0x00, 0x38, 0x40, 0x35,
-    0x0e, 0x0d, 0x02, 0x03, 0x02, 0x10, 0x0f, 0x08,
-    0x03, 0x00, 0x03, 0x11, 0x01, 0x02, 0x01, 0x00,
-    0x03, 0x4c, 0x00, 0x02, 0x00, 0x03, 0x00, 0x02,
-    0x03, 0x69, 0x00, 0x00, 0x01, 0x01, 0x00, 0x59,
-    0x00, 0x00, 0x00, 0x01, 0x61, 0x00, 0x01, 0x00,
-    0x01, 0x51, 0x28, 0x26, 0x22, 0x20, 0x1c, 0x1a,
-    0x16, 0x14, 0x04, 0x09, 0x21, 0x2b, 0x00, 0x00,
-    0x00, 0x02, 0xfe, 0x48, 0x00, 0x41, 0x01, 0xb8,
-    0x02, 0x53, 0x00, 0x05, 0x00, 0x1e, 0x00, 0x19,
-    0x40, 0x16, 0x19, 0x12, 0x05, 0x01, 0x04, 0x00,
-    0x4a, 0x0c, 0x04, 0x03, 0x02, 0x04, 0x00, 0x49,
-    0x00, 0x00, 0x00, 0x76, 0x26, 0x01, 0x09, 0x17,
-    0x2b, 0x11, 0x05, 0x15, 0x05, 0x25, 0x35, 0x17,
-    0x32, 0x17, 0x1e, 0x01, 0x17, 0x05, 0x25, 0x3e,
-    0x01, 0x37, 0x36, 0x37, 0x35, 0x26, 0x27, 0x2e,
-    0x01, 0x27, 0x25, 0x05, 0x06, 0x07, 0x06, 0x07,
-    0x01, 0xb8, 0xfe, 0x48, 0xfe, 0x48, 0x41, 0x07,
-    0x09, 0x08, 0x15, 0x0c, 0x01, 0x3e, 0x01, 0x3e,
-    0x0c, 0x15, 0x08, 0x09, 0x07, 0x07, 0x08, 0x08,
-    0x14, 0x0c, 0xfe, 0xc0, 0xfe, 0xc2, 0x1a, 0x0f,
-    0x09, 0x07, 0x02, 0x53, 0xd7, 0x64, 0xd7, 0xd7,
-    0x64, 0x36, 0x01, 0x02, 0x05, 0x06, 0x9b, 0x93,
-    0x06, 0x08, 0x03, 0x04, 0x02, 0x07, 0x01, 0x02,
-    0x02, 0x07, 0x06, 0x94, 0x96, 0x0b, 0x03, 0x02,
-    0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0xfb, 0x9a,
-    0x00, 0x5e, 0x02, 0x0d, 0x03, 0x02, 0x10, 0x23,
-    0x00, 0x46, 0xfb, 0x78, 0x00, 0x00, 0x10, 0x23,
-    0x00, 0x46, 0xfd, 0xa8, 0x00, 0xa0, 0x11, 0x02,
-    0x00, 0x46, 0xd8, 0x00, 0x00, 0x60, 0x40, 0x5d,
-    0x4f, 0x38, 0x02, 0x00, 0x03, 0x50, 0x48, 0x3f,
-    0x03, 0x04, 0x00, 0x86, 0x85, 0x7e, 0x75, 0x6e,
-    0x5e, 0x1a, 0x19, 0x12, 0x09, 0x02, 0x0b, 0x01,
-    0x04, 0x03, 0x4c, 0x9a, 0x99, 0x94, 0x90, 0x8f,
-    0x64, 0x63, 0x5a, 0x59, 0x2e, 0x2d, 0x28, 0x24,
-    0x23, 0x0e, 0x01, 0x49, 0x06, 0x01, 0x00, 0x04,
-    0x01, 0x00, 0x57, 0x00, 0x03, 0x05, 0x01, 0x04,
-    0x01, 0x03, 0x04, 0x69, 0x06, 0x01, 0x00, 0x00,
-    0x01, 0x61, 0x08, 0x07, 0x02, 0x03, 0x01, 0x00,
-    0x01, 0x51, 0xa0, 0x9f, 0x8a, 0x89, 0x7a, 0x79,
-    0x6a, 0x69, 0x54, 0x53, 0x44, 0x43, 0x34, 0x33,
-    0x1f, 0x1d, 0x09, 0x09, 0x23, 0x2b, 0x00, 0x00,
-    0xff, 0xff, 0xfe, 0x9d, 0xff, 0x60, 0x01, 0x2e,
-    0x02, 0x30, 0x10, 0x23, 0x00, 0x4a, 0xfd, 0xf8,
-    0x00, 0x00, 0x11, 0x02, 0x00, 0x4a, 0xb0, 0x00,
-    0x00, 0x3b, 0x40, 0x38, 0x09, 0x05, 0x08, 0x03,
-    0x01, 0x03, 0x00, 0x03, 0x01, 0x00, 0x80, 0x07,
-    0x01, 0x03, 0x03, 0x02, 0x61, 0x06, 0x01, 0x02,
-    0x02, 0x45, 0x4d, 0x04, 0x01, 0x00, 0x00, 0x3f,
-    0x00, 0x4e, 0x11, 0x11, 0x01, 0x01, 0x1f, 0x1d,
-    0x19, 0x17, 0x11, 0x14, 0x11, 0x14, 0x13, 0x12,
-    0x0f, 0x0d, 0x09, 0x07, 0x01, 0x04, 0x01, 0x04,
-    0x12, 0x0a, 0x09, 0x22, 0x2b, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x55, 0x00, 0x00, 0x02, 0x03,
-    0x02, 0xd0, 0x00, 0x11, 0x00, 0x15, 0x00, 0x24,
-    0x40, 0x21, 0x11, 0x10, 0x0f, 0x09, 0x02, 0x01,
-    0x00, 0x07, 0x00, 0x4a, 0x00, 0x00, 0x01, 0x01,
-    0x00, 0x57, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x00,
-    0x01, 0x00, 0x01, 0x4f, 0x15, 0x14, 0x13, 0x12,
-    0x02, 0x06, 0x16, 0x2b, 0x13, 0x25, 0x15, 0x05,
-    0x0e, 0x01, 0x07, 0x06, 0x07, 0x15, 0x16, 0x17,
-    0x1e, 0x01, 0x17, 0x05, 0x15, 0x25, 0x11, 0x21,
-    0x15, 0x21, 0x55, 0x01, 0xae, 0xfe, 0xca, 0x0c,
-    0x14, 0x07, 0x09, 0x07, 0x07, 0x09, 0x07, 0x14,
-    0x0c, 0x01, 0x36, 0xfe, 0x52, 0x01, 0xae, 0xfe,
-    0x52, 0x01, 0xf9, 0xd7, 0x5a, 0x97, 0x06, 0x08,
-    0x02, 0x03, 0x01, 0x07, 0x01, 0x02, 0x02, 0x08,
-    0x06, 0x9a, 0x59, 0xd7, 0xfe, 0xbb, 0x50, 0x00,
-    0x00, 0x02, 0x00, 0x55, 0x00, 0x00, 0x02, 0x03,
-    0x02, 0xd0, 0x00, 0x10, 0x00, 0x14, 0x00, 0x24,
-    0x40, 0x21, 0x10, 0x0f, 0x0e, 0x0d, 0x0c, 0x07,
-    0x00, 0x07, 0x00, 0x4a, 0x00, 0x00, 0x01, 0x01,
-    0x00, 0x57, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x00,
-    0x01, 0x00, 0x01, 0x4f, 0x14, 0x13, 0x12, 0x11,
-    0x02, 0x06, 0x16, 0x2b, 0x13, 0x25, 0x3e, 0x01,
-    0x37, 0x36, 0x37, 0x35, 0x26, 0x27, 0x26, 0x27,
-    0x25, 0x35, 0x05, 0x15, 0x05, 0x15, 0x21, 0x15,
-    0x21, 0x55, 0x01, 0x36, 0x0c, 0x14, 0x08, 0x08,
-    0x07, 0x07, 0x08, 0x11, 0x17, 0xfe, 0xca, 0x01,
-    0xae, 0xfe, 0x52, 0x01, 0xae, 0xfe, 0x52, 0x01,
-    0x18, 0x97, 0x06, 0x08, 0x02, 0x03, 0x01, 0x07,
-    0x01, 0x03, 0x03, 0x0c, 0x9a, 0x59, 0xd7, 0x64,
-    0xd7, 0x6e, 0x50, 0x00, 0x00, 0x01, 0xfb, 0x9b,
-    0xff, 0x92, 0x01, 0xea, 0x03, 0x3e, 0x00, 0x0b,
-    0x00, 0x34, 0x40, 0x31, 0x00, 0x00, 0x01, 0x00,
-    0x85, 0x06, 0x01, 0x05, 0x04, 0x05, 0x86, 0x00,
-    0x01, 0x00, 0x02, 0x03, 0x01, 0x02, 0x68, 0x00,
-    0x03, 0x04, 0x04, 0x03, 0x57, 0x00, 0x03, 0x03,
-    0x04, 0x5f, 0x00, 0x04, 0x03, 0x04, 0x4f, 0x00,
-    0x00, 0x00, 0x0b, 0x00, 0x0b, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x07, 0x09, 0x1b, 0x2b, 0x05, 0x01,
-    0x33, 0x03, 0x21, 0x15, 0x21, 0x07, 0x21, 0x15,
-    0x21, 0x03, 0xfb, 0x9b, 0x01, 0x63, 0x5f, 0x80,
-    0x05, 0x0d, 0xfa, 0xd4, 0x3c, 0x05, 0x68, 0xfa,
-    0x7a, 0x6a, 0x6e, 0x03, 0xac, 0xfe, 0xac, 0x50,
-    0xa0, 0x50, 0xfe, 0xe8, 0xff, 0xff, 0x00, 0x5c,
-    0x00, 0x00, 0x01, 0xfc, 0x02, 0xc6, 0x11, 0x02,
-    0x01, 0x84, 0x00, 0x00, 0x00, 0x11, 0x40, 0x0e,
-    0x00, 0x00, 0x01, 0x00, 0x85, 0x00, 0x01, 0x01,
-    0x76, 0x11, 0x11, 0x02, 0x06, 0x23, 0x2b, 0x00,
-    0xff, 0xff, 0x00, 0xd6, 0x00, 0xf0, 0x01, 0x82,
-    0x01, 0x9f, 0x11, 0x03, 0x00, 0x29, 0x00, 0x00,
-    0x00, 0xfa, 0x00, 0x18, 0x40, 0x15, 0x00, 0x00,
-    0x01, 0x01, 0x00, 0x59, 0x00, 0x00, 0x00, 0x01,
-    0x61, 0x00, 0x01, 0x00, 0x01, 0x51, 0x24, 0x23,
-    0x02, 0x06, 0x23, 0x2b, 0x00, 0x01, 0x00, 0xaa,
-    0x03, 0x57, 0x01, 0xae, 0x03, 0xa2, 0x00, 0x03,
-    0x00, 0x20, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x15,
-    0x00, 0x00, 0x01, 0x01, 0x00, 0x57, 0x00, 0x00,
-    0x00, 0x01, 0x5f, 0x00, 0x01, 0x00, 0x01, 0x4f,
-    0x11, 0x10, 0x02, 0x09, 0x18, 0x2b, 0xb1, 0x06,
-    0x00, 0x44, 0x13, 0x21, 0x15, 0x21, 0xaa, 0x01,
-    0x04, 0xfe, 0xfc, 0x03, 0xa2, 0x4b, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x3c, 0x00, 0x00, 0x04, 0x7e,
-    0x02, 0xfd, 0x10, 0x22, 0x00, 0x2e, 0x00, 0x00,
-    0x11, 0x03, 0x00, 0x09, 0x02, 0x58, 0x00, 0x00,
-    0x00, 0xde, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40,
-    0x3a, 0x03, 0x01, 0x00, 0x0e, 0x06, 0x02, 0x04,
-    0x07, 0x00, 0x04, 0x67, 0x0d, 0x01, 0x02, 0x02,
-    0x0c, 0x61, 0x10, 0x01, 0x0c, 0x0c, 0x44, 0x4d,
-    0x0d, 0x01, 0x02, 0x02, 0x01, 0x5f, 0x00, 0x01,
-    0x01, 0x3c, 0x4d, 0x00, 0x08, 0x08, 0x09, 0x5f,
-    0x00, 0x09, 0x09, 0x3d, 0x4d, 0x0a, 0x01, 0x07,
-    0x07, 0x05, 0x5f, 0x0f, 0x0b, 0x02, 0x05, 0x05,
-    0x3b, 0x05, 0x4e, 0x1b, 0x4b, 0xb0, 0x31, 0x50,
-    0x58, 0x40, 0x35, 0x10, 0x01, 0x0c, 0x01, 0x02,
-    0x0c, 0x59, 0x03, 0x01, 0x00, 0x0e, 0x06, 0x02,
-    0x04, 0x07, 0x00, 0x04, 0x67, 0x0d, 0x01, 0x02,
-    0x02, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x3a, 0x4d,
-    0x00, 0x08, 0x08, 0x09, 0x5f, 0x00, 0x09, 0x09,
-    0x3d, 0x4d, 0x0a, 0x01, 0x07, 0x07, 0x05, 0x5f,
-    0x0f, 0x0b, 0x02, 0x05, 0x05, 0x3b, 0x05, 0x4e,
-    0x1b, 0x40, 0x33, 0x10, 0x01, 0x0c, 0x01, 0x02,
-    0x0c, 0x59, 0x00, 0x01, 0x0d, 0x01, 0x02, 0x09,
-    0x01, 0x02, 0x69, 0x03, 0x01, 0x00, 0x0e, 0x06,
-    0x02, 0x04, 0x07, 0x00, 0x04, 0x67, 0x00, 0x08,
-    0x08, 0x09, 0x5f, 0x00, 0x09, 0x09, 0x3d, 0x4d,
-    0x0a, 0x01, 0x07, 0x07, 0x05, 0x5f, 0x0f, 0x0b,
-    0x02, 0x05, 0x05, 0x3b, 0x05, 0x4e, 0x59, 0x59,
-    0x40, 0x25, 0x20, 0x1e, 0x14, 0x14, 0x01, 0x01,
-    0x27, 0x24, 0x1e, 0x2b, 0x20, 0x2b, 0x14, 0x1d,
-    0x14, 0x1d, 0x1c, 0x1b, 0x1a, 0x19, 0x18, 0x17,
-    0x16, 0x15, 0x01, 0x13, 0x01, 0x13, 0x11, 0x11,
-    0x12, 0x21, 0x23, 0x12, 0x11, 0x09, 0x27, 0x2b,
-    0xff, 0xff, 0x00, 0x3c, 0x00, 0x00, 0x04, 0x7e,
-    0x02, 0xda, 0x10, 0x22, 0x00, 0x2e, 0x00, 0x00,
-    0x11, 0x03, 0x00, 0x0a, 0x02, 0x58, 0x00, 0x00,
-    0x00, 0x9c, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40,
-    0x24, 0x03, 0x01, 0x00, 0x0b, 0x06, 0x02, 0x04,
-    0x07, 0x00, 0x04, 0x67, 0x09, 0x01, 0x02, 0x02,
-    0x01, 0x5f, 0x0c, 0x0a, 0x02, 0x01, 0x01, 0x3c,
-    0x4d, 0x00, 0x07, 0x07, 0x05, 0x5f, 0x08, 0x01,
-    0x05, 0x05, 0x3b, 0x05, 0x4e, 0x1b, 0x4b, 0xb0,
-    0x31, 0x50, 0x58, 0x40, 0x24, 0x03, 0x01, 0x00,
-    0x0b, 0x06, 0x02, 0x04, 0x07, 0x00, 0x04, 0x67,
-    0x09, 0x01, 0x02, 0x02, 0x01, 0x5f, 0x0c, 0x0a,
-    0x02, 0x01, 0x01, 0x3a, 0x4d, 0x00, 0x07, 0x07,
-    0x05, 0x5f, 0x08, 0x01, 0x05, 0x05, 0x3b, 0x05,
-    0x4e, 0x1b, 0x40, 0x22, 0x0c, 0x0a, 0x02, 0x01,
-    0x09, 0x01, 0x02, 0x00, 0x01, 0x02, 0x67, 0x03,
-    0x01, 0x00, 0x0b, 0x06, 0x02, 0x04, 0x07, 0x00,
-    0x04, 0x67, 0x00, 0x07, 0x07, 0x05, 0x5f, 0x08,
-    0x01, 0x05, 0x05, 0x3b, 0x05, 0x4e, 0x59, 0x59,
-    0x40, 0x1b, 0x14, 0x14, 0x01, 0x01, 0x14, 0x21,
-    0x14, 0x21, 0x20, 0x1f, 0x1c, 0x1a, 0x19, 0x17,
-    0x01, 0x13, 0x01, 0x13, 0x11, 0x11, 0x12, 0x21,
-    0x23, 0x12, 0x0d, 0x09, 0x27, 0x2b, 0x00, 0x00,
-    0xff, 0xff, 0xfe, 0x57, 0x00, 0xaa, 0x02, 0x08,
-    0x01, 0xea, 0x10, 0x23, 0x00, 0x80, 0xfd, 0xa8,
-    0xff, 0xec, 0x11, 0x02, 0x00, 0x4c, 0x00, 0x00,
-    0x00, 0x32, 0x40, 0x2f, 0x00, 0x04, 0x06, 0x01,
-    0x05, 0x02, 0x04, 0x05, 0x67, 0x00, 0x02, 0x01,
-    0x03, 0x02, 0x57, 0x00, 0x00, 0x00, 0x01, 0x03,
-    0x00, 0x01, 0x69, 0x00, 0x02, 0x02, 0x03, 0x5f,
-    0x00, 0x03, 0x02, 0x03, 0x4f, 0x19, 0x19, 0x19,
-    0x1c, 0x19, 0x1c, 0x12, 0x11, 0x14, 0x28, 0x25,
-    0x07, 0x09, 0x26, 0x2b, 0xff, 0xff, 0xfe, 0x57,
-    0x00, 0xcd, 0x01, 0xf4, 0x01, 0xc7, 0x10, 0x23,
-    0x00, 0x80, 0xfd, 0xa8, 0xff, 0xe7, 0x11, 0x02,
-    0x00, 0x44, 0x00, 0x00, 0x00, 0x22, 0x40, 0x1f,
-    0x00, 0x00, 0x02, 0x01, 0x00, 0x59, 0x00, 0x02,
-    0x00, 0x03, 0x01, 0x02, 0x03, 0x67, 0x00, 0x00,
-    0x00, 0x01, 0x61, 0x00, 0x01, 0x00, 0x01, 0x51,
-    0x11, 0x14, 0x28, 0x25, 0x04, 0x09, 0x25, 0x2b,
-    0x00, 0x01, 0xfd, 0xe4, 0xff, 0x9c, 0x02, 0x1c,
-    0xff, 0xe7, 0x00, 0x03, 0x00, 0x18, 0x40, 0x15,
-    0x00, 0x00, 0x01, 0x01, 0x00, 0x57, 0x00, 0x00,
-    0x00, 0x01, 0x5f, 0x00, 0x01, 0x00, 0x01, 0x4f,
-    0x11, 0x10, 0x02, 0x09, 0x18, 0x2b, 0x05, 0x21,
-    0x15, 0x21, 0xfd, 0xe4, 0x04, 0x38, 0xfb, 0xc8,
-    0x19, 0x4b, 0x00, 0x00, 0x00, 0x01, 0xfb, 0x8c,
-    0x00, 0x00, 0x01, 0xf4, 0x02, 0x99, 0x00, 0x13,
-    0x00, 0x30, 0x40, 0x2d, 0x00, 0x03, 0x02, 0x03,
-    0x85, 0x04, 0x01, 0x02, 0x05, 0x01, 0x01, 0x00,
-    0x02, 0x01, 0x68, 0x06, 0x01, 0x00, 0x09, 0x01,
-    0x07, 0x08, 0x00, 0x07, 0x67, 0x00, 0x08, 0x08,
-    0x3b, 0x08, 0x4e, 0x13, 0x12, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x0a, 0x09,
-    0x1f, 0x2b, 0x25, 0x21, 0x37, 0x21, 0x35, 0x21,
-    0x37, 0x33, 0x07, 0x21, 0x15, 0x21, 0x07, 0x21,
-    0x15, 0x21, 0x07, 0x23, 0x37, 0x21, 0xfb, 0x8c,
-    0x02, 0xd2, 0x67, 0xfc, 0xc7, 0x03, 0x6d, 0x71,
-    0x5a, 0x71, 0x02, 0xa1, 0xfd, 0x2b, 0x67, 0x03,
-    0x3c, 0xfc, 0x90, 0x6e, 0x5a, 0x6e, 0xfd, 0x62,
-    0xfa, 0xa0, 0x50, 0xaf, 0xaf, 0x50, 0xa0, 0x50,
-    0xaa, 0xaa, 0x00, 0x00, 0x00, 0x01, 0xfb, 0x8c,
-    0x00, 0x23, 0x02, 0x1c, 0x02, 0x71, 0x00, 0x1d,
-    0x00, 0x2e, 0x40, 0x2b, 0x1d, 0x0e, 0x02, 0x04,
-    0x01, 0x01, 0x4c, 0x02, 0x01, 0x00, 0x01, 0x03,
-    0x00, 0x57, 0x00, 0x01, 0x00, 0x04, 0x03, 0x01,
-    0x04, 0x68, 0x02, 0x01, 0x00, 0x00, 0x03, 0x5f,
-    0x05, 0x01, 0x03, 0x00, 0x03, 0x4f, 0x14, 0x11,
-    0x1c, 0x11, 0x14, 0x10, 0x06, 0x09, 0x1c, 0x2b,
-    0x01, 0x33, 0x07, 0x0e, 0x01, 0x07, 0x21, 0x37,
-    0x33, 0x07, 0x0e, 0x01, 0x07, 0x06, 0x07, 0x15,
-    0x16, 0x17, 0x16, 0x1f, 0x01, 0x23, 0x27, 0x21,
-    0x1e, 0x01, 0x1f, 0x01, 0x23, 0x03, 0xfc, 0x73,
-    0x6a, 0xba, 0x05, 0x07, 0x04, 0x04, 0xd7, 0xc8,
-    0x6a, 0xba, 0x0e, 0x15, 0x07, 0x09, 0x06, 0x06,
-    0x08, 0x0f, 0x19, 0xbd, 0x69, 0xc9, 0xfb, 0x28,
-    0x03, 0x07, 0x04, 0xbd, 0x69, 0xe8, 0x02, 0x71,
-    0xec, 0x05, 0x09, 0x05, 0xff, 0xec, 0x11, 0x17,
-    0x07, 0x08, 0x04, 0x03, 0x04, 0x07, 0x0c, 0x1f,
-    0xee, 0xff, 0x04, 0x08, 0x05, 0xee, 0x01, 0x27,
-    0x00, 0x03, 0xfb, 0xeb, 0x00, 0x41, 0x01, 0xc2,
-    0x02, 0x53, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x2f,
-    0x00, 0x27, 0x40, 0x24, 0x2f, 0x21, 0x20, 0x12,
-    0x11, 0x10, 0x02, 0x01, 0x00, 0x09, 0x00, 0x4a,
-    0x2e, 0x2d, 0x2c, 0x1f, 0x1e, 0x1d, 0x0f, 0x0e,
-    0x0d, 0x09, 0x00, 0x49, 0x02, 0x01, 0x02, 0x00,
-    0x00, 0x76, 0x1e, 0x1f, 0x19, 0x03, 0x09, 0x19,
-    0x2b, 0x13, 0x25, 0x15, 0x05, 0x0e, 0x01, 0x07,
-    0x06, 0x23, 0x15, 0x32, 0x16, 0x17, 0x05, 0x15,
-    0x2d, 0x02, 0x15, 0x05, 0x0e, 0x01, 0x07, 0x06,
-    0x23, 0x15, 0x32, 0x16, 0x17, 0x05, 0x15, 0x25,
-    0x03, 0x15, 0x05, 0x0e, 0x01, 0x07, 0x06, 0x23,
-    0x15, 0x32, 0x16, 0x17, 0x05, 0x15, 0x25, 0x35,
-    0x05, 0x01, 0xbd, 0xfe, 0xbb, 0x0e, 0x14, 0x07,
-    0x08, 0x06, 0x0f, 0x1b, 0x0d, 0x01, 0x45, 0xfe,
-    0x43, 0xfd, 0xf3, 0x01, 0xbd, 0xfe, 0xbb, 0x0e,
-    0x14, 0x07, 0x08, 0x06, 0x0f, 0x1b, 0x0d, 0x01,
-    0x45, 0xfe, 0x43, 0x50, 0xfe, 0xbb, 0x0e, 0x14,
-    0x07, 0x08, 0x06, 0x0f, 0x1b, 0x0d, 0x01, 0x45,
-    0xfe, 0x43, 0x01, 0x7c, 0xd7, 0x5b, 0x9a, 0x06,
-    0x06, 0x02, 0x02, 0x07, 0x08, 0x07, 0x9e, 0x59,
-    0xd7, 0x64, 0xd7, 0x5b, 0x9a, 0x06, 0x06, 0x02,
-    0x02, 0x07, 0x08, 0x07, 0x9e, 0x59, 0xd7, 0x01,
-    0x3b, 0x5b, 0x9a, 0x06, 0x06, 0x02, 0x02, 0x07,
-    0x08, 0x07, 0x9e, 0x59, 0xd7, 0x64, 0x00, 0x00,
-    0x00, 0x03, 0xfb, 0xe6, 0x00, 0x41, 0x01, 0xbd,
-    0x02, 0x53, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x2f,
-    0x00, 0x29, 0x40, 0x26, 0x2e, 0x2d, 0x2c, 0x1f,
-    0x1e, 0x10, 0x0e, 0x0d, 0x0c, 0x09, 0x00, 0x4a,
-    0x2f, 0x21, 0x20, 0x13, 0x12, 0x11, 0x0f, 0x01,
-    0x00, 0x09, 0x00, 0x49, 0x02, 0x01, 0x02, 0x00,
-    0x00, 0x76, 0x29, 0x28, 0x1b, 0x1a, 0x18, 0x03,
-    0x09, 0x17, 0x2b, 0x3d, 0x01, 0x25, 0x3e, 0x01,
-    0x37, 0x36, 0x33, 0x35, 0x22, 0x26, 0x27, 0x25,
-    0x35, 0x05, 0x15, 0x25, 0x15, 0x05, 0x35, 0x25,
-    0x3e, 0x01, 0x37, 0x36, 0x33, 0x35, 0x22, 0x26,
-    0x27, 0x25, 0x35, 0x01, 0x35, 0x25, 0x3e, 0x01,
-    0x37, 0x36, 0x33, 0x35, 0x22, 0x26, 0x27, 0x25,
-    0x35, 0x05, 0x15, 0x01, 0x45, 0x0e, 0x14, 0x07,
-    0x08, 0x06, 0x0e, 0x1c, 0x0d, 0xfe, 0xbb, 0x01,
-    0xbd, 0xfd, 0xf3, 0xfe, 0x43, 0x01, 0x45, 0x0e,
-    0x14, 0x07, 0x08, 0x06, 0x0e, 0x1c, 0x0d, 0xfe,
-    0xbb, 0xfd, 0xf3, 0x01, 0x45, 0x0e, 0x14, 0x07,
-    0x08, 0x06, 0x0e, 0x1c, 0x0d, 0xfe, 0xbb, 0x01,
-    0xbd, 0x41, 0x5b, 0x9a, 0x07, 0x06, 0x01, 0x02,
-    0x07, 0x09, 0x06, 0x9e, 0x59, 0xd7, 0x64, 0x64,
-    0x64, 0xd7, 0x5b, 0x9a, 0x07, 0x06, 0x01, 0x02,
-    0x07, 0x09, 0x06, 0x9e, 0x59, 0xfd, 0xee, 0x5b,
-    0x9a, 0x07, 0x06, 0x01, 0x02, 0x07, 0x09, 0x06,
-    0x9e, 0x59, 0xd7, 0x64, 0x00, 0x02, 0xfb, 0x8c,
-    0x00, 0x23, 0x02, 0x1c, 0x02, 0x71, 0x00, 0x17,
-    0x00, 0x2e, 0x00, 0x39, 0x40, 0x36, 0x23, 0x18,
-    0x0c, 0x03, 0x06, 0x07, 0x01, 0x4c, 0x02, 0x01,
-    0x00, 0x01, 0x03, 0x00, 0x57, 0x00, 0x01, 0x00,
-    0x07, 0x06, 0x01, 0x07, 0x68, 0x00, 0x06, 0x00,
-    0x04, 0x03, 0x06, 0x04, 0x67, 0x02, 0x01, 0x00,
-    0x00, 0x03, 0x5f, 0x05, 0x01, 0x03, 0x00, 0x03,
-    0x4f, 0x12, 0x1a, 0x11, 0x11, 0x1c, 0x11, 0x11,
-    0x11, 0x08, 0x09, 0x1e, 0x2b, 0x01, 0x13, 0x33,
-    0x07, 0x21, 0x37, 0x33, 0x07, 0x0e, 0x01, 0x07,
-    0x06, 0x07, 0x15, 0x16, 0x17, 0x16, 0x1f, 0x01,
-    0x23, 0x27, 0x21, 0x17, 0x23, 0x03, 0x16, 0x17,
-    0x1e, 0x01, 0x17, 0x1e, 0x01, 0x1f, 0x01, 0x21,
-    0x27, 0x37, 0x21, 0x07, 0x0e, 0x01, 0x07, 0x0e,
-    0x01, 0x07, 0x06, 0x07, 0xfb, 0x8c, 0xe7, 0x6a,
-    0x6a, 0x04, 0xd5, 0x6a, 0x6a, 0xba, 0x0e, 0x15,
-    0x07, 0x09, 0x06, 0x06, 0x08, 0x0f, 0x19, 0xbd,
-    0x69, 0x6a, 0xfb, 0x29, 0x6b, 0x69, 0x8a, 0x05,
-    0x07, 0x06, 0x11, 0x0b, 0x02, 0x04, 0x02, 0x12,
-    0x04, 0xd8, 0x3f, 0x3f, 0xfb, 0x2a, 0x11, 0x03,
-    0x06, 0x02, 0x0b, 0x12, 0x05, 0x07, 0x05, 0x01,
-    0x4a, 0x01, 0x27, 0x87, 0x87, 0xec, 0x11, 0x17,
-    0x07, 0x08, 0x04, 0x03, 0x04, 0x07, 0x0c, 0x1f,
-    0xee, 0x87, 0x87, 0x01, 0x24, 0x03, 0x06, 0x05,
-    0x11, 0x0d, 0x02, 0x06, 0x02, 0x17, 0x50, 0x50,
-    0x15, 0x04, 0x06, 0x04, 0x0d, 0x12, 0x05, 0x06,
-    0x03, 0x00, 0x00, 0x00, 0x00, 0x02, 0xfb, 0x8c,
-    0x00, 0x23, 0x01, 0xf4, 0x02, 0x71, 0x00, 0x18,
-    0x00, 0x29, 0x00, 0x38, 0x40, 0x35, 0x21, 0x0c,
-    0x02, 0x03, 0x02, 0x01, 0x4c, 0x06, 0x01, 0x00,
-    0x01, 0x05, 0x00, 0x57, 0x00, 0x01, 0x00, 0x02,
-    0x03, 0x01, 0x02, 0x68, 0x00, 0x03, 0x00, 0x04,
-    0x05, 0x03, 0x04, 0x67, 0x06, 0x01, 0x00, 0x00,
-    0x05, 0x5f, 0x07, 0x01, 0x05, 0x00, 0x05, 0x4f,
-    0x1d, 0x12, 0x11, 0x11, 0x1d, 0x11, 0x11, 0x11,
-    0x08, 0x09, 0x1e, 0x2b, 0x01, 0x13, 0x33, 0x07,
-    0x21, 0x15, 0x21, 0x07, 0x0e, 0x01, 0x07, 0x06,
-    0x07, 0x15, 0x16, 0x17, 0x1e, 0x01, 0x1f, 0x01,
-    0x21, 0x15, 0x21, 0x17, 0x23, 0x01, 0x13, 0x33,
-    0x07, 0x0e, 0x01, 0x07, 0x06, 0x07, 0x15, 0x16,
-    0x17, 0x1e, 0x01, 0x1f, 0x01, 0x23, 0xfc, 0xae,
-    0xe7, 0x6a, 0x6a, 0x04, 0x5f, 0xfb, 0x62, 0x11,
-    0x0e, 0x15, 0x07, 0x09, 0x06, 0x06, 0x08, 0x07,
-    0x14, 0x0d, 0x12, 0x04, 0xa0, 0xfb, 0xa0, 0x6b,
-    0x69, 0xfd, 0xf6, 0xe7, 0x6a, 0xba, 0x0e, 0x15,
-    0x07, 0x09, 0x06, 0x06, 0x08, 0x07, 0x14, 0x0d,
-    0xbd, 0x69, 0x01, 0x4a, 0x01, 0x27, 0x87, 0x50,
-    0x15, 0x11, 0x17, 0x07, 0x08, 0x04, 0x03, 0x04,
-    0x07, 0x06, 0x15, 0x10, 0x17, 0x50, 0x87, 0x01,
-    0x27, 0x01, 0x27, 0xec, 0x11, 0x17, 0x07, 0x08,
-    0x04, 0x03, 0x04, 0x07, 0x06, 0x15, 0x10, 0xee,
-    0x00, 0x01, 0xfb, 0x8c, 0x00, 0x23, 0x01, 0xf4,
-    0x02, 0x71, 0x00, 0x18, 0x00, 0x65, 0xb6, 0x18,
-    0x0b, 0x02, 0x03, 0x02, 0x01, 0x4c, 0x4b, 0xb0,
-    0x0a, 0x50, 0x58, 0x40, 0x24, 0x00, 0x00, 0x01,
-    0x01, 0x00, 0x70, 0x00, 0x05, 0x04, 0x04, 0x05,
-    0x71, 0x00, 0x01, 0x00, 0x02, 0x03, 0x01, 0x02,
-    0x68, 0x00, 0x03, 0x04, 0x04, 0x03, 0x57, 0x00,
-    0x03, 0x03, 0x04, 0x5f, 0x00, 0x04, 0x03, 0x04,
-    0x4f, 0x1b, 0x40, 0x22, 0x00, 0x00, 0x01, 0x00,
-    0x85, 0x00, 0x05, 0x04, 0x05, 0x86, 0x00, 0x01,
-    0x00, 0x02, 0x03, 0x01, 0x02, 0x68, 0x00, 0x03,
-    0x04, 0x04, 0x03, 0x57, 0x00, 0x03, 0x03, 0x04,
-    0x5f, 0x00, 0x04, 0x03, 0x04, 0x4f, 0x59, 0x40,
-    0x09, 0x11, 0x11, 0x1d, 0x11, 0x11, 0x10, 0x06,
-    0x09, 0x1c, 0x2b, 0x01, 0x33, 0x07, 0x21, 0x15,
-    0x21, 0x07, 0x0e, 0x01, 0x07, 0x06, 0x07, 0x15,
-    0x16, 0x17, 0x1e, 0x01, 0x1f, 0x01, 0x21, 0x15,
-    0x21, 0x17, 0x23, 0x03, 0xfc, 0x73, 0x6a, 0x6a,
-    0x05, 0x81, 0xfa, 0x40, 0x11, 0x0e, 0x15, 0x07,
-    0x09, 0x06, 0x06, 0x08, 0x07, 0x14, 0x0d, 0x12,
-    0x05, 0xc2, 0xfa, 0x7e, 0x6b, 0x69, 0xe8, 0x02,
-    0x71, 0x87, 0x50, 0x15, 0x11, 0x17, 0x07, 0x08,
-    0x04, 0x03, 0x04, 0x07, 0x06, 0x15, 0x10, 0x17,
-    0x50, 0x87, 0x01, 0x27, 0x00, 0x02, 0xf9, 0x34,
-    0x00, 0x23, 0x02, 0x1c, 0x02, 0x71, 0x00, 0x0d,
-    0x00, 0x2e, 0x00, 0x6e, 0x40, 0x09, 0x1d, 0x0e,
-    0x0d, 0x06, 0x04, 0x06, 0x07, 0x01, 0x4c, 0x4b,
-    0xb0, 0x0a, 0x50, 0x58, 0x40, 0x26, 0x02, 0x01,
-    0x00, 0x01, 0x01, 0x00, 0x70, 0x05, 0x01, 0x03,
-    0x04, 0x04, 0x03, 0x71, 0x00, 0x01, 0x00, 0x07,
-    0x06, 0x01, 0x07, 0x68, 0x00, 0x06, 0x04, 0x04,
-    0x06, 0x57, 0x00, 0x06, 0x06, 0x04, 0x5f, 0x00,
-    0x04, 0x06, 0x04, 0x4f, 0x1b, 0x40, 0x24, 0x02,
-    0x01, 0x00, 0x01, 0x00, 0x85, 0x05, 0x01, 0x03,
-    0x04, 0x03, 0x86, 0x00, 0x01, 0x00, 0x07, 0x06,
-    0x01, 0x07, 0x68, 0x00, 0x06, 0x04, 0x04, 0x06,
-    0x57, 0x00, 0x06, 0x06, 0x04, 0x5f, 0x00, 0x04,
-    0x06, 0x04, 0x4f, 0x59, 0x40, 0x0b, 0x1c, 0x1b,
-    0x11, 0x11, 0x12, 0x11, 0x11, 0x10, 0x08, 0x09,
-    0x1e, 0x2b, 0x01, 0x33, 0x07, 0x21, 0x27, 0x33,
-    0x13, 0x03, 0x23, 0x37, 0x21, 0x17, 0x23, 0x03,
-    0x17, 0x16, 0x17, 0x1e, 0x01, 0x17, 0x1e, 0x01,
-    0x1f, 0x01, 0x21, 0x37, 0x36, 0x37, 0x36, 0x37,
-    0x35, 0x26, 0x27, 0x2e, 0x01, 0x2f, 0x01, 0x21,
-    0x07, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x07, 0x06,
-    0x07, 0xfa, 0x1b, 0x6a, 0x6a, 0x07, 0x1b, 0x6b,
-    0x6a, 0xe7, 0xe8, 0x69, 0x6b, 0xf8, 0xe4, 0x6b,
-    0x69, 0xe8, 0x5e, 0x05, 0x07, 0x06, 0x11, 0x0b,
-    0x02, 0x04, 0x02, 0x12, 0x07, 0x9c, 0x13, 0x18,
-    0x0f, 0x08, 0x06, 0x06, 0x08, 0x08, 0x15, 0x0e,
-    0x10, 0xf8, 0x67, 0x11, 0x03, 0x06, 0x02, 0x0b,
-    0x12, 0x05, 0x07, 0x05, 0x02, 0x71, 0x87, 0x87,
-    0xfe, 0xd9, 0xfe, 0xd9, 0x87, 0x87, 0x01, 0x27,
-    0x03, 0x03, 0x06, 0x05, 0x11, 0x0d, 0x02, 0x06,
-    0x02, 0x17, 0x18, 0x1e, 0x0d, 0x07, 0x04, 0x03,
-    0x04, 0x08, 0x07, 0x17, 0x11, 0x14, 0x15, 0x04,
-    0x06, 0x04, 0x0d, 0x12, 0x05, 0x06, 0x03, 0x00,
-    0x00, 0x01, 0xfb, 0xb4, 0x00, 0x23, 0x02, 0x1c,
-    0x02, 0x71, 0x00, 0x17, 0x00, 0x6c, 0xb6, 0x14,
-    0x07, 0x02, 0x00, 0x01, 0x01, 0x4c, 0x4b, 0xb0,
-    0x0a, 0x50, 0x58, 0x40, 0x25, 0x00, 0x03, 0x02,
-    0x02, 0x03, 0x70, 0x00, 0x04, 0x05, 0x05, 0x04,
-    0x71, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x01,
-    0x68, 0x00, 0x00, 0x05, 0x05, 0x00, 0x57, 0x00,
-    0x00, 0x00, 0x05, 0x5f, 0x06, 0x01, 0x05, 0x00,
-    0x05, 0x4f, 0x1b, 0x40, 0x23, 0x00, 0x03, 0x02,
-    0x03, 0x85, 0x00, 0x04, 0x05, 0x04, 0x86, 0x00,
-    0x02, 0x00, 0x01, 0x00, 0x02, 0x01, 0x68, 0x00,
-    0x00, 0x05, 0x05, 0x00, 0x57, 0x00, 0x00, 0x00,
-    0x05, 0x5f, 0x06, 0x01, 0x05, 0x00, 0x05, 0x4f,
-    0x59, 0x40, 0x0e, 0x00, 0x00, 0x00, 0x17, 0x00,
-    0x17, 0x12, 0x11, 0x11, 0x1c, 0x11, 0x07, 0x09,
-    0x1b, 0x2b, 0x25, 0x35, 0x21, 0x37, 0x36, 0x37,
-    0x36, 0x37, 0x35, 0x26, 0x27, 0x2e, 0x01, 0x2f,
-    0x01, 0x21, 0x35, 0x21, 0x27, 0x33, 0x13, 0x03,
-    0x23, 0x37, 0xfb, 0xb4, 0x05, 0xc2, 0x13, 0x18,
-    0x0f, 0x08, 0x06, 0x06, 0x08, 0x08, 0x15, 0x0e,
-    0x10, 0xfa, 0x3f, 0x05, 0x82, 0x6b, 0x6a, 0xe7,
-    0xe8, 0x69, 0x6b, 0xaa, 0x50, 0x18, 0x1e, 0x0d,
-    0x07, 0x04, 0x03, 0x04, 0x08, 0x07, 0x17, 0x11,
-    0x14, 0x50, 0x87, 0xfe, 0xd9, 0xfe, 0xd9, 0x87,
-    0x00, 0x02, 0xfb, 0xb4, 0x00, 0x23, 0x02, 0x1c,
-    0x02, 0x71, 0x00, 0x17, 0x00, 0x27, 0x00, 0x3a,
-    0x40, 0x37, 0x21, 0x1a, 0x13, 0x06, 0x04, 0x00,
-    0x01, 0x01, 0x4c, 0x06, 0x01, 0x03, 0x02, 0x04,
-    0x03, 0x57, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02,
-    0x01, 0x68, 0x00, 0x00, 0x00, 0x05, 0x04, 0x00,
-    0x05, 0x67, 0x06, 0x01, 0x03, 0x03, 0x04, 0x5f,
-    0x07, 0x01, 0x04, 0x03, 0x04, 0x4f, 0x12, 0x11,
-    0x11, 0x12, 0x11, 0x11, 0x1c, 0x10, 0x08, 0x09,
-    0x1e, 0x2b, 0x25, 0x21, 0x37, 0x36, 0x37, 0x36,
-    0x37, 0x35, 0x26, 0x27, 0x2e, 0x01, 0x2f, 0x01,
-    0x21, 0x35, 0x21, 0x27, 0x33, 0x13, 0x03, 0x23,
-    0x37, 0x21, 0x01, 0x33, 0x13, 0x03, 0x23, 0x37,
-    0x36, 0x37, 0x36, 0x37, 0x35, 0x26, 0x27, 0x2e,
-    0x01, 0x27, 0xfb, 0xb4, 0x04, 0xa0, 0x13, 0x18,
-    0x0f, 0x08, 0x06, 0x06, 0x08, 0x08, 0x15, 0x0e,
-    0x10, 0xfb, 0x61, 0x04, 0x60, 0x6b, 0x6a, 0xe7,
-    0xe8, 0x69, 0x6b, 0xfb, 0xa0, 0x05, 0x17, 0x6a,
-    0xe7, 0xe8, 0x69, 0xbe, 0x18, 0x0f, 0x08, 0x06,
-    0x06, 0x08, 0x08, 0x15, 0x0e, 0xfa, 0x18, 0x1e,
-    0x0d, 0x07, 0x04, 0x03, 0x04, 0x08, 0x07, 0x17,
-    0x11, 0x14, 0x50, 0x87, 0xfe, 0xd9, 0xfe, 0xd9,
-    0x87, 0x01, 0xc7, 0xfe, 0xd9, 0xfe, 0xd9, 0xef,
-    0x1e, 0x0d, 0x07, 0x04, 0x03, 0x04, 0x08, 0x07,
-    0x17, 0x11, 0x00, 0x00, 0x00, 0x02, 0xfb, 0x8c,
-    0x00, 0x23, 0x02, 0x1c, 0x02, 0x71, 0x00, 0x17,
-    0x00, 0x2e, 0x00, 0x3b, 0x40, 0x38, 0x2e, 0x23,
-    0x12, 0x07, 0x04, 0x06, 0x07, 0x01, 0x4c, 0x02,
-    0x01, 0x00, 0x01, 0x03, 0x00, 0x57, 0x00, 0x01,
-    0x00, 0x07, 0x06, 0x01, 0x07, 0x68, 0x00, 0x06,
-    0x00, 0x04, 0x03, 0x06, 0x04, 0x67, 0x02, 0x01,
-    0x00, 0x00, 0x03, 0x5f, 0x05, 0x01, 0x03, 0x00,
-    0x03, 0x4f, 0x2d, 0x2c, 0x1b, 0x11, 0x11, 0x12,
-    0x11, 0x11, 0x11, 0x08, 0x09, 0x1d, 0x2b, 0x01,
-    0x27, 0x33, 0x17, 0x21, 0x27, 0x33, 0x13, 0x03,
-    0x23, 0x37, 0x21, 0x07, 0x23, 0x37, 0x36, 0x37,
-    0x36, 0x37, 0x35, 0x26, 0x27, 0x2e, 0x01, 0x17,
-    0x21, 0x37, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x37,
-    0x36, 0x37, 0x35, 0x26, 0x27, 0x2e, 0x01, 0x27,
-    0x2e, 0x01, 0x2f, 0x01, 0x21, 0x17, 0xfc, 0x46,
-    0xba, 0x6a, 0x6a, 0x04, 0xd6, 0x6b, 0x6a, 0xe7,
-    0xe8, 0x69, 0x6b, 0xfb, 0x29, 0x6a, 0x69, 0xbe,
-    0x18, 0x0f, 0x08, 0x06, 0x06, 0x08, 0x08, 0x15,
-    0x4a, 0x04, 0xd8, 0x13, 0x02, 0x03, 0x02, 0x0b,
-    0x12, 0x05, 0x07, 0x05, 0x05, 0x06, 0x06, 0x11,
-    0x0c, 0x02, 0x06, 0x03, 0x10, 0xfb, 0x29, 0x3f,
-    0x01, 0x86, 0xeb, 0x87, 0x87, 0xfe, 0xd9, 0xfe,
-    0xd9, 0x87, 0x87, 0xef, 0x1e, 0x0d, 0x07, 0x04,
-    0x03, 0x04, 0x08, 0x07, 0x17, 0x7b, 0x18, 0x02,
-    0x04, 0x02, 0x0e, 0x12, 0x05, 0x06, 0x03, 0x03,
-    0x03, 0x07, 0x05, 0x11, 0x0e, 0x03, 0x06, 0x04,
-    0x14, 0x50, 0x00, 0x00, 0x00, 0x02, 0xfb, 0x8c,
-    0x00, 0x23, 0x01, 0xf4, 0x02, 0x71, 0x00, 0x18,
-    0x00, 0x28, 0x00, 0x3c, 0x40, 0x39, 0x26, 0x1d,
-    0x15, 0x06, 0x04, 0x03, 0x02, 0x01, 0x4c, 0x06,
-    0x01, 0x00, 0x01, 0x05, 0x00, 0x57, 0x00, 0x01,
-    0x00, 0x02, 0x03, 0x01, 0x02, 0x67, 0x00, 0x03,
-    0x00, 0x04, 0x05, 0x03, 0x04, 0x67, 0x06, 0x01,
-    0x00, 0x00, 0x05, 0x5f, 0x07, 0x01, 0x05, 0x00,
-    0x05, 0x4f, 0x28, 0x27, 0x25, 0x24, 0x11, 0x11,
-    0x12, 0x11, 0x11, 0x10, 0x08, 0x09, 0x1c, 0x2b,
-    0x01, 0x33, 0x17, 0x21, 0x15, 0x21, 0x17, 0x07,
-    0x21, 0x15, 0x21, 0x07, 0x23, 0x37, 0x36, 0x37,
-    0x3e, 0x01, 0x37, 0x36, 0x37, 0x35, 0x2e, 0x01,
-    0x27, 0x05, 0x36, 0x37, 0x36, 0x37, 0x35, 0x26,
-    0x27, 0x2e, 0x01, 0x2f, 0x01, 0x33, 0x13, 0x03,
-    0x23, 0xfc, 0xae, 0x6a, 0x6a, 0x04, 0x72, 0xfb,
-    0xcc, 0x3f, 0x3f, 0x04, 0x34, 0xfb, 0x8d, 0x6a,
-    0x69, 0xbe, 0x0a, 0x0a, 0x08, 0x0c, 0x04, 0x05,
-    0x04, 0x0d, 0x22, 0x0a, 0xfe, 0xe2, 0x18, 0x0f,
-    0x08, 0x06, 0x06, 0x08, 0x08, 0x15, 0x0e, 0xba,
-    0x6a, 0xe7, 0xe8, 0x69, 0x02, 0x71, 0x87, 0x50,
-    0x50, 0x50, 0x50, 0x87, 0xef, 0x0e, 0x09, 0x09,
-    0x0c, 0x04, 0x04, 0x02, 0x03, 0x08, 0x26, 0x0d,
-    0x74, 0x1e, 0x0d, 0x07, 0x04, 0x03, 0x04, 0x08,
-    0x07, 0x17, 0x11, 0xeb, 0xfe, 0xd9, 0xfe, 0xd9,
-    0x00, 0x02, 0xfb, 0x8c, 0x00, 0x23, 0x01, 0xf4,
-    0x02, 0x71, 0x00, 0x12, 0x00, 0x22, 0x00, 0x3e,
-    0x40, 0x3b, 0x1b, 0x14, 0x0b, 0x03, 0x01, 0x00,
-    0x01, 0x4c, 0x07, 0x05, 0x06, 0x03, 0x03, 0x00,
-    0x02, 0x03, 0x57, 0x00, 0x00, 0x00, 0x01, 0x02,
-    0x00, 0x01, 0x67, 0x07, 0x05, 0x06, 0x03, 0x03,
-    0x03, 0x02, 0x5f, 0x04, 0x01, 0x02, 0x03, 0x02,
-    0x4f, 0x13, 0x13, 0x00, 0x00, 0x13, 0x22, 0x13,
-    0x22, 0x16, 0x15, 0x00, 0x12, 0x00, 0x12, 0x11,
-    0x11, 0x11, 0x08, 0x09, 0x19, 0x2b, 0x01, 0x17,
-    0x21, 0x15, 0x21, 0x07, 0x23, 0x37, 0x36, 0x37,
-    0x36, 0x37, 0x35, 0x26, 0x27, 0x2e, 0x01, 0x2f,
-    0x01, 0x23, 0x13, 0x03, 0x23, 0x37, 0x36, 0x37,
-    0x36, 0x37, 0x35, 0x26, 0x27, 0x2e, 0x01, 0x2f,
-    0x01, 0xfd, 0x18, 0xc8, 0x04, 0x14, 0xfb, 0xec,
-    0xc9, 0x69, 0xbe, 0x18, 0x0f, 0x08, 0x06, 0x06,
-    0x08, 0x08, 0x15, 0x0e, 0xba, 0xb8, 0xe7, 0xe8,
-    0x69, 0xbe, 0x18, 0x0f, 0x08, 0x06, 0x06, 0x08,
-    0x08, 0x15, 0x0e, 0xba, 0x02, 0x71, 0xff, 0x50,
-    0xff, 0xef, 0x1e, 0x0d, 0x07, 0x04, 0x03, 0x04,
-    0x08, 0x07, 0x17, 0x11, 0xeb, 0xfe, 0xd9, 0xfe,
-    0xd9, 0xef, 0x1e, 0x0d, 0x07, 0x04, 0x03, 0x04,
-    0x08, 0x07, 0x17, 0x11, 0xeb, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xfd, 0xe4, 0x00, 0x23, 0x01, 0xf4,
-    0x02, 0x71, 0x00, 0x12, 0x00, 0x2f, 0x40, 0x2c,
-    0x0b, 0x01, 0x01, 0x00, 0x01, 0x4c, 0x04, 0x01,
-    0x03, 0x00, 0x02, 0x03, 0x57, 0x00, 0x00, 0x00,
-    0x01, 0x02, 0x00, 0x01, 0x67, 0x04, 0x01, 0x03,
-    0x03, 0x02, 0x5f, 0x00, 0x02, 0x03, 0x02, 0x4f,
-    0x00, 0x00, 0x00, 0x12, 0x00, 0x12, 0x11, 0x11,
-    0x11, 0x05, 0x09, 0x19, 0x2b, 0x01, 0x17, 0x21,
-    0x15, 0x21, 0x07, 0x23, 0x37, 0x36, 0x37, 0x36,
-    0x37, 0x35, 0x26, 0x27, 0x2e, 0x01, 0x2f, 0x01,
-    0xfe, 0x4e, 0xc8, 0x02, 0xde, 0xfd, 0x22, 0xc9,
-    0x69, 0xbe, 0x18, 0x0f, 0x08, 0x06, 0x06, 0x08,
-    0x08, 0x15, 0x0e, 0xba, 0x02, 0x71, 0xff, 0x50,
-    0xff, 0xef, 0x1e, 0x0d, 0x07, 0x04, 0x03, 0x04,
-    0x08, 0x07, 0x17, 0x11, 0xeb, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xfb, 0xa5, 0x00, 0x41, 0x02, 0x03,
-    0x02, 0x53, 0x00, 0x37, 0x00, 0x48, 0x00, 0x5a,
-    0x00, 0x95, 0x40, 0x1f, 0x5a, 0x45, 0x02, 0x07,
-    0x05, 0x51, 0x3e, 0x02, 0x02, 0x07, 0x59, 0x46,
-    0x02, 0x00, 0x02, 0x03, 0x4c, 0x4a, 0x49, 0x44,
-    0x43, 0x04, 0x01, 0x4a, 0x58, 0x57, 0x48, 0x47,
-    0x04, 0x06, 0x49, 0x4b, 0xb0, 0x0e, 0x50, 0x58,
-    0x40, 0x2b, 0x00, 0x05, 0x01, 0x07, 0x02, 0x05,
-    0x72, 0x00, 0x00, 0x02, 0x06, 0x07, 0x00, 0x72,
-    0x03, 0x01, 0x01, 0x09, 0x01, 0x07, 0x02, 0x01,
-    0x07, 0x69, 0x04, 0x01, 0x02, 0x00, 0x06, 0x02,
-    0x59, 0x04, 0x01, 0x02, 0x02, 0x06, 0x62, 0x08,
-    0x01, 0x06, 0x02, 0x06, 0x52, 0x1b, 0x40, 0x2d,
-    0x00, 0x05, 0x01, 0x07, 0x01, 0x05, 0x07, 0x80,
-    0x00, 0x00, 0x02, 0x06, 0x02, 0x00, 0x06, 0x80,
-    0x03, 0x01, 0x01, 0x09, 0x01, 0x07, 0x02, 0x01,
-    0x07, 0x69, 0x04, 0x01, 0x02, 0x00, 0x06, 0x02,
-    0x59, 0x04, 0x01, 0x02, 0x02, 0x06, 0x62, 0x08,
-    0x01, 0x06, 0x02, 0x06, 0x52, 0x59, 0x40, 0x0e,
-    0x36, 0x34, 0x25, 0x23, 0x23, 0x12, 0x25, 0x25,
-    0x25, 0x23, 0x10, 0x0a, 0x09, 0x1f, 0x2b, 0x01,
-    0x23, 0x35, 0x34, 0x36, 0x33, 0x32, 0x1e, 0x04,
-    0x33, 0x32, 0x3e, 0x04, 0x33, 0x32, 0x1e, 0x04,
-    0x33, 0x32, 0x3d, 0x01, 0x33, 0x15, 0x14, 0x06,
-    0x23, 0x22, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x04,
-    0x23, 0x22, 0x2e, 0x04, 0x23, 0x22, 0x15, 0x25,
-    0x3e, 0x01, 0x37, 0x36, 0x37, 0x35, 0x26, 0x27,
-    0x26, 0x27, 0x25, 0x35, 0x05, 0x15, 0x05, 0x35,
-    0x01, 0x15, 0x05, 0x0e, 0x01, 0x07, 0x06, 0x07,
-    0x15, 0x16, 0x17, 0x1e, 0x01, 0x17, 0x05, 0x15,
-    0x25, 0x35, 0xfd, 0x80, 0x55, 0x48, 0x3a, 0x1f,
-    0x2c, 0x20, 0x18, 0x18, 0x1a, 0x11, 0x11, 0x1a,
-    0x17, 0x18, 0x20, 0x2c, 0x1f, 0x1f, 0x2c, 0x21,
-    0x19, 0x17, 0x19, 0x11, 0x2f, 0x55, 0x48, 0x3a,
-    0x2f, 0x36, 0x25, 0x22, 0x1a, 0x12, 0x19, 0x17,
-    0x18, 0x20, 0x2c, 0x1f, 0x1f, 0x2c, 0x21, 0x19,
-    0x17, 0x19, 0x11, 0x2f, 0x04, 0x0b, 0x0c, 0x14,
-    0x08, 0x08, 0x07, 0x07, 0x08, 0x11, 0x17, 0xfe,
-    0xca, 0x01, 0xae, 0xfe, 0x52, 0xfc, 0xfe, 0xfe,
-    0xca, 0x0c, 0x14, 0x08, 0x08, 0x07, 0x07, 0x08,
-    0x08, 0x14, 0x0c, 0x01, 0x36, 0xfe, 0x52, 0x01,
-    0x08, 0x28, 0x3b, 0x47, 0x13, 0x1d, 0x22, 0x1d,
-    0x13, 0x13, 0x1d, 0x22, 0x1d, 0x13, 0x13, 0x1d,
-    0x22, 0x1d, 0x13, 0x37, 0x28, 0x28, 0x3a, 0x48,
-    0x29, 0x30, 0x29, 0x13, 0x1d, 0x22, 0x1d, 0x13,
-    0x13, 0x1d, 0x22, 0x1d, 0x13, 0x37, 0x02, 0x06,
-    0x08, 0x02, 0x03, 0x01, 0x07, 0x01, 0x03, 0x03,
-    0x0c, 0x9a, 0x59, 0xd7, 0x64, 0xd7, 0x5a, 0x01,
-    0xb8, 0x5a, 0x97, 0x06, 0x08, 0x02, 0x03, 0x01,
-    0x07, 0x01, 0x02, 0x02, 0x08, 0x06, 0x9a, 0x59,
-    0xd7, 0x64, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x0c,
-    0x00, 0x23, 0x02, 0x1c, 0x02, 0x71, 0x00, 0x12,
-    0x00, 0x2e, 0x40, 0x2b, 0x08, 0x01, 0x02, 0x03,
-    0x01, 0x4c, 0x00, 0x00, 0x03, 0x01, 0x00, 0x57,
-    0x04, 0x01, 0x03, 0x00, 0x02, 0x01, 0x03, 0x02,
-    0x67, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x00, 0x01,
-    0x00, 0x01, 0x4f, 0x00, 0x00, 0x00, 0x12, 0x00,
-    0x12, 0x11, 0x1c, 0x11, 0x05, 0x09, 0x19, 0x2b,
-    0x13, 0x37, 0x33, 0x07, 0x0e, 0x01, 0x07, 0x06,
-    0x07, 0x15, 0x16, 0x17, 0x16, 0x1f, 0x01, 0x23,
-    0x27, 0x21, 0x35, 0xea, 0xc8, 0x6a, 0xba, 0x0e,
-    0x15, 0x07, 0x09, 0x06, 0x06, 0x08, 0x0f, 0x19,
-    0xbd, 0x69, 0xc9, 0xfd, 0x22, 0x01, 0x72, 0xff,
-    0xec, 0x11, 0x17, 0x07, 0x08, 0x04, 0x03, 0x04,
-    0x07, 0x0c, 0x1f, 0xee, 0xff, 0x50, 0x00, 0x00,
-    0x00, 0x02, 0xfb, 0xe6, 0x00, 0x23, 0x02, 0x1c,
-    0x02, 0x71, 0x00, 0x12, 0x00, 0x22, 0x00, 0x36,
-    0x40, 0x33, 0x1b, 0x0a, 0x02, 0x03, 0x00, 0x01,
-    0x4c, 0x04, 0x01, 0x01, 0x00, 0x02, 0x01, 0x57,
-    0x00, 0x00, 0x06, 0x01, 0x03, 0x02, 0x00, 0x03,
-    0x67, 0x04, 0x01, 0x01, 0x01, 0x02, 0x5f, 0x05,
-    0x01, 0x02, 0x01, 0x02, 0x4f, 0x00, 0x00, 0x22,
-    0x21, 0x15, 0x14, 0x00, 0x12, 0x00, 0x12, 0x1c,
-    0x11, 0x11, 0x07, 0x09, 0x19, 0x2b, 0x01, 0x35,
-    0x21, 0x37, 0x33, 0x07, 0x0e, 0x01, 0x07, 0x06,
-    0x07, 0x15, 0x16, 0x17, 0x16, 0x1f, 0x01, 0x23,
-    0x27, 0x25, 0x13, 0x33, 0x07, 0x0e, 0x01, 0x07,
-    0x06, 0x07, 0x15, 0x16, 0x17, 0x16, 0x1f, 0x01,
-    0x23, 0xfb, 0xe6, 0x03, 0xe2, 0xc8, 0x6a, 0xba,
-    0x0e, 0x15, 0x07, 0x09, 0x06, 0x06, 0x08, 0x0f,
-    0x19, 0xbd, 0x69, 0xc9, 0x01, 0x03, 0xe7, 0x6a,
-    0xba, 0x0e, 0x15, 0x07, 0x09, 0x06, 0x06, 0x08,
-    0x0f, 0x19, 0xbd, 0x69, 0x01, 0x22, 0x50, 0xff,
-    0xec, 0x11, 0x17, 0x07, 0x08, 0x04, 0x03, 0x04,
-    0x07, 0x0c, 0x1f, 0xee, 0xff, 0x28, 0x01, 0x27,
-    0xec, 0x11, 0x17, 0x07, 0x08, 0x04, 0x03, 0x04,
-    0x07, 0x0c, 0x1f, 0xee, 0x00, 0x02, 0xfb, 0xb4,
-    0x00, 0x23, 0x02, 0x1c, 0x02, 0x71, 0x00, 0x1a,
-    0x00, 0x2a, 0x00, 0x38, 0x40, 0x35, 0x23, 0x02,
-    0x02, 0x00, 0x01, 0x01, 0x4c, 0x06, 0x01, 0x03,
-    0x02, 0x04, 0x03, 0x57, 0x00, 0x02, 0x00, 0x01,
-    0x00, 0x02, 0x01, 0x67, 0x00, 0x00, 0x00, 0x05,
-    0x04, 0x00, 0x05, 0x67, 0x06, 0x01, 0x03, 0x03,
-    0x04, 0x5f, 0x07, 0x01, 0x04, 0x03, 0x04, 0x4f,
-    0x1c, 0x12, 0x11, 0x1f, 0x11, 0x11, 0x12, 0x10,
-    0x08, 0x09, 0x1e, 0x2b, 0x25, 0x21, 0x27, 0x37,
-    0x21, 0x35, 0x21, 0x37, 0x33, 0x07, 0x0e, 0x01,
-    0x07, 0x06, 0x07, 0x06, 0x07, 0x15, 0x1e, 0x03,
-    0x1f, 0x01, 0x23, 0x27, 0x21, 0x25, 0x13, 0x33,
-    0x07, 0x0e, 0x01, 0x07, 0x06, 0x07, 0x15, 0x16,
-    0x17, 0x16, 0x1f, 0x01, 0x23, 0xfb, 0xb4, 0x04,
-    0x34, 0x3f, 0x3f, 0xfb, 0xcc, 0x04, 0x72, 0x6a,
-    0x6a, 0xba, 0x07, 0x0c, 0x05, 0x11, 0x08, 0x05,
-    0x03, 0x06, 0x0f, 0x0f, 0x0e, 0x04, 0xbd, 0x69,
-    0x6a, 0xfb, 0x8d, 0x05, 0x17, 0xe7, 0x6a, 0xba,
-    0x0e, 0x15, 0x07, 0x09, 0x06, 0x06, 0x08, 0x0f,
-    0x19, 0xbd, 0x69, 0xfa, 0x50, 0x50, 0x50, 0x87,
-    0xec, 0x08, 0x0f, 0x05, 0x13, 0x05, 0x05, 0x02,
-    0x03, 0x03, 0x0e, 0x10, 0x0f, 0x06, 0xee, 0x87,
-    0xa0, 0x01, 0x27, 0xec, 0x11, 0x17, 0x07, 0x08,
-    0x04, 0x03, 0x04, 0x07, 0x0c, 0x1f, 0xee, 0x00,
-    0x00, 0x03, 0xfb, 0xb4, 0x01, 0x22, 0x01, 0xf4,
-    0x01, 0x72, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b,
-    0x00, 0x32, 0x40, 0x2f, 0x04, 0x02, 0x06, 0x03,
-    0x01, 0x00, 0x00, 0x01, 0x57, 0x04, 0x02, 0x06,
-    0x03, 0x01, 0x01, 0x00, 0x5f, 0x07, 0x05, 0x03,
-    0x03, 0x00, 0x01, 0x00, 0x4f, 0x08, 0x08, 0x00,
-    0x00, 0x08, 0x0b, 0x08, 0x0b, 0x0a, 0x09, 0x07,
-    0x06, 0x05, 0x04, 0x00, 0x03, 0x00, 0x03, 0x11,
-    0x08, 0x09, 0x17, 0x2b, 0x01, 0x15, 0x21, 0x35,
-    0x29, 0x01, 0x15, 0x29, 0x01, 0x35, 0x21, 0x15,
-    0x01, 0xf4, 0xfe, 0x2a, 0xfd, 0xcb, 0x01, 0xd6,
-    0xfe, 0x2a, 0xfd, 0xcb, 0x01, 0xd6, 0x01, 0x72,
-    0x50, 0x50, 0x50, 0x50, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xfb, 0x8c, 0x00, 0x23, 0x01, 0xfe,
-    0x02, 0x71, 0x00, 0x12, 0x00, 0x2d, 0x40, 0x2a,
-    0x12, 0x01, 0x04, 0x01, 0x01, 0x4c, 0x02, 0x01,
-    0x00, 0x01, 0x03, 0x00, 0x57, 0x00, 0x01, 0x00,
-    0x04, 0x03, 0x01, 0x04, 0x68, 0x02, 0x01, 0x00,
-    0x00, 0x03, 0x5f, 0x05, 0x01, 0x03, 0x00, 0x03,
-    0x4f, 0x14, 0x11, 0x11, 0x11, 0x14, 0x10, 0x06,
-    0x09, 0x1c, 0x2b, 0x01, 0x33, 0x07, 0x0e, 0x01,
-    0x07, 0x21, 0x35, 0x33, 0x11, 0x23, 0x35, 0x21,
-    0x1e, 0x01, 0x1f, 0x01, 0x23, 0x03, 0xfc, 0x73,
-    0x6a, 0xba, 0x05, 0x07, 0x04, 0x05, 0x91, 0x5a,
-    0x5a, 0xfa, 0x6e, 0x03, 0x07, 0x04, 0xbd, 0x69,
-    0xe8, 0x02, 0x71, 0xec, 0x05, 0x09, 0x05, 0xff,
-    0xfd, 0xb2, 0xff, 0x04, 0x08, 0x05, 0xee, 0x01,
-    0x27, 0x00, 0x00, 0x00, 0x00, 0x02, 0xfb, 0x8c,
-    0x00, 0x23, 0x01, 0xfe, 0x02, 0x71, 0x00, 0x0c,
-    0x00, 0x1c, 0x00, 0x38, 0x40, 0x35, 0x1c, 0x0c,
-    0x02, 0x06, 0x07, 0x01, 0x4c, 0x02, 0x01, 0x00,
-    0x01, 0x03, 0x00, 0x57, 0x00, 0x01, 0x00, 0x07,
-    0x06, 0x01, 0x07, 0x68, 0x00, 0x06, 0x00, 0x04,
-    0x03, 0x06, 0x04, 0x67, 0x02, 0x01, 0x00, 0x00,
-    0x03, 0x5f, 0x05, 0x01, 0x03, 0x00, 0x03, 0x4f,
-    0x11, 0x18, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10,
-    0x08, 0x09, 0x1e, 0x2b, 0x01, 0x33, 0x07, 0x21,
-    0x35, 0x33, 0x11, 0x23, 0x35, 0x21, 0x17, 0x23,
-    0x03, 0x17, 0x16, 0x17, 0x1e, 0x01, 0x1f, 0x01,
-    0x21, 0x35, 0x21, 0x07, 0x0e, 0x01, 0x07, 0x06,
-    0x07, 0xfc, 0x73, 0x6a, 0x6a, 0x05, 0x31, 0x5a,
-    0x5a, 0xfa, 0xce, 0x6b, 0x69, 0xe8, 0x5e, 0x06,
-    0x08, 0x07, 0x14, 0x0d, 0x12, 0x05, 0x72, 0xfa,
-    0x90, 0x11, 0x0e, 0x15, 0x07, 0x09, 0x06, 0x02,
-    0x71, 0x87, 0x87, 0xfd, 0xb2, 0x87, 0x87, 0x01,
-    0x27, 0x03, 0x04, 0x07, 0x06, 0x15, 0x10, 0x17,
-    0xa0, 0x15, 0x11, 0x17, 0x07, 0x08, 0x04, 0x00,
-    0x00, 0x01, 0xfe, 0x6b, 0x00, 0x00, 0x01, 0x95,
-    0x02, 0xda, 0x00, 0x11, 0x00, 0x50, 0xb5, 0x0a,
-    0x01, 0x01, 0x00, 0x01, 0x4c, 0x4b, 0xb0, 0x17,
-    0x50, 0x58, 0x40, 0x0d, 0x00, 0x00, 0x00, 0x3c,
-    0x4d, 0x03, 0x02, 0x02, 0x01, 0x01, 0x3b, 0x01,
-    0x4e, 0x1b, 0x4b, 0xb0, 0x31, 0x50, 0x58, 0x40,
-    0x0d, 0x00, 0x00, 0x00, 0x3a, 0x4d, 0x03, 0x02,
-    0x02, 0x01, 0x01, 0x3b, 0x01, 0x4e, 0x1b, 0x40,
-    0x0d, 0x00, 0x00, 0x01, 0x00, 0x85, 0x03, 0x02,
-    0x02, 0x01, 0x01, 0x3b, 0x01, 0x4e, 0x59, 0x59,
-    0x40, 0x0b, 0x00, 0x00, 0x00, 0x11, 0x00, 0x11,
-    0x11, 0x11, 0x04, 0x09, 0x18, 0x2b, 0x21, 0x01,
-    0x33, 0x01, 0x23, 0x01, 0x2e, 0x01, 0x27, 0x26,
-    0x27, 0x23, 0x06, 0x07, 0x0e, 0x01, 0x07, 0x01,
-    0xfe, 0x6b, 0x01, 0x5f, 0x6c, 0x01, 0x5f, 0x60,
-    0xfe, 0xfe, 0x0c, 0x12, 0x06, 0x07, 0x05, 0x06,
-    0x05, 0x08, 0x06, 0x13, 0x0c, 0xfe, 0xfe, 0x02,
-    0xda, 0xfd, 0x26, 0x02, 0x1c, 0x1a, 0x2a, 0x0f,
-    0x12, 0x0e, 0x0e, 0x12, 0x0f, 0x2a, 0x1a, 0xfd,
-    0xe4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x6b,
-    0x00, 0x00, 0x01, 0x95, 0x02, 0xda, 0x00, 0x11,
-    0x00, 0x47, 0xb5, 0x07, 0x01, 0x02, 0x00, 0x01,
-    0x4c, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x0c,
-    0x01, 0x01, 0x00, 0x00, 0x3c, 0x4d, 0x00, 0x02,
-    0x02, 0x3b, 0x02, 0x4e, 0x1b, 0x4b, 0xb0, 0x31,
-    0x50, 0x58, 0x40, 0x0c, 0x01, 0x01, 0x00, 0x00,
-    0x3a, 0x4d, 0x00, 0x02, 0x02, 0x3b, 0x02, 0x4e,
-    0x1b, 0x40, 0x0c, 0x01, 0x01, 0x00, 0x02, 0x00,
-    0x85, 0x00, 0x02, 0x02, 0x3b, 0x02, 0x4e, 0x59,
-    0x59, 0xb5, 0x11, 0x1d, 0x10, 0x03, 0x09, 0x19,
-    0x2b, 0x01, 0x33, 0x01, 0x1e, 0x01, 0x17, 0x16,
-    0x17, 0x33, 0x36, 0x37, 0x3e, 0x01, 0x37, 0x01,
-    0x33, 0x01, 0x23, 0xfe, 0x6b, 0x60, 0x01, 0x02,
-    0x0c, 0x12, 0x06, 0x07, 0x05, 0x06, 0x05, 0x08,
-    0x06, 0x13, 0x0c, 0x01, 0x02, 0x5e, 0xfe, 0xa1,
-    0x6c, 0x02, 0xda, 0xfd, 0xe4, 0x1a, 0x2a, 0x0f,
-    0x12, 0x0e, 0x0e, 0x12, 0x0f, 0x2a, 0x1a, 0x02,
-    0x1c, 0xfd, 0x26, 0x00, 0x00, 0x02, 0xfb, 0xaa,
-    0x00, 0x23, 0x02, 0x1c, 0x02, 0x71, 0x00, 0x0c,
-    0x00, 0x22, 0x00, 0x45, 0x40, 0x42, 0x19, 0x07,
-    0x02, 0x06, 0x07, 0x01, 0x4c, 0x02, 0x01, 0x00,
-    0x01, 0x03, 0x00, 0x57, 0x00, 0x01, 0x09, 0x01,
-    0x07, 0x06, 0x01, 0x07, 0x68, 0x00, 0x06, 0x00,
-    0x04, 0x03, 0x06, 0x04, 0x67, 0x02, 0x01, 0x00,
-    0x00, 0x03, 0x5f, 0x08, 0x05, 0x02, 0x03, 0x00,
-    0x03, 0x4f, 0x0d, 0x0d, 0x00, 0x00, 0x0d, 0x22,
-    0x0d, 0x22, 0x0f, 0x0e, 0x00, 0x0c, 0x00, 0x0c,
-    0x11, 0x12, 0x11, 0x11, 0x11, 0x0a, 0x09, 0x1b,
-    0x2b, 0x25, 0x11, 0x33, 0x15, 0x21, 0x27, 0x33,
-    0x13, 0x03, 0x23, 0x37, 0x21, 0x15, 0x11, 0x15,
-    0x21, 0x37, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x37,
-    0x36, 0x37, 0x35, 0x26, 0x27, 0x2e, 0x01, 0x27,
-    0x2e, 0x01, 0x2f, 0x01, 0xfb, 0xaa, 0x5a, 0x05,
-    0x32, 0x6b, 0x6a, 0xe7, 0xe8, 0x69, 0x6b, 0xfa,
-    0xce, 0x05, 0x72, 0x13, 0x02, 0x03, 0x02, 0x0b,
-    0x12, 0x05, 0x07, 0x05, 0x05, 0x06, 0x06, 0x11,
-    0x0c, 0x02, 0x06, 0x03, 0x10, 0x23, 0x02, 0x4e,
-    0x87, 0x87, 0xfe, 0xd9, 0xfe, 0xd9, 0x87, 0x87,
-    0x01, 0x77, 0xa0, 0x18, 0x02, 0x04, 0x02, 0x0e,
-    0x12, 0x05, 0x06, 0x03, 0x03, 0x03, 0x07, 0x05,
-    0x11, 0x0e, 0x03, 0x06, 0x04, 0x14, 0x00, 0x00,
-    0x00, 0x01, 0xfb, 0xaa, 0x00, 0x23, 0x02, 0x1c,
-    0x02, 0x71, 0x00, 0x12, 0x00, 0x33, 0x40, 0x30,
-    0x0a, 0x01, 0x04, 0x01, 0x01, 0x4c, 0x02, 0x01,
-    0x00, 0x01, 0x03, 0x00, 0x57, 0x00, 0x01, 0x00,
-    0x04, 0x03, 0x01, 0x04, 0x68, 0x02, 0x01, 0x00,
-    0x00, 0x03, 0x5f, 0x06, 0x05, 0x02, 0x03, 0x00,
-    0x03, 0x4f, 0x00, 0x00, 0x00, 0x12, 0x00, 0x12,
-    0x23, 0x12, 0x14, 0x11, 0x11, 0x07, 0x09, 0x1b,
-    0x2b, 0x25, 0x11, 0x33, 0x15, 0x21, 0x2e, 0x01,
-    0x2f, 0x01, 0x33, 0x13, 0x03, 0x23, 0x37, 0x3e,
-    0x01, 0x37, 0x21, 0x15, 0xfb, 0xaa, 0x5a, 0x05,
-    0x92, 0x04, 0x08, 0x05, 0xba, 0x6a, 0xe7, 0xe8,
-    0x69, 0xbe, 0x04, 0x06, 0x03, 0xfa, 0x6e, 0x23,
-    0x02, 0x4e, 0xff, 0x05, 0x09, 0x06, 0xeb, 0xfe,
-    0xd9, 0xfe, 0xd9, 0xef, 0x05, 0x07, 0x04, 0xff,
-    0x00, 0x01, 0xfb, 0x8c, 0x00, 0x23, 0x02, 0x12,
-    0x02, 0x71, 0x00, 0x77, 0x00, 0xa7, 0x40, 0x0a,
-    0x02, 0x01, 0x08, 0x02, 0x77, 0x01, 0x01, 0x0a,
-    0x02, 0x4c, 0x4b, 0xb0, 0x0e, 0x50, 0x58, 0x40,
-    0x37, 0x00, 0x00, 0x02, 0x00, 0x85, 0x00, 0x08,
-    0x02, 0x0a, 0x01, 0x08, 0x72, 0x00, 0x11, 0x09,
-    0x11, 0x86, 0x06, 0x04, 0x02, 0x02, 0x10, 0x0e,
-    0x0c, 0x03, 0x0a, 0x01, 0x02, 0x0a, 0x69, 0x07,
-    0x05, 0x03, 0x03, 0x01, 0x09, 0x09, 0x01, 0x59,
-    0x07, 0x05, 0x03, 0x03, 0x01, 0x01, 0x09, 0x62,
-    0x0f, 0x0d, 0x0b, 0x03, 0x09, 0x01, 0x09, 0x52,
-    0x1b, 0x40, 0x38, 0x00, 0x00, 0x02, 0x00, 0x85,
-    0x00, 0x08, 0x02, 0x0a, 0x02, 0x08, 0x0a, 0x80,
-    0x00, 0x11, 0x09, 0x11, 0x86, 0x06, 0x04, 0x02,
-    0x02, 0x10, 0x0e, 0x0c, 0x03, 0x0a, 0x01, 0x02,
-    0x0a, 0x69, 0x07, 0x05, 0x03, 0x03, 0x01, 0x09,
-    0x09, 0x01, 0x59, 0x07, 0x05, 0x03, 0x03, 0x01,
-    0x01, 0x09, 0x62, 0x0f, 0x0d, 0x0b, 0x03, 0x09,
-    0x01, 0x09, 0x52, 0x59, 0x40, 0x1e, 0x76, 0x75,
-    0x68, 0x67, 0x62, 0x60, 0x5b, 0x59, 0x54, 0x52,
-    0x4d, 0x4b, 0x46, 0x44, 0x3f, 0x3d, 0x3a, 0x38,
-    0x12, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
-    0x10, 0x12, 0x09, 0x1f, 0x2b, 0x01, 0x33, 0x07,
-    0x1e, 0x03, 0x33, 0x32, 0x3e, 0x04, 0x33, 0x32,
-    0x1e, 0x04, 0x33, 0x32, 0x3e, 0x04, 0x33, 0x32,
-    0x1e, 0x04, 0x33, 0x32, 0x3e, 0x04, 0x33, 0x32,
-    0x1e, 0x04, 0x33, 0x32, 0x3d, 0x01, 0x33, 0x15,
-    0x14, 0x06, 0x23, 0x22, 0x2e, 0x02, 0x23, 0x22,
-    0x0e, 0x04, 0x23, 0x22, 0x2e, 0x04, 0x23, 0x22,
-    0x0e, 0x04, 0x23, 0x22, 0x2e, 0x04, 0x23, 0x22,
-    0x0e, 0x04, 0x23, 0x22, 0x2e, 0x04, 0x2b, 0x01,
-    0x0e, 0x01, 0x07, 0x06, 0x07, 0x15, 0x16, 0x17,
-    0x1e, 0x01, 0x1f, 0x01, 0x23, 0x03, 0xfc, 0x73,
-    0x6a, 0x9d, 0x1d, 0x26, 0x1e, 0x1f, 0x16, 0x11,
-    0x1a, 0x18, 0x19, 0x21, 0x2c, 0x1f, 0x1f, 0x2c,
-    0x21, 0x19, 0x18, 0x19, 0x12, 0x11, 0x1a, 0x18,
-    0x19, 0x21, 0x2c, 0x1f, 0x1f, 0x2d, 0x23, 0x1a,
-    0x19, 0x1a, 0x11, 0x12, 0x1a, 0x19, 0x1a, 0x22,
-    0x2d, 0x1f, 0x1f, 0x2c, 0x21, 0x19, 0x17, 0x19,
-    0x11, 0x2f, 0x55, 0x47, 0x3b, 0x2f, 0x36, 0x25,
-    0x22, 0x1a, 0x11, 0x1b, 0x1a, 0x1a, 0x23, 0x2d,
-    0x1f, 0x1f, 0x2d, 0x22, 0x1a, 0x19, 0x1b, 0x11,
-    0x12, 0x19, 0x18, 0x19, 0x21, 0x2c, 0x1f, 0x1f,
-    0x2c, 0x21, 0x19, 0x18, 0x19, 0x12, 0x12, 0x19,
-    0x18, 0x19, 0x21, 0x2c, 0x1f, 0x1f, 0x2c, 0x21,
-    0x19, 0x18, 0x1a, 0x11, 0x04, 0x08, 0x0c, 0x04,
-    0x05, 0x03, 0x06, 0x08, 0x07, 0x14, 0x0d, 0xbd,
-    0x69, 0xe8, 0x02, 0x71, 0xc7, 0x0b, 0x29, 0x28,
-    0x1e, 0x13, 0x1d, 0x22, 0x1d, 0x13, 0x13, 0x1d,
-    0x22, 0x1d, 0x13, 0x13, 0x1d, 0x22, 0x1d, 0x13,
-    0x13, 0x1d, 0x22, 0x1d, 0x13, 0x13, 0x1d, 0x22,
-    0x1d, 0x13, 0x13, 0x1d, 0x22, 0x1d, 0x13, 0x37,
-    0x28, 0x28, 0x3a, 0x48, 0x29, 0x30, 0x29, 0x13,
-    0x1d, 0x22, 0x1d, 0x13, 0x13, 0x1d, 0x22, 0x1d,
-    0x13, 0x13, 0x1d, 0x22, 0x1d, 0x13, 0x13, 0x1d,
-    0x22, 0x1d, 0x13, 0x13, 0x1d, 0x22, 0x1d, 0x13,
-    0x13, 0x1d, 0x22, 0x1d, 0x13, 0x08, 0x0b, 0x04,
-    0x04, 0x02, 0x03, 0x04, 0x07, 0x06, 0x15, 0x10,
-    0xee, 0x01, 0x27, 0x00, 0x00, 0x01, 0xfd, 0xe4,
-    0x00, 0x23, 0x02, 0x12, 0x02, 0x71, 0x00, 0x47,
-    0x00, 0x94, 0xb5, 0x45, 0x01, 0x07, 0x03, 0x01,
-    0x4c, 0x4b, 0xb0, 0x0e, 0x50, 0x58, 0x40, 0x36,
-    0x00, 0x00, 0x02, 0x00, 0x85, 0x00, 0x06, 0x02,
-    0x08, 0x03, 0x06, 0x72, 0x00, 0x01, 0x08, 0x03,
-    0x08, 0x01, 0x03, 0x80, 0x00, 0x0b, 0x07, 0x0b,
-    0x86, 0x04, 0x01, 0x02, 0x0a, 0x01, 0x08, 0x01,
-    0x02, 0x08, 0x6a, 0x05, 0x01, 0x03, 0x07, 0x07,
-    0x03, 0x59, 0x05, 0x01, 0x03, 0x03, 0x07, 0x62,
-    0x09, 0x01, 0x07, 0x03, 0x07, 0x52, 0x1b, 0x40,
-    0x37, 0x00, 0x00, 0x02, 0x00, 0x85, 0x00, 0x06,
-    0x02, 0x08, 0x02, 0x06, 0x08, 0x80, 0x00, 0x01,
-    0x08, 0x03, 0x08, 0x01, 0x03, 0x80, 0x00, 0x0b,
-    0x07, 0x0b, 0x86, 0x04, 0x01, 0x02, 0x0a, 0x01,
-    0x08, 0x01, 0x02, 0x08, 0x6a, 0x05, 0x01, 0x03,
-    0x07, 0x07, 0x03, 0x59, 0x05, 0x01, 0x03, 0x03,
-    0x07, 0x62, 0x09, 0x01, 0x07, 0x03, 0x07, 0x52,
-    0x59, 0x40, 0x12, 0x47, 0x46, 0x41, 0x3f, 0x3a,
-    0x38, 0x23, 0x23, 0x12, 0x25, 0x25, 0x25, 0x25,
-    0x26, 0x11, 0x0c, 0x09, 0x1f, 0x2b, 0x01, 0x13,
-    0x33, 0x07, 0x0e, 0x01, 0x07, 0x06, 0x07, 0x33,
-    0x32, 0x3e, 0x04, 0x33, 0x32, 0x1e, 0x04, 0x33,
-    0x32, 0x3e, 0x04, 0x33, 0x32, 0x1e, 0x04, 0x33,
-    0x32, 0x3d, 0x01, 0x33, 0x15, 0x14, 0x06, 0x23,
-    0x22, 0x2e, 0x02, 0x23, 0x22, 0x0e, 0x04, 0x23,
-    0x22, 0x2e, 0x04, 0x23, 0x22, 0x0e, 0x02, 0x07,
-    0x17, 0x23, 0xfd, 0xe4, 0xe7, 0x6a, 0xba, 0x0e,
-    0x15, 0x07, 0x09, 0x06, 0x24, 0x11, 0x1a, 0x18,
-    0x19, 0x21, 0x2c, 0x1f, 0x1f, 0x2d, 0x23, 0x1a,
-    0x19, 0x1a, 0x11, 0x12, 0x1a, 0x19, 0x1a, 0x22,
-    0x2d, 0x1f, 0x1f, 0x2c, 0x21, 0x19, 0x17, 0x19,
-    0x11, 0x2f, 0x55, 0x47, 0x3b, 0x2f, 0x36, 0x25,
-    0x22, 0x1a, 0x11, 0x1b, 0x1a, 0x1a, 0x23, 0x2d,
-    0x1f, 0x1f, 0x2d, 0x22, 0x1a, 0x19, 0x1b, 0x11,
-    0x18, 0x22, 0x24, 0x2d, 0x22, 0xb4, 0x69, 0x01,
-    0x4a, 0x01, 0x27, 0xec, 0x11, 0x17, 0x07, 0x08,
-    0x04, 0x0f, 0x18, 0x1a, 0x18, 0x0f, 0x13, 0x1d,
-    0x22, 0x1d, 0x13, 0x13, 0x1d, 0x22, 0x1d, 0x13,
-    0x13, 0x1d, 0x22, 0x1d, 0x13, 0x37, 0x28, 0x28,
-    0x3a, 0x48, 0x29, 0x30, 0x29, 0x13, 0x1d, 0x22,
-    0x1d, 0x13, 0x13, 0x1d, 0x22, 0x1d, 0x13, 0x1a,
-    0x22, 0x20, 0x05, 0xe3, 0x00, 0x01, 0xfe, 0x57,
-    0x00, 0xe5, 0x01, 0xae, 0x01, 0xb2, 0x00, 0x37,
-    0x00, 0x7a, 0x4b, 0xb0, 0x0e, 0x50, 0x58, 0x40,
-    0x2c, 0x00, 0x04, 0x00, 0x06, 0x01, 0x04, 0x72,
-    0x0a, 0x01, 0x09, 0x01, 0x05, 0x06, 0x09, 0x72,
-    0x02, 0x01, 0x00, 0x08, 0x01, 0x06, 0x01, 0x00,
-    0x06, 0x69, 0x03, 0x01, 0x01, 0x09, 0x05, 0x01,
-    0x59, 0x03, 0x01, 0x01, 0x01, 0x05, 0x62, 0x07,
-    0x01, 0x05, 0x01, 0x05, 0x52, 0x1b, 0x40, 0x2e,
-    0x00, 0x04, 0x00, 0x06, 0x00, 0x04, 0x06, 0x80,
-    0x0a, 0x01, 0x09, 0x01, 0x05, 0x01, 0x09, 0x05,
-    0x80, 0x02, 0x01, 0x00, 0x08, 0x01, 0x06, 0x01,
-    0x00, 0x06, 0x69, 0x03, 0x01, 0x01, 0x09, 0x05,
-    0x01, 0x59, 0x03, 0x01, 0x01, 0x01, 0x05, 0x62,
-    0x07, 0x01, 0x05, 0x01, 0x05, 0x52, 0x59, 0x40,
-    0x12, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x25,
-    0x25, 0x23, 0x23, 0x12, 0x25, 0x25, 0x25, 0x23,
-    0x0b, 0x09, 0x1f, 0x2b, 0x01, 0x35, 0x34, 0x36,
-    0x33, 0x32, 0x1e, 0x04, 0x33, 0x32, 0x3e, 0x04,
-    0x33, 0x32, 0x1e, 0x04, 0x33, 0x32, 0x3d, 0x01,
-    0x33, 0x15, 0x14, 0x06, 0x23, 0x22, 0x2e, 0x02,
-    0x23, 0x22, 0x0e, 0x04, 0x23, 0x22, 0x2e, 0x04,
-    0x23, 0x22, 0x1d, 0x01, 0xfe, 0x57, 0x47, 0x3b,
-    0x1f, 0x2c, 0x20, 0x18, 0x18, 0x19, 0x12, 0x11,
-    0x1a, 0x17, 0x18, 0x20, 0x2c, 0x1f, 0x1f, 0x2c,
-    0x21, 0x19, 0x17, 0x19, 0x11, 0x2f, 0x55, 0x47,
-    0x3b, 0x2f, 0x36, 0x25, 0x22, 0x1a, 0x11, 0x1a,
-    0x17, 0x18, 0x20, 0x2c, 0x1f, 0x1f, 0x2c, 0x21,
-    0x19, 0x17, 0x19, 0x11, 0x2f, 0x01, 0x08, 0x28,
-    0x3b, 0x47, 0x13, 0x1d, 0x22, 0x1d, 0x13, 0x13,
-    0x1d, 0x22, 0x1d, 0x13, 0x13, 0x1d, 0x22, 0x1d,
-    0x13, 0x37, 0x28, 0x28, 0x3a, 0x48, 0x29, 0x30,
-    0x29, 0x13, 0x1d, 0x22, 0x1d, 0x13, 0x13, 0x1d,
-    0x22, 0x1d, 0x13, 0x37, 0x28, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xfb, 0x96, 0x00, 0x23, 0x02, 0x1c,
-    0x02, 0x71, 0x00, 0x76, 0x00, 0xf0, 0x40, 0x0b,
-    0x33, 0x01, 0x00, 0x02, 0x3d, 0x36, 0x02, 0x01,
-    0x0a, 0x02, 0x4c, 0x4b, 0xb0, 0x0e, 0x50, 0x58,
-    0x40, 0x37, 0x00, 0x08, 0x02, 0x08, 0x85, 0x00,
-    0x00, 0x02, 0x0a, 0x01, 0x00, 0x72, 0x00, 0x09,
-    0x0b, 0x09, 0x86, 0x06, 0x04, 0x02, 0x02, 0x10,
-    0x0e, 0x0c, 0x03, 0x0a, 0x01, 0x02, 0x0a, 0x69,
-    0x07, 0x05, 0x03, 0x03, 0x01, 0x0b, 0x0b, 0x01,
-    0x59, 0x07, 0x05, 0x03, 0x03, 0x01, 0x01, 0x0b,
-    0x62, 0x11, 0x0f, 0x0d, 0x03, 0x0b, 0x01, 0x0b,
-    0x52, 0x1b, 0x4b, 0xb0, 0x18, 0x50, 0x58, 0x40,
-    0x38, 0x00, 0x08, 0x02, 0x08, 0x85, 0x00, 0x00,
-    0x02, 0x0a, 0x02, 0x00, 0x0a, 0x80, 0x00, 0x09,
-    0x0b, 0x09, 0x86, 0x06, 0x04, 0x02, 0x02, 0x10,
-    0x0e, 0x0c, 0x03, 0x0a, 0x01, 0x02, 0x0a, 0x69,
-    0x07, 0x05, 0x03, 0x03, 0x01, 0x0b, 0x0b, 0x01,
-    0x59, 0x07, 0x05, 0x03, 0x03, 0x01, 0x01, 0x0b,
-    0x62, 0x11, 0x0f, 0x0d, 0x03, 0x0b, 0x01, 0x0b,
-    0x52, 0x1b, 0x40, 0x3f, 0x00, 0x08, 0x02, 0x08,
-    0x85, 0x00, 0x00, 0x02, 0x0c, 0x02, 0x00, 0x0c,
-    0x80, 0x00, 0x0a, 0x0c, 0x01, 0x0c, 0x0a, 0x01,
-    0x80, 0x00, 0x09, 0x0b, 0x09, 0x86, 0x06, 0x04,
-    0x02, 0x02, 0x10, 0x0e, 0x02, 0x0c, 0x0a, 0x02,
-    0x0c, 0x69, 0x07, 0x05, 0x03, 0x03, 0x01, 0x0b,
-    0x0b, 0x01, 0x59, 0x07, 0x05, 0x03, 0x03, 0x01,
-    0x01, 0x0b, 0x62, 0x11, 0x0f, 0x0d, 0x03, 0x0b,
-    0x01, 0x0b, 0x52, 0x59, 0x59, 0x40, 0x1e, 0x74,
-    0x72, 0x6f, 0x6d, 0x68, 0x66, 0x61, 0x5f, 0x5a,
-    0x58, 0x53, 0x51, 0x4c, 0x4a, 0x45, 0x43, 0x38,
-    0x37, 0x15, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
-    0x22, 0x10, 0x12, 0x09, 0x1f, 0x2b, 0x01, 0x33,
-    0x15, 0x14, 0x33, 0x32, 0x3e, 0x04, 0x33, 0x32,
-    0x1e, 0x04, 0x33, 0x32, 0x3e, 0x04, 0x33, 0x32,
-    0x1e, 0x04, 0x33, 0x32, 0x3e, 0x04, 0x33, 0x32,
-    0x1e, 0x04, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x27,
-    0x33, 0x13, 0x03, 0x23, 0x37, 0x36, 0x37, 0x36,
-    0x37, 0x35, 0x26, 0x27, 0x2e, 0x01, 0x27, 0x23,
-    0x22, 0x0e, 0x04, 0x23, 0x22, 0x2e, 0x04, 0x23,
-    0x22, 0x0e, 0x04, 0x23, 0x22, 0x2e, 0x04, 0x23,
-    0x22, 0x0e, 0x04, 0x23, 0x22, 0x2e, 0x04, 0x23,
-    0x22, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x35, 0xfb,
-    0x96, 0x55, 0x2f, 0x11, 0x19, 0x17, 0x19, 0x21,
-    0x2c, 0x1f, 0x1f, 0x2d, 0x22, 0x1a, 0x19, 0x1b,
-    0x11, 0x11, 0x1a, 0x19, 0x1a, 0x23, 0x2d, 0x1f,
-    0x1f, 0x2c, 0x21, 0x19, 0x18, 0x1a, 0x11, 0x11,
-    0x1a, 0x18, 0x19, 0x21, 0x2c, 0x1f, 0x1f, 0x2c,
-    0x21, 0x19, 0x18, 0x19, 0x12, 0x17, 0x1f, 0x20,
-    0x28, 0x1f, 0xa4, 0x6a, 0xe7, 0xe8, 0x69, 0xbe,
-    0x18, 0x0f, 0x08, 0x06, 0x02, 0x03, 0x03, 0x08,
-    0x05, 0x0f, 0x11, 0x1a, 0x18, 0x19, 0x21, 0x2c,
-    0x1f, 0x1f, 0x2c, 0x21, 0x19, 0x18, 0x1a, 0x11,
-    0x12, 0x19, 0x18, 0x19, 0x21, 0x2c, 0x1f, 0x1f,
-    0x2c, 0x21, 0x19, 0x18, 0x1a, 0x11, 0x12, 0x1a,
-    0x19, 0x1a, 0x22, 0x2d, 0x1f, 0x1f, 0x2e, 0x22,
-    0x1a, 0x1a, 0x1b, 0x11, 0x1a, 0x22, 0x25, 0x36,
-    0x2f, 0x3b, 0x47, 0x01, 0x8f, 0x28, 0x37, 0x13,
-    0x1d, 0x22, 0x1d, 0x13, 0x13, 0x1d, 0x22, 0x1d,
-    0x13, 0x13, 0x1d, 0x22, 0x1d, 0x13, 0x13, 0x1d,
-    0x22, 0x1d, 0x13, 0x13, 0x1d, 0x22, 0x1d, 0x13,
-    0x13, 0x1d, 0x22, 0x1d, 0x13, 0x1d, 0x27, 0x25,
-    0x09, 0xcf, 0xfe, 0xd9, 0xfe, 0xd9, 0xef, 0x1e,
-    0x0d, 0x07, 0x04, 0x03, 0x01, 0x03, 0x02, 0x07,
-    0x05, 0x12, 0x1a, 0x20, 0x1a, 0x12, 0x13, 0x1d,
-    0x22, 0x1d, 0x13, 0x13, 0x1d, 0x22, 0x1d, 0x13,
-    0x13, 0x1d, 0x22, 0x1d, 0x13, 0x13, 0x1d, 0x22,
-    0x1d, 0x13, 0x13, 0x1d, 0x22, 0x1d, 0x13, 0x29,
-    0x30, 0x29, 0x48, 0x3a, 0x00, 0x01, 0xfd, 0xee,
-    0x00, 0x23, 0x02, 0x1c, 0x02, 0x71, 0x00, 0x48,
-    0x00, 0x9a, 0x40, 0x0b, 0x2d, 0x01, 0x09, 0x01,
-    0x01, 0x4c, 0x2a, 0x01, 0x05, 0x01, 0x4b, 0x4b,
-    0xb0, 0x0e, 0x50, 0x58, 0x40, 0x36, 0x00, 0x06,
-    0x02, 0x06, 0x85, 0x00, 0x00, 0x02, 0x08, 0x01,
-    0x00, 0x72, 0x00, 0x05, 0x08, 0x01, 0x08, 0x05,
-    0x01, 0x80, 0x00, 0x07, 0x09, 0x07, 0x86, 0x04,
-    0x01, 0x02, 0x0a, 0x01, 0x08, 0x05, 0x02, 0x08,
-    0x6a, 0x03, 0x01, 0x01, 0x09, 0x09, 0x01, 0x59,
-    0x03, 0x01, 0x01, 0x01, 0x09, 0x62, 0x0b, 0x01,
-    0x09, 0x01, 0x09, 0x52, 0x1b, 0x40, 0x37, 0x00,
-    0x06, 0x02, 0x06, 0x85, 0x00, 0x00, 0x02, 0x08,
-    0x02, 0x00, 0x08, 0x80, 0x00, 0x05, 0x08, 0x01,
-    0x08, 0x05, 0x01, 0x80, 0x00, 0x07, 0x09, 0x07,
-    0x86, 0x04, 0x01, 0x02, 0x0a, 0x01, 0x08, 0x05,
-    0x02, 0x08, 0x6a, 0x03, 0x01, 0x01, 0x09, 0x09,
-    0x01, 0x59, 0x03, 0x01, 0x01, 0x01, 0x09, 0x62,
-    0x0b, 0x01, 0x09, 0x01, 0x09, 0x52, 0x59, 0x40,
-    0x12, 0x46, 0x44, 0x41, 0x3f, 0x3a, 0x38, 0x25,
-    0x12, 0x17, 0x25, 0x25, 0x25, 0x25, 0x22, 0x10,
-    0x0c, 0x09, 0x1f, 0x2b, 0x01, 0x33, 0x15, 0x14,
-    0x33, 0x32, 0x3e, 0x04, 0x33, 0x32, 0x1e, 0x04,
-    0x33, 0x32, 0x3e, 0x04, 0x33, 0x32, 0x1e, 0x04,
-    0x3b, 0x01, 0x35, 0x26, 0x27, 0x2e, 0x01, 0x2f,
-    0x01, 0x33, 0x13, 0x03, 0x23, 0x37, 0x2e, 0x03,
-    0x23, 0x22, 0x0e, 0x04, 0x23, 0x22, 0x2e, 0x04,
-    0x23, 0x22, 0x0e, 0x02, 0x23, 0x22, 0x26, 0x35,
-    0xfd, 0xee, 0x55, 0x2f, 0x11, 0x19, 0x17, 0x19,
-    0x21, 0x2c, 0x1f, 0x1f, 0x2d, 0x22, 0x1a, 0x19,
-    0x1b, 0x11, 0x11, 0x1a, 0x19, 0x1a, 0x23, 0x2d,
-    0x1f, 0x1f, 0x2c, 0x21, 0x19, 0x18, 0x1a, 0x11,
-    0x24, 0x06, 0x08, 0x08, 0x15, 0x0e, 0xba, 0x6a,
-    0xe7, 0xe8, 0x69, 0xb4, 0x22, 0x2d, 0x24, 0x22,
-    0x18, 0x11, 0x1b, 0x19, 0x1a, 0x22, 0x2d, 0x1f,
-    0x1f, 0x2e, 0x22, 0x1a, 0x1a, 0x1b, 0x11, 0x1a,
-    0x22, 0x25, 0x36, 0x2f, 0x3b, 0x47, 0x01, 0x8f,
-    0x28, 0x37, 0x13, 0x1d, 0x22, 0x1d, 0x13, 0x13,
-    0x1d, 0x22, 0x1d, 0x13, 0x13, 0x1d, 0x22, 0x1d,
-    0x13, 0x0f, 0x18, 0x1a, 0x18, 0x0f, 0x01, 0x04,
-    0x08, 0x07, 0x17, 0x11, 0xeb, 0xfe, 0xd9, 0xfe,
-    0xd9, 0xe3, 0x05, 0x20, 0x22, 0x1a, 0x13, 0x1d,
-    0x22, 0x1d, 0x13, 0x13, 0x1d, 0x22, 0x1d, 0x13,
-    0x29, 0x30, 0x29, 0x48, 0x3a, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xfb, 0xd7, 0xff, 0x92, 0x01, 0xd1,
-    0x03, 0x34, 0x00, 0x4e, 0x00, 0x6a, 0x40, 0x1c,
-    0x21, 0x1e, 0x02, 0x02, 0x01, 0x4e, 0x4d, 0x30,
-    0x29, 0x27, 0x26, 0x08, 0x01, 0x00, 0x09, 0x00,
-    0x02, 0x28, 0x01, 0x04, 0x00, 0x49, 0x46, 0x02,
-    0x03, 0x04, 0x04, 0x4c, 0x4b, 0xb0, 0x0c, 0x50,
-    0x58, 0x40, 0x19, 0x00, 0x03, 0x04, 0x04, 0x03,
-    0x71, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x02,
-    0x69, 0x00, 0x00, 0x00, 0x04, 0x61, 0x00, 0x04,
-    0x04, 0x43, 0x04, 0x4e, 0x1b, 0x40, 0x18, 0x00,
-    0x03, 0x04, 0x03, 0x86, 0x00, 0x01, 0x00, 0x02,
-    0x00, 0x01, 0x02, 0x69, 0x00, 0x00, 0x00, 0x04,
-    0x61, 0x00, 0x04, 0x04, 0x43, 0x04, 0x4e, 0x59,
-    0x40, 0x0d, 0x4b, 0x4a, 0x48, 0x47, 0x3a, 0x38,
-    0x20, 0x1f, 0x12, 0x10, 0x05, 0x09, 0x16, 0x2b,
-    0x01, 0x15, 0x05, 0x0e, 0x01, 0x07, 0x06, 0x07,
-    0x15, 0x16, 0x17, 0x1e, 0x01, 0x17, 0x05, 0x1e,
-    0x01, 0x33, 0x32, 0x36, 0x35, 0x34, 0x2f, 0x01,
-    0x2e, 0x01, 0x35, 0x34, 0x36, 0x37, 0x27, 0x35,
-    0x33, 0x15, 0x07, 0x1e, 0x01, 0x17, 0x01, 0x15,
-    0x05, 0x35, 0x25, 0x3e, 0x01, 0x37, 0x36, 0x37,
-    0x35, 0x26, 0x27, 0x2e, 0x01, 0x27, 0x25, 0x2e,
-    0x01, 0x23, 0x22, 0x06, 0x15, 0x14, 0x1f, 0x01,
-    0x1e, 0x01, 0x15, 0x14, 0x06, 0x07, 0x17, 0x15,
-    0x23, 0x35, 0x37, 0x26, 0x27, 0x25, 0x35, 0xfd,
-    0x71, 0xfe, 0xde, 0x0c, 0x14, 0x08, 0x08, 0x07,
-    0x07, 0x09, 0x08, 0x14, 0x0c, 0x01, 0x9a, 0x30,
-    0x70, 0x3d, 0x48, 0x5a, 0x73, 0x4c, 0x58, 0x59,
-    0x5d, 0x53, 0x02, 0x5a, 0x01, 0x27, 0x51, 0x3a,
-    0x02, 0x1f, 0xfe, 0x66, 0x01, 0x22, 0x0c, 0x14,
-    0x08, 0x08, 0x07, 0x07, 0x08, 0x08, 0x14, 0x0c,
-    0xfe, 0x3c, 0x3b, 0x58, 0x2a, 0x3e, 0x46, 0x72,
-    0x50, 0x56, 0x58, 0x6b, 0x5a, 0x03, 0x5a, 0x03,
-    0x7f, 0x63, 0xfe, 0x0e, 0x02, 0x5d, 0x5a, 0xa1,
-    0x07, 0x08, 0x02, 0x02, 0x01, 0x07, 0x01, 0x02,
-    0x02, 0x07, 0x06, 0xbf, 0x16, 0x1a, 0x3d, 0x31,
-    0x57, 0x2a, 0x1c, 0x20, 0x6a, 0x48, 0x4b, 0x5e,
-    0x0b, 0x0d, 0x50, 0x50, 0x0c, 0x04, 0x1d, 0x1e,
-    0xfe, 0xe3, 0x64, 0xe1, 0x5a, 0xa1, 0x07, 0x08,
-    0x02, 0x02, 0x01, 0x07, 0x01, 0x02, 0x02, 0x08,
-    0x06, 0xef, 0x1f, 0x1c, 0x35, 0x2f, 0x53, 0x29,
-    0x1d, 0x1f, 0x6c, 0x4b, 0x4b, 0x65, 0x0d, 0x18,
-    0x50, 0x50, 0x14, 0x05, 0x2f, 0xee, 0x64, 0x00,
-    0x00, 0x01, 0xfe, 0x0c, 0xff, 0x92, 0x01, 0xf9,
-    0x03, 0x34, 0x00, 0x40, 0x00, 0x77, 0x40, 0x17,
-    0x22, 0x1f, 0x02, 0x03, 0x01, 0x01, 0x01, 0x02,
-    0x03, 0x40, 0x09, 0x02, 0x00, 0x04, 0x00, 0x02,
-    0x3c, 0x39, 0x02, 0x04, 0x05, 0x04, 0x4c, 0x4b,
-    0xb0, 0x0c, 0x50, 0x58, 0x40, 0x21, 0x00, 0x02,
-    0x03, 0x00, 0x03, 0x02, 0x00, 0x80, 0x00, 0x04,
-    0x05, 0x05, 0x04, 0x71, 0x00, 0x01, 0x00, 0x03,
-    0x02, 0x01, 0x03, 0x69, 0x00, 0x00, 0x00, 0x05,
-    0x61, 0x00, 0x05, 0x05, 0x43, 0x05, 0x4e, 0x1b,
-    0x40, 0x20, 0x00, 0x02, 0x03, 0x00, 0x03, 0x02,
-    0x00, 0x80, 0x00, 0x04, 0x05, 0x04, 0x86, 0x00,
-    0x01, 0x00, 0x03, 0x02, 0x01, 0x03, 0x69, 0x00,
-    0x00, 0x00, 0x05, 0x61, 0x00, 0x05, 0x05, 0x43,
-    0x05, 0x4e, 0x59, 0x40, 0x0f, 0x3e, 0x3d, 0x3b,
-    0x3a, 0x2d, 0x2b, 0x27, 0x26, 0x21, 0x20, 0x13,
-    0x11, 0x06, 0x09, 0x16, 0x2b, 0x01, 0x25, 0x15,
-    0x05, 0x0e, 0x01, 0x07, 0x06, 0x07, 0x15, 0x16,
-    0x17, 0x1e, 0x01, 0x17, 0x05, 0x1e, 0x01, 0x33,
-    0x32, 0x36, 0x35, 0x34, 0x2f, 0x01, 0x2e, 0x01,
-    0x35, 0x34, 0x36, 0x37, 0x27, 0x35, 0x33, 0x15,
-    0x07, 0x1e, 0x01, 0x17, 0x23, 0x34, 0x2e, 0x02,
-    0x23, 0x22, 0x06, 0x15, 0x14, 0x1f, 0x01, 0x1e,
-    0x01, 0x15, 0x14, 0x06, 0x07, 0x17, 0x15, 0x23,
-    0x35, 0x37, 0x26, 0x27, 0x25, 0xfe, 0x0c, 0x01,
-    0x9a, 0xfe, 0xde, 0x0c, 0x14, 0x08, 0x08, 0x07,
-    0x07, 0x09, 0x08, 0x14, 0x0c, 0x01, 0x9a, 0x30,
-    0x70, 0x3d, 0x48, 0x5a, 0x73, 0x4c, 0x58, 0x59,
-    0x5d, 0x53, 0x02, 0x5a, 0x02, 0x4e, 0x62, 0x02,
-    0x5f, 0x14, 0x21, 0x2c, 0x19, 0x3e, 0x46, 0x72,
-    0x50, 0x56, 0x58, 0x6b, 0x5a, 0x03, 0x5a, 0x03,
-    0x7f, 0x63, 0xfe, 0x0e, 0x01, 0x7c, 0xe1, 0x5a,
-    0xa1, 0x07, 0x08, 0x02, 0x02, 0x01, 0x07, 0x01,
-    0x02, 0x02, 0x07, 0x06, 0xbf, 0x16, 0x1a, 0x3d,
-    0x31, 0x57, 0x2a, 0x1c, 0x20, 0x6a, 0x48, 0x4b,
-    0x5e, 0x0b, 0x0d, 0x50, 0x50, 0x0c, 0x0b, 0x63,
-    0x4f, 0x19, 0x29, 0x1d, 0x10, 0x35, 0x2f, 0x53,
-    0x29, 0x1d, 0x1f, 0x6c, 0x4b, 0x4b, 0x65, 0x0d,
-    0x18, 0x50, 0x50, 0x14, 0x05, 0x2f, 0xee, 0x00,
-    0x00, 0x01, 0xfe, 0x02, 0xff, 0x92, 0x01, 0xf4,
-    0x03, 0x34, 0x00, 0x41, 0x00, 0x4a, 0x40, 0x47,
-    0x15, 0x12, 0x02, 0x02, 0x01, 0x24, 0x1b, 0x1a,
-    0x03, 0x04, 0x02, 0x1d, 0x01, 0x00, 0x04, 0x3d,
-    0x3a, 0x1c, 0x03, 0x03, 0x00, 0x04, 0x4c, 0x05,
-    0x01, 0x04, 0x02, 0x00, 0x02, 0x04, 0x00, 0x80,
-    0x00, 0x01, 0x00, 0x02, 0x04, 0x01, 0x02, 0x69,
-    0x00, 0x00, 0x03, 0x03, 0x00, 0x59, 0x00, 0x00,
-    0x00, 0x03, 0x5f, 0x00, 0x03, 0x00, 0x03, 0x4f,
-    0x00, 0x00, 0x00, 0x41, 0x00, 0x41, 0x3c, 0x3b,
-    0x2e, 0x2c, 0x1d, 0x24, 0x06, 0x09, 0x18, 0x2b,
-    0x25, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x35,
-    0x34, 0x2f, 0x01, 0x2e, 0x01, 0x35, 0x34, 0x36,
-    0x37, 0x27, 0x35, 0x33, 0x15, 0x07, 0x1e, 0x01,
-    0x17, 0x01, 0x15, 0x05, 0x35, 0x25, 0x3e, 0x01,
-    0x37, 0x36, 0x37, 0x35, 0x26, 0x27, 0x2e, 0x01,
-    0x27, 0x25, 0x2e, 0x01, 0x23, 0x22, 0x06, 0x15,
-    0x14, 0x1f, 0x01, 0x1e, 0x01, 0x15, 0x14, 0x06,
-    0x07, 0x17, 0x15, 0x23, 0x35, 0x37, 0x2e, 0x01,
-    0x27, 0xfe, 0x61, 0x15, 0x26, 0x31, 0x1d, 0x48,
-    0x5a, 0x73, 0x4c, 0x58, 0x59, 0x5d, 0x53, 0x02,
-    0x5a, 0x01, 0x27, 0x51, 0x3a, 0x02, 0x1f, 0xfe,
-    0x66, 0x01, 0x22, 0x0c, 0x14, 0x08, 0x08, 0x07,
-    0x07, 0x08, 0x08, 0x14, 0x0c, 0xfe, 0x3c, 0x3b,
-    0x58, 0x2a, 0x3e, 0x46, 0x72, 0x50, 0x56, 0x58,
-    0x6b, 0x5a, 0x03, 0x5a, 0x03, 0x5a, 0x70, 0x02,
-    0xb9, 0x1a, 0x2a, 0x1e, 0x11, 0x3d, 0x31, 0x57,
-    0x2a, 0x1c, 0x20, 0x6a, 0x48, 0x4b, 0x5e, 0x0b,
-    0x0d, 0x50, 0x50, 0x0c, 0x04, 0x1d, 0x1e, 0xfe,
-    0xe3, 0x64, 0xe1, 0x5a, 0xa1, 0x07, 0x08, 0x02,
-    0x02, 0x01, 0x07, 0x01, 0x02, 0x02, 0x08, 0x06,
-    0xef, 0x1f, 0x1c, 0x35, 0x2f, 0x53, 0x29, 0x1d,
-    0x1f, 0x6c, 0x4b, 0x4b, 0x65, 0x0d, 0x18, 0x50,
-    0x50, 0x15, 0x07, 0x66, 0x55, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xfb, 0xb9, 0x00, 0x2d, 0x01, 0xef,
-    0x02, 0x67, 0x00, 0x0b, 0x00, 0x1c, 0x00, 0x2e,
-    0x00, 0x45, 0x40, 0x42, 0x2e, 0x1e, 0x1d, 0x1a,
-    0x19, 0x18, 0x06, 0x01, 0x00, 0x25, 0x13, 0x02,
-    0x02, 0x01, 0x2d, 0x2c, 0x2b, 0x1c, 0x1b, 0x0c,
-    0x06, 0x03, 0x02, 0x03, 0x4c, 0x00, 0x00, 0x01,
-    0x03, 0x00, 0x57, 0x06, 0x05, 0x02, 0x01, 0x04,
-    0x01, 0x02, 0x03, 0x01, 0x02, 0x67, 0x00, 0x00,
-    0x00, 0x03, 0x5f, 0x00, 0x03, 0x00, 0x03, 0x4f,
-    0x00, 0x00, 0x00, 0x0b, 0x00, 0x0b, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x07, 0x09, 0x1b, 0x2b, 0x01,
-    0x35, 0x33, 0x15, 0x33, 0x15, 0x23, 0x15, 0x23,
-    0x35, 0x23, 0x35, 0x05, 0x25, 0x3e, 0x01, 0x37,
-    0x36, 0x37, 0x35, 0x26, 0x27, 0x26, 0x27, 0x25,
-    0x35, 0x05, 0x15, 0x05, 0x01, 0x15, 0x05, 0x0e,
-    0x01, 0x07, 0x06, 0x07, 0x15, 0x16, 0x17, 0x1e,
-    0x01, 0x17, 0x05, 0x15, 0x25, 0x35, 0xfe, 0xa8,
-    0x58, 0xf1, 0xf1, 0x58, 0xf1, 0x02, 0x8a, 0x01,
-    0x36, 0x0c, 0x14, 0x08, 0x08, 0x07, 0x07, 0x08,
-    0x11, 0x17, 0xfe, 0xca, 0x01, 0xae, 0xfe, 0x52,
-    0xfd, 0x26, 0xfe, 0xca, 0x0c, 0x14, 0x08, 0x08,
-    0x07, 0x07, 0x08, 0x08, 0x14, 0x0c, 0x01, 0x36,
-    0xfe, 0x52, 0x01, 0x72, 0xf5, 0xf5, 0x50, 0xf5,
-    0xf5, 0x50, 0xd7, 0x97, 0x06, 0x08, 0x02, 0x03,
-    0x01, 0x07, 0x01, 0x03, 0x03, 0x0c, 0x9a, 0x59,
-    0xd7, 0x64, 0xd7, 0x02, 0x12, 0x5a, 0x97, 0x06,
-    0x08, 0x02, 0x03, 0x01, 0x07, 0x01, 0x02, 0x02,
-    0x08, 0x06, 0x9a, 0x59, 0xd7, 0x64, 0x00, 0x00,
-    0x00, 0x02, 0xfd, 0xdf, 0x00, 0x2d, 0x02, 0x21,
-    0x02, 0x67, 0x00, 0x0b, 0x00, 0x1d, 0x00, 0x3e,
-    0x40, 0x3b, 0x1d, 0x0d, 0x0c, 0x03, 0x00, 0x01,
-    0x14, 0x01, 0x03, 0x00, 0x1c, 0x1b, 0x1a, 0x03,
-    0x04, 0x03, 0x03, 0x4c, 0x00, 0x01, 0x00, 0x04,
-    0x01, 0x57, 0x02, 0x01, 0x00, 0x06, 0x05, 0x02,
-    0x03, 0x04, 0x00, 0x03, 0x67, 0x00, 0x01, 0x01,
-    0x04, 0x5f, 0x00, 0x04, 0x01, 0x04, 0x4f, 0x00,
-    0x00, 0x00, 0x0b, 0x00, 0x0b, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x07, 0x09, 0x1b, 0x2b, 0x03, 0x35,
-    0x33, 0x35, 0x33, 0x15, 0x33, 0x15, 0x23, 0x15,
-    0x23, 0x35, 0x01, 0x15, 0x05, 0x0e, 0x01, 0x07,
-    0x06, 0x07, 0x15, 0x16, 0x17, 0x1e, 0x01, 0x17,
-    0x05, 0x15, 0x25, 0x35, 0x19, 0xf1, 0x58, 0xf1,
-    0xf1, 0x58, 0xfe, 0xb5, 0xfe, 0xca, 0x0c, 0x14,
-    0x08, 0x08, 0x07, 0x07, 0x08, 0x08, 0x14, 0x0c,
-    0x01, 0x36, 0xfe, 0x52, 0x01, 0x22, 0x50, 0xf5,
-    0xf5, 0x50, 0xf5, 0xf5, 0x01, 0x31, 0x5a, 0x97,
-    0x06, 0x08, 0x02, 0x03, 0x01, 0x07, 0x01, 0x02,
-    0x02, 0x08, 0x06, 0x9a, 0x59, 0xd7, 0x64, 0x00,
-    0x00, 0x02, 0xfd, 0xc1, 0x00, 0x2d, 0x02, 0x03,
-    0x02, 0x67, 0x00, 0x0b, 0x00, 0x1c, 0x00, 0x38,
-    0x40, 0x35, 0x1c, 0x0d, 0x0c, 0x03, 0x00, 0x01,
-    0x17, 0x01, 0x03, 0x00, 0x10, 0x0f, 0x0e, 0x03,
-    0x04, 0x03, 0x03, 0x4c, 0x00, 0x01, 0x00, 0x04,
-    0x01, 0x57, 0x02, 0x01, 0x00, 0x05, 0x01, 0x03,
-    0x04, 0x00, 0x03, 0x67, 0x00, 0x01, 0x01, 0x04,
-    0x5f, 0x00, 0x04, 0x01, 0x04, 0x4f, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x10, 0x06, 0x09, 0x1c, 0x2b,
-    0x01, 0x33, 0x35, 0x33, 0x15, 0x33, 0x15, 0x23,
-    0x15, 0x23, 0x35, 0x23, 0x01, 0x05, 0x15, 0x05,
-    0x35, 0x25, 0x3e, 0x01, 0x37, 0x36, 0x37, 0x35,
-    0x26, 0x27, 0x26, 0x27, 0x25, 0xfd, 0xc1, 0xf1,
-    0x58, 0xf1, 0xf1, 0x58, 0xf1, 0x02, 0x94, 0x01,
-    0xae, 0xfe, 0x52, 0x01, 0x36, 0x0c, 0x14, 0x08,
-    0x08, 0x07, 0x07, 0x08, 0x11, 0x17, 0xfe, 0xca,
-    0x01, 0x72, 0xf5, 0xf5, 0x50, 0xf5, 0xf5, 0x01,
-    0x31, 0xd7, 0x64, 0xd7, 0x5a, 0x97, 0x06, 0x08,
-    0x02, 0x03, 0x01, 0x07, 0x01, 0x03, 0x03, 0x0c,
-    0x9a, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfb, 0xb9,
-    0x00, 0x40, 0x01, 0xef, 0x02, 0x80, 0x00, 0x33,
-    0x00, 0x44, 0x00, 0x56, 0x00, 0x3b, 0x40, 0x38,
-    0x47, 0x46, 0x45, 0x42, 0x41, 0x40, 0x3b, 0x33,
-    0x16, 0x15, 0x10, 0x07, 0x0c, 0x01, 0x00, 0x01,
-    0x4c, 0x56, 0x55, 0x54, 0x4e, 0x44, 0x43, 0x34,
-    0x2a, 0x29, 0x24, 0x20, 0x1f, 0x0c, 0x01, 0x49,
-    0x00, 0x00, 0x01, 0x01, 0x00, 0x57, 0x00, 0x00,
-    0x00, 0x01, 0x61, 0x02, 0x01, 0x01, 0x00, 0x01,
-    0x51, 0x30, 0x2f, 0x1d, 0x1b, 0x03, 0x09, 0x18,
-    0x2b, 0x01, 0x17, 0x1e, 0x03, 0x17, 0x37, 0x2e,
-    0x01, 0x3d, 0x01, 0x33, 0x15, 0x14, 0x06, 0x07,
-    0x17, 0x3e, 0x01, 0x3f, 0x01, 0x17, 0x07, 0x0e,
-    0x01, 0x0f, 0x01, 0x1e, 0x01, 0x1f, 0x01, 0x07,
-    0x27, 0x2e, 0x01, 0x27, 0x23, 0x0e, 0x01, 0x0f,
-    0x01, 0x27, 0x37, 0x3e, 0x01, 0x37, 0x27, 0x2e,
-    0x01, 0x2f, 0x01, 0x05, 0x25, 0x3e, 0x01, 0x37,
-    0x36, 0x37, 0x35, 0x26, 0x27, 0x26, 0x27, 0x25,
-    0x35, 0x05, 0x15, 0x05, 0x01, 0x25, 0x15, 0x05,
-    0x0e, 0x01, 0x07, 0x06, 0x07, 0x15, 0x16, 0x17,
-    0x1e, 0x01, 0x17, 0x05, 0x15, 0x25, 0xfd, 0xca,
-    0x77, 0x10, 0x21, 0x21, 0x1d, 0x0c, 0x05, 0x08,
-    0x11, 0x58, 0x12, 0x08, 0x05, 0x17, 0x44, 0x20,
-    0x77, 0x1e, 0x77, 0x1f, 0x4c, 0x1d, 0x04, 0x17,
-    0x39, 0x13, 0x4b, 0x48, 0x4b, 0x13, 0x20, 0x09,
-    0x08, 0x09, 0x20, 0x13, 0x4a, 0x48, 0x4a, 0x13,
-    0x3a, 0x17, 0x03, 0x1d, 0x4d, 0x1f, 0x77, 0x02,
-    0x95, 0x01, 0x36, 0x0c, 0x14, 0x08, 0x08, 0x07,
-    0x07, 0x08, 0x11, 0x17, 0xfe, 0xca, 0x01, 0xae,
-    0xfe, 0x52, 0xfb, 0x78, 0x01, 0xae, 0xfe, 0xca,
-    0x0c, 0x14, 0x08, 0x08, 0x07, 0x07, 0x08, 0x08,
-    0x14, 0x0c, 0x01, 0x36, 0xfe, 0x52, 0x01, 0xe0,
-    0x2a, 0x06, 0x11, 0x13, 0x14, 0x09, 0x04, 0x1c,
-    0x51, 0x23, 0x7d, 0x7d, 0x23, 0x51, 0x1c, 0x03,
-    0x11, 0x2a, 0x0b, 0x2a, 0x53, 0x2a, 0x0b, 0x0b,
-    0x02, 0x09, 0x13, 0x36, 0x1b, 0x6c, 0x32, 0x6c,
-    0x1b, 0x4a, 0x1b, 0x1b, 0x49, 0x1c, 0x6c, 0x32,
-    0x6c, 0x1c, 0x37, 0x12, 0x07, 0x02, 0x0c, 0x0b,
-    0x2a, 0xf2, 0x97, 0x06, 0x08, 0x02, 0x03, 0x01,
-    0x07, 0x01, 0x03, 0x03, 0x0c, 0x9a, 0x59, 0xd7,
-    0x64, 0xd7, 0x01, 0x3b, 0xd7, 0x5a, 0x97, 0x06,
-    0x08, 0x02, 0x03, 0x01, 0x07, 0x01, 0x02, 0x02,
-    0x08, 0x06, 0x9a, 0x59, 0xd7, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xfd, 0xfd, 0x00, 0x40, 0x02, 0x44,
-    0x02, 0x80, 0x00, 0x33, 0x00, 0x45, 0x00, 0x34,
-    0x40, 0x31, 0x36, 0x35, 0x34, 0x17, 0x16, 0x11,
-    0x08, 0x01, 0x08, 0x01, 0x00, 0x01, 0x4c, 0x45,
-    0x44, 0x43, 0x3d, 0x2b, 0x2a, 0x25, 0x21, 0x20,
-    0x09, 0x01, 0x49, 0x00, 0x00, 0x01, 0x01, 0x00,
-    0x57, 0x00, 0x00, 0x00, 0x01, 0x61, 0x02, 0x01,
-    0x01, 0x00, 0x01, 0x51, 0x31, 0x30, 0x1d, 0x1c,
-    0x03, 0x09, 0x18, 0x2b, 0x03, 0x37, 0x17, 0x1e,
-    0x03, 0x17, 0x37, 0x2e, 0x01, 0x3d, 0x01, 0x33,
-    0x15, 0x14, 0x06, 0x07, 0x17, 0x3e, 0x01, 0x3f,
-    0x01, 0x17, 0x07, 0x0e, 0x01, 0x0f, 0x01, 0x1e,
-    0x01, 0x1f, 0x01, 0x07, 0x27, 0x2e, 0x01, 0x27,
-    0x23, 0x0e, 0x01, 0x0f, 0x01, 0x27, 0x37, 0x3e,
-    0x01, 0x37, 0x27, 0x2e, 0x01, 0x27, 0x2d, 0x01,
-    0x15, 0x05, 0x0e, 0x01, 0x07, 0x06, 0x07, 0x15,
-    0x16, 0x17, 0x1e, 0x01, 0x17, 0x05, 0x15, 0x25,
-    0x0b, 0x1e, 0x77, 0x10, 0x21, 0x21, 0x1d, 0x0c,
-    0x05, 0x08, 0x11, 0x58, 0x12, 0x08, 0x05, 0x17,
-    0x44, 0x20, 0x77, 0x1e, 0x77, 0x1f, 0x4c, 0x1d,
-    0x04, 0x17, 0x39, 0x13, 0x4b, 0x48, 0x4b, 0x13,
-    0x20, 0x09, 0x08, 0x09, 0x20, 0x13, 0x4a, 0x48,
-    0x4a, 0x13, 0x3a, 0x17, 0x03, 0x1d, 0x4d, 0x1f,
-    0xfd, 0x91, 0x01, 0xae, 0xfe, 0xca, 0x0c, 0x14,
-    0x08, 0x08, 0x07, 0x07, 0x08, 0x08, 0x14, 0x0c,
-    0x01, 0x36, 0xfe, 0x52, 0x01, 0x8d, 0x53, 0x2a,
-    0x06, 0x11, 0x13, 0x14, 0x09, 0x04, 0x1c, 0x51,
-    0x23, 0x7d, 0x7d, 0x23, 0x51, 0x1c, 0x03, 0x11,
-    0x2a, 0x0b, 0x2a, 0x53, 0x2a, 0x0b, 0x0b, 0x02,
-    0x09, 0x13, 0x36, 0x1b, 0x6c, 0x32, 0x6c, 0x1b,
-    0x4a, 0x1b, 0x1b, 0x49, 0x1c, 0x6c, 0x32, 0x6c,
-    0x1c, 0x37, 0x12, 0x07, 0x02, 0x0c, 0x0b, 0x19,
-    0xd7, 0x5a, 0x97, 0x06, 0x08, 0x02, 0x03, 0x01,
-    0x07, 0x01, 0x02, 0x02, 0x08, 0x06, 0x9a, 0x59,
-    0xd7, 0x00, 0x00, 0x00, 0x00, 0x02, 0xfd, 0xc0,
-    0x00, 0x40, 0x02, 0x03, 0x02, 0x80, 0x00, 0x33,
-    0x00, 0x44, 0x00, 0x34, 0x40, 0x31, 0x42, 0x41,
-    0x40, 0x3b, 0x33, 0x16, 0x15, 0x10, 0x07, 0x09,
-    0x01, 0x00, 0x01, 0x4c, 0x44, 0x43, 0x34, 0x2a,
-    0x29, 0x24, 0x20, 0x1f, 0x08, 0x01, 0x49, 0x00,
-    0x00, 0x01, 0x01, 0x00, 0x57, 0x00, 0x00, 0x00,
-    0x01, 0x61, 0x02, 0x01, 0x01, 0x00, 0x01, 0x51,
-    0x30, 0x2f, 0x1d, 0x1b, 0x03, 0x09, 0x18, 0x2b,
-    0x01, 0x17, 0x1e, 0x03, 0x17, 0x37, 0x2e, 0x01,
-    0x3d, 0x01, 0x33, 0x15, 0x14, 0x06, 0x07, 0x17,
-    0x3e, 0x01, 0x3f, 0x01, 0x17, 0x07, 0x0e, 0x01,
-    0x0f, 0x01, 0x1e, 0x01, 0x1f, 0x01, 0x07, 0x27,
-    0x2e, 0x01, 0x27, 0x23, 0x0e, 0x01, 0x0f, 0x01,
-    0x27, 0x37, 0x3e, 0x01, 0x37, 0x27, 0x2e, 0x01,
-    0x2f, 0x01, 0x05, 0x25, 0x3e, 0x01, 0x37, 0x36,
-    0x37, 0x35, 0x26, 0x27, 0x26, 0x27, 0x25, 0x35,
-    0x05, 0x15, 0x05, 0xfd, 0xde, 0x77, 0x10, 0x21,
-    0x21, 0x1d, 0x0c, 0x05, 0x08, 0x11, 0x58, 0x12,
-    0x08, 0x05, 0x17, 0x44, 0x20, 0x77, 0x1e, 0x77,
-    0x1f, 0x4c, 0x1d, 0x04, 0x17, 0x39, 0x13, 0x4b,
-    0x48, 0x4b, 0x13, 0x20, 0x09, 0x08, 0x09, 0x20,
-    0x13, 0x4a, 0x48, 0x4a, 0x13, 0x3a, 0x17, 0x03,
-    0x1d, 0x4d, 0x1f, 0x77, 0x02, 0x95, 0x01, 0x36,
-    0x0c, 0x14, 0x08, 0x08, 0x07, 0x07, 0x08, 0x11,
-    0x17, 0xfe, 0xca, 0x01, 0xae, 0xfe, 0x52, 0x01,
-    0xe0, 0x2a, 0x06, 0x11, 0x13, 0x14, 0x09, 0x04,
-    0x1c, 0x51, 0x23, 0x7d, 0x7d, 0x23, 0x51, 0x1c,
-    0x03, 0x11, 0x2a, 0x0b, 0x2a, 0x53, 0x2a, 0x0b,
-    0x0b, 0x02, 0x09, 0x13, 0x36, 0x1b, 0x6c, 0x32,
-    0x6c, 0x1b, 0x4a, 0x1b, 0x1b, 0x49, 0x1c, 0x6c,
-    0x32, 0x6c, 0x1c, 0x37, 0x12, 0x07, 0x02, 0x0c,
-    0x0b, 0x2a, 0xf2, 0x97, 0x06, 0x08, 0x02, 0x03,
-    0x01, 0x07, 0x01, 0x03, 0x03, 0x0c, 0x9a, 0x59,
-    0xd7, 0x64, 0xd7, 0x00, 0x00, 0x01, 0xfe, 0x25,
-    0xff, 0x92, 0x01, 0xef, 0x03, 0x3e, 0x00, 0x15,
-    0x00, 0x1d, 0x40, 0x1a, 0x15, 0x14, 0x13, 0x0e,
-    0x08, 0x01, 0x00, 0x07, 0x01, 0x00, 0x01, 0x4c,
-    0x00, 0x00, 0x01, 0x00, 0x85, 0x00, 0x01, 0x01,
-    0x76, 0x11, 0x1f, 0x02, 0x09, 0x18, 0x2b, 0x03,
-    0x15, 0x05, 0x0e, 0x01, 0x07, 0x06, 0x07, 0x15,
-    0x16, 0x17, 0x1e, 0x01, 0x17, 0x05, 0x01, 0x33,
-    0x01, 0x23, 0x37, 0x01, 0x35, 0x2d, 0xfe, 0xca,
-    0x0c, 0x14, 0x08, 0x08, 0x07, 0x07, 0x08, 0x08,
-    0x14, 0x0c, 0x01, 0xd6, 0x01, 0x1d, 0x5f, 0xfe,
-    0x9d, 0x5f, 0x29, 0xfd, 0xcf, 0x02, 0x53, 0x5a,
-    0x97, 0x06, 0x08, 0x02, 0x03, 0x01, 0x07, 0x01,
-    0x02, 0x02, 0x08, 0x06, 0xe9, 0x02, 0xf3, 0xfc,
-    0x54, 0x6e, 0x01, 0x18, 0x64, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xfb, 0xf5, 0xff, 0x92, 0x01, 0xb3,
-    0x03, 0x3e, 0x00, 0x26, 0x00, 0x26, 0x40, 0x23,
-    0x26, 0x25, 0x22, 0x1d, 0x16, 0x15, 0x14, 0x13,
-    0x12, 0x0f, 0x09, 0x02, 0x01, 0x00, 0x0e, 0x01,
-    0x00, 0x01, 0x4c, 0x00, 0x00, 0x01, 0x00, 0x85,
-    0x00, 0x01, 0x01, 0x76, 0x24, 0x23, 0x11, 0x10,
-    0x02, 0x09, 0x16, 0x2b, 0x01, 0x25, 0x15, 0x05,
-    0x0e, 0x01, 0x07, 0x06, 0x07, 0x15, 0x16, 0x17,
-    0x1e, 0x01, 0x17, 0x05, 0x01, 0x33, 0x07, 0x01,
-    0x15, 0x05, 0x35, 0x25, 0x3e, 0x01, 0x37, 0x36,
-    0x37, 0x35, 0x26, 0x27, 0x26, 0x27, 0x25, 0x01,
-    0x23, 0x37, 0x01, 0xfb, 0xf5, 0x01, 0xae, 0xfe,
-    0xca, 0x0c, 0x14, 0x08, 0x08, 0x07, 0x07, 0x08,
-    0x08, 0x14, 0x0c, 0x01, 0xcd, 0x01, 0x1c, 0x5f,
-    0x3e, 0x02, 0x3c, 0xfe, 0x52, 0x01, 0x36, 0x0c,
-    0x14, 0x08, 0x08, 0x07, 0x07, 0x08, 0x11, 0x17,
-    0xfe, 0x20, 0xfe, 0xf7, 0x5f, 0x2b, 0xfd, 0xd7,
-    0x01, 0x7c, 0xd7, 0x5a, 0x97, 0x06, 0x08, 0x02,
-    0x03, 0x01, 0x07, 0x01, 0x02, 0x02, 0x08, 0x06,
-    0xe5, 0x02, 0xef, 0xa4, 0xfe, 0xe2, 0x64, 0xd7,
-    0x5a, 0x97, 0x06, 0x08, 0x02, 0x03, 0x01, 0x07,
-    0x01, 0x03, 0x03, 0x0c, 0xef, 0xfd, 0x43, 0x72,
-    0x01, 0x14, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x11,
-    0xff, 0x92, 0x01, 0xdb, 0x03, 0x3e, 0x00, 0x14,
-    0x00, 0x1e, 0x40, 0x1b, 0x12, 0x0d, 0x06, 0x05,
-    0x04, 0x03, 0x02, 0x07, 0x01, 0x00, 0x01, 0x4c,
-    0x00, 0x00, 0x01, 0x00, 0x85, 0x00, 0x01, 0x01,
-    0x76, 0x14, 0x13, 0x10, 0x02, 0x09, 0x17, 0x2b,
-    0x03, 0x33, 0x07, 0x01, 0x15, 0x05, 0x35, 0x25,
-    0x3e, 0x01, 0x37, 0x36, 0x37, 0x35, 0x26, 0x27,
-    0x26, 0x27, 0x25, 0x01, 0x23, 0x8c, 0x5f, 0x3c,
-    0x02, 0x44, 0xfe, 0x52, 0x01, 0x36, 0x0c, 0x14,
-    0x08, 0x08, 0x07, 0x07, 0x08, 0x11, 0x17, 0xfe,
-    0x17, 0xfe, 0xf6, 0x5f, 0x03, 0x3e, 0xa0, 0xfe,
-    0xde, 0x64, 0xd7, 0x5a, 0x97, 0x06, 0x08, 0x02,
-    0x03, 0x01, 0x07, 0x01, 0x03, 0x03, 0x0c, 0xf3,
-    0xfd, 0x3f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
-    0xff, 0x5b, 0x02, 0x58, 0x03, 0xd9, 0x00, 0x30,
-    0x00, 0x5d, 0x00, 0x80, 0x00, 0xa9, 0x00, 0xb5,
-    0x00, 0xc1, 0x00, 0xc5, 0x03, 0xfb, 0x40, 0x20,
-    0xa1, 0xa0, 0x9f, 0x99, 0x04, 0x13, 0x14, 0x6d,
-    0x68, 0x02, 0x0d, 0x1b, 0x24, 0x19, 0x15, 0x09,
-    0x04, 0x08, 0x02, 0x3b, 0x01, 0x06, 0x09, 0x2d,
-    0x2a, 0x03, 0x00, 0x04, 0x05, 0x07, 0x05, 0x4c,
-    0x4b, 0xb0, 0x09, 0x50, 0x58, 0x40, 0x7b, 0x00,
-    0x13, 0x14, 0x11, 0x14, 0x13, 0x72, 0x00, 0x11,
-    0x10, 0x14, 0x11, 0x10, 0x7e, 0x00, 0x10, 0x1b,
-    0x14, 0x10, 0x1b, 0x7e, 0x03, 0x01, 0x01, 0x16,
-    0x02, 0x02, 0x01, 0x72, 0x00, 0x06, 0x09, 0x07,
-    0x07, 0x06, 0x72, 0x04, 0x01, 0x00, 0x05, 0x05,
-    0x00, 0x71, 0x00, 0x1b, 0x0d, 0x16, 0x1b, 0x57,
-    0x00, 0x0d, 0x00, 0x0e, 0x16, 0x0d, 0x0e, 0x67,
-    0x00, 0x12, 0x1d, 0x1c, 0x02, 0x16, 0x01, 0x12,
-    0x16, 0x69, 0x00, 0x02, 0x0b, 0x01, 0x08, 0x17,
-    0x02, 0x08, 0x6a, 0x19, 0x01, 0x17, 0x1a, 0x01,
-    0x18, 0x09, 0x17, 0x18, 0x69, 0x00, 0x0a, 0x00,
-    0x09, 0x06, 0x0a, 0x09, 0x67, 0x00, 0x07, 0x00,
-    0x05, 0x00, 0x07, 0x05, 0x6a, 0x00, 0x0f, 0x0f,
-    0x0c, 0x61, 0x00, 0x0c, 0x0c, 0x64, 0x4d, 0x00,
-    0x14, 0x14, 0x15, 0x5f, 0x00, 0x15, 0x15, 0x64,
-    0x14, 0x4e, 0x1b, 0x4b, 0xb0, 0x0a, 0x50, 0x58,
-    0x40, 0x7c, 0x00, 0x13, 0x14, 0x11, 0x14, 0x13,
-    0x11, 0x80, 0x00, 0x11, 0x10, 0x14, 0x11, 0x10,
-    0x7e, 0x00, 0x10, 0x1b, 0x14, 0x10, 0x1b, 0x7e,
-    0x03, 0x01, 0x01, 0x16, 0x02, 0x02, 0x01, 0x72,
-    0x00, 0x06, 0x09, 0x07, 0x07, 0x06, 0x72, 0x04,
-    0x01, 0x00, 0x05, 0x05, 0x00, 0x71, 0x00, 0x1b,
-    0x0d, 0x0e, 0x1b, 0x57, 0x00, 0x0d, 0x1d, 0x1c,
-    0x02, 0x0e, 0x16, 0x0d, 0x0e, 0x67, 0x00, 0x12,
-    0x00, 0x16, 0x01, 0x12, 0x16, 0x69, 0x00, 0x02,
-    0x0b, 0x01, 0x08, 0x17, 0x02, 0x08, 0x6a, 0x19,
-    0x01, 0x17, 0x1a, 0x01, 0x18, 0x09, 0x17, 0x18,
-    0x69, 0x00, 0x0a, 0x00, 0x09, 0x06, 0x0a, 0x09,
-    0x67, 0x00, 0x07, 0x00, 0x05, 0x00, 0x07, 0x05,
-    0x6a, 0x00, 0x0f, 0x0f, 0x0c, 0x61, 0x00, 0x0c,
-    0x0c, 0x64, 0x4d, 0x00, 0x14, 0x14, 0x15, 0x5f,
-    0x00, 0x15, 0x15, 0x64, 0x14, 0x4e, 0x1b, 0x4b,
-    0xb0, 0x0b, 0x50, 0x58, 0x40, 0x7b, 0x00, 0x13,
-    0x14, 0x11, 0x14, 0x13, 0x11, 0x80, 0x00, 0x11,
-    0x10, 0x14, 0x11, 0x10, 0x7e, 0x00, 0x10, 0x1b,
-    0x14, 0x10, 0x1b, 0x7e, 0x03, 0x01, 0x01, 0x16,
-    0x02, 0x02, 0x01, 0x72, 0x00, 0x06, 0x09, 0x07,
-    0x07, 0x06, 0x72, 0x04, 0x01, 0x00, 0x05, 0x05,
-    0x00, 0x71, 0x00, 0x1b, 0x0d, 0x16, 0x1b, 0x57,
-    0x00, 0x0e, 0x16, 0x0d, 0x0e, 0x57, 0x12, 0x01,
-    0x0d, 0x1d, 0x1c, 0x02, 0x16, 0x01, 0x0d, 0x16,
-    0x69, 0x00, 0x02, 0x0b, 0x01, 0x08, 0x17, 0x02,
-    0x08, 0x6a, 0x19, 0x01, 0x17, 0x1a, 0x01, 0x18,
-    0x09, 0x17, 0x18, 0x69, 0x00, 0x0a, 0x00, 0x09,
-    0x06, 0x0a, 0x09, 0x67, 0x00, 0x07, 0x00, 0x05,
-    0x00, 0x07, 0x05, 0x6a, 0x00, 0x0f, 0x0f, 0x0c,
-    0x61, 0x00, 0x0c, 0x0c, 0x64, 0x4d, 0x00, 0x14,
-    0x14, 0x15, 0x5f, 0x00, 0x15, 0x15, 0x64, 0x14,
-    0x4e, 0x1b, 0x4b, 0xb0, 0x14, 0x50, 0x58, 0x40,
-    0x7c, 0x00, 0x13, 0x14, 0x11, 0x14, 0x13, 0x11,
-    0x80, 0x00, 0x11, 0x10, 0x14, 0x11, 0x10, 0x7e,
-    0x00, 0x10, 0x1b, 0x14, 0x10, 0x1b, 0x7e, 0x03,
-    0x01, 0x01, 0x16, 0x02, 0x02, 0x01, 0x72, 0x00,
-    0x06, 0x09, 0x07, 0x07, 0x06, 0x72, 0x04, 0x01,
-    0x00, 0x05, 0x05, 0x00, 0x71, 0x00, 0x1b, 0x0d,
-    0x16, 0x1b, 0x57, 0x00, 0x0d, 0x00, 0x0e, 0x16,
-    0x0d, 0x0e, 0x67, 0x00, 0x12, 0x1d, 0x1c, 0x02,
-    0x16, 0x01, 0x12, 0x16, 0x69, 0x00, 0x02, 0x0b,
-    0x01, 0x08, 0x17, 0x02, 0x08, 0x6a, 0x19, 0x01,
-    0x17, 0x1a, 0x01, 0x18, 0x09, 0x17, 0x18, 0x69,
-    0x00, 0x0a, 0x00, 0x09, 0x06, 0x0a, 0x09, 0x67,
-    0x00, 0x07, 0x00, 0x05, 0x00, 0x07, 0x05, 0x6a,
-    0x00, 0x0f, 0x0f, 0x0c, 0x61, 0x00, 0x0c, 0x0c,
-    0x64, 0x4d, 0x00, 0x14, 0x14, 0x15, 0x5f, 0x00,
-    0x15, 0x15, 0x64, 0x14, 0x4e, 0x1b, 0x4b, 0xb0,
-    0x17, 0x50, 0x58, 0x40, 0x7d, 0x00, 0x13, 0x14,
-    0x11, 0x14, 0x13, 0x11, 0x80, 0x00, 0x11, 0x10,
-    0x14, 0x11, 0x10, 0x7e, 0x00, 0x10, 0x1b, 0x14,
-    0x10, 0x1b, 0x7e, 0x03, 0x01, 0x01, 0x16, 0x02,
-    0x02, 0x01, 0x72, 0x00, 0x06, 0x09, 0x07, 0x09,
-    0x06, 0x07, 0x80, 0x04, 0x01, 0x00, 0x05, 0x05,
-    0x00, 0x71, 0x00, 0x1b, 0x0d, 0x16, 0x1b, 0x57,
-    0x00, 0x0d, 0x00, 0x0e, 0x16, 0x0d, 0x0e, 0x67,
-    0x00, 0x12, 0x1d, 0x1c, 0x02, 0x16, 0x01, 0x12,
-    0x16, 0x69, 0x00, 0x02, 0x0b, 0x01, 0x08, 0x17,
-    0x02, 0x08, 0x6a, 0x19, 0x01, 0x17, 0x1a, 0x01,
-    0x18, 0x09, 0x17, 0x18, 0x69, 0x00, 0x0a, 0x00,
-    0x09, 0x06, 0x0a, 0x09, 0x67, 0x00, 0x07, 0x00,
-    0x05, 0x00, 0x07, 0x05, 0x6a, 0x00, 0x0f, 0x0f,
-    0x0c, 0x61, 0x00, 0x0c, 0x0c, 0x64, 0x4d, 0x00,
-    0x14, 0x14, 0x15, 0x5f, 0x00, 0x15, 0x15, 0x64,
-    0x14, 0x4e, 0x1b, 0x4b, 0xb0, 0x24, 0x50, 0x58,
-    0x40, 0x7e, 0x00, 0x13, 0x14, 0x11, 0x14, 0x13,
-    0x11, 0x80, 0x00, 0x11, 0x10, 0x14, 0x11, 0x10,
-    0x7e, 0x00, 0x10, 0x1b, 0x14, 0x10, 0x1b, 0x7e,
-    0x03, 0x01, 0x01, 0x16, 0x02, 0x16, 0x01, 0x02,
-    0x80, 0x00, 0x06, 0x09, 0x07, 0x09, 0x06, 0x07,
-    0x80, 0x04, 0x01, 0x00, 0x05, 0x05, 0x00, 0x71,
-    0x00, 0x1b, 0x0d, 0x16, 0x1b, 0x57, 0x00, 0x0d,
-    0x00, 0x0e, 0x16, 0x0d, 0x0e, 0x67, 0x00, 0x12,
-    0x1d, 0x1c, 0x02, 0x16, 0x01, 0x12, 0x16, 0x69,
-    0x00, 0x02, 0x0b, 0x01, 0x08, 0x17, 0x02, 0x08,
-    0x6a, 0x19, 0x01, 0x17, 0x1a, 0x01, 0x18, 0x09,
-    0x17, 0x18, 0x69, 0x00, 0x0a, 0x00, 0x09, 0x06,
-    0x0a, 0x09, 0x67, 0x00, 0x07, 0x00, 0x05, 0x00,
-    0x07, 0x05, 0x6a, 0x00, 0x0f, 0x0f, 0x0c, 0x61,
-    0x00, 0x0c, 0x0c, 0x64, 0x4d, 0x00, 0x14, 0x14,
-    0x15, 0x5f, 0x00, 0x15, 0x15, 0x64, 0x14, 0x4e,
-    0x1b, 0x40, 0x7d, 0x00, 0x13, 0x14, 0x11, 0x14,
-    0x13, 0x11, 0x80, 0x00, 0x11, 0x10, 0x14, 0x11,
-    0x10, 0x7e, 0x00, 0x10, 0x1b, 0x14, 0x10, 0x1b,
-    0x7e, 0x03, 0x01, 0x01, 0x16, 0x02, 0x16, 0x01,
-    0x02, 0x80, 0x00, 0x06, 0x09, 0x07, 0x09, 0x06,
-    0x07, 0x80, 0x04, 0x01, 0x00, 0x05, 0x00, 0x86,
-    0x00, 0x1b, 0x0d, 0x16, 0x1b, 0x57, 0x00, 0x0d,
-    0x00, 0x0e, 0x16, 0x0d, 0x0e, 0x67, 0x00, 0x12,
-    0x1d, 0x1c, 0x02, 0x16, 0x01, 0x12, 0x16, 0x69,
-    0x00, 0x02, 0x0b, 0x01, 0x08, 0x17, 0x02, 0x08,
-    0x6a, 0x19, 0x01, 0x17, 0x1a, 0x01, 0x18, 0x09,
-    0x17, 0x18, 0x69, 0x00, 0x0a, 0x00, 0x09, 0x06,
-    0x0a, 0x09, 0x67, 0x00, 0x07, 0x00, 0x05, 0x00,
-    0x07, 0x05, 0x6a, 0x00, 0x0f, 0x0f, 0x0c, 0x61,
-    0x00, 0x0c, 0x0c, 0x64, 0x4d, 0x00, 0x14, 0x14,
-    0x15, 0x5f, 0x00, 0x15, 0x15, 0x64, 0x14, 0x4e,
-    0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x40, 0x38,
-    0xc2, 0xc2, 0xc2, 0xc5, 0xc2, 0xc5, 0xc4, 0xc3,
-    0xc0, 0xbe, 0xba, 0xb8, 0xb4, 0xb2, 0xae, 0xac,
-    0xa8, 0xa6, 0x9e, 0x9d, 0x9c, 0x9a, 0x98, 0x96,
-    0x90, 0x8e, 0x87, 0x86, 0x7c, 0x7b, 0x74, 0x72,
-    0x6c, 0x6b, 0x6a, 0x69, 0x62, 0x60, 0x5c, 0x5a,
-    0x56, 0x55, 0x51, 0x4f, 0x26, 0x18, 0x35, 0x22,
-    0x1e, 0x14, 0x25, 0x1e, 0x11, 0x1e, 0x06, 0x1f,
-    0x2b, 0x17, 0x15, 0x23, 0x35, 0x2e, 0x01, 0x35,
-    0x34, 0x36, 0x37, 0x26, 0x27, 0x26, 0x36, 0x37,
-    0x36, 0x33, 0x32, 0x16, 0x17, 0x16, 0x07, 0x36,
-    0x33, 0x32, 0x17, 0x26, 0x37, 0x36, 0x33, 0x32,
-    0x17, 0x1e, 0x01, 0x07, 0x06, 0x07, 0x1e, 0x01,
-    0x15, 0x14, 0x06, 0x07, 0x15, 0x23, 0x35, 0x06,
-    0x23, 0x22, 0x03, 0x14, 0x1e, 0x02, 0x33, 0x32,
-    0x36, 0x37, 0x36, 0x37, 0x06, 0x07, 0x0e, 0x01,
-    0x07, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x26, 0x23,
-    0x22, 0x06, 0x15, 0x14, 0x16, 0x1f, 0x01, 0x23,
-    0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x34, 0x2e,
-    0x02, 0x23, 0x22, 0x06, 0x13, 0x34, 0x36, 0x33,
-    0x32, 0x16, 0x15, 0x14, 0x06, 0x0f, 0x01, 0x15,
-    0x37, 0x15, 0x23, 0x35, 0x37, 0x3e, 0x01, 0x35,
-    0x34, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x17,
-    0x16, 0x17, 0x23, 0x26, 0x27, 0x2e, 0x01, 0x17,
-    0x34, 0x36, 0x37, 0x36, 0x37, 0x33, 0x06, 0x07,
-    0x0e, 0x01, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36,
-    0x35, 0x34, 0x2e, 0x02, 0x2b, 0x01, 0x35, 0x37,
-    0x35, 0x23, 0x35, 0x33, 0x15, 0x07, 0x15, 0x1e,
-    0x01, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x13,
-    0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06,
-    0x23, 0x22, 0x26, 0x25, 0x34, 0x36, 0x33, 0x32,
-    0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x03,
-    0x35, 0x33, 0x15, 0xfa, 0x26, 0x63, 0x71, 0x28,
-    0x2d, 0x18, 0x08, 0x05, 0x10, 0x11, 0x03, 0x05,
-    0x0e, 0x15, 0x04, 0x05, 0x0a, 0x42, 0x6f, 0x6f,
-    0x42, 0x09, 0x04, 0x08, 0x1f, 0x06, 0x03, 0x10,
-    0x0f, 0x04, 0x08, 0x19, 0x2e, 0x28, 0x71, 0x63,
-    0x26, 0x18, 0x1a, 0x1a, 0xef, 0x1f, 0x38, 0x50,
-    0x30, 0x17, 0x20, 0x0b, 0x0d, 0x08, 0x04, 0x09,
-    0x07, 0x1a, 0x16, 0x43, 0x6d, 0x4e, 0x2a, 0x44,
-    0x39, 0x34, 0x3f, 0x1e, 0x19, 0x5b, 0xb6, 0x14,
-    0x18, 0x16, 0x12, 0x13, 0x21, 0x2e, 0x1b, 0x39,
-    0x44, 0x2d, 0x3c, 0x36, 0x35, 0x3a, 0x27, 0x23,
-    0x57, 0xab, 0xeb, 0x6e, 0x1a, 0x1d, 0x32, 0x1a,
-    0x1d, 0x0a, 0x06, 0x06, 0x09, 0x3c, 0x09, 0x06,
-    0x06, 0x0a, 0xfa, 0x06, 0x04, 0x04, 0x06, 0x3c,
-    0x06, 0x04, 0x04, 0x06, 0x1e, 0x19, 0x19, 0x1e,
-    0x08, 0x0e, 0x15, 0x0c, 0x23, 0x47, 0x8d, 0xcd,
-    0x4b, 0x29, 0x31, 0x3f, 0x34, 0x34, 0x3f, 0x37,
-    0x1b, 0x17, 0x17, 0x1b, 0x1b, 0x17, 0x17, 0x1b,
-    0xfe, 0xf2, 0x1c, 0x16, 0x17, 0x1b, 0x1b, 0x17,
-    0x17, 0x1b, 0x73, 0x39, 0x7f, 0x26, 0x2c, 0x17,
-    0x88, 0x66, 0x3f, 0x54, 0x19, 0x05, 0x20, 0x14,
-    0x1e, 0x04, 0x01, 0x15, 0x12, 0x15, 0x10, 0x16,
-    0x16, 0x10, 0x16, 0x26, 0x01, 0x03, 0x1e, 0x14,
-    0x21, 0x05, 0x19, 0x54, 0x3e, 0x67, 0x88, 0x17,
-    0x2c, 0x26, 0x03, 0x01, 0x36, 0x24, 0x38, 0x26,
-    0x14, 0x02, 0x02, 0x02, 0x02, 0x0a, 0x0c, 0x0a,
-    0x1a, 0x0e, 0x1b, 0x37, 0x50, 0x34, 0x3b, 0x47,
-    0x39, 0x2f, 0x1b, 0x2c, 0x0a, 0x23, 0x16, 0x11,
-    0x12, 0x16, 0x1b, 0x33, 0x27, 0x18, 0x47, 0x02,
-    0x40, 0x51, 0x59, 0x59, 0x51, 0x38, 0x6d, 0x27,
-    0x62, 0x09, 0x01, 0x37, 0x46, 0x7d, 0x1d, 0x5a,
-    0x33, 0x73, 0x3c, 0x37, 0x2a, 0x42, 0x17, 0x1b,
-    0x14, 0x14, 0x1b, 0x17, 0x42, 0x94, 0x22, 0x35,
-    0x13, 0x16, 0x11, 0x11, 0x16, 0x13, 0x35, 0x22,
-    0x39, 0x44, 0x44, 0x39, 0x21, 0x38, 0x2a, 0x18,
-    0x41, 0x48, 0x08, 0x37, 0x3c, 0x51, 0x0b, 0x0b,
-    0x70, 0x50, 0x51, 0x63, 0x63, 0xfe, 0xa3, 0x17,
-    0x1b, 0x1b, 0x17, 0x17, 0x1b, 0x1b, 0x17, 0x16,
-    0x1c, 0x1b, 0x17, 0x17, 0x1b, 0x1b, 0x01, 0x14,
-    0x4c, 0x4c, 0x00, 0x00, 0x00, 0x01, 0xfb, 0x8c,
-    0x00, 0x23, 0x02, 0x1c, 0x02, 0x71, 0x00, 0x19,
-    0x00, 0x2e, 0x40, 0x2b, 0x0d, 0x01, 0x04, 0x01,
-    0x01, 0x4c, 0x02, 0x01, 0x00, 0x01, 0x00, 0x85,
-    0x05, 0x01, 0x03, 0x04, 0x03, 0x86, 0x00, 0x01,
-    0x04, 0x04, 0x01, 0x57, 0x00, 0x01, 0x01, 0x04,
-    0x60, 0x00, 0x04, 0x01, 0x04, 0x50, 0x14, 0x23,
-    0x12, 0x14, 0x14, 0x11, 0x06, 0x09, 0x1c, 0x2b,
-    0x01, 0x13, 0x33, 0x07, 0x0e, 0x01, 0x07, 0x21,
-    0x2e, 0x01, 0x2f, 0x01, 0x33, 0x13, 0x03, 0x23,
-    0x37, 0x3e, 0x01, 0x37, 0x21, 0x1e, 0x01, 0x1f,
-    0x01, 0x23, 0xfb, 0x8c, 0xe7, 0x6a, 0xba, 0x05,
-    0x07, 0x04, 0x05, 0x83, 0x04, 0x08, 0x05, 0xba,
-    0x6a, 0xe7, 0xe8, 0x69, 0xbe, 0x04, 0x06, 0x03,
-    0xfa, 0x7c, 0x03, 0x07, 0x04, 0xbd, 0x69, 0x01,
-    0x4a, 0x01, 0x27, 0xec, 0x05, 0x09, 0x05, 0x05,
-    0x09, 0x06, 0xeb, 0xfe, 0xd9, 0xfe, 0xd9, 0xef,
-    0x05, 0x07, 0x04, 0x04, 0x08, 0x05, 0xee, 0x00,
-    0xff, 0xff, 0xfc, 0x6d, 0xff, 0xf6, 0x01, 0x45,
-    0x02, 0x53, 0x10, 0x23, 0x00, 0x4b, 0xff, 0x42,
-    0x00, 0x00, 0x10, 0x23, 0x00, 0x29, 0xfb, 0x97,
-    0x00, 0x00, 0x11, 0x03, 0x00, 0x29, 0xfd, 0x4d,
-    0x00, 0x00, 0x00, 0x2a, 0x40, 0x27, 0x11, 0x10,
-    0x02, 0x01, 0x00, 0x01, 0x4c, 0x12, 0x0a, 0x03,
-    0x02, 0x01, 0x05, 0x00, 0x4a, 0x02, 0x01, 0x00,
-    0x00, 0x01, 0x61, 0x03, 0x01, 0x01, 0x01, 0x43,
-    0x01, 0x4e, 0x29, 0x27, 0x23, 0x21, 0x1d, 0x1b,
-    0x17, 0x15, 0x04, 0x09, 0x21, 0x2b, 0x00, 0x00,
-    0x00, 0x02, 0xfe, 0x8e, 0x00, 0xaa, 0x01, 0x72,
-    0x02, 0x21, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x99,
-    0x4b, 0xb0, 0x2e, 0x50, 0x58, 0x40, 0x1d, 0x00,
-    0x01, 0x08, 0x05, 0x02, 0x03, 0x06, 0x01, 0x03,
-    0x69, 0x00, 0x06, 0x00, 0x07, 0x06, 0x07, 0x64,
-    0x00, 0x04, 0x04, 0x00, 0x61, 0x02, 0x01, 0x00,
-    0x00, 0x3d, 0x04, 0x4e, 0x1b, 0x4b, 0xb0, 0x31,
-    0x50, 0x58, 0x40, 0x28, 0x08, 0x01, 0x05, 0x01,
-    0x03, 0x01, 0x05, 0x03, 0x80, 0x00, 0x01, 0x00,
-    0x03, 0x06, 0x01, 0x03, 0x69, 0x00, 0x06, 0x00,
-    0x07, 0x06, 0x07, 0x64, 0x00, 0x02, 0x02, 0x3d,
-    0x4d, 0x00, 0x04, 0x04, 0x00, 0x61, 0x00, 0x00,
-    0x00, 0x3d, 0x04, 0x4e, 0x1b, 0x40, 0x2b, 0x00,
-    0x02, 0x00, 0x04, 0x00, 0x02, 0x04, 0x80, 0x08,
-    0x01, 0x05, 0x01, 0x03, 0x01, 0x05, 0x03, 0x80,
-    0x00, 0x01, 0x00, 0x03, 0x06, 0x01, 0x03, 0x69,
-    0x00, 0x06, 0x00, 0x07, 0x06, 0x07, 0x64, 0x00,
-    0x04, 0x04, 0x00, 0x61, 0x00, 0x00, 0x00, 0x3d,
-    0x04, 0x4e, 0x59, 0x59, 0x40, 0x12, 0x00, 0x00,
-    0x23, 0x22, 0x21, 0x20, 0x00, 0x1f, 0x00, 0x1f,
-    0x23, 0x25, 0x13, 0x23, 0x25, 0x09, 0x09, 0x1b,
-    0x2b, 0x01, 0x35, 0x34, 0x3e, 0x02, 0x33, 0x32,
-    0x1e, 0x02, 0x33, 0x32, 0x36, 0x3d, 0x01, 0x33,
-    0x15, 0x14, 0x0e, 0x02, 0x23, 0x22, 0x2e, 0x02,
-    0x23, 0x22, 0x06, 0x1d, 0x01, 0x07, 0x21, 0x15,
-    0x21, 0xfe, 0x8e, 0x1b, 0x30, 0x44, 0x29, 0x36,
-    0x64, 0x5d, 0x57, 0x28, 0x2c, 0x35, 0x55, 0x1b,
-    0x30, 0x44, 0x29, 0x36, 0x64, 0x5d, 0x57, 0x28,
-    0x2c, 0x35, 0x55, 0x02, 0xe4, 0xfd, 0x1c, 0x01,
-    0x68, 0x19, 0x24, 0x3b, 0x2a, 0x17, 0x24, 0x2b,
-    0x24, 0x2f, 0x26, 0x19, 0x19, 0x24, 0x3b, 0x2a,
-    0x17, 0x24, 0x2b, 0x24, 0x2f, 0x26, 0x19, 0x6e,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x11,
-    0x00, 0xdc, 0x01, 0xf4, 0x01, 0xb8, 0x00, 0x1f,
-    0x00, 0x61, 0x4b, 0xb0, 0x11, 0x50, 0x58, 0x40,
-    0x21, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x05,
-    0x69, 0x00, 0x01, 0x03, 0x04, 0x01, 0x59, 0x00,
-    0x02, 0x00, 0x03, 0x04, 0x02, 0x03, 0x67, 0x00,
-    0x01, 0x01, 0x04, 0x61, 0x06, 0x01, 0x04, 0x01,
-    0x04, 0x51, 0x1b, 0x40, 0x28, 0x00, 0x06, 0x03,
-    0x04, 0x03, 0x06, 0x04, 0x80, 0x00, 0x00, 0x00,
-    0x05, 0x01, 0x00, 0x05, 0x69, 0x00, 0x01, 0x03,
-    0x04, 0x01, 0x59, 0x00, 0x02, 0x00, 0x03, 0x06,
-    0x02, 0x03, 0x67, 0x00, 0x01, 0x01, 0x04, 0x61,
-    0x00, 0x04, 0x01, 0x04, 0x51, 0x59, 0x40, 0x0a,
-    0x13, 0x25, 0x22, 0x11, 0x12, 0x25, 0x22, 0x07,
-    0x09, 0x1d, 0x2b, 0x01, 0x34, 0x36, 0x33, 0x32,
-    0x1e, 0x04, 0x33, 0x32, 0x36, 0x35, 0x21, 0x15,
-    0x21, 0x0e, 0x01, 0x23, 0x22, 0x2e, 0x04, 0x23,
-    0x22, 0x06, 0x1d, 0x01, 0x23, 0xfe, 0x11, 0x55,
-    0x46, 0x23, 0x33, 0x26, 0x1f, 0x1e, 0x21, 0x16,
-    0x20, 0x26, 0x02, 0x12, 0xfe, 0x2f, 0x14, 0x45,
-    0x2e, 0x22, 0x32, 0x26, 0x1f, 0x1e, 0x23, 0x16,
-    0x20, 0x26, 0x55, 0x01, 0x27, 0x42, 0x4f, 0x15,
-    0x21, 0x25, 0x21, 0x15, 0x29, 0x22, 0x50, 0x21,
-    0x25, 0x15, 0x21, 0x25, 0x21, 0x15, 0x26, 0x20,
-    0x3c, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x0c,
-    0x00, 0xdc, 0x01, 0xef, 0x01, 0xb8, 0x00, 0x1f,
-    0x00, 0x68, 0x4b, 0xb0, 0x11, 0x50, 0x58, 0x40,
-    0x22, 0x00, 0x02, 0x00, 0x04, 0x01, 0x02, 0x04,
-    0x69, 0x00, 0x01, 0x06, 0x03, 0x01, 0x59, 0x00,
-    0x00, 0x07, 0x01, 0x06, 0x03, 0x00, 0x06, 0x67,
-    0x00, 0x01, 0x01, 0x03, 0x61, 0x05, 0x01, 0x03,
-    0x01, 0x03, 0x51, 0x1b, 0x40, 0x29, 0x00, 0x03,
-    0x06, 0x05, 0x06, 0x03, 0x05, 0x80, 0x00, 0x02,
-    0x00, 0x04, 0x01, 0x02, 0x04, 0x69, 0x00, 0x01,
-    0x06, 0x05, 0x01, 0x59, 0x00, 0x00, 0x07, 0x01,
-    0x06, 0x03, 0x00, 0x06, 0x67, 0x00, 0x01, 0x01,
-    0x05, 0x61, 0x00, 0x05, 0x01, 0x05, 0x51, 0x59,
-    0x40, 0x0f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f,
-    0x25, 0x23, 0x13, 0x25, 0x22, 0x11, 0x08, 0x09,
-    0x1c, 0x2b, 0x01, 0x35, 0x21, 0x14, 0x16, 0x33,
-    0x32, 0x3e, 0x04, 0x33, 0x32, 0x16, 0x1d, 0x01,
-    0x23, 0x35, 0x34, 0x26, 0x23, 0x22, 0x0e, 0x04,
-    0x23, 0x22, 0x26, 0x27, 0xfe, 0x0c, 0x02, 0x12,
-    0x26, 0x20, 0x16, 0x21, 0x1e, 0x1f, 0x26, 0x33,
-    0x23, 0x46, 0x55, 0x55, 0x26, 0x20, 0x16, 0x23,
-    0x1e, 0x1f, 0x26, 0x32, 0x22, 0x2e, 0x45, 0x14,
-    0x01, 0x22, 0x50, 0x22, 0x29, 0x15, 0x21, 0x25,
-    0x21, 0x15, 0x4f, 0x42, 0x3c, 0x3c, 0x20, 0x26,
-    0x15, 0x21, 0x25, 0x21, 0x15, 0x25, 0x21, 0x00,
-    0x00, 0x02, 0xfd, 0xe9, 0x00, 0x41, 0x02, 0x08,
-    0x02, 0xda, 0x00, 0x3a, 0x00, 0x46, 0x00, 0xd9,
-    0xb5, 0x12, 0x01, 0x0a, 0x07, 0x01, 0x4c, 0x4b,
-    0xb0, 0x18, 0x50, 0x58, 0x40, 0x2d, 0x00, 0x05,
-    0x00, 0x0b, 0x08, 0x05, 0x0b, 0x69, 0x0c, 0x01,
-    0x00, 0x00, 0x08, 0x01, 0x00, 0x08, 0x69, 0x00,
-    0x01, 0x09, 0x01, 0x07, 0x0a, 0x01, 0x07, 0x69,
-    0x00, 0x0a, 0x04, 0x01, 0x03, 0x0a, 0x03, 0x65,
-    0x00, 0x06, 0x06, 0x02, 0x61, 0x00, 0x02, 0x02,
-    0x42, 0x06, 0x4e, 0x1b, 0x4b, 0xb0, 0x2e, 0x50,
-    0x58, 0x40, 0x34, 0x00, 0x03, 0x0a, 0x04, 0x0a,
-    0x03, 0x04, 0x80, 0x00, 0x05, 0x00, 0x0b, 0x08,
-    0x05, 0x0b, 0x69, 0x0c, 0x01, 0x00, 0x00, 0x08,
-    0x01, 0x00, 0x08, 0x69, 0x00, 0x01, 0x09, 0x01,
-    0x07, 0x0a, 0x01, 0x07, 0x69, 0x00, 0x0a, 0x00,
-    0x04, 0x0a, 0x04, 0x65, 0x00, 0x06, 0x06, 0x02,
-    0x61, 0x00, 0x02, 0x02, 0x42, 0x06, 0x4e, 0x1b,
-    0x40, 0x3b, 0x00, 0x09, 0x01, 0x07, 0x01, 0x09,
-    0x07, 0x80, 0x00, 0x03, 0x0a, 0x04, 0x0a, 0x03,
-    0x04, 0x80, 0x00, 0x05, 0x00, 0x0b, 0x08, 0x05,
-    0x0b, 0x69, 0x0c, 0x01, 0x00, 0x00, 0x08, 0x01,
-    0x00, 0x08, 0x69, 0x00, 0x01, 0x00, 0x07, 0x0a,
-    0x01, 0x07, 0x69, 0x00, 0x0a, 0x00, 0x04, 0x0a,
-    0x04, 0x65, 0x00, 0x06, 0x06, 0x02, 0x61, 0x00,
-    0x02, 0x02, 0x42, 0x06, 0x4e, 0x59, 0x59, 0x40,
-    0x1f, 0x01, 0x00, 0x44, 0x42, 0x3f, 0x3d, 0x37,
-    0x36, 0x34, 0x32, 0x2f, 0x2d, 0x28, 0x26, 0x1c,
-    0x1a, 0x15, 0x13, 0x11, 0x10, 0x0d, 0x0b, 0x06,
-    0x04, 0x00, 0x3a, 0x01, 0x3a, 0x0d, 0x09, 0x16,
-    0x2b, 0x01, 0x32, 0x1e, 0x02, 0x33, 0x32, 0x3e,
-    0x04, 0x33, 0x32, 0x16, 0x15, 0x11, 0x23, 0x27,
-    0x06, 0x23, 0x22, 0x26, 0x3d, 0x01, 0x34, 0x36,
-    0x33, 0x32, 0x17, 0x1e, 0x01, 0x17, 0x2e, 0x01,
-    0x3d, 0x01, 0x34, 0x26, 0x23, 0x22, 0x0e, 0x04,
-    0x23, 0x22, 0x2e, 0x02, 0x23, 0x22, 0x1d, 0x01,
-    0x23, 0x35, 0x34, 0x36, 0x05, 0x14, 0x16, 0x33,
-    0x32, 0x3d, 0x01, 0x34, 0x23, 0x22, 0x06, 0x15,
-    0xfe, 0x6b, 0x2f, 0x4b, 0x3e, 0x35, 0x1a, 0x2b,
-    0x38, 0x2e, 0x2f, 0x45, 0x64, 0x4c, 0x6a, 0x77,
-    0x47, 0x01, 0x18, 0x5e, 0x3f, 0x43, 0x44, 0x3e,
-    0x51, 0x1d, 0x01, 0x02, 0x01, 0x01, 0x03, 0x4d,
-    0x44, 0x3a, 0x4d, 0x39, 0x2f, 0x3a, 0x4f, 0x3b,
-    0x2f, 0x4b, 0x3e, 0x36, 0x19, 0x2f, 0x55, 0x47,
-    0x02, 0xe8, 0x25, 0x22, 0x59, 0x59, 0x22, 0x25,
-    0x01, 0xc7, 0x29, 0x30, 0x29, 0x3c, 0x5a, 0x69,
-    0x5a, 0x3c, 0x72, 0x6a, 0xfe, 0x4d, 0x62, 0x6c,
-    0x5b, 0x54, 0x50, 0x53, 0x5c, 0x50, 0x03, 0x06,
-    0x04, 0x0d, 0x30, 0x1b, 0x14, 0x46, 0x4b, 0x3c,
-    0x5a, 0x69, 0x5a, 0x3c, 0x29, 0x30, 0x29, 0x37,
-    0x46, 0x46, 0x3b, 0x47, 0xd7, 0x36, 0x3a, 0x7a,
-    0x3d, 0x79, 0x3a, 0x36, 0x00, 0x02, 0xfe, 0x39,
-    0x00, 0xaa, 0x01, 0x9f, 0x02, 0xf8, 0x00, 0x11,
-    0x00, 0x15, 0x00, 0x36, 0x40, 0x33, 0x0a, 0x01,
-    0x01, 0x00, 0x01, 0x4c, 0x00, 0x00, 0x01, 0x00,
-    0x85, 0x00, 0x01, 0x03, 0x01, 0x02, 0x04, 0x01,
-    0x02, 0x67, 0x00, 0x04, 0x05, 0x05, 0x04, 0x57,
-    0x00, 0x04, 0x04, 0x05, 0x5f, 0x06, 0x01, 0x05,
-    0x04, 0x05, 0x4f, 0x12, 0x12, 0x12, 0x15, 0x12,
-    0x15, 0x12, 0x1b, 0x11, 0x11, 0x10, 0x07, 0x09,
-    0x1b, 0x2b, 0x03, 0x33, 0x13, 0x21, 0x15, 0x21,
-    0x27, 0x26, 0x27, 0x26, 0x27, 0x23, 0x06, 0x07,
-    0x06, 0x0f, 0x01, 0x23, 0x05, 0x35, 0x21, 0x15,
-    0xff, 0x54, 0x9b, 0x01, 0xaf, 0xfe, 0x1b, 0x77,
-    0x0e, 0x04, 0x03, 0x01, 0x04, 0x02, 0x03, 0x05,
-    0x0d, 0x7c, 0x5d, 0x01, 0x81, 0x01, 0xe5, 0x02,
-    0xf8, 0xfe, 0xf2, 0x50, 0xe1, 0x1a, 0x10, 0x09,
-    0x08, 0x08, 0x09, 0x10, 0x1a, 0xe1, 0xf0, 0x50,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x5c,
-    0xff, 0xab, 0x01, 0x59, 0x02, 0xee, 0x00, 0x07,
-    0x00, 0x47, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40,
-    0x14, 0x00, 0x00, 0x04, 0x01, 0x03, 0x02, 0x00,
-    0x03, 0x67, 0x00, 0x02, 0x02, 0x01, 0x5f, 0x00,
-    0x01, 0x01, 0x3c, 0x02, 0x4e, 0x1b, 0x40, 0x19,
-    0x00, 0x01, 0x00, 0x02, 0x01, 0x57, 0x00, 0x00,
-    0x04, 0x01, 0x03, 0x02, 0x00, 0x03, 0x67, 0x00,
-    0x01, 0x01, 0x02, 0x5f, 0x00, 0x02, 0x01, 0x02,
-    0x4f, 0x59, 0x40, 0x0c, 0x00, 0x00, 0x00, 0x07,
-    0x00, 0x07, 0x11, 0x11, 0x11, 0x05, 0x09, 0x19,
-    0x2b, 0x01, 0x35, 0x21, 0x11, 0x33, 0x11, 0x23,
-    0x11, 0xfe, 0x5c, 0x02, 0xa3, 0x5a, 0x5a, 0x01,
-    0x22, 0x50, 0x01, 0x7c, 0xfc, 0xbd, 0x01, 0x77,
-    0x00, 0x01, 0xfc, 0x22, 0xff, 0x9c, 0x01, 0x86,
-    0x02, 0xee, 0x00, 0x07, 0x00, 0x41, 0x4b, 0xb0,
-    0x17, 0x50, 0x58, 0x40, 0x0f, 0x02, 0x01, 0x00,
-    0x04, 0x01, 0x03, 0x00, 0x03, 0x63, 0x00, 0x01,
-    0x01, 0x3c, 0x01, 0x4e, 0x1b, 0x40, 0x18, 0x00,
-    0x01, 0x00, 0x01, 0x85, 0x02, 0x01, 0x00, 0x03,
-    0x03, 0x00, 0x57, 0x02, 0x01, 0x00, 0x00, 0x03,
-    0x5f, 0x04, 0x01, 0x03, 0x00, 0x03, 0x4f, 0x59,
-    0x40, 0x0c, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07,
-    0x11, 0x11, 0x11, 0x05, 0x09, 0x19, 0x2b, 0x05,
-    0x35, 0x21, 0x11, 0x33, 0x11, 0x21, 0x15, 0xfc,
-    0x22, 0x02, 0x85, 0x5a, 0x02, 0x85, 0x64, 0x4b,
-    0x03, 0x07, 0xfc, 0xf9, 0x4b, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xfe, 0xa7, 0xff, 0xab, 0x01, 0xa4,
-    0x02, 0xee, 0x00, 0x07, 0x00, 0x47, 0x4b, 0xb0,
-    0x17, 0x50, 0x58, 0x40, 0x14, 0x00, 0x01, 0x00,
-    0x02, 0x03, 0x01, 0x02, 0x67, 0x04, 0x01, 0x03,
-    0x03, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x3c, 0x03,
-    0x4e, 0x1b, 0x40, 0x19, 0x00, 0x00, 0x01, 0x03,
-    0x00, 0x57, 0x00, 0x01, 0x00, 0x02, 0x03, 0x01,
-    0x02, 0x67, 0x00, 0x00, 0x00, 0x03, 0x5f, 0x04,
-    0x01, 0x03, 0x00, 0x03, 0x4f, 0x59, 0x40, 0x0c,
-    0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x11, 0x11,
-    0x11, 0x05, 0x09, 0x19, 0x2b, 0x05, 0x11, 0x33,
-    0x11, 0x21, 0x15, 0x21, 0x11, 0xfe, 0xa7, 0x5a,
-    0x02, 0xa3, 0xfd, 0x5d, 0x55, 0x03, 0x43, 0xfe,
-    0x84, 0x50, 0xfe, 0x89, 0x00, 0x02, 0xfc, 0xa4,
-    0xff, 0xab, 0x01, 0x72, 0x02, 0xee, 0x00, 0x07,
-    0x00, 0x0b, 0x00, 0x56, 0x4b, 0xb0, 0x17, 0x50,
-    0x58, 0x40, 0x17, 0x00, 0x01, 0x00, 0x02, 0x03,
-    0x01, 0x02, 0x67, 0x07, 0x05, 0x06, 0x03, 0x03,
-    0x03, 0x00, 0x5f, 0x04, 0x01, 0x00, 0x00, 0x3c,
-    0x03, 0x4e, 0x1b, 0x40, 0x1d, 0x04, 0x01, 0x00,
-    0x01, 0x03, 0x00, 0x57, 0x00, 0x01, 0x00, 0x02,
-    0x03, 0x01, 0x02, 0x67, 0x04, 0x01, 0x00, 0x00,
-    0x03, 0x5f, 0x07, 0x05, 0x06, 0x03, 0x03, 0x00,
-    0x03, 0x4f, 0x59, 0x40, 0x14, 0x08, 0x08, 0x00,
-    0x00, 0x08, 0x0b, 0x08, 0x0b, 0x0a, 0x09, 0x00,
-    0x07, 0x00, 0x07, 0x11, 0x11, 0x11, 0x08, 0x09,
-    0x19, 0x2b, 0x05, 0x11, 0x33, 0x11, 0x21, 0x15,
-    0x21, 0x11, 0x21, 0x11, 0x33, 0x11, 0xfe, 0x52,
-    0x5a, 0x02, 0xc6, 0xfd, 0x3a, 0xfd, 0xf8, 0x5a,
-    0x55, 0x03, 0x43, 0xfe, 0x84, 0x50, 0xfe, 0x89,
-    0x03, 0x43, 0xfc, 0xbd, 0x00, 0x01, 0xfe, 0xa7,
-    0xff, 0xab, 0x01, 0xa4, 0x02, 0xee, 0x00, 0x0b,
-    0x00, 0x59, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40,
-    0x1c, 0x00, 0x01, 0x00, 0x02, 0x03, 0x01, 0x02,
-    0x67, 0x00, 0x03, 0x00, 0x04, 0x05, 0x03, 0x04,
-    0x67, 0x06, 0x01, 0x05, 0x05, 0x00, 0x5f, 0x00,
-    0x00, 0x00, 0x3c, 0x05, 0x4e, 0x1b, 0x40, 0x21,
-    0x00, 0x00, 0x01, 0x05, 0x00, 0x57, 0x00, 0x01,
-    0x00, 0x02, 0x03, 0x01, 0x02, 0x67, 0x00, 0x03,
-    0x00, 0x04, 0x05, 0x03, 0x04, 0x67, 0x00, 0x00,
-    0x00, 0x05, 0x5f, 0x06, 0x01, 0x05, 0x00, 0x05,
-    0x4f, 0x59, 0x40, 0x0e, 0x00, 0x00, 0x00, 0x0b,
-    0x00, 0x0b, 0x11, 0x11, 0x11, 0x11, 0x11, 0x07,
-    0x09, 0x1b, 0x2b, 0x05, 0x11, 0x33, 0x11, 0x21,
-    0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0xfe,
-    0xa7, 0x5a, 0x02, 0xa3, 0xfd, 0x5d, 0x02, 0xa3,
-    0xfd, 0x5d, 0x55, 0x03, 0x43, 0xfe, 0xfc, 0x50,
-    0xa0, 0x50, 0xff, 0x00, 0x00, 0x02, 0xfc, 0xa4,
-    0xff, 0xab, 0x01, 0x72, 0x02, 0xee, 0x00, 0x0b,
-    0x00, 0x0f, 0x00, 0x68, 0x4b, 0xb0, 0x17, 0x50,
-    0x58, 0x40, 0x1f, 0x00, 0x01, 0x00, 0x02, 0x03,
-    0x01, 0x02, 0x67, 0x00, 0x03, 0x00, 0x04, 0x05,
-    0x03, 0x04, 0x67, 0x09, 0x07, 0x08, 0x03, 0x05,
-    0x05, 0x00, 0x5f, 0x06, 0x01, 0x00, 0x00, 0x3c,
-    0x05, 0x4e, 0x1b, 0x40, 0x25, 0x06, 0x01, 0x00,
-    0x01, 0x05, 0x00, 0x57, 0x00, 0x01, 0x00, 0x02,
-    0x03, 0x01, 0x02, 0x67, 0x00, 0x03, 0x00, 0x04,
-    0x05, 0x03, 0x04, 0x67, 0x06, 0x01, 0x00, 0x00,
-    0x05, 0x5f, 0x09, 0x07, 0x08, 0x03, 0x05, 0x00,
-    0x05, 0x4f, 0x59, 0x40, 0x16, 0x0c, 0x0c, 0x00,
-    0x00, 0x0c, 0x0f, 0x0c, 0x0f, 0x0e, 0x0d, 0x00,
-    0x0b, 0x00, 0x0b, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x0a, 0x09, 0x1b, 0x2b, 0x05, 0x11, 0x33, 0x11,
-    0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15,
-    0x21, 0x11, 0x33, 0x11, 0xfe, 0x52, 0x5a, 0x02,
-    0xc6, 0xfd, 0x3a, 0x02, 0xc6, 0xfd, 0x3a, 0xfd,
-    0xf8, 0x5a, 0x55, 0x03, 0x43, 0xfe, 0xfc, 0x50,
-    0xa0, 0x50, 0xff, 0x03, 0x43, 0xfc, 0xbd, 0x00,
-    0x00, 0x03, 0xfd, 0xcb, 0xff, 0x92, 0x02, 0x03,
-    0x03, 0x3e, 0x00, 0x3b, 0x00, 0x47, 0x00, 0x4b,
-    0x00, 0xdb, 0x40, 0x0a, 0x1b, 0x01, 0x01, 0x02,
-    0x26, 0x01, 0x0c, 0x00, 0x02, 0x4c, 0x4b, 0xb0,
-    0x0e, 0x50, 0x58, 0x40, 0x46, 0x00, 0x09, 0x12,
-    0x11, 0x01, 0x09, 0x72, 0x00, 0x07, 0x00, 0x08,
-    0x03, 0x07, 0x08, 0x69, 0x06, 0x04, 0x02, 0x02,
-    0x15, 0x13, 0x02, 0x01, 0x12, 0x02, 0x01, 0x68,
-    0x00, 0x12, 0x00, 0x11, 0x00, 0x12, 0x11, 0x69,
-    0x19, 0x16, 0x18, 0x14, 0x04, 0x00, 0x17, 0x10,
-    0x0e, 0x03, 0x0c, 0x0d, 0x00, 0x0c, 0x67, 0x00,
-    0x0a, 0x00, 0x0b, 0x0a, 0x0b, 0x65, 0x05, 0x01,
-    0x03, 0x03, 0x3a, 0x4d, 0x0f, 0x01, 0x0d, 0x0d,
-    0x3b, 0x0d, 0x4e, 0x1b, 0x40, 0x47, 0x00, 0x09,
-    0x12, 0x11, 0x12, 0x09, 0x11, 0x80, 0x00, 0x07,
-    0x00, 0x08, 0x03, 0x07, 0x08, 0x69, 0x06, 0x04,
-    0x02, 0x02, 0x15, 0x13, 0x02, 0x01, 0x12, 0x02,
-    0x01, 0x68, 0x00, 0x12, 0x00, 0x11, 0x00, 0x12,
-    0x11, 0x69, 0x19, 0x16, 0x18, 0x14, 0x04, 0x00,
-    0x17, 0x10, 0x0e, 0x03, 0x0c, 0x0d, 0x00, 0x0c,
-    0x67, 0x00, 0x0a, 0x00, 0x0b, 0x0a, 0x0b, 0x65,
-    0x05, 0x01, 0x03, 0x03, 0x3a, 0x4d, 0x0f, 0x01,
-    0x0d, 0x0d, 0x3b, 0x0d, 0x4e, 0x59, 0x40, 0x34,
-    0x48, 0x48, 0x3c, 0x3c, 0x00, 0x00, 0x48, 0x4b,
-    0x48, 0x4b, 0x4a, 0x49, 0x3c, 0x47, 0x3c, 0x47,
-    0x46, 0x45, 0x43, 0x41, 0x40, 0x3e, 0x00, 0x3b,
-    0x00, 0x3b, 0x3a, 0x39, 0x38, 0x37, 0x36, 0x35,
-    0x34, 0x33, 0x2e, 0x2c, 0x2b, 0x29, 0x20, 0x1f,
-    0x21, 0x25, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x1a, 0x09, 0x1f, 0x2b, 0x25, 0x35, 0x33,
-    0x37, 0x23, 0x35, 0x33, 0x37, 0x33, 0x07, 0x33,
-    0x37, 0x33, 0x07, 0x21, 0x27, 0x26, 0x3e, 0x02,
-    0x3b, 0x01, 0x15, 0x23, 0x22, 0x06, 0x1f, 0x01,
-    0x16, 0x0e, 0x02, 0x07, 0x15, 0x1e, 0x03, 0x0f,
-    0x01, 0x06, 0x16, 0x3b, 0x01, 0x15, 0x23, 0x22,
-    0x2e, 0x02, 0x3f, 0x01, 0x21, 0x07, 0x23, 0x37,
-    0x23, 0x07, 0x23, 0x37, 0x25, 0x2e, 0x01, 0x2b,
-    0x01, 0x35, 0x33, 0x32, 0x36, 0x37, 0x21, 0x07,
-    0x23, 0x37, 0x23, 0x07, 0xfd, 0xcb, 0x61, 0x24,
-    0x63, 0x6f, 0x25, 0x46, 0x25, 0xa0, 0x25, 0x46,
-    0x25, 0x01, 0x9e, 0x09, 0x02, 0x18, 0x30, 0x47,
-    0x2c, 0x2d, 0x2d, 0x30, 0x31, 0x02, 0x0a, 0x02,
-    0x0e, 0x1d, 0x2c, 0x1e, 0x1e, 0x2d, 0x1c, 0x0e,
-    0x02, 0x0a, 0x02, 0x31, 0x30, 0x2d, 0x2d, 0x2c,
-    0x47, 0x30, 0x18, 0x02, 0x09, 0xfe, 0x26, 0x25,
-    0x46, 0x25, 0xa0, 0x25, 0x46, 0x25, 0x03, 0x05,
-    0x05, 0x2c, 0x31, 0x32, 0x32, 0x31, 0x2c, 0x05,
-    0xfe, 0x57, 0x24, 0x46, 0x24, 0xa0, 0x24, 0xc8,
-    0x41, 0xbe, 0x41, 0xc8, 0xc8, 0xc8, 0xc8, 0x90,
-    0x27, 0x3e, 0x2b, 0x16, 0x50, 0x2b, 0x2b, 0xa5,
-    0x1b, 0x31, 0x25, 0x16, 0x01, 0x05, 0x01, 0x17,
-    0x26, 0x32, 0x1b, 0xa3, 0x2b, 0x2b, 0x50, 0x16,
-    0x2b, 0x3e, 0x27, 0x90, 0xc8, 0xc8, 0xc8, 0xc8,
-    0x41, 0x1d, 0x19, 0x50, 0x1b, 0x1d, 0xbe, 0xbe,
-    0xbe, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfd, 0xcb,
-    0xff, 0x92, 0x01, 0xc7, 0x03, 0x3e, 0x00, 0x1f,
-    0x00, 0x23, 0x00, 0x27, 0x00, 0x63, 0x40, 0x60,
-    0x00, 0x06, 0x00, 0x07, 0x02, 0x06, 0x07, 0x67,
-    0x05, 0x03, 0x02, 0x01, 0x13, 0x10, 0x02, 0x00,
-    0x0f, 0x01, 0x00, 0x68, 0x12, 0x15, 0x11, 0x14,
-    0x04, 0x0f, 0x0e, 0x0c, 0x02, 0x0a, 0x0b, 0x0f,
-    0x0a, 0x67, 0x00, 0x08, 0x00, 0x09, 0x08, 0x09,
-    0x63, 0x04, 0x01, 0x02, 0x02, 0x3a, 0x4d, 0x0d,
-    0x01, 0x0b, 0x0b, 0x3b, 0x0b, 0x4e, 0x20, 0x20,
-    0x00, 0x00, 0x27, 0x26, 0x25, 0x24, 0x20, 0x23,
-    0x20, 0x23, 0x22, 0x21, 0x00, 0x1f, 0x00, 0x1f,
-    0x1e, 0x1d, 0x1c, 0x1b, 0x1a, 0x19, 0x18, 0x17,
-    0x16, 0x15, 0x14, 0x13, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x16, 0x09, 0x1f,
-    0x2b, 0x01, 0x37, 0x23, 0x35, 0x33, 0x37, 0x33,
-    0x07, 0x33, 0x37, 0x33, 0x07, 0x21, 0x11, 0x33,
-    0x15, 0x23, 0x11, 0x33, 0x15, 0x23, 0x11, 0x21,
-    0x07, 0x23, 0x37, 0x23, 0x07, 0x23, 0x37, 0x23,
-    0x35, 0x21, 0x35, 0x21, 0x07, 0x23, 0x33, 0x37,
-    0x23, 0xfe, 0x2c, 0x24, 0x63, 0x6f, 0x25, 0x46,
-    0x25, 0xa0, 0x25, 0x46, 0x25, 0x01, 0x4a, 0xf5,
-    0x9b, 0x9b, 0xf5, 0xfe, 0x7a, 0x25, 0x46, 0x25,
-    0xa0, 0x25, 0x46, 0x25, 0x55, 0x03, 0x07, 0xfe,
-    0xaa, 0x24, 0xe6, 0xa0, 0x24, 0xa0, 0x01, 0x09,
-    0xbe, 0x41, 0xc8, 0xc8, 0xc8, 0xc8, 0x01, 0x36,
-    0x50, 0xfc, 0xf4, 0x50, 0x01, 0x36, 0xc8, 0xc8,
-    0xc8, 0xc8, 0x41, 0xbe, 0xbe, 0xbe, 0x00, 0x00,
-    0x00, 0x03, 0xfe, 0x3e, 0xff, 0x92, 0x02, 0x35,
-    0x03, 0x3e, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x27,
-    0x00, 0x63, 0x40, 0x60, 0x00, 0x01, 0x00, 0x00,
-    0x03, 0x01, 0x00, 0x67, 0x06, 0x04, 0x02, 0x02,
-    0x13, 0x15, 0x11, 0x03, 0x07, 0x08, 0x02, 0x07,
-    0x68, 0x12, 0x10, 0x02, 0x08, 0x0d, 0x0b, 0x02,
-    0x09, 0x0a, 0x08, 0x09, 0x67, 0x14, 0x01, 0x0f,
-    0x00, 0x0e, 0x0f, 0x0e, 0x63, 0x05, 0x01, 0x03,
-    0x03, 0x3a, 0x4d, 0x0c, 0x01, 0x0a, 0x0a, 0x3b,
-    0x0a, 0x4e, 0x20, 0x20, 0x00, 0x00, 0x27, 0x26,
-    0x25, 0x24, 0x20, 0x23, 0x20, 0x23, 0x22, 0x21,
-    0x00, 0x1f, 0x00, 0x1f, 0x1e, 0x1d, 0x1c, 0x1b,
-    0x1a, 0x19, 0x18, 0x17, 0x16, 0x15, 0x14, 0x13,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x16, 0x09, 0x1f, 0x2b, 0x05, 0x11, 0x23,
-    0x35, 0x33, 0x11, 0x21, 0x37, 0x33, 0x07, 0x33,
-    0x37, 0x33, 0x07, 0x33, 0x15, 0x23, 0x07, 0x33,
-    0x15, 0x23, 0x07, 0x23, 0x37, 0x23, 0x07, 0x23,
-    0x37, 0x21, 0x11, 0x23, 0x35, 0x13, 0x15, 0x21,
-    0x37, 0x17, 0x33, 0x37, 0x23, 0xfe, 0xd9, 0x9b,
-    0xf5, 0x01, 0x81, 0x25, 0x46, 0x25, 0xa0, 0x25,
-    0x46, 0x25, 0x55, 0x61, 0x24, 0x62, 0x6e, 0x25,
-    0x46, 0x25, 0xa0, 0x25, 0x46, 0x25, 0xfe, 0xbb,
-    0xf5, 0xf5, 0x01, 0x51, 0x24, 0x22, 0xa0, 0x24,
-    0xa0, 0x1e, 0x03, 0x0c, 0x50, 0xfe, 0xca, 0xc8,
-    0xc8, 0xc8, 0xc8, 0x41, 0xbe, 0x41, 0xc8, 0xc8,
-    0xc8, 0xc8, 0xfe, 0xca, 0x50, 0x01, 0xe5, 0xbe,
-    0xbe, 0xbe, 0xbe, 0x00, 0x00, 0x03, 0xfd, 0xcb,
-    0xff, 0x83, 0x01, 0xe5, 0x03, 0x4d, 0x00, 0x2b,
-    0x00, 0x2f, 0x00, 0x33, 0x00, 0x5d, 0x40, 0x5a,
-    0x14, 0x13, 0x02, 0x03, 0x4a, 0x20, 0x1f, 0x02,
-    0x08, 0x49, 0x06, 0x04, 0x02, 0x02, 0x0e, 0x0c,
-    0x02, 0x01, 0x00, 0x02, 0x01, 0x68, 0x12, 0x0f,
-    0x11, 0x0d, 0x04, 0x00, 0x10, 0x0b, 0x09, 0x03,
-    0x07, 0x08, 0x00, 0x07, 0x67, 0x05, 0x01, 0x03,
-    0x03, 0x3a, 0x4d, 0x0a, 0x01, 0x08, 0x08, 0x3b,
-    0x08, 0x4e, 0x30, 0x30, 0x2c, 0x2c, 0x00, 0x00,
-    0x30, 0x33, 0x30, 0x33, 0x32, 0x31, 0x2c, 0x2f,
-    0x2c, 0x2f, 0x2e, 0x2d, 0x00, 0x2b, 0x00, 0x2b,
-    0x2a, 0x29, 0x28, 0x27, 0x26, 0x25, 0x24, 0x23,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13,
-    0x09, 0x1d, 0x2b, 0x25, 0x35, 0x33, 0x37, 0x23,
-    0x35, 0x33, 0x37, 0x33, 0x07, 0x33, 0x37, 0x33,
-    0x07, 0x21, 0x3e, 0x03, 0x37, 0x15, 0x0e, 0x03,
-    0x1d, 0x01, 0x14, 0x1e, 0x02, 0x17, 0x15, 0x2e,
-    0x01, 0x27, 0x21, 0x07, 0x23, 0x37, 0x23, 0x07,
-    0x23, 0x37, 0x25, 0x35, 0x21, 0x07, 0x23, 0x37,
-    0x23, 0x07, 0xfd, 0xcb, 0x61, 0x24, 0x63, 0x6f,
-    0x25, 0x46, 0x25, 0xa0, 0x25, 0x46, 0x25, 0x01,
-    0x35, 0x09, 0x30, 0x4c, 0x66, 0x3d, 0x30, 0x4e,
-    0x36, 0x1e, 0x1d, 0x37, 0x4e, 0x30, 0x7f, 0x98,
-    0x11, 0xfe, 0x8f, 0x25, 0x46, 0x25, 0xa0, 0x25,
-    0x46, 0x25, 0x02, 0x99, 0xfe, 0xc3, 0x24, 0x46,
-    0x24, 0xa0, 0x24, 0xc8, 0x41, 0xbe, 0x41, 0xc8,
-    0xc8, 0xc8, 0xc8, 0x3d, 0x69, 0x54, 0x3c, 0x0f,
-    0x55, 0x0b, 0x36, 0x50, 0x65, 0x3b, 0xbe, 0x3a,
-    0x64, 0x4e, 0x36, 0x0b, 0x59, 0x20, 0xa8, 0x7d,
-    0xc8, 0xc8, 0xc8, 0xc8, 0x41, 0xbe, 0xbe, 0xbe,
-    0xbe, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfd, 0xcb,
-    0xff, 0xfb, 0x02, 0x08, 0x02, 0xd0, 0x00, 0x37,
-    0x00, 0x3b, 0x00, 0x49, 0x00, 0xbc, 0xb5, 0x1a,
-    0x01, 0x0b, 0x08, 0x01, 0x4c, 0x4b, 0xb0, 0x2e,
-    0x50, 0x58, 0x40, 0x3a, 0x05, 0x03, 0x02, 0x01,
-    0x12, 0x0a, 0x02, 0x00, 0x08, 0x01, 0x00, 0x68,
-    0x00, 0x08, 0x0b, 0x07, 0x08, 0x59, 0x17, 0x13,
-    0x16, 0x11, 0x04, 0x0b, 0x10, 0x0e, 0x0c, 0x03,
-    0x07, 0x14, 0x0b, 0x07, 0x67, 0x00, 0x09, 0x09,
-    0x02, 0x5f, 0x06, 0x04, 0x02, 0x02, 0x02, 0x3a,
-    0x4d, 0x00, 0x14, 0x14, 0x0d, 0x5f, 0x15, 0x0f,
-    0x02, 0x0d, 0x0d, 0x3b, 0x0d, 0x4e, 0x1b, 0x40,
-    0x3f, 0x05, 0x03, 0x02, 0x01, 0x12, 0x0a, 0x02,
-    0x00, 0x08, 0x01, 0x00, 0x68, 0x00, 0x08, 0x00,
-    0x07, 0x0c, 0x08, 0x07, 0x67, 0x17, 0x13, 0x16,
-    0x11, 0x04, 0x0b, 0x10, 0x0e, 0x02, 0x0c, 0x14,
-    0x0b, 0x0c, 0x67, 0x00, 0x09, 0x09, 0x02, 0x5f,
-    0x06, 0x04, 0x02, 0x02, 0x02, 0x3a, 0x4d, 0x0f,
-    0x01, 0x0d, 0x0d, 0x3b, 0x4d, 0x00, 0x14, 0x14,
-    0x15, 0x61, 0x00, 0x15, 0x15, 0x3b, 0x15, 0x4e,
-    0x59, 0x40, 0x2e, 0x38, 0x38, 0x00, 0x00, 0x48,
-    0x45, 0x41, 0x3e, 0x38, 0x3b, 0x38, 0x3b, 0x3a,
-    0x39, 0x00, 0x37, 0x00, 0x37, 0x36, 0x35, 0x34,
-    0x33, 0x32, 0x31, 0x30, 0x2f, 0x2e, 0x2d, 0x2c,
-    0x2b, 0x2a, 0x29, 0x26, 0x23, 0x21, 0x1a, 0x32,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0x09,
-    0x1f, 0x2b, 0x01, 0x37, 0x23, 0x35, 0x33, 0x37,
-    0x33, 0x07, 0x33, 0x37, 0x33, 0x07, 0x33, 0x3e,
-    0x01, 0x3b, 0x01, 0x32, 0x1e, 0x02, 0x15, 0x14,
-    0x0e, 0x02, 0x07, 0x15, 0x23, 0x35, 0x33, 0x32,
-    0x36, 0x35, 0x34, 0x26, 0x2b, 0x01, 0x22, 0x06,
-    0x1d, 0x01, 0x21, 0x07, 0x33, 0x15, 0x23, 0x07,
-    0x23, 0x37, 0x23, 0x07, 0x23, 0x37, 0x23, 0x35,
-    0x21, 0x37, 0x23, 0x07, 0x05, 0x34, 0x36, 0x3b,
-    0x01, 0x32, 0x16, 0x15, 0x14, 0x06, 0x2b, 0x01,
-    0x22, 0x26, 0xfe, 0x2c, 0x24, 0x63, 0x6f, 0x25,
-    0x46, 0x25, 0xa0, 0x25, 0x46, 0x25, 0xa0, 0x02,
-    0x7a, 0x6a, 0x14, 0x35, 0x55, 0x3c, 0x20, 0x1c,
-    0x31, 0x46, 0x2a, 0x5a, 0x32, 0x40, 0x49, 0x4a,
-    0x40, 0x14, 0x41, 0x4b, 0xfe, 0xfa, 0x24, 0x62,
-    0x6e, 0x25, 0x46, 0x25, 0xa0, 0x25, 0x46, 0x25,
-    0x55, 0x01, 0x47, 0x24, 0xa0, 0x24, 0x02, 0x60,
-    0x24, 0x1d, 0x14, 0x1d, 0x24, 0x24, 0x1d, 0x14,
-    0x1d, 0x24, 0x01, 0x09, 0xbe, 0x41, 0xc8, 0xc8,
-    0xc8, 0xc8, 0x5e, 0x6a, 0x1d, 0x37, 0x4e, 0x30,
-    0x2a, 0x49, 0x36, 0x21, 0x03, 0x64, 0xaf, 0x46,
-    0x3c, 0x3c, 0x46, 0x43, 0x3a, 0x3c, 0xbe, 0x41,
-    0xc8, 0xc8, 0xc8, 0xc8, 0x41, 0xbe, 0xbe, 0xd3,
-    0x1b, 0x22, 0x22, 0x1b, 0x1b, 0x20, 0x1f, 0x00,
-    0x00, 0x02, 0xfd, 0xcb, 0xff, 0x9c, 0x02, 0x1c,
-    0x02, 0xd0, 0x00, 0x1d, 0x00, 0x21, 0x00, 0x4f,
-    0x40, 0x4c, 0x05, 0x03, 0x02, 0x01, 0x10, 0x06,
-    0x02, 0x00, 0x07, 0x01, 0x00, 0x68, 0x0f, 0x11,
-    0x0e, 0x03, 0x07, 0x0d, 0x0b, 0x02, 0x08, 0x0c,
-    0x07, 0x08, 0x67, 0x00, 0x09, 0x00, 0x0a, 0x09,
-    0x0a, 0x63, 0x04, 0x01, 0x02, 0x02, 0x3a, 0x4d,
-    0x00, 0x0c, 0x0c, 0x3b, 0x0c, 0x4e, 0x00, 0x00,
-    0x21, 0x20, 0x1f, 0x1e, 0x00, 0x1d, 0x00, 0x1d,
-    0x1c, 0x1b, 0x1a, 0x19, 0x18, 0x17, 0x16, 0x15,
-    0x14, 0x13, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x12, 0x09, 0x1f, 0x2b, 0x01,
-    0x37, 0x23, 0x35, 0x33, 0x37, 0x33, 0x07, 0x33,
-    0x37, 0x33, 0x07, 0x33, 0x15, 0x23, 0x07, 0x33,
-    0x15, 0x23, 0x07, 0x21, 0x15, 0x21, 0x13, 0x23,
-    0x07, 0x23, 0x37, 0x23, 0x35, 0x3b, 0x01, 0x37,
-    0x23, 0xfe, 0x2c, 0x24, 0x63, 0x6f, 0x25, 0x46,
-    0x25, 0xa0, 0x25, 0x46, 0x25, 0x55, 0x61, 0x24,
-    0x62, 0x6e, 0x2a, 0x02, 0xfa, 0xfc, 0xb2, 0x38,
-    0xa0, 0x25, 0x46, 0x25, 0x55, 0xa7, 0xa0, 0x24,
-    0xa0, 0x01, 0x09, 0xbe, 0x41, 0xc8, 0xc8, 0xc8,
-    0xc8, 0x41, 0xbe, 0x41, 0xe1, 0x4b, 0x01, 0x2c,
-    0xc8, 0xc8, 0x41, 0xbe, 0x00, 0x02, 0xfb, 0x73,
-    0xff, 0x9c, 0x01, 0xdb, 0x03, 0x43, 0x00, 0x33,
-    0x00, 0x37, 0x00, 0x59, 0x40, 0x56, 0x2a, 0x01,
-    0x0a, 0x01, 0x4b, 0x1f, 0x1e, 0x02, 0x03, 0x4a,
-    0x06, 0x04, 0x02, 0x02, 0x0f, 0x07, 0x02, 0x01,
-    0x00, 0x02, 0x01, 0x68, 0x11, 0x10, 0x08, 0x03,
-    0x00, 0x0e, 0x0c, 0x02, 0x09, 0x0d, 0x00, 0x09,
-    0x67, 0x00, 0x0a, 0x00, 0x0b, 0x0a, 0x0b, 0x63,
-    0x05, 0x01, 0x03, 0x03, 0x3a, 0x4d, 0x00, 0x0d,
-    0x0d, 0x3b, 0x0d, 0x4e, 0x34, 0x34, 0x34, 0x37,
-    0x34, 0x37, 0x36, 0x35, 0x33, 0x32, 0x31, 0x30,
-    0x2f, 0x2e, 0x2d, 0x2c, 0x15, 0x14, 0x13, 0x12,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x10, 0x12, 0x09, 0x1f, 0x2b, 0x01, 0x33, 0x37,
-    0x23, 0x35, 0x33, 0x37, 0x33, 0x07, 0x33, 0x37,
-    0x33, 0x07, 0x33, 0x15, 0x23, 0x07, 0x33, 0x15,
-    0x23, 0x07, 0x21, 0x2e, 0x01, 0x3d, 0x01, 0x34,
-    0x3e, 0x02, 0x37, 0x15, 0x0e, 0x03, 0x1d, 0x01,
-    0x14, 0x1e, 0x02, 0x17, 0x33, 0x15, 0x21, 0x13,
-    0x23, 0x07, 0x23, 0x37, 0x23, 0x25, 0x37, 0x23,
-    0x07, 0xfb, 0x73, 0x61, 0x24, 0x63, 0x6f, 0x25,
-    0x46, 0x25, 0xa0, 0x25, 0x46, 0x25, 0x55, 0x61,
-    0x24, 0x62, 0x6e, 0x2a, 0x04, 0x6e, 0x42, 0x47,
-    0x2a, 0x4e, 0x6f, 0x45, 0x30, 0x4e, 0x36, 0x1e,
-    0x1d, 0x35, 0x4c, 0x30, 0x04, 0xfa, 0x9b, 0x38,
-    0xa0, 0x25, 0x46, 0x25, 0x55, 0x01, 0x47, 0x24,
-    0xa0, 0x24, 0x01, 0x09, 0xbe, 0x41, 0xc8, 0xc8,
-    0xc8, 0xc8, 0x41, 0xbe, 0x41, 0xe1, 0x33, 0x95,
-    0x64, 0xaa, 0x49, 0x7f, 0x65, 0x48, 0x11, 0x55,
-    0x0b, 0x36, 0x50, 0x65, 0x3b, 0xaa, 0x39, 0x63,
-    0x4e, 0x36, 0x0c, 0x4b, 0x01, 0x2c, 0xc8, 0xc8,
-    0x41, 0xbe, 0xbe, 0x00, 0x00, 0x04, 0xfd, 0xcb,
-    0x00, 0x00, 0x01, 0x7c, 0x02, 0xd0, 0x00, 0x1b,
-    0x00, 0x1f, 0x00, 0x2b, 0x00, 0x37, 0x00, 0x69,
-    0x40, 0x66, 0x0a, 0x08, 0x02, 0x06, 0x0e, 0x0b,
-    0x02, 0x05, 0x13, 0x06, 0x05, 0x68, 0x16, 0x01,
-    0x12, 0x00, 0x13, 0x10, 0x12, 0x13, 0x69, 0x15,
-    0x0f, 0x0c, 0x03, 0x04, 0x14, 0x0d, 0x03, 0x03,
-    0x01, 0x11, 0x04, 0x01, 0x67, 0x00, 0x10, 0x00,
-    0x11, 0x00, 0x10, 0x11, 0x69, 0x09, 0x01, 0x07,
-    0x07, 0x3a, 0x4d, 0x02, 0x01, 0x00, 0x00, 0x3b,
-    0x00, 0x4e, 0x2d, 0x2c, 0x1c, 0x1c, 0x00, 0x00,
-    0x33, 0x31, 0x2c, 0x37, 0x2d, 0x37, 0x2a, 0x28,
-    0x24, 0x22, 0x1c, 0x1f, 0x1c, 0x1f, 0x1e, 0x1d,
-    0x00, 0x1b, 0x00, 0x1b, 0x1a, 0x19, 0x18, 0x17,
-    0x16, 0x15, 0x14, 0x13, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0x09, 0x1f,
-    0x2b, 0x27, 0x07, 0x23, 0x37, 0x23, 0x07, 0x23,
-    0x37, 0x23, 0x35, 0x33, 0x37, 0x23, 0x35, 0x33,
-    0x37, 0x33, 0x07, 0x33, 0x37, 0x33, 0x07, 0x33,
-    0x15, 0x23, 0x07, 0x33, 0x15, 0x27, 0x37, 0x23,
-    0x07, 0x05, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15,
-    0x14, 0x06, 0x23, 0x22, 0x26, 0x13, 0x32, 0x16,
-    0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34,
-    0x36, 0xb4, 0x25, 0x46, 0x25, 0xa0, 0x25, 0x46,
-    0x25, 0x55, 0x61, 0x24, 0x63, 0x6f, 0x25, 0x46,
-    0x25, 0xa0, 0x25, 0x46, 0x25, 0x55, 0x61, 0x24,
-    0x62, 0xa8, 0x24, 0xa0, 0x24, 0x02, 0x6a, 0x2c,
-    0x24, 0x24, 0x2c, 0x2c, 0x24, 0x24, 0x2c, 0x50,
-    0x24, 0x2c, 0x2c, 0x24, 0x24, 0x2c, 0x2c, 0xc8,
-    0xc8, 0xc8, 0xc8, 0xc8, 0x41, 0xbe, 0x41, 0xc8,
-    0xc8, 0xc8, 0xc8, 0x41, 0xbe, 0x41, 0x41, 0xbe,
-    0xbe, 0x36, 0x24, 0x2b, 0x2b, 0x24, 0x25, 0x2c,
-    0x2c, 0x01, 0xa0, 0x2c, 0x24, 0x25, 0x2b, 0x2b,
-    0x25, 0x24, 0x2c, 0x00, 0x00, 0x04, 0xfd, 0xcb,
-    0xff, 0xfb, 0x01, 0x7c, 0x02, 0xd0, 0x00, 0x1b,
-    0x00, 0x21, 0x00, 0x25, 0x00, 0x33, 0x00, 0xe0,
-    0x4b, 0xb0, 0x11, 0x50, 0x58, 0x40, 0x2f, 0x05,
-    0x03, 0x02, 0x01, 0x10, 0x06, 0x02, 0x00, 0x07,
-    0x01, 0x00, 0x68, 0x15, 0x11, 0x14, 0x0d, 0x04,
-    0x07, 0x0f, 0x0c, 0x0a, 0x03, 0x08, 0x12, 0x07,
-    0x08, 0x67, 0x0e, 0x04, 0x02, 0x02, 0x02, 0x3a,
-    0x4d, 0x00, 0x12, 0x12, 0x09, 0x5f, 0x13, 0x0b,
-    0x02, 0x09, 0x09, 0x3b, 0x09, 0x4e, 0x1b, 0x4b,
-    0xb0, 0x2e, 0x50, 0x58, 0x40, 0x36, 0x00, 0x0f,
-    0x07, 0x08, 0x07, 0x0f, 0x08, 0x80, 0x05, 0x03,
-    0x02, 0x01, 0x10, 0x06, 0x02, 0x00, 0x07, 0x01,
-    0x00, 0x68, 0x15, 0x11, 0x14, 0x0d, 0x04, 0x07,
-    0x0c, 0x0a, 0x02, 0x08, 0x12, 0x07, 0x08, 0x67,
-    0x0e, 0x04, 0x02, 0x02, 0x02, 0x3a, 0x4d, 0x00,
-    0x12, 0x12, 0x09, 0x5f, 0x13, 0x0b, 0x02, 0x09,
-    0x09, 0x3b, 0x09, 0x4e, 0x1b, 0x40, 0x3a, 0x00,
-    0x0f, 0x07, 0x08, 0x07, 0x0f, 0x08, 0x80, 0x05,
-    0x03, 0x02, 0x01, 0x10, 0x06, 0x02, 0x00, 0x07,
-    0x01, 0x00, 0x68, 0x15, 0x11, 0x14, 0x0d, 0x04,
-    0x07, 0x0c, 0x0a, 0x02, 0x08, 0x12, 0x07, 0x08,
-    0x67, 0x0e, 0x04, 0x02, 0x02, 0x02, 0x3a, 0x4d,
-    0x0b, 0x01, 0x09, 0x09, 0x3b, 0x4d, 0x00, 0x12,
-    0x12, 0x13, 0x61, 0x00, 0x13, 0x13, 0x3b, 0x13,
-    0x4e, 0x59, 0x59, 0x40, 0x2a, 0x22, 0x22, 0x00,
-    0x00, 0x32, 0x2f, 0x2b, 0x28, 0x22, 0x25, 0x22,
-    0x25, 0x24, 0x23, 0x21, 0x20, 0x1e, 0x1d, 0x00,
-    0x1b, 0x00, 0x1b, 0x1a, 0x19, 0x18, 0x17, 0x16,
-    0x15, 0x14, 0x13, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x16, 0x09, 0x1f, 0x2b,
-    0x01, 0x37, 0x23, 0x35, 0x33, 0x37, 0x33, 0x07,
-    0x33, 0x37, 0x33, 0x07, 0x33, 0x15, 0x23, 0x07,
-    0x33, 0x15, 0x23, 0x07, 0x23, 0x37, 0x23, 0x07,
-    0x23, 0x37, 0x23, 0x35, 0x01, 0x37, 0x33, 0x07,
-    0x03, 0x23, 0x25, 0x37, 0x23, 0x07, 0x05, 0x3e,
-    0x01, 0x3b, 0x01, 0x32, 0x16, 0x07, 0x0e, 0x01,
-    0x2b, 0x01, 0x22, 0x26, 0xfe, 0x2c, 0x24, 0x63,
-    0x6f, 0x25, 0x46, 0x25, 0xa0, 0x25, 0x46, 0x25,
-    0x55, 0x61, 0x24, 0x62, 0x6e, 0x25, 0x46, 0x25,
-    0xa0, 0x25, 0x46, 0x25, 0x55, 0x03, 0x32, 0x15,
-    0x6a, 0x15, 0x59, 0x40, 0xfe, 0x44, 0x24, 0xa0,
-    0x24, 0x02, 0x15, 0x05, 0x29, 0x1d, 0x14, 0x1d,
-    0x1e, 0x05, 0x05, 0x29, 0x1d, 0x14, 0x1d, 0x1e,
-    0x01, 0x09, 0xbe, 0x41, 0xc8, 0xc8, 0xc8, 0xc8,
-    0x41, 0xbe, 0x41, 0xc8, 0xc8, 0xc8, 0xc8, 0x41,
-    0x01, 0x4f, 0x78, 0x78, 0xfe, 0x7f, 0x32, 0xbe,
-    0xbe, 0xd3, 0x1b, 0x22, 0x22, 0x1b, 0x1b, 0x20,
-    0x1f, 0x00, 0x00, 0x00, 0xff, 0xff, 0xfd, 0xcb,
-    0x00, 0x00, 0x02, 0x08, 0x02, 0xd0, 0x10, 0x23,
-    0x00, 0x51, 0xfd, 0xa8, 0x00, 0x00, 0x11, 0x02,
-    0x00, 0x4c, 0x00, 0x1e, 0x00, 0x9e, 0x4b, 0xb0,
-    0x11, 0x50, 0x58, 0x40, 0x2c, 0x12, 0x0a, 0x08,
-    0x03, 0x06, 0x16, 0x13, 0x0e, 0x0b, 0x04, 0x05,
-    0x04, 0x06, 0x05, 0x68, 0x10, 0x15, 0x0f, 0x0c,
-    0x04, 0x04, 0x11, 0x14, 0x0d, 0x03, 0x04, 0x01,
-    0x00, 0x04, 0x01, 0x67, 0x09, 0x01, 0x07, 0x07,
-    0x3a, 0x4d, 0x02, 0x01, 0x00, 0x00, 0x3b, 0x00,
-    0x4e, 0x1b, 0x40, 0x36, 0x0e, 0x0b, 0x02, 0x05,
-    0x13, 0x06, 0x05, 0x58, 0x12, 0x0a, 0x08, 0x03,
-    0x06, 0x16, 0x01, 0x13, 0x10, 0x06, 0x13, 0x68,
-    0x00, 0x10, 0x04, 0x01, 0x10, 0x57, 0x15, 0x0f,
-    0x0c, 0x03, 0x04, 0x11, 0x14, 0x0d, 0x03, 0x04,
-    0x01, 0x00, 0x04, 0x01, 0x67, 0x09, 0x01, 0x07,
-    0x07, 0x3a, 0x4d, 0x02, 0x01, 0x00, 0x00, 0x3b,
-    0x00, 0x4e, 0x59, 0x40, 0x2e, 0x25, 0x25, 0x1d,
-    0x1d, 0x01, 0x01, 0x25, 0x28, 0x25, 0x28, 0x27,
-    0x26, 0x24, 0x23, 0x22, 0x21, 0x1d, 0x20, 0x1d,
-    0x20, 0x1f, 0x1e, 0x01, 0x1c, 0x01, 0x1c, 0x1b,
-    0x1a, 0x19, 0x18, 0x17, 0x16, 0x15, 0x14, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12,
-    0x17, 0x09, 0x2a, 0x2b, 0x00, 0x03, 0x00, 0x19,
-    0x00, 0x00, 0x02, 0x3f, 0x02, 0xda, 0x00, 0x1f,
-    0x00, 0x2d, 0x00, 0x3b, 0x00, 0x43, 0x40, 0x40,
-    0x0a, 0x01, 0x06, 0x00, 0x09, 0x04, 0x06, 0x09,
-    0x69, 0x02, 0x01, 0x00, 0x00, 0x04, 0x08, 0x00,
-    0x04, 0x67, 0x00, 0x08, 0x00, 0x07, 0x01, 0x08,
-    0x07, 0x69, 0x00, 0x01, 0x03, 0x03, 0x01, 0x57,
-    0x00, 0x01, 0x01, 0x03, 0x5f, 0x05, 0x01, 0x03,
-    0x01, 0x03, 0x4f, 0x21, 0x20, 0x39, 0x37, 0x32,
-    0x30, 0x28, 0x26, 0x20, 0x2d, 0x21, 0x2d, 0x16,
-    0x16, 0x11, 0x16, 0x16, 0x10, 0x0b, 0x06, 0x1c,
-    0x2b, 0x13, 0x33, 0x13, 0x1e, 0x01, 0x17, 0x16,
-    0x17, 0x33, 0x30, 0x2e, 0x02, 0x35, 0x11, 0x33,
-    0x11, 0x23, 0x03, 0x2e, 0x01, 0x27, 0x26, 0x27,
-    0x23, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x11, 0x23,
-    0x01, 0x32, 0x16, 0x1d, 0x01, 0x14, 0x06, 0x23,
-    0x22, 0x26, 0x3d, 0x01, 0x34, 0x36, 0x13, 0x14,
-    0x16, 0x33, 0x32, 0x36, 0x3d, 0x01, 0x34, 0x26,
-    0x23, 0x22, 0x06, 0x15, 0x19, 0x5f, 0x76, 0x05,
-    0x0d, 0x05, 0x06, 0x07, 0x0c, 0x05, 0x06, 0x05,
-    0x46, 0x5f, 0x73, 0x06, 0x0d, 0x05, 0x07, 0x06,
-    0x0c, 0x04, 0x03, 0x03, 0x04, 0x46, 0x01, 0xc7,
-    0x29, 0x36, 0x36, 0x29, 0x29, 0x36, 0x36, 0x06,
-    0x15, 0x0e, 0x0e, 0x15, 0x15, 0x0e, 0x0e, 0x15,
-    0x02, 0xd0, 0xfe, 0x45, 0x12, 0x3f, 0x1e, 0x24,
-    0x28, 0x2b, 0x3e, 0x45, 0x1a, 0x01, 0xae, 0xfd,
-    0x30, 0x01, 0xbc, 0x17, 0x40, 0x1d, 0x23, 0x24,
-    0x24, 0x24, 0x1f, 0x45, 0x1d, 0xfe, 0x52, 0x02,
-    0xda, 0x39, 0x30, 0xdc, 0x30, 0x39, 0x39, 0x30,
-    0xdc, 0x30, 0x39, 0xfe, 0xb1, 0x17, 0x11, 0x11,
-    0x17, 0xf0, 0x12, 0x16, 0x16, 0x12, 0x00, 0x00,
-    0x00, 0x03, 0xfd, 0xfd, 0xff, 0xf6, 0x02, 0x08,
-    0x02, 0xda, 0x00, 0x29, 0x00, 0x34, 0x00, 0x38,
-    0x00, 0x8e, 0x40, 0x10, 0x31, 0x01, 0x08, 0x04,
-    0x19, 0x01, 0x09, 0x08, 0x30, 0x21, 0x1e, 0x03,
-    0x07, 0x09, 0x03, 0x4c, 0x4b, 0xb0, 0x18, 0x50,
-    0x58, 0x40, 0x2e, 0x00, 0x01, 0x02, 0x03, 0x02,
-    0x01, 0x03, 0x80, 0x00, 0x03, 0x00, 0x04, 0x08,
-    0x03, 0x04, 0x67, 0x00, 0x08, 0x00, 0x09, 0x07,
-    0x08, 0x09, 0x67, 0x00, 0x02, 0x02, 0x00, 0x61,
-    0x00, 0x00, 0x00, 0x42, 0x4d, 0x00, 0x07, 0x07,
-    0x05, 0x61, 0x06, 0x01, 0x05, 0x05, 0x3b, 0x05,
-    0x4e, 0x1b, 0x40, 0x32, 0x00, 0x01, 0x02, 0x03,
-    0x02, 0x01, 0x03, 0x80, 0x00, 0x03, 0x00, 0x04,
-    0x08, 0x03, 0x04, 0x67, 0x00, 0x08, 0x00, 0x09,
-    0x07, 0x08, 0x09, 0x67, 0x00, 0x02, 0x02, 0x00,
-    0x61, 0x00, 0x00, 0x00, 0x42, 0x4d, 0x00, 0x05,
-    0x05, 0x3b, 0x4d, 0x00, 0x07, 0x07, 0x06, 0x61,
-    0x00, 0x06, 0x06, 0x43, 0x06, 0x4e, 0x59, 0x40,
-    0x0e, 0x38, 0x37, 0x17, 0x28, 0x22, 0x12, 0x11,
-    0x17, 0x22, 0x14, 0x28, 0x0a, 0x09, 0x1f, 0x2b,
-    0x01, 0x27, 0x2e, 0x01, 0x35, 0x34, 0x3e, 0x02,
-    0x33, 0x32, 0x1e, 0x02, 0x15, 0x23, 0x34, 0x26,
-    0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x1f, 0x01,
-    0x13, 0x21, 0x15, 0x21, 0x07, 0x17, 0x23, 0x27,
-    0x06, 0x23, 0x22, 0x26, 0x3d, 0x01, 0x34, 0x36,
-    0x17, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x27,
-    0x0e, 0x01, 0x15, 0x05, 0x21, 0x15, 0x21, 0xfe,
-    0x6b, 0x0b, 0x1c, 0x1a, 0x1a, 0x2f, 0x42, 0x29,
-    0x2a, 0x46, 0x32, 0x1b, 0x5a, 0x36, 0x2d, 0x29,
-    0x31, 0x10, 0x12, 0xb2, 0xa3, 0x02, 0x0d, 0xfe,
-    0x1d, 0x9b, 0x72, 0x63, 0x3f, 0x4d, 0x61, 0x52,
-    0x5d, 0x39, 0x21, 0x2f, 0x2b, 0x20, 0x3f, 0x19,
-    0x99, 0x1b, 0x1e, 0x01, 0xd6, 0x01, 0xdb, 0xfe,
-    0x25, 0x01, 0xa1, 0x0f, 0x26, 0x43, 0x1c, 0x24,
-    0x3d, 0x2c, 0x18, 0x19, 0x2b, 0x3d, 0x24, 0x25,
-    0x32, 0x32, 0x25, 0x14, 0x2c, 0x19, 0xf8, 0x01,
-    0x06, 0x50, 0xfb, 0x9f, 0x57, 0x61, 0x57, 0x4e,
-    0x7d, 0x36, 0x46, 0xf9, 0x29, 0x2c, 0x2d, 0x27,
-    0xd4, 0x08, 0x2b, 0x23, 0x1e, 0x50, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xb2, 0x02,
-    0x64, 0x02, 0x45, 0x60, 0x44, 0x31, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x9f, 0x4d, 0xaa, 0xba, 0x5f, 0x0f, 0x3c, 0xf5,
-    0x00, 0x0f, 0x03, 0xe8, 0x00, 0x00, 0x00, 0x00,
-    0xda, 0x3d, 0xf5, 0x8b, 0x00, 0x00, 0x00, 0x00,
-    0xda, 0x3e, 0x21, 0x21, 0xf9, 0x34, 0xff, 0x10,
-    0x02, 0x8e, 0x03, 0xd9, 0x00, 0x00, 0x00, 0x06,
-    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x03, 0x84, 0xff, 0x0b,
-    0x00, 0x00, 0x04, 0xb0, 0xf9, 0x34, 0xff, 0xca,
-    0x04, 0x7e, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x78, 0x02, 0x58, 0x00, 0x5a,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00,
-    0x02, 0x58, 0x00, 0x00, 0x02, 0x58, 0x00, 0x5a,
-    0x02, 0x58, 0x00, 0x58, 0x02, 0x58, 0x00, 0x58,
-    0x02, 0x58, 0x00, 0xb9, 0x02, 0x58, 0x00, 0x50,
-    0x02, 0x58, 0x00, 0x5f, 0x02, 0x58, 0x00, 0x28,
-    0x02, 0x58, 0x00, 0x50, 0x02, 0x58, 0x00, 0x58,
-    0x02, 0x58, 0x00, 0x5d, 0x02, 0x58, 0x00, 0x49,
-    0x02, 0x58, 0x00, 0x55, 0x02, 0x58, 0x00, 0x55,
-    0x02, 0x58, 0x00, 0x2c, 0x02, 0x58, 0x00, 0x5a,
-    0x02, 0x58, 0x00, 0x56, 0x02, 0x58, 0x00, 0x58,
-    0x02, 0x58, 0x00, 0x5f, 0x02, 0x58, 0x00, 0x5f,
-    0x02, 0x58, 0x00, 0x50, 0x02, 0x58, 0x00, 0x5f,
-    0x02, 0x58, 0x00, 0x2d, 0x02, 0x58, 0x00, 0x5a,
-    0x02, 0x58, 0x00, 0x69, 0x02, 0x58, 0x00, 0x4b,
-    0x02, 0x58, 0x00, 0x55, 0x02, 0x58, 0x00, 0x5a,
-    0x02, 0x58, 0x00, 0x50, 0x02, 0x58, 0x00, 0x5a,
-    0x02, 0x58, 0x00, 0x46, 0x02, 0x58, 0x00, 0x2d,
-    0x02, 0x58, 0x00, 0x55, 0x02, 0x58, 0x00, 0x2c,
-    0x02, 0x58, 0x00, 0x19, 0x02, 0x58, 0x00, 0x28,
-    0x02, 0x58, 0x00, 0x1e, 0x02, 0x58, 0x00, 0x55,
-    0x02, 0x58, 0x00, 0xd6, 0x02, 0x58, 0x00, 0x3f,
-    0x02, 0x58, 0x00, 0x58, 0x02, 0x58, 0x00, 0x58,
-    0x02, 0x58, 0x00, 0x50, 0x02, 0x58, 0x00, 0x3c,
-    0x02, 0x58, 0x00, 0x55, 0x02, 0x58, 0x00, 0x3e,
-    0x02, 0x58, 0x00, 0x70, 0x02, 0x58, 0x00, 0x4d,
-    0x02, 0x58, 0x00, 0x3c, 0x02, 0x58, 0x00, 0x32,
-    0x02, 0x58, 0x00, 0x1e, 0x02, 0x58, 0x00, 0x30,
-    0x02, 0x58, 0x00, 0x32, 0x02, 0x58, 0x00, 0x50,
-    0x02, 0x58, 0x00, 0xa5, 0x02, 0x58, 0x00, 0x50,
-    0x02, 0x58, 0x00, 0x5a, 0x02, 0x58, 0x00, 0x41,
-    0x02, 0x58, 0x00, 0x44, 0x02, 0x58, 0x00, 0x55,
-    0x02, 0x58, 0x00, 0x4b, 0x02, 0x58, 0x00, 0x46,
-    0x02, 0x58, 0x00, 0x4b, 0x02, 0x58, 0x00, 0x46,
-    0x02, 0x58, 0x00, 0x46, 0x02, 0x58, 0x00, 0x64,
-    0x02, 0x58, 0x00, 0x41, 0x02, 0x58, 0x00, 0x22,
-    0x02, 0x58, 0x00, 0x4b, 0x02, 0x58, 0x00, 0x4b,
-    0x02, 0x58, 0x00, 0xda, 0x02, 0x58, 0x00, 0xa5,
-    0x02, 0x58, 0x00, 0x55, 0x02, 0x58, 0x00, 0x50,
-    0x02, 0x58, 0x00, 0xe1, 0x02, 0x58, 0x00, 0x87,
-    0x02, 0x58, 0x00, 0xf6, 0x02, 0x58, 0x00, 0x96,
-    0x02, 0x58, 0x00, 0x23, 0x02, 0x58, 0x00, 0x1e,
-    0x02, 0x58, 0x00, 0x55, 0x02, 0x58, 0x00, 0xff,
-    0x02, 0x58, 0x00, 0xd2, 0x02, 0x58, 0x00, 0x3c,
-    0x02, 0x58, 0x00, 0x73, 0x02, 0x58, 0x00, 0x50,
-    0x02, 0x58, 0x00, 0x58, 0x02, 0x58, 0x00, 0x5a,
-    0x02, 0x58, 0x00, 0x0f, 0x02, 0x58, 0x00, 0x50,
-    0x02, 0x58, 0x00, 0x64, 0x02, 0x58, 0x00, 0x66,
-    0x02, 0x58, 0x00, 0x41, 0x02, 0x58, 0x00, 0x64,
-    0x02, 0x58, 0x00, 0x2d, 0x02, 0x58, 0x00, 0x37,
-    0x02, 0x58, 0x00, 0x96, 0x02, 0x58, 0x00, 0x46,
-    0x02, 0x58, 0x00, 0x00, 0x02, 0x58, 0x00, 0x46,
-    0x02, 0x58, 0x00, 0xd6, 0x02, 0x58, 0xfb, 0xb4,
-    0x02, 0x58, 0xfe, 0x3e, 0x02, 0x58, 0xfb, 0x9b,
-    0x02, 0x58, 0xfd, 0xf3, 0x02, 0x58, 0xfd, 0xfd,
-    0x02, 0x58, 0xf9, 0x34, 0x02, 0x58, 0xfe, 0x52,
-    0x02, 0x58, 0xfb, 0xb4, 0x02, 0x58, 0xfb, 0x8c,
-    0x02, 0x58, 0xfe, 0x0c, 0x02, 0x58, 0xfd, 0xe4,
-    0x02, 0x58, 0xfb, 0x8c, 0x02, 0x58, 0xfd, 0xf8,
-    0x02, 0x58, 0xfd, 0xf8, 0x02, 0x58, 0xfe, 0xcf,
-    0x02, 0x58, 0xfe, 0xcf, 0x02, 0x58, 0xfb, 0xa0,
-    0x02, 0x58, 0xfb, 0xa0, 0x02, 0x58, 0x00, 0x5a,
-    0x02, 0x58, 0xfe, 0x11, 0x02, 0x58, 0xfe, 0xe3,
-    0x02, 0x58, 0xfc, 0x8b, 0x02, 0x58, 0xfe, 0xcf,
-    0x02, 0x58, 0x00, 0x19, 0x02, 0x58, 0x00, 0xaf,
-    0x02, 0x58, 0x00, 0xff, 0x02, 0x58, 0x00, 0x1e,
-    0x02, 0x58, 0x00, 0x1e, 0x02, 0x58, 0x00, 0x93,
-    0x02, 0x58, 0x00, 0x92, 0x02, 0x58, 0x00, 0xe4,
-    0x02, 0x58, 0x00, 0xa3, 0x02, 0x58, 0x00, 0x5a,
-    0x02, 0x58, 0x00, 0x19, 0x02, 0x58, 0x00, 0xa5,
-    0x02, 0x58, 0x00, 0x19, 0x02, 0x58, 0x00, 0x69,
-    0x02, 0x58, 0x00, 0xaa, 0x02, 0x58, 0x00, 0x41,
-    0x02, 0x58, 0x00, 0x82, 0x02, 0x58, 0x00, 0xd7,
-    0x02, 0x58, 0x00, 0xb4, 0x02, 0x58, 0x00, 0xaa,
-    0x02, 0x58, 0x00, 0xe6, 0x02, 0x58, 0x00, 0x78,
-    0x02, 0x58, 0x00, 0x3f, 0x02, 0x58, 0x00, 0x58,
-    0x02, 0x58, 0x00, 0x55, 0x02, 0x58, 0x00, 0x5a,
-    0x02, 0x58, 0x00, 0x8c, 0x02, 0x58, 0x00, 0x3f,
-    0x02, 0x58, 0x00, 0x87, 0x02, 0x58, 0x00, 0x87,
-    0x02, 0x58, 0x00, 0x58, 0x02, 0x58, 0x00, 0xcd,
-    0x02, 0x58, 0x00, 0xb9, 0x02, 0x58, 0x00, 0x55,
-    0x02, 0x58, 0x00, 0x5a, 0x02, 0x58, 0x00, 0x58,
-    0x02, 0x58, 0x00, 0x2c, 0x02, 0x58, 0x00, 0x2c,
-    0x02, 0x58, 0x00, 0x2c, 0x02, 0x58, 0x00, 0x2c,
-    0x02, 0x58, 0x00, 0x2c, 0x02, 0x58, 0x00, 0x2c,
-    0x02, 0x58, 0x00, 0x56, 0x02, 0x58, 0x00, 0x5f,
-    0x02, 0x58, 0x00, 0x5f, 0x02, 0x58, 0x00, 0x5f,
-    0x02, 0x58, 0x00, 0x5f, 0x02, 0x58, 0x00, 0x5f,
-    0x02, 0x58, 0x00, 0x5f, 0x02, 0x58, 0x00, 0x5f,
-    0x02, 0x58, 0x00, 0x5f, 0x02, 0x58, 0x00, 0x50,
-    0x02, 0x58, 0x00, 0x50, 0x02, 0x58, 0x00, 0x50,
-    0x02, 0x58, 0x00, 0x50, 0x02, 0x58, 0x00, 0x50,
-    0x02, 0x58, 0x00, 0x46, 0x02, 0x58, 0x00, 0x55,
-    0x02, 0x58, 0x00, 0x55, 0x02, 0x58, 0x00, 0x55,
-    0x02, 0x58, 0x00, 0x55, 0x02, 0x58, 0x00, 0x1e,
-    0x02, 0x58, 0x00, 0x1e, 0x02, 0x58, 0x00, 0x55,
-    0x02, 0x58, 0x00, 0x3f, 0x02, 0x58, 0x00, 0x3f,
-    0x02, 0x58, 0x00, 0x3f, 0x02, 0x58, 0x00, 0x3f,
-    0x02, 0x58, 0x00, 0x50, 0x02, 0x58, 0x00, 0x50,
-    0x02, 0x58, 0x00, 0x50, 0x02, 0x58, 0x00, 0x50,
-    0x02, 0x58, 0x00, 0x5a, 0x02, 0x58, 0x00, 0x5a,
-    0x02, 0x58, 0x00, 0x5a, 0x02, 0x58, 0x00, 0x5a,
-    0x02, 0x58, 0x00, 0x50, 0x02, 0x58, 0x00, 0x50,
-    0x02, 0x58, 0x00, 0x50, 0x02, 0x58, 0x00, 0x50,
-    0x02, 0x58, 0x00, 0x50, 0x02, 0x58, 0x00, 0x4d,
-    0x02, 0x58, 0x00, 0x5a, 0x02, 0x58, 0x00, 0x5a,
-    0x02, 0x58, 0x00, 0x5a, 0x02, 0x58, 0x00, 0x5a,
-    0x02, 0x58, 0x00, 0x32, 0x02, 0x58, 0x00, 0x32,
-    0x02, 0x58, 0x00, 0x50, 0x02, 0x58, 0x00, 0x55,
-    0x02, 0x58, 0x00, 0x23, 0x02, 0x58, 0x00, 0x23,
-    0x02, 0x58, 0x00, 0x53, 0x02, 0x58, 0x00, 0x23,
-    0x02, 0x58, 0x00, 0x23, 0x02, 0x58, 0x00, 0x28,
-    0x02, 0x58, 0x00, 0x14, 0x02, 0x58, 0x00, 0x2c,
-    0x02, 0x58, 0x00, 0x3f, 0x02, 0x58, 0x00, 0x2c,
-    0x02, 0x58, 0x00, 0x3f, 0x02, 0x58, 0x00, 0x2c,
-    0x02, 0x58, 0x00, 0x3f, 0x02, 0x58, 0x00, 0x56,
-    0x02, 0x58, 0x00, 0x58, 0x02, 0x58, 0x00, 0x56,
-    0x02, 0x58, 0x00, 0x58, 0x02, 0x58, 0x00, 0x56,
-    0x02, 0x58, 0x00, 0x58, 0x02, 0x58, 0x00, 0x56,
-    0x02, 0x58, 0x00, 0x58, 0x02, 0x58, 0x00, 0x3c,
-    0x02, 0x58, 0x00, 0x5f, 0x02, 0x58, 0x00, 0x50,
-    0x02, 0x58, 0x00, 0x5f, 0x02, 0x58, 0x00, 0x50,
-    0x02, 0x58, 0x00, 0x5f, 0x02, 0x58, 0x00, 0x50,
-    0x02, 0x58, 0x00, 0x5f, 0x02, 0x58, 0x00, 0x50,
-    0x02, 0x58, 0x00, 0x5f, 0x02, 0x58, 0x00, 0x50,
-    0x02, 0x58, 0x00, 0x50, 0x02, 0x58, 0x00, 0x49,
-    0x02, 0x58, 0x00, 0x50, 0x02, 0x58, 0x00, 0x49,
-    0x02, 0x58, 0x00, 0x50, 0x02, 0x58, 0x00, 0x49,
-    0x02, 0x58, 0x00, 0x5a, 0x02, 0x58, 0xff, 0xf1,
-    0x02, 0x58, 0x00, 0x5f, 0x02, 0x58, 0x00, 0x5a,
-    0x02, 0x58, 0x00, 0x5f, 0x02, 0x58, 0x00, 0x5a,
-    0x02, 0x58, 0x00, 0x5f, 0x02, 0x58, 0x00, 0x5f,
-    0x02, 0x58, 0x00, 0x5f, 0x02, 0x58, 0x00, 0x55,
-    0x02, 0x58, 0x00, 0x58, 0x02, 0x58, 0x00, 0x55,
-    0x02, 0x58, 0x00, 0x58, 0x02, 0x58, 0x00, 0x50,
-    0x02, 0x58, 0x00, 0x50, 0x02, 0x58, 0x00, 0x50,
-    0x02, 0x58, 0x00, 0x50, 0x02, 0x58, 0x00, 0x50,
-    0x02, 0x58, 0x00, 0x50, 0x02, 0x58, 0x00, 0x5a,
-    0x02, 0x58, 0x00, 0x70, 0x02, 0x58, 0x00, 0x5a,
-    0x02, 0x58, 0x00, 0x70, 0x02, 0x58, 0x00, 0x46,
-    0x02, 0x58, 0x00, 0x4d, 0x02, 0x58, 0x00, 0x46,
-    0x02, 0x58, 0x00, 0x4d, 0x02, 0x58, 0x00, 0x46,
-    0x02, 0x58, 0x00, 0x4d, 0x02, 0x58, 0x00, 0x2d,
-    0x02, 0x58, 0x00, 0x55, 0x02, 0x58, 0x00, 0x5a,
-    0x02, 0x58, 0x00, 0x55, 0x02, 0x58, 0x00, 0x5a,
-    0x02, 0x58, 0x00, 0x55, 0x02, 0x58, 0x00, 0x5a,
-    0x02, 0x58, 0x00, 0x55, 0x02, 0x58, 0x00, 0x5a,
-    0x02, 0x58, 0x00, 0x19, 0x02, 0x58, 0x00, 0x1e,
-    0x02, 0x58, 0x00, 0x1e, 0x02, 0x58, 0x00, 0x32,
-    0x02, 0x58, 0x00, 0x55, 0x02, 0x58, 0x00, 0x50,
-    0x02, 0x58, 0x00, 0x55, 0x02, 0x58, 0x00, 0x50,
-    0x02, 0x58, 0x00, 0x19, 0x02, 0x58, 0x00, 0x1e,
-    0x02, 0x58, 0x00, 0x19, 0x02, 0x58, 0x00, 0x1e,
-    0x02, 0x58, 0x00, 0x19, 0x02, 0x58, 0x00, 0x1e,
-    0x02, 0x58, 0x00, 0xaa, 0x02, 0x58, 0x00, 0x8c,
-    0x02, 0x58, 0x00, 0xaa, 0x02, 0x58, 0x00, 0xbe,
-    0x02, 0x58, 0x00, 0x87, 0x02, 0x58, 0x00, 0x87,
-    0x02, 0x58, 0x00, 0x8c, 0x02, 0x58, 0x00, 0xd7,
-    0x02, 0x58, 0x00, 0xb4, 0x02, 0x58, 0x00, 0x69,
-    0x02, 0x58, 0x00, 0x78, 0x02, 0x58, 0x00, 0x87,
-    0x02, 0x58, 0x00, 0xd7, 0x02, 0x58, 0x00, 0xd7,
-    0x02, 0x58, 0x00, 0x69, 0x02, 0x58, 0x00, 0x14,
-    0x02, 0x58, 0x00, 0x96, 0x02, 0x58, 0x00, 0x3c,
-    0x02, 0x58, 0x00, 0x69, 0x02, 0x58, 0x00, 0x4d,
-    0x02, 0x58, 0x00, 0x58, 0x02, 0x58, 0x00, 0x2d,
-    0x02, 0x58, 0x00, 0x55, 0x02, 0x58, 0x00, 0x5a,
-    0x02, 0x58, 0x00, 0x5d, 0x02, 0x58, 0x00, 0x50,
-    0x02, 0x58, 0x00, 0x28, 0x02, 0x58, 0x00, 0x28,
-    0x02, 0x58, 0x00, 0x70, 0x02, 0x58, 0x00, 0x5a,
-    0x02, 0x58, 0x00, 0x69, 0x02, 0x58, 0x00, 0x28,
-    0x02, 0x58, 0x00, 0x2d, 0x02, 0x58, 0x00, 0x3c,
-    0x02, 0x58, 0x00, 0x14, 0x02, 0x58, 0x00, 0x64,
-    0x02, 0x58, 0x00, 0x2d, 0x02, 0x58, 0x00, 0x2d,
-    0x02, 0x58, 0x00, 0xe1, 0x02, 0x58, 0x00, 0x6e,
-    0x02, 0x58, 0xff, 0xf1, 0x02, 0x58, 0x00, 0x46,
-    0x02, 0x58, 0x00, 0x5a, 0x02, 0x58, 0x00, 0x55,
-    0x02, 0x58, 0x00, 0x2d, 0x02, 0x58, 0x00, 0x3c,
-    0x02, 0x58, 0x00, 0x50, 0x02, 0x58, 0x00, 0x49,
-    0x02, 0x58, 0x00, 0x2d, 0x02, 0x58, 0x00, 0x2d,
-    0x02, 0x58, 0x00, 0x55, 0x02, 0x58, 0x00, 0x3c,
-    0x02, 0x58, 0x00, 0x3c, 0x02, 0x58, 0x00, 0x41,
-    0x02, 0x58, 0x00, 0x5a, 0x02, 0x58, 0x00, 0x28,
-    0x02, 0x58, 0x00, 0x23, 0x02, 0x58, 0x00, 0x1e,
-    0x02, 0x58, 0x00, 0x23, 0x02, 0x58, 0x00, 0x37,
-    0x02, 0x58, 0x00, 0x46, 0x02, 0x58, 0x00, 0x46,
-    0x02, 0x58, 0x00, 0x0f, 0x02, 0x58, 0x00, 0x00,
-    0x02, 0x58, 0x00, 0x4d, 0x02, 0x58, 0x00, 0x2a,
-    0x02, 0x58, 0x00, 0x58, 0x02, 0x58, 0x00, 0x4b,
-    0x02, 0x58, 0x00, 0x1e, 0x02, 0x58, 0x00, 0xaf,
-    0x02, 0x58, 0x00, 0xb9, 0x02, 0x58, 0x00, 0xb4,
-    0x02, 0x58, 0x00, 0x9b, 0x02, 0x58, 0x00, 0x9b,
-    0x02, 0x58, 0x00, 0xaa, 0x02, 0x58, 0x00, 0xaf,
-    0x02, 0x58, 0x00, 0xaa, 0x02, 0x58, 0x00, 0xb4,
-    0x02, 0x58, 0x00, 0x9b, 0x02, 0x58, 0x00, 0x9b,
-    0x02, 0x58, 0x00, 0xaf, 0x02, 0x58, 0x00, 0x5c,
-    0x02, 0x58, 0x00, 0x1e, 0x02, 0x58, 0x00, 0x1e,
-    0x02, 0x58, 0x00, 0x05, 0x02, 0x58, 0x00, 0x1e,
-    0x02, 0x58, 0x00, 0x64, 0x02, 0x58, 0x00, 0x50,
-    0x02, 0x58, 0x00, 0x5d, 0x02, 0x58, 0x00, 0x5a,
-    0x02, 0x58, 0x00, 0x5f, 0x02, 0x58, 0x00, 0xa5,
-    0x02, 0x58, 0x00, 0x58, 0x02, 0x58, 0x00, 0x55,
-    0x02, 0x58, 0xfc, 0xc7, 0x02, 0x58, 0xfc, 0x13,
-    0x02, 0x58, 0xfb, 0xd7, 0x02, 0x58, 0xfb, 0xa0,
-    0x02, 0x58, 0xfe, 0x20, 0x02, 0x58, 0xfe, 0x0c,
-    0x02, 0x58, 0xfd, 0xf8, 0x02, 0x58, 0x00, 0x5a,
-    0x02, 0x58, 0x00, 0x50, 0x02, 0x58, 0x00, 0x2c,
-    0x02, 0x58, 0x00, 0x5a, 0x02, 0x58, 0x00, 0x5a,
-    0x02, 0x58, 0x00, 0x56, 0x02, 0x58, 0x00, 0x5f,
-    0x02, 0x58, 0x00, 0x5a, 0x02, 0x58, 0x00, 0x4b,
-    0x02, 0x58, 0x00, 0x28, 0x02, 0x58, 0x00, 0x3f,
-    0x02, 0x58, 0x00, 0x50, 0x02, 0x58, 0x00, 0x50,
-    0x02, 0x58, 0x00, 0x56, 0x02, 0x58, 0x00, 0x32,
-    0x02, 0x58, 0x00, 0x30, 0x02, 0x58, 0x00, 0x58,
-    0x02, 0x58, 0x00, 0x5a, 0x02, 0x58, 0x00, 0x5a,
-    0x02, 0x58, 0x00, 0x55, 0x02, 0x58, 0x00, 0x2d,
-    0x02, 0x58, 0x00, 0x69, 0x02, 0x58, 0x00, 0x05,
-    0x02, 0x58, 0x00, 0x5a, 0x02, 0x58, 0x00, 0x35,
-    0x02, 0x58, 0x00, 0x3e, 0x02, 0x58, 0x00, 0x35,
-    0x02, 0x58, 0x00, 0x55, 0x02, 0x58, 0x00, 0x46,
-    0x02, 0x58, 0x00, 0x4d, 0x02, 0x58, 0x00, 0x5f,
-    0x02, 0x58, 0x00, 0x14, 0x02, 0x58, 0x00, 0x5a,
-    0x02, 0x58, 0x00, 0x3e, 0x02, 0x58, 0x00, 0x0a,
-    0x02, 0x58, 0x00, 0x35, 0x02, 0x58, 0x00, 0x4a,
-    0x02, 0x58, 0x00, 0x14, 0x02, 0x58, 0x00, 0x19,
-    0x02, 0x58, 0x00, 0x28, 0x02, 0x58, 0x00, 0x32,
-    0x02, 0x58, 0x00, 0x4b, 0x02, 0x58, 0x00, 0x5a,
-    0x02, 0x58, 0x00, 0x50, 0x02, 0x58, 0x00, 0x5a,
-    0x02, 0x58, 0x00, 0x37, 0x02, 0x58, 0x00, 0x5a,
-    0x02, 0x58, 0x00, 0x14, 0x02, 0x58, 0x00, 0x19,
-    0x02, 0x58, 0x00, 0x69, 0x02, 0x58, 0x00, 0x5d,
-    0x02, 0x58, 0x00, 0x46, 0x02, 0x58, 0x00, 0x32,
-    0x02, 0x58, 0x00, 0x5a, 0x02, 0x58, 0x00, 0x2d,
-    0x02, 0x58, 0x00, 0x05, 0x02, 0x58, 0x00, 0x5a,
-    0x02, 0x58, 0x00, 0x3e, 0x02, 0x58, 0x00, 0x3c,
-    0x02, 0x58, 0x00, 0x5a, 0x02, 0x58, 0x00, 0x00,
-    0x02, 0x58, 0x00, 0x48, 0x02, 0x58, 0x00, 0x5a,
-    0x02, 0x58, 0x00, 0x3e, 0x02, 0x58, 0x00, 0x4b,
-    0x02, 0x58, 0x00, 0x3e, 0x02, 0x58, 0x00, 0x3c,
-    0x02, 0x58, 0x00, 0x50, 0x02, 0x58, 0x00, 0x50,
-    0x02, 0x58, 0x00, 0x5f, 0x02, 0x58, 0x00, 0x5f,
-    0x02, 0x58, 0x00, 0x5f, 0x02, 0x58, 0x00, 0x2d,
-    0x02, 0x58, 0x00, 0x5a, 0x02, 0x58, 0x00, 0x55,
-    0x02, 0x58, 0x00, 0x69, 0x02, 0x58, 0x00, 0x69,
-    0x02, 0x58, 0x00, 0x69, 0x02, 0x58, 0x00, 0x69,
-    0x02, 0x58, 0x00, 0x5a, 0x02, 0x58, 0x00, 0x5d,
-    0x02, 0x58, 0x00, 0x28, 0x02, 0x58, 0x00, 0x32,
-    0x02, 0x58, 0x00, 0x5a, 0x02, 0x58, 0x00, 0x5a,
-    0x02, 0x58, 0x00, 0x35, 0x02, 0x58, 0x00, 0x35,
-    0x02, 0x58, 0xff, 0xfb, 0x02, 0x58, 0xff, 0xfb,
-    0x02, 0x58, 0x00, 0x58, 0x02, 0x58, 0x00, 0x56,
-    0x02, 0x58, 0x00, 0x14, 0x02, 0x58, 0x00, 0x14,
-    0x02, 0x58, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00,
-    0x02, 0x58, 0x00, 0x4b, 0x02, 0x58, 0x00, 0x46,
-    0x02, 0x58, 0xfe, 0xbb, 0x02, 0x58, 0xfe, 0x98,
-    0x02, 0x58, 0xfc, 0xd6, 0x02, 0x58, 0xfc, 0x77,
-    0x02, 0x58, 0xfa, 0xc9, 0x02, 0x58, 0xfa, 0x7e,
-    0x02, 0x58, 0xfe, 0x1b, 0x02, 0x58, 0xfe, 0x1b,
-    0x02, 0x58, 0x00, 0x50, 0x02, 0x58, 0x00, 0x00,
-    0x02, 0x58, 0xfc, 0x45, 0x02, 0x58, 0xfe, 0xbb,
-    0x02, 0x58, 0xfe, 0xbb, 0x02, 0x58, 0xfe, 0x4d,
-    0x02, 0x58, 0xfe, 0xbb, 0x02, 0x58, 0xfe, 0x93,
-    0x02, 0x58, 0xfe, 0x61, 0x02, 0x58, 0xfc, 0x2a,
-    0x02, 0x58, 0xfe, 0xb4, 0x02, 0x58, 0x00, 0x50,
-    0x02, 0x58, 0xfe, 0x11, 0x02, 0x58, 0xf9, 0xfc,
-    0x02, 0x58, 0x00, 0x5a, 0x02, 0x58, 0x00, 0x5a,
-    0x02, 0x58, 0x00, 0x1e, 0x02, 0x58, 0x00, 0x32,
-    0x02, 0x58, 0x00, 0x3c, 0x02, 0x58, 0x00, 0x37,
-    0x02, 0x58, 0x00, 0x14, 0x02, 0x58, 0x00, 0x1e,
-    0x02, 0x58, 0x00, 0x23, 0x02, 0x58, 0x00, 0x50,
-    0x02, 0x58, 0x00, 0x41, 0x02, 0x58, 0x00, 0x3c,
-    0x02, 0x58, 0x00, 0x41, 0x02, 0x58, 0x00, 0x3c,
-    0x02, 0x58, 0xfe, 0xc5, 0x02, 0x58, 0xfe, 0x95,
-    0x02, 0x58, 0xfe, 0x95, 0x02, 0x58, 0xfe, 0xd2,
-    0x02, 0x58, 0xfb, 0xff, 0x02, 0x58, 0xfe, 0x61,
-    0x02, 0x58, 0xfb, 0x91, 0x02, 0x58, 0xfd, 0xe9,
-    0x02, 0x58, 0xfc, 0xca, 0x02, 0x58, 0xf9, 0x39,
-    0x02, 0x58, 0xfe, 0x7e, 0x02, 0x58, 0xfe, 0x57,
-    0x02, 0x58, 0xfb, 0xa0, 0x02, 0x58, 0xfb, 0xe6,
-    0x02, 0x58, 0xfe, 0x89, 0x02, 0x58, 0xfe, 0x82,
-    0x02, 0x58, 0xfe, 0x82, 0x02, 0x58, 0xfe, 0x89,
-    0x02, 0x58, 0xfe, 0x48, 0x02, 0x58, 0xfb, 0x9a,
-    0x02, 0x58, 0xfe, 0x9d, 0x02, 0x58, 0x00, 0x55,
-    0x02, 0x58, 0x00, 0x55, 0x02, 0x58, 0xfb, 0x9b,
-    0x02, 0x58, 0x00, 0x5c, 0x02, 0x58, 0x00, 0xd6,
-    0x02, 0x58, 0x00, 0xaa, 0x04, 0xb0, 0x00, 0x3c,
-    0x04, 0xb0, 0x00, 0x3c, 0x02, 0x58, 0xfe, 0x57,
-    0x02, 0x58, 0xfe, 0x57, 0x02, 0x58, 0xfd, 0xe4,
-    0x02, 0x58, 0xfb, 0x8c, 0x02, 0x58, 0xfb, 0x8c,
-    0x02, 0x58, 0xfb, 0xeb, 0x02, 0x58, 0xfb, 0xe6,
-    0x02, 0x58, 0xfb, 0x8c, 0x02, 0x58, 0xfb, 0x8c,
-    0x02, 0x58, 0xfb, 0x8c, 0x02, 0x58, 0xf9, 0x34,
-    0x02, 0x58, 0xfb, 0xb4, 0x02, 0x58, 0xfb, 0xb4,
-    0x02, 0x58, 0xfb, 0x8c, 0x02, 0x58, 0xfb, 0x8c,
-    0x02, 0x58, 0xfb, 0x8c, 0x02, 0x58, 0xfd, 0xe4,
-    0x02, 0x58, 0xfb, 0xa5, 0x02, 0x58, 0xfe, 0x0c,
-    0x02, 0x58, 0xfb, 0xe6, 0x02, 0x58, 0xfb, 0xb4,
-    0x02, 0x58, 0xfb, 0xb4, 0x02, 0x58, 0xfb, 0x8c,
-    0x02, 0x58, 0xfb, 0x8c, 0x02, 0x58, 0xfe, 0x6b,
-    0x02, 0x58, 0xfe, 0x6b, 0x02, 0x58, 0xfb, 0xaa,
-    0x02, 0x58, 0xfb, 0xaa, 0x02, 0x58, 0xfb, 0x8c,
-    0x02, 0x58, 0xfd, 0xe4, 0x02, 0x58, 0xfe, 0x57,
-    0x02, 0x58, 0xfb, 0x96, 0x02, 0x58, 0xfd, 0xee,
-    0x02, 0x58, 0xfb, 0xd7, 0x02, 0x58, 0xfe, 0x0c,
-    0x02, 0x58, 0xfe, 0x02, 0x02, 0x58, 0xfb, 0xb9,
-    0x02, 0x58, 0xfd, 0xdf, 0x02, 0x58, 0xfd, 0xc1,
-    0x02, 0x58, 0xfb, 0xb9, 0x02, 0x58, 0xfd, 0xfd,
-    0x02, 0x58, 0xfd, 0xc0, 0x02, 0x58, 0xfe, 0x25,
-    0x02, 0x58, 0xfb, 0xf5, 0x02, 0x58, 0xfe, 0x11,
-    0x02, 0x58, 0x00, 0x00, 0x02, 0x58, 0xfb, 0x8c,
-    0x02, 0x58, 0xfc, 0x6d, 0x02, 0x58, 0xfe, 0x8e,
-    0x02, 0x58, 0xfe, 0x11, 0x02, 0x58, 0xfe, 0x0c,
-    0x02, 0x58, 0xfd, 0xe9, 0x02, 0x58, 0xfe, 0x39,
-    0x02, 0x58, 0xfe, 0x5c, 0x02, 0x58, 0xfc, 0x22,
-    0x02, 0x58, 0xfe, 0xa7, 0x02, 0x58, 0xfc, 0xa4,
-    0x02, 0x58, 0xfe, 0xa7, 0x02, 0x58, 0xfc, 0xa4,
-    0x02, 0x58, 0xfd, 0xcb, 0x02, 0x6c, 0xfd, 0xcb,
-    0x02, 0x58, 0xfe, 0x3e, 0xfd, 0xcb, 0xfd, 0xcb,
-    0xfd, 0xcb, 0xfb, 0x73, 0xfd, 0xcb, 0xfd, 0xcb,
-    0xfd, 0xcb, 0x00, 0x19, 0xfd, 0xfd, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x32, 0x00, 0x32, 0x00, 0x32,
-    0x00, 0x32, 0x00, 0x5e, 0x00, 0xa8, 0x01, 0x1a,
-    0x01, 0x42, 0x01, 0x82, 0x01, 0xda, 0x02, 0x24,
-    0x02, 0x68, 0x02, 0xc6, 0x03, 0x20, 0x03, 0x90,
-    0x03, 0xb4, 0x04, 0x1a, 0x04, 0x56, 0x04, 0xac,
-    0x04, 0xfa, 0x05, 0x38, 0x05, 0x66, 0x05, 0x8c,
-    0x05, 0xdc, 0x06, 0x06, 0x06, 0x44, 0x06, 0x72,
-    0x06, 0x92, 0x06, 0xf0, 0x07, 0x32, 0x07, 0x72,
-    0x07, 0xc2, 0x08, 0x00, 0x08, 0x60, 0x08, 0x80,
-    0x08, 0xb0, 0x08, 0xe0, 0x09, 0x42, 0x09, 0x84,
-    0x09, 0xb8, 0x09, 0xea, 0x0a, 0x0a, 0x0a, 0x82,
-    0x0b, 0x14, 0x0b, 0x62, 0x0b, 0xb4, 0x0c, 0x0c,
-    0x0c, 0x68, 0x0c, 0xc6, 0x0d, 0x10, 0x0d, 0x6e,
-    0x0d, 0xa2, 0x0d, 0xd2, 0x0e, 0x32, 0x0e, 0x7e,
-    0x0e, 0xb4, 0x0e, 0xee, 0x0f, 0x0a, 0x0f, 0x64,
-    0x0f, 0x98, 0x0f, 0xee, 0x10, 0x52, 0x10, 0x7e,
-    0x10, 0xdc, 0x11, 0x3e, 0x11, 0x8a, 0x12, 0x06,
-    0x12, 0x68, 0x12, 0x82, 0x12, 0xbe, 0x13, 0x28,
-    0x13, 0x40, 0x13, 0x56, 0x13, 0x8c, 0x13, 0xc0,
-    0x13, 0xe6, 0x14, 0x0c, 0x14, 0x42, 0x14, 0xae,
-    0x14, 0xe2, 0x15, 0x24, 0x15, 0x7a, 0x15, 0xfe,
-    0x16, 0x6a, 0x16, 0x80, 0x16, 0xa6, 0x16, 0xc4,
-    0x16, 0xec, 0x17, 0x84, 0x17, 0xf0, 0x18, 0x18,
-    0x18, 0x32, 0x18, 0x66, 0x18, 0xc8, 0x18, 0xe4,
-    0x19, 0x1a, 0x19, 0x30, 0x19, 0xbe, 0x1a, 0x44,
-    0x1a, 0x6a, 0x1a, 0xd4, 0x1a, 0xd4, 0x1a, 0xee,
-    0x1b, 0x04, 0x1b, 0x38, 0x1b, 0x50, 0x1b, 0xae,
-    0x1b, 0xfa, 0x1c, 0x36, 0x1c, 0x9e, 0x1d, 0x04,
-    0x1d, 0x58, 0x1d, 0xa6, 0x1d, 0xda, 0x1e, 0x0e,
-    0x1e, 0x8a, 0x1e, 0xb4, 0x1e, 0xf0, 0x1f, 0x1e,
-    0x1f, 0x4e, 0x1f, 0xd8, 0x20, 0x44, 0x20, 0x68,
-    0x21, 0x3a, 0x21, 0x52, 0x21, 0x72, 0x21, 0x8c,
-    0x21, 0xf8, 0x22, 0x24, 0x22, 0x4c, 0x22, 0x9c,
-    0x22, 0xe8, 0x23, 0x18, 0x23, 0x48, 0x23, 0x60,
-    0x23, 0x76, 0x23, 0x98, 0x23, 0xb8, 0x23, 0xce,
-    0x23, 0xee, 0x24, 0x4e, 0x24, 0x6c, 0x24, 0xcc,
-    0x24, 0xfe, 0x25, 0x2c, 0x25, 0x68, 0x25, 0x82,
-    0x25, 0x9c, 0x25, 0xc2, 0x26, 0x16, 0x26, 0x88,
-    0x26, 0xb2, 0x26, 0xd4, 0x27, 0x0c, 0x27, 0x80,
-    0x27, 0xb0, 0x27, 0xde, 0x28, 0x10, 0x28, 0x48,
-    0x28, 0x7c, 0x28, 0xbe, 0x28, 0xfa, 0x29, 0x5a,
-    0x29, 0x80, 0x29, 0xa6, 0x29, 0xce, 0x2a, 0x20,
-    0x2a, 0x48, 0x2a, 0x74, 0x2a, 0xd4, 0x2b, 0x00,
-    0x2b, 0x2c, 0x2b, 0x5a, 0x2b, 0x88, 0x2b, 0xb2,
-    0x2b, 0xdc, 0x2c, 0x06, 0x2c, 0x32, 0x2c, 0x56,
-    0x2c, 0x7a, 0x2c, 0x9e, 0x2c, 0xee, 0x2d, 0x12,
-    0x2d, 0x46, 0x2d, 0x6c, 0x2d, 0x92, 0x2d, 0xba,
-    0x2d, 0xe2, 0x2e, 0x06, 0x2e, 0x28, 0x2e, 0x54,
-    0x2e, 0xa8, 0x2e, 0xfe, 0x2f, 0x90, 0x2f, 0xec,
-    0x30, 0x22, 0x30, 0x58, 0x30, 0x8e, 0x30, 0xe4,
-    0x31, 0x08, 0x31, 0x2c, 0x31, 0x50, 0x31, 0x8a,
-    0x31, 0xac, 0x31, 0xce, 0x31, 0xf2, 0x32, 0x42,
-    0x32, 0x7c, 0x32, 0xae, 0x32, 0xce, 0x32, 0xee,
-    0x33, 0x10, 0x33, 0x46, 0x33, 0x6a, 0x33, 0xa4,
-    0x33, 0xce, 0x34, 0x18, 0x34, 0x66, 0x34, 0x8e,
-    0x35, 0x1a, 0x35, 0x94, 0x35, 0xf8, 0x36, 0x50,
-    0x36, 0x7e, 0x36, 0xa4, 0x36, 0xf6, 0x37, 0x20,
-    0x37, 0x78, 0x37, 0xa4, 0x38, 0x02, 0x38, 0x50,
-    0x38, 0x9e, 0x38, 0xd2, 0x39, 0x04, 0x39, 0x56,
-    0x39, 0x88, 0x39, 0xbc, 0x39, 0xe8, 0x3a, 0x98,
-    0x3a, 0xc4, 0x3a, 0xf8, 0x3b, 0x28, 0x3b, 0x62,
-    0x3b, 0xaa, 0x3b, 0xe0, 0x3c, 0x2e, 0x3c, 0xa0,
-    0x3c, 0xce, 0x3d, 0x04, 0x3d, 0x32, 0x3d, 0x7c,
-    0x3d, 0xaa, 0x3d, 0xfa, 0x3e, 0x46, 0x3e, 0x90,
-    0x3e, 0xba, 0x3f, 0x0e, 0x3f, 0x64, 0x3f, 0xb6,
-    0x3f, 0xde, 0x40, 0x00, 0x40, 0x48, 0x40, 0xba,
-    0x40, 0xfc, 0x41, 0x1e, 0x41, 0x5c, 0x41, 0x80,
-    0x41, 0xca, 0x41, 0xec, 0x42, 0x0e, 0x42, 0x34,
-    0x42, 0x5a, 0x42, 0x96, 0x42, 0xd0, 0x42, 0xfa,
-    0x43, 0x3c, 0x43, 0x66, 0x43, 0xa8, 0x43, 0xda,
-    0x44, 0x28, 0x44, 0x5c, 0x44, 0x8e, 0x44, 0xee,
-    0x45, 0x4e, 0x45, 0x70, 0x45, 0xc0, 0x46, 0x0c,
-    0x46, 0x32, 0x46, 0x52, 0x46, 0x7c, 0x46, 0xa0,
-    0x46, 0xcc, 0x46, 0xf0, 0x47, 0x1c, 0x47, 0x44,
-    0x47, 0x68, 0x47, 0x8e, 0x47, 0xb8, 0x47, 0xe0,
-    0x48, 0x22, 0x48, 0x4e, 0x48, 0x7a, 0x48, 0xa0,
-    0x48, 0xcc, 0x48, 0xf2, 0x49, 0x20, 0x49, 0x60,
-    0x49, 0x74, 0x49, 0xa8, 0x49, 0xbe, 0x49, 0xd4,
-    0x49, 0xe8, 0x49, 0xfc, 0x4a, 0x24, 0x4a, 0x4a,
-    0x4a, 0x62, 0x4a, 0xa6, 0x4a, 0xc0, 0x4a, 0xd4,
-    0x4a, 0xee, 0x4b, 0x04, 0x4b, 0x26, 0x4b, 0x74,
-    0x4b, 0xb0, 0x4b, 0xda, 0x4c, 0x00, 0x4c, 0x34,
-    0x4c, 0x76, 0x4c, 0x9a, 0x4c, 0xbe, 0x4c, 0xe8,
-    0x4d, 0x4a, 0x4d, 0x78, 0x4d, 0xc8, 0x4e, 0x1a,
-    0x4e, 0x5e, 0x4e, 0x8a, 0x4e, 0xae, 0x4f, 0x02,
-    0x4f, 0x22, 0x4f, 0x4a, 0x4f, 0xc6, 0x4f, 0xea,
-    0x50, 0x90, 0x51, 0x1e, 0x51, 0x54, 0x51, 0xbe,
-    0x52, 0x28, 0x52, 0x5c, 0x52, 0xae, 0x52, 0xda,
-    0x53, 0x1c, 0x53, 0x6e, 0x54, 0x24, 0x54, 0x70,
-    0x54, 0xb6, 0x54, 0xe4, 0x55, 0x08, 0x55, 0x4e,
-    0x55, 0x96, 0x55, 0xc8, 0x56, 0x0a, 0x56, 0xb8,
-    0x57, 0x3e, 0x57, 0x7a, 0x58, 0x30, 0x58, 0xde,
-    0x59, 0x72, 0x59, 0xa0, 0x5a, 0x1c, 0x5a, 0x8a,
-    0x5b, 0x36, 0x5b, 0x9a, 0x5b, 0xee, 0x5c, 0x50,
-    0x5c, 0x9e, 0x5d, 0x48, 0x5d, 0x80, 0x5d, 0xb6,
-    0x5d, 0xfe, 0x5e, 0x70, 0x5e, 0xb2, 0x5e, 0xdc,
-    0x5e, 0xfe, 0x5f, 0x1c, 0x5f, 0x40, 0x5f, 0x86,
-    0x5f, 0xa6, 0x5f, 0xc8, 0x60, 0x60, 0x61, 0x18,
-    0x61, 0xea, 0x62, 0xa2, 0x62, 0xc0, 0x62, 0xfc,
-    0x63, 0x1c, 0x63, 0x44, 0x63, 0x70, 0x63, 0xb4,
-    0x64, 0x12, 0x64, 0x76, 0x64, 0xa8, 0x64, 0xc6,
-    0x65, 0xda, 0x66, 0x0c, 0x66, 0x58, 0x66, 0x7e,
-    0x66, 0xea, 0x67, 0x08, 0x67, 0x22, 0x67, 0x3e,
-    0x67, 0x68, 0x67, 0x8a, 0x67, 0xb2, 0x67, 0xd4,
-    0x67, 0xf2, 0x68, 0x14, 0x68, 0x2e, 0x68, 0x74,
-    0x68, 0xa0, 0x68, 0xba, 0x68, 0xe2, 0x68, 0xfc,
-    0x69, 0x18, 0x69, 0x56, 0x69, 0x78, 0x69, 0xb8,
-    0x69, 0xfa, 0x6a, 0x12, 0x6a, 0x32, 0x6a, 0x74,
-    0x6a, 0xa0, 0x6a, 0xd2, 0x6a, 0xfe, 0x6b, 0x66,
-    0x6b, 0x8a, 0x6b, 0xb2, 0x6b, 0xda, 0x6c, 0x00,
-    0x6c, 0x74, 0x6c, 0xb0, 0x6c, 0xf4, 0x6d, 0x38,
-    0x6d, 0x78, 0x6d, 0xc8, 0x6e, 0x08, 0x6e, 0x52,
-    0x6e, 0x88, 0x6e, 0xf8, 0x6f, 0x3e, 0x6f, 0x68,
-    0x6f, 0xa0, 0x6f, 0xe2, 0x70, 0x1c, 0x70, 0x3e,
-    0x70, 0x82, 0x70, 0xcc, 0x70, 0xec, 0x71, 0x1a,
-    0x71, 0x7a, 0x71, 0xd2, 0x71, 0xf8, 0x72, 0x18,
-    0x72, 0x54, 0x72, 0xac, 0x72, 0xd8, 0x73, 0x0a,
-    0x73, 0x40, 0x73, 0x7a, 0x73, 0xca, 0x73, 0xf6,
-    0x74, 0x5e, 0x74, 0xa6, 0x74, 0xe6, 0x75, 0x4c,
-    0x75, 0xba, 0x75, 0xf6, 0x76, 0x24, 0x76, 0x42,
-    0x76, 0x6c, 0x76, 0x8e, 0x76, 0xb2, 0x76, 0xd4,
-    0x77, 0x0a, 0x77, 0x40, 0x77, 0x64, 0x77, 0x88,
-    0x77, 0xae, 0x77, 0xd8, 0x78, 0x00, 0x78, 0x2a,
-    0x78, 0x68, 0x78, 0xa6, 0x78, 0xf0, 0x79, 0x3a,
-    0x79, 0xaa, 0x7a, 0x34, 0x7a, 0x62, 0x7a, 0x90,
-    0x7a, 0xf8, 0x7b, 0x72, 0x7b, 0xb2, 0x7c, 0x02,
-    0x7c, 0x7c, 0x7c, 0xae, 0x7c, 0xf2, 0x7d, 0x3c,
-    0x7d, 0x90, 0x7d, 0xe6, 0x7e, 0x4a, 0x7e, 0xb0,
-    0x7e, 0xf8, 0x7f, 0x40, 0x7f, 0x98, 0x7f, 0x98,
-    0x7f, 0xce, 0x80, 0x00, 0x80, 0x22, 0x80, 0x52,
-    0x80, 0xb6, 0x80, 0xde, 0x81, 0x08, 0x82, 0x0a,
-    0x82, 0x88, 0x82, 0xda, 0x83, 0x0e, 0x83, 0x5e,
-    0x83, 0x7e, 0x83, 0x9a, 0x83, 0xd4, 0x84, 0x76,
-    0x84, 0xb0, 0x84, 0xe8, 0x85, 0x1e, 0x85, 0x5c,
-    0x85, 0xda, 0x86, 0x30, 0x86, 0x9e, 0x86, 0xec,
-    0x87, 0x4c, 0x87, 0xbc, 0x87, 0xe6, 0x88, 0x66,
-    0x88, 0xd6, 0x88, 0xf8, 0x89, 0x54, 0x89, 0xaa,
-    0x8a, 0x72, 0x8b, 0x00, 0x8b, 0x2c, 0x8c, 0x30,
-    0x8c, 0x9e, 0x8d, 0x12, 0x8d, 0x7c, 0x8d, 0xd6,
-    0x8e, 0x00, 0x8e, 0x28, 0x8e, 0x52, 0x8e, 0x7c,
-    0x8e, 0xc2, 0x8f, 0x04, 0x8f, 0x30, 0x8f, 0x6c,
-    0x8f, 0xa6, 0x8f, 0xda, 0x8f, 0xec, 0x90, 0x02,
-    0x90, 0x20, 0x90, 0x9c, 0x90, 0xf8, 0x91, 0x1e,
-    0x91, 0x3c, 0x91, 0x56, 0x91, 0x92, 0x91, 0xdc,
-    0x92, 0x40, 0x92, 0xa2, 0x93, 0x0e, 0x93, 0x70,
-    0x93, 0xce, 0x94, 0x54, 0x94, 0xb4, 0x95, 0x16,
-    0x95, 0x82, 0x95, 0xe4, 0x96, 0x40, 0x96, 0x7c,
-    0x97, 0x46, 0x97, 0x80, 0x97, 0xd6, 0x98, 0x38,
-    0x98, 0x6c, 0x98, 0xa6, 0x98, 0xf4, 0x99, 0x42,
-    0x99, 0x8a, 0x99, 0xe8, 0x9a, 0x24, 0x9b, 0x0e,
-    0x9b, 0xb6, 0x9c, 0x3c, 0x9d, 0x4a, 0x9d, 0xf8,
-    0x9e, 0xa4, 0x9f, 0x40, 0x9f, 0xc8, 0xa0, 0x38,
-    0xa0, 0x88, 0xa0, 0xd6, 0xa1, 0x80, 0xa2, 0x0a,
-    0xa2, 0x92, 0xa2, 0xcc, 0xa3, 0x26, 0xa3, 0x5e,
-    0xa6, 0x66, 0xa6, 0xac, 0xa6, 0xd4, 0xa7, 0x56,
-    0xa7, 0xb6, 0xa8, 0x18, 0xa8, 0xe2, 0xa9, 0x26,
-    0xa9, 0x5c, 0xa9, 0x90, 0xa9, 0xc6, 0xaa, 0x0a,
-    0xaa, 0x4e, 0xaa, 0xa0, 0xab, 0x7a, 0xab, 0xe8,
-    0xac, 0x56, 0xac, 0xd2, 0xad, 0x94, 0xad, 0xee,
-    0xae, 0x6a, 0xae, 0xee, 0xaf, 0xae, 0xb0, 0x0a,
-    0xb0, 0x84, 0xb1, 0x20, 0xb1, 0x2b, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x02, 0x82, 0x00, 0xc6,
-    0x00, 0x08, 0x00, 0xa3, 0x00, 0x07, 0x00, 0x02,
-    0x00, 0x78, 0x00, 0xcc, 0x00, 0x8d, 0x00, 0x00,
-    0x00, 0xea, 0x0d, 0xfd, 0x00, 0x04, 0x00, 0x02,
-    0x00, 0x00, 0x00, 0x1a, 0x01, 0x3e, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x0e, 0x00, 0x44, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x07,
-    0x00, 0x52, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x34, 0x00, 0x59, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x16,
-    0x00, 0x8d, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x23, 0x00, 0xa3, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x15,
-    0x00, 0xc6, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0x00, 0x31, 0x00, 0xdb, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x09,
-    0x01, 0x0c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x09, 0x00, 0x25, 0x01, 0x15, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x19,
-    0x01, 0x3a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0d, 0x00, 0x2e, 0x01, 0x53, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x2a,
-    0x01, 0x81, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x00, 0x00, 0x00, 0x88, 0x01, 0xab, 0x00, 0x03,
-    0x00, 0x01, 0x04, 0x09, 0x00, 0x01, 0x00, 0x1c,
-    0x02, 0x33, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x00, 0x02, 0x00, 0x0e, 0x02, 0x4f, 0x00, 0x03,
-    0x00, 0x01, 0x04, 0x09, 0x00, 0x03, 0x00, 0x68,
-    0x02, 0x5d, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x00, 0x04, 0x00, 0x2c, 0x02, 0xc5, 0x00, 0x03,
-    0x00, 0x01, 0x04, 0x09, 0x00, 0x05, 0x00, 0x46,
-    0x02, 0xf1, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x00, 0x06, 0x00, 0x2a, 0x03, 0x37, 0x00, 0x03,
-    0x00, 0x01, 0x04, 0x09, 0x00, 0x07, 0x00, 0x62,
-    0x03, 0x61, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x00, 0x08, 0x00, 0x12, 0x03, 0xc3, 0x00, 0x03,
-    0x00, 0x01, 0x04, 0x09, 0x00, 0x09, 0x00, 0x4a,
-    0x03, 0xd5, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x00, 0x0b, 0x00, 0x32, 0x04, 0x1f, 0x00, 0x03,
-    0x00, 0x01, 0x04, 0x09, 0x00, 0x0d, 0x00, 0x5c,
-    0x04, 0x51, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x00, 0x0e, 0x00, 0x54, 0x04, 0xad, 0xa9, 0x20,
-    0x32, 0x30, 0x30, 0x30, 0x2d, 0x32, 0x30, 0x32,
-    0x30, 0x20, 0x4a, 0x65, 0x74, 0x42, 0x72, 0x61,
-    0x69, 0x6e, 0x73, 0x20, 0x73, 0x2e, 0x72, 0x2e,
-    0x6f, 0x2e, 0x20, 0x44, 0x65, 0x76, 0x65, 0x6c,
-    0x6f, 0x70, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74,
-    0x68, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x20,
-    0x61, 0x6e, 0x64, 0x20, 0x49, 0x6e, 0x74, 0x65,
-    0x6c, 0x6c, 0x69, 0x4a, 0x20, 0x49, 0x44, 0x45,
-    0x41, 0x2e, 0x4a, 0x65, 0x74, 0x42, 0x72, 0x61,
-    0x69, 0x6e, 0x73, 0x20, 0x4d, 0x6f, 0x6e, 0x6f,
-    0x52, 0x65, 0x67, 0x75, 0x6c, 0x61, 0x72, 0x56,
-    0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x31,
-    0x2e, 0x30, 0x30, 0x30, 0x3b, 0x4a, 0x42, 0x3b,
-    0x4a, 0x65, 0x74, 0x42, 0x72, 0x61, 0x69, 0x6e,
-    0x73, 0x4d, 0x6f, 0x6e, 0x6f, 0x2d, 0x52, 0x65,
-    0x67, 0x75, 0x6c, 0x61, 0x72, 0x3b, 0x32, 0x30,
-    0x32, 0x30, 0x3b, 0x46, 0x4c, 0x56, 0x49, 0x2d,
-    0x36, 0x31, 0x34, 0x4a, 0x65, 0x74, 0x42, 0x72,
-    0x61, 0x69, 0x6e, 0x73, 0x20, 0x4d, 0x6f, 0x6e,
-    0x6f, 0x20, 0x52, 0x65, 0x67, 0x75, 0x6c, 0x61,
-    0x72, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e,
-    0x20, 0x31, 0x2e, 0x30, 0x30, 0x30, 0x3b, 0x20,
-    0x74, 0x74, 0x66, 0x61, 0x75, 0x74, 0x6f, 0x68,
-    0x69, 0x6e, 0x74, 0x20, 0x28, 0x76, 0x31, 0x2e,
-    0x38, 0x2e, 0x33, 0x29, 0x4a, 0x65, 0x74, 0x42,
-    0x72, 0x61, 0x69, 0x6e, 0x73, 0x4d, 0x6f, 0x6e,
-    0x6f, 0x2d, 0x52, 0x65, 0x67, 0x75, 0x6c, 0x61,
-    0x72, 0x4a, 0x65, 0x74, 0x42, 0x72, 0x61, 0x69,
-    0x6e, 0x73, 0x20, 0x4d, 0x6f, 0x6e, 0x6f, 0x20,
-    0x69, 0x73, 0x20, 0x61, 0x20, 0x74, 0x72, 0x61,
-    0x64, 0x65, 0x6d, 0x61, 0x72, 0x6b, 0x20, 0x6f,
-    0x66, 0x20, 0x4a, 0x65, 0x74, 0x42, 0x72, 0x61,
-    0x69, 0x6e, 0x73, 0x20, 0x73, 0x2e, 0x72, 0x2e,
-    0x6f, 0x2e, 0x4a, 0x65, 0x74, 0x42, 0x72, 0x61,
-    0x69, 0x6e, 0x73, 0x50, 0x68, 0x69, 0x6c, 0x69,
-    0x70, 0x70, 0x20, 0x4e, 0x75, 0x72, 0x75, 0x6c,
-    0x6c, 0x69, 0x6e, 0x2c, 0x20, 0x4b, 0x6f, 0x6e,
-    0x73, 0x74, 0x61, 0x6e, 0x74, 0x69, 0x6e, 0x20,
-    0x42, 0x75, 0x6c, 0x65, 0x6e, 0x6b, 0x6f, 0x76,
-    0x68, 0x74, 0x74, 0x70, 0x73, 0x3a, 0x2f, 0x2f,
-    0x77, 0x77, 0x77, 0x2e, 0x6a, 0x65, 0x74, 0x62,
-    0x72, 0x61, 0x69, 0x6e, 0x73, 0x2e, 0x63, 0x6f,
-    0x6d, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65,
-    0x64, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20,
-    0x74, 0x68, 0x65, 0x20, 0x41, 0x70, 0x61, 0x63,
-    0x68, 0x65, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e,
-    0x73, 0x65, 0x2c, 0x20, 0x56, 0x65, 0x72, 0x73,
-    0x69, 0x6f, 0x6e, 0x20, 0x32, 0x2e, 0x30, 0x68,
-    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77,
-    0x77, 0x2e, 0x61, 0x70, 0x61, 0x63, 0x68, 0x65,
-    0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x6c, 0x69, 0x63,
-    0x65, 0x6e, 0x73, 0x65, 0x73, 0x2f, 0x4c, 0x49,
-    0x43, 0x45, 0x4e, 0x53, 0x45, 0x2d, 0x32, 0x2e,
-    0x30, 0x00, 0xa9, 0x00, 0x20, 0x00, 0x32, 0x00,
-    0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x2d, 0x00,
-    0x32, 0x00, 0x30, 0x00, 0x32, 0x00, 0x30, 0x00,
-    0x20, 0x00, 0x4a, 0x00, 0x65, 0x00, 0x74, 0x00,
-    0x42, 0x00, 0x72, 0x00, 0x61, 0x00, 0x69, 0x00,
-    0x6e, 0x00, 0x73, 0x00, 0x20, 0x00, 0x73, 0x00,
-    0x2e, 0x00, 0x72, 0x00, 0x2e, 0x00, 0x6f, 0x00,
-    0x2e, 0x00, 0x20, 0x00, 0x44, 0x00, 0x65, 0x00,
-    0x76, 0x00, 0x65, 0x00, 0x6c, 0x00, 0x6f, 0x00,
-    0x70, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00,
-    0x77, 0x00, 0x69, 0x00, 0x74, 0x00, 0x68, 0x00,
-    0x20, 0x00, 0x64, 0x00, 0x72, 0x00, 0x69, 0x00,
-    0x76, 0x00, 0x65, 0x00, 0x20, 0x00, 0x61, 0x00,
-    0x6e, 0x00, 0x64, 0x00, 0x20, 0x00, 0x49, 0x00,
-    0x6e, 0x00, 0x74, 0x00, 0x65, 0x00, 0x6c, 0x00,
-    0x6c, 0x00, 0x69, 0x00, 0x4a, 0x00, 0x20, 0x00,
-    0x49, 0x00, 0x44, 0x00, 0x45, 0x00, 0x41, 0x00,
-    0x2e, 0x00, 0x4a, 0x00, 0x65, 0x00, 0x74, 0x00,
-    0x42, 0x00, 0x72, 0x00, 0x61, 0x00, 0x69, 0x00,
-    0x6e, 0x00, 0x73, 0x00, 0x20, 0x00, 0x4d, 0x00,
-    0x6f, 0x00, 0x6e, 0x00, 0x6f, 0x00, 0x52, 0x00,
-    0x65, 0x00, 0x67, 0x00, 0x75, 0x00, 0x6c, 0x00,
-    0x61, 0x00, 0x72, 0x00, 0x56, 0x00, 0x65, 0x00,
-    0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f, 0x00,
-    0x6e, 0x00, 0x20, 0x00, 0x31, 0x00, 0x2e, 0x00,
-    0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x3b, 0x00,
-    0x4a, 0x00, 0x42, 0x00, 0x3b, 0x00, 0x4a, 0x00,
-    0x65, 0x00, 0x74, 0x00, 0x42, 0x00, 0x72, 0x00,
-    0x61, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x73, 0x00,
-    0x4d, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x6f, 0x00,
-    0x2d, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00,
-    0x75, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x72, 0x00,
-    0x3b, 0x00, 0x32, 0x00, 0x30, 0x00, 0x32, 0x00,
-    0x30, 0x00, 0x3b, 0x00, 0x46, 0x00, 0x4c, 0x00,
-    0x56, 0x00, 0x49, 0x00, 0x2d, 0x00, 0x36, 0x00,
-    0x31, 0x00, 0x34, 0x00, 0x4a, 0x00, 0x65, 0x00,
-    0x74, 0x00, 0x42, 0x00, 0x72, 0x00, 0x61, 0x00,
-    0x69, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x20, 0x00,
-    0x4d, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x6f, 0x00,
-    0x20, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00,
-    0x75, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x72, 0x00,
-    0x56, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00,
-    0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x20, 0x00,
-    0x31, 0x00, 0x2e, 0x00, 0x30, 0x00, 0x30, 0x00,
-    0x30, 0x00, 0x3b, 0x00, 0x20, 0x00, 0x74, 0x00,
-    0x74, 0x00, 0x66, 0x00, 0x61, 0x00, 0x75, 0x00,
-    0x74, 0x00, 0x6f, 0x00, 0x68, 0x00, 0x69, 0x00,
-    0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x28, 0x00,
-    0x76, 0x00, 0x31, 0x00, 0x2e, 0x00, 0x38, 0x00,
-    0x2e, 0x00, 0x33, 0x00, 0x29, 0x00, 0x4a, 0x00,
-    0x65, 0x00, 0x74, 0x00, 0x42, 0x00, 0x72, 0x00,
-    0x61, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x73, 0x00,
-    0x4d, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x6f, 0x00,
-    0x2d, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00,
-    0x75, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x72, 0x00,
-    0x4a, 0x00, 0x65, 0x00, 0x74, 0x00, 0x42, 0x00,
-    0x72, 0x00, 0x61, 0x00, 0x69, 0x00, 0x6e, 0x00,
-    0x73, 0x00, 0x20, 0x00, 0x4d, 0x00, 0x6f, 0x00,
-    0x6e, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x69, 0x00,
-    0x73, 0x00, 0x20, 0x00, 0x61, 0x00, 0x20, 0x00,
-    0x74, 0x00, 0x72, 0x00, 0x61, 0x00, 0x64, 0x00,
-    0x65, 0x00, 0x6d, 0x00, 0x61, 0x00, 0x72, 0x00,
-    0x6b, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x66, 0x00,
-    0x20, 0x00, 0x4a, 0x00, 0x65, 0x00, 0x74, 0x00,
-    0x42, 0x00, 0x72, 0x00, 0x61, 0x00, 0x69, 0x00,
-    0x6e, 0x00, 0x73, 0x00, 0x20, 0x00, 0x73, 0x00,
-    0x2e, 0x00, 0x72, 0x00, 0x2e, 0x00, 0x6f, 0x00,
-    0x2e, 0x00, 0x4a, 0x00, 0x65, 0x00, 0x74, 0x00,
-    0x42, 0x00, 0x72, 0x00, 0x61, 0x00, 0x69, 0x00,
-    0x6e, 0x00, 0x73, 0x00, 0x50, 0x00, 0x68, 0x00,
-    0x69, 0x00, 0x6c, 0x00, 0x69, 0x00, 0x70, 0x00,
-    0x70, 0x00, 0x20, 0x00, 0x4e, 0x00, 0x75, 0x00,
-    0x72, 0x00, 0x75, 0x00, 0x6c, 0x00, 0x6c, 0x00,
-    0x69, 0x00, 0x6e, 0x00, 0x2c, 0x00, 0x20, 0x00,
-    0x4b, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x73, 0x00,
-    0x74, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x74, 0x00,
-    0x69, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x42, 0x00,
-    0x75, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x6e, 0x00,
-    0x6b, 0x00, 0x6f, 0x00, 0x76, 0x00, 0x68, 0x00,
-    0x74, 0x00, 0x74, 0x00, 0x70, 0x00, 0x73, 0x00,
-    0x3a, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x77, 0x00,
-    0x77, 0x00, 0x77, 0x00, 0x2e, 0x00, 0x6a, 0x00,
-    0x65, 0x00, 0x74, 0x00, 0x62, 0x00, 0x72, 0x00,
-    0x61, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x73, 0x00,
-    0x2e, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x6d, 0x00,
-    0x4c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x65, 0x00,
-    0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00,
-    0x20, 0x00, 0x75, 0x00, 0x6e, 0x00, 0x64, 0x00,
-    0x65, 0x00, 0x72, 0x00, 0x20, 0x00, 0x74, 0x00,
-    0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x41, 0x00,
-    0x70, 0x00, 0x61, 0x00, 0x63, 0x00, 0x68, 0x00,
-    0x65, 0x00, 0x20, 0x00, 0x4c, 0x00, 0x69, 0x00,
-    0x63, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00,
-    0x65, 0x00, 0x2c, 0x00, 0x20, 0x00, 0x56, 0x00,
-    0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00,
-    0x6f, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x32, 0x00,
-    0x2e, 0x00, 0x30, 0x00, 0x68, 0x00, 0x74, 0x00,
-    0x74, 0x00, 0x70, 0x00, 0x3a, 0x00, 0x2f, 0x00,
-    0x2f, 0x00, 0x77, 0x00, 0x77, 0x00, 0x77, 0x00,
-    0x2e, 0x00, 0x61, 0x00, 0x70, 0x00, 0x61, 0x00,
-    0x63, 0x00, 0x68, 0x00, 0x65, 0x00, 0x2e, 0x00,
-    0x6f, 0x00, 0x72, 0x00, 0x67, 0x00, 0x2f, 0x00,
-    0x6c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x65, 0x00,
-    0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x73, 0x00,
-    0x2f, 0x00, 0x4c, 0x00, 0x49, 0x00, 0x43, 0x00,
-    0x45, 0x00, 0x4e, 0x00, 0x53, 0x00, 0x45, 0x00,
-    0x2d, 0x00, 0x32, 0x00, 0x2e, 0x00, 0x30, 0x00,
-    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0x88, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x82, 0x00, 0x00, 0x01, 0x02, 0x01, 0x03,
-    0x00, 0x03, 0x00, 0x2b, 0x00, 0x51, 0x00, 0x53,
-    0x00, 0x0b, 0x00, 0x52, 0x00, 0x4c, 0x00, 0x4f,
-    0x00, 0x32, 0x00, 0x4b, 0x00, 0x4e, 0x00, 0x4a,
-    0x00, 0x21, 0x00, 0x60, 0x00, 0x24, 0x00, 0x25,
-    0x00, 0x26, 0x00, 0x27, 0x00, 0x28, 0x00, 0x29,
-    0x00, 0x2a, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x2e,
-    0x00, 0x2f, 0x00, 0x30, 0x00, 0x31, 0x00, 0x33,
-    0x00, 0x34, 0x00, 0x35, 0x00, 0x36, 0x00, 0x37,
-    0x00, 0x38, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3b,
-    0x00, 0x3c, 0x00, 0x3d, 0x00, 0x11, 0x00, 0x44,
-    0x00, 0x45, 0x00, 0x46, 0x00, 0x48, 0x00, 0x49,
-    0x00, 0x4d, 0x00, 0x50, 0x00, 0x55, 0x00, 0x56,
-    0x00, 0x57, 0x00, 0x59, 0x00, 0x5a, 0x00, 0x5b,
-    0x00, 0x5c, 0x00, 0x5d, 0x00, 0x0f, 0x00, 0x13,
-    0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17,
-    0x00, 0x18, 0x00, 0x19, 0x00, 0x1a, 0x00, 0x1b,
-    0x00, 0x1c, 0x00, 0x10, 0x00, 0x0e, 0x00, 0x0d,
-    0x00, 0x12, 0x00, 0x3f, 0x00, 0x1d, 0x00, 0x1e,
-    0x00, 0x1f, 0x00, 0x20, 0x00, 0x04, 0x00, 0x22,
-    0x00, 0x0a, 0x00, 0x05, 0x00, 0x06, 0x00, 0x08,
-    0x00, 0x5e, 0x00, 0x5f, 0x00, 0x3e, 0x00, 0x42,
-    0x00, 0x0c, 0x00, 0x47, 0x00, 0x54, 0x00, 0x58,
-    0x00, 0xb3, 0x00, 0x41, 0x00, 0xb8, 0x00, 0xf0,
-    0x00, 0x93, 0x00, 0xef, 0x00, 0x23, 0x00, 0x09,
-    0x00, 0x40, 0x00, 0x07, 0x01, 0x04, 0x00, 0xb2,
-    0x00, 0xc3, 0x01, 0x05, 0x01, 0x06, 0x01, 0x07,
-    0x01, 0x08, 0x01, 0x09, 0x01, 0x0a, 0x01, 0x0b,
-    0x01, 0x0c, 0x01, 0x0d, 0x01, 0x0e, 0x01, 0x0f,
-    0x01, 0x10, 0x01, 0x11, 0x01, 0x12, 0x01, 0x13,
-    0x01, 0x14, 0x01, 0x15, 0x01, 0x16, 0x00, 0xd7,
-    0x01, 0x17, 0x01, 0x18, 0x01, 0x19, 0x01, 0x1a,
-    0x01, 0x1b, 0x00, 0x87, 0x00, 0xe8, 0x00, 0xaa,
-    0x00, 0xa9, 0x00, 0xbe, 0x00, 0xbf, 0x00, 0xb6,
-    0x00, 0xb7, 0x00, 0xb4, 0x00, 0xb5, 0x00, 0xc4,
-    0x00, 0xc5, 0x00, 0xd9, 0x00, 0xda, 0x00, 0x61,
-    0x00, 0xdb, 0x00, 0xdc, 0x00, 0xdd, 0x00, 0x43,
-    0x00, 0x8d, 0x00, 0xdf, 0x00, 0x6a, 0x00, 0x78,
-    0x01, 0x1c, 0x01, 0x1d, 0x00, 0x8e, 0x00, 0x6c,
-    0x00, 0xd8, 0x00, 0xe1, 0x01, 0x00, 0x00, 0xde,
-    0x00, 0xe0, 0x01, 0x1e, 0x01, 0x1f, 0x00, 0x6f,
-    0x00, 0xad, 0x00, 0xc9, 0x00, 0xc7, 0x00, 0xae,
-    0x00, 0x62, 0x00, 0x63, 0x00, 0x64, 0x00, 0xcb,
-    0x00, 0x65, 0x00, 0xc8, 0x00, 0xca, 0x00, 0xcf,
-    0x00, 0xcc, 0x00, 0xcd, 0x00, 0xce, 0x00, 0xd3,
-    0x00, 0xd0, 0x00, 0xd1, 0x00, 0xaf, 0x00, 0x67,
-    0x00, 0xe4, 0x00, 0xd6, 0x00, 0xd4, 0x00, 0xd5,
-    0x00, 0x68, 0x00, 0xbb, 0x00, 0xeb, 0x00, 0xe6,
-    0x00, 0x69, 0x00, 0x6b, 0x00, 0x6d, 0x00, 0x6e,
-    0x00, 0x71, 0x00, 0x70, 0x00, 0x72, 0x00, 0x73,
-    0x00, 0x75, 0x00, 0x74, 0x00, 0x76, 0x00, 0x77,
-    0x00, 0x7a, 0x00, 0x79, 0x00, 0x7b, 0x00, 0x7d,
-    0x00, 0x7c, 0x00, 0xe5, 0x00, 0x7f, 0x00, 0x7e,
-    0x00, 0x80, 0x00, 0x81, 0x00, 0xec, 0x00, 0xba,
-    0x00, 0xe7, 0x00, 0x66, 0x01, 0x20, 0x00, 0xe9,
-    0x00, 0xee, 0x00, 0x91, 0x00, 0xa1, 0x00, 0xe3,
-    0x00, 0xe2, 0x01, 0x21, 0x01, 0x22, 0x01, 0x23,
-    0x01, 0x24, 0x01, 0x25, 0x01, 0x26, 0x00, 0xfd,
-    0x00, 0xfe, 0x01, 0x27, 0x01, 0x28, 0x01, 0x29,
-    0x01, 0x2a, 0x00, 0xff, 0x01, 0x2b, 0x01, 0x2c,
-    0x01, 0x2d, 0x01, 0x2e, 0x01, 0x2f, 0x01, 0x30,
-    0x01, 0x31, 0x01, 0x32, 0x01, 0x33, 0x01, 0x34,
-    0x01, 0x35, 0x01, 0x36, 0x01, 0x37, 0x01, 0x38,
-    0x00, 0xf8, 0x00, 0xf9, 0x01, 0x39, 0x01, 0x3a,
-    0x01, 0x3b, 0x01, 0x3c, 0x01, 0x3d, 0x01, 0x3e,
-    0x01, 0x3f, 0x01, 0x40, 0x01, 0x41, 0x01, 0x42,
-    0x00, 0xfa, 0x01, 0x43, 0x01, 0x44, 0x01, 0x45,
-    0x01, 0x46, 0x01, 0x47, 0x01, 0x48, 0x01, 0x49,
-    0x01, 0x4a, 0x01, 0x4b, 0x01, 0x4c, 0x01, 0x4d,
-    0x01, 0x4e, 0x01, 0x4f, 0x01, 0x50, 0x01, 0x51,
-    0x01, 0x52, 0x01, 0x53, 0x01, 0x54, 0x00, 0xfb,
-    0x00, 0xfc, 0x01, 0x55, 0x01, 0x56, 0x01, 0x57,
-    0x01, 0x58, 0x01, 0x59, 0x01, 0x5a, 0x01, 0x5b,
-    0x01, 0x5c, 0x01, 0x5d, 0x01, 0x5e, 0x01, 0x5f,
-    0x01, 0x60, 0x01, 0x61, 0x01, 0x62, 0x01, 0x63,
-    0x01, 0x64, 0x01, 0x65, 0x01, 0x66, 0x01, 0x67,
-    0x01, 0x68, 0x01, 0x69, 0x01, 0x6a, 0x01, 0x6b,
-    0x01, 0x6c, 0x01, 0x6d, 0x01, 0x6e, 0x01, 0x6f,
-    0x01, 0x70, 0x01, 0x71, 0x01, 0x72, 0x01, 0x73,
-    0x01, 0x74, 0x01, 0x75, 0x01, 0x76, 0x01, 0x77,
-    0x01, 0x78, 0x01, 0x79, 0x01, 0x7a, 0x01, 0x7b,
-    0x00, 0x83, 0x01, 0x7c, 0x01, 0x7d, 0x01, 0x7e,
-    0x01, 0x7f, 0x01, 0x80, 0x01, 0x81, 0x01, 0x82,
-    0x01, 0x83, 0x01, 0x84, 0x01, 0x85, 0x01, 0x86,
-    0x01, 0x87, 0x01, 0x88, 0x01, 0x89, 0x01, 0x8a,
-    0x01, 0x8b, 0x01, 0x8c, 0x01, 0x8d, 0x01, 0x8e,
-    0x00, 0x8b, 0x00, 0x8a, 0x00, 0xa3, 0x00, 0xa2,
-    0x01, 0x8f, 0x01, 0x90, 0x00, 0xed, 0x01, 0x91,
-    0x01, 0x92, 0x01, 0x93, 0x01, 0x01, 0x01, 0x94,
-    0x01, 0x95, 0x01, 0x96, 0x01, 0x97, 0x01, 0x98,
-    0x00, 0xab, 0x00, 0x88, 0x00, 0x97, 0x00, 0xb0,
-    0x00, 0xb1, 0x00, 0x90, 0x00, 0xa0, 0x00, 0x89,
-    0x00, 0xea, 0x00, 0xa4, 0x00, 0x8c, 0x00, 0xa6,
-    0x00, 0x86, 0x00, 0xbd, 0x00, 0x84, 0x00, 0x85,
-    0x00, 0x96, 0x00, 0x9d, 0x00, 0x9e, 0x00, 0xf1,
-    0x00, 0xf2, 0x00, 0xf3, 0x01, 0x99, 0x01, 0x9a,
-    0x01, 0x9b, 0x01, 0x9c, 0x01, 0x9d, 0x01, 0x9e,
-    0x01, 0x9f, 0x00, 0xbc, 0x00, 0xf5, 0x00, 0xf4,
-    0x00, 0xf6, 0x00, 0xc6, 0x00, 0x82, 0x00, 0xc2,
-    0x01, 0xa0, 0x01, 0xa1, 0x01, 0xa2, 0x01, 0xa3,
-    0x01, 0xa4, 0x01, 0xa5, 0x01, 0xa6, 0x01, 0xa7,
-    0x01, 0xa8, 0x01, 0xa9, 0x01, 0xaa, 0x01, 0xab,
-    0x01, 0xac, 0x01, 0xad, 0x01, 0xae, 0x01, 0xaf,
-    0x01, 0xb0, 0x01, 0xb1, 0x01, 0xb2, 0x01, 0xb3,
-    0x01, 0xb4, 0x01, 0xb5, 0x01, 0xb6, 0x01, 0xb7,
-    0x01, 0xb8, 0x01, 0xb9, 0x01, 0xba, 0x01, 0xbb,
-    0x01, 0xbc, 0x01, 0xbd, 0x01, 0xbe, 0x01, 0xbf,
-    0x01, 0xc0, 0x01, 0xc1, 0x01, 0xc2, 0x01, 0xc3,
-    0x01, 0xc4, 0x01, 0xc5, 0x01, 0xc6, 0x01, 0xc7,
-    0x01, 0xc8, 0x01, 0xc9, 0x01, 0xca, 0x01, 0xcb,
-    0x01, 0xcc, 0x01, 0xcd, 0x01, 0xce, 0x01, 0xcf,
-    0x01, 0xd0, 0x01, 0xd1, 0x01, 0xd2, 0x01, 0xd3,
-    0x01, 0xd4, 0x01, 0xd5, 0x01, 0xd6, 0x01, 0xd7,
-    0x01, 0xd8, 0x01, 0xd9, 0x01, 0xda, 0x01, 0xdb,
-    0x01, 0xdc, 0x01, 0xdd, 0x01, 0xde, 0x01, 0xdf,
-    0x01, 0xe0, 0x01, 0xe1, 0x01, 0xe2, 0x01, 0xe3,
-    0x01, 0xe4, 0x01, 0xe5, 0x01, 0xe6, 0x01, 0xe7,
-    0x01, 0xe8, 0x01, 0xe9, 0x01, 0xea, 0x01, 0xeb,
-    0x01, 0xec, 0x01, 0xed, 0x01, 0xee, 0x01, 0xef,
-    0x01, 0xf0, 0x00, 0x8f, 0x01, 0xf1, 0x01, 0xf2,
-    0x01, 0xf3, 0x01, 0xf4, 0x01, 0xf5, 0x01, 0xf6,
-    0x01, 0xf7, 0x01, 0xf8, 0x01, 0xf9, 0x01, 0xfa,
-    0x01, 0xfb, 0x01, 0xfc, 0x01, 0xfd, 0x01, 0xfe,
-    0x01, 0xff, 0x02, 0x00, 0x02, 0x01, 0x02, 0x02,
-    0x02, 0x03, 0x02, 0x04, 0x02, 0x05, 0x02, 0x06,
-    0x02, 0x07, 0x02, 0x08, 0x02, 0x09, 0x02, 0x0a,
-    0x02, 0x0b, 0x02, 0x0c, 0x02, 0x0d, 0x02, 0x0e,
-    0x02, 0x0f, 0x02, 0x10, 0x02, 0x11, 0x02, 0x12,
-    0x02, 0x13, 0x02, 0x14, 0x02, 0x15, 0x02, 0x16,
-    0x02, 0x17, 0x02, 0x18, 0x02, 0x19, 0x02, 0x1a,
-    0x02, 0x1b, 0x02, 0x1c, 0x02, 0x1d, 0x02, 0x1e,
-    0x02, 0x1f, 0x02, 0x20, 0x02, 0x21, 0x02, 0x22,
-    0x02, 0x23, 0x00, 0x9a, 0x00, 0x9c, 0x00, 0x9f,
-    0x00, 0xa8, 0x00, 0x99, 0x00, 0x9b, 0x00, 0xa5,
-    0x00, 0x92, 0x00, 0x98, 0x00, 0xa7, 0x00, 0xb9,
-    0x02, 0x24, 0x02, 0x25, 0x02, 0x26, 0x02, 0x27,
-    0x02, 0x28, 0x02, 0x29, 0x02, 0x2a, 0x02, 0x2b,
-    0x02, 0x2c, 0x02, 0x2d, 0x02, 0x2e, 0x02, 0x2f,
-    0x02, 0x30, 0x02, 0x31, 0x02, 0x32, 0x02, 0x33,
-    0x02, 0x34, 0x02, 0x35, 0x02, 0x36, 0x02, 0x37,
-    0x02, 0x38, 0x02, 0x39, 0x02, 0x3a, 0x00, 0x94,
-    0x00, 0x95, 0x02, 0x3b, 0x02, 0x3c, 0x02, 0x3d,
-    0x02, 0x3e, 0x00, 0xc0, 0x00, 0xc1, 0x02, 0x3f,
-    0x02, 0x40, 0x02, 0x41, 0x02, 0x42, 0x02, 0x43,
-    0x02, 0x44, 0x02, 0x45, 0x02, 0x46, 0x02, 0x47,
-    0x02, 0x48, 0x02, 0x49, 0x02, 0x4a, 0x02, 0x4b,
-    0x02, 0x4c, 0x02, 0x4d, 0x02, 0x4e, 0x02, 0x4f,
-    0x02, 0x50, 0x02, 0x51, 0x02, 0x52, 0x02, 0x53,
-    0x02, 0x54, 0x02, 0x55, 0x02, 0x56, 0x02, 0x57,
-    0x02, 0x58, 0x02, 0x59, 0x02, 0x5a, 0x02, 0x5b,
-    0x02, 0x5c, 0x02, 0x5d, 0x02, 0x5e, 0x02, 0x5f,
-    0x02, 0x60, 0x02, 0x61, 0x02, 0x62, 0x02, 0x63,
-    0x02, 0x64, 0x02, 0x65, 0x02, 0x66, 0x02, 0x67,
-    0x02, 0x68, 0x02, 0x69, 0x02, 0x6a, 0x02, 0x6b,
-    0x02, 0x6c, 0x02, 0x6d, 0x02, 0x6e, 0x02, 0x6f,
-    0x02, 0x70, 0x02, 0x71, 0x02, 0x72, 0x02, 0x73,
-    0x02, 0x74, 0x02, 0x75, 0x02, 0x76, 0x02, 0x77,
-    0x02, 0x78, 0x02, 0x79, 0x02, 0x7a, 0x02, 0x7b,
-    0x02, 0x7c, 0x02, 0x7d, 0x02, 0x7e, 0x02, 0x7f,
-    0x02, 0x80, 0x02, 0x81, 0x02, 0x82, 0x02, 0x83,
-    0x02, 0x84, 0x02, 0x85, 0x02, 0x86, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x30, 0x30, 0x30, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x30, 0x30, 0x44, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x30, 0x30, 0x41, 0x1a, 0x68,
-    0x79, 0x70, 0x68, 0x65, 0x6e, 0x5f, 0x68, 0x79,
-    0x70, 0x68, 0x65, 0x6e, 0x5f, 0x67, 0x72, 0x65,
-    0x61, 0x74, 0x65, 0x72, 0x2e, 0x6c, 0x69, 0x67,
-    0x61, 0x10, 0x73, 0x6c, 0x61, 0x73, 0x68, 0x5f,
-    0x73, 0x6c, 0x61, 0x73, 0x68, 0x2e, 0x6c, 0x69,
-    0x67, 0x61, 0x1c, 0x73, 0x6c, 0x61, 0x73, 0x68,
-    0x5f, 0x61, 0x73, 0x74, 0x65, 0x72, 0x69, 0x73,
-    0x6b, 0x5f, 0x61, 0x73, 0x74, 0x65, 0x72, 0x69,
-    0x73, 0x6b, 0x2e, 0x6c, 0x69, 0x67, 0x61, 0x13,
-    0x73, 0x6c, 0x61, 0x73, 0x68, 0x5f, 0x61, 0x73,
-    0x74, 0x65, 0x72, 0x69, 0x73, 0x6b, 0x2e, 0x6c,
-    0x69, 0x67, 0x61, 0x13, 0x61, 0x73, 0x74, 0x65,
-    0x72, 0x69, 0x73, 0x6b, 0x5f, 0x73, 0x6c, 0x61,
-    0x73, 0x68, 0x2e, 0x6c, 0x69, 0x67, 0x61, 0x1e,
-    0x6c, 0x65, 0x73, 0x73, 0x5f, 0x65, 0x78, 0x63,
-    0x6c, 0x61, 0x6d, 0x5f, 0x68, 0x79, 0x70, 0x68,
-    0x65, 0x6e, 0x5f, 0x68, 0x79, 0x70, 0x68, 0x65,
-    0x6e, 0x2e, 0x6c, 0x69, 0x67, 0x61, 0x10, 0x63,
-    0x6f, 0x6c, 0x6f, 0x6e, 0x5f, 0x65, 0x71, 0x75,
-    0x61, 0x6c, 0x2e, 0x6c, 0x69, 0x67, 0x61, 0x1b,
-    0x68, 0x79, 0x70, 0x68, 0x65, 0x6e, 0x5f, 0x67,
-    0x72, 0x65, 0x61, 0x74, 0x65, 0x72, 0x5f, 0x67,
-    0x72, 0x65, 0x61, 0x74, 0x65, 0x72, 0x2e, 0x6c,
-    0x69, 0x67, 0x61, 0x15, 0x6c, 0x65, 0x73, 0x73,
-    0x5f, 0x6c, 0x65, 0x73, 0x73, 0x5f, 0x68, 0x79,
-    0x70, 0x68, 0x65, 0x6e, 0x2e, 0x6c, 0x69, 0x67,
-    0x61, 0x13, 0x68, 0x79, 0x70, 0x68, 0x65, 0x6e,
-    0x5f, 0x67, 0x72, 0x65, 0x61, 0x74, 0x65, 0x72,
-    0x2e, 0x6c, 0x69, 0x67, 0x61, 0x10, 0x6c, 0x65,
-    0x73, 0x73, 0x5f, 0x68, 0x79, 0x70, 0x68, 0x65,
-    0x6e, 0x2e, 0x6c, 0x69, 0x67, 0x61, 0x17, 0x6c,
-    0x65, 0x73, 0x73, 0x5f, 0x65, 0x71, 0x75, 0x61,
-    0x6c, 0x5f, 0x67, 0x72, 0x65, 0x61, 0x74, 0x65,
-    0x72, 0x2e, 0x6c, 0x69, 0x67, 0x61, 0x10, 0x65,
-    0x71, 0x75, 0x61, 0x6c, 0x5f, 0x65, 0x71, 0x75,
-    0x61, 0x6c, 0x2e, 0x6c, 0x69, 0x67, 0x61, 0x11,
-    0x65, 0x78, 0x63, 0x6c, 0x61, 0x6d, 0x5f, 0x65,
-    0x71, 0x75, 0x61, 0x6c, 0x2e, 0x6c, 0x69, 0x67,
-    0x61, 0x0f, 0x6c, 0x65, 0x73, 0x73, 0x5f, 0x65,
-    0x71, 0x75, 0x61, 0x6c, 0x2e, 0x6c, 0x69, 0x67,
-    0x61, 0x12, 0x67, 0x72, 0x65, 0x61, 0x74, 0x65,
-    0x72, 0x5f, 0x65, 0x71, 0x75, 0x61, 0x6c, 0x2e,
-    0x6c, 0x69, 0x67, 0x61, 0x16, 0x65, 0x71, 0x75,
-    0x61, 0x6c, 0x5f, 0x63, 0x6f, 0x6c, 0x6f, 0x6e,
-    0x5f, 0x65, 0x71, 0x75, 0x61, 0x6c, 0x2e, 0x6c,
-    0x69, 0x67, 0x61, 0x17, 0x65, 0x78, 0x63, 0x6c,
-    0x61, 0x6d, 0x5f, 0x65, 0x71, 0x75, 0x61, 0x6c,
-    0x5f, 0x65, 0x71, 0x75, 0x61, 0x6c, 0x2e, 0x6c,
-    0x69, 0x67, 0x61, 0x18, 0x61, 0x6d, 0x70, 0x65,
-    0x72, 0x73, 0x61, 0x6e, 0x64, 0x5f, 0x61, 0x6d,
-    0x70, 0x65, 0x72, 0x73, 0x61, 0x6e, 0x64, 0x2e,
-    0x6c, 0x69, 0x67, 0x61, 0x0c, 0x62, 0x61, 0x72,
-    0x5f, 0x62, 0x61, 0x72, 0x2e, 0x6c, 0x69, 0x67,
-    0x61, 0x19, 0x70, 0x65, 0x72, 0x69, 0x6f, 0x64,
-    0x5f, 0x70, 0x65, 0x72, 0x69, 0x6f, 0x64, 0x5f,
-    0x70, 0x65, 0x72, 0x69, 0x6f, 0x64, 0x2e, 0x6c,
-    0x69, 0x67, 0x61, 0x12, 0x70, 0x65, 0x72, 0x69,
-    0x6f, 0x64, 0x5f, 0x70, 0x65, 0x72, 0x69, 0x6f,
-    0x64, 0x2e, 0x6c, 0x69, 0x67, 0x61, 0x04, 0x45,
-    0x75, 0x72, 0x6f, 0x0d, 0x55, 0x68, 0x75, 0x6e,
-    0x67, 0x61, 0x72, 0x75, 0x6d, 0x6c, 0x61, 0x75,
-    0x74, 0x0d, 0x75, 0x68, 0x75, 0x6e, 0x67, 0x61,
-    0x72, 0x75, 0x6d, 0x6c, 0x61, 0x75, 0x74, 0x07,
-    0x55, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x07,
-    0x75, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x06,
-    0x44, 0x63, 0x72, 0x6f, 0x61, 0x74, 0x07, 0x41,
-    0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x07, 0x61,
-    0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x06, 0x41,
-    0x62, 0x72, 0x65, 0x76, 0x65, 0x06, 0x61, 0x62,
-    0x72, 0x65, 0x76, 0x65, 0x07, 0x41, 0x6f, 0x67,
-    0x6f, 0x6e, 0x65, 0x6b, 0x07, 0x61, 0x6f, 0x67,
-    0x6f, 0x6e, 0x65, 0x6b, 0x0b, 0x43, 0x63, 0x69,
-    0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78,
-    0x0b, 0x63, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d,
-    0x66, 0x6c, 0x65, 0x78, 0x0a, 0x43, 0x64, 0x6f,
-    0x74, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x0a,
-    0x63, 0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65,
-    0x6e, 0x74, 0x06, 0x44, 0x63, 0x61, 0x72, 0x6f,
-    0x6e, 0x06, 0x64, 0x63, 0x61, 0x72, 0x6f, 0x6e,
-    0x07, 0x45, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e,
-    0x07, 0x65, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e,
-    0x06, 0x45, 0x62, 0x72, 0x65, 0x76, 0x65, 0x06,
-    0x65, 0x62, 0x72, 0x65, 0x76, 0x65, 0x0a, 0x45,
-    0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e,
-    0x74, 0x0a, 0x65, 0x64, 0x6f, 0x74, 0x61, 0x63,
-    0x63, 0x65, 0x6e, 0x74, 0x07, 0x45, 0x6f, 0x67,
-    0x6f, 0x6e, 0x65, 0x6b, 0x07, 0x65, 0x6f, 0x67,
-    0x6f, 0x6e, 0x65, 0x6b, 0x06, 0x45, 0x63, 0x61,
-    0x72, 0x6f, 0x6e, 0x06, 0x65, 0x63, 0x61, 0x72,
-    0x6f, 0x6e, 0x0b, 0x47, 0x63, 0x69, 0x72, 0x63,
-    0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0b, 0x67,
-    0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c,
-    0x65, 0x78, 0x0a, 0x47, 0x64, 0x6f, 0x74, 0x61,
-    0x63, 0x63, 0x65, 0x6e, 0x74, 0x0a, 0x67, 0x64,
-    0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74,
-    0x0b, 0x48, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d,
-    0x66, 0x6c, 0x65, 0x78, 0x0b, 0x68, 0x63, 0x69,
-    0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78,
-    0x06, 0x49, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x06,
-    0x69, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x07, 0x49,
-    0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x07, 0x69,
-    0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x07, 0x49,
-    0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x07, 0x69,
-    0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x06, 0x4e,
-    0x61, 0x63, 0x75, 0x74, 0x65, 0x06, 0x6e, 0x61,
-    0x63, 0x75, 0x74, 0x65, 0x06, 0x4e, 0x63, 0x61,
-    0x72, 0x6f, 0x6e, 0x06, 0x6e, 0x63, 0x61, 0x72,
-    0x6f, 0x6e, 0x07, 0x4f, 0x6d, 0x61, 0x63, 0x72,
-    0x6f, 0x6e, 0x07, 0x6f, 0x6d, 0x61, 0x63, 0x72,
-    0x6f, 0x6e, 0x06, 0x4f, 0x62, 0x72, 0x65, 0x76,
-    0x65, 0x06, 0x6f, 0x62, 0x72, 0x65, 0x76, 0x65,
-    0x0d, 0x4f, 0x68, 0x75, 0x6e, 0x67, 0x61, 0x72,
-    0x75, 0x6d, 0x6c, 0x61, 0x75, 0x74, 0x0d, 0x6f,
-    0x68, 0x75, 0x6e, 0x67, 0x61, 0x72, 0x75, 0x6d,
-    0x6c, 0x61, 0x75, 0x74, 0x06, 0x52, 0x61, 0x63,
-    0x75, 0x74, 0x65, 0x06, 0x72, 0x61, 0x63, 0x75,
-    0x74, 0x65, 0x06, 0x52, 0x63, 0x61, 0x72, 0x6f,
-    0x6e, 0x06, 0x72, 0x63, 0x61, 0x72, 0x6f, 0x6e,
-    0x06, 0x53, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06,
-    0x73, 0x61, 0x63, 0x75, 0x74, 0x65, 0x0b, 0x53,
-    0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c,
-    0x65, 0x78, 0x0b, 0x73, 0x63, 0x69, 0x72, 0x63,
-    0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x06, 0x54,
-    0x63, 0x61, 0x72, 0x6f, 0x6e, 0x06, 0x55, 0x74,
-    0x69, 0x6c, 0x64, 0x65, 0x06, 0x75, 0x74, 0x69,
-    0x6c, 0x64, 0x65, 0x07, 0x55, 0x6d, 0x61, 0x63,
-    0x72, 0x6f, 0x6e, 0x07, 0x75, 0x6d, 0x61, 0x63,
-    0x72, 0x6f, 0x6e, 0x06, 0x55, 0x62, 0x72, 0x65,
-    0x76, 0x65, 0x06, 0x75, 0x62, 0x72, 0x65, 0x76,
-    0x65, 0x05, 0x55, 0x72, 0x69, 0x6e, 0x67, 0x05,
-    0x75, 0x72, 0x69, 0x6e, 0x67, 0x0b, 0x57, 0x63,
-    0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65,
-    0x78, 0x0b, 0x77, 0x63, 0x69, 0x72, 0x63, 0x75,
-    0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0b, 0x59, 0x63,
-    0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65,
-    0x78, 0x0b, 0x79, 0x63, 0x69, 0x72, 0x63, 0x75,
-    0x6d, 0x66, 0x6c, 0x65, 0x78, 0x06, 0x5a, 0x61,
-    0x63, 0x75, 0x74, 0x65, 0x06, 0x7a, 0x61, 0x63,
-    0x75, 0x74, 0x65, 0x0a, 0x5a, 0x64, 0x6f, 0x74,
-    0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x0a, 0x7a,
-    0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e,
-    0x74, 0x06, 0x57, 0x67, 0x72, 0x61, 0x76, 0x65,
-    0x06, 0x77, 0x67, 0x72, 0x61, 0x76, 0x65, 0x06,
-    0x57, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06, 0x77,
-    0x61, 0x63, 0x75, 0x74, 0x65, 0x09, 0x57, 0x64,
-    0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x09,
-    0x77, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69,
-    0x73, 0x0a, 0x67, 0x72, 0x61, 0x76, 0x65, 0x2e,
-    0x63, 0x61, 0x73, 0x65, 0x0d, 0x64, 0x69, 0x65,
-    0x72, 0x65, 0x73, 0x69, 0x73, 0x2e, 0x63, 0x61,
-    0x73, 0x65, 0x0b, 0x6d, 0x61, 0x63, 0x72, 0x6f,
-    0x6e, 0x2e, 0x63, 0x61, 0x73, 0x65, 0x0a, 0x61,
-    0x63, 0x75, 0x74, 0x65, 0x2e, 0x63, 0x61, 0x73,
-    0x65, 0x0f, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d,
-    0x66, 0x6c, 0x65, 0x78, 0x2e, 0x63, 0x61, 0x73,
-    0x65, 0x0a, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x2e,
-    0x63, 0x61, 0x73, 0x65, 0x0a, 0x62, 0x72, 0x65,
-    0x76, 0x65, 0x2e, 0x63, 0x61, 0x73, 0x65, 0x0e,
-    0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e,
-    0x74, 0x2e, 0x63, 0x61, 0x73, 0x65, 0x09, 0x72,
-    0x69, 0x6e, 0x67, 0x2e, 0x63, 0x61, 0x73, 0x65,
-    0x0a, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x2e, 0x63,
-    0x61, 0x73, 0x65, 0x11, 0x68, 0x75, 0x6e, 0x67,
-    0x61, 0x72, 0x75, 0x6d, 0x6c, 0x61, 0x75, 0x74,
-    0x2e, 0x63, 0x61, 0x73, 0x65, 0x0a, 0x63, 0x61,
-    0x72, 0x6f, 0x6e, 0x2e, 0x73, 0x61, 0x6c, 0x74,
-    0x0b, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63,
-    0x63, 0x65, 0x6e, 0x74, 0x10, 0x63, 0x6f, 0x6d,
-    0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74,
-    0x2e, 0x73, 0x61, 0x6c, 0x74, 0x04, 0x4c, 0x64,
-    0x6f, 0x74, 0x04, 0x6c, 0x64, 0x6f, 0x74, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x32, 0x31, 0x42, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x31, 0x33, 0x42, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x32, 0x31, 0x39, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x31, 0x34, 0x36, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x32, 0x31, 0x41, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x31, 0x34, 0x35, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x31, 0x33, 0x36, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x31, 0x33, 0x37, 0x07,
-    0x75, 0x6e, 0x69, 0x30, 0x31, 0x32, 0x32, 0x06,
-    0x6c, 0x61, 0x63, 0x75, 0x74, 0x65, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x31, 0x33, 0x43, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x31, 0x35, 0x37, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x31, 0x35, 0x36, 0x06, 0x4c,
-    0x63, 0x61, 0x72, 0x6f, 0x6e, 0x06, 0x6c, 0x63,
-    0x61, 0x72, 0x6f, 0x6e, 0x04, 0x54, 0x62, 0x61,
-    0x72, 0x04, 0x74, 0x62, 0x61, 0x72, 0x04, 0x68,
-    0x62, 0x61, 0x72, 0x06, 0x4c, 0x61, 0x63, 0x75,
-    0x74, 0x65, 0x0b, 0x6e, 0x61, 0x70, 0x6f, 0x73,
-    0x74, 0x72, 0x6f, 0x70, 0x68, 0x65, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x32, 0x31, 0x38, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x32, 0x33, 0x37, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x31, 0x36, 0x32, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x31, 0x36, 0x33, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x31, 0x32, 0x33, 0x04, 0x48,
-    0x62, 0x61, 0x72, 0x0b, 0x4a, 0x63, 0x69, 0x72,
-    0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0b,
-    0x6a, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66,
-    0x6c, 0x65, 0x78, 0x06, 0x74, 0x63, 0x61, 0x72,
-    0x6f, 0x6e, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30,
-    0x37, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30,
-    0x37, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30,
-    0x38, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30,
-    0x38, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30,
-    0x38, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30,
-    0x38, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30,
-    0x38, 0x34, 0x0c, 0x6b, 0x67, 0x72, 0x65, 0x65,
-    0x6e, 0x6c, 0x61, 0x6e, 0x64, 0x69, 0x63, 0x06,
-    0x69, 0x62, 0x72, 0x65, 0x76, 0x65, 0x06, 0x49,
-    0x62, 0x72, 0x65, 0x76, 0x65, 0x05, 0x6c, 0x6f,
-    0x6e, 0x67, 0x73, 0x03, 0x65, 0x6e, 0x67, 0x03,
-    0x45, 0x6e, 0x67, 0x10, 0x62, 0x61, 0x72, 0x5f,
-    0x62, 0x61, 0x72, 0x5f, 0x62, 0x61, 0x72, 0x2e,
-    0x6c, 0x69, 0x67, 0x61, 0x16, 0x73, 0x6c, 0x61,
-    0x73, 0x68, 0x5f, 0x73, 0x6c, 0x61, 0x73, 0x68,
-    0x5f, 0x73, 0x6c, 0x61, 0x73, 0x68, 0x2e, 0x6c,
-    0x69, 0x67, 0x61, 0x22, 0x61, 0x6d, 0x70, 0x65,
-    0x72, 0x73, 0x61, 0x6e, 0x64, 0x5f, 0x61, 0x6d,
-    0x70, 0x65, 0x72, 0x73, 0x61, 0x6e, 0x64, 0x5f,
-    0x61, 0x6d, 0x70, 0x65, 0x72, 0x73, 0x61, 0x6e,
-    0x64, 0x2e, 0x6c, 0x69, 0x67, 0x61, 0x16, 0x65,
-    0x71, 0x75, 0x61, 0x6c, 0x5f, 0x65, 0x71, 0x75,
-    0x61, 0x6c, 0x5f, 0x65, 0x71, 0x75, 0x61, 0x6c,
-    0x2e, 0x6c, 0x69, 0x67, 0x61, 0x0e, 0x70, 0x6c,
-    0x75, 0x73, 0x5f, 0x70, 0x6c, 0x75, 0x73, 0x2e,
-    0x6c, 0x69, 0x67, 0x61, 0x12, 0x68, 0x79, 0x70,
-    0x68, 0x65, 0x6e, 0x5f, 0x68, 0x79, 0x70, 0x68,
-    0x65, 0x6e, 0x2e, 0x6c, 0x69, 0x67, 0x61, 0x12,
-    0x65, 0x71, 0x75, 0x61, 0x6c, 0x5f, 0x67, 0x72,
-    0x65, 0x61, 0x74, 0x65, 0x72, 0x2e, 0x6c, 0x69,
-    0x67, 0x61, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x31, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x31, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x31, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x31, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x32, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x32, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x31, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x31, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x31, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x32, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x33, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x33, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x33, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x34, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x34, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x34, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x34, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x31, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x31, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x31, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x32, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x31, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x31, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x32, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x32, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x32, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x31, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x31, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x30, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x35, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x35, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x32, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x32, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x32, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x32, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x32, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x32, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x31, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x31, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x32, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x32, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x32, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x33, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x35, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x33, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x34, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x33, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x33, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x33, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x33, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x33, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x33, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x34, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x33, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x34, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x33, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x33, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x34, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x34, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x34, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x34, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x34, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x34, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x34, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x34, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x34, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x33, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x33, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x30, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x30, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x30, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x30, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x35, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x35, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x39, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x39, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x30, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x35, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x30, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x35, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x30, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x35, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x30, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x35, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x30, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x35, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x30, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x35, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x35, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x30, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x35, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x35, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x30, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x34,
-    0x30, 0x32, 0x02, 0x69, 0x6a, 0x02, 0x49, 0x4a,
-    0x10, 0x62, 0x61, 0x72, 0x5f, 0x67, 0x72, 0x65,
-    0x61, 0x74, 0x65, 0x72, 0x2e, 0x6c, 0x69, 0x67,
-    0x61, 0x0d, 0x6c, 0x65, 0x73, 0x73, 0x5f, 0x62,
-    0x61, 0x72, 0x2e, 0x6c, 0x69, 0x67, 0x61, 0x14,
-    0x62, 0x61, 0x72, 0x5f, 0x62, 0x61, 0x72, 0x5f,
-    0x67, 0x72, 0x65, 0x61, 0x74, 0x65, 0x72, 0x2e,
-    0x6c, 0x69, 0x67, 0x61, 0x11, 0x6c, 0x65, 0x73,
-    0x73, 0x5f, 0x62, 0x61, 0x72, 0x5f, 0x62, 0x61,
-    0x72, 0x2e, 0x6c, 0x69, 0x67, 0x61, 0x18, 0x62,
-    0x61, 0x72, 0x5f, 0x62, 0x61, 0x72, 0x5f, 0x62,
-    0x61, 0x72, 0x5f, 0x67, 0x72, 0x65, 0x61, 0x74,
-    0x65, 0x72, 0x2e, 0x6c, 0x69, 0x67, 0x61, 0x15,
-    0x6c, 0x65, 0x73, 0x73, 0x5f, 0x62, 0x61, 0x72,
-    0x5f, 0x62, 0x61, 0x72, 0x5f, 0x62, 0x61, 0x72,
-    0x2e, 0x6c, 0x69, 0x67, 0x61, 0x14, 0x67, 0x72,
-    0x65, 0x61, 0x74, 0x65, 0x72, 0x5f, 0x67, 0x72,
-    0x65, 0x61, 0x74, 0x65, 0x72, 0x2e, 0x6c, 0x69,
-    0x67, 0x61, 0x0e, 0x6c, 0x65, 0x73, 0x73, 0x5f,
-    0x6c, 0x65, 0x73, 0x73, 0x2e, 0x6c, 0x69, 0x67,
-    0x61, 0x05, 0x61, 0x2e, 0x61, 0x6c, 0x74, 0x03,
-    0x53, 0x50, 0x43, 0x16, 0x63, 0x6f, 0x6c, 0x6f,
-    0x6e, 0x5f, 0x63, 0x6f, 0x6c, 0x6f, 0x6e, 0x5f,
-    0x65, 0x71, 0x75, 0x61, 0x6c, 0x2e, 0x6c, 0x69,
-    0x67, 0x61, 0x15, 0x62, 0x61, 0x72, 0x5f, 0x62,
-    0x72, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x72, 0x69,
-    0x67, 0x68, 0x74, 0x2e, 0x6c, 0x69, 0x67, 0x61,
-    0x14, 0x62, 0x72, 0x61, 0x63, 0x6b, 0x65, 0x74,
-    0x6c, 0x65, 0x66, 0x74, 0x5f, 0x62, 0x61, 0x72,
-    0x2e, 0x6c, 0x69, 0x67, 0x61, 0x12, 0x62, 0x72,
-    0x61, 0x63, 0x65, 0x6c, 0x65, 0x66, 0x74, 0x5f,
-    0x62, 0x61, 0x72, 0x2e, 0x6c, 0x69, 0x67, 0x61,
-    0x13, 0x62, 0x61, 0x72, 0x5f, 0x62, 0x72, 0x61,
-    0x63, 0x65, 0x72, 0x69, 0x67, 0x68, 0x74, 0x2e,
-    0x6c, 0x69, 0x67, 0x61, 0x15, 0x62, 0x72, 0x61,
-    0x63, 0x6b, 0x65, 0x74, 0x6c, 0x65, 0x66, 0x74,
-    0x5f, 0x6c, 0x65, 0x73, 0x73, 0x2e, 0x6c, 0x69,
-    0x67, 0x61, 0x19, 0x67, 0x72, 0x65, 0x61, 0x74,
-    0x65, 0x72, 0x5f, 0x62, 0x72, 0x61, 0x63, 0x6b,
-    0x65, 0x74, 0x72, 0x69, 0x67, 0x68, 0x74, 0x2e,
-    0x6c, 0x69, 0x67, 0x61, 0x1b, 0x63, 0x6f, 0x6c,
-    0x6f, 0x6e, 0x5f, 0x71, 0x75, 0x65, 0x73, 0x74,
-    0x69, 0x6f, 0x6e, 0x5f, 0x67, 0x72, 0x65, 0x61,
-    0x74, 0x65, 0x72, 0x2e, 0x6c, 0x69, 0x67, 0x61,
-    0x13, 0x63, 0x6f, 0x6c, 0x6f, 0x6e, 0x5f, 0x71,
-    0x75, 0x65, 0x73, 0x74, 0x69, 0x6f, 0x6e, 0x2e,
-    0x6c, 0x69, 0x67, 0x61, 0x08, 0x7a, 0x65, 0x72,
-    0x6f, 0x2e, 0x61, 0x6c, 0x74, 0x10, 0x73, 0x6c,
-    0x61, 0x73, 0x68, 0x5f, 0x65, 0x71, 0x75, 0x61,
-    0x6c, 0x2e, 0x6c, 0x69, 0x67, 0x61, 0x25, 0x62,
-    0x72, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x6c, 0x65,
-    0x66, 0x74, 0x5f, 0x62, 0x61, 0x72, 0x5f, 0x62,
-    0x61, 0x72, 0x5f, 0x62, 0x72, 0x61, 0x63, 0x6b,
-    0x65, 0x74, 0x72, 0x69, 0x67, 0x68, 0x74, 0x2e,
-    0x6c, 0x69, 0x67, 0x61, 0x07, 0x75, 0x6e, 0x69,
-    0x30, 0x33, 0x42, 0x43, 0x07, 0x75, 0x6e, 0x69,
-    0x32, 0x31, 0x31, 0x33, 0x09, 0x65, 0x73, 0x74,
-    0x69, 0x6d, 0x61, 0x74, 0x65, 0x64, 0x12, 0x65,
-    0x78, 0x63, 0x6c, 0x61, 0x6d, 0x5f, 0x65, 0x78,
-    0x63, 0x6c, 0x61, 0x6d, 0x2e, 0x6c, 0x69, 0x67,
-    0x61, 0x13, 0x71, 0x75, 0x65, 0x73, 0x74, 0x69,
-    0x6f, 0x6e, 0x5f, 0x63, 0x6f, 0x6c, 0x6f, 0x6e,
-    0x2e, 0x6c, 0x69, 0x67, 0x61, 0x14, 0x71, 0x75,
-    0x65, 0x73, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x70,
-    0x65, 0x72, 0x69, 0x6f, 0x64, 0x2e, 0x6c, 0x69,
-    0x67, 0x61, 0x10, 0x63, 0x6f, 0x6c, 0x6f, 0x6e,
-    0x5f, 0x63, 0x6f, 0x6c, 0x6f, 0x6e, 0x2e, 0x6c,
-    0x69, 0x67, 0x61, 0x13, 0x70, 0x6c, 0x75, 0x73,
-    0x5f, 0x70, 0x6c, 0x75, 0x73, 0x5f, 0x70, 0x6c,
-    0x75, 0x73, 0x2e, 0x6c, 0x69, 0x67, 0x61, 0x16,
-    0x71, 0x75, 0x65, 0x73, 0x74, 0x69, 0x6f, 0x6e,
-    0x5f, 0x71, 0x75, 0x65, 0x73, 0x74, 0x69, 0x6f,
-    0x6e, 0x2e, 0x6c, 0x69, 0x67, 0x61, 0x25, 0x6e,
-    0x75, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x69, 0x67,
-    0x6e, 0x5f, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72,
-    0x73, 0x69, 0x67, 0x6e, 0x5f, 0x6e, 0x75, 0x6d,
-    0x62, 0x65, 0x72, 0x73, 0x69, 0x67, 0x6e, 0x2e,
-    0x6c, 0x69, 0x67, 0x61, 0x1a, 0x6e, 0x75, 0x6d,
-    0x62, 0x65, 0x72, 0x73, 0x69, 0x67, 0x6e, 0x5f,
-    0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x69,
-    0x67, 0x6e, 0x2e, 0x6c, 0x69, 0x67, 0x61, 0x16,
-    0x63, 0x6f, 0x6c, 0x6f, 0x6e, 0x5f, 0x63, 0x6f,
-    0x6c, 0x6f, 0x6e, 0x5f, 0x63, 0x6f, 0x6c, 0x6f,
-    0x6e, 0x2e, 0x6c, 0x69, 0x67, 0x61, 0x30, 0x6e,
-    0x75, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x69, 0x67,
-    0x6e, 0x5f, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72,
-    0x73, 0x69, 0x67, 0x6e, 0x5f, 0x6e, 0x75, 0x6d,
-    0x62, 0x65, 0x72, 0x73, 0x69, 0x67, 0x6e, 0x5f,
-    0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x69,
-    0x67, 0x6e, 0x2e, 0x6c, 0x69, 0x67, 0x61, 0x14,
-    0x70, 0x65, 0x72, 0x69, 0x6f, 0x64, 0x5f, 0x71,
-    0x75, 0x65, 0x73, 0x74, 0x69, 0x6f, 0x6e, 0x2e,
-    0x6c, 0x69, 0x67, 0x61, 0x13, 0x71, 0x75, 0x65,
-    0x73, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x65, 0x71,
-    0x75, 0x61, 0x6c, 0x2e, 0x6c, 0x69, 0x67, 0x61,
-    0x17, 0x65, 0x71, 0x75, 0x61, 0x6c, 0x5f, 0x65,
-    0x78, 0x63, 0x6c, 0x61, 0x6d, 0x5f, 0x65, 0x71,
-    0x75, 0x61, 0x6c, 0x2e, 0x6c, 0x69, 0x67, 0x61,
-    0x15, 0x6c, 0x65, 0x73, 0x73, 0x5f, 0x62, 0x61,
-    0x72, 0x5f, 0x67, 0x72, 0x65, 0x61, 0x74, 0x65,
-    0x72, 0x2e, 0x6c, 0x69, 0x67, 0x61, 0x0f, 0x6c,
-    0x65, 0x73, 0x73, 0x5f, 0x63, 0x6f, 0x6c, 0x6f,
-    0x6e, 0x2e, 0x6c, 0x69, 0x67, 0x61, 0x0f, 0x63,
-    0x6f, 0x6c, 0x6f, 0x6e, 0x5f, 0x6c, 0x65, 0x73,
-    0x73, 0x2e, 0x6c, 0x69, 0x67, 0x61, 0x12, 0x63,
-    0x6f, 0x6c, 0x6f, 0x6e, 0x5f, 0x67, 0x72, 0x65,
-    0x61, 0x74, 0x65, 0x72, 0x2e, 0x6c, 0x69, 0x67,
-    0x61, 0x12, 0x67, 0x72, 0x65, 0x61, 0x74, 0x65,
-    0x72, 0x5f, 0x63, 0x6f, 0x6c, 0x6f, 0x6e, 0x2e,
-    0x6c, 0x69, 0x67, 0x61, 0x11, 0x6c, 0x65, 0x73,
-    0x73, 0x5f, 0x67, 0x72, 0x65, 0x61, 0x74, 0x65,
-    0x72, 0x2e, 0x6c, 0x69, 0x67, 0x61, 0x1f, 0x61,
-    0x73, 0x74, 0x65, 0x72, 0x69, 0x73, 0x6b, 0x5f,
-    0x61, 0x73, 0x74, 0x65, 0x72, 0x69, 0x73, 0x6b,
-    0x5f, 0x61, 0x73, 0x74, 0x65, 0x72, 0x69, 0x73,
-    0x6b, 0x2e, 0x6c, 0x69, 0x67, 0x61, 0x18, 0x73,
-    0x65, 0x6d, 0x69, 0x63, 0x6f, 0x6c, 0x6f, 0x6e,
-    0x5f, 0x73, 0x65, 0x6d, 0x69, 0x63, 0x6f, 0x6c,
-    0x6f, 0x6e, 0x2e, 0x6c, 0x69, 0x67, 0x61, 0x16,
-    0x73, 0x6c, 0x61, 0x73, 0x68, 0x5f, 0x65, 0x71,
-    0x75, 0x61, 0x6c, 0x5f, 0x65, 0x71, 0x75, 0x61,
-    0x6c, 0x2e, 0x6c, 0x69, 0x67, 0x61, 0x07, 0x75,
-    0x6e, 0x69, 0x32, 0x32, 0x31, 0x35, 0x07, 0x75,
-    0x6e, 0x69, 0x32, 0x32, 0x31, 0x39, 0x07, 0x75,
-    0x6e, 0x69, 0x30, 0x32, 0x43, 0x39, 0x11, 0x70,
-    0x65, 0x72, 0x69, 0x6f, 0x64, 0x5f, 0x65, 0x71,
-    0x75, 0x61, 0x6c, 0x2e, 0x6c, 0x69, 0x67, 0x61,
-    0x12, 0x70, 0x65, 0x72, 0x69, 0x6f, 0x64, 0x5f,
-    0x68, 0x79, 0x70, 0x68, 0x65, 0x6e, 0x2e, 0x6c,
-    0x69, 0x67, 0x61, 0x1a, 0x75, 0x6e, 0x64, 0x65,
-    0x72, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x5f, 0x75,
-    0x6e, 0x64, 0x65, 0x72, 0x73, 0x63, 0x6f, 0x72,
-    0x65, 0x2e, 0x6c, 0x69, 0x67, 0x61, 0x16, 0x65,
-    0x71, 0x75, 0x61, 0x6c, 0x5f, 0x73, 0x6c, 0x61,
-    0x73, 0x68, 0x5f, 0x65, 0x71, 0x75, 0x61, 0x6c,
-    0x2e, 0x6c, 0x69, 0x67, 0x61, 0x15, 0x6c, 0x65,
-    0x73, 0x73, 0x5f, 0x68, 0x79, 0x70, 0x68, 0x65,
-    0x6e, 0x5f, 0x6c, 0x65, 0x73, 0x73, 0x2e, 0x6c,
-    0x69, 0x67, 0x61, 0x13, 0x6c, 0x65, 0x73, 0x73,
-    0x5f, 0x6c, 0x65, 0x73, 0x73, 0x5f, 0x6c, 0x65,
-    0x73, 0x73, 0x2e, 0x6c, 0x69, 0x67, 0x61, 0x1c,
-    0x67, 0x72, 0x65, 0x61, 0x74, 0x65, 0x72, 0x5f,
-    0x67, 0x72, 0x65, 0x61, 0x74, 0x65, 0x72, 0x5f,
-    0x67, 0x72, 0x65, 0x61, 0x74, 0x65, 0x72, 0x2e,
-    0x6c, 0x69, 0x67, 0x61, 0x14, 0x6c, 0x65, 0x73,
-    0x73, 0x5f, 0x65, 0x71, 0x75, 0x61, 0x6c, 0x5f,
-    0x6c, 0x65, 0x73, 0x73, 0x2e, 0x6c, 0x69, 0x67,
-    0x61, 0x14, 0x6c, 0x65, 0x73, 0x73, 0x5f, 0x6c,
-    0x65, 0x73, 0x73, 0x5f, 0x65, 0x71, 0x75, 0x61,
-    0x6c, 0x2e, 0x6c, 0x69, 0x67, 0x61, 0x15, 0x6c,
-    0x65, 0x73, 0x73, 0x5f, 0x65, 0x71, 0x75, 0x61,
-    0x6c, 0x5f, 0x65, 0x71, 0x75, 0x61, 0x6c, 0x2e,
-    0x6c, 0x69, 0x67, 0x61, 0x1d, 0x6c, 0x65, 0x73,
-    0x73, 0x5f, 0x65, 0x71, 0x75, 0x61, 0x6c, 0x5f,
-    0x65, 0x71, 0x75, 0x61, 0x6c, 0x5f, 0x67, 0x72,
-    0x65, 0x61, 0x74, 0x65, 0x72, 0x2e, 0x6c, 0x69,
-    0x67, 0x61, 0x18, 0x65, 0x71, 0x75, 0x61, 0x6c,
-    0x5f, 0x65, 0x71, 0x75, 0x61, 0x6c, 0x5f, 0x67,
-    0x72, 0x65, 0x61, 0x74, 0x65, 0x72, 0x2e, 0x6c,
-    0x69, 0x67, 0x61, 0x1a, 0x65, 0x71, 0x75, 0x61,
-    0x6c, 0x5f, 0x67, 0x72, 0x65, 0x61, 0x74, 0x65,
-    0x72, 0x5f, 0x67, 0x72, 0x65, 0x61, 0x74, 0x65,
-    0x72, 0x2e, 0x6c, 0x69, 0x67, 0x61, 0x1a, 0x67,
-    0x72, 0x65, 0x61, 0x74, 0x65, 0x72, 0x5f, 0x65,
-    0x71, 0x75, 0x61, 0x6c, 0x5f, 0x67, 0x72, 0x65,
-    0x61, 0x74, 0x65, 0x72, 0x2e, 0x6c, 0x69, 0x67,
-    0x61, 0x1a, 0x67, 0x72, 0x65, 0x61, 0x74, 0x65,
-    0x72, 0x5f, 0x67, 0x72, 0x65, 0x61, 0x74, 0x65,
-    0x72, 0x5f, 0x65, 0x71, 0x75, 0x61, 0x6c, 0x2e,
-    0x6c, 0x69, 0x67, 0x61, 0x1b, 0x67, 0x72, 0x65,
-    0x61, 0x74, 0x65, 0x72, 0x5f, 0x67, 0x72, 0x65,
-    0x61, 0x74, 0x65, 0x72, 0x5f, 0x68, 0x79, 0x70,
-    0x68, 0x65, 0x6e, 0x2e, 0x6c, 0x69, 0x67, 0x61,
-    0x13, 0x67, 0x72, 0x65, 0x61, 0x74, 0x65, 0x72,
-    0x5f, 0x68, 0x79, 0x70, 0x68, 0x65, 0x6e, 0x2e,
-    0x6c, 0x69, 0x67, 0x61, 0x1c, 0x6c, 0x65, 0x73,
-    0x73, 0x5f, 0x61, 0x73, 0x63, 0x69, 0x69, 0x74,
-    0x69, 0x6c, 0x64, 0x65, 0x5f, 0x67, 0x72, 0x65,
-    0x61, 0x74, 0x65, 0x72, 0x2e, 0x6c, 0x69, 0x67,
-    0x61, 0x10, 0x68, 0x79, 0x70, 0x68, 0x65, 0x6e,
-    0x5f, 0x6c, 0x65, 0x73, 0x73, 0x2e, 0x6c, 0x69,
-    0x67, 0x61, 0x15, 0x68, 0x79, 0x70, 0x68, 0x65,
-    0x6e, 0x5f, 0x6c, 0x65, 0x73, 0x73, 0x5f, 0x6c,
-    0x65, 0x73, 0x73, 0x2e, 0x6c, 0x69, 0x67, 0x61,
-    0x14, 0x65, 0x71, 0x75, 0x61, 0x6c, 0x5f, 0x6c,
-    0x65, 0x73, 0x73, 0x5f, 0x6c, 0x65, 0x73, 0x73,
-    0x2e, 0x6c, 0x69, 0x67, 0x61, 0x19, 0x68, 0x79,
-    0x70, 0x68, 0x65, 0x6e, 0x5f, 0x68, 0x79, 0x70,
-    0x68, 0x65, 0x6e, 0x5f, 0x68, 0x79, 0x70, 0x68,
-    0x65, 0x6e, 0x2e, 0x6c, 0x69, 0x67, 0x61, 0x14,
-    0x6c, 0x65, 0x73, 0x73, 0x5f, 0x68, 0x79, 0x70,
-    0x68, 0x65, 0x6e, 0x5f, 0x62, 0x61, 0x72, 0x2e,
-    0x6c, 0x69, 0x67, 0x61, 0x13, 0x6c, 0x65, 0x73,
-    0x73, 0x5f, 0x65, 0x71, 0x75, 0x61, 0x6c, 0x5f,
-    0x62, 0x61, 0x72, 0x2e, 0x6c, 0x69, 0x67, 0x61,
-    0x14, 0x73, 0x6c, 0x61, 0x73, 0x68, 0x5f, 0x62,
-    0x61, 0x63, 0x6b, 0x73, 0x6c, 0x61, 0x73, 0x68,
-    0x2e, 0x6c, 0x69, 0x67, 0x61, 0x14, 0x62, 0x61,
-    0x63, 0x6b, 0x73, 0x6c, 0x61, 0x73, 0x68, 0x5f,
-    0x73, 0x6c, 0x61, 0x73, 0x68, 0x2e, 0x6c, 0x69,
-    0x67, 0x61, 0x16, 0x62, 0x61, 0x72, 0x5f, 0x65,
-    0x71, 0x75, 0x61, 0x6c, 0x5f, 0x67, 0x72, 0x65,
-    0x61, 0x74, 0x65, 0x72, 0x2e, 0x6c, 0x69, 0x67,
-    0x61, 0x17, 0x62, 0x61, 0x72, 0x5f, 0x68, 0x79,
-    0x70, 0x68, 0x65, 0x6e, 0x5f, 0x67, 0x72, 0x65,
-    0x61, 0x74, 0x65, 0x72, 0x2e, 0x6c, 0x69, 0x67,
-    0x61, 0x1f, 0x6c, 0x65, 0x73, 0x73, 0x5f, 0x61,
-    0x73, 0x63, 0x69, 0x69, 0x74, 0x69, 0x6c, 0x64,
-    0x65, 0x5f, 0x61, 0x73, 0x63, 0x69, 0x69, 0x74,
-    0x69, 0x6c, 0x64, 0x65, 0x2e, 0x6c, 0x69, 0x67,
-    0x61, 0x14, 0x6c, 0x65, 0x73, 0x73, 0x5f, 0x61,
-    0x73, 0x63, 0x69, 0x69, 0x74, 0x69, 0x6c, 0x64,
-    0x65, 0x2e, 0x6c, 0x69, 0x67, 0x61, 0x1a, 0x61,
-    0x73, 0x63, 0x69, 0x69, 0x74, 0x69, 0x6c, 0x64,
-    0x65, 0x5f, 0x61, 0x73, 0x63, 0x69, 0x69, 0x74,
-    0x69, 0x6c, 0x64, 0x65, 0x2e, 0x6c, 0x69, 0x67,
-    0x61, 0x22, 0x61, 0x73, 0x63, 0x69, 0x69, 0x74,
-    0x69, 0x6c, 0x64, 0x65, 0x5f, 0x61, 0x73, 0x63,
-    0x69, 0x69, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x5f,
-    0x67, 0x72, 0x65, 0x61, 0x74, 0x65, 0x72, 0x2e,
-    0x6c, 0x69, 0x67, 0x61, 0x17, 0x61, 0x73, 0x63,
-    0x69, 0x69, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x5f,
-    0x67, 0x72, 0x65, 0x61, 0x74, 0x65, 0x72, 0x2e,
-    0x6c, 0x69, 0x67, 0x61, 0x18, 0x6c, 0x65, 0x73,
-    0x73, 0x5f, 0x64, 0x6f, 0x6c, 0x6c, 0x61, 0x72,
-    0x5f, 0x67, 0x72, 0x65, 0x61, 0x74, 0x65, 0x72,
-    0x2e, 0x6c, 0x69, 0x67, 0x61, 0x10, 0x6c, 0x65,
-    0x73, 0x73, 0x5f, 0x64, 0x6f, 0x6c, 0x6c, 0x61,
-    0x72, 0x2e, 0x6c, 0x69, 0x67, 0x61, 0x13, 0x64,
-    0x6f, 0x6c, 0x6c, 0x61, 0x72, 0x5f, 0x67, 0x72,
-    0x65, 0x61, 0x74, 0x65, 0x72, 0x2e, 0x6c, 0x69,
-    0x67, 0x61, 0x16, 0x6c, 0x65, 0x73, 0x73, 0x5f,
-    0x70, 0x6c, 0x75, 0x73, 0x5f, 0x67, 0x72, 0x65,
-    0x61, 0x74, 0x65, 0x72, 0x2e, 0x6c, 0x69, 0x67,
-    0x61, 0x0e, 0x6c, 0x65, 0x73, 0x73, 0x5f, 0x70,
-    0x6c, 0x75, 0x73, 0x2e, 0x6c, 0x69, 0x67, 0x61,
-    0x11, 0x70, 0x6c, 0x75, 0x73, 0x5f, 0x67, 0x72,
-    0x65, 0x61, 0x74, 0x65, 0x72, 0x2e, 0x6c, 0x69,
-    0x67, 0x61, 0x1a, 0x6c, 0x65, 0x73, 0x73, 0x5f,
-    0x61, 0x73, 0x74, 0x65, 0x72, 0x69, 0x73, 0x6b,
-    0x5f, 0x67, 0x72, 0x65, 0x61, 0x74, 0x65, 0x72,
-    0x2e, 0x6c, 0x69, 0x67, 0x61, 0x12, 0x6c, 0x65,
-    0x73, 0x73, 0x5f, 0x61, 0x73, 0x74, 0x65, 0x72,
-    0x69, 0x73, 0x6b, 0x2e, 0x6c, 0x69, 0x67, 0x61,
-    0x15, 0x61, 0x73, 0x74, 0x65, 0x72, 0x69, 0x73,
-    0x6b, 0x5f, 0x67, 0x72, 0x65, 0x61, 0x74, 0x65,
-    0x72, 0x2e, 0x6c, 0x69, 0x67, 0x61, 0x0f, 0x6c,
-    0x65, 0x73, 0x73, 0x5f, 0x73, 0x6c, 0x61, 0x73,
-    0x68, 0x2e, 0x6c, 0x69, 0x67, 0x61, 0x17, 0x6c,
-    0x65, 0x73, 0x73, 0x5f, 0x73, 0x6c, 0x61, 0x73,
-    0x68, 0x5f, 0x67, 0x72, 0x65, 0x61, 0x74, 0x65,
-    0x72, 0x2e, 0x6c, 0x69, 0x67, 0x61, 0x12, 0x73,
-    0x6c, 0x61, 0x73, 0x68, 0x5f, 0x67, 0x72, 0x65,
-    0x61, 0x74, 0x65, 0x72, 0x2e, 0x6c, 0x69, 0x67,
-    0x61, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x36, 0x43,
-    0x34, 0x18, 0x6c, 0x65, 0x73, 0x73, 0x5f, 0x68,
-    0x79, 0x70, 0x68, 0x65, 0x6e, 0x5f, 0x67, 0x72,
-    0x65, 0x61, 0x74, 0x65, 0x72, 0x2e, 0x6c, 0x69,
-    0x67, 0x61, 0x17, 0x70, 0x65, 0x72, 0x69, 0x6f,
-    0x64, 0x5f, 0x70, 0x65, 0x72, 0x69, 0x6f, 0x64,
-    0x5f, 0x6c, 0x65, 0x73, 0x73, 0x2e, 0x6c, 0x69,
-    0x67, 0x61, 0x15, 0x61, 0x73, 0x63, 0x69, 0x69,
-    0x74, 0x69, 0x6c, 0x64, 0x65, 0x5f, 0x65, 0x71,
-    0x75, 0x61, 0x6c, 0x2e, 0x6c, 0x69, 0x67, 0x61,
-    0x16, 0x61, 0x73, 0x63, 0x69, 0x69, 0x74, 0x69,
-    0x6c, 0x64, 0x65, 0x5f, 0x68, 0x79, 0x70, 0x68,
-    0x65, 0x6e, 0x2e, 0x6c, 0x69, 0x67, 0x61, 0x16,
-    0x68, 0x79, 0x70, 0x68, 0x65, 0x6e, 0x5f, 0x61,
-    0x73, 0x63, 0x69, 0x69, 0x74, 0x69, 0x6c, 0x64,
-    0x65, 0x2e, 0x6c, 0x69, 0x67, 0x61, 0x12, 0x61,
-    0x73, 0x63, 0x69, 0x69, 0x74, 0x69, 0x6c, 0x64,
-    0x65, 0x5f, 0x61, 0x74, 0x2e, 0x6c, 0x69, 0x67,
-    0x61, 0x16, 0x61, 0x73, 0x63, 0x69, 0x69, 0x63,
-    0x69, 0x72, 0x63, 0x75, 0x6d, 0x5f, 0x65, 0x71,
-    0x75, 0x61, 0x6c, 0x2e, 0x6c, 0x69, 0x67, 0x61,
-    0x0f, 0x68, 0x79, 0x70, 0x68, 0x65, 0x6e, 0x5f,
-    0x62, 0x61, 0x72, 0x2e, 0x6c, 0x69, 0x67, 0x61,
-    0x1e, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x73, 0x63,
-    0x6f, 0x72, 0x65, 0x5f, 0x62, 0x61, 0x72, 0x5f,
-    0x75, 0x6e, 0x64, 0x65, 0x72, 0x73, 0x63, 0x6f,
-    0x72, 0x65, 0x2e, 0x6c, 0x69, 0x67, 0x61, 0x0f,
-    0x62, 0x61, 0x72, 0x5f, 0x68, 0x79, 0x70, 0x68,
-    0x65, 0x6e, 0x2e, 0x6c, 0x69, 0x67, 0x61, 0x13,
-    0x62, 0x61, 0x72, 0x5f, 0x62, 0x61, 0x72, 0x5f,
-    0x68, 0x79, 0x70, 0x68, 0x65, 0x6e, 0x2e, 0x6c,
-    0x69, 0x67, 0x61, 0x0e, 0x62, 0x61, 0x72, 0x5f,
-    0x65, 0x71, 0x75, 0x61, 0x6c, 0x2e, 0x6c, 0x69,
-    0x67, 0x61, 0x12, 0x62, 0x61, 0x72, 0x5f, 0x62,
-    0x61, 0x72, 0x5f, 0x65, 0x71, 0x75, 0x61, 0x6c,
-    0x2e, 0x6c, 0x69, 0x67, 0x61, 0x19, 0x6e, 0x75,
-    0x6d, 0x62, 0x65, 0x72, 0x73, 0x69, 0x67, 0x6e,
-    0x5f, 0x62, 0x72, 0x61, 0x63, 0x65, 0x6c, 0x65,
-    0x66, 0x74, 0x2e, 0x6c, 0x69, 0x67, 0x61, 0x1b,
-    0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x69,
-    0x67, 0x6e, 0x5f, 0x62, 0x72, 0x61, 0x63, 0x6b,
-    0x65, 0x74, 0x6c, 0x65, 0x66, 0x74, 0x2e, 0x6c,
-    0x69, 0x67, 0x61, 0x1c, 0x62, 0x72, 0x61, 0x63,
-    0x6b, 0x65, 0x74, 0x72, 0x69, 0x67, 0x68, 0x74,
-    0x5f, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x73,
-    0x69, 0x67, 0x6e, 0x2e, 0x6c, 0x69, 0x67, 0x61,
-    0x19, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x73,
-    0x69, 0x67, 0x6e, 0x5f, 0x70, 0x61, 0x72, 0x65,
-    0x6e, 0x6c, 0x65, 0x66, 0x74, 0x2e, 0x6c, 0x69,
-    0x67, 0x61, 0x18, 0x6e, 0x75, 0x6d, 0x62, 0x65,
-    0x72, 0x73, 0x69, 0x67, 0x6e, 0x5f, 0x71, 0x75,
-    0x65, 0x73, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x6c,
-    0x69, 0x67, 0x61, 0x1a, 0x6e, 0x75, 0x6d, 0x62,
-    0x65, 0x72, 0x73, 0x69, 0x67, 0x6e, 0x5f, 0x75,
-    0x6e, 0x64, 0x65, 0x72, 0x73, 0x63, 0x6f, 0x72,
-    0x65, 0x2e, 0x6c, 0x69, 0x67, 0x61, 0x24, 0x6e,
-    0x75, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x69, 0x67,
-    0x6e, 0x5f, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x73,
-    0x63, 0x6f, 0x72, 0x65, 0x5f, 0x70, 0x61, 0x72,
-    0x65, 0x6e, 0x6c, 0x65, 0x66, 0x74, 0x2e, 0x6c,
-    0x69, 0x67, 0x61, 0x15, 0x6e, 0x75, 0x6d, 0x62,
-    0x65, 0x72, 0x73, 0x69, 0x67, 0x6e, 0x5f, 0x63,
-    0x6f, 0x6c, 0x6f, 0x6e, 0x2e, 0x6c, 0x69, 0x67,
-    0x61, 0x16, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72,
-    0x73, 0x69, 0x67, 0x6e, 0x5f, 0x65, 0x78, 0x63,
-    0x6c, 0x61, 0x6d, 0x2e, 0x6c, 0x69, 0x67, 0x61,
-    0x15, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x73,
-    0x69, 0x67, 0x6e, 0x5f, 0x65, 0x71, 0x75, 0x61,
-    0x6c, 0x2e, 0x6c, 0x69, 0x67, 0x61, 0x07, 0x75,
-    0x6e, 0x69, 0x32, 0x31, 0x31, 0x36, 0x14, 0x61,
-    0x6d, 0x70, 0x65, 0x72, 0x73, 0x61, 0x6e, 0x64,
-    0x5f, 0x65, 0x71, 0x75, 0x61, 0x6c, 0x2e, 0x6c,
-    0x69, 0x67, 0x61, 0x0c, 0x2e, 0x74, 0x74, 0x66,
-    0x61, 0x75, 0x74, 0x6f, 0x68, 0x69, 0x6e, 0x74,
-    0x00, 0x01, 0x00, 0x01, 0xff, 0xff, 0x00, 0x0f,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x5a,
-    0x00, 0x50, 0x00, 0x50, 0x02, 0xd0, 0x00, 0x00,
-    0x02, 0x26, 0x00, 0x00, 0xff, 0x5b, 0x03, 0xd9,
-    0xff, 0x0b, 0x02, 0xda, 0xff, 0xf6, 0x02, 0x30,
-    0xff, 0xf6, 0xff, 0x5b, 0x03, 0xd9, 0xff, 0x0b,
-    0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18,
-    0x02, 0x26, 0xff, 0xfb, 0xff, 0x5b, 0x03, 0xd9,
-    0xff, 0x0b, 0x02, 0x26, 0xff, 0xfb, 0xff, 0x5b,
-    0x03, 0xd9, 0xff, 0x0b, 0x00, 0x5a, 0x00, 0x5a,
-    0x00, 0x50, 0x00, 0x50, 0x02, 0xd0, 0x00, 0x00,
-    0x02, 0xda, 0x02, 0x26, 0x00, 0x00, 0xff, 0x5b,
-    0x03, 0xd9, 0xff, 0x0b, 0x02, 0xda, 0xff, 0xf6,
-    0x02, 0xfd, 0x02, 0x30, 0xff, 0xf6, 0xff, 0x5b,
-    0x03, 0xd9, 0xff, 0x0b, 0x00, 0x3c, 0x00, 0x3c,
-    0x00, 0x37, 0x00, 0x37, 0x01, 0x18, 0xff, 0xd3,
-    0x03, 0xd9, 0xff, 0x0b, 0x01, 0x1d, 0xff, 0xce,
-    0x03, 0xd9, 0xff, 0x0b, 0x00, 0x3c, 0x00, 0x3c,
-    0x00, 0x37, 0x00, 0x37, 0x02, 0xfd, 0x01, 0xb8,
-    0x03, 0xd9, 0xff, 0x0b, 0x03, 0x02, 0x01, 0xb3,
-    0x03, 0xd9, 0xff, 0x0b, 0xb0, 0x00, 0x2c, 0x20,
-    0xb0, 0x00, 0x55, 0x58, 0x45, 0x59, 0x20, 0x20,
-    0xb0, 0x28, 0x60, 0x66, 0x20, 0x8a, 0x55, 0x58,
-    0xb0, 0x02, 0x25, 0x61, 0xb9, 0x08, 0x00, 0x08,
-    0x00, 0x63, 0x63, 0x23, 0x62, 0x1b, 0x21, 0x21,
-    0xb0, 0x00, 0x59, 0xb0, 0x00, 0x43, 0x23, 0x44,
-    0xb2, 0x00, 0x01, 0x00, 0x43, 0x60, 0x42, 0x2d,
-    0xb0, 0x01, 0x2c, 0xb0, 0x20, 0x60, 0x66, 0x2d,
-    0xb0, 0x02, 0x2c, 0x23, 0x21, 0x23, 0x21, 0x2d,
-    0xb0, 0x03, 0x2c, 0x20, 0x64, 0xb3, 0x03, 0x14,
-    0x15, 0x00, 0x42, 0x43, 0xb0, 0x13, 0x43, 0x20,
-    0x60, 0x60, 0x42, 0xb1, 0x02, 0x14, 0x43, 0x42,
-    0xb1, 0x25, 0x03, 0x43, 0xb0, 0x02, 0x43, 0x54,
-    0x78, 0x20, 0xb0, 0x0c, 0x23, 0xb0, 0x02, 0x43,
-    0x43, 0x61, 0x64, 0xb0, 0x04, 0x50, 0x78, 0xb2,
-    0x02, 0x02, 0x02, 0x43, 0x60, 0x42, 0xb0, 0x21,
-    0x65, 0x1c, 0x21, 0xb0, 0x02, 0x43, 0x43, 0xb2,
-    0x0e, 0x15, 0x01, 0x42, 0x1c, 0x20, 0xb0, 0x02,
-    0x43, 0x23, 0x42, 0xb2, 0x13, 0x01, 0x13, 0x43,
-    0x60, 0x42, 0x23, 0xb0, 0x00, 0x50, 0x58, 0x65,
-    0x59, 0xb2, 0x16, 0x01, 0x02, 0x43, 0x60, 0x42,
-    0x2d, 0xb0, 0x04, 0x2c, 0xb0, 0x03, 0x2b, 0xb0,
-    0x15, 0x43, 0x58, 0x23, 0x21, 0x23, 0x21, 0xb0,
-    0x16, 0x43, 0x43, 0x23, 0xb0, 0x00, 0x50, 0x58,
-    0x65, 0x59, 0x1b, 0x20, 0x64, 0x20, 0xb0, 0xc0,
-    0x50, 0xb0, 0x04, 0x26, 0x5a, 0xb2, 0x28, 0x01,
-    0x0d, 0x43, 0x45, 0x63, 0x45, 0xb0, 0x06, 0x45,
-    0x58, 0x21, 0xb0, 0x03, 0x25, 0x59, 0x52, 0x5b,
-    0x58, 0x21, 0x23, 0x21, 0x1b, 0x8a, 0x58, 0x20,
-    0xb0, 0x50, 0x50, 0x58, 0x21, 0xb0, 0x40, 0x59,
-    0x1b, 0x20, 0xb0, 0x38, 0x50, 0x58, 0x21, 0xb0,
-    0x38, 0x59, 0x59, 0x20, 0xb1, 0x01, 0x0d, 0x43,
-    0x45, 0x63, 0x45, 0x61, 0x64, 0xb0, 0x28, 0x50,
-    0x58, 0x21, 0xb1, 0x01, 0x0d, 0x43, 0x45, 0x63,
-    0x45, 0x20, 0xb0, 0x30, 0x50, 0x58, 0x21, 0xb0,
-    0x30, 0x59, 0x1b, 0x20, 0xb0, 0xc0, 0x50, 0x58,
-    0x20, 0x66, 0x20, 0x8a, 0x8a, 0x61, 0x20, 0xb0,
-    0x0a, 0x50, 0x58, 0x60, 0x1b, 0x20, 0xb0, 0x20,
-    0x50, 0x58, 0x21, 0xb0, 0x0a, 0x60, 0x1b, 0x20,
-    0xb0, 0x36, 0x50, 0x58, 0x21, 0xb0, 0x36, 0x60,
-    0x1b, 0x60, 0x59, 0x59, 0x59, 0x1b, 0xb0, 0x02,
-    0x25, 0xb0, 0x0c, 0x43, 0x63, 0xb0, 0x00, 0x52,
-    0x58, 0xb0, 0x00, 0x4b, 0xb0, 0x0a, 0x50, 0x58,
-    0x21, 0xb0, 0x0c, 0x43, 0x1b, 0x4b, 0xb0, 0x1e,
-    0x50, 0x58, 0x21, 0xb0, 0x1e, 0x4b, 0x61, 0xb8,
-    0x10, 0x00, 0x63, 0xb0, 0x0c, 0x43, 0x63, 0xb8,
-    0x05, 0x00, 0x62, 0x59, 0x59, 0x64, 0x61, 0x59,
-    0xb0, 0x01, 0x2b, 0x59, 0x59, 0x23, 0xb0, 0x00,
-    0x50, 0x58, 0x65, 0x59, 0x59, 0x20, 0x64, 0xb0,
-    0x16, 0x43, 0x23, 0x42, 0x59, 0x2d, 0xb0, 0x05,
-    0x2c, 0x20, 0x45, 0x20, 0xb0, 0x04, 0x25, 0x61,
-    0x64, 0x20, 0xb0, 0x07, 0x43, 0x50, 0x58, 0xb0,
-    0x07, 0x23, 0x42, 0xb0, 0x08, 0x23, 0x42, 0x1b,
-    0x21, 0x21, 0x59, 0xb0, 0x01, 0x60, 0x2d, 0xb0,
-    0x06, 0x2c, 0x23, 0x21, 0x23, 0x21, 0xb0, 0x03,
-    0x2b, 0x20, 0x64, 0xb1, 0x07, 0x62, 0x42, 0x20,
-    0xb0, 0x08, 0x23, 0x42, 0xb0, 0x06, 0x45, 0x58,
-    0x1b, 0xb1, 0x01, 0x0d, 0x43, 0x45, 0x63, 0xb1,
-    0x01, 0x0d, 0x43, 0xb0, 0x05, 0x60, 0x45, 0x63,
-    0xb0, 0x05, 0x2a, 0x21, 0x20, 0xb0, 0x08, 0x43,
-    0x20, 0x8a, 0x20, 0x8a, 0xb0, 0x01, 0x2b, 0xb1,
-    0x30, 0x05, 0x25, 0xb0, 0x04, 0x26, 0x51, 0x58,
-    0x60, 0x50, 0x1b, 0x61, 0x52, 0x59, 0x58, 0x23,
-    0x59, 0x21, 0x59, 0x20, 0xb0, 0x40, 0x53, 0x58,
-    0xb0, 0x01, 0x2b, 0x1b, 0x21, 0xb0, 0x40, 0x59,
-    0x23, 0xb0, 0x00, 0x50, 0x58, 0x65, 0x59, 0x2d,
-    0xb0, 0x07, 0x2c, 0xb0, 0x09, 0x43, 0x2b, 0xb2,
-    0x00, 0x02, 0x00, 0x43, 0x60, 0x42, 0x2d, 0xb0,
-    0x08, 0x2c, 0xb0, 0x09, 0x23, 0x42, 0x23, 0x20,
-    0xb0, 0x00, 0x23, 0x42, 0x61, 0xb0, 0x02, 0x62,
-    0x66, 0xb0, 0x01, 0x63, 0xb0, 0x01, 0x60, 0xb0,
-    0x07, 0x2a, 0x2d, 0xb0, 0x09, 0x2c, 0x20, 0x20,
-    0x45, 0x20, 0xb0, 0x0e, 0x43, 0x63, 0xb8, 0x04,
-    0x00, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0,
-    0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60,
-    0x44, 0xb0, 0x01, 0x60, 0x2d, 0xb0, 0x0a, 0x2c,
-    0xb2, 0x09, 0x0e, 0x00, 0x43, 0x45, 0x42, 0x2a,
-    0x21, 0xb2, 0x00, 0x01, 0x00, 0x43, 0x60, 0x42,
-    0x2d, 0xb0, 0x0b, 0x2c, 0xb0, 0x00, 0x43, 0x23,
-    0x44, 0xb2, 0x00, 0x01, 0x00, 0x43, 0x60, 0x42,
-    0x2d, 0xb0, 0x0c, 0x2c, 0x20, 0x20, 0x45, 0x20,
-    0xb0, 0x01, 0x2b, 0x23, 0xb0, 0x00, 0x43, 0xb0,
-    0x04, 0x25, 0x60, 0x20, 0x45, 0x8a, 0x23, 0x61,
-    0x20, 0x64, 0x20, 0xb0, 0x20, 0x50, 0x58, 0x21,
-    0xb0, 0x00, 0x1b, 0xb0, 0x30, 0x50, 0x58, 0xb0,
-    0x20, 0x1b, 0xb0, 0x40, 0x59, 0x59, 0x23, 0xb0,
-    0x00, 0x50, 0x58, 0x65, 0x59, 0xb0, 0x03, 0x25,
-    0x23, 0x61, 0x44, 0x44, 0xb0, 0x01, 0x60, 0x2d,
-    0xb0, 0x0d, 0x2c, 0x20, 0x20, 0x45, 0x20, 0xb0,
-    0x01, 0x2b, 0x23, 0xb0, 0x00, 0x43, 0xb0, 0x04,
-    0x25, 0x60, 0x20, 0x45, 0x8a, 0x23, 0x61, 0x20,
-    0x64, 0xb0, 0x24, 0x50, 0x58, 0xb0, 0x00, 0x1b,
-    0xb0, 0x40, 0x59, 0x23, 0xb0, 0x00, 0x50, 0x58,
-    0x65, 0x59, 0xb0, 0x03, 0x25, 0x23, 0x61, 0x44,
-    0x44, 0xb0, 0x01, 0x60, 0x2d, 0xb0, 0x0e, 0x2c,
-    0x20, 0xb0, 0x00, 0x23, 0x42, 0xb3, 0x0d, 0x0c,
-    0x00, 0x03, 0x45, 0x50, 0x58, 0x21, 0x1b, 0x23,
-    0x21, 0x59, 0x2a, 0x21, 0x2d, 0xb0, 0x0f, 0x2c,
-    0xb1, 0x02, 0x02, 0x45, 0xb0, 0x64, 0x61, 0x44,
-    0x2d, 0xb0, 0x10, 0x2c, 0xb0, 0x01, 0x60, 0x20,
-    0x20, 0xb0, 0x0f, 0x43, 0x4a, 0xb0, 0x00, 0x50,
-    0x58, 0x20, 0xb0, 0x0f, 0x23, 0x42, 0x59, 0xb0,
-    0x10, 0x43, 0x4a, 0xb0, 0x00, 0x52, 0x58, 0x20,
-    0xb0, 0x10, 0x23, 0x42, 0x59, 0x2d, 0xb0, 0x11,
-    0x2c, 0x20, 0xb0, 0x10, 0x62, 0x66, 0xb0, 0x01,
-    0x63, 0x20, 0xb8, 0x04, 0x00, 0x63, 0x8a, 0x23,
-    0x61, 0xb0, 0x11, 0x43, 0x60, 0x20, 0x8a, 0x60,
-    0x20, 0xb0, 0x11, 0x23, 0x42, 0x23, 0x2d, 0xb0,
-    0x12, 0x2c, 0x4b, 0x54, 0x58, 0xb1, 0x04, 0x64,
-    0x44, 0x59, 0x24, 0xb0, 0x0d, 0x65, 0x23, 0x78,
-    0x2d, 0xb0, 0x13, 0x2c, 0x4b, 0x51, 0x58, 0x4b,
-    0x53, 0x58, 0xb1, 0x04, 0x64, 0x44, 0x59, 0x1b,
-    0x21, 0x59, 0x24, 0xb0, 0x13, 0x65, 0x23, 0x78,
-    0x2d, 0xb0, 0x14, 0x2c, 0xb1, 0x00, 0x12, 0x43,
-    0x55, 0x58, 0xb1, 0x12, 0x12, 0x43, 0xb0, 0x01,
-    0x61, 0x42, 0xb0, 0x11, 0x2b, 0x59, 0xb0, 0x00,
-    0x43, 0xb0, 0x02, 0x25, 0x42, 0xb1, 0x0f, 0x02,
-    0x25, 0x42, 0xb1, 0x10, 0x02, 0x25, 0x42, 0xb0,
-    0x01, 0x16, 0x23, 0x20, 0xb0, 0x03, 0x25, 0x50,
-    0x58, 0xb1, 0x01, 0x00, 0x43, 0x60, 0xb0, 0x04,
-    0x25, 0x42, 0x8a, 0x8a, 0x20, 0x8a, 0x23, 0x61,
-    0xb0, 0x10, 0x2a, 0x21, 0x23, 0xb0, 0x01, 0x61,
-    0x20, 0x8a, 0x23, 0x61, 0xb0, 0x10, 0x2a, 0x21,
-    0x1b, 0xb1, 0x01, 0x00, 0x43, 0x60, 0xb0, 0x02,
-    0x25, 0x42, 0xb0, 0x02, 0x25, 0x61, 0xb0, 0x10,
-    0x2a, 0x21, 0x59, 0xb0, 0x0f, 0x43, 0x47, 0xb0,
-    0x10, 0x43, 0x47, 0x60, 0xb0, 0x02, 0x62, 0x20,
-    0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59,
-    0x66, 0xb0, 0x01, 0x63, 0x20, 0xb0, 0x0e, 0x43,
-    0x63, 0xb8, 0x04, 0x00, 0x62, 0x20, 0xb0, 0x00,
-    0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0,
-    0x01, 0x63, 0x60, 0xb1, 0x00, 0x00, 0x13, 0x23,
-    0x44, 0xb0, 0x01, 0x43, 0xb0, 0x00, 0x3e, 0xb2,
-    0x01, 0x01, 0x01, 0x43, 0x60, 0x42, 0x2d, 0xb0,
-    0x15, 0x2c, 0x00, 0xb1, 0x00, 0x02, 0x45, 0x54,
-    0x58, 0xb0, 0x12, 0x23, 0x42, 0x20, 0x45, 0xb0,
-    0x0e, 0x23, 0x42, 0xb0, 0x0d, 0x23, 0xb0, 0x05,
-    0x60, 0x42, 0x20, 0x60, 0xb7, 0x18, 0x18, 0x01,
-    0x00, 0x11, 0x00, 0x13, 0x00, 0x42, 0x42, 0x42,
-    0x8a, 0x60, 0x20, 0xb0, 0x14, 0x23, 0x42, 0xb0,
-    0x01, 0x61, 0xb1, 0x14, 0x08, 0x2b, 0xb0, 0x8b,
-    0x2b, 0x1b, 0x22, 0x59, 0x2d, 0xb0, 0x16, 0x2c,
-    0xb1, 0x00, 0x15, 0x2b, 0x2d, 0xb0, 0x17, 0x2c,
-    0xb1, 0x01, 0x15, 0x2b, 0x2d, 0xb0, 0x18, 0x2c,
-    0xb1, 0x02, 0x15, 0x2b, 0x2d, 0xb0, 0x19, 0x2c,
-    0xb1, 0x03, 0x15, 0x2b, 0x2d, 0xb0, 0x1a, 0x2c,
-    0xb1, 0x04, 0x15, 0x2b, 0x2d, 0xb0, 0x1b, 0x2c,
-    0xb1, 0x05, 0x15, 0x2b, 0x2d, 0xb0, 0x1c, 0x2c,
-    0xb1, 0x06, 0x15, 0x2b, 0x2d, 0xb0, 0x1d, 0x2c,
-    0xb1, 0x07, 0x15, 0x2b, 0x2d, 0xb0, 0x1e, 0x2c,
-    0xb1, 0x08, 0x15, 0x2b, 0x2d, 0xb0, 0x1f, 0x2c,
-    0xb1, 0x09, 0x15, 0x2b, 0x2d, 0xb0, 0x2b, 0x2c,
-    0x23, 0x20, 0xb0, 0x10, 0x62, 0x66, 0xb0, 0x01,
-    0x63, 0xb0, 0x06, 0x60, 0x4b, 0x54, 0x58, 0x23,
-    0x20, 0x2e, 0xb0, 0x01, 0x5d, 0x1b, 0x21, 0x21,
-    0x59, 0x2d, 0xb0, 0x2c, 0x2c, 0x23, 0x20, 0xb0,
-    0x10, 0x62, 0x66, 0xb0, 0x01, 0x63, 0xb0, 0x16,
-    0x60, 0x4b, 0x54, 0x58, 0x23, 0x20, 0x2e, 0xb0,
-    0x01, 0x71, 0x1b, 0x21, 0x21, 0x59, 0x2d, 0xb0,
-    0x2d, 0x2c, 0x23, 0x20, 0xb0, 0x10, 0x62, 0x66,
-    0xb0, 0x01, 0x63, 0xb0, 0x26, 0x60, 0x4b, 0x54,
-    0x58, 0x23, 0x20, 0x2e, 0xb0, 0x01, 0x72, 0x1b,
-    0x21, 0x21, 0x59, 0x2d, 0xb0, 0x20, 0x2c, 0x00,
-    0xb0, 0x0f, 0x2b, 0xb1, 0x00, 0x02, 0x45, 0x54,
-    0x58, 0xb0, 0x12, 0x23, 0x42, 0x20, 0x45, 0xb0,
-    0x0e, 0x23, 0x42, 0xb0, 0x0d, 0x23, 0xb0, 0x05,
-    0x60, 0x42, 0x20, 0x60, 0xb0, 0x01, 0x61, 0xb5,
-    0x18, 0x18, 0x01, 0x00, 0x11, 0x00, 0x42, 0x42,
-    0x8a, 0x60, 0xb1, 0x14, 0x08, 0x2b, 0xb0, 0x8b,
-    0x2b, 0x1b, 0x22, 0x59, 0x2d, 0xb0, 0x21, 0x2c,
-    0xb1, 0x00, 0x20, 0x2b, 0x2d, 0xb0, 0x22, 0x2c,
-    0xb1, 0x01, 0x20, 0x2b, 0x2d, 0xb0, 0x23, 0x2c,
-    0xb1, 0x02, 0x20, 0x2b, 0x2d, 0xb0, 0x24, 0x2c,
-    0xb1, 0x03, 0x20, 0x2b, 0x2d, 0xb0, 0x25, 0x2c,
-    0xb1, 0x04, 0x20, 0x2b, 0x2d, 0xb0, 0x26, 0x2c,
-    0xb1, 0x05, 0x20, 0x2b, 0x2d, 0xb0, 0x27, 0x2c,
-    0xb1, 0x06, 0x20, 0x2b, 0x2d, 0xb0, 0x28, 0x2c,
-    0xb1, 0x07, 0x20, 0x2b, 0x2d, 0xb0, 0x29, 0x2c,
-    0xb1, 0x08, 0x20, 0x2b, 0x2d, 0xb0, 0x2a, 0x2c,
-    0xb1, 0x09, 0x20, 0x2b, 0x2d, 0xb0, 0x2e, 0x2c,
-    0x20, 0x3c, 0xb0, 0x01, 0x60, 0x2d, 0xb0, 0x2f,
-    0x2c, 0x20, 0x60, 0xb0, 0x18, 0x60, 0x20, 0x43,
-    0x23, 0xb0, 0x01, 0x60, 0x43, 0xb0, 0x02, 0x25,
-    0x61, 0xb0, 0x01, 0x60, 0xb0, 0x2e, 0x2a, 0x21,
-    0x2d, 0xb0, 0x30, 0x2c, 0xb0, 0x2f, 0x2b, 0xb0,
-    0x2f, 0x2a, 0x2d, 0xb0, 0x31, 0x2c, 0x20, 0x20,
-    0x47, 0x20, 0x20, 0xb0, 0x0e, 0x43, 0x63, 0xb8,
-    0x04, 0x00, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58,
-    0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63,
-    0x60, 0x23, 0x61, 0x38, 0x23, 0x20, 0x8a, 0x55,
-    0x58, 0x20, 0x47, 0x20, 0x20, 0xb0, 0x0e, 0x43,
-    0x63, 0xb8, 0x04, 0x00, 0x62, 0x20, 0xb0, 0x00,
-    0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0,
-    0x01, 0x63, 0x60, 0x23, 0x61, 0x38, 0x1b, 0x21,
-    0x59, 0x2d, 0xb0, 0x32, 0x2c, 0x00, 0xb1, 0x00,
-    0x02, 0x45, 0x54, 0x58, 0xb1, 0x0e, 0x06, 0x45,
-    0x42, 0xb0, 0x01, 0x16, 0xb0, 0x31, 0x2a, 0xb1,
-    0x05, 0x01, 0x15, 0x45, 0x58, 0x30, 0x59, 0x1b,
-    0x22, 0x59, 0x2d, 0xb0, 0x33, 0x2c, 0x00, 0xb0,
-    0x0f, 0x2b, 0xb1, 0x00, 0x02, 0x45, 0x54, 0x58,
-    0xb1, 0x0e, 0x06, 0x45, 0x42, 0xb0, 0x01, 0x16,
-    0xb0, 0x31, 0x2a, 0xb1, 0x05, 0x01, 0x15, 0x45,
-    0x58, 0x30, 0x59, 0x1b, 0x22, 0x59, 0x2d, 0xb0,
-    0x34, 0x2c, 0x20, 0x35, 0xb0, 0x01, 0x60, 0x2d,
-    0xb0, 0x35, 0x2c, 0x00, 0xb1, 0x0e, 0x06, 0x45,
-    0x42, 0xb0, 0x01, 0x45, 0x63, 0xb8, 0x04, 0x00,
-    0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40,
-    0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0xb0, 0x01,
-    0x2b, 0xb0, 0x0e, 0x43, 0x63, 0xb8, 0x04, 0x00,
-    0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40,
-    0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0xb0, 0x01,
-    0x2b, 0xb0, 0x00, 0x16, 0xb4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x44, 0x3e, 0x23, 0x38, 0xb1, 0x34,
-    0x01, 0x15, 0x2a, 0x21, 0x2d, 0xb0, 0x36, 0x2c,
-    0x20, 0x3c, 0x20, 0x47, 0x20, 0xb0, 0x0e, 0x43,
-    0x63, 0xb8, 0x04, 0x00, 0x62, 0x20, 0xb0, 0x00,
-    0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0,
-    0x01, 0x63, 0x60, 0xb0, 0x00, 0x43, 0x61, 0x38,
-    0x2d, 0xb0, 0x37, 0x2c, 0x2e, 0x17, 0x3c, 0x2d,
-    0xb0, 0x38, 0x2c, 0x20, 0x3c, 0x20, 0x47, 0x20,
-    0xb0, 0x0e, 0x43, 0x63, 0xb8, 0x04, 0x00, 0x62,
-    0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60,
-    0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0xb0, 0x00,
-    0x43, 0x61, 0xb0, 0x01, 0x43, 0x63, 0x38, 0x2d,
-    0xb0, 0x39, 0x2c, 0xb1, 0x02, 0x00, 0x16, 0x25,
-    0x20, 0x2e, 0x20, 0x47, 0xb0, 0x00, 0x23, 0x42,
-    0xb0, 0x02, 0x25, 0x49, 0x8a, 0x8a, 0x47, 0x23,
-    0x47, 0x23, 0x61, 0x20, 0x58, 0x62, 0x1b, 0x21,
-    0x59, 0xb0, 0x01, 0x23, 0x42, 0xb2, 0x38, 0x01,
-    0x01, 0x15, 0x14, 0x2a, 0x2d, 0xb0, 0x3a, 0x2c,
-    0xb0, 0x00, 0x16, 0xb0, 0x17, 0x23, 0x42, 0xb0,
-    0x04, 0x25, 0xb0, 0x04, 0x25, 0x47, 0x23, 0x47,
-    0x23, 0x61, 0xb1, 0x0c, 0x00, 0x42, 0xb0, 0x0b,
-    0x43, 0x2b, 0x65, 0x8a, 0x2e, 0x23, 0x20, 0x20,
-    0x3c, 0x8a, 0x38, 0x2d, 0xb0, 0x3b, 0x2c, 0xb0,
-    0x00, 0x16, 0xb0, 0x17, 0x23, 0x42, 0xb0, 0x04,
-    0x25, 0xb0, 0x04, 0x25, 0x20, 0x2e, 0x47, 0x23,
-    0x47, 0x23, 0x61, 0x20, 0xb0, 0x06, 0x23, 0x42,
-    0xb1, 0x0c, 0x00, 0x42, 0xb0, 0x0b, 0x43, 0x2b,
-    0x20, 0xb0, 0x60, 0x50, 0x58, 0x20, 0xb0, 0x40,
-    0x51, 0x58, 0xb3, 0x04, 0x20, 0x05, 0x20, 0x1b,
-    0xb3, 0x04, 0x26, 0x05, 0x1a, 0x59, 0x42, 0x42,
-    0x23, 0x20, 0xb0, 0x0a, 0x43, 0x20, 0x8a, 0x23,
-    0x47, 0x23, 0x47, 0x23, 0x61, 0x23, 0x46, 0x60,
-    0xb0, 0x06, 0x43, 0xb0, 0x02, 0x62, 0x20, 0xb0,
-    0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66,
-    0xb0, 0x01, 0x63, 0x60, 0x20, 0xb0, 0x01, 0x2b,
-    0x20, 0x8a, 0x8a, 0x61, 0x20, 0xb0, 0x04, 0x43,
-    0x60, 0x64, 0x23, 0xb0, 0x05, 0x43, 0x61, 0x64,
-    0x50, 0x58, 0xb0, 0x04, 0x43, 0x61, 0x1b, 0xb0,
-    0x05, 0x43, 0x60, 0x59, 0xb0, 0x03, 0x25, 0xb0,
-    0x02, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0,
-    0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x61,
-    0x23, 0x20, 0x20, 0xb0, 0x04, 0x26, 0x23, 0x46,
-    0x61, 0x38, 0x1b, 0x23, 0xb0, 0x0a, 0x43, 0x46,
-    0xb0, 0x02, 0x25, 0xb0, 0x0a, 0x43, 0x47, 0x23,
-    0x47, 0x23, 0x61, 0x60, 0x20, 0xb0, 0x06, 0x43,
-    0xb0, 0x02, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58,
-    0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63,
-    0x60, 0x23, 0x20, 0xb0, 0x01, 0x2b, 0x23, 0xb0,
-    0x06, 0x43, 0x60, 0xb0, 0x01, 0x2b, 0xb0, 0x05,
-    0x25, 0x61, 0xb0, 0x05, 0x25, 0xb0, 0x02, 0x62,
-    0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60,
-    0x59, 0x66, 0xb0, 0x01, 0x63, 0xb0, 0x04, 0x26,
-    0x61, 0x20, 0xb0, 0x04, 0x25, 0x60, 0x64, 0x23,
-    0xb0, 0x03, 0x25, 0x60, 0x64, 0x50, 0x58, 0x21,
-    0x1b, 0x23, 0x21, 0x59, 0x23, 0x20, 0x20, 0xb0,
-    0x04, 0x26, 0x23, 0x46, 0x61, 0x38, 0x59, 0x2d,
-    0xb0, 0x3c, 0x2c, 0xb0, 0x00, 0x16, 0xb0, 0x17,
-    0x23, 0x42, 0x20, 0x20, 0x20, 0xb0, 0x05, 0x26,
-    0x20, 0x2e, 0x47, 0x23, 0x47, 0x23, 0x61, 0x23,
-    0x3c, 0x38, 0x2d, 0xb0, 0x3d, 0x2c, 0xb0, 0x00,
-    0x16, 0xb0, 0x17, 0x23, 0x42, 0x20, 0xb0, 0x0a,
-    0x23, 0x42, 0x20, 0x20, 0x20, 0x46, 0x23, 0x47,
-    0xb0, 0x01, 0x2b, 0x23, 0x61, 0x38, 0x2d, 0xb0,
-    0x3e, 0x2c, 0xb0, 0x00, 0x16, 0xb0, 0x17, 0x23,
-    0x42, 0xb0, 0x03, 0x25, 0xb0, 0x02, 0x25, 0x47,
-    0x23, 0x47, 0x23, 0x61, 0xb0, 0x00, 0x54, 0x58,
-    0x2e, 0x20, 0x3c, 0x23, 0x21, 0x1b, 0xb0, 0x02,
-    0x25, 0xb0, 0x02, 0x25, 0x47, 0x23, 0x47, 0x23,
-    0x61, 0x20, 0xb0, 0x05, 0x25, 0xb0, 0x04, 0x25,
-    0x47, 0x23, 0x47, 0x23, 0x61, 0xb0, 0x06, 0x25,
-    0xb0, 0x05, 0x25, 0x49, 0xb0, 0x02, 0x25, 0x61,
-    0xb9, 0x08, 0x00, 0x08, 0x00, 0x63, 0x63, 0x23,
-    0x20, 0x58, 0x62, 0x1b, 0x21, 0x59, 0x63, 0xb8,
-    0x04, 0x00, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58,
-    0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63,
-    0x60, 0x23, 0x2e, 0x23, 0x20, 0x20, 0x3c, 0x8a,
-    0x38, 0x23, 0x21, 0x59, 0x2d, 0xb0, 0x3f, 0x2c,
-    0xb0, 0x00, 0x16, 0xb0, 0x17, 0x23, 0x42, 0x20,
-    0xb0, 0x0a, 0x43, 0x20, 0x2e, 0x47, 0x23, 0x47,
-    0x23, 0x61, 0x20, 0x60, 0xb0, 0x20, 0x60, 0x66,
-    0xb0, 0x02, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58,
-    0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63,
-    0x23, 0x20, 0x20, 0x3c, 0x8a, 0x38, 0x2d, 0xb0,
-    0x40, 0x2c, 0x23, 0x20, 0x2e, 0x46, 0xb0, 0x02,
-    0x25, 0x46, 0xb0, 0x17, 0x43, 0x58, 0x50, 0x1b,
-    0x52, 0x59, 0x58, 0x20, 0x3c, 0x59, 0x2e, 0xb1,
-    0x30, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x41, 0x2c,
-    0x23, 0x20, 0x2e, 0x46, 0xb0, 0x02, 0x25, 0x46,
-    0xb0, 0x17, 0x43, 0x58, 0x52, 0x1b, 0x50, 0x59,
-    0x58, 0x20, 0x3c, 0x59, 0x2e, 0xb1, 0x30, 0x01,
-    0x14, 0x2b, 0x2d, 0xb0, 0x42, 0x2c, 0x23, 0x20,
-    0x2e, 0x46, 0xb0, 0x02, 0x25, 0x46, 0xb0, 0x17,
-    0x43, 0x58, 0x50, 0x1b, 0x52, 0x59, 0x58, 0x20,
-    0x3c, 0x59, 0x23, 0x20, 0x2e, 0x46, 0xb0, 0x02,
-    0x25, 0x46, 0xb0, 0x17, 0x43, 0x58, 0x52, 0x1b,
-    0x50, 0x59, 0x58, 0x20, 0x3c, 0x59, 0x2e, 0xb1,
-    0x30, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x43, 0x2c,
-    0xb0, 0x3a, 0x2b, 0x23, 0x20, 0x2e, 0x46, 0xb0,
-    0x02, 0x25, 0x46, 0xb0, 0x17, 0x43, 0x58, 0x50,
-    0x1b, 0x52, 0x59, 0x58, 0x20, 0x3c, 0x59, 0x2e,
-    0xb1, 0x30, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x44,
-    0x2c, 0xb0, 0x3b, 0x2b, 0x8a, 0x20, 0x20, 0x3c,
-    0xb0, 0x06, 0x23, 0x42, 0x8a, 0x38, 0x23, 0x20,
-    0x2e, 0x46, 0xb0, 0x02, 0x25, 0x46, 0xb0, 0x17,
-    0x43, 0x58, 0x50, 0x1b, 0x52, 0x59, 0x58, 0x20,
-    0x3c, 0x59, 0x2e, 0xb1, 0x30, 0x01, 0x14, 0x2b,
-    0xb0, 0x06, 0x43, 0x2e, 0xb0, 0x30, 0x2b, 0x2d,
-    0xb0, 0x45, 0x2c, 0xb0, 0x00, 0x16, 0xb0, 0x04,
-    0x25, 0xb0, 0x04, 0x26, 0x20, 0x20, 0x20, 0x46,
-    0x23, 0x47, 0x61, 0xb0, 0x0c, 0x23, 0x42, 0x2e,
-    0x47, 0x23, 0x47, 0x23, 0x61, 0xb0, 0x0b, 0x43,
-    0x2b, 0x23, 0x20, 0x3c, 0x20, 0x2e, 0x23, 0x38,
-    0xb1, 0x30, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x46,
-    0x2c, 0xb1, 0x0a, 0x04, 0x25, 0x42, 0xb0, 0x00,
-    0x16, 0xb0, 0x04, 0x25, 0xb0, 0x04, 0x25, 0x20,
-    0x2e, 0x47, 0x23, 0x47, 0x23, 0x61, 0x20, 0xb0,
-    0x06, 0x23, 0x42, 0xb1, 0x0c, 0x00, 0x42, 0xb0,
-    0x0b, 0x43, 0x2b, 0x20, 0xb0, 0x60, 0x50, 0x58,
-    0x20, 0xb0, 0x40, 0x51, 0x58, 0xb3, 0x04, 0x20,
-    0x05, 0x20, 0x1b, 0xb3, 0x04, 0x26, 0x05, 0x1a,
-    0x59, 0x42, 0x42, 0x23, 0x20, 0x47, 0xb0, 0x06,
-    0x43, 0xb0, 0x02, 0x62, 0x20, 0xb0, 0x00, 0x50,
-    0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01,
-    0x63, 0x60, 0x20, 0xb0, 0x01, 0x2b, 0x20, 0x8a,
-    0x8a, 0x61, 0x20, 0xb0, 0x04, 0x43, 0x60, 0x64,
-    0x23, 0xb0, 0x05, 0x43, 0x61, 0x64, 0x50, 0x58,
-    0xb0, 0x04, 0x43, 0x61, 0x1b, 0xb0, 0x05, 0x43,
-    0x60, 0x59, 0xb0, 0x03, 0x25, 0xb0, 0x02, 0x62,
-    0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60,
-    0x59, 0x66, 0xb0, 0x01, 0x63, 0x61, 0xb0, 0x02,
-    0x25, 0x46, 0x61, 0x38, 0x23, 0x20, 0x3c, 0x23,
-    0x38, 0x1b, 0x21, 0x20, 0x20, 0x46, 0x23, 0x47,
-    0xb0, 0x01, 0x2b, 0x23, 0x61, 0x38, 0x21, 0x59,
-    0xb1, 0x30, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x47,
-    0x2c, 0xb1, 0x00, 0x3a, 0x2b, 0x2e, 0xb1, 0x30,
-    0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x48, 0x2c, 0xb1,
-    0x00, 0x3b, 0x2b, 0x21, 0x23, 0x20, 0x20, 0x3c,
-    0xb0, 0x06, 0x23, 0x42, 0x23, 0x38, 0xb1, 0x30,
-    0x01, 0x14, 0x2b, 0xb0, 0x06, 0x43, 0x2e, 0xb0,
-    0x30, 0x2b, 0x2d, 0xb0, 0x49, 0x2c, 0xb0, 0x00,
-    0x15, 0x20, 0x47, 0xb0, 0x00, 0x23, 0x42, 0xb2,
-    0x00, 0x01, 0x01, 0x15, 0x14, 0x13, 0x2e, 0xb0,
-    0x36, 0x2a, 0x2d, 0xb0, 0x4a, 0x2c, 0xb0, 0x00,
-    0x15, 0x20, 0x47, 0xb0, 0x00, 0x23, 0x42, 0xb2,
-    0x00, 0x01, 0x01, 0x15, 0x14, 0x13, 0x2e, 0xb0,
-    0x36, 0x2a, 0x2d, 0xb0, 0x4b, 0x2c, 0xb1, 0x00,
-    0x01, 0x14, 0x13, 0xb0, 0x37, 0x2a, 0x2d, 0xb0,
-    0x4c, 0x2c, 0xb0, 0x39, 0x2a, 0x2d, 0xb0, 0x4d,
-    0x2c, 0xb0, 0x00, 0x16, 0x45, 0x23, 0x20, 0x2e,
-    0x20, 0x46, 0x8a, 0x23, 0x61, 0x38, 0xb1, 0x30,
-    0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x4e, 0x2c, 0xb0,
-    0x0a, 0x23, 0x42, 0xb0, 0x4d, 0x2b, 0x2d, 0xb0,
-    0x4f, 0x2c, 0xb2, 0x00, 0x00, 0x46, 0x2b, 0x2d,
-    0xb0, 0x50, 0x2c, 0xb2, 0x00, 0x01, 0x46, 0x2b,
-    0x2d, 0xb0, 0x51, 0x2c, 0xb2, 0x01, 0x00, 0x46,
-    0x2b, 0x2d, 0xb0, 0x52, 0x2c, 0xb2, 0x01, 0x01,
-    0x46, 0x2b, 0x2d, 0xb0, 0x53, 0x2c, 0xb2, 0x00,
-    0x00, 0x47, 0x2b, 0x2d, 0xb0, 0x54, 0x2c, 0xb2,
-    0x00, 0x01, 0x47, 0x2b, 0x2d, 0xb0, 0x55, 0x2c,
-    0xb2, 0x01, 0x00, 0x47, 0x2b, 0x2d, 0xb0, 0x56,
-    0x2c, 0xb2, 0x01, 0x01, 0x47, 0x2b, 0x2d, 0xb0,
-    0x57, 0x2c, 0xb3, 0x00, 0x00, 0x00, 0x43, 0x2b,
-    0x2d, 0xb0, 0x58, 0x2c, 0xb3, 0x00, 0x01, 0x00,
-    0x43, 0x2b, 0x2d, 0xb0, 0x59, 0x2c, 0xb3, 0x01,
-    0x00, 0x00, 0x43, 0x2b, 0x2d, 0xb0, 0x5a, 0x2c,
-    0xb3, 0x01, 0x01, 0x00, 0x43, 0x2b, 0x2d, 0xb0,
-    0x5b, 0x2c, 0xb3, 0x00, 0x00, 0x01, 0x43, 0x2b,
-    0x2d, 0xb0, 0x5c, 0x2c, 0xb3, 0x00, 0x01, 0x01,
-    0x43, 0x2b, 0x2d, 0xb0, 0x5d, 0x2c, 0xb3, 0x01,
-    0x00, 0x01, 0x43, 0x2b, 0x2d, 0xb0, 0x5e, 0x2c,
-    0xb3, 0x01, 0x01, 0x01, 0x43, 0x2b, 0x2d, 0xb0,
-    0x5f, 0x2c, 0xb2, 0x00, 0x00, 0x45, 0x2b, 0x2d,
-    0xb0, 0x60, 0x2c, 0xb2, 0x00, 0x01, 0x45, 0x2b,
-    0x2d, 0xb0, 0x61, 0x2c, 0xb2, 0x01, 0x00, 0x45,
-    0x2b, 0x2d, 0xb0, 0x62, 0x2c, 0xb2, 0x01, 0x01,
-    0x45, 0x2b, 0x2d, 0xb0, 0x63, 0x2c, 0xb2, 0x00,
-    0x00, 0x48, 0x2b, 0x2d, 0xb0, 0x64, 0x2c, 0xb2,
-    0x00, 0x01, 0x48, 0x2b, 0x2d, 0xb0, 0x65, 0x2c,
-    0xb2, 0x01, 0x00, 0x48, 0x2b, 0x2d, 0xb0, 0x66,
-    0x2c, 0xb2, 0x01, 0x01, 0x48, 0x2b, 0x2d, 0xb0,
-    0x67, 0x2c, 0xb3, 0x00, 0x00, 0x00, 0x44, 0x2b,
-    0x2d, 0xb0, 0x68, 0x2c, 0xb3, 0x00, 0x01, 0x00,
-    0x44, 0x2b, 0x2d, 0xb0, 0x69, 0x2c, 0xb3, 0x01,
-    0x00, 0x00, 0x44, 0x2b, 0x2d, 0xb0, 0x6a, 0x2c,
-    0xb3, 0x01, 0x01, 0x00, 0x44, 0x2b, 0x2d, 0xb0,
-    0x6b, 0x2c, 0xb3, 0x00, 0x00, 0x01, 0x44, 0x2b,
-    0x2d, 0xb0, 0x6c, 0x2c, 0xb3, 0x00, 0x01, 0x01,
-    0x44, 0x2b, 0x2d, 0xb0, 0x6d, 0x2c, 0xb3, 0x01,
-    0x00, 0x01, 0x44, 0x2b, 0x2d, 0xb0, 0x6e, 0x2c,
-    0xb3, 0x01, 0x01, 0x01, 0x44, 0x2b, 0x2d, 0xb0,
-    0x6f, 0x2c, 0xb1, 0x00, 0x3c, 0x2b, 0x2e, 0xb1,
-    0x30, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x70, 0x2c,
-    0xb1, 0x00, 0x3c, 0x2b, 0xb0, 0x40, 0x2b, 0x2d,
-    0xb0, 0x71, 0x2c, 0xb1, 0x00, 0x3c, 0x2b, 0xb0,
-    0x41, 0x2b, 0x2d, 0xb0, 0x72, 0x2c, 0xb0, 0x00,
-    0x16, 0xb1, 0x00, 0x3c, 0x2b, 0xb0, 0x42, 0x2b,
-    0x2d, 0xb0, 0x73, 0x2c, 0xb1, 0x01, 0x3c, 0x2b,
-    0xb0, 0x40, 0x2b, 0x2d, 0xb0, 0x74, 0x2c, 0xb1,
-    0x01, 0x3c, 0x2b, 0xb0, 0x41, 0x2b, 0x2d, 0xb0,
-    0x75, 0x2c, 0xb0, 0x00, 0x16, 0xb1, 0x01, 0x3c,
-    0x2b, 0xb0, 0x42, 0x2b, 0x2d, 0xb0, 0x76, 0x2c,
-    0xb1, 0x00, 0x3d, 0x2b, 0x2e, 0xb1, 0x30, 0x01,
-    0x14, 0x2b, 0x2d, 0xb0, 0x77, 0x2c, 0xb1, 0x00,
-    0x3d, 0x2b, 0xb0, 0x40, 0x2b, 0x2d, 0xb0, 0x78,
-    0x2c, 0xb1, 0x00, 0x3d, 0x2b, 0xb0, 0x41, 0x2b,
-    0x2d, 0xb0, 0x79, 0x2c, 0xb1, 0x00, 0x3d, 0x2b,
-    0xb0, 0x42, 0x2b, 0x2d, 0xb0, 0x7a, 0x2c, 0xb1,
-    0x01, 0x3d, 0x2b, 0xb0, 0x40, 0x2b, 0x2d, 0xb0,
-    0x7b, 0x2c, 0xb1, 0x01, 0x3d, 0x2b, 0xb0, 0x41,
-    0x2b, 0x2d, 0xb0, 0x7c, 0x2c, 0xb1, 0x01, 0x3d,
-    0x2b, 0xb0, 0x42, 0x2b, 0x2d, 0xb0, 0x7d, 0x2c,
-    0xb1, 0x00, 0x3e, 0x2b, 0x2e, 0xb1, 0x30, 0x01,
-    0x14, 0x2b, 0x2d, 0xb0, 0x7e, 0x2c, 0xb1, 0x00,
-    0x3e, 0x2b, 0xb0, 0x40, 0x2b, 0x2d, 0xb0, 0x7f,
-    0x2c, 0xb1, 0x00, 0x3e, 0x2b, 0xb0, 0x41, 0x2b,
-    0x2d, 0xb0, 0x80, 0x2c, 0xb1, 0x00, 0x3e, 0x2b,
-    0xb0, 0x42, 0x2b, 0x2d, 0xb0, 0x81, 0x2c, 0xb1,
-    0x01, 0x3e, 0x2b, 0xb0, 0x40, 0x2b, 0x2d, 0xb0,
-    0x82, 0x2c, 0xb1, 0x01, 0x3e, 0x2b, 0xb0, 0x41,
-    0x2b, 0x2d, 0xb0, 0x83, 0x2c, 0xb1, 0x01, 0x3e,
-    0x2b, 0xb0, 0x42, 0x2b, 0x2d, 0xb0, 0x84, 0x2c,
-    0xb1, 0x00, 0x3f, 0x2b, 0x2e, 0xb1, 0x30, 0x01,
-    0x14, 0x2b, 0x2d, 0xb0, 0x85, 0x2c, 0xb1, 0x00,
-    0x3f, 0x2b, 0xb0, 0x40, 0x2b, 0x2d, 0xb0, 0x86,
-    0x2c, 0xb1, 0x00, 0x3f, 0x2b, 0xb0, 0x41, 0x2b,
-    0x2d, 0xb0, 0x87, 0x2c, 0xb1, 0x00, 0x3f, 0x2b,
-    0xb0, 0x42, 0x2b, 0x2d, 0xb0, 0x88, 0x2c, 0xb1,
-    0x01, 0x3f, 0x2b, 0xb0, 0x40, 0x2b, 0x2d, 0xb0,
-    0x89, 0x2c, 0xb1, 0x01, 0x3f, 0x2b, 0xb0, 0x41,
-    0x2b, 0x2d, 0xb0, 0x8a, 0x2c, 0xb1, 0x01, 0x3f,
-    0x2b, 0xb0, 0x42, 0x2b, 0x2d, 0xb0, 0x8b, 0x2c,
-    0xb2, 0x0b, 0x00, 0x03, 0x45, 0x50, 0x58, 0xb0,
-    0x06, 0x1b, 0xb2, 0x04, 0x02, 0x03, 0x45, 0x58,
-    0x23, 0x21, 0x1b, 0x21, 0x59, 0x59, 0x42, 0x2b,
-    0xb0, 0x08, 0x65, 0xb0, 0x03, 0x24, 0x50, 0x78,
-    0xb1, 0x05, 0x01, 0x15, 0x45, 0x58, 0x30, 0x59,
-    0x2d, 0x00, 0x00, 0x00, 0x00, 0x4b, 0xb8, 0x00,
-    0xc8, 0x52, 0x58, 0xb1, 0x01, 0x01, 0x8e, 0x59,
-    0xb0, 0x01, 0xb9, 0x08, 0x00, 0x08, 0x00, 0x63,
-    0x70, 0xb1, 0x00, 0x07, 0x42, 0xb6, 0x00, 0x00,
-    0x45, 0x31, 0x23, 0x05, 0x00, 0x2a, 0xb1, 0x00,
-    0x07, 0x42, 0x40, 0x0c, 0x58, 0x04, 0x4c, 0x04,
-    0x38, 0x08, 0x2a, 0x05, 0x18, 0x07, 0x05, 0x0a,
-    0x2a, 0xb1, 0x00, 0x07, 0x42, 0x40, 0x0c, 0x5e,
-    0x02, 0x52, 0x02, 0x42, 0x06, 0x31, 0x03, 0x21,
-    0x05, 0x05, 0x0a, 0x2a, 0xb1, 0x00, 0x0c, 0x42,
-    0xbe, 0x16, 0x40, 0x13, 0x40, 0x0e, 0x40, 0x0a,
-    0xc0, 0x06, 0x40, 0x00, 0x05, 0x00, 0x0b, 0x2a,
-    0xb1, 0x00, 0x11, 0x42, 0xbe, 0x00, 0x40, 0x00,
-    0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00,
-    0x05, 0x00, 0x0b, 0x2a, 0xb9, 0x00, 0x03, 0x00,
-    0x00, 0x44, 0xb1, 0x24, 0x01, 0x88, 0x51, 0x58,
-    0xb0, 0x40, 0x88, 0x58, 0xb9, 0x00, 0x03, 0x00,
-    0x64, 0x44, 0xb1, 0x28, 0x01, 0x88, 0x51, 0x58,
-    0xb8, 0x08, 0x00, 0x88, 0x58, 0xb9, 0x00, 0x03,
-    0x00, 0x00, 0x44, 0x59, 0x1b, 0xb1, 0x27, 0x01,
-    0x88, 0x51, 0x58, 0xba, 0x08, 0x80, 0x00, 0x01,
-    0x04, 0x40, 0x88, 0x63, 0x54, 0x58, 0xb9, 0x00,
-    0x03, 0x00, 0x00, 0x44, 0x59, 0x59, 0x59, 0x59,
-    0x59, 0x40, 0x0c, 0x5a, 0x04, 0x4e, 0x04, 0x3a,
-    0x08, 0x2c, 0x05, 0x1a, 0x07, 0x05, 0x0e, 0x2a,
-    0xb8, 0x01, 0xff, 0x85, 0xb0, 0x04, 0x8d, 0xb1,
-    0x02, 0x00, 0x44, 0xb3, 0x05, 0x64, 0x06, 0x00,
-    0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 
-};
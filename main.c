@@ -3,12 +3,35 @@
 #include <stdio.h>
 #include <errno.h>
 #include <stdbool.h>
+#include <inttypes.h>
+#include <math.h>
 #include <SDL.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 #include <assert.h>
+#include <limits.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <signal.h>
+#include <sys/stat.h>
 
 #include <ft2build.h>
 #include FT_FREETYPE_H
+#include FT_OUTLINE_H
+
+#ifdef E_FONT_HEADER
+// font[] generated with makeFont, for toolchains without .incbin
 #include "font.h"
+#define FONT_END (font + sizeof(font))
+#else
+// linked in from font.S
+extern const unsigned char font[];
+extern const unsigned char fontEnd[];
+#define FONT_END fontEnd
+#endif
 
 #define MIN(a, b) ((a) < (b) ? (a) : (b))
 #define MAX(a, b) ((a) > (b) ? (a) : (b))
@@ -79,6 +102,63 @@ void buf_set_len(void *buf, size_t new_len) {
   }
 }
 
+// Flight recorder of scoped spans: the last TRACE_CAPACITY spans are kept
+// in a ring and can be written out as Chrome trace JSON (chrome://tracing, Perfetto)
+enum {
+  TRACE_CAPACITY = 1 << 16,
+};
+
+typedef struct TraceEvent {
+  const char *name; // string literal
+  Uint64 start;
+  Uint64 end;
+  long arg; // span specific counter (bytes, lines, glyphs), negative if not set
+} TraceEvent;
+
+typedef struct Trace {
+  TraceEvent events[TRACE_CAPACITY];
+  size_t count; // total number of recorded spans, only the last TRACE_CAPACITY are kept
+  const char *path;
+} Trace;
+
+Trace trace;
+
+void traceRecord(const char *name, Uint64 start, long arg) {
+  trace.events[trace.count % TRACE_CAPACITY] = (TraceEvent){
+          .name = name,
+          .start = start,
+          .end = SDL_GetPerformanceCounter(),
+          .arg = arg,
+  };
+  trace.count++;
+}
+
+bool writeTrace(const char *path) {
+  FILE *file = fopen(path, "w");
+  if (!file) {
+    return false;
+  }
+  size_t count = MIN(trace.count, TRACE_CAPACITY);
+  size_t first = trace.count - count;
+  double perfCountFreqUS = SDL_GetPerformanceFrequency() / 1000000.0;
+  Uint64 t0 = count ? trace.events[first % TRACE_CAPACITY].start : 0;
+  fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+  for (size_t i = first; i < trace.count; i++) {
+    TraceEvent *event = &trace.events[i % TRACE_CAPACITY];
+    // spans are recorded when they end, so an enclosing span may start before t0
+    double ts = ((double) event->start - (double) t0) / perfCountFreqUS;
+    double dur = (event->end - event->start) / perfCountFreqUS;
+    fprintf(file, "%s\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f",
+            i == first ? "" : ",", event->name, ts, dur);
+    if (event->arg >= 0) {
+      fprintf(file, ",\"args\":{\"n\":%ld}", event->arg);
+    }
+    fprintf(file, "}");
+  }
+  fprintf(file, "\n]}\n");
+  return fclose(file) == 0;
+}
+
 typedef struct Gap {
   size_t offset;
   char *buf; // stretchy buf
@@ -88,21 +168,194 @@ struct E;
 
 typedef void E_ActionHandler(struct E *e);
 
+struct E_KeyMap;
+
 typedef struct E_Key {
-  SDL_Keycode sym;
-  Uint16 mod;
+  SDL_Keycode sym; // SDLK_UNKNOWN marks an empty slot of E_KeyMap
+  Uint16 mod; // normalized with normalizeKeyMod
   bool hasMoreKeys;
   union {
     E_ActionHandler *handler;
-    struct E_Key *keys;
+    struct E_KeyMap *keys;
   };
 } E_Key;
 
+// One layer of the key trie: open addressing hash table with linear probing
+// keyed by (sym, normalized mod), capacity is a power of two
+typedef struct E_KeyMap {
+  E_Key *slots;
+  size_t cap;
+  size_t count;
+} E_KeyMap;
+
+// left/right variants of modifiers are merged, lock modifiers are dropped
+Uint16 normalizeKeyMod(Uint16 mod) {
+  Uint16 result = 0;
+  if (mod & KMOD_CTRL) {
+    result |= KMOD_CTRL;
+  }
+  if (mod & KMOD_ALT) {
+    result |= KMOD_ALT;
+  }
+  if (mod & KMOD_SHIFT) {
+    result |= KMOD_SHIFT;
+  }
+  if (mod & KMOD_GUI) {
+    result |= KMOD_GUI;
+  }
+  return result;
+}
+
+size_t E_KeyMap_hash(SDL_Keycode sym, Uint16 mod) {
+  Uint32 h = ((Uint32) sym ^ ((Uint32) mod << 16)) * 0x9E3779B1u;
+  return h ^ (h >> 15);
+}
+
+E_Key *E_KeyMap_get(E_KeyMap *map, SDL_Keycode sym, Uint16 mod) {
+  if (!map->cap) {
+    return 0;
+  }
+  size_t mask = map->cap - 1;
+  for (size_t i = E_KeyMap_hash(sym, mod) & mask; ; i = (i + 1) & mask) {
+    E_Key *slot = &map->slots[i];
+    if (slot->sym == SDLK_UNKNOWN) {
+      return 0;
+    }
+    if (slot->sym == sym && slot->mod == mod) {
+      return slot;
+    }
+  }
+}
+
+E_Key *E_KeyMap_put(E_KeyMap *map, E_Key key);
+
+void E_KeyMap_grow(E_KeyMap *map) {
+  E_Key *oldSlots = map->slots;
+  size_t oldCap = map->cap;
+  map->cap = MAX(oldCap * 2, 16);
+  map->slots = xcalloc(map->cap, sizeof(E_Key));
+  map->count = 0;
+  for (size_t i = 0; i < oldCap; i++) {
+    if (oldSlots[i].sym != SDLK_UNKNOWN) {
+      E_KeyMap_put(map, oldSlots[i]);
+    }
+  }
+  free(oldSlots);
+}
+
+// returns the existing key with the same sym and mod or the newly inserted one,
+// pointers into the map are invalidated by the next insertion
+E_Key *E_KeyMap_put(E_KeyMap *map, E_Key key) {
+  E_Key *existing = E_KeyMap_get(map, key.sym, key.mod);
+  if (existing) {
+    return existing;
+  }
+  if ((map->count + 1) * 2 > map->cap) { // keep load factor under 1/2
+    E_KeyMap_grow(map);
+  }
+  size_t mask = map->cap - 1;
+  size_t i = E_KeyMap_hash(key.sym, key.mod) & mask;
+  while (map->slots[i].sym != SDLK_UNKNOWN) {
+    i = (i + 1) & mask;
+  }
+  map->slots[i] = key;
+  map->count++;
+  return &map->slots[i];
+}
+
+// Offsets of '\n' in the text kept in a gap array split at the offset of the
+// last edit. Newlines before the split are stored as offsets from the text
+// start, newlines after it as distances from the text end, so an edit at
+// the split doesn't touch any other entry.
+typedef struct LineIndex {
+  size_t *newlines;
+  size_t cap;
+  size_t gapStart; // entries [0, gapStart) are offsets from the text start
+  size_t gapEnd; // entries [gapEnd, cap) are distances from the text end
+} LineIndex;
+
+size_t LineIndex_getNewlineCount(LineIndex *index) {
+  return index->gapStart + (index->cap - index->gapEnd);
+}
+
+// offset of the i-th newline, textSize is the current size of the text
+size_t LineIndex_getNewline(LineIndex *index, size_t i, size_t textSize) {
+  if (i < index->gapStart) {
+    return index->newlines[i];
+  }
+  return textSize - index->newlines[index->gapEnd + (i - index->gapStart)];
+}
+
+// number of the line containing offset, i.e. number of newlines before it
+size_t LineIndex_getLine(LineIndex *index, size_t offset, size_t textSize) {
+  size_t lo = 0;
+  size_t hi = LineIndex_getNewlineCount(index);
+  while (lo < hi) {
+    size_t mid = lo + (hi - lo) / 2;
+    if (LineIndex_getNewline(index, mid, textSize) < offset) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+size_t LineIndex_getLineStart(LineIndex *index, size_t line, size_t textSize) {
+  return line == 0 ? 0 : LineIndex_getNewline(index, line - 1, textSize) + 1;
+}
+
+void LineIndex_grow(LineIndex *index) {
+  size_t newCap = MAX(index->cap * 2, 64);
+  size_t *newlines = xalloc(newCap * sizeof(size_t));
+  size_t tailLen = index->cap - index->gapEnd;
+  if (index->newlines) {
+    memcpy(newlines, index->newlines, index->gapStart * sizeof(size_t));
+    memcpy(&newlines[newCap - tailLen], &index->newlines[index->gapEnd], tailLen * sizeof(size_t));
+    free(index->newlines);
+  }
+  index->newlines = newlines;
+  index->gapEnd = newCap - tailLen;
+  index->cap = newCap;
+}
+
+// moves the split so that newlines before offset are stored before the gap
+void LineIndex_moveSplit(LineIndex *index, size_t offset, size_t textSize) {
+  while (index->gapStart > 0 && index->newlines[index->gapStart - 1] >= offset) {
+    size_t newline = index->newlines[--index->gapStart];
+    index->newlines[--index->gapEnd] = textSize - newline;
+  }
+  while (index->gapEnd < index->cap && textSize - index->newlines[index->gapEnd] < offset) {
+    size_t newline = textSize - index->newlines[index->gapEnd++];
+    index->newlines[index->gapStart++] = newline;
+  }
+}
+
+// called before c is inserted at offset into the text of textSize
+void LineIndex_insert(LineIndex *index, size_t offset, char c, size_t textSize) {
+  LineIndex_moveSplit(index, offset, textSize);
+  if (c == '\n') {
+    if (index->gapStart == index->gapEnd) {
+      LineIndex_grow(index);
+    }
+    index->newlines[index->gapStart++] = offset;
+  }
+}
+
+// called before [start, end) is deleted from the text of textSize
+void LineIndex_delete(LineIndex *index, size_t start, size_t end, size_t textSize) {
+  LineIndex_moveSplit(index, start, textSize);
+  while (index->gapEnd < index->cap && textSize - index->newlines[index->gapEnd] < end) {
+    index->gapEnd++;
+  }
+}
+
 typedef struct Buffer {
   char *text;
   size_t bufferSize;
   size_t gapStart;
   size_t gapEnd;
+  LineIndex lines;
 } Buffer;
 
 size_t getTextSize(Buffer *buffer) {
@@ -119,6 +372,7 @@ size_t getPhysicalOffset(Buffer *buffer, size_t logicalOffset) {
 }
 
 void moveGap(Buffer *buffer, size_t offset) {
+  Uint64 traceStart = SDL_GetPerformanceCounter();
   size_t gapSize = buffer->gapEnd - buffer->gapStart;
   if (gapSize == 0) {
     size_t newBufferSize = buffer->bufferSize * 2 + 1;
@@ -133,6 +387,7 @@ void moveGap(Buffer *buffer, size_t offset) {
   } else if (offset > buffer->gapStart) {
     memmove(&buffer->text[buffer->gapStart], &buffer->text[buffer->gapEnd], offset - buffer->gapStart);
   }
+  long moved = offset < buffer->gapStart ? buffer->gapStart - offset : offset - buffer->gapStart;
   buffer->gapStart = offset;
   buffer->gapEnd = buffer->gapStart + gapSize;
 #if 0
@@ -140,9 +395,21 @@ void moveGap(Buffer *buffer, size_t offset) {
     buffer->text[i] = '*';
   }
 #endif
+  traceRecord("moveGap", traceStart, moved);
+}
+
+// indexes the text of a freshly loaded buffer which has no gap yet
+void initLineIndex(Buffer *buffer) {
+  assert(buffer->gapStart == buffer->gapEnd);
+  char *text = buffer->text;
+  size_t textSize = getTextSize(buffer);
+  for (char *c = memchr(text, '\n', textSize); c; c = memchr(c + 1, '\n', textSize - (c + 1 - text))) {
+    LineIndex_insert(&buffer->lines, c - text, '\n', c - text);
+  }
 }
 
 void insertChar(Buffer *buffer, size_t offset, char c) {
+  LineIndex_insert(&buffer->lines, offset, c, getTextSize(buffer));
   moveGap(buffer, offset);
   buffer->text[buffer->gapStart++] = c;
 }
@@ -150,6 +417,7 @@ void insertChar(Buffer *buffer, size_t offset, char c) {
 void deleteRegion(Buffer *buffer, size_t start, size_t end) {
   size_t min = MIN(start, end);
   size_t max = MAX(start, end);
+  LineIndex_delete(&buffer->lines, min, max, getTextSize(buffer));
   moveGap(buffer, min);
   buffer->gapEnd += (max - min);
 }
@@ -157,16 +425,58 @@ void deleteRegion(Buffer *buffer, size_t start, size_t end) {
 void deleteChar(Buffer *buffer, size_t offset) {
   moveGap(buffer, offset);
   if (buffer->gapEnd < buffer->bufferSize - 1) {
+    LineIndex_delete(&buffer->lines, offset, offset + 1, getTextSize(buffer));
     buffer->gapEnd++;
   }
 }
 
-typedef struct E_Glyph {
-  SDL_Texture *texture;
+// drawn in place of whitespace and control bytes, kinds are shown per bit 1 << Marker of E.markers
+typedef enum Marker {
+  MARKER_TAB,
+  MARKER_SPACE, // spaces ending a line
+  MARKER_CR,
+  MARKER_CONTROL,
+  MARKER_COUNT,
+} Marker;
+
+typedef struct MarkerGlyph {
+  const char *name; // in --markers
+  Uint32 codePoint;
+  char fallback; // rasterized instead for fonts without the code point
+} MarkerGlyph;
+
+MarkerGlyph markerGlyphs[MARKER_COUNT] = {
+        [MARKER_TAB] = {"tab", 0xBB, '>'},
+        [MARKER_SPACE] = {"space", 0xB7, '.'},
+        [MARKER_CR] = {"cr", 0xB6, '<'},
+        [MARKER_CONTROL] = {"control", 0xA4, '?'},
+};
+
+enum {
+  // glyphs are rasterized at GLYPH_SUBPIXELS x offsets within a pixel
+  GLYPH_SUBPIXEL_BITS = 2,
+  GLYPH_SUBPIXELS = 1 << GLYPH_SUBPIXEL_BITS,
+  // glyphs of the 256 bytes are followed by the markers
+  GLYPH_MARKERS = 256,
+  GLYPH_COUNT = GLYPH_MARKERS + MARKER_COUNT,
+  MARKERS_DEFAULT = 1 << MARKER_CR | 1 << MARKER_CONTROL,
+};
+
+typedef struct E_GlyphBitmap {
+  int sheetX; // top left in E.glyphSheet
+  int sheetY;
+  const Uint8 *coverage; // w * h alpha values, blended by the framebuffer renderer, 0 if the bitmap is empty
   int h;
   int w;
   int bearingX;
   int bearingY;
+} E_GlyphBitmap;
+
+// X positions and widths of text are 26.6 fixed point like FreeType's, the
+// pen moves by unrounded advances and a glyph is drawn with the bitmap
+// rasterized nearest to the fraction of a pixel where the pen is.
+typedef struct E_Glyph {
+  E_GlyphBitmap bitmaps[GLYPH_SUBPIXELS]; // bitmap i is rasterized i / GLYPH_SUBPIXELS pixels to the right
   int advance;
   bool initialized;
 } E_Glyph;
@@ -197,1080 +507,5402 @@ void KillRing_push(KillRing *killRing, char *text, size_t len) {
   killRing->currentEntry = index;
 }
 
-typedef struct E {
-  const char *path;
-  const char *fileName;
+// Log-linear histogram in the spirit of HdrHistogram: values are grouped by
+// power of two and each power is split into HIST_SUB_BUCKETS linear
+// sub-buckets, so relative error stays below 1/HIST_SUB_BUCKETS at any scale.
+enum {
+  HIST_SUB_BUCKET_BITS = 5,
+  HIST_SUB_BUCKETS = 1 << HIST_SUB_BUCKET_BITS,
+  HIST_BUCKETS = 40,
+};
 
-  char *text;
-  Buffer buffer;
+typedef struct Histogram {
+  Uint64 counts[HIST_BUCKETS * HIST_SUB_BUCKETS];
+  Uint64 totalCount;
+  Uint64 max;
+} Histogram;
 
-  char lineBuf[1000];
+size_t Histogram_getIndex(Uint64 value) {
+  size_t bucket = 0;
+  while ((value >> bucket) >= HIST_SUB_BUCKETS) {
+    bucket++;
+  }
+  size_t index = bucket * HIST_SUB_BUCKETS + (value >> bucket);
+  return MIN(index, HIST_BUCKETS * HIST_SUB_BUCKETS - 1);
+}
+
+// highest value which falls into the same sub-bucket as the value at index
+Uint64 Histogram_getValue(size_t index) {
+  size_t bucket = index / HIST_SUB_BUCKETS;
+  Uint64 subBucket = index % HIST_SUB_BUCKETS;
+  return ((subBucket + 1) << bucket) - 1;
+}
+
+void Histogram_record(Histogram *h, Uint64 value) {
+  h->counts[Histogram_getIndex(value)]++;
+  h->totalCount++;
+  h->max = MAX(h->max, value);
+}
+
+Uint64 Histogram_getPercentile(Histogram *h, double percentile) {
+  if (!h->totalCount) {
+    return 0;
+  }
+  Uint64 target = ceil(h->totalCount * percentile / 100.0);
+  target = MAX(target, 1);
+  Uint64 count = 0;
+  for (size_t i = 0; i < HIST_BUCKETS * HIST_SUB_BUCKETS; i++) {
+    count += h->counts[i];
+    if (count >= target) {
+      return MIN(Histogram_getValue(i), h->max);
+    }
+  }
+  return h->max;
+}
+
+// Stages of input-to-photon latency in microseconds:
+// event -> handler done -> render done -> present done,
+// each stage measures time since the previous one, total is event to present
+typedef enum LatencyStage {
+  LATENCY_HANDLE,
+  LATENCY_RENDER,
+  LATENCY_PRESENT,
+  LATENCY_TOTAL,
+  LATENCY_STAGE_COUNT
+} LatencyStage;
+
+const char *latencyStageNames[LATENCY_STAGE_COUNT] = {
+        [LATENCY_HANDLE] = "handle",
+        [LATENCY_RENDER] = "render",
+        [LATENCY_PRESENT] = "present",
+        [LATENCY_TOTAL] = "total",
+};
+
+typedef struct Latency {
+  Histogram histograms[LATENCY_STAGE_COUNT];
+  Uint64 eventTime; // perf counter of the input event being rendered, 0 if no input is pending
+  Uint64 handledTime; // perf counter when the handler of that event returned
+  bool showOverlay;
+  const char *dumpPath;
+} Latency;
+
+typedef enum StartupPhase {
+  STARTUP_FILE_READ,
+  STARTUP_SDL_INIT,
+  STARTUP_WINDOW,
+  STARTUP_RENDERER,
+  STARTUP_FONT_CACHE_LOAD,
+  STARTUP_FREETYPE_INIT,
+  STARTUP_GLYPHS,
+  STARTUP_KERNING,
+  STARTUP_FONT_CACHE_SAVE,
+  STARTUP_GLYPH_TEXTURES,
+  STARTUP_FIRST_FRAME,
+  STARTUP_PHASE_COUNT
+} StartupPhase;
+
+const char *startupPhaseNames[STARTUP_PHASE_COUNT] = {
+        [STARTUP_FILE_READ] = "file read",
+        [STARTUP_SDL_INIT] = "SDL init",
+        [STARTUP_WINDOW] = "window",
+        [STARTUP_RENDERER] = "renderer",
+        [STARTUP_FONT_CACHE_LOAD] = "font cache load",
+        [STARTUP_FREETYPE_INIT] = "FreeType init",
+        [STARTUP_GLYPHS] = "glyph rasterization",
+        [STARTUP_KERNING] = "kerning",
+        [STARTUP_FONT_CACHE_SAVE] = "font cache save",
+        [STARTUP_GLYPH_TEXTURES] = "glyph textures",
+        [STARTUP_FIRST_FRAME] = "first frame",
+};
+
+typedef struct StartupProfile {
+  Uint64 start; // perf counter when init started
+  Uint64 durations[STARTUP_PHASE_COUNT]; // perf counter ticks, 0 for skipped phases
+  bool print; // print the phases once the first frame is presented
+} StartupProfile;
+
+// Font atlas cache: rasterized glyph bitmaps, metrics and kerning written
+// as the FontAtlas struct followed by the pixels. The file is only read by
+// the build which wrote it, so structs are stored as they are in memory.
+#define FONT_CACHE_MAGIC "EFNT"
+
+enum {
+  FONT_CACHE_VERSION = 3,
+  FONT_SIZE = 12,
+  FONT_SIZE_MIN = 6,
+  FONT_SIZE_MAX = 48,
+  FONT_DPI = 96, // of a display without scaling, HiDPI displays scale it, see updateDisplayScale
+};
+
+typedef struct FontAtlasBitmap {
+  Sint32 w;
+  Sint32 h;
+  Sint32 bearingX;
+  Sint32 bearingY;
+  Uint32 pixelOffset; // offset of the w * h alpha values in FontAtlas.pixels
+} FontAtlasBitmap;
+
+typedef struct FontAtlasGlyph {
+  FontAtlasBitmap bitmaps[GLYPH_SUBPIXELS];
+  Sint32 advance; // 26.6
+  bool initialized;
+} FontAtlasGlyph;
+
+typedef struct FontAtlas {
+  char magic[4];
+  Uint32 version;
+  Uint64 fontHash; // FNV-1a of the font file
+  Sint32 fontSize;
+  Sint32 dpi;
+  Sint32 lineHeight;
+  Sint32 descender;
+  FontAtlasGlyph glyphs[GLYPH_COUNT];
+  Sint16 kerning[256 * 256]; // 26.6
+  Uint32 pixelsSize;
+  Uint8 *pixels; // not stored, the pixels follow the struct in the file
+} FontAtlas;
+
+// The atlas for a font size and dpi with its bitmaps packed into one sheet.
+// Building touches no editor state, so zooming builds on a thread and the
+// UI thread only uploads the sheet, see applyFont.
+typedef struct FontBuild {
+  const Uint8 *fontData;
+  size_t fontDataSize;
+  int fontSize;
+  int dpi;
+  StartupProfile *profile; // phases are recorded for builds on the UI thread, 0 for others
+  FontAtlas *atlas;
+  bool cached; // the atlas was read from the cache
+  Uint32 *sheet; // ARGB, white glyphs with the coverage as alpha
+  int sheetW;
+  int sheetH;
+  SDL_Point sheetPositions[GLYPH_COUNT][GLYPH_SUBPIXELS]; // top left of each bitmap in the sheet
   const char *error;
-  bool quit;
-  size_t cursor;
-  int height;
-  int width;
-  int textHeight;
-  int statusLineHeight;
-  int statusLineBaselineOffset;
+} FontBuild;
+
+typedef struct FontLoader {
+  int fontSize; // wanted size and dpi, built once the running build completes
+  int dpi;
+  bool building;
+  SDL_Thread *thread; // 0 if the build ran on the UI thread
+  SDL_atomic_t done; // set once build is complete
+  FontBuild build;
+} FontLoader;
+
+// Input recording: "EREC" magic, u32 version, then records of
+// u8 kind, u32 microseconds since the previous record, u16 modifier state
+// and a kind specific payload, all in host byte order
+#define RECORD_MAGIC "EREC"
+
+enum {
+  RECORD_VERSION = 1,
+};
 
+typedef enum RecordKind {
+  RECORD_TEXT = 1, // u8 len, len bytes of text
+  RECORD_KEY, // i32 sym, u16 mod
+  RECORD_RESIZE, // i32 width, i32 height
+  RECORD_EXPOSED,
+  RECORD_FOCUS_GAINED,
+  RECORD_BATCH_END, // event queue was drained
+  RECORD_WHEEL, // i32 y, flipped wheels already negated, only read from older recordings
+  RECORD_WHEEL_PRECISE, // f32 y, flipped wheels already negated
+} RecordKind;
+
+typedef struct Recorder {
+  FILE *file;
+  Uint64 lastTime;
+} Recorder;
+
+typedef struct Server {
+  int socket;
+  bool listening;
+  struct sockaddr_un address;
+} Server;
+
+enum {
+  // longest request a client may send, paths are separated with '\0'
+  SERVER_REQUEST_MAX = 64 * 1024,
+  SERVER_RECEIVE_TIMEOUT_MS = 1000,
+};
+
+typedef struct MacroStep {
+  E_ActionHandler *handler; // 0 if the step inserts c
+  size_t prefixArg; // prefix argument the handler ran with
+  char c;
+} MacroStep;
+
+typedef struct Macro {
+  MacroStep *steps; // stretchy buf, last recorded macro
+  MacroStep *recording; // stretchy buf, steps of the macro being recorded
+  bool isRecording;
+} Macro;
+
+// cursor and scroll state of a document on the screen
+typedef struct View {
+  size_t cursor;
   size_t selectionStart;
   bool hasSelection;
-  KillRing killRing;
 
-  int lineHeight;
-  int visibleLineCount; // number of visible lines on the screen
   int visibleLineCursor; // index of visible line with a cursor [0, visibleLineCount)
   int visibleLineTop; // index of a line which is the top visible line in the editor [0, totalLinesCount)
+  int visibleRowTop; // in soft wrap mode the number of rows of the top line above the screen
+  int scrollPixelY; // pixels of the top line or row above the screen, [0, lineHeight)
+  float scrollPending; // pixels the wheel animation has yet to scroll, down if > 0
+  Uint64 scrollTime; // perf counter of the last animation step
 
-  int screenLeftBorderOffsetX;
+  Sint64 screenLeftBorderOffsetX;
 
   // when moving up/down try to reach this cursor offset on prev/next line
   // it is reset during horizontal movements, 0 means not set
-  int desiredCursorOffsetX;
+  Sint64 desiredCursorOffsetX;
+} View;
 
-  SDL_Window *window;
-  SDL_Renderer *renderer;
+// Pen position at an offset of a long line: x is where the glyph before
+// the offset ends, kerning with the glyph at the offset is not included
+typedef struct Checkpoint {
+  size_t offset;
+  Sint64 x;
+} Checkpoint;
 
-  FT_Library ftLib;
-  FT_Face ftFace;
-  E_Glyph glyphs[256];
-  FT_Pos kerning[256 * 256];
+typedef struct LineCheckpoints {
+  size_t lineStart;
+  Checkpoint *checkpoints; // stretchy buf, one every CHECKPOINT_INTERVAL bytes, 0 if the entry is unused
+  Uint32 lastUsedTicks;
+} LineCheckpoints;
 
-  Uint64 perfCountFreqMS;
+enum {
+  // lines shorter than that are measured from their start
+  CHECKPOINT_INTERVAL = 4096,
+  CHECKPOINT_CACHE_SIZE = 16,
+};
 
-  E_Key *rootKeys;
-  E_Key *curKeys;
-} E;
+typedef enum Language {
+  LANGUAGE_NONE,
+  LANGUAGE_C,
+  LANGUAGE_JSON,
+} Language;
 
+// lexer state at a line start, only what can continue from the previous line
+typedef enum LexState {
+  LEX_NORMAL,
+  LEX_COMMENT, // inside /* */
+  LEX_STRING, // string continued with a trailing backslash
+  LEX_PREPROCESSOR, // directive continued with a trailing backslash
+} LexState;
 
-void setEditorError(E *e, const char *error) {
-  e->error = error;
+typedef enum Style {
+  STYLE_TEXT,
+  STYLE_KEYWORD,
+  STYLE_TYPE,
+  STYLE_STRING,
+  STYLE_NUMBER,
+  STYLE_COMMENT,
+  STYLE_PREPROCESSOR,
+  STYLE_COUNT,
+} Style;
+
+Uint32 styleColors[STYLE_COUNT] = {
+        [STYLE_TEXT] = 0x000000,
+        [STYLE_KEYWORD] = 0x0033b3,
+        [STYLE_TYPE] = 0x008080,
+        [STYLE_STRING] = 0x067d17,
+        [STYLE_NUMBER] = 0x1750eb,
+        [STYLE_COMMENT] = 0x8c8c8c,
+        [STYLE_PREPROCESSOR] = 0x9e880d,
+};
+
+enum {
+  // longer lines are shown without highlighting and end any comment or string
+  HIGHLIGHT_LINE_MAX = 64 * 1024,
+  // time spent lexing lines below the screen when the editor is idle
+  HIGHLIGHT_IDLE_MS = 2,
+  HIGHLIGHT_IDLE_BATCH = 256,
+  // a frame lexes lines only this far below the lexed ones, after a jump further
+  // down the screen is shown without highlighting until idle lexing reaches it
+  HIGHLIGHT_FRAME_LINES = 4096,
+};
+
+// Brackets outside of comments and strings of a run of lines, where depth
+// goes up at opening and down at closing brackets of any kind
+typedef struct BracketSummary {
+  int net; // depth at the end
+  int minPrefix; // lowest depth reached from the start, <= 0
+  int maxSuffix; // highest depth of the end above a point before it, >= 0
+} BracketSummary;
+
+BracketSummary combineBrackets(BracketSummary a, BracketSummary b) {
+  return (BracketSummary){
+          .net = a.net + b.net,
+          .minPrefix = MIN(a.minPrefix, a.net + b.minPrefix),
+          .maxSuffix = MAX(b.maxSuffix, b.net + a.maxSuffix),
+  };
 }
 
-void moveLeft(E *e);
-void moveRight(E *e);
-void moveLineUp(E *e);
-void moveLineDown(E *e);
-void moveToStartOfLine(E *e);
-void moveToEndOfLine(E *e);
-void moveWordBackward(E *e);
-void moveWordForward(E *e);
-void saveFile(E *e);
-void deleteCharAtCursor(E *e);
-void deleteCharBackwards(E *e);
-void startSelection(E *e);
-void escape(E *e);
-void copySelectionToKillRing(E *e);
-void yank(E *e);
+// adds a bracket to the end of a summary
+void addBracket(BracketSummary *summary, int delta) {
+  summary->net += delta;
+  summary->minPrefix = MIN(summary->minPrefix, summary->net);
+  summary->maxSuffix = MAX(summary->maxSuffix + delta, 0);
+}
 
-void setKeyHandler(E *e, const char *key, E_ActionHandler *handler) {
-  size_t keyLen = strlen(key);
-  Uint16 mod = 0;
-  E_Key *keySequence = 0;
-  for (size_t i = 0; i < keyLen; ) {
-    char c = key[i];
-    switch (c) {
-      case '\\':
-        if (i == keyLen - 1) {
-          die("key is terminated with \\");
-          return;
-        }
-        i++;
-        char next = key[i];
-        switch(next) {
-          case '\\':
-            buf_push(keySequence, ((E_Key){.sym = SDLK_BACKSLASH, .mod = mod, .hasMoreKeys = true}));
-            mod = 0;
-            break;
-          case 'C':
-            mod |= KMOD_CTRL;
-            break;
-          case 'A':
-            mod |= KMOD_ALT;
-            break;
-          case 'L':
-            buf_push(keySequence, ((E_Key){.sym = SDLK_LEFT, .mod = mod, .hasMoreKeys = true}));
-            mod = 0;
-            break;
-          case 'R':
-            buf_push(keySequence, ((E_Key){.sym = SDLK_RIGHT, .mod = mod, .hasMoreKeys = true}));
-            mod = 0;
-            break;
-          case 'U':
-            buf_push(keySequence, ((E_Key){.sym = SDLK_UP, .mod = mod, .hasMoreKeys = true}));
-            mod = 0;
-            break;
-          case 'D':
-            buf_push(keySequence, ((E_Key){.sym = SDLK_DOWN, .mod = mod, .hasMoreKeys = true}));
-            mod = 0;
-            break;
-          default:
-            die("wrong key");
-            break;
-        }
-        i++;
-        break;
-      default:
-        buf_push(keySequence, ((E_Key){.sym = c, .mod = mod, .hasMoreKeys = true}));
-        mod = 0;
-        i++;
-        break;
-    }
-  }
+// +1 for an opening bracket, -1 for a closing one, 0 for other chars
+int getBracketDelta(char c) {
+  return c == '(' || c == '[' || c == '{' ? 1 : c == ')' || c == ']' || c == '}' ? -1 : 0;
+}
 
-  if (!keySequence) {
+char getClosingBracket(char open) {
+  return open == '{' ? '}' : open == '[' ? ']' : ')';
+}
+
+// Lexer states at line starts in a gap array parallel to the line index,
+// with one more slot for the state at the text end. After an edit lines are
+// relexed from the edited one until the state at a line start matches the
+// cached one, lines below the screen are lexed when idle. A segment tree over
+// the slots sums up the brackets of the lexed lines, so the bracket matching
+// one is found in O(log n) however many lines are between them.
+typedef struct Highlight {
+  Language language;
+  Uint8 *states; // 0 until the document is highlighted
+  size_t cap; // a power of two
+  size_t gapStart;
+  size_t gapEnd;
+  size_t validLines; // start states of lines before it are up to date
+  size_t lexedLines; // start states of lines before it were computed, maybe before an edit
+  // lines before it may have changed after the start state of the line after them
+  // was computed, so relexing can't stop at them
+  size_t editedEnd;
+  // 2 * cap nodes, node i sums up nodes 2i and 2i + 1 and the leaf of slot s is
+  // node cap + s. Leaves of lines before validLines - 1 are up to date, gap ones are 0.
+  BracketSummary *brackets;
+} Highlight;
+
+size_t Highlight_getSlot(Highlight *h, size_t line) {
+  return line < h->gapStart ? line : h->gapEnd + (line - h->gapStart);
+}
+
+size_t Highlight_getLine(Highlight *h, size_t slot) {
+  return slot < h->gapStart ? slot : slot - (h->gapEnd - h->gapStart);
+}
+
+Uint8 *Highlight_get(Highlight *h, size_t line) {
+  return &h->states[Highlight_getSlot(h, line)];
+}
+
+void Highlight_free(Highlight *h) {
+  free(h->states);
+  free(h->brackets);
+  *h = (Highlight){.language = h->language};
+}
+
+// recomputes the tree nodes above the leaves of slots [start, end)
+void Highlight_sumBrackets(Highlight *h, size_t start, size_t end) {
+  if (start >= end) {
     return;
   }
-
-  E_Key **keys = &e->rootKeys;
-  size_t keySeqLen = buf_len(keySequence);
-  for (size_t i = 0; i < keySeqLen; i++) {
-    E_Key newKey = keySequence[i];
-    E_Key *installedKey = 0;
-    size_t keyLayerLen = buf_len(*keys);
-    for (size_t j = 0; j < keyLayerLen; j++) {
-      E_Key k = (*keys)[j];
-      if (k.sym == newKey.sym && (k.mod == newKey.mod || k.mod & newKey.mod)) {
-        installedKey = &(*keys)[j];
-        break;
-      }
-    }
-    if (!installedKey) {
-      buf_push(*keys, newKey);
-      installedKey = &(*keys)[buf_len(*keys) - 1];
-    }
-    keys = &installedKey->keys;
-    if (i == keySeqLen - 1) { //set handler in the last key in the sequence
-      installedKey->hasMoreKeys = false;
-      installedKey->handler = handler;
+  BracketSummary *tree = h->brackets;
+  size_t first = h->cap + start, last = h->cap + end - 1;
+  while (first > 1) {
+    first /= 2;
+    last /= 2;
+    for (size_t i = first; i <= last; i++) {
+      tree[i] = combineBrackets(tree[2 * i], tree[2 * i + 1]);
     }
   }
 }
 
-E init(char *path) {
-  FILE *file = fopen(path, "r+b");
-  if (!file) {
-    die("Open file failed");
+// recomputes the tree nodes above the leaves of lines [start, end)
+void Highlight_sumLineBrackets(Highlight *h, size_t start, size_t end) {
+  if (start >= end) {
+    return;
   }
-  if (fseek(file, 0, SEEK_END) == -1) {
-    die("Failed to get file size");
+  if (start < h->gapStart) {
+    Highlight_sumBrackets(h, start, MIN(end, h->gapStart));
   }
-  long int fileSize = ftell(file);
-  char *text = xalloc(fileSize + 1);
-  rewind(file);
-  fread(text, fileSize, 1, file);
-  text[fileSize] = '\0';
+  if (end > h->gapStart) {
+    Highlight_sumBrackets(h, Highlight_getSlot(h, MAX(start, h->gapStart)), Highlight_getSlot(h, end - 1) + 1);
+  }
+}
+
+void Highlight_grow(Highlight *h) {
+  size_t newCap = h->cap * 2;
+  Uint8 *states = xcalloc(newCap, 1);
+  BracketSummary *brackets = xcalloc(2 * newCap, sizeof(BracketSummary));
+  size_t tailLen = h->cap - h->gapEnd;
+  memcpy(states, h->states, h->gapStart);
+  memcpy(&states[newCap - tailLen], &h->states[h->gapEnd], tailLen);
+  memcpy(&brackets[newCap], &h->brackets[h->cap], h->gapStart * sizeof(BracketSummary));
+  memcpy(&brackets[2 * newCap - tailLen], &h->brackets[h->cap + h->gapEnd], tailLen * sizeof(BracketSummary));
+  free(h->states);
+  free(h->brackets);
+  h->states = states;
+  h->brackets = brackets;
+  h->gapEnd = newCap - tailLen;
+  h->cap = newCap;
+  Highlight_sumBrackets(h, 0, newCap);
+}
+
+// moves count leaves from slot from to slot to after the gap moved,
+// the ones left in the gap become 0
+void Highlight_moveBrackets(Highlight *h, size_t from, size_t to, size_t count) {
+  BracketSummary *leaves = &h->brackets[h->cap];
+  memmove(&leaves[to], &leaves[from], count * sizeof(BracketSummary));
+  size_t gapStart = MAX(from, h->gapStart), gapEnd = MIN(from + count, h->gapEnd);
+  if (gapStart < gapEnd) {
+    memset(&leaves[gapStart], 0, (gapEnd - gapStart) * sizeof(BracketSummary));
+  }
+  if (MAX(from, to) - MIN(from, to) < count) {
+    Highlight_sumBrackets(h, MIN(from, to), MAX(from, to) + count);
+  } else {
+    Highlight_sumBrackets(h, from, from + count);
+    Highlight_sumBrackets(h, to, to + count);
+  }
+}
+
+void Highlight_moveGap(Highlight *h, size_t line) {
+  if (line < h->gapStart) {
+    size_t count = h->gapStart - line;
+    memmove(&h->states[h->gapEnd - count], &h->states[line], count);
+    h->gapStart -= count;
+    h->gapEnd -= count;
+    Highlight_moveBrackets(h, line, h->gapEnd, count);
+  } else if (line > h->gapStart) {
+    size_t count = line - h->gapStart;
+    memmove(&h->states[h->gapStart], &h->states[h->gapEnd], count);
+    h->gapStart += count;
+    h->gapEnd += count;
+    Highlight_moveBrackets(h, h->gapEnd - count, h->gapStart - count, count);
+  }
+}
+
+// line was edited, deletedLines lines after it were joined into it
+// and insertedLines lines were split off it
+void Highlight_edit(Highlight *h, size_t line, size_t deletedLines, size_t insertedLines) {
+  if (!h->states) {
+    return;
+  }
+  Highlight_moveGap(h, line + 1);
+  memset(&h->brackets[h->cap + h->gapEnd], 0, deletedLines * sizeof(BracketSummary));
+  Highlight_sumBrackets(h, h->gapEnd, h->gapEnd + deletedLines);
+  h->gapEnd += deletedLines;
+  for (size_t i = 0; i < insertedLines; i++) {
+    if (h->gapStart == h->gapEnd) {
+      Highlight_grow(h);
+    }
+    h->states[h->gapStart++] = LEX_NORMAL;
+  }
+  if (h->lexedLines > line + 1) {
+    h->lexedLines = MAX(h->lexedLines, line + 1 + deletedLines) - deletedLines + insertedLines;
+  }
+  if (h->editedEnd > line + 1) {
+    h->editedEnd = MAX(h->editedEnd, line + 1 + deletedLines) - deletedLines + insertedLines;
+  }
+  h->editedEnd = MAX(h->editedEnd, line + 1 + insertedLines);
+  h->validLines = MIN(h->validLines, line + 1);
+}
+
+// Bracket pair of the syntax tree. Offsets are relative to the parent's
+// opening bracket, so an edit changes only the nodes on its path and the
+// starts of their later siblings.
+typedef struct SyntaxNode {
+  size_t start; // of the opening bracket
+  size_t length; // up to and including the closing bracket
+  char open;
+  bool closed; // false if the node ends without its closing bracket
+  struct SyntaxNode *children; // stretchy buf
+} SyntaxNode;
+
+// Brackets outside of comments, strings and directives nested into a tree
+// under a root spanning the text. Built on first use, an edit then reparses
+// only the smallest node around it whose brackets stay the same.
+typedef struct SyntaxTree {
+  SyntaxNode root;
+  bool built;
+} SyntaxTree;
+
+void SyntaxNode_free(SyntaxNode *node) {
+  for (size_t i = 0; i < buf_len(node->children); i++) {
+    SyntaxNode_free(&node->children[i]);
+  }
+  buf_free(node->children);
+}
+
+void SyntaxTree_free(SyntaxTree *tree) {
+  SyntaxNode_free(&tree->root);
+  *tree = (SyntaxTree){0};
+}
+
+typedef struct Document {
+  const char *path;
+  const char *fileName;
+  Buffer buffer;
+  View view;
+  Uint32 lastShownTicks; // SDL_GetTicks() of the last frame showing the document
+  // long lines measured recently, so that positions far into them
+  // are found without measuring everything to the left
+  LineCheckpoints longLines[CHECKPOINT_CACHE_SIZE];
+  Highlight highlight;
+  SyntaxTree syntax;
+  size_t gutterLineCount; // line count gutterWidth was measured for, 0 if it needs measuring
+  int gutterWidth;
+} Document;
+
+enum {
+  // documents not shown for that long give their spare memory back
+  DOCUMENT_IDLE_MS = 30 * 1000,
+  DOCUMENT_COMPACT_INTERVAL_MS = 1000,
+  PANE_BORDER = 1,
+  // pixels left and right of the line numbers
+  GUTTER_PADDING = 6,
+  // lines of the screen still shown after C-v or M-v
+  PAGE_CONTEXT_LINES = 2,
+  WHEEL_SCROLL_LINES = 3,
+  // a step of the wheel scroll animation goes its ms / SCROLL_ANIMATION_MS
+  // share of the rest of the way
+  SCROLL_ANIMATION_MS = 50,
+};
+
+// Rows of a line in soft wrap mode, the breaks stay valid while the line
+// moves since they are relative to the line start
+typedef struct WrapLine {
+  Uint32 *breaks; // stretchy buf, offsets from the line start where the second and later rows start
+  int width; // wrap width the breaks were computed for, 0 if the line needs wrapping
+} WrapLine;
+
+// Wrapped rows of each line of the document shown in a pane, in a gap array
+// parallel to the line index. Lines are wrapped on first use after an edit
+// or a width change, so a resize only rewraps the lines which are shown.
+typedef struct WrapLayout {
+  Document *doc; // document the lines belong to, 0 if the layout is not built
+  WrapLine *lines;
+  size_t cap;
+  size_t gapStart;
+  size_t gapEnd;
+  int width; // current wrap width, lines wrapped for another width are stale
+} WrapLayout;
+
+WrapLine *WrapLayout_get(WrapLayout *layout, size_t line) {
+  return &layout->lines[line < layout->gapStart ? line : layout->gapEnd + (line - layout->gapStart)];
+}
+
+void WrapLayout_free(WrapLayout *layout) {
+  for (size_t i = 0; i < layout->cap; i++) {
+    if (i < layout->gapStart || i >= layout->gapEnd) {
+      buf_free(layout->lines[i].breaks);
+    }
+  }
+  free(layout->lines);
+  *layout = (WrapLayout){.width = layout->width};
+}
+
+void WrapLayout_reset(WrapLayout *layout, Document *doc, size_t lineCount) {
+  WrapLayout_free(layout);
+  layout->doc = doc;
+  layout->cap = MAX(lineCount * 2, 64);
+  layout->lines = xcalloc(layout->cap, sizeof(WrapLine));
+  layout->gapStart = lineCount;
+  layout->gapEnd = layout->cap;
+}
+
+void WrapLayout_grow(WrapLayout *layout) {
+  size_t newCap = layout->cap * 2;
+  WrapLine *lines = xcalloc(newCap, sizeof(WrapLine));
+  size_t tailLen = layout->cap - layout->gapEnd;
+  memcpy(lines, layout->lines, layout->gapStart * sizeof(WrapLine));
+  memcpy(&lines[newCap - tailLen], &layout->lines[layout->gapEnd], tailLen * sizeof(WrapLine));
+  free(layout->lines);
+  layout->lines = lines;
+  layout->gapEnd = newCap - tailLen;
+  layout->cap = newCap;
+}
+
+void WrapLayout_moveGap(WrapLayout *layout, size_t line) {
+  while (layout->gapStart > line) {
+    layout->lines[--layout->gapEnd] = layout->lines[--layout->gapStart];
+  }
+  while (layout->gapStart < line) {
+    layout->lines[layout->gapStart++] = layout->lines[layout->gapEnd++];
+  }
+}
+
+// line was edited, deletedLines lines after it were joined into it
+// and insertedLines lines were split off it
+void WrapLayout_edit(WrapLayout *layout, size_t line, size_t deletedLines, size_t insertedLines) {
+  WrapLayout_moveGap(layout, line + 1);
+  WrapLayout_get(layout, line)->width = 0;
+  for (size_t i = 0; i < deletedLines; i++) {
+    WrapLine *deleted = &layout->lines[layout->gapEnd++];
+    buf_free(deleted->breaks);
+  }
+  for (size_t i = 0; i < insertedLines; i++) {
+    if (layout->gapStart == layout->gapEnd) {
+      WrapLayout_grow(layout);
+    }
+    layout->lines[layout->gapStart++] = (WrapLine){0};
+  }
+}
+
+// Area of the window showing a document. Panes form a binary tree of splits,
+// leaves show documents, several leaves may show the same document.
+typedef struct Pane {
+  struct Pane *parent;
+  struct Pane *first; // children of a split, 0 for a leaf
+  struct Pane *second;
+  bool sideBySide; // children are split left and right instead of top and bottom
+  Document *doc;
+  View view;
+  SDL_Rect rect;
+  int visibleLineCount; // number of visible lines in the pane
+  WrapLayout wrap; // built on demand in soft wrap mode
+} Pane;
+
+enum {
+  // texture memory of the line cache, rows beyond it evict the least recently used ones
+  LINE_CACHE_BYTES = 16 * 1024 * 1024,
+  // rows further than that from their line start are drawn directly,
+  // hashing them would cost about as much as drawing them
+  LINE_CACHE_ROW_MAX = 1024,
+};
+
+typedef struct LineCacheRow {
+  Uint64 key;
+  Uint64 lastUsedFrame; // 0 if the row is free
+} LineCacheRow;
+
+// Rows of text rasterized once into a target texture and blitted while they
+// stay the same, enabled with --line-cache. A row is keyed by a hash of
+// everything its pixels depend on, so an edited line simply misses and its
+// old row ages out.
+typedef struct LineCache {
+  bool enabled;
+  SDL_Texture *texture;
+  int width; // of the texture and of each row
+  int rowHeight;
+  int baseline; // y of the baseline in a row
+  LineCacheRow *rows; // row i is at y = i * rowHeight
+  int rowCount;
+  Uint64 frame;
+  Uint64 hits;
+  Uint64 misses;
+} LineCache;
+
+void LineCache_free(LineCache *cache) {
+  if (cache->texture) {
+    SDL_DestroyTexture(cache->texture);
+  }
+  free(cache->rows);
+  cache->texture = 0;
+  cache->rows = 0;
+  cache->rowCount = 0;
+}
+
+// the texture contents were lost, rows are drawn again
+void LineCache_clear(LineCache *cache) {
+  for (int i = 0; i < cache->rowCount; i++) {
+    cache->rows[i].lastUsedFrame = 0;
+  }
+}
+
+int LineCache_find(LineCache *cache, Uint64 key) {
+  for (int i = 0; i < cache->rowCount; i++) {
+    LineCacheRow *row = &cache->rows[i];
+    if (row->lastUsedFrame && row->key == key) {
+      row->lastUsedFrame = cache->frame;
+      return i;
+    }
+  }
+  return -1;
+}
+
+// takes a free or the least recently used row for key, -1 if all rows are shown in this frame
+int LineCache_claim(LineCache *cache, Uint64 key) {
+  int result = -1;
+  for (int i = 0; i < cache->rowCount; i++) {
+    Uint64 lastUsedFrame = cache->rows[i].lastUsedFrame;
+    if (lastUsedFrame != cache->frame && (result < 0 || lastUsedFrame < cache->rows[result].lastUsedFrame)) {
+      result = i;
+    }
+  }
+  if (result >= 0) {
+    cache->rows[result] = (LineCacheRow){.key = key, .lastUsedFrame = cache->frame};
+  }
+  return result;
+}
+
+// Frames drawn on the CPU and uploaded to a streaming texture, enabled with
+// --framebuffer. Glyph coverage is blended straight into the pixels and only
+// runs of scanlines that differ from the shown frame are uploaded.
+typedef struct Framebuffer {
+  bool enabled;
+  SDL_Texture *texture;
+  Uint32 *pixels; // ARGB of the frame being drawn
+  Uint32 *shown; // pixels of the texture
+  int width;
+  int height;
+  SDL_Rect clip; // viewport being drawn into, drawing is relative to its origin
+  bool uploadAll; // the texture is new
+} Framebuffer;
+
+void Framebuffer_free(Framebuffer *fb) {
+  if (fb->texture) {
+    SDL_DestroyTexture(fb->texture);
+  }
+  free(fb->pixels);
+  free(fb->shown);
+  fb->texture = 0;
+  fb->pixels = 0;
+  fb->shown = 0;
+}
+
+// translates rect from the viewport into the framebuffer and clips it to both,
+// returns false if nothing is left
+bool Framebuffer_clip(Framebuffer *fb, SDL_Rect *rect) {
+  int x0 = MAX(rect->x + fb->clip.x, MAX(fb->clip.x, 0));
+  int y0 = MAX(rect->y + fb->clip.y, MAX(fb->clip.y, 0));
+  int x1 = MIN(rect->x + rect->w + fb->clip.x, MIN(fb->clip.x + fb->clip.w, fb->width));
+  int y1 = MIN(rect->y + rect->h + fb->clip.y, MIN(fb->clip.y + fb->clip.h, fb->height));
+  if (x0 >= x1 || y0 >= y1) {
+    return false;
+  }
+  *rect = (SDL_Rect){x0, y0, x1 - x0, y1 - y0};
+  return true;
+}
+
+// Blends count pixels of color (0xRRGGBB) with the given coverage over dst,
+// 4 pixels at a time with SSE2. Both paths round x / 255 the same way.
+void blendSpan(Uint32 *dst, const Uint8 *coverage, int count, Uint32 color) {
+  int i = 0;
+#ifdef __SSE2__
+  __m128i zero = _mm_setzero_si128();
+  __m128i src = _mm_unpacklo_epi8(_mm_set1_epi32(0xff000000 | color), zero);
+  __m128i max = _mm_set1_epi16(255);
+  __m128i bias = _mm_set1_epi16(128);
+  for (; i + 4 <= count; i += 4) {
+    Uint32 alphas;
+    memcpy(&alphas, &coverage[i], sizeof(alphas));
+    if (!alphas) {
+      continue;
+    }
+    // each alpha repeated over the 4 channels of its pixel
+    __m128i a = _mm_unpacklo_epi8(_mm_cvtsi32_si128(alphas), zero);
+    a = _mm_unpacklo_epi16(a, a);
+    __m128i alpha[2] = {_mm_unpacklo_epi32(a, a), _mm_unpackhi_epi32(a, a)};
+    __m128i d = _mm_loadu_si128((__m128i *) &dst[i]);
+    __m128i pixels[2] = {_mm_unpacklo_epi8(d, zero), _mm_unpackhi_epi8(d, zero)};
+    for (int j = 0; j < 2; j++) {
+      __m128i v = _mm_add_epi16(_mm_mullo_epi16(src, alpha[j]), _mm_mullo_epi16(pixels[j], _mm_sub_epi16(max, alpha[j])));
+      v = _mm_add_epi16(v, bias);
+      pixels[j] = _mm_srli_epi16(_mm_add_epi16(v, _mm_srli_epi16(v, 8)), 8);
+    }
+    // the alpha channel of both is 255 and stays so
+    _mm_storeu_si128((__m128i *) &dst[i], _mm_packus_epi16(pixels[0], pixels[1]));
+  }
+#endif
+  for (; i < count; i++) {
+    Uint32 a = coverage[i];
+    if (!a) {
+      continue;
+    }
+    Uint32 d = dst[i];
+    Uint32 result = 0xff000000;
+    for (int shift = 0; shift < 24; shift += 8) {
+      Uint32 v = ((color >> shift) & 0xff) * a + ((d >> shift) & 0xff) * (255 - a) + 128;
+      result |= ((v + (v >> 8)) >> 8) << shift;
+    }
+    dst[i] = result;
+  }
+}
+
+typedef struct E {
+  Document **docs; // stretchy buf, pointers stay valid when documents are added
+  Uint32 lastCompactTicks; // SDL_GetTicks() of the last compactIdleDocuments
+  Pane *rootPane;
+  Pane *pane; // selected leaf
+  Document *doc; // pane->doc
+  View *view; // &pane->view
+
+  char *text;
+
+  char lineBuf[1000];
+  const char *error;
+  bool quit;
+  int height;
+  int width;
+  int textHeight;
+  int statusLineHeight;
+  int statusLineBaselineOffset;
+
+  KillRing killRing;
+
+  int lineHeight;
+
+  SDL_Window *window;
+  SDL_Renderer *renderer;
+  SDL_Surface *surface; // render target in headless mode
+  bool headless;
+  Recorder recorder;
+  Server server;
+
+  const Uint8 *fontData; // embedded font or fontFile
+  size_t fontDataSize;
+  Uint8 *fontFile; // font loaded with --font, 0 if the embedded one is used
+  E_Glyph glyphs[GLYPH_COUNT];
+  E_Glyph *shownGlyphs[256]; // drawn for each byte, a marker or the glyph measured by layout
+  Uint8 markers; // bit 1 << Marker for each kind of marker shown
+  SDL_Texture *glyphSheet; // bitmaps of all glyphs, see E_GlyphBitmap.sheetX
+  Uint8 *glyphPixels; // coverage of all glyphs, see E_Glyph.coverage
+  FT_Pos kerning[256 * 256];
+  int fontSize; // size and dpi the glyphs were rasterized for
+  int dpi;
+  FontLoader fontLoader;
+
+  Uint64 perfCountFreqMS;
+  Latency latency;
+  StartupProfile startup;
+
+  E_KeyMap *rootKeys;
+  E_KeyMap *curKeys;
+  SDL_Keysym lastKey; // key which invoked the running handler
+  // a key press was consumed by a key binding, drop the text it produces;
+  // in a prefix layer the text is used to resolve the key instead, see handleKey
+  bool swallowTextInput;
+  size_t prefixArg; // numeric argument entered with M-<digits>, 0 if not set
+  Macro macro;
+  bool showDocumentList;
+  bool softWrap; // long lines wrap into rows instead of scrolling horizontally
+  bool lineNumbers; // panes show line numbers in a gutter left of the text
+  Uint8 *lineStyles; // stretchy buf, styles of the line being rendered
+  size_t *lineBrackets; // stretchy buf, brackets of the line being matched
+  int batchDepth; // > 0 while handlers are applied in a batch without intermediate layout
+  LineCache lineCache;
+  Framebuffer framebuffer;
+} E;
+
+
+void setEditorError(E *e, const char *error) {
+  e->error = error;
+}
+
+// profile is 0 for phases run off the UI thread, they are neither timed nor traced
+void recordProfilePhase(StartupProfile *profile, StartupPhase phase, Uint64 start) {
+  if (!profile) {
+    return;
+  }
+  profile->durations[phase] += SDL_GetPerformanceCounter() - start;
+  traceRecord(startupPhaseNames[phase], start, -1);
+}
+
+void recordStartupPhase(E *e, StartupPhase phase, Uint64 start) {
+  recordProfilePhase(&e->startup, phase, start);
+}
+
+// prints the startup phases once, after the first frame was presented
+void printStartupProfile(E *e) {
+  if (!e->startup.print) {
+    return;
+  }
+  e->startup.print = false;
+  Uint64 end = SDL_GetPerformanceCounter();
+  for (int i = 0; i < STARTUP_PHASE_COUNT; i++) {
+    if (e->startup.durations[i]) {
+      printf("%-20s %8.2fms\n", startupPhaseNames[i], e->startup.durations[i] / (double) e->perfCountFreqMS);
+    }
+  }
+  printf("%-20s %8.2fms\n", "total", (end - e->startup.start) / (double) e->perfCountFreqMS);
+}
+
+void moveLeft(E *e);
+void moveRight(E *e);
+void moveLineUp(E *e);
+void moveLineDown(E *e);
+void moveToStartOfLine(E *e);
+void moveToEndOfLine(E *e);
+void moveWordBackward(E *e);
+void moveWordForward(E *e);
+void saveFile(E *e);
+void stopServer(E *e);
+void deleteCharAtCursor(E *e);
+void deleteCharBackwards(E *e);
+void startSelection(E *e);
+void escape(E *e);
+void copySelectionToKillRing(E *e);
+void yank(E *e);
+void toggleLatencyOverlay(E *e);
+void saveTrace(E *e);
+void startMacro(E *e);
+void endMacro(E *e);
+void executeMacro(E *e);
+void digitArgument(E *e);
+void nextDocument(E *e);
+void previousDocument(E *e);
+void toggleDocumentList(E *e);
+void toggleSoftWrap(E *e);
+void toggleWhitespaceMarkers(E *e);
+void toggleLineNumbers(E *e);
+void splitPaneBelow(E *e);
+void splitPaneRight(E *e);
+void selectNextPane(E *e);
+void deletePane(E *e);
+void deleteOtherPanes(E *e);
+void forwardList(E *e);
+void backwardList(E *e);
+void backwardUpList(E *e);
+void beginningOfDefun(E *e);
+void endOfDefun(E *e);
+void jumpToMatchingBracket(E *e);
+void goToLine(E *e);
+void goToChar(E *e);
+void scrollPageDown(E *e);
+void scrollPageUp(E *e);
+void zoomIn(E *e);
+void zoomOut(E *e);
+void resetZoom(E *e);
+void freeWrapLayouts(Pane *pane);
+void resetVisibleLines(E *e, Pane *pane);
+
+void installKeySequence(E *e, E_Key *keySequence, size_t keySeqLen, E_ActionHandler *handler) {
+  if (!e->rootKeys) {
+    e->rootKeys = xcalloc(1, sizeof(E_KeyMap));
+  }
+  E_KeyMap *keys = e->rootKeys;
+  for (size_t i = 0; i < keySeqLen; i++) {
+    E_Key newKey = keySequence[i];
+    newKey.mod = normalizeKeyMod(newKey.mod);
+    newKey.keys = 0;
+    E_Key *installedKey = E_KeyMap_put(keys, newKey);
+    if (i == keySeqLen - 1) { //set handler in the last key in the sequence
+      installedKey->hasMoreKeys = false;
+      installedKey->handler = handler;
+    } else {
+      if (!installedKey->hasMoreKeys || !installedKey->keys) {
+        installedKey->hasMoreKeys = true;
+        installedKey->keys = xcalloc(1, sizeof(E_KeyMap));
+      }
+      keys = installedKey->keys;
+    }
+  }
+}
+
+void setKeyHandler(E *e, const char *key, E_ActionHandler *handler) {
+  size_t keyLen = strlen(key);
+  Uint16 mod = 0;
+  E_Key *keySequence = 0;
+  for (size_t i = 0; i < keyLen; ) {
+    char c = key[i];
+    switch (c) {
+      case '\\':
+        if (i == keyLen - 1) {
+          die("key is terminated with \\");
+          return;
+        }
+        i++;
+        char next = key[i];
+        switch(next) {
+          case '\\':
+            buf_push(keySequence, ((E_Key){.sym = SDLK_BACKSLASH, .mod = mod, .hasMoreKeys = true}));
+            mod = 0;
+            break;
+          case 'C':
+            mod |= KMOD_CTRL;
+            break;
+          case 'A':
+            mod |= KMOD_ALT;
+            break;
+          case 'S':
+            mod |= KMOD_SHIFT;
+            break;
+          case 'L':
+            buf_push(keySequence, ((E_Key){.sym = SDLK_LEFT, .mod = mod, .hasMoreKeys = true}));
+            mod = 0;
+            break;
+          case 'R':
+            buf_push(keySequence, ((E_Key){.sym = SDLK_RIGHT, .mod = mod, .hasMoreKeys = true}));
+            mod = 0;
+            break;
+          case 'U':
+            buf_push(keySequence, ((E_Key){.sym = SDLK_UP, .mod = mod, .hasMoreKeys = true}));
+            mod = 0;
+            break;
+          case 'D':
+            buf_push(keySequence, ((E_Key){.sym = SDLK_DOWN, .mod = mod, .hasMoreKeys = true}));
+            mod = 0;
+            break;
+          default:
+            die("wrong key");
+            break;
+        }
+        i++;
+        break;
+      default:
+        buf_push(keySequence, ((E_Key){.sym = c, .mod = mod, .hasMoreKeys = true}));
+        mod = 0;
+        i++;
+        break;
+    }
+  }
+
+  if (!keySequence) {
+    return;
+  }
+
+  installKeySequence(e, keySequence, buf_len(keySequence), handler);
+  buf_free(keySequence);
+}
+
+Language getLanguage(const char *fileName) {
+  const char *extension = strrchr(fileName, '.');
+  if (!extension) {
+    return LANGUAGE_NONE;
+  }
+  const char *cExtensions[] = {".c", ".h", ".cc", ".cpp", ".hpp", ".cxx"};
+  for (size_t i = 0; i < SDL_arraysize(cExtensions); i++) {
+    if (strcmp(extension, cExtensions[i]) == 0) {
+      return LANGUAGE_C;
+    }
+  }
+  if (strcmp(extension, ".json") == 0) {
+    return LANGUAGE_JSON;
+  }
+  return LANGUAGE_NONE;
+}
+
+// takes ownership of text, path is copied
+Document *createDocument(const char *path, char *text, size_t textSize) {
+  // file name
+  const char *fileName = path ? path : "";
+  for (const char *c = fileName; *c; c++) {
+    if (*c == '/') {
+      fileName = c + 1;
+    }
+  }
+
+  Document *doc = xcalloc(1, sizeof(Document));
+  *doc = (Document) {
+          .path = path ? strdup(path) : 0,
+          .fileName = strdup(fileName),
+          .buffer = {
+                  .text = text,
+                  .bufferSize = textSize + 1,
+          },
+          .lastShownTicks = SDL_GetTicks(),
+          .highlight.language = getLanguage(fileName),
+  };
+  initLineIndex(&doc->buffer);
+  return doc;
+}
+
+// returns 0 with errno set if the file can't be read
+Document *openDocument(const char *path) {
+  FILE *file = fopen(path, "r+b");
+  if (!file) {
+    return 0;
+  }
+  if (fseek(file, 0, SEEK_END) == -1) {
+    fclose(file);
+    return 0;
+  }
+  long int fileSize = ftell(file);
+  char *text = xalloc(fileSize + 1);
+  rewind(file);
+  fread(text, fileSize, 1, file);
+  text[fileSize] = '\0';
+  fclose(file);
+  return createDocument(path, text, fileSize);
+}
+
+void freeLineCheckpoints(Document *doc) {
+  for (int i = 0; i < CHECKPOINT_CACHE_SIZE; i++) {
+    buf_free(doc->longLines[i].checkpoints);
+  }
+}
+
+void freeDocument(Document *doc) {
+  freeLineCheckpoints(doc);
+  Highlight_free(&doc->highlight);
+  SyntaxTree_free(&doc->syntax);
+  free(doc->buffer.text);
+  free(doc->buffer.lines.newlines);
+  free((char *) doc->path);
+  free((char *) doc->fileName);
+  free(doc);
+}
+
+E init(char **paths, size_t pathCount) {
+  E e = (E) {
+          .height=768,
+          .width=1024,
+          .perfCountFreqMS = SDL_GetPerformanceFrequency() / 1000,
+          .startup.start = SDL_GetPerformanceCounter(),
+          .fontData = font,
+          .fontDataSize = FONT_END - font,
+          .fontLoader = {.fontSize = FONT_SIZE, .dpi = FONT_DPI},
+          .markers = MARKERS_DEFAULT,
+  };
+  for (size_t i = 0; i < pathCount; i++) {
+    Document *doc = openDocument(paths[i]);
+    if (!doc) {
+      die("Open file failed");
+    }
+    buf_push(e.docs, doc);
+  }
+  recordStartupPhase(&e, STARTUP_FILE_READ, e.startup.start);
+  if (!e.docs) {
+    // a server started without files waits for the first one in a hidden window
+    char *text = xalloc(1);
+    text[0] = '\0';
+    buf_push(e.docs, createDocument(0, text, 0));
+  }
+  e.rootPane = xcalloc(1, sizeof(Pane));
+  *e.rootPane = (Pane){.doc = e.docs[0], .view = e.docs[0]->view};
+  e.pane = e.rootPane;
+  e.doc = e.pane->doc;
+  e.view = &e.pane->view;
+
+  setKeyHandler(&e, "\\L", moveLeft);
+  setKeyHandler(&e, "\\Cb", moveLeft);
+  setKeyHandler(&e, "\\R", moveRight);
+  setKeyHandler(&e, "\\Cf", moveRight);
+  setKeyHandler(&e, "\\U", moveLineUp);
+  setKeyHandler(&e, "\\Cp", moveLineUp);
+  setKeyHandler(&e, "\\D", moveLineDown);
+  setKeyHandler(&e, "\\Cn", moveLineDown);
+  setKeyHandler(&e, "\\Ca", moveToStartOfLine);
+  setKeyHandler(&e, "\\Ce", moveToEndOfLine);
+  setKeyHandler(&e, "\\Ab", moveWordBackward);
+  setKeyHandler(&e, "\\Af", moveWordForward);
+  setKeyHandler(&e, "\\Cd", deleteCharAtCursor);
+  setKeyHandler(&e, "\\Ch", deleteCharBackwards);
+  setKeyHandler(&e, "\\C ", startSelection);
+  setKeyHandler(&e, "\\Cg", escape);
+  setKeyHandler(&e, "\\Aw", copySelectionToKillRing);
+  setKeyHandler(&e, "\\Cy", yank);
+  setKeyHandler(&e, "\\Cx\\Cs", saveFile);
+  setKeyHandler(&e, "\\Cx\\Cl", toggleLatencyOverlay);
+  setKeyHandler(&e, "\\Cx\\Ct", saveTrace);
+  setKeyHandler(&e, "\\Cx(", startMacro);
+  setKeyHandler(&e, "\\Cx)", endMacro);
+  setKeyHandler(&e, "\\Cxe", executeMacro);
+  setKeyHandler(&e, "\\Cx\\R", nextDocument);
+  setKeyHandler(&e, "\\Cx\\L", previousDocument);
+  setKeyHandler(&e, "\\Cx\\Cb", toggleDocumentList);
+  setKeyHandler(&e, "\\Cx2", splitPaneBelow);
+  setKeyHandler(&e, "\\Cx3", splitPaneRight);
+  setKeyHandler(&e, "\\Cxo", selectNextPane);
+  setKeyHandler(&e, "\\Cx0", deletePane);
+  setKeyHandler(&e, "\\Cx1", deleteOtherPanes);
+  setKeyHandler(&e, "\\Cxw", toggleSoftWrap);
+  setKeyHandler(&e, "\\Cxm", toggleWhitespaceMarkers);
+  setKeyHandler(&e, "\\Cxn", toggleLineNumbers);
+  setKeyHandler(&e, "\\C\\Af", forwardList);
+  setKeyHandler(&e, "\\C\\Ab", backwardList);
+  setKeyHandler(&e, "\\C\\Au", backwardUpList);
+  setKeyHandler(&e, "\\C\\Aa", beginningOfDefun);
+  setKeyHandler(&e, "\\C\\Ae", endOfDefun);
+  setKeyHandler(&e, "\\C\\Am", jumpToMatchingBracket);
+  setKeyHandler(&e, "\\Agg", goToLine);
+  setKeyHandler(&e, "\\Ag\\Ag", goToLine);
+  setKeyHandler(&e, "\\Agc", goToChar);
+  setKeyHandler(&e, "\\Cv", scrollPageDown);
+  setKeyHandler(&e, "\\Av", scrollPageUp);
+  setKeyHandler(&e, "\\C=", zoomIn);
+  setKeyHandler(&e, "\\C\\S=", zoomIn);
+  setKeyHandler(&e, "\\C+", zoomIn);
+  setKeyHandler(&e, "\\C-", zoomOut);
+  setKeyHandler(&e, "\\C0", resetZoom);
+  for (char digit[] = "\\A0"; digit[2] <= '9'; digit[2]++) {
+    setKeyHandler(&e, digit, digitArgument);
+  }
+
+  e.curKeys = e.rootKeys;
+
+  return e;
+}
+
+
+// keeps the cursor line on the screen when the number of visible lines shrinks
+void clampVisibleLineCursor(View *view, int visibleLineCount) {
+  if (view->visibleLineCursor >= visibleLineCount) {
+    int shift = view->visibleLineCursor - (visibleLineCount - 1);
+    view->visibleLineCursor -= shift;
+    view->visibleLineTop += shift;
+  }
+}
+
+void layoutPane(E *e, Pane *pane, SDL_Rect rect) {
+  pane->rect = rect;
+  if (pane->first) {
+    SDL_Rect first = rect;
+    SDL_Rect second = rect;
+    if (pane->sideBySide) {
+      first.w = rect.w / 2;
+      second.x = rect.x + first.w + PANE_BORDER;
+      second.w = rect.w - first.w - PANE_BORDER;
+    } else {
+      first.h = rect.h / 2;
+      second.y = rect.y + first.h + PANE_BORDER;
+      second.h = rect.h - first.h - PANE_BORDER;
+    }
+    layoutPane(e, pane->first, first);
+    layoutPane(e, pane->second, second);
+  } else {
+    pane->visibleLineCount = MAX(floor((rect.h - e->statusLineHeight) * 1.0 / e->lineHeight), 1);
+    clampVisibleLineCursor(&pane->view, pane->visibleLineCount);
+  }
+}
+
+void initVisibleLines(E *e) {
+  e->statusLineHeight = e->lineHeight + e->statusLineBaselineOffset;
+  e->textHeight = e->height - e->statusLineHeight;
+  layoutPane(e, e->rootPane, (SDL_Rect){0, 0, e->width, e->textHeight});
+}
+
+
+int getKerning(E *e, unsigned char left, unsigned char right) {
+  return e->kerning[left * 256 + right];
+}
+
+E_Glyph *getGlyph(E *e, unsigned char c) {
+  return e->glyphs[c].initialized ? &e->glyphs[c] : &e->glyphs['?'];
+}
+
+// x after the glyph of c drawn at x, a tab reaches the next tab stop. Stops are
+// measured from the start of the row, layout caches keep x where they stop.
+Sint64 advanceX(E *e, Sint64 x, char c) {
+  if (c == '\t') {
+    Sint64 tabWidth = e->glyphs['\t'].advance;
+    return (x / tabWidth + 1) * tabWidth;
+  }
+  return x + getGlyph(e, c)->advance;
+}
+
+// Markers replace the glyphs drawn for their bytes, a lookup per glyph picks
+// them. Layout keeps measuring the bytes with getGlyph and advanceX.
+void updateShownGlyphs(E *e) {
+  for (int c = 0; c < 256; c++) {
+    Marker marker = MARKER_COUNT;
+    if (c == '\t') {
+      marker = MARKER_TAB;
+    } else if (c == '\r') {
+      marker = MARKER_CR;
+    } else if ((c < ' ' && c != '\n') || c == 127) {
+      marker = MARKER_CONTROL;
+    }
+    bool shown = marker != MARKER_COUNT && (e->markers & 1 << marker) && e->glyphs[GLYPH_MARKERS + marker].initialized;
+    e->shownGlyphs[c] = shown ? &e->glyphs[GLYPH_MARKERS + marker] : getGlyph(e, c);
+  }
+}
+
+Uint64 hashBytes(Uint64 hash, const void *data, size_t size) {
+  // FNV-1a, start with 0xcbf29ce484222325
+  const Uint8 *bytes = data;
+  for (size_t i = 0; i < size; i++) {
+    hash ^= bytes[i];
+    hash *= 0x100000001b3ULL;
+  }
+  return hash;
+}
+
+// $XDG_CACHE_HOME/e/font-<hash>-<size>-<dpi>, directories are created on demand
+bool getFontCachePath(FontAtlas *atlas, char *path, size_t size, bool create) {
+  const char *cacheHome = getenv("XDG_CACHE_HOME");
+  const char *home = getenv("HOME");
+  int len;
+  if (cacheHome && cacheHome[0]) {
+    len = snprintf(path, size, "%s", cacheHome);
+  } else if (home && home[0]) {
+    len = snprintf(path, size, "%s/.cache", home);
+  } else {
+    return false;
+  }
+  if (create) {
+    mkdir(path, 0700);
+  }
+  len += snprintf(path + len, size - MIN(len, size), "/e");
+  if (create) {
+    mkdir(path, 0700);
+  }
+  len += snprintf(path + len, size - MIN(len, size), "/font-%016" PRIx64 "-%d-%d",
+                  atlas->fontHash, atlas->fontSize, atlas->dpi);
+  return len < size;
+}
+
+// reads the atlas cached for the key set in atlas, false if there is no valid one
+bool loadFontAtlas(FontAtlas *atlas) {
+  char path[PATH_MAX];
+  FILE *file = getFontCachePath(atlas, path, sizeof(path), false) ? fopen(path, "rb") : 0;
+  if (!file) {
+    return false;
+  }
+  FontAtlas cached;
+  bool valid = fread(&cached, offsetof(FontAtlas, pixels), 1, file) == 1 &&
+               memcmp(cached.magic, atlas->magic, 4) == 0 && cached.version == atlas->version &&
+               cached.fontHash == atlas->fontHash && cached.fontSize == atlas->fontSize && cached.dpi == atlas->dpi;
+  for (int c = 0; valid && c < GLYPH_COUNT; c++) {
+    for (int i = 0; valid && i < GLYPH_SUBPIXELS; i++) {
+      FontAtlasBitmap *bitmap = &cached.glyphs[c].bitmaps[i];
+      valid = bitmap->w >= 0 && bitmap->h >= 0 &&
+              (Uint64) bitmap->pixelOffset + (Uint64) bitmap->w * bitmap->h <= cached.pixelsSize;
+    }
+  }
+  if (valid) {
+    cached.pixels = xalloc(cached.pixelsSize + 1);
+    valid = fread(cached.pixels, 1, cached.pixelsSize, file) == cached.pixelsSize;
+    if (!valid) {
+      free(cached.pixels);
+    }
+  }
+  fclose(file);
+  if (valid) {
+    *atlas = cached;
+  }
+  return valid;
+}
+
+void saveFontAtlas(FontAtlas *atlas) {
+  char path[PATH_MAX];
+  char tmpPath[PATH_MAX + 16];
+  if (!getFontCachePath(atlas, path, sizeof(path), true)) {
+    return;
+  }
+  // written next to the cache and renamed, a concurrent start never reads a partial file
+  snprintf(tmpPath, sizeof(tmpPath), "%s.%d", path, (int) getpid());
+  FILE *file = fopen(tmpPath, "wb");
+  if (!file) {
+    return;
+  }
+  bool written = fwrite(atlas, offsetof(FontAtlas, pixels), 1, file) == 1 &&
+                 fwrite(atlas->pixels, 1, atlas->pixelsSize, file) == atlas->pixelsSize;
+  if (fclose(file) == 0 && written) {
+    rename(tmpPath, path);
+  } else {
+    remove(tmpPath);
+  }
+}
+
+// renders the subpixel variants of a glyph, appending their coverage to pixels
+void rasterizeGlyph(FT_Face face, Uint32 codePoint, FontAtlasGlyph *atlasGlyph, Uint8 **pixels) {
+  for (int variant = 0; variant < GLYPH_SUBPIXELS; variant++) {
+    // light hinting only fits the outline vertically, so it can be shifted by a fraction of a pixel
+    FT_Error error = FT_Load_Char(face, codePoint, FT_LOAD_NO_BITMAP | FT_LOAD_TARGET_LIGHT);
+    if (!error) {
+      FT_Outline_Translate(&face->glyph->outline, variant * 64 / GLYPH_SUBPIXELS, 0);
+      error = FT_Render_Glyph(face->glyph, FT_RENDER_MODE_LIGHT);
+    }
+    if (error) {
+      *atlasGlyph = (FontAtlasGlyph){0};
+      return;
+    }
+    FT_GlyphSlot glyph = face->glyph;
+    FT_Bitmap bitmap = glyph->bitmap;
+    atlasGlyph->bitmaps[variant] = (FontAtlasBitmap){
+            .h = bitmap.rows,
+            .w = bitmap.width,
+            .bearingX = glyph->bitmap_left,
+            .bearingY = glyph->bitmap_top,
+            .pixelOffset = buf_len(*pixels),
+    };
+    // unhinted, 16.16
+    atlasGlyph->advance = glyph->linearHoriAdvance >> 10;
+    atlasGlyph->initialized = true;
+    for (int i = 0; i < bitmap.rows; i++) {
+      for (int j = 0; j < bitmap.width; j++) {
+        buf_push(*pixels, bitmap.buffer[i * bitmap.pitch + j]);
+      }
+    }
+  }
+}
+
+bool rasterizeFontAtlas(FontBuild *build, FontAtlas *atlas) {
+  Uint64 phaseStart = SDL_GetPerformanceCounter();
+  FT_Library ftLib;
+  FT_Error error = FT_Init_FreeType(&ftLib);
+  if (error) {
+    build->error = "Failed to init ft";
+    return false;
+  }
+  FT_Face face;
+  error = FT_New_Memory_Face(ftLib, build->fontData, build->fontDataSize, 0, &face);
+  if (error) {
+    FT_Done_FreeType(ftLib);
+    build->error = "Failed to init face";
+    return false;
+  }
+  error = FT_Set_Char_Size(face, 0, atlas->fontSize * 64, atlas->dpi, atlas->dpi);
+  if (error) {
+    FT_Done_FreeType(ftLib);
+    build->error = "Failed to init font size";
+    return false;
+  }
+  atlas->lineHeight = face->size->metrics.height >> 6;
+  atlas->descender = face->size->metrics.descender >> 6;
+  recordProfilePhase(build->profile, STARTUP_FREETYPE_INIT, phaseStart);
+
+  phaseStart = SDL_GetPerformanceCounter();
+  Uint8 *pixels = 0; // stretchy buf
+  for (int c = 0; c < 255; c++) {
+    if (isprint(c)) {
+      rasterizeGlyph(face, c, &atlas->glyphs[c], &pixels);
+    }
+  }
+  for (int marker = 0; marker < MARKER_COUNT; marker++) {
+    Uint32 codePoint = markerGlyphs[marker].codePoint;
+    if (!FT_Get_Char_Index(face, codePoint)) {
+      codePoint = markerGlyphs[marker].fallback;
+    }
+    rasterizeGlyph(face, codePoint, &atlas->glyphs[GLYPH_MARKERS + marker], &pixels);
+  }
+  // the distance between tab stops, see advanceX
+  FontAtlasGlyph *tab = &atlas->glyphs['\t'];
+  tab->advance = atlas->glyphs[' '].advance * 4;
+  tab->initialized = true;
+  atlas->pixelsSize = buf_len(pixels);
+  atlas->pixels = xalloc(atlas->pixelsSize + 1);
+  memcpy(atlas->pixels, pixels, atlas->pixelsSize);
+  buf_free(pixels);
+  recordProfilePhase(build->profile, STARTUP_GLYPHS, phaseStart);
+
+  phaseStart = SDL_GetPerformanceCounter();
+  if (FT_HAS_KERNING(face)) {
+    for (int left = 0; left < 255; left++) {
+      if (isprint(left)) {
+        FT_UInt leftIndex = FT_Get_Char_Index(face, left);
+        for (int right = 0; right < 255; right++) {
+          if (isprint(right)) {
+            FT_UInt rightIndex = FT_Get_Char_Index(face, right);
+            FT_Vector kerning = {0};
+            FT_Get_Kerning(face, leftIndex, rightIndex, FT_KERNING_UNFITTED, &kerning);
+            atlas->kerning[left * 256 + right] = kerning.x;
+          }
+        }
+      }
+    }
+  }
+  FT_Done_FreeType(ftLib);
+  recordProfilePhase(build->profile, STARTUP_KERNING, phaseStart);
+  return true;
+}
+
+// replaces the embedded font with a font file read at startup
+bool loadFontFile(E *e, const char *path) {
+  FILE *file = fopen(path, "rb");
+  if (!file) {
+    setEditorError(e, "Failed to open font file");
+    return false;
+  }
+  long size = fseek(file, 0, SEEK_END) == 0 ? ftell(file) : -1;
+  if (size <= 0) {
+    fclose(file);
+    setEditorError(e, "Failed to read font file");
+    return false;
+  }
+  rewind(file);
+  e->fontFile = xalloc(size);
+  bool read = fread(e->fontFile, size, 1, file) == 1;
+  fclose(file);
+  if (!read) {
+    setEditorError(e, "Failed to read font file");
+    return false;
+  }
+  e->fontData = e->fontFile;
+  e->fontDataSize = size;
+  return true;
+}
+
+// Shelf packs the bitmaps into one sheet, a font change uploads a single
+// texture and all glyph draws share it.
+void packGlyphSheet(FontBuild *build) {
+  FontAtlas *atlas = build->atlas;
+  // bitmaps are 1 pixel apart so filtering never samples a neighbour
+  Uint64 area = 0;
+  int widest = 0;
+  for (int c = 0; c < GLYPH_COUNT; c++) {
+    for (int variant = 0; variant < GLYPH_SUBPIXELS; variant++) {
+      FontAtlasBitmap *bitmap = &atlas->glyphs[c].bitmaps[variant];
+      area += (Uint64) (bitmap->w + 1) * (bitmap->h + 1);
+      widest = MAX(widest, bitmap->w + 1);
+    }
+  }
+  int width = 64;
+  while ((Uint64) width * width < area || width < widest) {
+    width *= 2;
+  }
+  int x = 0;
+  int y = 0;
+  int shelfHeight = 0;
+  for (int c = 0; c < GLYPH_COUNT; c++) {
+    for (int variant = 0; variant < GLYPH_SUBPIXELS; variant++) {
+      FontAtlasBitmap *bitmap = &atlas->glyphs[c].bitmaps[variant];
+      if (!bitmap->w || !bitmap->h) {
+        continue;
+      }
+      if (x + bitmap->w > width) {
+        x = 0;
+        y += shelfHeight + 1;
+        shelfHeight = 0;
+      }
+      build->sheetPositions[c][variant] = (SDL_Point){x, y};
+      x += bitmap->w + 1;
+      shelfHeight = MAX(shelfHeight, bitmap->h);
+    }
+  }
+  build->sheetW = width;
+  build->sheetH = MAX(y + shelfHeight, 1);
+  size_t sheetSize = (size_t) build->sheetW * build->sheetH;
+  build->sheet = xalloc(sheetSize * sizeof(Uint32));
+  for (size_t i = 0; i < sheetSize; i++) {
+    build->sheet[i] = 0x00FFFFFF;
+  }
+  for (int c = 0; c < GLYPH_COUNT; c++) {
+    for (int variant = 0; variant < GLYPH_SUBPIXELS; variant++) {
+      FontAtlasBitmap *bitmap = &atlas->glyphs[c].bitmaps[variant];
+      SDL_Point position = build->sheetPositions[c][variant];
+      Uint8 *src = &atlas->pixels[bitmap->pixelOffset];
+      for (int i = 0; i < bitmap->h; i++) {
+        Uint32 *dst = &build->sheet[(size_t) (position.y + i) * build->sheetW + position.x];
+        for (int j = 0; j < bitmap->w; j++) {
+          *dst++ = (Uint32) *src++ << 24 | 0xFFFFFF;
+        }
+      }
+    }
+  }
+}
+
+// Glyph bitmaps and metrics come from the atlas cache when one matches the
+// font data, size and dpi, FreeType is only loaded to build a missing one.
+bool buildFont(FontBuild *build) {
+  Uint64 phaseStart = SDL_GetPerformanceCounter();
+  FontAtlas *atlas = xcalloc(1, sizeof(FontAtlas));
+  build->atlas = atlas;
+  memcpy(atlas->magic, FONT_CACHE_MAGIC, 4);
+  atlas->version = FONT_CACHE_VERSION;
+  atlas->fontHash = hashBytes(0xcbf29ce484222325ULL, build->fontData, build->fontDataSize);
+  atlas->fontSize = build->fontSize;
+  atlas->dpi = build->dpi;
+  build->cached = loadFontAtlas(atlas);
+  recordProfilePhase(build->profile, STARTUP_FONT_CACHE_LOAD, phaseStart);
+  if (!build->cached) {
+    if (!rasterizeFontAtlas(build, atlas)) {
+      return false;
+    }
+    phaseStart = SDL_GetPerformanceCounter();
+    saveFontAtlas(atlas);
+    recordProfilePhase(build->profile, STARTUP_FONT_CACHE_SAVE, phaseStart);
+  }
+  phaseStart = SDL_GetPerformanceCounter();
+  packGlyphSheet(build);
+  recordProfilePhase(build->profile, STARTUP_GLYPH_TEXTURES, phaseStart);
+  return true;
+}
+
+void FontBuild_free(FontBuild *build) {
+  if (build->atlas) {
+    free(build->atlas->pixels);
+    free(build->atlas);
+  }
+  free(build->sheet);
+  build->atlas = 0;
+  build->sheet = 0;
+}
+
+// Replaces the glyphs with a completed build, the old ones stay in use if
+// the sheet can't be uploaded. Takes the coverage pixels from the atlas.
+bool applyFont(E *e, FontBuild *build) {
+  Uint64 phaseStart = SDL_GetPerformanceCounter();
+  SDL_Texture *sheet = SDL_CreateTexture(e->renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC,
+                                         build->sheetW, build->sheetH);
+  if (!sheet) {
+    setEditorError(e, SDL_GetError());
+    return false;
+  }
+  SDL_SetTextureBlendMode(sheet, SDL_BLENDMODE_BLEND);
+  SDL_UpdateTexture(sheet, 0, build->sheet, build->sheetW * sizeof(Uint32));
+  if (e->glyphSheet) {
+    SDL_DestroyTexture(e->glyphSheet);
+  }
+  e->glyphSheet = sheet;
+
+  FontAtlas *atlas = build->atlas;
+  for (int c = 0; c < GLYPH_COUNT; c++) {
+    FontAtlasGlyph *atlasGlyph = &atlas->glyphs[c];
+    E_Glyph *glyph = &e->glyphs[c];
+    *glyph = (E_Glyph){.advance = atlasGlyph->advance, .initialized = atlasGlyph->initialized};
+    for (int variant = 0; variant < GLYPH_SUBPIXELS; variant++) {
+      FontAtlasBitmap *bitmap = &atlasGlyph->bitmaps[variant];
+      glyph->bitmaps[variant] = (E_GlyphBitmap){
+              .sheetX = build->sheetPositions[c][variant].x,
+              .sheetY = build->sheetPositions[c][variant].y,
+              .coverage = bitmap->w && bitmap->h ? &atlas->pixels[bitmap->pixelOffset] : 0,
+              .h = bitmap->h,
+              .w = bitmap->w,
+              .bearingX = bitmap->bearingX,
+              .bearingY = bitmap->bearingY,
+      };
+    }
+  }
+  for (int i = 0; i < 256 * 256; i++) {
+    e->kerning[i] = atlas->kerning[i];
+  }
+  e->lineHeight = atlas->lineHeight;
+  e->statusLineBaselineOffset = abs(atlas->descender);
+  e->fontSize = atlas->fontSize;
+  e->dpi = atlas->dpi;
+  free(e->glyphPixels);
+  e->glyphPixels = atlas->pixels;
+  atlas->pixels = 0;
+  updateShownGlyphs(e);
+  recordProfilePhase(build->profile, STARTUP_GLYPH_TEXTURES, phaseStart);
+  return true;
+}
+
+// builds the first font on the UI thread, nothing can be laid out without it
+bool initFont(E *e) {
+  Uint64 traceStart = SDL_GetPerformanceCounter();
+  FontLoader *loader = &e->fontLoader;
+  FontBuild build = {
+          .fontData = e->fontData,
+          .fontDataSize = e->fontDataSize,
+          .fontSize = loader->fontSize,
+          .dpi = loader->dpi,
+          .profile = &e->startup,
+  };
+  bool loaded = buildFont(&build) && applyFont(e, &build);
+  if (build.error) {
+    setEditorError(e, build.error);
+  }
+  traceRecord("initFont", traceStart, build.cached);
+  FontBuild_free(&build);
+  return loaded;
+}
+
+// x offsets and scroll pixels measured with the previous font
+void resetViewOffsets(View *view) {
+  view->screenLeftBorderOffsetX = 0;
+  view->desiredCursorOffsetX = 0;
+  view->scrollPixelY = 0;
+  view->scrollPending = 0;
+}
+
+void resetPaneOffsets(Pane *pane) {
+  if (pane->first) {
+    resetPaneOffsets(pane->first);
+    resetPaneOffsets(pane->second);
+  } else {
+    resetViewOffsets(&pane->view);
+  }
+}
+
+// drops everything measured with the previous glyphs and lays the panes out again
+void relayoutFont(E *e) {
+  for (size_t i = 0; i < buf_len(e->docs); i++) {
+    Document *doc = e->docs[i];
+    freeLineCheckpoints(doc);
+    resetViewOffsets(&doc->view);
+    doc->gutterLineCount = 0;
+  }
+  resetPaneOffsets(e->rootPane);
+  LineCache_free(&e->lineCache);
+  freeWrapLayouts(e->rootPane);
+  initVisibleLines(e);
+  resetVisibleLines(e, e->rootPane);
+}
+
+int runFontBuild(void *data) {
+  FontLoader *loader = data;
+  buildFont(&loader->build);
+  SDL_AtomicSet(&loader->done, 1);
+  return 0;
+}
+
+// Starts building the wanted font unless it is loaded or a build runs, the
+// build runs on a thread so typing continues while glyphs are rasterized.
+void startFontBuild(E *e) {
+  FontLoader *loader = &e->fontLoader;
+  if (loader->building || (loader->fontSize == e->fontSize && loader->dpi == e->dpi)) {
+    return;
+  }
+  loader->build = (FontBuild){
+          .fontData = e->fontData,
+          .fontDataSize = e->fontDataSize,
+          .fontSize = loader->fontSize,
+          .dpi = loader->dpi,
+  };
+  loader->building = true;
+  SDL_AtomicSet(&loader->done, 0);
+  // headless replays build in place, a zoom applies at the event it was recorded at
+  loader->thread = e->headless ? 0 : SDL_CreateThread(runFontBuild, "font", loader);
+  if (!loader->thread) {
+    runFontBuild(loader);
+  }
+}
+
+// applies a completed build, true if the screen changed
+bool finishFontBuild(E *e) {
+  FontLoader *loader = &e->fontLoader;
+  if (!loader->building || !SDL_AtomicGet(&loader->done)) {
+    return false;
+  }
+  if (loader->thread) {
+    SDL_WaitThread(loader->thread, 0);
+    loader->thread = 0;
+  }
+  loader->building = false;
+  FontBuild *build = &loader->build;
+  if (build->error) {
+    setEditorError(e, build->error);
+  }
+  if (!build->error && applyFont(e, build)) {
+    relayoutFont(e);
+  } else {
+    // keeps the loaded font instead of retrying
+    loader->fontSize = e->fontSize;
+    loader->dpi = e->dpi;
+  }
+  FontBuild_free(build);
+  // the size changed again while this build ran
+  startFontBuild(e);
+  return true;
+}
+
+void setFontSize(E *e, int fontSize) {
+  e->fontLoader.fontSize = MIN(MAX(fontSize, FONT_SIZE_MIN), FONT_SIZE_MAX);
+  startFontBuild(e);
+  finishFontBuild(e);
+}
+
+void zoomIn(E *e) {
+  setFontSize(e, e->fontLoader.fontSize + 1);
+}
+
+void zoomOut(E *e) {
+  setFontSize(e, e->fontLoader.fontSize - 1);
+}
+
+void resetZoom(E *e) {
+  setFontSize(e, FONT_SIZE);
+}
+
+// The renderer's output is larger than the window on HiDPI displays, text is
+// laid out in output pixels and rasterized with the dpi scaled to match.
+void updateDisplayScale(E *e) {
+  int windowW = 0, windowH = 0, outputW = 0, outputH = 0;
+  SDL_GetWindowSize(e->window, &windowW, &windowH);
+  if (SDL_GetRendererOutputSize(e->renderer, &outputW, &outputH) != 0 || windowW <= 0 || outputW <= 0) {
+    return;
+  }
+  e->width = outputW;
+  e->height = outputH;
+  e->fontLoader.dpi = FONT_DPI * outputW / windowW;
+}
+
+
+bool initUI(E *e) {
+  Uint64 phaseStart = SDL_GetPerformanceCounter();
+  if (SDL_Init(SDL_INIT_VIDEO) < 0) {
+    setEditorError(e, SDL_GetError());
+    return false;
+  }
+  recordStartupPhase(e, STARTUP_SDL_INIT, phaseStart);
+  phaseStart = SDL_GetPerformanceCounter();
+  // a server started without files shows the window when the first file arrives
+  Uint32 visibility = e->doc->path ? SDL_WINDOW_SHOWN : SDL_WINDOW_HIDDEN;
+  e->window = SDL_CreateWindow(e->doc->path ? e->doc->path : "e", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED,
+          e->width, e->height, visibility | SDL_WINDOW_RESIZABLE | SDL_WINDOW_ALLOW_HIGHDPI);
+  if (!e->window) {
+    setEditorError(e, SDL_GetError());
+    return false;
+  }
+  recordStartupPhase(e, STARTUP_WINDOW, phaseStart);
+  phaseStart = SDL_GetPerformanceCounter();
+  e->renderer = SDL_CreateRenderer(e->window, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC );
+  if (!e->renderer) {
+    setEditorError(e, SDL_GetError());
+    return false;
+  }
+  recordStartupPhase(e, STARTUP_RENDERER, phaseStart);
+  updateDisplayScale(e);
+  if (!initFont(e)) {
+    return false;
+  }
+  initVisibleLines(e);
+  return true;
+}
+
+
+// Renders into an offscreen surface with the software renderer,
+// no window and no video subsystem are needed.
+bool initHeadlessUI(E *e) {
+  e->headless = true;
+  Uint64 phaseStart = SDL_GetPerformanceCounter();
+  e->surface = SDL_CreateRGBSurface(0, e->width, e->height, 32, 0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000);
+  if (!e->surface) {
+    setEditorError(e, SDL_GetError());
+    return false;
+  }
+  e->renderer = SDL_CreateSoftwareRenderer(e->surface);
+  if (!e->renderer) {
+    setEditorError(e, SDL_GetError());
+    return false;
+  }
+  recordStartupPhase(e, STARTUP_RENDERER, phaseStart);
+  if (!initFont(e)) {
+    return false;
+  }
+  initVisibleLines(e);
+  return true;
+}
+
+void freePanes(Pane *pane) {
+  if (pane->first) {
+    freePanes(pane->first);
+    freePanes(pane->second);
+  }
+  WrapLayout_free(&pane->wrap);
+  free(pane);
+}
+
+void closeEditor(E *e) {
+  if (e->recorder.file) {
+    fclose(e->recorder.file);
+  }
+  stopServer(e);
+  for (size_t i = 0; i < buf_len(e->docs); i++) {
+    freeDocument(e->docs[i]);
+  }
+  buf_free(e->docs);
+  buf_free(e->lineStyles);
+  buf_free(e->lineBrackets);
+  if (e->rootPane) {
+    freePanes(e->rootPane);
+  }
+  if (e->fontLoader.thread) {
+    SDL_WaitThread(e->fontLoader.thread, 0);
+  }
+  FontBuild_free(&e->fontLoader.build);
+  free(e->fontFile);
+  free(e->glyphPixels);
+  LineCache_free(&e->lineCache);
+  Framebuffer_free(&e->framebuffer);
+  if (e->glyphSheet) {
+    SDL_DestroyTexture(e->glyphSheet);
+  }
+  if (e->renderer) {
+    SDL_DestroyRenderer(e->renderer);
+  }
+  if (e->window) {
+    SDL_DestroyWindow(e->window);
+  }
+  if (e->surface) {
+    SDL_FreeSurface(e->surface);
+  }
+  SDL_Quit();
+}
+
+size_t E_getTextLen(E *e) {
+  return getTextSize(&e->doc->buffer);
+}
+
+char getChar(Buffer *buffer, size_t offset) {
+  size_t physicalOffset = getPhysicalOffset(buffer, offset);
+  if (physicalOffset < buffer->bufferSize) {
+    return buffer->text[physicalOffset];
+  } else {
+    return '\0';
+  }
+}
+
+char E_getChar(E *e, size_t offset) {
+  return getChar(&e->doc->buffer, offset);
+}
+
+size_t E_getLineCount(E *e) {
+  return LineIndex_getNewlineCount(&e->doc->buffer.lines) + 1;
+}
+
+// index of the line containing offset
+size_t E_getLineIndex(E *e, size_t offset) {
+  return LineIndex_getLine(&e->doc->buffer.lines, offset, E_getTextLen(e));
+}
+
+size_t E_getLineStart(E *e, size_t line) {
+  line = MIN(line, E_getLineCount(e) - 1);
+  return LineIndex_getLineStart(&e->doc->buffer.lines, line, E_getTextLen(e));
+}
+
+// offset of the '\n' ending the line, or of the text end for the last line
+size_t getLineEnd(Buffer *buffer, size_t line) {
+  if (line >= LineIndex_getNewlineCount(&buffer->lines)) {
+    return getTextSize(buffer);
+  }
+  return LineIndex_getNewline(&buffer->lines, line, getTextSize(buffer));
+}
+
+size_t E_getLineEnd(E *e, size_t line) {
+  return getLineEnd(&e->doc->buffer, line);
+}
+
+// offset of the whitespace ending the line, lineEnd if there is none
+size_t getTrailingSpaceStart(E *e, size_t lineStart, size_t lineEnd) {
+  size_t i = lineEnd;
+  while (i > lineStart) {
+    char c = E_getChar(e, i - 1);
+    if (c != ' ' && c != '\t' && c != '\r') {
+      break;
+    }
+    i--;
+  }
+  return i;
+}
+
+// x where the glyph at offset starts, measured from the pen position x at start
+// where prev is the char before start or 0 at the start of a row
+Sint64 measureOffsetX(E *e, size_t start, Sint64 x, char prev, size_t offset) {
+  for (size_t i = start; i <= offset; i++) {
+    char c = E_getChar(e, i);
+    x += (prev ? getKerning(e, prev, c) : 0);
+    if (i < offset) {
+      x = advanceX(e, x, c);
+    }
+    prev = c;
+  }
+  return x;
+}
+
+// x where the glyph at offset starts when a row starting at rowStart is rendered
+Sint64 getOffsetX(E *e, size_t rowStart, size_t offset) {
+  return measureOffsetX(e, rowStart, 0, 0, offset);
+}
+
+LineCheckpoints *getLineCheckpoints(E *e, size_t lineStart) {
+  LineCheckpoints *longLines = e->doc->longLines;
+  LineCheckpoints *result = &longLines[0];
+  for (int i = 0; i < CHECKPOINT_CACHE_SIZE; i++) {
+    if (longLines[i].checkpoints && longLines[i].lineStart == lineStart) {
+      result = &longLines[i];
+      break;
+    }
+    if (!longLines[i].checkpoints || longLines[i].lastUsedTicks < result->lastUsedTicks) {
+      result = &longLines[i];
+    }
+  }
+  if (!result->checkpoints || result->lineStart != lineStart) {
+    // reuse the least recently used entry
+    buf_free(result->checkpoints);
+    result->lineStart = lineStart;
+    buf_push(result->checkpoints, ((Checkpoint){.offset = lineStart}));
+  }
+  result->lastUsedTicks = SDL_GetTicks();
+  return result;
+}
+
+// Last checkpoint of the line at or before offset with x not past maxX,
+// checkpoints are added as far as needed. Short lines have only their start.
+Checkpoint getCheckpoint(E *e, size_t lineStart, size_t lineEnd, size_t offset, Sint64 maxX) {
+  Checkpoint start = {.offset = lineStart};
+  if (lineEnd - lineStart < CHECKPOINT_INTERVAL) {
+    return start;
+  }
+  Uint64 traceStart = SDL_GetPerformanceCounter();
+  LineCheckpoints *line = getLineCheckpoints(e, lineStart);
+  Checkpoint last = line->checkpoints[buf_len(line->checkpoints) - 1];
+  size_t end = MIN(offset, lineEnd);
+  if (last.offset + CHECKPOINT_INTERVAL <= end && last.x <= maxX) {
+    char prev = last.offset > lineStart ? E_getChar(e, last.offset - 1) : 0;
+    Sint64 x = last.x;
+    for (size_t i = last.offset; i < end; i++) {
+      char c = E_getChar(e, i);
+      x = advanceX(e, x + (prev ? getKerning(e, prev, c) : 0), c);
+      prev = c;
+      if (i + 1 - last.offset == CHECKPOINT_INTERVAL) {
+        last = (Checkpoint){.offset = i + 1, .x = x};
+        buf_push(line->checkpoints, last);
+        if (x > maxX) {
+          break;
+        }
+      }
+    }
+  }
+  size_t lo = 0;
+  size_t hi = buf_len(line->checkpoints);
+  while (lo < hi) {
+    size_t mid = lo + (hi - lo) / 2;
+    Checkpoint *checkpoint = &line->checkpoints[mid];
+    if (checkpoint->offset <= offset && checkpoint->x <= maxX) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  traceRecord("getCheckpoint", traceStart, lo);
+  return lo ? line->checkpoints[lo - 1] : start;
+}
+
+// x where the glyph at offset starts on a line rendered without wrapping
+Sint64 getLineOffsetX(E *e, size_t lineStart, size_t lineEnd, size_t offset) {
+  Checkpoint checkpoint = getCheckpoint(e, lineStart, lineEnd, offset, INT64_MAX);
+  char prev = checkpoint.offset > lineStart ? E_getChar(e, checkpoint.offset - 1) : 0;
+  return measureOffsetX(e, checkpoint.offset, checkpoint.x, prev, offset);
+}
+
+// Drops checkpoints past an edit of [offset, offset + deleted) replaced with
+// inserted chars, checkpoints before it don't depend on the edited text.
+void adjustCheckpoints(Document *doc, size_t offset, size_t deleted, size_t inserted) {
+  for (int i = 0; i < CHECKPOINT_CACHE_SIZE; i++) {
+    LineCheckpoints *line = &doc->longLines[i];
+    if (!line->checkpoints) {
+      continue;
+    }
+    if (line->lineStart <= offset) {
+      while (line->checkpoints[buf_len(line->checkpoints) - 1].offset > offset) {
+        buf_hdr(line->checkpoints)->len--;
+      }
+    } else if (offset + deleted >= line->lineStart) {
+      // the newline before the line was deleted
+      buf_free(line->checkpoints);
+    } else {
+      line->lineStart = line->lineStart - deleted + inserted;
+      for (size_t j = 0; j < buf_len(line->checkpoints); j++) {
+        line->checkpoints[j].offset = line->checkpoints[j].offset - deleted + inserted;
+      }
+    }
+  }
+}
+
+const char *cKeywords[] = {
+        "auto", "break", "case", "const", "continue", "default", "do", "else", "enum", "extern", "false",
+        "for", "goto", "if", "inline", "NULL", "register", "restrict", "return", "sizeof", "static",
+        "struct", "switch", "true", "typedef", "union", "volatile", "while",
+};
+const char *cTypes[] = {
+        "bool", "char", "double", "float", "int", "long", "short", "signed", "unsigned", "void",
+        "size_t", "ssize_t", "Uint8", "Uint16", "Uint32", "Uint64", "Sint8", "Sint16", "Sint32", "Sint64",
+};
+const char *jsonKeywords[] = {"false", "null", "true"};
+
+bool isWordIn(const char *word, const char **words, size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    if (strcmp(word, words[i]) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+Style getWordStyle(Buffer *buffer, Language language, size_t start, size_t end) {
+  char word[32];
+  if (end - start >= sizeof(word)) {
+    return STYLE_TEXT;
+  }
+  for (size_t i = start; i < end; i++) {
+    word[i - start] = getChar(buffer, i);
+  }
+  word[end - start] = '\0';
+  if (language == LANGUAGE_JSON) {
+    return isWordIn(word, jsonKeywords, SDL_arraysize(jsonKeywords)) ? STYLE_KEYWORD : STYLE_TEXT;
+  }
+  if (isWordIn(word, cKeywords, SDL_arraysize(cKeywords))) {
+    return STYLE_KEYWORD;
+  }
+  return isWordIn(word, cTypes, SDL_arraysize(cTypes)) ? STYLE_TYPE : STYLE_TEXT;
+}
+
+// Splits a line into runs of chars of one style, the state which continues
+// on the next line is returned by getLineEndState
+typedef struct Lexer {
+  Buffer *buffer;
+  Language language;
+  LexState state;
+  bool directive; // the line is a preprocessor directive
+  bool lineStart; // only blanks so far on the line
+  size_t offset; // start of the next token
+  size_t lineEnd;
+} Lexer;
+
+// lexer of [offset, lineEnd) where offset is in the given state
+Lexer createLexer(Buffer *buffer, Language language, LexState state, size_t offset, size_t lineEnd) {
+  return (Lexer){
+          .buffer = buffer,
+          .language = language,
+          .state = state == LEX_PREPROCESSOR ? LEX_NORMAL : state,
+          .directive = state == LEX_PREPROCESSOR,
+          .lineStart = offset == 0 || getChar(buffer, offset - 1) == '\n',
+          .offset = offset,
+          .lineEnd = lineEnd,
+  };
+}
+
+// Lexes the token at lexer->offset and moves past it. Keywords are looked
+// up only if withKeywords, they don't change the state.
+Style lexToken(Lexer *lexer, bool withKeywords) {
+  Buffer *buffer = lexer->buffer;
+  size_t end = lexer->lineEnd;
+  bool isC = lexer->language == LANGUAGE_C;
+  size_t i = lexer->offset;
+  char c = getChar(buffer, i);
+  char next = i + 1 < end ? getChar(buffer, i + 1) : 0;
+  Style style = STYLE_TEXT;
+  if (lexer->state == LEX_COMMENT) {
+    style = STYLE_COMMENT;
+    i++;
+    if (c == '*' && next == '/') {
+      i++;
+      lexer->state = LEX_NORMAL;
+    }
+  } else if (lexer->state == LEX_STRING || ((c == '"' || c == '\'') && lexer->language != LANGUAGE_NONE)) {
+    // up to the closing quote, an unterminated string ends with the line
+    char quote = lexer->state == LEX_STRING ? '"' : c;
+    i += lexer->state == LEX_STRING ? 0 : 1;
+    lexer->state = LEX_NORMAL;
+    for (; i < end; i++) {
+      char d = getChar(buffer, i);
+      if (d == '\\') {
+        if (i + 1 == end && isC && quote == '"') {
+          lexer->state = LEX_STRING;
+        }
+        i++;
+      } else if (d == quote) {
+        i++;
+        break;
+      }
+    }
+    i = MIN(i, end);
+    style = STYLE_STRING;
+  } else if (isC && c == '/' && next == '/') {
+    i = end;
+    style = STYLE_COMMENT;
+  } else if (isC && c == '/' && next == '*') {
+    i += 2;
+    lexer->state = LEX_COMMENT;
+    style = STYLE_COMMENT;
+  } else if (isC && c == '#' && lexer->lineStart) {
+    i++;
+    lexer->directive = true;
+  } else if (isdigit(c) || (c == '-' && isdigit(next))) {
+    for (i++; i < end && (isalnum(getChar(buffer, i)) || getChar(buffer, i) == '.'); i++) {
+    }
+    style = STYLE_NUMBER;
+  } else if (isalpha(c) || c == '_') {
+    for (i++; i < end && (isalnum(getChar(buffer, i)) || getChar(buffer, i) == '_'); i++) {
+    }
+    if (withKeywords) {
+      style = getWordStyle(buffer, lexer->language, lexer->offset, i);
+    }
+  } else {
+    i++;
+  }
+  if (c != ' ' && c != '\t') {
+    lexer->lineStart = false;
+  }
+  if (lexer->directive && style != STYLE_COMMENT && style != STYLE_STRING) {
+    style = STYLE_PREPROCESSOR;
+  }
+  lexer->offset = i;
+  return style;
+}
+
+// state at the start of the next line once the line is lexed
+LexState getLineEndState(Lexer *lexer) {
+  size_t end = lexer->lineEnd;
+  if (lexer->state == LEX_NORMAL && lexer->directive && end > 0 && getChar(lexer->buffer, end - 1) == '\\') {
+    return LEX_PREPROCESSOR;
+  }
+  return lexer->state;
+}
+
+// +1 or -1 if the token just lexed from tokenStart is a bracket outside of
+// comments and strings, 0 otherwise
+int getTokenBracketDelta(Lexer *lexer, size_t tokenStart, Style style) {
+  if (lexer->offset != tokenStart + 1 || style == STYLE_COMMENT || style == STYLE_STRING) {
+    return 0;
+  }
+  return getBracketDelta(getChar(lexer->buffer, tokenStart));
+}
+
+// Lexes the line [start, end) starting in state, writes the style of each
+// char to styles and adds its brackets to brackets unless they're 0,
+// returns the state at the next line start. Lines too long to lex are text
+// without brackets, so that typing on them doesn't rescan megabytes.
+LexState lexLine(Buffer *buffer, Language language, LexState state, size_t start, size_t end, Uint8 *styles,
+                 BracketSummary *brackets) {
+  if (end - start > HIGHLIGHT_LINE_MAX) {
+    if (styles) {
+      memset(styles, STYLE_TEXT, end - start);
+    }
+    return LEX_NORMAL;
+  }
+  Lexer lexer = createLexer(buffer, language, state, start, end);
+  while (lexer.offset < end) {
+    size_t tokenStart = lexer.offset;
+    Style style = lexToken(&lexer, styles != 0);
+    if (styles) {
+      memset(&styles[tokenStart - start], style, lexer.offset - tokenStart);
+    }
+    int delta = brackets ? getTokenBracketDelta(&lexer, tokenStart, style) : 0;
+    if (delta) {
+      addBracket(brackets, delta);
+    }
+  }
+  return getLineEndState(&lexer);
+}
+
+// Lexes lines until the start states of the first lineCount lines are up to
+// date, as well as the brackets of the lines before the last of them. Text
+// without a language is lexed too, for its brackets.
+void updateHighlight(Document *doc, size_t lineCount) {
+  Highlight *h = &doc->highlight;
+  Buffer *buffer = &doc->buffer;
+  size_t textSize = getTextSize(buffer);
+  size_t totalLines = LineIndex_getNewlineCount(&buffer->lines) + 1;
+  if (!h->states) {
+    for (h->cap = 64; h->cap < (totalLines + 1) * 2; h->cap *= 2) {
+    }
+    h->states = xcalloc(h->cap, 1);
+    h->brackets = xcalloc(2 * h->cap, sizeof(BracketSummary));
+    h->gapStart = totalLines + 1;
+    h->gapEnd = h->cap;
+    h->validLines = 1;
+    h->lexedLines = 1;
+    h->editedEnd = 0;
+  }
+  lineCount = MIN(lineCount, totalLines + 1);
+  if (h->validLines >= lineCount) {
+    return;
+  }
+  Uint64 traceStart = SDL_GetPerformanceCounter();
+  long lexed = 0;
+  size_t runStart = h->validLines - 1; // of the relexed lines whose sums are still to update
+  while (h->validLines < lineCount) {
+    size_t line = h->validLines - 1;
+    size_t lineStart = LineIndex_getLineStart(&buffer->lines, line, textSize);
+    size_t lineEnd = getLineEnd(buffer, line);
+    BracketSummary brackets = {0};
+    LexState state = lexLine(buffer, h->language, *Highlight_get(h, line), lineStart, lineEnd, 0, &brackets);
+    h->brackets[h->cap + Highlight_getSlot(h, line)] = brackets;
+    Uint8 *next = Highlight_get(h, line + 1);
+    lexed++;
+    if (line >= h->editedEnd && line + 1 < h->lexedLines && *next == state) {
+      // converged, the following lines were lexed from the same state before
+      Highlight_sumLineBrackets(h, runStart, line + 1);
+      h->validLines = h->lexedLines;
+      runStart = h->validLines - 1;
+    } else {
+      *next = state;
+      h->validLines = line + 2;
+      h->lexedLines = MAX(h->lexedLines, h->validLines);
+    }
+  }
+  if (h->validLines < h->lexedLines) {
+    // the cached state after the last relexed line came from its old start state
+    h->editedEnd = MAX(h->editedEnd, h->validLines);
+  }
+  Highlight_sumLineBrackets(h, runStart, h->validLines - 1);
+  traceRecord("highlight", traceStart, lexed);
+}
+
+// styles of the chars of a shown line, 0 if it isn't highlighted
+Uint8 *getLineStyles(E *e, size_t line, size_t lineStart, size_t lineEnd) {
+  Highlight *h = &e->doc->highlight;
+  if (!h->states || h->language == LANGUAGE_NONE || line >= h->validLines || lineEnd - lineStart > HIGHLIGHT_LINE_MAX) {
+    return 0;
+  }
+  e->lineStyles = buf_grow(e->lineStyles, lineEnd - lineStart + 1, sizeof(Uint8));
+  lexLine(&e->doc->buffer, h->language, *Highlight_get(h, line), lineStart, lineEnd, e->lineStyles, 0);
+  return e->lineStyles;
+}
+
+// Lexes lines below the screen for a few ms when there are no events,
+// so that scrolling finds them ready. Returns true if lines shown in the
+// selected pane were lexed, then it has to be rendered again.
+bool highlightInBackground(E *e) {
+  Uint64 deadline = SDL_GetPerformanceCounter() + HIGHLIGHT_IDLE_MS * e->perfCountFreqMS;
+  size_t shownStart = e->view->visibleLineTop;
+  size_t shownEnd = shownStart + e->pane->visibleLineCount + 1;
+  size_t validLines = e->doc->highlight.validLines;
+  for (size_t i = 0; i < buf_len(e->docs); i++) {
+    Highlight *h = &e->docs[i]->highlight;
+    while (h->states && h->validLines < h->gapStart + h->cap - h->gapEnd && SDL_GetPerformanceCounter() < deadline) {
+      updateHighlight(e->docs[i], h->validLines + HIGHLIGHT_IDLE_BATCH);
+    }
+  }
+  return validLines < shownEnd && e->doc->highlight.validLines > MAX(validLines, shownStart);
+}
+
+// offsets of the brackets outside of comments and strings on a lexed line
+size_t *getLineBrackets(E *e, size_t line) {
+  Highlight *h = &e->doc->highlight;
+  if (e->lineBrackets) {
+    buf_hdr(e->lineBrackets)->len = 0;
+  }
+  size_t start = E_getLineStart(e, line), end = E_getLineEnd(e, line);
+  if (end - start > HIGHLIGHT_LINE_MAX) {
+    return e->lineBrackets;
+  }
+  Lexer lexer = createLexer(&e->doc->buffer, h->language, *Highlight_get(h, line), start, end);
+  while (lexer.offset < end) {
+    size_t tokenStart = lexer.offset;
+    Style style = lexToken(&lexer, false);
+    if (getTokenBracketDelta(&lexer, tokenStart, style)) {
+      buf_push(e->lineBrackets, tokenStart);
+    }
+  }
+  return e->lineBrackets;
+}
+
+// First slot in [start, end) where the depth, *depth > 0 before start, drops
+// to 0, SIZE_MAX if there is none. node is the tree node of [nodeStart, nodeEnd).
+size_t findBracketSlotForward(BracketSummary *tree, size_t node, size_t nodeStart, size_t nodeEnd,
+                              size_t start, size_t end, int *depth) {
+  if (nodeEnd <= start || end <= nodeStart) {
+    return SIZE_MAX;
+  }
+  if (start <= nodeStart && nodeEnd <= end && *depth + tree[node].minPrefix > 0) {
+    *depth += tree[node].net;
+    return SIZE_MAX;
+  }
+  if (nodeEnd - nodeStart == 1) {
+    return nodeStart;
+  }
+  size_t mid = nodeStart + (nodeEnd - nodeStart) / 2;
+  size_t slot = findBracketSlotForward(tree, 2 * node, nodeStart, mid, start, end, depth);
+  return slot != SIZE_MAX ? slot : findBracketSlotForward(tree, 2 * node + 1, mid, nodeEnd, start, end, depth);
+}
+
+// last slot in [start, end) where the count of unmatched closing brackets,
+// *depth > 0 after end, drops to 0 going backwards, SIZE_MAX if there is none
+size_t findBracketSlotBackward(BracketSummary *tree, size_t node, size_t nodeStart, size_t nodeEnd,
+                               size_t start, size_t end, int *depth) {
+  if (nodeEnd <= start || end <= nodeStart) {
+    return SIZE_MAX;
+  }
+  if (start <= nodeStart && nodeEnd <= end && *depth - tree[node].maxSuffix > 0) {
+    *depth -= tree[node].net;
+    return SIZE_MAX;
+  }
+  if (nodeEnd - nodeStart == 1) {
+    return nodeStart;
+  }
+  size_t mid = nodeStart + (nodeEnd - nodeStart) / 2;
+  size_t slot = findBracketSlotBackward(tree, 2 * node + 1, mid, nodeEnd, start, end, depth);
+  return slot != SIZE_MAX ? slot : findBracketSlotBackward(tree, 2 * node, nodeStart, mid, start, end, depth);
+}
+
+// Index of the bracket of brackets where the depth, starting at depth
+// before the one at index from, drops to 0 going in direction dir, -1 if none.
+// The depth left over is stored back.
+long matchLineBrackets(E *e, size_t *brackets, long from, int dir, int *depth) {
+  for (long i = from; i >= 0 && i < (long) buf_len(brackets); i += dir) {
+    *depth += dir * getBracketDelta(E_getChar(e, brackets[i]));
+    if (*depth == 0) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+// Finds the bracket matching the one at offset by depth, whatever its kind,
+// among the lines lexed so far. Returns false if offset isn't a bracket outside
+// of comments and strings or its line isn't lexed yet, match is SIZE_MAX if
+// the bracket has no match.
+bool findMatchingBracket(E *e, size_t offset, size_t *match) {
+  Highlight *h = &e->doc->highlight;
+  size_t line = E_getLineIndex(e, offset);
+  if (line + 1 >= h->validLines) {
+    return false;
+  }
+  size_t *brackets = getLineBrackets(e, line);
+  long i = 0;
+  while (i < (long) buf_len(brackets) && brackets[i] < offset) {
+    i++;
+  }
+  if (i == (long) buf_len(brackets) || brackets[i] != offset) {
+    return false;
+  }
+  *match = SIZE_MAX;
+  int dir = getBracketDelta(E_getChar(e, offset));
+  int depth = 0;
+  long j = matchLineBrackets(e, brackets, i, dir, &depth);
+  if (j >= 0) {
+    *match = brackets[j];
+    return true;
+  }
+  // the other lines are skipped by their sums, lines before validLines - 1 have them
+  size_t slot = SIZE_MAX;
+  if (dir > 0 && line + 2 < h->validLines) {
+    size_t end = Highlight_getSlot(h, h->validLines - 2) + 1;
+    slot = findBracketSlotForward(h->brackets, 1, 0, h->cap, Highlight_getSlot(h, line + 1), end, &depth);
+  } else if (dir < 0 && line > 0) {
+    size_t end = Highlight_getSlot(h, line - 1) + 1;
+    slot = findBracketSlotBackward(h->brackets, 1, 0, h->cap, 0, end, &depth);
+  }
+  if (slot != SIZE_MAX) {
+    brackets = getLineBrackets(e, Highlight_getLine(h, slot));
+    j = matchLineBrackets(e, brackets, dir > 0 ? 0 : (long) buf_len(brackets) - 1, dir, &depth);
+    *match = j >= 0 ? brackets[j] : SIZE_MAX;
+  }
+  return true;
+}
+
+// The bracket at the cursor, or else the closing one before it
+bool getCursorBracket(E *e, size_t *bracket, size_t *match) {
+  size_t cursor = e->view->cursor;
+  if (cursor < E_getTextLen(e) && getBracketDelta(E_getChar(e, cursor)) && findMatchingBracket(e, cursor, match)) {
+    *bracket = cursor;
+    return true;
+  }
+  if (cursor > 0 && getBracketDelta(E_getChar(e, cursor - 1)) < 0 && findMatchingBracket(e, cursor - 1, match)) {
+    *bracket = cursor - 1;
+    return true;
+  }
+  return false;
+}
+
+// Brackets to mark this frame: the cursor bracket and its match, or the
+// cursor bracket alone once the whole text is lexed and it has no match.
+// Returns whether they are a pair of the same kind.
+bool getMarkedBrackets(E *e, size_t marked[2]) {
+  Highlight *h = &e->doc->highlight;
+  marked[0] = marked[1] = SIZE_MAX;
+  size_t bracket = 0, match = 0;
+  if (!getCursorBracket(e, &bracket, &match)) {
+    return false;
+  }
+  if (match == SIZE_MAX) {
+    if (h->validLines == h->gapStart + h->cap - h->gapEnd) {
+      marked[0] = bracket;
+    }
+    return false;
+  }
+  marked[0] = bracket;
+  marked[1] = match;
+  char open = E_getChar(e, MIN(bracket, match)), close = E_getChar(e, MAX(bracket, match));
+  return getClosingBracket(open) == close;
+}
+
+// Ends the top node of the stack at end and adds it to the node below
+// or to nodes if it's the last one
+void closeSyntaxNode(SyntaxNode **stack, SyntaxNode **nodes, size_t end, bool closed) {
+  SyntaxNode node = (*stack)[buf_len(*stack) - 1];
+  buf_hdr(*stack)->len--;
+  node.length = end - node.start;
+  node.closed = closed;
+  for (size_t i = 0; i < buf_len(node.children); i++) {
+    node.children[i].start -= node.start;
+  }
+  if (buf_len(*stack)) {
+    buf_push((*stack)[buf_len(*stack) - 1].children, node);
+  } else {
+    buf_push(*nodes, node);
+  }
+}
+
+// Parses the brackets in [offset, end) into nodes with absolute starts.
+//
+// A closing bracket closes the innermost open node it matches and leaves
+// the nodes above without their closing brackets, other closing brackets
+// are skipped. In C a '}' in column 0 closes every open node, so that a
+// missing '}' in a function doesn't swallow the rest of the file.
+//
+// Inside a node (parent) the range ends at the parent's closing bracket and
+// the parse fails if the brackets in the range would change the parent or
+// the nodes around it. The parse stops at the first opening bracket outside
+// of other nodes at an offset in resume, *resumed is its index there.
+bool parseSyntax(Buffer *buffer, Language language, size_t offset, size_t end, SyntaxNode *parent, bool topLevelParent,
+                 size_t *resume, size_t resumeCount, SyntaxNode **nodes, size_t *resumed) {
+  size_t textSize = getTextSize(buffer);
+  size_t line = LineIndex_getLine(&buffer->lines, offset, textSize);
+  Lexer lexer = createLexer(buffer, language, LEX_NORMAL, offset, getLineEnd(buffer, line));
+  SyntaxNode *stack = 0;
+  size_t nextResume = 0;
+  bool ok = true;
+  *resumed = resumeCount;
+  while (ok && lexer.offset < end) {
+    if (lexer.offset == lexer.lineEnd) {
+      LexState state = getLineEndState(&lexer);
+      line++;
+      lexer = createLexer(buffer, language, state, lexer.lineEnd + 1, getLineEnd(buffer, line));
+      continue;
+    }
+    size_t tokenStart = lexer.offset;
+    if (lexToken(&lexer, false) != STYLE_TEXT || lexer.offset != tokenStart + 1) {
+      continue;
+    }
+    char c = getChar(buffer, tokenStart);
+    if (c == '{' || c == '[' || c == '(') {
+      if (!buf_len(stack)) {
+        while (nextResume < resumeCount && resume[nextResume] < tokenStart) {
+          nextResume++;
+        }
+        if (nextResume < resumeCount && resume[nextResume] == tokenStart) {
+          *resumed = nextResume;
+          break;
+        }
+      }
+      buf_push(stack, ((SyntaxNode){.start = tokenStart, .open = c}));
+    } else if (c == '}' || c == ']' || c == ')') {
+      bool column0 = language == LANGUAGE_C && c == '}' && (tokenStart == 0 || getChar(buffer, tokenStart - 1) == '\n');
+      size_t depth = buf_len(stack);
+      if (column0) {
+        depth = MIN(depth, 1);
+      } else {
+        while (depth > 0 && getClosingBracket(stack[depth - 1].open) != c) {
+          depth--;
+        }
+      }
+      if (parent && (column0 || depth == 0)) {
+        // closes the parent or a node around it
+        ok = false;
+        break;
+      }
+      while (depth > 0 && buf_len(stack) > depth) {
+        closeSyntaxNode(&stack, nodes, tokenStart, false);
+      }
+      if (depth > 0) {
+        bool closed = getClosingBracket(stack[depth - 1].open) == c;
+        closeSyntaxNode(&stack, nodes, tokenStart + 1, closed);
+      }
+    }
+  }
+  if (parent && ok && *resumed == resumeCount) {
+    // the parent's closing bracket must still close it, nodes left open
+    // end there unless one of them would be closed by it instead
+    char c = getChar(buffer, end);
+    bool column0 = language == LANGUAGE_C && c == '}' && getChar(buffer, end - 1) == '\n';
+    ok = lexer.offset == end && lexToken(&lexer, false) == STYLE_TEXT && c == getClosingBracket(parent->open) &&
+         (!column0 || topLevelParent);
+    for (size_t i = 0; ok && !column0 && i < buf_len(stack); i++) {
+      ok = stack[i].open != parent->open;
+    }
+  }
+  if (ok) {
+    size_t stop = *resumed < resumeCount ? resume[*resumed] : end;
+    while (buf_len(stack)) {
+      closeSyntaxNode(&stack, nodes, stop, false);
+    }
+  }
+  for (size_t i = 0; i < buf_len(stack); i++) {
+    SyntaxNode_free(&stack[i]);
+  }
+  buf_free(stack);
+  if (!ok) {
+    for (size_t i = 0; i < buf_len(*nodes); i++) {
+      SyntaxNode_free(&(*nodes)[i]);
+    }
+    buf_free(*nodes);
+  }
+  return ok;
+}
+
+// the syntax tree of the current document, 0 if its language isn't known
+SyntaxTree *getSyntaxTree(E *e) {
+  SyntaxTree *tree = &e->doc->syntax;
+  Language language = e->doc->highlight.language;
+  if (language == LANGUAGE_NONE) {
+    return 0;
+  }
+  if (!tree->built) {
+    Uint64 traceStart = SDL_GetPerformanceCounter();
+    size_t resumed = 0;
+    parseSyntax(&e->doc->buffer, language, 0, E_getTextLen(e), 0, false, 0, 0, &tree->root.children, &resumed);
+    tree->root.length = E_getTextLen(e);
+    tree->built = true;
+    traceRecord("parseSyntax", traceStart, -1);
+  }
+  return tree;
+}
+
+// index of the first child starting at or after offset
+size_t findSyntaxChild(SyntaxNode *node, size_t offset) {
+  size_t lo = 0;
+  size_t hi = buf_len(node->children);
+  while (lo < hi) {
+    size_t mid = lo + (hi - lo) / 2;
+    if (node->children[mid].start < offset) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+// Reparses the children of node at nodeStart after [offset, offset + deleted)
+// was replaced with inserted chars. Children ending before the edit are kept,
+// parsing starts after them and stops at the first later child it reaches
+// between other nodes, which is kept with the rest. Fails if the brackets of
+// the node are changed, then the node has to be reparsed as a part of its parent.
+bool reparseSyntaxNode(Document *doc, SyntaxNode *node, size_t nodeStart, bool isRoot, bool topLevel,
+                       size_t offset, size_t deleted, size_t inserted) {
+  Buffer *buffer = &doc->buffer;
+  size_t delta = inserted - deleted; // wraps around when deleting
+  size_t interiorStart = isRoot ? 0 : nodeStart + 1;
+  size_t oldInteriorEnd = isRoot ? node->length : nodeStart + node->length - 1;
+  size_t interiorEnd = oldInteriorEnd + delta;
+  SyntaxNode *children = node->children;
+  size_t count = buf_len(children);
+  // a child running to the interior end grows with text inserted there
+  size_t first = 0;
+  while (first < count && nodeStart + children[first].start + children[first].length <= offset &&
+         nodeStart + children[first].start + children[first].length < oldInteriorEnd) {
+    first++;
+  }
+  size_t from = first > 0 ? nodeStart + children[first - 1].start + children[first - 1].length : interiorStart;
+  size_t reusable = first;
+  while (reusable < count && nodeStart + children[reusable].start < offset + deleted) {
+    reusable++;
+  }
+  size_t *resume = 0;
+  for (size_t i = reusable; i < count; i++) {
+    buf_push(resume, nodeStart + children[i].start + delta);
+  }
+  SyntaxNode *nodes = 0;
+  size_t resumed = 0;
+  bool ok = parseSyntax(buffer, doc->highlight.language, from, interiorEnd, isRoot ? 0 : node, topLevel,
+                        resume, buf_len(resume), &nodes, &resumed);
+  buf_free(resume);
+  if (!ok) {
+    return false;
+  }
+  size_t kept = reusable + resumed;
+  SyntaxNode *newChildren = 0;
+  for (size_t i = 0; i < first; i++) {
+    buf_push(newChildren, children[i]);
+  }
+  for (size_t i = 0; i < buf_len(nodes); i++) {
+    nodes[i].start -= nodeStart;
+    buf_push(newChildren, nodes[i]);
+  }
+  for (size_t i = first; i < count; i++) {
+    if (i < kept) {
+      SyntaxNode_free(&children[i]);
+    } else {
+      children[i].start += delta;
+      buf_push(newChildren, children[i]);
+    }
+  }
+  buf_free(nodes);
+  buf_free(node->children);
+  node->children = newChildren;
+  return true;
+}
+
+// Updates the tree after [offset, offset + deleted) was replaced with
+// inserted chars, starting with the innermost node around the edit.
+void SyntaxTree_edit(Document *doc, size_t offset, size_t deleted, size_t inserted) {
+  SyntaxTree *tree = &doc->syntax;
+  if (!tree->built) {
+    return;
+  }
+  Uint64 traceStart = SDL_GetPerformanceCounter();
+  // nodes which have the edit between their brackets, starting with the root
+  SyntaxNode *path[256];
+  size_t pathStarts[256];
+  size_t pathIndexes[256]; // index of path[i] in the children of path[i - 1]
+  size_t depth = 1;
+  path[0] = &tree->root;
+  pathStarts[0] = 0;
+  while (depth < SDL_arraysize(path)) {
+    SyntaxNode *node = path[depth - 1];
+    size_t i = findSyntaxChild(node, offset - pathStarts[depth - 1]);
+    if (i == 0) {
+      break;
+    }
+    SyntaxNode *child = &node->children[i - 1];
+    size_t childStart = pathStarts[depth - 1] + child->start;
+    if (!child->closed || offset + deleted >= childStart + child->length) {
+      break;
+    }
+    path[depth] = child;
+    pathStarts[depth] = childStart;
+    pathIndexes[depth] = i - 1;
+    depth++;
+  }
+  size_t level = depth - 1;
+  while (!reparseSyntaxNode(doc, path[level], pathStarts[level], level == 0, level == 1, offset, deleted, inserted)) {
+    level--;
+  }
+  size_t delta = inserted - deleted;
+  for (size_t i = level; i > 0; i--) {
+    path[i]->length += delta;
+    SyntaxNode *siblings = path[i - 1]->children;
+    for (size_t j = pathIndexes[i] + 1; j < buf_len(siblings); j++) {
+      siblings[j].start += delta;
+    }
+  }
+  tree->root.length = getTextSize(&doc->buffer);
+  traceRecord("SyntaxTree_edit", traceStart, depth - level);
+}
+
+// innermost node with offset between its brackets, the root if there is none
+SyntaxNode *findSyntaxNode(SyntaxTree *tree, size_t offset, size_t *nodeStart) {
+  SyntaxNode *node = &tree->root;
+  *nodeStart = 0;
+  while (1) {
+    size_t i = findSyntaxChild(node, offset - *nodeStart);
+    if (i == 0) {
+      return node;
+    }
+    SyntaxNode *child = &node->children[i - 1];
+    size_t childStart = *nodeStart + child->start;
+    if (offset >= childStart + child->length + !child->closed) {
+      return node;
+    }
+    node = child;
+    *nodeStart = childStart;
+  }
+}
+
+// Breaks the line into rows not wider than width, preferably after a space.
+// Rows are measured the same way renderText draws them.
+void wrapLine(E *e, WrapLine *wrap, size_t lineStart, size_t lineEnd, int width) {
+  if (wrap->breaks) {
+    buf_hdr(wrap->breaks)->len = 0;
+  }
+  wrap->width = width;
+  size_t rowStart = lineStart;
+  size_t afterSpace = 0; // offset after the last space of the row, 0 if there is none
+  Sint64 x = 0;
+  char prev = 0;
+  for (size_t i = lineStart; i < lineEnd; i++) {
+    char c = E_getChar(e, i);
+    Sint64 next = advanceX(e, x + (prev ? getKerning(e, prev, c) : 0), c);
+    while (next > width && i > rowStart) {
+      rowStart = afterSpace > rowStart ? afterSpace : i;
+      buf_push(wrap->breaks, rowStart - lineStart);
+      afterSpace = 0;
+      x = rowStart < i ? advanceX(e, getOffsetX(e, rowStart, i - 1), E_getChar(e, i - 1)) : 0;
+      prev = rowStart < i ? E_getChar(e, i - 1) : 0;
+      next = advanceX(e, x + (prev ? getKerning(e, prev, c) : 0), c);
+    }
+    x = next;
+    prev = c;
+    if (c == ' ' || c == '\t') {
+      afterSpace = i + 1;
+    }
+  }
+}
+
+// Wide enough for the digits of the last line number. It is measured again
+// only when the line count or the font changes, not each frame.
+int getGutterWidth(E *e, Document *doc) {
+  if (!e->lineNumbers) {
+    return 0;
+  }
+  size_t lineCount = LineIndex_getNewlineCount(&doc->buffer.lines) + 1;
+  if (doc->gutterLineCount != lineCount) {
+    char digits[24];
+    int count = snprintf(digits, sizeof(digits), "%zu", lineCount);
+    doc->gutterLineCount = lineCount;
+    doc->gutterWidth = ((count * getGlyph(e, '0')->advance + 63) >> 6) + 2 * GUTTER_PADDING;
+  }
+  return doc->gutterWidth;
+}
+
+// part of the pane right of the gutter, text is laid out and drawn in it
+SDL_Rect getTextRect(E *e, Pane *pane) {
+  SDL_Rect rect = pane->rect;
+  int gutterWidth = MIN(getGutterWidth(e, pane->doc), rect.w - 1);
+  rect.x += gutterWidth;
+  rect.w -= gutterWidth;
+  return rect;
+}
+
+// rows of the line in the pane, wrapped now if the line changed since
+WrapLine *getWrapLine(E *e, Pane *pane, size_t line) {
+  WrapLayout *layout = &pane->wrap;
+  if (layout->doc != pane->doc) {
+    WrapLayout_reset(layout, pane->doc, E_getLineCount(e));
+  }
+  // room for the cursor after the last char of a row
+  layout->width = MAX((getTextRect(e, pane).w << 6) - getGlyph(e, ' ')->advance, 1);
+  WrapLine *wrap = WrapLayout_get(layout, line);
+  if (wrap->width != layout->width) {
+    wrapLine(e, wrap, E_getLineStart(e, line), E_getLineEnd(e, line), layout->width);
+  }
+  return wrap;
+}
+
+size_t getRowCount(WrapLine *wrap) {
+  return buf_len(wrap->breaks) + 1;
+}
+
+// row of the line containing the offset from the line start
+size_t getWrapRow(WrapLine *wrap, size_t offset) {
+  size_t lo = 0;
+  size_t hi = buf_len(wrap->breaks);
+  while (lo < hi) {
+    size_t mid = lo + (hi - lo) / 2;
+    if (wrap->breaks[mid] <= offset) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+size_t getRowStart(WrapLine *wrap, size_t lineStart, size_t row) {
+  return lineStart + (row ? wrap->breaks[row - 1] : 0);
+}
+
+// offset where the next row starts, or the line end for the last row
+size_t getRowEnd(WrapLine *wrap, size_t lineStart, size_t lineEnd, size_t row) {
+  return row < buf_len(wrap->breaks) ? lineStart + wrap->breaks[row] : lineEnd;
+}
+
+// line bounds come from the line index, lines are never scanned
+typedef struct LineIter {
+  E *e;
+  size_t line; // next line
+  size_t lineStart;
+  size_t lineLen;
+} LineIter;
+
+LineIter createIter(E *e) {
+  return (LineIter){.e = e};
+}
+
+// iterates lines starting with the given one
+LineIter createIterAt(E *e, size_t line) {
+  return (LineIter){.e = e, .line = line};
+}
+
+bool lineIterNext(LineIter *iter) {
+  if (iter->line >= E_getLineCount(iter->e)) {
+    return false;
+  }
+  iter->lineStart = E_getLineStart(iter->e, iter->line);
+  iter->lineLen = E_getLineEnd(iter->e, iter->line) - iter->lineStart;
+  iter->line++;
+  return true;
+}
+
+void fillCurrentLineAndOffset(E *e, int *lineIndex, int *lineStart) {
+  *lineIndex = E_getLineIndex(e, e->view->cursor);
+  *lineStart = E_getLineStart(e, *lineIndex);
+}
+
+int getCurrentLineIndex(E *e) {
+  return E_getLineIndex(e, e->view->cursor);
+}
+
+// (Re)creates the texture and the pixels when the window size changes.
+bool Framebuffer_reserve(E *e, Framebuffer *fb) {
+  if (fb->texture && fb->width == e->width && fb->height == e->height) {
+    return true;
+  }
+  Framebuffer_free(fb);
+  fb->texture = SDL_CreateTexture(e->renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING, e->width, e->height);
+  if (!fb->texture) {
+    return false;
+  }
+  fb->width = e->width;
+  fb->height = e->height;
+  fb->pixels = xalloc(fb->width * fb->height * sizeof(Uint32));
+  fb->shown = xalloc(fb->width * fb->height * sizeof(Uint32));
+  fb->uploadAll = true;
+  return true;
+}
+
+void fillPixels(Uint32 *dst, int count, Uint32 color) {
+  Uint32 pixel = 0xff000000 | color;
+  for (int i = 0; i < count; i++) {
+    dst[i] = pixel;
+  }
+}
+
+// Drawing primitives of the UI, they go to the framebuffer when it is enabled
+// and to the SDL renderer otherwise. Colors are 0xRRGGBB.
+
+void setViewport(E *e, SDL_Rect *rect) {
+  Framebuffer *fb = &e->framebuffer;
+  SDL_RenderSetViewport(e->renderer, rect);
+  fb->clip = rect ? *rect : (SDL_Rect){0, 0, fb->width, fb->height};
+}
+
+void clearFrame(E *e, Uint32 color) {
+  Framebuffer *fb = &e->framebuffer;
+  if (fb->enabled && !Framebuffer_reserve(e, fb)) {
+    // falls back to the renderer
+    fb->enabled = false;
+  }
+  setViewport(e, 0);
+  if (fb->enabled) {
+    fillPixels(fb->pixels, fb->width * fb->height, color);
+  } else {
+    SDL_SetRenderDrawColor(e->renderer, color >> 16, (color >> 8) & 0xff, color & 0xff, 0xff);
+    SDL_RenderClear(e->renderer);
+  }
+}
+
+void fillRect(E *e, SDL_Rect rect, Uint32 color) {
+  Framebuffer *fb = &e->framebuffer;
+  if (!fb->enabled) {
+    SDL_SetRenderDrawColor(e->renderer, color >> 16, (color >> 8) & 0xff, color & 0xff, 0xff);
+    SDL_RenderFillRect(e->renderer, &rect);
+    return;
+  }
+  if (!Framebuffer_clip(fb, &rect)) {
+    return;
+  }
+  for (int y = rect.y; y < rect.y + rect.h; y++) {
+    fillPixels(&fb->pixels[y * fb->width + rect.x], rect.w, color);
+  }
+}
+
+void strokeRect(E *e, SDL_Rect rect, Uint32 color) {
+  if (!e->framebuffer.enabled) {
+    SDL_SetRenderDrawColor(e->renderer, color >> 16, (color >> 8) & 0xff, color & 0xff, 0xff);
+    SDL_RenderDrawRect(e->renderer, &rect);
+    return;
+  }
+  fillRect(e, (SDL_Rect){rect.x, rect.y, rect.w, 1}, color);
+  fillRect(e, (SDL_Rect){rect.x, rect.y + rect.h - 1, rect.w, 1}, color);
+  fillRect(e, (SDL_Rect){rect.x, rect.y, 1, rect.h}, color);
+  fillRect(e, (SDL_Rect){rect.x + rect.w - 1, rect.y, 1, rect.h}, color);
+}
+
+// bitmap with its top left corner at x, y
+void drawGlyph(E *e, E_GlyphBitmap *glyph, int x, int y, Uint32 color) {
+  Framebuffer *fb = &e->framebuffer;
+  if (!fb->enabled) {
+    if (glyph->coverage) {
+      SDL_Rect srcRect = {glyph->sheetX, glyph->sheetY, glyph->w, glyph->h};
+      SDL_Rect dstRect = {x, y, glyph->w, glyph->h};
+      // glyphs are white, the color is a texture state so draws still batch
+      SDL_SetTextureColorMod(e->glyphSheet, color >> 16, (color >> 8) & 0xff, color & 0xff);
+      SDL_RenderCopy(e->renderer, e->glyphSheet, &srcRect, &dstRect);
+    }
+    return;
+  }
+  SDL_Rect rect = {x, y, glyph->w, glyph->h};
+  if (!glyph->coverage || !Framebuffer_clip(fb, &rect)) {
+    return;
+  }
+  int srcX = rect.x - (x + fb->clip.x);
+  int srcY = rect.y - (y + fb->clip.y);
+  for (int i = 0; i < rect.h; i++) {
+    blendSpan(&fb->pixels[(rect.y + i) * fb->width + rect.x], &glyph->coverage[(srcY + i) * glyph->w + srcX], rect.w, color);
+  }
+}
+
+bool isFramebufferRowChanged(Framebuffer *fb, int y) {
+  return fb->uploadAll || memcmp(&fb->pixels[y * fb->width], &fb->shown[y * fb->width], fb->width * sizeof(Uint32));
+}
+
+// uploads the runs of scanlines that changed since the last frame and draws the texture
+void uploadFramebuffer(E *e) {
+  Framebuffer *fb = &e->framebuffer;
+  int y = 0;
+  while (y < fb->height) {
+    while (y < fb->height && !isFramebufferRowChanged(fb, y)) {
+      y++;
+    }
+    int start = y;
+    while (y < fb->height && isFramebufferRowChanged(fb, y)) {
+      y++;
+    }
+    if (start < y) {
+      SDL_Rect rect = {0, start, fb->width, y - start};
+      SDL_UpdateTexture(fb->texture, &rect, &fb->pixels[start * fb->width], fb->width * sizeof(Uint32));
+      memcpy(&fb->shown[start * fb->width], &fb->pixels[start * fb->width], rect.h * fb->width * sizeof(Uint32));
+    }
+  }
+  fb->uploadAll = false;
+  SDL_RenderCopy(e->renderer, fb->texture, 0, 0);
+}
+
+void presentFrame(E *e) {
+  if (e->framebuffer.enabled) {
+    uploadFramebuffer(e);
+  }
+  SDL_RenderPresent(e->renderer);
+}
+
+// nearest pixel of a 26.6 x
+int toPixels(Sint64 x) {
+  return (x + 32) >> 6;
+}
+
+// background of a line from x (26.6) to x + width
+SDL_Rect getLineRect(E *e, int x, int width, int penY) {
+  return (SDL_Rect){toPixels(x), penY - e->lineHeight, toPixels(x + width) - toPixels(x), e->lineHeight + 5};
+}
+
+// cursors of panes other than the selected one are drawn hollow, penX is 26.6
+void renderCursor(E *e, int penX, int penY, bool selected) {
+  if (selected) {
+    fillRect(e, getLineRect(e, penX, 2 << 6, penY), 0x000000);
+  } else {
+    strokeRect(e, getLineRect(e, penX, getGlyph(e, ' ')->advance, penY), 0x000000);
+  }
+}
+
+// penX is 26.6, penY is in pixels
+void renderGlyph(E *e, E_Glyph *glyph, int penX, int penY, bool drawGlyphBox, Uint32 color) {
+  if (glyph) {
+    // the pen rounded to a subpixel, then split into the pixel and the bitmap shifted by the rest
+    int subpixelX = (penX + (32 >> GLYPH_SUBPIXEL_BITS)) >> (6 - GLYPH_SUBPIXEL_BITS);
+    E_GlyphBitmap *bitmap = &glyph->bitmaps[subpixelX & (GLYPH_SUBPIXELS - 1)];
+    int x = (subpixelX >> GLYPH_SUBPIXEL_BITS) + bitmap->bearingX;
+    if (drawGlyphBox) {
+      strokeRect(e, (SDL_Rect){x, penY - bitmap->bearingY, bitmap->w + 1, bitmap->h + 1}, 0xff0000);
+    }
+    drawGlyph(e, bitmap, x, penY - bitmap->bearingY, color);
+  }
+}
+
+// background of a bracket at the cursor, green if its match is of the same kind
+void renderBracketMark(E *e, E_Glyph *glyph, int penX, int penY, bool matched) {
+  fillRect(e, getLineRect(e, penX, glyph->advance, penY), matched ? 0xC0ECC0 : 0xFFB0B0);
+}
+
+// Creates the texture again when rows get wider than it or the line height
+// changes. Rows are as tall as a line with the descender below the baseline,
+// so that they tile without overlapping each other.
+bool LineCache_reserve(E *e, LineCache *cache, int width) {
+  if (cache->texture && width <= cache->width && cache->rowHeight == e->lineHeight) {
+    return true;
+  }
+  LineCache_free(cache);
+  width = MAX(width, e->width);
+  int rowCount = MAX(LINE_CACHE_BYTES / (width * e->lineHeight * 4), 1);
+  SDL_RendererInfo info;
+  if (SDL_GetRendererInfo(e->renderer, &info) == 0 && info.max_texture_height) {
+    if (width > info.max_texture_width) {
+      return false;
+    }
+    rowCount = MIN(rowCount, info.max_texture_height / e->lineHeight);
+  }
+  cache->texture = SDL_CreateTexture(e->renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET,
+          width, rowCount * e->lineHeight);
+  if (!cache->texture) {
+    return false;
+  }
+  SDL_SetTextureBlendMode(cache->texture, SDL_BLENDMODE_NONE);
+  cache->width = width;
+  cache->rowHeight = e->lineHeight;
+  cache->baseline = e->lineHeight - e->statusLineBaselineOffset;
+  cache->rows = xcalloc(rowCount, sizeof(LineCacheRow));
+  cache->rowCount = rowCount;
+  return true;
+}
+
+Uint64 hashText(Buffer *buffer, Uint64 hash, size_t start, size_t end) {
+  if (start < buffer->gapStart) {
+    size_t split = MIN(end, buffer->gapStart);
+    hash = hashBytes(hash, &buffer->text[start], split - start);
+    start = split;
+  }
+  return hashBytes(hash, &buffer->text[start + buffer->gapEnd - buffer->gapStart], end - start);
+}
+
+// Rows with the cursor, a selection or a bracket mark are drawn directly,
+// as are rows of long lines.
+bool isRowCacheable(E *e, bool cursorLine, size_t lineStart, size_t lineEnd, size_t rowStart, size_t rowEnd,
+                    size_t markedBrackets[2]) {
+  View *view = e->view;
+  if (cursorLine || lineEnd - lineStart > LINE_CACHE_ROW_MAX) {
+    return false;
+  }
+  if (view->hasSelection && MIN(view->cursor, view->selectionStart) < rowEnd &&
+      MAX(view->cursor, view->selectionStart) > rowStart) {
+    return false;
+  }
+  for (int i = 0; i < 2; i++) {
+    if (markedBrackets[i] >= rowStart && markedBrackets[i] < rowEnd) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Hash of everything the pixels of a row depend on. Styles follow from the
+// text of the whole line and the lexer state at its start.
+Uint64 getRowKey(E *e, size_t line, size_t lineStart, size_t lineEnd, size_t rowStart, size_t rowEnd, int width) {
+  Highlight *h = &e->doc->highlight;
+  bool styled = h->states && h->language != LANGUAGE_NONE && line < h->validLines;
+  Uint64 params[] = {
+          rowStart - lineStart,
+          rowEnd - lineStart,
+          e->softWrap ? 0 : e->view->screenLeftBorderOffsetX,
+          width,
+          e->markers,
+          h->language,
+          styled ? *Highlight_get(h, line) : 0x100,
+  };
+  Uint64 hash = hashBytes(0xcbf29ce484222325ULL, params, sizeof(params));
+  return hashText(&e->doc->buffer, hash, lineStart, lineEnd);
+}
+
+void blitCachedRow(E *e, int row, int penY, int width) {
+  LineCache *cache = &e->lineCache;
+  SDL_Rect src = {0, row * cache->rowHeight, width, cache->rowHeight};
+  SDL_Rect dst = {0, penY - cache->baseline, width, cache->rowHeight};
+  SDL_RenderCopy(e->renderer, cache->texture, &src, &dst);
+}
+
+// directs drawing into a cleared cache row, returns the pen y of its baseline
+int beginCachedRow(E *e, int row, int width) {
+  LineCache *cache = &e->lineCache;
+  SDL_Rect rect = {0, row * cache->rowHeight, width, cache->rowHeight};
+  Uint8 r = 0, g = 0, b = 0, a = 0;
+  SDL_GetRenderDrawColor(e->renderer, &r, &g, &b, &a);
+  SDL_SetRenderTarget(e->renderer, cache->texture);
+  // glyphs reaching above the ascender would spill into the row above
+  SDL_RenderSetClipRect(e->renderer, &rect);
+  SDL_SetRenderDrawColor(e->renderer, 0xff, 0xff, 0xff, 0xff);
+  SDL_RenderFillRect(e->renderer, &rect);
+  SDL_SetRenderDrawColor(e->renderer, r, g, b, a);
+  return rect.y + cache->baseline;
+}
+
+void endCachedRow(E *e, int row, int penY, int width) {
+  SDL_RenderSetClipRect(e->renderer, 0);
+  SDL_SetRenderTarget(e->renderer, 0);
+  SDL_Rect textRect = getTextRect(e, e->pane);
+  SDL_RenderSetViewport(e->renderer, &textRect);
+  blitCachedRow(e, row, penY, width);
+}
+
+// text at penX and penY in pixels
+void renderLine(E *e, char *line, size_t size, int penX, int penY) {
+  char prev = 0;
+  penX <<= 6;
+  for (int i = 0; i < size; i++) {
+    char c = line[i];
+    E_Glyph *glyph = getGlyph(e, c);
+    renderGlyph(e, glyph, penX, penY, false, styleColors[STYLE_TEXT]);
+    penX = advanceX(e, penX, c);
+    if (prev) {
+      penX += getKerning(e, prev, c);
+    }
+    prev = c;
+  }
+}
+
+void debugRender(E *e) {
+  clearFrame(e, 0xffffff);
+
+  int penx = 300, peny = 400;
+
+  fillRect(e, (SDL_Rect){penx, peny - 50, 1, 101}, 0x0000ff);
+  fillRect(e, (SDL_Rect){penx - 50, peny, 101, 1}, 0x0000ff);
+  penx <<= 6;
+
+  char *txt = "public static void Main() {}";
+  char prev = 0;
+  for (int i = 0; i < strlen(txt); i++) {
+    char c = txt[i];
+    E_Glyph *glyph = getGlyph(e, c);
+    renderGlyph(e, glyph, penx, peny, false, styleColors[STYLE_TEXT]);
+    penx += glyph->advance;
+    if (prev) {
+      penx += getKerning(e, prev, c);
+    }
+    prev = c;
+  }
+  presentFrame(e);
+}
+
+// Soft wrap counterpart of the visibleLineCursor bookkeeping done by the
+// movement commands: scrolls the selected view so that the cursor row is on
+// the screen and sets visibleLineCursor to it, walking at most a screen of rows.
+void scrollWrappedView(E *e) {
+  View *view = e->view;
+  int visibleLineCount = e->pane->visibleLineCount;
+  size_t cursorLine = E_getLineIndex(e, view->cursor);
+  size_t cursorRow = getWrapRow(getWrapLine(e, e->pane, cursorLine), view->cursor - E_getLineStart(e, cursorLine));
+  // the top line could be edited to fewer rows
+  size_t line = MIN(view->visibleLineTop, E_getLineCount(e) - 1);
+  size_t row = MIN(view->visibleRowTop, getRowCount(getWrapLine(e, e->pane, line)) - 1);
+  view->visibleLineTop = line;
+  view->visibleRowTop = row;
+  if (cursorLine < line || (cursorLine == line && cursorRow < row)) {
+    view->visibleLineTop = cursorLine;
+    view->visibleRowTop = cursorRow;
+    view->visibleLineCursor = 0;
+    return;
+  }
+  int rows = 0;
+  while ((line != cursorLine || row != cursorRow) && rows < visibleLineCount) {
+    if (row + 1 < getRowCount(getWrapLine(e, e->pane, line))) {
+      row++;
+    } else {
+      line++;
+      row = 0;
+    }
+    rows++;
+  }
+  if (rows < visibleLineCount) {
+    view->visibleLineCursor = rows;
+    return;
+  }
+  // cursor is below the screen, put it on the last row
+  line = cursorLine;
+  row = cursorRow;
+  for (int i = 0; i < visibleLineCount - 1 && (line > 0 || row > 0); i++) {
+    if (row > 0) {
+      row--;
+    } else {
+      line--;
+      row = getRowCount(getWrapLine(e, e->pane, line)) - 1;
+    }
+  }
+  view->visibleLineTop = line;
+  view->visibleRowTop = row;
+  view->visibleLineCursor = visibleLineCount - 1;
+}
+
+// renders the selected pane into the current viewport
+void renderText(E *e, bool selected) {
+  Uint64 traceStart = SDL_GetPerformanceCounter();
+  if (e->softWrap) {
+    scrollWrappedView(e);
+  }
+  int currentLine = getCurrentLineIndex(e);
+  int firstLine = e->view->visibleLineTop;
+  LineIter iter = createIterAt(e, firstLine);
+  int penY = e->lineHeight - e->view->scrollPixelY;
+  int lineNum = firstLine;
+  SDL_Rect textRect = getTextRect(e, e->pane);
+  int winHeight = textRect.h;
+  int winWidth = textRect.w;
+  size_t shownLines = firstLine + e->pane->visibleLineCount + 1;
+  updateHighlight(e->doc, shownLines <= e->doc->highlight.validLines + HIGHLIGHT_FRAME_LINES ? shownLines : 1);
+  size_t markedBrackets[2];
+  bool bracketsMatch = getMarkedBrackets(e, markedBrackets);
+  LineCache *cache = &e->lineCache;
+  if (cache->enabled && !LineCache_reserve(e, cache, winWidth)) {
+    // falls back to drawing the glyphs
+    cache->enabled = false;
+  }
+  while (lineIterNext(&iter) && penY <= winHeight + e->lineHeight) {
+    Uint64 glyphsStart = SDL_GetPerformanceCounter();
+    long glyphCount = 0;
+    size_t lineEnd = iter.lineStart + iter.lineLen;
+    WrapLine *wrap = e->softWrap ? getWrapLine(e, e->pane, lineNum) : 0;
+    size_t trailingStart = e->markers & 1 << MARKER_SPACE ? getTrailingSpaceStart(e, iter.lineStart, lineEnd) : lineEnd;
+    E_Glyph *spaceMarker = &e->glyphs[GLYPH_MARKERS + MARKER_SPACE];
+    Uint8 *styles = 0;
+    bool lexed = false; // styles are only needed by rows missing the cache
+    size_t rowCount = wrap ? getRowCount(wrap) : 1;
+    size_t row = lineNum == firstLine && wrap ? MIN(e->view->visibleRowTop, rowCount - 1) : 0;
+    for (; row < rowCount && penY <= winHeight + e->lineHeight; row++) {
+      size_t rowStart = wrap ? getRowStart(wrap, iter.lineStart, row) : iter.lineStart;
+      size_t rowEnd = wrap ? getRowEnd(wrap, iter.lineStart, lineEnd, row) : lineEnd;
+      bool lastRow = row == rowCount - 1;
+      int rowPenY = penY;
+      int cacheRow = -1;
+      if (cache->enabled &&
+          isRowCacheable(e, lineNum == currentLine, iter.lineStart, lineEnd, rowStart, rowEnd, markedBrackets)) {
+        Uint64 key = getRowKey(e, lineNum, iter.lineStart, lineEnd, rowStart, rowEnd, winWidth);
+        cacheRow = LineCache_find(cache, key);
+        if (cacheRow >= 0) {
+          cache->hits++;
+          blitCachedRow(e, cacheRow, penY, winWidth);
+          penY += e->lineHeight;
+          continue;
+        }
+        cache->misses++;
+        cacheRow = LineCache_claim(cache, key);
+        if (cacheRow >= 0) {
+          rowPenY = beginCachedRow(e, cacheRow, winWidth);
+        }
+      }
+      if (!lexed) {
+        styles = getLineStyles(e, lineNum, iter.lineStart, lineEnd);
+        lexed = true;
+      }
+      // glyphs left of the screen are skipped from the nearest checkpoint
+      Checkpoint checkpoint = wrap ? (Checkpoint){.offset = rowStart}
+                                   : getCheckpoint(e, rowStart, rowEnd, rowEnd, e->view->screenLeftBorderOffsetX);
+      char prev = checkpoint.offset > rowStart ? E_getChar(e, checkpoint.offset - 1) : 0;
+      Sint64 prevGlyphRightBorder = checkpoint.x; // includes invisible glyphs to the left of screen left border
+      int penX = 0; // x offset where we put a char on a screen, can be negative for partially shown glyphs with start to the left of left screen border
+      bool firstVisibleGlyph = true; // whether we reached first visible glyph on the line
+      for (size_t i = checkpoint.offset; i < rowEnd; i++) {
+        if (penX > winWidth << 6) {
+          break;
+        }
+        char c = E_getChar(e, i);
+        int kerning = prev ? getKerning(e, prev, c) : 0;
+        Sint64 glyphLeftBorder = prevGlyphRightBorder + kerning;
+        Sint64 glyphRightBorder = advanceX(e, glyphLeftBorder, c);
+        if (glyphRightBorder < e->view->screenLeftBorderOffsetX) {
+          // whole glyph is before left screen border
+          prevGlyphRightBorder = glyphRightBorder;
+          prev = c;
+          continue;
+        }
+        if (firstVisibleGlyph) {
+          penX = glyphLeftBorder - e->view->screenLeftBorderOffsetX;
+          firstVisibleGlyph = false;
+        } else {
+          penX = penX + kerning;
+        }
+        bool withSelection = 0;
+        if (e->view->hasSelection) {
+          if (e->view->cursor > e->view->selectionStart && e->view->selectionStart <= i && i < e->view->cursor) {
+            withSelection = 1;
+          }
+          if (e->view->cursor < e->view->selectionStart && e->view->cursor <= i && i < e->view->selectionStart) {
+            withSelection = 1;
+          }
+        }
+        int advance = glyphRightBorder - glyphLeftBorder;
+        if (i == markedBrackets[0] || i == markedBrackets[1]) {
+          renderBracketMark(e, getGlyph(e, c), penX, rowPenY, bracketsMatch);
+        }
+        if (withSelection) {
+          fillRect(e, getLineRect(e, penX, advance, rowPenY), 0xADD8E6);
+        }
+        Style style = styles ? styles[i - iter.lineStart] : STYLE_TEXT;
+        E_Glyph *glyph = c == ' ' && i >= trailingStart ? spaceMarker : e->shownGlyphs[(unsigned char) c];
+        renderGlyph(e, glyph, penX, rowPenY, false, styleColors[style]);
+        glyphCount++;
+        if (lineNum == currentLine && i == e->view->cursor) {
+          renderCursor(e, penX, rowPenY, selected);
+        }
+        penX += advance;
+        prevGlyphRightBorder = glyphRightBorder;
+        prev = c;
+      }
+      // space in the end of line to be able to continue it
+      if (lastRow && penX < winWidth << 6) {
+        if (lineNum == currentLine && lineEnd == e->view->cursor) {
+          renderCursor(e, penX, rowPenY, selected);
+        }
+        renderGlyph(e, getGlyph(e, ' '), penX, rowPenY, false, styleColors[STYLE_TEXT]);
+      }
+      if (cacheRow >= 0) {
+        endCachedRow(e, cacheRow, penY, winWidth);
+      }
+      penY += e->lineHeight;
+    }
+    traceRecord("renderGlyphs", glyphsStart, glyphCount);
+    lineNum++;
+  }
+  traceRecord("renderText", traceStart, -1);
+}
+
+// Numbers of the lines starting on the screen, counted from the top line
+// index of the view instead of from the text, drawn with the text's glyphs.
+void renderGutter(E *e, int width) {
+  View *view = e->view;
+  size_t lineCount = E_getLineCount(e);
+  size_t currentLine = getCurrentLineIndex(e);
+  int digitAdvance = getGlyph(e, '0')->advance;
+  int penY = e->lineHeight - view->scrollPixelY;
+  for (size_t line = view->visibleLineTop; line < lineCount && penY <= e->pane->rect.h + e->lineHeight; line++) {
+    size_t rowCount = e->softWrap ? getRowCount(getWrapLine(e, e->pane, line)) : 1;
+    size_t row = line == view->visibleLineTop ? MIN(view->visibleRowTop, rowCount - 1) : 0;
+    if (row == 0) {
+      char digits[24];
+      int count = snprintf(digits, sizeof(digits), "%zu", line + 1);
+      int penX = ((width - GUTTER_PADDING) << 6) - count * digitAdvance;
+      for (int i = 0; i < count; i++) {
+        renderGlyph(e, getGlyph(e, digits[i]), penX, penY, false, line == currentLine ? 0x000000 : 0x808080);
+        penX += digitAdvance;
+      }
+    }
+    penY += (rowCount - row) * e->lineHeight;
+  }
+}
+
+void renderStatusLine(E *e, Uint64 t0) {
+  SDL_Rect statusLineRect = {0, e->height - e->statusLineHeight, e->width, e->statusLineHeight};
+  fillRect(e, statusLineRect, 0xdcdcdc);
+  fillRect(e, (SDL_Rect){0, e->height - e->statusLineHeight, e->width, 1}, 0x000000);
+  Uint64 t1 = SDL_GetPerformanceCounter();
+  double duration = (t1 - t0) * 1.0 / e->perfCountFreqMS;
+  if (duration > 1000) {
+    duration = 1000;
+  }
+
+  int lineIndex = 0;
+  int lineStart = 0;
+  fillCurrentLineAndOffset(e, &lineIndex, &lineStart);
+  int count = snprintf(e->lineBuf, 1000, "  %s (%d:%lu)   %.1fms", e->doc->fileName, lineIndex+1, e->view->cursor - lineStart, duration);
+  renderLine(e, e->lineBuf, count, 0, e->height - e->statusLineBaselineOffset);
+}
+
+Uint64 getDurationUs(E *e, Uint64 start, Uint64 end) {
+  return end > start ? (end - start) * 1000 / e->perfCountFreqMS : 0;
+}
+
+void recordLatency(E *e, Uint64 renderedTime, Uint64 presentedTime) {
+  Latency *latency = &e->latency;
+  if (!latency->eventTime) {
+    return;
+  }
+  Histogram *h = latency->histograms;
+  Histogram_record(&h[LATENCY_HANDLE], getDurationUs(e, latency->eventTime, latency->handledTime));
+  Histogram_record(&h[LATENCY_RENDER], getDurationUs(e, latency->handledTime, renderedTime));
+  Histogram_record(&h[LATENCY_PRESENT], getDurationUs(e, renderedTime, presentedTime));
+  Histogram_record(&h[LATENCY_TOTAL], getDurationUs(e, latency->eventTime, presentedTime));
+  latency->eventTime = 0;
+}
+
+// in pixels
+int getTextWidth(E *e, char *text, size_t size) {
+  int result = 0;
+  char prev = 0;
+  for (size_t i = 0; i < size; i++) {
+    result = advanceX(e, result + (prev ? getKerning(e, prev, text[i]) : 0), text[i]);
+    prev = text[i];
+  }
+  return (result + 63) >> 6;
+}
+
+// box with lines of text in the top left or top right corner of the text area
+void renderOverlay(E *e, char **lines, int *counts, int lineCount, bool right) {
+  int width = 0;
+  for (int i = 0; i < lineCount; i++) {
+    width = MAX(width, getTextWidth(e, lines[i], counts[i]));
+  }
+  int padding = 4;
+  int x = right ? e->width - width - 3 * padding : padding;
+  SDL_Rect rect = {x, padding, width + 2 * padding, lineCount * e->lineHeight + 2 * padding};
+  fillRect(e, rect, 0xffffe0);
+  strokeRect(e, rect, 0x000000);
+  for (int i = 0; i < lineCount; i++) {
+    renderLine(e, lines[i], counts[i], rect.x + padding, rect.y + padding + (i + 1) * e->lineHeight - e->statusLineBaselineOffset);
+  }
+}
+
+void renderLatencyOverlay(E *e) {
+  char lineBufs[LATENCY_STAGE_COUNT + 2][100];
+  char *lines[LATENCY_STAGE_COUNT + 2];
+  int counts[LATENCY_STAGE_COUNT + 2];
+  int lineCount = LATENCY_STAGE_COUNT + 1;
+  for (int i = 0; i < LATENCY_STAGE_COUNT + 2; i++) {
+    lines[i] = lineBufs[i];
+  }
+  counts[0] = snprintf(lines[0], sizeof(lineBufs[0]), "%-8s %9s %9s %9s %7s", "us", "p50", "p99", "max", "n");
+  for (int i = 0; i < LATENCY_STAGE_COUNT; i++) {
+    Histogram *h = &e->latency.histograms[i];
+    counts[i + 1] = snprintf(lines[i + 1], sizeof(lineBufs[i + 1]), "%-8s %9lu %9lu %9lu %7lu", latencyStageNames[i],
+            Histogram_getPercentile(h, 50), Histogram_getPercentile(h, 99), h->max, h->totalCount);
+  }
+  LineCache *cache = &e->lineCache;
+  if (cache->enabled) {
+    Uint64 lookups = cache->hits + cache->misses;
+    counts[lineCount] = snprintf(lines[lineCount], sizeof(lineBufs[lineCount]), "%-8s %9lu hits %9lu misses %5.1f%%",
+            "rows", cache->hits, cache->misses, lookups ? cache->hits * 100.0 / lookups : 0.0);
+    lineCount++;
+  }
+  renderOverlay(e, lines, counts, lineCount, true);
+}
+
+size_t getSyntaxNodeMemory(SyntaxNode *node) {
+  size_t memory = buf_cap(node->children) * sizeof(SyntaxNode);
+  for (size_t i = 0; i < buf_len(node->children); i++) {
+    memory += getSyntaxNodeMemory(&node->children[i]);
+  }
+  return memory;
+}
+
+size_t getDocumentMemory(Document *doc) {
+  size_t memory = sizeof(Document) + strlen(doc->fileName) + 1 + doc->buffer.bufferSize +
+                  doc->buffer.lines.cap * sizeof(size_t) + doc->highlight.cap * (1 + 2 * sizeof(BracketSummary)) +
+                  getSyntaxNodeMemory(&doc->syntax.root);
+  for (int i = 0; i < CHECKPOINT_CACHE_SIZE; i++) {
+    memory += buf_cap(doc->longLines[i].checkpoints) * sizeof(Checkpoint);
+  }
+  return memory;
+}
+
+void renderDocumentList(E *e) {
+  int docCount = buf_len(e->docs);
+  int lineCount = MIN(docCount + 1, MAX(e->textHeight / e->lineHeight - 1, 1));
+  char *lineBuf = xalloc(lineCount * 100);
+  char **lines = xalloc(lineCount * sizeof(char *));
+  int *counts = xalloc(lineCount * sizeof(int));
+  size_t totalMemory = 0;
+  for (int i = 0; i < docCount; i++) {
+    totalMemory += getDocumentMemory(e->docs[i]);
+  }
+  for (int i = 0; i < lineCount; i++) {
+    lines[i] = &lineBuf[i * 100];
+  }
+  counts[0] = snprintf(lines[0], 100, "%d documents, %lu bytes", docCount, totalMemory);
+  for (int i = 0; i < lineCount - 1; i++) {
+    Document *doc = e->docs[i];
+    Uint32 idleSeconds = doc == e->doc ? 0 : (SDL_GetTicks() - doc->lastShownTicks) / 1000;
+    counts[i + 1] = snprintf(lines[i + 1], 100, "%c %-24s %10lu text %10lu bytes %5us idle", doc == e->doc ? '*' : ' ',
+            doc->fileName, getTextSize(&doc->buffer), getDocumentMemory(doc), idleSeconds);
+  }
+  renderOverlay(e, lines, counts, lineCount, false);
+  free(counts);
+  free(lines);
+  free(lineBuf);
+}
+
+void selectPane(E *e, Pane *pane) {
+  e->pane = pane;
+  e->doc = pane->doc;
+  e->view = &pane->view;
+}
+
+// Renders all leaves in one pass, each into its own viewport which clips and
+// translates its drawing. Rendering temporarily selects the pane, so the
+// rendering code sees the pane's document and view as the current ones.
+void renderPanes(E *e, Pane *pane) {
+  if (pane->first) {
+    renderPanes(e, pane->first);
+    renderPanes(e, pane->second);
+    SDL_Rect second = pane->second->rect;
+    if (pane->sideBySide) {
+      fillRect(e, (SDL_Rect){second.x - 1, second.y, 1, second.h + 1}, 0x808080);
+    } else {
+      fillRect(e, (SDL_Rect){second.x, second.y - 1, second.w + 1, 1}, 0x808080);
+    }
+    return;
+  }
+  Pane *selected = e->pane;
+  selectPane(e, pane);
+  SDL_Rect textRect = getTextRect(e, pane);
+  setViewport(e, &textRect);
+  renderText(e, pane == selected);
+  if (textRect.x > pane->rect.x) {
+    // after renderText, which scrolls a wrapped view to its cursor
+    SDL_Rect gutterRect = {pane->rect.x, pane->rect.y, textRect.x - pane->rect.x, pane->rect.h};
+    setViewport(e, &gutterRect);
+    renderGutter(e, gutterRect.w);
+  }
+  setViewport(e, 0);
+  pane->doc->lastShownTicks = SDL_GetTicks();
+  selectPane(e, selected);
+}
+
+void updateUI(E *e) {
+  Uint64 t0 = SDL_GetPerformanceCounter();
+  e->lineCache.frame++;
+  clearFrame(e, 0xffffff);
+  renderPanes(e, e->rootPane);
+  renderStatusLine(e, t0);
+  if (e->latency.showOverlay) {
+    renderLatencyOverlay(e);
+  }
+  if (e->showDocumentList) {
+    renderDocumentList(e);
+  }
+  if (e->framebuffer.enabled) {
+    uploadFramebuffer(e);
+  }
+  Uint64 renderedTime = SDL_GetPerformanceCounter();
+  SDL_RenderPresent(e->renderer);
+  recordLatency(e, renderedTime, SDL_GetPerformanceCounter());
+  traceRecord("updateUI", t0, -1);
+}
+
+void saveTrace(E *e) {
+  const char *path = trace.path ? trace.path : "e.trace.json";
+  if (!writeTrace(path)) {
+    perror("Failed to write trace");
+  }
+}
+
+void toggleLatencyOverlay(E *e) {
+  e->latency.showOverlay = !e->latency.showOverlay;
+}
+
+void dumpLatency(E *e, const char *path) {
+  FILE *file = fopen(path, "w");
+  if (!file) {
+    perror("Failed to open latency dump");
+    return;
+  }
+  for (int i = 0; i < LATENCY_STAGE_COUNT; i++) {
+    Histogram *h = &e->latency.histograms[i];
+    fprintf(file, "# %s: n=%lu p50=%luus p90=%luus p99=%luus p99.9=%luus max=%luus\n", latencyStageNames[i],
+            h->totalCount, Histogram_getPercentile(h, 50), Histogram_getPercentile(h, 90),
+            Histogram_getPercentile(h, 99), Histogram_getPercentile(h, 99.9), h->max);
+    fprintf(file, "%-12s %-12s %s\n", "value_us", "percentile", "count");
+    Uint64 count = 0;
+    for (size_t j = 0; j < HIST_BUCKETS * HIST_SUB_BUCKETS; j++) {
+      if (h->counts[j]) {
+        count += h->counts[j];
+        fprintf(file, "%-12lu %-12.6f %lu\n", MIN(Histogram_getValue(j), h->max), count * 1.0 / h->totalCount, h->counts[j]);
+      }
+    }
+    fprintf(file, "\n");
+  }
+  fclose(file);
+}
+
+// x of the cursor from the start of its line, or of its row in soft wrap mode
+Sint64 getCursorOffsetX(E *e) {
+  size_t cursor = e->view->cursor;
+  size_t line = E_getLineIndex(e, cursor);
+  size_t lineStart = E_getLineStart(e, line);
+  if (e->softWrap) {
+    WrapLine *wrap = getWrapLine(e, e->pane, line);
+    return getOffsetX(e, getRowStart(wrap, lineStart, getWrapRow(wrap, cursor - lineStart)), cursor);
+  }
+  return getLineOffsetX(e, lineStart, E_getLineEnd(e, line), cursor);
+}
+
+void updateScreenLeftBorderOffsetX(E *e) {
+  if (e->batchDepth) {
+    // done once when the batch ends
+    return;
+  }
+  if (e->softWrap) {
+    e->view->screenLeftBorderOffsetX = 0;
+    return;
+  }
+  char c = E_getChar(e, e->view->cursor);
+  char nextC = e->view->cursor < E_getTextLen(e) - 1 ? E_getChar(e, e->view->cursor + 1) : 0;
+  Sint64 cursorOffsetX = getCursorOffsetX(e);
+  Sint64 nextCharOffset = cursorOffsetX;
+  if (c == '\n') {
+    nextCharOffset += getGlyph(e, ' ')->advance;
+  } else {
+    int kerning = nextC ? getKerning(e, E_getChar(e, e->view->cursor), nextC) : 0;
+    nextCharOffset = advanceX(e, nextCharOffset, c) + kerning;
+  }
+  Sint64 width = (Sint64) getTextRect(e, e->pane).w << 6;
+  if ((nextCharOffset - e->view->screenLeftBorderOffsetX) > width) {
+    e->view->screenLeftBorderOffsetX = nextCharOffset - width;
+  } else if (cursorOffsetX < e->view->screenLeftBorderOffsetX) {
+    e->view->screenLeftBorderOffsetX = cursorOffsetX;
+  }
+}
+
+size_t adjustOffset(size_t o, size_t offset, size_t deleted, size_t inserted) {
+  if (o <= offset) {
+    return o;
+  }
+  if (o < offset + deleted) {
+    return offset;
+  }
+  return o - deleted + inserted;
+}
+
+// Keeps a view of the edited document looking at the same text after
+// [offset, offset + deleted) was replaced with inserted chars. Line numbers
+// come from the line index, nothing is rescanned.
+void adjustView(E *e, View *view, int visibleLineCount, size_t offset, size_t deleted, size_t inserted,
+                size_t deletedLines, size_t insertedLines) {
+  view->cursor = adjustOffset(view->cursor, offset, deleted, inserted);
+  view->selectionStart = adjustOffset(view->selectionStart, offset, deleted, inserted);
+  size_t editLine = E_getLineIndex(e, offset);
+  size_t top = view->visibleLineTop;
+  if (editLine < top) {
+    top = top - MIN(deletedLines, top - editLine) + insertedLines;
+  }
+  size_t cursorLine = E_getLineIndex(e, view->cursor);
+  if (cursorLine < top) {
+    top = cursorLine;
+  } else if (cursorLine >= top + visibleLineCount) {
+    top = cursorLine - visibleLineCount + 1;
+  }
+  view->visibleLineTop = top;
+  view->visibleLineCursor = cursorLine - top;
+}
+
+void adjustPaneViews(E *e, Pane *pane, size_t offset, size_t deleted, size_t inserted,
+                     size_t deletedLines, size_t insertedLines) {
+  if (pane->first) {
+    adjustPaneViews(e, pane->first, offset, deleted, inserted, deletedLines, insertedLines);
+    adjustPaneViews(e, pane->second, offset, deleted, inserted, deletedLines, insertedLines);
+  } else if (pane != e->pane && pane->doc == e->doc) {
+    adjustView(e, &pane->view, pane->visibleLineCount, offset, deleted, inserted, deletedLines, insertedLines);
+  }
+}
+
+// the selected view is maintained by the editing commands themselves,
+// other panes on the document and its saved view are adjusted here
+void adjustOtherViews(E *e, size_t offset, size_t deleted, size_t inserted, size_t deletedLines, size_t insertedLines) {
+  adjustPaneViews(e, e->rootPane, offset, deleted, inserted, deletedLines, insertedLines);
+  adjustView(e, &e->doc->view, e->pane->visibleLineCount, offset, deleted, inserted, deletedLines, insertedLines);
+}
+
+// keeps the wrap layouts of the edited document in step with its line index
+void adjustWrapLayouts(E *e, Pane *pane, size_t line, size_t deletedLines, size_t insertedLines) {
+  if (pane->first) {
+    adjustWrapLayouts(e, pane->first, line, deletedLines, insertedLines);
+    adjustWrapLayouts(e, pane->second, line, deletedLines, insertedLines);
+  } else if (pane->wrap.doc == e->doc) {
+    WrapLayout_edit(&pane->wrap, line, deletedLines, insertedLines);
+  }
+}
+
+void E_insertChar(E *e, size_t offset, char c) {
+  insertChar(&e->doc->buffer, offset, c);
+  adjustCheckpoints(e->doc, offset, 0, 1);
+  Highlight_edit(&e->doc->highlight, E_getLineIndex(e, offset), 0, c == '\n');
+  SyntaxTree_edit(e->doc, offset, 0, 1);
+  if (e->softWrap) {
+    adjustWrapLayouts(e, e->rootPane, E_getLineIndex(e, offset), 0, c == '\n');
+  }
+  adjustOtherViews(e, offset, 0, 1, 0, c == '\n');
+}
+
+void E_deleteRegion(E *e, size_t start, size_t end) {
+  size_t min = MIN(start, end);
+  size_t max = MIN(MAX(start, end), E_getTextLen(e));
+  if (min >= max) {
+    return;
+  }
+  size_t lineCount = E_getLineCount(e);
+  deleteRegion(&e->doc->buffer, min, max);
+  adjustCheckpoints(e->doc, min, max - min, 0);
+  Highlight_edit(&e->doc->highlight, E_getLineIndex(e, min), lineCount - E_getLineCount(e), 0);
+  SyntaxTree_edit(e->doc, min, max - min, 0);
+  if (e->softWrap) {
+    adjustWrapLayouts(e, e->rootPane, E_getLineIndex(e, min), lineCount - E_getLineCount(e), 0);
+  }
+  adjustOtherViews(e, min, max - min, 0, lineCount - E_getLineCount(e), 0);
+}
+
+// deleting '\0' terminating the text is noop
+void E_deleteChar(E *e, size_t offset) {
+  E_deleteRegion(e, offset, offset + 1);
+}
+
+void insertCharAtCursor(E *e, char c) {
+  assert(0 <= e->view->cursor && e->view->cursor <= E_getTextLen(e));
+  E_insertChar(e, e->view->cursor, c);
+
+  e->view->cursor++;
+  if (c == '\n') {
+    if (e->view->visibleLineCursor < e->pane->visibleLineCount - 1) {
+      e->view->visibleLineCursor++;
+    } else {
+      e->view->visibleLineTop++;
+    }
+  }
+  e->view->hasSelection = 0;
+  updateScreenLeftBorderOffsetX(e);
+}
+
+void deleteCharAtCursor(E *e) {
+  assert(0 <= e->view->cursor && e->view->cursor <= E_getTextLen(e));
+  if (e->view->hasSelection) {
+    E_deleteRegion(e, e->view->selectionStart, e->view->cursor);
+    if (e->view->cursor > e->view->selectionStart) {
+      e->view->cursor = e->view->selectionStart;
+    }
+    e->view->hasSelection = 0;
+  } else {
+    E_deleteChar(e, e->view->cursor);
+    if (e->view->cursor == E_getTextLen(e)) {
+      // cursor is at '\0' terminating the text, deleting it is noop
+      return;
+    }
+    e->view->hasSelection = 0;
+    e->view->cursor = MIN(e->view->cursor, E_getTextLen(e));
+  }
+}
+
+void deleteCharBackwards(E *e) {
+  if (e->view->hasSelection) {
+    E_deleteRegion(e, e->view->selectionStart, e->view->cursor);
+    if (e->view->cursor > e->view->selectionStart) {
+      e->view->cursor = e->view->selectionStart;
+    }
+    e->view->hasSelection = 0;
+  } else if (e->view->cursor > 0) {
+    E_deleteChar(e, e->view->cursor - 1);
+    e->view->cursor = e->view->cursor - 1;
+    e->view->hasSelection = 0;
+  }
+}
+
+void saveFile(E *e) {
+  if (e->headless || !e->doc->path) {
+    // replayed sessions must not overwrite the file they are replayed on,
+    // the empty document of a server started without files has no file
+    return;
+  }
+  Uint64 traceStart = SDL_GetPerformanceCounter();
+  FILE *file = fopen(e->doc->path, "w+b");
+  if (!file) {
+    die("Open file failed");
+  }
+  size_t w1 = fwrite(e->doc->buffer.text, 1, e->doc->buffer.gapStart, file);
+  size_t w2 = fwrite(&e->doc->buffer.text[e->doc->buffer.gapEnd], 1, e->doc->buffer.bufferSize - e->doc->buffer.gapEnd, file);
+  fclose(file);
+  if (w1 + w2 != E_getTextLen(e) + 1) {
+    die("Write failed");
+  }
+  traceRecord("saveFile", traceStart, w1 + w2);
+}
+
+// Gives the spare memory of the gap back for documents which were not shown
+// for a while, the gap grows again on the next edit.
+void compactBuffer(Buffer *buffer) {
+  size_t gapSize = buffer->gapEnd - buffer->gapStart;
+  if (gapSize == 0) {
+    return;
+  }
+  moveGap(buffer, buffer->bufferSize - gapSize);
+  buffer->bufferSize -= gapSize;
+  buffer->text = xrealloc(buffer->text, buffer->bufferSize);
+  buffer->gapStart = buffer->bufferSize;
+  buffer->gapEnd = buffer->bufferSize;
+}
 
-  // file name
-  int i = strlen(path) - 1;
-  for (; i >= 0; i--) {
-    if (path[i] == '/') {
-      i++;
-      break;
+bool isDocumentShown(Pane *pane, Document *doc) {
+  if (pane->first) {
+    return isDocumentShown(pane->first, doc) || isDocumentShown(pane->second, doc);
+  }
+  return pane->doc == doc;
+}
+
+void compactIdleDocuments(E *e) {
+  Uint32 now = SDL_GetTicks();
+  for (size_t i = 0; i < buf_len(e->docs); i++) {
+    Document *doc = e->docs[i];
+    if (!isDocumentShown(e->rootPane, doc) && now - doc->lastShownTicks > DOCUMENT_IDLE_MS) {
+      compactBuffer(&doc->buffer);
+      freeLineCheckpoints(doc);
+      Highlight_free(&doc->highlight);
+      SyntaxTree_free(&doc->syntax);
     }
   }
-  size_t fileNameLen = strlen(path) - i;
-  char *fileName = xalloc(fileNameLen + 1);
-  strncpy(fileName, &path[i], fileNameLen);
-  fileName[fileNameLen] = '\0';
+  e->lastCompactTicks = now;
+}
 
-  fclose(file);
+// Switching only swaps the document and view state of the selected pane,
+// the next frame is rendered from the saved view state.
+void showDocument(E *e, Document *doc) {
+  e->doc->lastShownTicks = SDL_GetTicks();
+  e->doc->view = e->pane->view;
+  e->pane->doc = doc;
+  e->pane->view = doc->view;
+  selectPane(e, e->pane);
+  e->curKeys = e->rootKeys;
+  // window could be resized while the document was hidden
+  clampVisibleLineCursor(e->view, e->pane->visibleLineCount);
+  if (e->window) {
+    SDL_SetWindowTitle(e->window, doc->path);
+  }
+  compactIdleDocuments(e);
+}
 
-  FT_Library ftLib;
-  FT_Error error = FT_Init_FreeType(&ftLib);
-  if (error) {
-    die("Failed to init ft");
+size_t getDocumentIndex(E *e, Document *doc) {
+  for (size_t i = 0; i < buf_len(e->docs); i++) {
+    if (e->docs[i] == doc) {
+      return i;
+    }
   }
+  return 0;
+}
 
-  E e = (E) {
-          .path = path,
-          .fileName = fileName,
-          .height=768,
-          .width=1024,
-          .buffer = {
-                  .text = text,
-                  .bufferSize = strlen(text) + 1,
-          },
-          .ftLib = ftLib,
-          .perfCountFreqMS = SDL_GetPerformanceFrequency() / 1000,
-  };
+void nextDocument(E *e) {
+  size_t count = buf_len(e->docs);
+  showDocument(e, e->docs[(getDocumentIndex(e, e->doc) + 1) % count]);
+}
 
-  setKeyHandler(&e, "\\L", moveLeft);
-  setKeyHandler(&e, "\\Cb", moveLeft);
-  setKeyHandler(&e, "\\R", moveRight);
-  setKeyHandler(&e, "\\Cf", moveRight);
-  setKeyHandler(&e, "\\U", moveLineUp);
-  setKeyHandler(&e, "\\Cp", moveLineUp);
-  setKeyHandler(&e, "\\D", moveLineDown);
-  setKeyHandler(&e, "\\Cn", moveLineDown);
-  setKeyHandler(&e, "\\Ca", moveToStartOfLine);
-  setKeyHandler(&e, "\\Ce", moveToEndOfLine);
-  setKeyHandler(&e, "\\Ab", moveWordBackward);
-  setKeyHandler(&e, "\\Af", moveWordForward);
-  setKeyHandler(&e, "\\Cd", deleteCharAtCursor);
-  setKeyHandler(&e, "\\Ch", deleteCharBackwards);
-  setKeyHandler(&e, "\\C ", startSelection);
-  setKeyHandler(&e, "\\Cg", escape);
-  setKeyHandler(&e, "\\Aw", copySelectionToKillRing);
-  setKeyHandler(&e, "\\Cy", yank);
-  setKeyHandler(&e, "\\Cx\\Cs", saveFile);
+void previousDocument(E *e) {
+  size_t count = buf_len(e->docs);
+  showDocument(e, e->docs[(getDocumentIndex(e, e->doc) + count - 1) % count]);
+}
 
-  e.curKeys = e.rootKeys;
+void freeWrapLayouts(Pane *pane) {
+  if (pane->first) {
+    freeWrapLayouts(pane->first);
+    freeWrapLayouts(pane->second);
+  } else {
+    WrapLayout_free(&pane->wrap);
+  }
+}
 
-  return e;
+// Rows are tracked by renderText while wrapping, visibleLineCursor is put
+// back in lines when wrapping is turned off.
+void resetVisibleLines(E *e, Pane *pane) {
+  if (pane->first) {
+    resetVisibleLines(e, pane->first);
+    resetVisibleLines(e, pane->second);
+    return;
+  }
+  Pane *selected = e->pane;
+  selectPane(e, pane);
+  pane->view.visibleRowTop = 0;
+  adjustView(e, &pane->view, pane->visibleLineCount, 0, 0, 0, 0, 0);
+  updateScreenLeftBorderOffsetX(e);
+  selectPane(e, selected);
 }
 
+void toggleSoftWrap(E *e) {
+  e->softWrap = !e->softWrap;
+  if (!e->softWrap) {
+    freeWrapLayouts(e->rootPane);
+    resetVisibleLines(e, e->rootPane);
+  }
+}
 
-void initVisibleLines(E *e) {
-  e->lineHeight = e->ftFace->size->metrics.height >> 6;
-  e->statusLineBaselineOffset = abs(e->ftFace->size->metrics.descender >> 6);
-  e->statusLineHeight = e->lineHeight + e->statusLineBaselineOffset;
-  e->textHeight = e->height - e->statusLineHeight;
-  e->visibleLineCount = floor((e->textHeight - e->statusLineHeight) * 1.0 / e->lineHeight);
+void toggleLineNumbers(E *e) {
+  e->lineNumbers = !e->lineNumbers;
+}
+
+// shows or hides the tab and trailing space markers together
+void toggleWhitespaceMarkers(E *e) {
+  Uint8 whitespace = 1 << MARKER_TAB | 1 << MARKER_SPACE;
+  e->markers = e->markers & whitespace ? e->markers & ~whitespace : e->markers | whitespace;
+  updateShownGlyphs(e);
+}
+
+void toggleDocumentList(E *e) {
+  e->showDocumentList = !e->showDocumentList;
+}
+
+Pane *getFirstLeaf(Pane *pane) {
+  while (pane->first) {
+    pane = pane->first;
+  }
+  return pane;
+}
+
+void splitPane(E *e, bool sideBySide) {
+  Pane *pane = e->pane;
+  Pane *first = xcalloc(1, sizeof(Pane));
+  Pane *second = xcalloc(1, sizeof(Pane));
+  *first = (Pane){.parent = pane, .doc = pane->doc, .view = pane->view};
+  *second = *first;
+  pane->first = first;
+  pane->second = second;
+  pane->sideBySide = sideBySide;
+  pane->doc = 0;
+  WrapLayout_free(&pane->wrap);
+  layoutPane(e, pane, pane->rect);
+  selectPane(e, first);
+}
+
+void splitPaneBelow(E *e) {
+  splitPane(e, false);
+}
+
+void splitPaneRight(E *e) {
+  splitPane(e, true);
+}
+
+void selectNextPane(E *e) {
+  Pane *pane = e->pane;
+  while (pane->parent && pane->parent->second == pane) {
+    pane = pane->parent;
+  }
+  selectPane(e, getFirstLeaf(pane->parent ? pane->parent->second : pane));
+}
+
+void deletePane(E *e) {
+  Pane *pane = e->pane;
+  Pane *parent = pane->parent;
+  if (!parent) {
+    return;
+  }
+  Pane *sibling = parent->first == pane ? parent->second : parent->first;
+  pane->doc->view = pane->view;
+  Pane *grandParent = parent->parent;
+  // the sibling's rect is only its half of the parent's area
+  SDL_Rect rect = parent->rect;
+  *parent = *sibling;
+  parent->parent = grandParent;
+  if (parent->first) {
+    parent->first->parent = parent;
+    parent->second->parent = parent;
+  }
+  free(sibling);
+  WrapLayout_free(&pane->wrap);
+  free(pane);
+  layoutPane(e, parent, rect);
+  selectPane(e, getFirstLeaf(parent));
+}
+
+void deleteOtherPanes(E *e) {
+  Pane *root = e->rootPane;
+  if (!root->first) {
+    return;
+  }
+  Pane selected = *e->pane;
+  freePanes(root->first);
+  freePanes(root->second);
+  *root = (Pane){.doc = selected.doc, .view = selected.view};
+  layoutPane(e, root, (SDL_Rect){0, 0, e->width, e->textHeight});
+  selectPane(e, root);
+}
+
+void incVisibleLine(E *e) {
+  if (e->view->visibleLineCursor < e->pane->visibleLineCount - 1) {
+    e->view->visibleLineCursor++;
+  } else if (getCurrentLineIndex(e) + 1 < E_getLineCount(e)) {
+    e->view->visibleLineTop++;
+  }
+}
+
+// moves the cursor to any offset, the view scrolls only if the cursor line is off the screen
+void jumpToOffset(E *e, size_t offset) {
+  View *view = e->view;
+  view->cursor = MIN(offset, E_getTextLen(e));
+  int line = E_getLineIndex(e, view->cursor);
+  if (line < view->visibleLineTop) {
+    view->visibleLineTop = line;
+  } else if (line >= view->visibleLineTop + e->pane->visibleLineCount) {
+    view->visibleLineTop = line - e->pane->visibleLineCount + 1;
+  }
+  view->visibleLineCursor = line - view->visibleLineTop;
+  updateScreenLeftBorderOffsetX(e);
+  view->desiredCursorOffsetX = 0;
+}
+
+// Moves the cursor to any offset through the line index, a line off the
+// screen is scrolled to the middle of it. The caller renders once.
+void goToOffset(E *e, size_t offset) {
+  View *view = e->view;
+  size_t line = E_getLineIndex(e, MIN(offset, E_getTextLen(e)));
+  size_t visibleLineCount = e->pane->visibleLineCount;
+  if (line < view->visibleLineTop || line >= view->visibleLineTop + visibleLineCount) {
+    view->visibleLineTop = line - MIN(line, visibleLineCount / 2);
+    view->visibleRowTop = 0;
+  }
+  jumpToOffset(e, offset);
+}
+
+void decVisibleLine(E *e) {
+  if (e->view->visibleLineCursor > 0) {
+    e->view->visibleLineCursor--;
+  } else if (e->view->visibleLineTop > 0) {
+    e->view->visibleLineTop--;
+  }
+}
+
+void moveToStartOfLine(E *e) {
+  if (e->view->cursor > 0) {
+    e->view->cursor = E_getLineStart(e, getCurrentLineIndex(e));
+    updateScreenLeftBorderOffsetX(e);
+    e->view->desiredCursorOffsetX = 0;
+  }
+}
+
+void moveToEndOfLine(E *e) {
+  size_t textLen = E_getTextLen(e);
+  if (e->view->cursor < textLen) {
+    char c = E_getChar(e, e->view->cursor);
+    if (c == '\n') {
+      return;
+    }
+    e->view->cursor = E_getLineEnd(e, getCurrentLineIndex(e));
+    updateScreenLeftBorderOffsetX(e);
+    e->view->desiredCursorOffsetX = 0;
+  }
+}
+
+void startSelection(E *e) {
+  e->view->selectionStart = e->view->cursor;
+  e->view->hasSelection = 1;
+}
+
+void escape(E *e) {
+  e->view->hasSelection = 0;
+}
+
+void copySelectionToKillRing(E *e) {
+  size_t start = MIN(e->view->selectionStart, e->view->cursor);
+  size_t end = MAX(e->view->selectionStart, e->view->cursor);
+  size_t selectionSize = end - start;
+  char *selection = xalloc(selectionSize);
+  size_t j = 0;
+  for (size_t i = start; i < end; i++) {
+    selection[j++] = E_getChar(e, i);
+  }
+  KillRing_push(&e->killRing, selection, selectionSize);
+  e->view->hasSelection = 0;
+}
+
+void yank(E *e) {
+  KillRingEntry *entry = KillRing_getCurrentEntry(&e->killRing);
+  if (entry) {
+    for (size_t i = 0; i < entry->len; i++) {
+      insertCharAtCursor(e, entry->text[i]);
+    }
+  }
+}
+
+void moveLeft(E *e) {
+  if (e->view->cursor > 0) {
+    e->view->cursor--;
+    if (E_getChar(e, e->view->cursor) == '\n') {
+      decVisibleLine(e);
+    }
+    updateScreenLeftBorderOffsetX(e);
+    e->view->desiredCursorOffsetX = 0;
+  }
+}
+
+void moveRight(E *e) {
+  if (e->view->cursor < E_getTextLen(e)) {
+    char c = E_getChar(e, e->view->cursor);
+    if (c == '\n') {
+      incVisibleLine(e);
+    }
+    e->view->cursor++;
+    updateScreenLeftBorderOffsetX(e);
+    e->view->desiredCursorOffsetX = 0;
+  }
+}
+
+void moveWordBackward(E *e) {
+  if (e->view->cursor > 0) {
+    size_t initial = e->view->cursor - 1;
+    size_t i = initial;
+    size_t decLines = 0;
+    // skip spaces backwards
+    for (; i <= initial; i--) {
+      char c = E_getChar(e, i);
+      if (isspace(c)) {
+        if (c == '\n') {
+          decLines++;
+        }
+      } else {
+        break; 
+      }
+    }
+    for (; i <= initial; i--) {
+      if (isspace(E_getChar(e, i))) {
+        break;
+      }
+    }
+    e->view->cursor = i + 1;
+    for (int j = 0; j < decLines; j++) {
+      decVisibleLine(e);
+    }
+    updateScreenLeftBorderOffsetX(e);
+    e->view->desiredCursorOffsetX = 0;
+  }
+}
+
+void moveWordForward(E *e) {
+  size_t len = E_getTextLen(e);
+  if (e->view->cursor < len) {
+    size_t initial = e->view->cursor;
+    size_t i = initial;
+    size_t incLines = 0;
+    // skip spaces forward
+    for (; i <= len; i++) {
+      char c = E_getChar(e, i);
+      if (isspace(c)) {
+        if (c == '\n') {
+          incLines++;
+        }
+      } else {
+        break;
+      }
+    }
+    for (; i < len; i++) {
+      if (isspace(E_getChar(e, i))) {
+        break;
+      }
+    }
+    e->view->cursor = i;
+    for (int j = 0; j < incLines; j++) {
+      incVisibleLine(e);
+    }
+    updateScreenLeftBorderOffsetX(e);
+    e->view->desiredCursorOffsetX = 0;
+  }
+}
+
+// moves past the next bracket group in the innermost group around the cursor
+void forwardList(E *e) {
+  SyntaxTree *tree = getSyntaxTree(e);
+  if (!tree) {
+    return;
+  }
+  size_t nodeStart = 0;
+  SyntaxNode *node = findSyntaxNode(tree, e->view->cursor, &nodeStart);
+  size_t i = findSyntaxChild(node, e->view->cursor - nodeStart);
+  if (i < buf_len(node->children)) {
+    SyntaxNode *child = &node->children[i];
+    jumpToOffset(e, nodeStart + child->start + child->length);
+  }
+}
+
+// moves to the start of the previous bracket group in the innermost group around the cursor
+void backwardList(E *e) {
+  SyntaxTree *tree = getSyntaxTree(e);
+  if (!tree) {
+    return;
+  }
+  size_t nodeStart = 0;
+  SyntaxNode *node = findSyntaxNode(tree, e->view->cursor, &nodeStart);
+  size_t i = findSyntaxChild(node, e->view->cursor - nodeStart);
+  if (i > 0) {
+    jumpToOffset(e, nodeStart + node->children[i - 1].start);
+  }
+}
+
+// moves to the opening bracket of the innermost group around the cursor
+void backwardUpList(E *e) {
+  SyntaxTree *tree = getSyntaxTree(e);
+  if (!tree) {
+    return;
+  }
+  size_t nodeStart = 0;
+  SyntaxNode *node = findSyntaxNode(tree, e->view->cursor, &nodeStart);
+  if (node != &tree->root) {
+    jumpToOffset(e, nodeStart);
+  }
+}
+
+// moves to the start of the line of the top level '{' before the cursor,
+// in C that's where the function, struct or initializer starts
+void beginningOfDefun(E *e) {
+  SyntaxTree *tree = getSyntaxTree(e);
+  if (!tree) {
+    return;
+  }
+  SyntaxNode *root = &tree->root;
+  for (size_t i = findSyntaxChild(root, e->view->cursor); i > 0; i--) {
+    SyntaxNode *node = &root->children[i - 1];
+    size_t lineStart = E_getLineStart(e, E_getLineIndex(e, node->start));
+    if (node->open == '{' && lineStart < e->view->cursor) {
+      jumpToOffset(e, lineStart);
+      return;
+    }
+  }
+}
+
+// moves past the closing bracket of the top level '{' around or after the cursor
+void endOfDefun(E *e) {
+  SyntaxTree *tree = getSyntaxTree(e);
+  if (!tree) {
+    return;
+  }
+  SyntaxNode *root = &tree->root;
+  size_t i = findSyntaxChild(root, e->view->cursor);
+  for (i = i > 0 ? i - 1 : 0; i < buf_len(root->children); i++) {
+    SyntaxNode *node = &root->children[i];
+    if (node->open == '{' && node->start + node->length > e->view->cursor) {
+      jumpToOffset(e, node->start + node->length);
+      return;
+    }
+  }
+}
+
+// moves to the bracket matching the one at the cursor or the closing one before it
+void jumpToMatchingBracket(E *e) {
+  updateHighlight(e->doc, SIZE_MAX);
+  size_t bracket = 0, match = 0;
+  if (getCursorBracket(e, &bracket, &match) && match != SIZE_MAX) {
+    jumpToOffset(e, match);
+  }
+}
+
+// moves to the start of line prefixArg, counted from 1 like in the status line
+void goToLine(E *e) {
+  if (e->prefixArg) {
+    goToOffset(e, E_getLineStart(e, MIN(e->prefixArg, E_getLineCount(e)) - 1));
+  }
+}
+
+// moves to char prefixArg of the text, counted from 1
+void goToChar(E *e) {
+  if (e->prefixArg) {
+    goToOffset(e, e->prefixArg - 1);
+  }
+}
+
+// First offset in [start, end) whose glyph ends past x, measured from the pen
+// position startX where prev is the char before start, end if there is none
+size_t findOffsetAtX(E *e, size_t start, Sint64 startX, char prev, size_t end, Sint64 x) {
+  Sint64 offset = startX;
+  size_t i = start;
+  for (; i < end; i++) {
+    char c = E_getChar(e, i);
+    Sint64 next = advanceX(e, offset + (prev ? getKerning(e, prev, c) : 0), c);
+    if (next > x) {
+      break;
+    }
+    offset = next;
+    prev = c;
+  }
+  return i;
+}
+
+// the x the cursor keeps while moving between lines, taken from the cursor on the first move
+Sint64 getDesiredCursorOffsetX(E *e) {
+  if (!e->view->desiredCursorOffsetX) {
+    e->view->desiredCursorOffsetX = getCursorOffsetX(e);
+  }
+  return e->view->desiredCursorOffsetX;
 }
 
+// moves line and row by count rows in soft wrap mode, down if count > 0,
+// stopping at the text start or end, returns the number of rows moved
+long stepRows(E *e, size_t *line, size_t *row, long count) {
+  long moved = 0;
+  for (; moved < count; moved++) {
+    if (*row + 1 < getRowCount(getWrapLine(e, e->pane, *line))) {
+      (*row)++;
+    } else if (*line + 1 < E_getLineCount(e)) {
+      (*line)++;
+      *row = 0;
+    } else {
+      break;
+    }
+  }
+  for (; moved < -count; moved++) {
+    if (*row > 0) {
+      (*row)--;
+    } else if (*line > 0) {
+      (*line)--;
+      *row = getRowCount(getWrapLine(e, e->pane, *line)) - 1;
+    } else {
+      break;
+    }
+  }
+  return moved;
+}
 
-void setKerning(E *e, unsigned char left, unsigned char right, int kerning) {
-  e->kerning[left * 256 + right] = kerning;
+// moves the cursor to the char at x on a row in soft wrap mode
+void moveToRow(E *e, size_t line, size_t row, Sint64 x) {
+  WrapLine *wrap = getWrapLine(e, e->pane, line);
+  size_t lineStart = E_getLineStart(e, line);
+  size_t rowStart = getRowStart(wrap, lineStart, row);
+  size_t rowEnd = getRowEnd(wrap, lineStart, E_getLineEnd(e, line), row);
+  if (row + 1 < getRowCount(wrap)) {
+    // rowEnd is the start of the next row
+    rowEnd--;
+  }
+  e->view->cursor = findOffsetAtX(e, rowStart, 0, 0, rowEnd, x);
 }
 
-int getKerning(E *e, unsigned char left, unsigned char right) {
-  return e->kerning[left * 256 + right];
+// Moves the cursor to the previous or next row in soft wrap mode: the line
+// comes from the line index and the row from the wrap breaks, both with
+// a binary search, only the target row is scanned for the x offset.
+void moveRow(E *e, bool up) {
+  Sint64 desiredCursorOffsetX = getDesiredCursorOffsetX(e);
+  size_t line = E_getLineIndex(e, e->view->cursor);
+  size_t row = getWrapRow(getWrapLine(e, e->pane, line), e->view->cursor - E_getLineStart(e, line));
+  if (stepRows(e, &line, &row, up ? -1 : 1)) {
+    moveToRow(e, line, row, desiredCursorOffsetX);
+  }
 }
 
-E_Glyph *getGlyph(E *e, unsigned char c) {
-  return e->glyphs[c].initialized ? &e->glyphs[c] : &e->glyphs['?'];
+// Offset of the char containing x on a line rendered without wrapping,
+// or the line end when the line is shorter.
+size_t getLineOffsetAtX(E *e, size_t line, Sint64 x) {
+  size_t lineStart = E_getLineStart(e, line);
+  size_t lineEnd = E_getLineEnd(e, line);
+  Checkpoint checkpoint = getCheckpoint(e, lineStart, lineEnd, lineEnd, x);
+  char prev = checkpoint.offset > lineStart ? E_getChar(e, checkpoint.offset - 1) : 0;
+  return findOffsetAtX(e, checkpoint.offset, checkpoint.x, prev, lineEnd, x);
 }
 
-bool initFont(E *e) {
-  FT_Face face;
-  FT_Error error = FT_New_Memory_Face(e->ftLib, font, sizeof(font), 0, &face);
-  if (error) {
-    e->error = "Failed to init face";
-    return false;
-  }
-  e->ftFace = face;
-  int fontSize = 12;
-  error = FT_Set_Char_Size(face, 0, fontSize*64, 96, 96);
-  if (error) {
-    e->error = "Failed to init font size";
-    return false;
+void moveLineUp(E *e) {
+  if (e->softWrap) {
+    moveRow(e, true);
+    return;
   }
+  Sint64 desiredCursorOffsetX = getDesiredCursorOffsetX(e);
+  size_t line = getCurrentLineIndex(e);
+  e->view->cursor = line > 0 ? getLineOffsetAtX(e, line - 1, desiredCursorOffsetX) : 0;
+  decVisibleLine(e);
+  updateScreenLeftBorderOffsetX(e);
+}
 
-  Uint8 alpha_table[256];
-  for (int i = 0; i < SDL_arraysize(alpha_table); ++i) {
-    alpha_table[i] = (Uint8)i;
+void moveLineDown(E *e) {
+  if (e->softWrap) {
+    moveRow(e, false);
+    return;
+  }
+  Sint64 desiredCursorOffsetX = getDesiredCursorOffsetX(e);
+  size_t line = getCurrentLineIndex(e);
+  bool hasMoreLines = line + 1 < E_getLineCount(e);
+  if (hasMoreLines) {
+    // before the cursor moves, incVisibleLine checks for a line after the cursor line
+    incVisibleLine(e);
   }
+  e->view->cursor = hasMoreLines ? getLineOffsetAtX(e, line + 1, desiredCursorOffsetX) : E_getTextLen(e);
+  updateScreenLeftBorderOffsetX(e);
+}
 
-  for (int c = 0; c < 255; c++) {
-    if (isprint(c)) {
-      error = FT_Load_Char(face, c, FT_LOAD_RENDER);
-      if (error) {
-        continue;
-      }
-      FT_GlyphSlot glyph = face->glyph;
-      FT_Bitmap bitmap = glyph->bitmap;
-      SDL_Texture *texture = 0;
-      if (bitmap.rows) {
-        SDL_Surface *surface = SDL_CreateRGBSurface(0, bitmap.width, bitmap.rows, 32, 0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000);
-        for (int i = 0; i < bitmap.rows; i++) {
-          int srcRowStart = i * bitmap.pitch;
-          Uint32 *dst = (Uint32 *)surface->pixels + i * surface->pitch / 4;
-          for (int j = 0; j < bitmap.width; j++) {
-            unsigned char gray = bitmap.buffer[srcRowStart + j];
-            Uint8 alpha = alpha_table[gray];
-            Uint32 pixel = ((Uint32) alpha << 24);
-            *dst++ = pixel;
-          }
-        }
-        texture = SDL_CreateTextureFromSurface(e->renderer, surface);
-        SDL_FreeSurface(surface);
+// Scrolls the view by count lines, or rows in soft wrap mode, down if count > 0.
+// The top line comes from the line index and the cursor is moved once, only if
+// it left the screen, to the nearest shown line at the x it keeps between lines.
+// Returns the lines or rows scrolled, fewer than count at the text start or end.
+long scrollView(E *e, long count) {
+  View *view = e->view;
+  long visibleLineCount = e->pane->visibleLineCount;
+  size_t cursorLine = getCurrentLineIndex(e);
+  if (e->softWrap) {
+    size_t line = view->visibleLineTop, row = view->visibleRowTop;
+    long moved = stepRows(e, &line, &row, count);
+    view->visibleLineTop = line;
+    view->visibleRowTop = row;
+    size_t cursorRow = getWrapRow(getWrapLine(e, e->pane, cursorLine), view->cursor - E_getLineStart(e, cursorLine));
+    if (cursorLine < line || (cursorLine == line && cursorRow < row)) {
+      moveToRow(e, line, row, getDesiredCursorOffsetX(e));
+    } else {
+      stepRows(e, &line, &row, visibleLineCount - 1);
+      if (cursorLine > line || (cursorLine == line && cursorRow > row)) {
+        moveToRow(e, line, row, getDesiredCursorOffsetX(e));
       }
-
-      e->glyphs[c] = (E_Glyph){
-              .texture = texture,
-              .h = bitmap.rows,
-              .w = bitmap.width,
-              .bearingX = glyph->metrics.horiBearingX >> 6,
-              .bearingY = glyph->metrics.horiBearingY >> 6,
-              .advance = glyph->metrics.horiAdvance >> 6,
-              .initialized = true,
-      };
     }
+    // renderText finds the cursor row on the screen
+    return count < 0 ? -moved : moved;
   }
-  E_Glyph *tab = &e->glyphs['\t'];
-  tab->advance = e->glyphs[' '].advance * 4;
-  tab->initialized = true;
-  if (FT_HAS_KERNING(face)) {
-    for (int left = 0; left < 255; left++) {
-      if (isprint(left)) {
-        FT_UInt leftIndex = FT_Get_Char_Index(face, left);
-        for (int right = 0; right < 255; right++) {
-          if (isprint(right)) {
-            FT_UInt rightIndex = FT_Get_Char_Index(face, right);
-            FT_Vector kerning = {0};
-            FT_Get_Kerning(face, leftIndex, rightIndex, FT_KERNING_DEFAULT, &kerning);
-            setKerning(e, left, right, kerning.x >> 6);
-          }
-        }
-      }
-    }
+  long lastLine = E_getLineCount(e) - 1;
+  long oldTop = view->visibleLineTop;
+  long top = MAX(0, MIN(oldTop + count, lastLine));
+  long bottom = MIN(top + visibleLineCount - 1, lastLine);
+  view->visibleLineTop = top;
+  if ((long) cursorLine < top || (long) cursorLine > bottom) {
+    size_t line = (long) cursorLine < top ? top : bottom;
+    view->cursor = getLineOffsetAtX(e, line, getDesiredCursorOffsetX(e));
+    cursorLine = line;
+    updateScreenLeftBorderOffsetX(e);
   }
-  return true;
+  view->visibleLineCursor = cursorLine - top;
+  return top - oldTop;
 }
 
-
-bool initUI(E *e) {
-  if (SDL_Init(SDL_INIT_VIDEO) < 0) {
-    setEditorError(e, SDL_GetError());
-    return false;
+// whether the top line or row is the last one of the text
+bool isViewAtEnd(E *e) {
+  View *view = e->view;
+  if (e->softWrap) {
+    size_t line = view->visibleLineTop, row = view->visibleRowTop;
+    return stepRows(e, &line, &row, 1) == 0;
   }
-  e->window = SDL_CreateWindow(e->path, SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, e->width, e->height,
-          SDL_WINDOW_SHOWN | SDL_WINDOW_RESIZABLE);
-  if (!e->window) {
-    setEditorError(e, SDL_GetError());
-    return false;
+  return view->visibleLineTop + 1 >= E_getLineCount(e);
+}
+
+// Scrolls the view by pixels, down if pixels > 0. Whole lines go through
+// scrollView, the rest moves the text up by less than a line.
+void scrollViewPixels(E *e, int pixels) {
+  View *view = e->view;
+  int offset = view->scrollPixelY + pixels;
+  long lines = offset >= 0 ? offset / e->lineHeight : -((e->lineHeight - 1 - offset) / e->lineHeight);
+  offset -= lines * e->lineHeight;
+  if (scrollView(e, lines) != lines || (offset > 0 && isViewAtEnd(e))) {
+    // nothing more to scroll to
+    offset = 0;
+    view->scrollPending = 0;
   }
-  e->renderer = SDL_CreateRenderer(e->window, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC );
-  if (!e->renderer) {
-    setEditorError(e, SDL_GetError());
+  view->scrollPixelY = offset;
+}
+
+// Advances the wheel scroll animation of the selected view by the time since
+// its last step, going a share of the rest of the way. Returns true while it
+// runs, then the view is rendered every frame at the pace of presenting.
+bool animateScroll(E *e) {
+  View *view = e->view;
+  if (!view->scrollPending) {
     return false;
   }
-  if (!initFont(e)) {
-    return false;
+  Uint64 now = SDL_GetPerformanceCounter();
+  float ms = (float) (now - view->scrollTime) / e->perfCountFreqMS;
+  view->scrollTime = now;
+  float step = view->scrollPending * MIN(ms / SCROLL_ANIMATION_MS, 1.0f);
+  int pixels = step > 0 ? MAX((int) step, 1) : MIN((int) step, -1);
+  view->scrollPending -= pixels;
+  if (view->scrollPending > -1 && view->scrollPending < 1) {
+    view->scrollPending = 0;
   }
-  initVisibleLines(e);
+  scrollViewPixels(e, pixels);
   return true;
 }
 
-
-void closeEditor(E *e) {
-  if (e->buffer.text) {
-    free(e->buffer.text);
-  }
-  if (e->ftLib) {
-    FT_Done_FreeType(e->ftLib);
-  }
-  if (e->renderer) {
-    SDL_DestroyRenderer(e->renderer);
-  }
-  if (e->window) {
-    SDL_DestroyWindow(e->window);
+// adds a wheel move to the animation, the wheel points down if y < 0
+void startScrollAnimation(E *e, float y) {
+  View *view = e->view;
+  if (!view->scrollPending) {
+    view->scrollTime = SDL_GetPerformanceCounter();
   }
-  SDL_Quit();
+  view->scrollPending -= y * WHEEL_SCROLL_LINES * e->lineHeight;
 }
 
-size_t E_getTextLen(E *e) {
-  return getTextSize(&e->buffer);
+// jumps to the end of the wheel scroll animation, for replays
+void finishScrollAnimation(E *e) {
+  float pending = e->view->scrollPending;
+  e->view->scrollPending = 0;
+  scrollViewPixels(e, (int) pending);
 }
 
-char E_getChar(E *e, size_t offset) {
-  size_t physicalOffset = getPhysicalOffset(&e->buffer, offset);
-  if (physicalOffset < e->buffer.bufferSize) {
-    return e->buffer.text[physicalOffset];
-  } else {
-    return '\0';
-  }
+// keys scroll by whole lines, the pixel offset is dropped when one is pressed
+void stopScrollAnimation(E *e) {
+  e->view->scrollPending = 0;
+  e->view->scrollPixelY = 0;
 }
 
-typedef struct LineIter {
-  E *e;
-  int lineStart;
-  int lineLen;
-} LineIter;
+// the wheel points down if y < 0, trackpads move it by fractions of a notch
+float getWheelY(SDL_MouseWheelEvent *wheel) {
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+  float y = wheel->preciseY;
+#else
+  float y = wheel->y;
+#endif
+  return wheel->direction == SDL_MOUSEWHEEL_FLIPPED ? -y : y;
+}
 
-LineIter createIter(E *e) {
-  return (LineIter){.e = e, .lineStart = -1};
+// lines scrolled by a page, the last ones of the screen stay on it
+long getPageLineCount(E *e) {
+  return MAX(e->pane->visibleLineCount - PAGE_CONTEXT_LINES, 1);
 }
 
-bool lineIterNext(LineIter *iter) {
-  if (!iter->e) {
-    return false;
-  }
-  iter->lineStart = iter->lineStart + iter->lineLen + 1;
-  int len = 0;
-  for (int i = iter->lineStart; ; i++) {
-    char c = E_getChar(iter->e, i);
-    if (c == '\n') {
-      break;
-    }
-    if (c == '\0') {
-      iter->e = 0;
-      break;
-    }
-    len++;
-  }
-  iter->lineLen = len;
-  return true;
+void scrollPageDown(E *e) {
+  scrollView(e, getPageLineCount(e));
 }
 
-void fillCurrentLineAndOffset(E *e, int *lineIndex, int *lineStart) {
-  LineIter iter = createIter(e);
-  int index = 0;
-  while (lineIterNext(&iter)) {
-    if (iter.lineStart <= e->cursor && e->cursor <= iter.lineStart + iter.lineLen) {
-      *lineIndex = index;
-      *lineStart = iter.lineStart;
-      break;
-    }
-    index++;
+void scrollPageUp(E *e) {
+  scrollView(e, -getPageLineCount(e));
+}
+
+void handleResize(E *e, int w, int h) {
+  e->width = w;
+  e->height = h;
+  initVisibleLines(e);
+}
+
+bool isModifierKey(SDL_Keycode sym) {
+  switch (sym) {
+    case SDLK_LCTRL:
+    case SDLK_RCTRL:
+    case SDLK_LSHIFT:
+    case SDLK_RSHIFT:
+    case SDLK_LALT:
+    case SDLK_RALT:
+    case SDLK_LGUI:
+    case SDLK_RGUI:
+      return true;
+    default:
+      return false;
   }
 }
 
-int getCurrentLineIndex(E *e) {
-  LineIter iter = createIter(e);
-  int result = 0;
-  while (lineIterNext(&iter)) {
-    if (iter.lineStart <= e->cursor && e->cursor <= iter.lineStart + iter.lineLen) {
-      break;
-    }
-    result++;
+bool isMacroCommand(E_ActionHandler *handler) {
+  return handler == startMacro || handler == endMacro || handler == executeMacro || handler == digitArgument;
+}
+
+void runHandler(E *e, E_ActionHandler *handler) {
+  if (e->macro.isRecording && !isMacroCommand(handler)) {
+    buf_push(e->macro.recording, ((MacroStep){.handler = handler, .prefixArg = e->prefixArg}));
+  }
+  handler(e);
+  if (handler != digitArgument) {
+    e->prefixArg = 0;
   }
-  return result;
 }
 
-void renderCursor(E *e, int penX, int penY) {
-  Uint8 r = 0, g = 0, b = 0, a = 0;
-  SDL_GetRenderDrawColor(e->renderer, &r, &g, &b, &a);
-  SDL_SetRenderDrawColor(e->renderer, 0x0, 0x0, 0x0, 0xff);
-  SDL_Rect cursorRect = {penX, penY - e->lineHeight, 2, e->lineHeight + 5};
-  SDL_RenderFillRect(e->renderer, &cursorRect);
-  SDL_SetRenderDrawColor(e->renderer, r, g, b, a);
+// inserts a char typed by the user, as opposed to inserted by a command
+void typeChar(E *e, char c) {
+  if (e->macro.isRecording) {
+    buf_push(e->macro.recording, ((MacroStep){.c = c}));
+  }
+  insertCharAtCursor(e, c);
 }
 
-void renderGlyph(E *e, E_Glyph *glyph, int penX, int penY, bool drawGlyphBox, bool withSelection) {
-  if (glyph) {
-    Uint8 r = 0, g = 0, b = 0, a = 0;
-    SDL_GetRenderDrawColor(e->renderer, &r, &g, &b, &a);
-    if (drawGlyphBox) {
-      SDL_SetRenderDrawColor(e->renderer, 0xff, 0x0, 0x0, 0xff);
-      SDL_RenderDrawLine(e->renderer, penX + glyph->bearingX, penY - glyph->bearingY, penX + + glyph->bearingX + glyph->w, penY - glyph->bearingY);
-      SDL_RenderDrawLine(e->renderer, penX + glyph->bearingX, penY - glyph->bearingY + glyph->h, penX + glyph->bearingX + glyph->w, penY - glyph->bearingY + glyph->h);
-      SDL_RenderDrawLine(e->renderer, penX + glyph->bearingX, penY - glyph->bearingY, penX + glyph->bearingX, penY - glyph->bearingY + glyph->h);
-      SDL_RenderDrawLine(e->renderer, penX + glyph->bearingX + glyph->w, penY - glyph->bearingY, penX + glyph->bearingX + glyph->w, penY - glyph->bearingY + glyph->h);
-      SDL_SetRenderDrawColor(e->renderer, r, g, b, a);
-    }
-    if (withSelection) {
-      SDL_SetRenderDrawColor(e->renderer, 0xAD, 0xD8, 0xE6, 0xff);
-      SDL_Rect selectionRect = (SDL_Rect){penX, penY - e->lineHeight, glyph->advance, e->lineHeight + 5};
-      SDL_RenderFillRect(e->renderer, &selectionRect);
-      SDL_SetRenderDrawColor(e->renderer, r, g, b, a);
-    }
-    if (glyph->texture) {
-      SDL_Rect dstRect = (SDL_Rect){penX + glyph->bearingX, penY - glyph->bearingY, glyph->w, glyph->h};
-      SDL_RenderCopy(e->renderer, glyph->texture, 0, &dstRect);
+bool handleKey(E *e, SDL_Keysym key) {
+  if (isModifierKey(key.sym)) {
+    // pressing a modifier doesn't abort a key sequence
+    return false;
+  }
+  Uint16 mod = normalizeKeyMod(key.mod);
+  E_Key *k = E_KeyMap_get(e->curKeys, key.sym, mod);
+  if (k) {
+    e->swallowTextInput = true;
+    if (k->hasMoreKeys) {
+      e->curKeys = k->keys;
+    } else {
+      e->curKeys = e->rootKeys;
+      e->lastKey = key;
+      runHandler(e, k->handler);
     }
+    return true;
+  }
+  if (e->curKeys != e->rootKeys && (mod & ~KMOD_SHIFT) == 0 && key.sym < 128 && isprint(key.sym)) {
+    // keys like '(' are typed with shift and a layout specific sym,
+    // resolve the sequence by the text the key produces
+    e->swallowTextInput = true;
+    return true;
   }
+  e->curKeys = e->rootKeys;
+  return false;
 }
 
-void renderLine(E *e, char *line, size_t size, int penX, int penY) {
-  char prev = 0;
-  for (int i = 0; i < size; i++) {
-    char c = line[i];
-    E_Glyph *glyph = getGlyph(e, c);
-    renderGlyph(e, glyph, penX, penY, false, false);
-    penX += glyph->advance;
-    if (prev) {
-      penX += getKerning(e, prev, c);
+// feeds text produced by a key press in a prefix layer to the key map
+void handlePrefixText(E *e, const char *text) {
+  for (const char *c = text; *c && e->curKeys != e->rootKeys; c++) {
+    E_Key *k = E_KeyMap_get(e->curKeys, (unsigned char) *c, 0);
+    if (!k) {
+      e->curKeys = e->rootKeys;
+    } else if (k->hasMoreKeys) {
+      e->curKeys = k->keys;
+    } else {
+      e->curKeys = e->rootKeys;
+      e->lastKey = (SDL_Keysym){.sym = (unsigned char) *c};
+      runHandler(e, k->handler);
     }
-    prev = c;
   }
 }
 
-void debugRender(E *e) {
-  SDL_SetRenderDrawColor(e->renderer, 0xff, 0xff, 0xff, 0xff);
-  SDL_RenderClear(e->renderer);
-
-  int penx = 300, peny = 400;
+void startMacro(E *e) {
+  buf_set_len(e->macro.recording, 0);
+  e->macro.isRecording = true;
+}
 
-  SDL_SetRenderDrawColor(e->renderer, 0x0, 0x0, 0xff, 0xff);
-  SDL_RenderDrawLine(e->renderer, penx, peny-50, penx, peny+50);
-  SDL_RenderDrawLine(e->renderer, penx - 50, peny, penx + 50, peny);
+void endMacro(E *e) {
+  if (!e->macro.isRecording) {
+    return;
+  }
+  MacroStep *steps = e->macro.steps;
+  e->macro.steps = e->macro.recording;
+  e->macro.recording = steps;
+  e->macro.isRecording = false;
+}
 
-  SDL_SetRenderDrawColor(e->renderer, 0x0, 0x0, 0x0, 0xff);
-  char *txt = "public static void Main() {}";
-  char prev = 0;
-  for (int i = 0; i < strlen(txt); i++) {
-    char c = txt[i];
-    E_Glyph *glyph = getGlyph(e, c);
-    renderGlyph(e, glyph, penx, peny, false, false);
-    penx += glyph->advance;
-    if (prev) {
-      penx += getKerning(e, prev, c);
+// Runs the last macro prefixArg times. Steps are applied back to back,
+// horizontal scroll is updated once at the end and the caller renders once.
+void executeMacro(E *e) {
+  if (e->macro.isRecording) {
+    return;
+  }
+  Uint64 traceStart = SDL_GetPerformanceCounter();
+  size_t count = e->prefixArg ? e->prefixArg : 1;
+  // the count isn't an argument of the steps
+  e->prefixArg = 0;
+  size_t stepCount = buf_len(e->macro.steps);
+  e->batchDepth++;
+  for (size_t n = 0; n < count; n++) {
+    for (size_t i = 0; i < stepCount; i++) {
+      MacroStep step = e->macro.steps[i];
+      if (step.handler) {
+        e->prefixArg = step.prefixArg;
+        step.handler(e);
+        e->prefixArg = 0;
+      } else {
+        insertCharAtCursor(e, step.c);
+      }
     }
-    prev = c;
   }
-  SDL_RenderPresent(e->renderer);
+  e->batchDepth--;
+  updateScreenLeftBorderOffsetX(e);
+  traceRecord("executeMacro", traceStart, count * stepCount);
 }
 
-void renderText(E *e) {
-  SDL_SetRenderDrawColor(e->renderer, 0xff, 0xff, 0xff, 0xff);
-  SDL_RenderClear(e->renderer);
-  int currentLine = getCurrentLineIndex(e);
-  int firstLine = e->visibleLineTop;
-  LineIter iter = createIter(e);
-  int penY = e->lineHeight;
-  int lineNum = 0;
-  char prev = 0;
-  int winHeight = e->textHeight;
-  int winWidth = e->width;
-  while (lineIterNext(&iter)) {
-    if (lineNum < firstLine) {
-      lineNum++;
-      continue;
-    }
+void digitArgument(E *e) {
+  e->prefixArg = e->prefixArg * 10 + (e->lastKey.sym - '0');
+}
 
-    int lineEnd = iter.lineStart + iter.lineLen;
-    int prevGlyphRightBorder = 0; // includes invisible glyphs to the left of screen left border
-    int penX = 0; // x offset where we put a char on a screen, can be negative for partially shown glyphs with start to the left of left screen border
-    bool firstVisibleGlyph = true; // whether we reached first visible glyph on the line
-    for (int i = iter.lineStart; i < lineEnd; i++) {
-      if (penX > winWidth) {
-        break;
-      }
-      char c = E_getChar(e, i);
-      E_Glyph *glyph = getGlyph(e, c);
-      int kerning = prev ? getKerning(e, prev, c) : 0;
-      int glyphLeftBorder = prevGlyphRightBorder + kerning;
-      int glyphRightBorder = glyphLeftBorder + glyph->advance;
-      if (glyphRightBorder < e->screenLeftBorderOffsetX) {
-        // whole glyph is before left screen border
-        prevGlyphRightBorder = glyphRightBorder;
-        prev = c;
-        continue;
+// SDL stamps events with millisecond ticks, shift the current perf counter
+// back by the time the event spent in the queue
+Uint64 getEventTime(E *e, SDL_Event *event) {
+  Uint64 now = SDL_GetPerformanceCounter();
+  Uint32 ticks = SDL_GetTicks();
+  Uint32 queuedMS = ticks > event->common.timestamp ? ticks - event->common.timestamp : 0;
+  Uint64 queued = queuedMS * e->perfCountFreqMS;
+  return now > queued ? now - queued : now;
+}
+
+// returns true if the editor has to be rendered after the event
+bool handleEvent(E *e, SDL_Event *event, SDL_Keymod modState, bool *justGainedFocus) {
+  bool render = false;
+  switch (event->type) {
+    case SDL_QUIT:
+      e->quit = true;
+      break;
+    case SDL_TEXTINPUT: {
+      if (e->swallowTextInput) {
+        e->swallowTextInput = false;
+        handlePrefixText(e, event->text.text);
+        render = true;
+      } else if (!(modState & KMOD_ALT)) {
+        size_t textLen = strlen(event->text.text);
+        for (size_t i = 0; i < textLen; i++) {
+          typeChar(e, event->text.text[i]);
+        }
+        render = true;
       }
-      if (firstVisibleGlyph) {
-        penX = glyphLeftBorder - e->screenLeftBorderOffsetX;
-        firstVisibleGlyph = false;
-      } else {
-        penX = penX + kerning;
+      break;
+    }
+    case SDL_KEYDOWN: {
+      SDL_Keycode keySym = event->key.keysym.sym;
+      if (!isModifierKey(keySym)) {
+        e->swallowTextInput = false;
+        stopScrollAnimation(e);
       }
-      bool withSelection = 0;
-      if (e->hasSelection) {
-        if (e->cursor > e->selectionStart && e->selectionStart <= i && i < e->cursor) {
-          withSelection = 1;
+      if (handleKey(e, event->key.keysym)) {
+        render = true;
+      } else if (keySym == SDLK_RETURN) {
+        typeChar(e, '\n');
+        render = true;
+      } else if (keySym == SDLK_TAB) {
+        // ignore tab if it is from alt-tab when we are about to loose or have just gained focus
+        if ((modState & KMOD_ALT) != 0 && !*justGainedFocus) {
+          typeChar(e, '\t');
+          render = true;
         }
-        if (e->cursor < e->selectionStart && e->cursor <= i && i < e->selectionStart) {
-          withSelection = 1;
+      } else if (modState & KMOD_CTRL) {
+        switch (keySym) {
+          case SDLK_r:
+            render = false;
+            debugRender(e);
+            break;
+          case SDLK_e:
+            render = true;
+            break;
         }
       }
-      renderGlyph(e, glyph, penX, penY, false, withSelection);
-      if (lineNum == currentLine && i == e->cursor) {
-        renderCursor(e, penX, penY);
-      }
-      penX += glyph->advance;
-      prevGlyphRightBorder = glyphRightBorder;
-      prev = c;
+      break;
     }
-    // space in the end of line to be able to continue it
-    if (penX < winWidth) {
-      if (lineNum == currentLine && lineEnd == e->cursor) {
-        renderCursor(e, penX, penY);
+    case SDL_MOUSEWHEEL:
+      startScrollAnimation(e, getWheelY(&event->wheel));
+      break;
+    case SDL_WINDOWEVENT: {
+      switch (event->window.event) {
+        case SDL_WINDOWEVENT_SIZE_CHANGED:
+          if (e->window) {
+            // in output pixels, the window may have moved to a display with another scale
+            updateDisplayScale(e);
+            handleResize(e, e->width, e->height);
+            startFontBuild(e);
+          } else {
+            handleResize(e, event->window.data1, event->window.data2);
+          }
+          render = true;
+          break;
+        case SDL_WINDOWEVENT_EXPOSED:
+          *justGainedFocus = false;
+          render = true;
+          break;
+        case SDL_WINDOWEVENT_FOCUS_GAINED:
+          *justGainedFocus = true;
+          break;
       }
-      renderGlyph(e, getGlyph(e, ' '), penX, penY, false, false);
-    }
-
-    if (penY > winHeight) {
       break;
     }
-    penY += e->lineHeight;
-    lineNum++;
+    case SDL_RENDER_TARGETS_RESET:
+      LineCache_clear(&e->lineCache);
+      render = true;
+      break;
   }
+  return render;
 }
 
-void renderStatusLine(E *e, Uint64 t0) {
-  SDL_SetRenderDrawColor(e->renderer, 0xdc, 0xdc, 0xdc, 0xff);
-  SDL_Rect statusLineRect = {0, e->height - e->statusLineHeight, e->width, e->statusLineHeight};
-  SDL_RenderFillRect(e->renderer, &statusLineRect);
-  SDL_SetRenderDrawColor(e->renderer, 0x0, 0x0, 0x0, 0xff);
-  SDL_RenderDrawLine(e->renderer, 0, e->height - e->statusLineHeight, e->width, e->height - e->statusLineHeight);
-  Uint64 t1 = SDL_GetPerformanceCounter();
-  double duration = (t1 - t0) * 1.0 / e->perfCountFreqMS;
-  if (duration > 1000) {
-    duration = 1000;
-  }
-
-  int lineIndex = 0;
-  int lineStart = 0;
-  fillCurrentLineAndOffset(e, &lineIndex, &lineStart);
-  int count = snprintf(e->lineBuf, 1000, "  %s (%d:%lu)   %.1fms", e->fileName, lineIndex+1, e->cursor - lineStart, duration);
-  renderLine(e, e->lineBuf, count, 0, e->height - e->statusLineBaselineOffset);
+bool isInputEvent(SDL_Event *event) {
+  return event->type == SDL_KEYDOWN || event->type == SDL_TEXTINPUT || event->type == SDL_MOUSEWHEEL;
 }
 
-void updateUI(E *e) {
-  Uint64 t0 = SDL_GetPerformanceCounter();
-  renderText(e);
-  renderStatusLine(e, t0);
-  SDL_RenderPresent(e->renderer);
+void writeRecordHeader(E *e, RecordKind kind, SDL_Keymod modState) {
+  Recorder *recorder = &e->recorder;
+  Uint64 now = SDL_GetPerformanceCounter();
+  Uint64 delta = recorder->lastTime ? getDurationUs(e, recorder->lastTime, now) : 0;
+  recorder->lastTime = now;
+  Uint8 kindByte = kind;
+  Uint32 delta32 = MIN(delta, UINT32_MAX);
+  Uint16 mod = modState;
+  fwrite(&kindByte, sizeof(kindByte), 1, recorder->file);
+  fwrite(&delta32, sizeof(delta32), 1, recorder->file);
+  fwrite(&mod, sizeof(mod), 1, recorder->file);
 }
 
-int getCursorOffsetX(E *e) {
-  size_t cursor = e->cursor;
-  if (cursor == 0) {
-    return 0;
+void recordEvent(E *e, SDL_Event *event, SDL_Keymod modState) {
+  FILE *file = e->recorder.file;
+  if (!file) {
+    return;
   }
-  size_t i = cursor - 1;
-  for (; i > 0; i--) {
-    if (E_getChar(e, i) == '\n') { // prev line end
-      i++;
+  switch (event->type) {
+    case SDL_TEXTINPUT: {
+      Uint8 len = strlen(event->text.text);
+      writeRecordHeader(e, RECORD_TEXT, modState);
+      fwrite(&len, sizeof(len), 1, file);
+      fwrite(event->text.text, 1, len, file);
       break;
     }
-  }
-  int result = 0;
-  char prev = 0;
-  for (; i <= cursor; i++) {
-    char c = E_getChar(e, i);
-    result += (prev ? getKerning(e, prev, c) : 0);
-    if (i < cursor) {
-      result += getGlyph(e, c)->advance;
-    }
-    prev = c;
-  }
-  return result;
-}
-
-void updateScreenLeftBorderOffsetX(E *e) {
-  char c = E_getChar(e, e->cursor);
-  char nextC = e->cursor < E_getTextLen(e) - 1 ? E_getChar(e, e->cursor + 1) : 0;
-  int cursorOffsetX = getCursorOffsetX(e);
-  int nextCharOffset = cursorOffsetX;
-  if (c == '\n') {
-    nextCharOffset += getGlyph(e, ' ')->advance;
-  } else {
-    int kerning = nextC ? getKerning(e, E_getChar(e, e->cursor), nextC) : 0;
-    nextCharOffset += getGlyph(e, c)->advance + kerning;
-  }
-  if ((nextCharOffset - e->screenLeftBorderOffsetX) > e->width) {
-    e->screenLeftBorderOffsetX = nextCharOffset - e->width;
-  } else if (cursorOffsetX < e->screenLeftBorderOffsetX) {
-    e->screenLeftBorderOffsetX = cursorOffsetX;
-  }
-}
-
-void insertCharAtCursor(E *e, char c) {
-  assert(0 <= e->cursor && e->cursor <= E_getTextLen(e));
-  insertChar(&e->buffer, e->cursor, c);
-
-  e->cursor++;
-  if (c == '\n') {
-    if (e->visibleLineCursor < e->visibleLineCount - 1) {
-      e->visibleLineCursor++;
-    } else {
-      e->visibleLineTop++;
-    }
-  }
-  e->hasSelection = 0;
-  updateScreenLeftBorderOffsetX(e);
-}
-
-void deleteCharAtCursor(E *e) {
-  assert(0 <= e->cursor && e->cursor <= E_getTextLen(e));
-  if (e->hasSelection) {
-    deleteRegion(&e->buffer, e->selectionStart, e->cursor);
-    if (e->cursor > e->selectionStart) {
-      e->cursor = e->selectionStart;
+    case SDL_KEYDOWN: {
+      Sint32 sym = event->key.keysym.sym;
+      Uint16 mod = event->key.keysym.mod;
+      writeRecordHeader(e, RECORD_KEY, modState);
+      fwrite(&sym, sizeof(sym), 1, file);
+      fwrite(&mod, sizeof(mod), 1, file);
+      break;
     }
-    e->hasSelection = 0;
-  } else {
-    deleteChar(&e->buffer, e->cursor);
-    if (e->cursor == E_getTextLen(e)) {
-      // cursor is at '\0' terminating the text, deleting it is noop
-      return;
+    case SDL_MOUSEWHEEL: {
+      float y = getWheelY(&event->wheel);
+      writeRecordHeader(e, RECORD_WHEEL_PRECISE, modState);
+      fwrite(&y, sizeof(y), 1, file);
+      break;
     }
-    e->hasSelection = 0;
-    e->cursor = MIN(e->cursor, E_getTextLen(e));
-  }
-}
-
-void deleteCharBackwards(E *e) {
-  if (e->hasSelection) {
-    deleteRegion(&e->buffer, e->selectionStart, e->cursor);
-    if (e->cursor > e->selectionStart) {
-      e->cursor = e->selectionStart;
+    case SDL_WINDOWEVENT: {
+      switch (event->window.event) {
+        case SDL_WINDOWEVENT_SIZE_CHANGED: {
+          Sint32 size[2] = {event->window.data1, event->window.data2};
+          writeRecordHeader(e, RECORD_RESIZE, modState);
+          fwrite(size, sizeof(size), 1, file);
+          break;
+        }
+        case SDL_WINDOWEVENT_EXPOSED:
+          writeRecordHeader(e, RECORD_EXPOSED, modState);
+          break;
+        case SDL_WINDOWEVENT_FOCUS_GAINED:
+          writeRecordHeader(e, RECORD_FOCUS_GAINED, modState);
+          break;
+      }
+      break;
     }
-    e->hasSelection = 0;
-  } else if (e->cursor > 0) {
-    deleteChar(&e->buffer, e->cursor - 1);
-    e->cursor = e->cursor - 1;
-    e->hasSelection = 0;
   }
 }
 
-void saveFile(E *e) {
-  FILE *file = fopen(e->path, "w+b");
+bool startRecording(E *e, const char *path) {
+  FILE *file = fopen(path, "wb");
   if (!file) {
-    die("Open file failed");
-  }
-  size_t w1 = fwrite(e->buffer.text, 1, e->buffer.gapStart, file);
-  size_t w2 = fwrite(&e->buffer.text[e->buffer.gapEnd], 1, e->buffer.bufferSize - e->buffer.gapEnd, file);
-  fclose(file);
-  if (w1 + w2 != E_getTextLen(e) + 1) {
-    die("Write failed");
+    return false;
   }
+  Uint32 version = RECORD_VERSION;
+  fwrite(RECORD_MAGIC, 1, 4, file);
+  fwrite(&version, sizeof(version), 1, file);
+  e->recorder.file = file;
+  return true;
 }
 
-void incVisibleLine(E *e) {
-  if (e->visibleLineCursor < e->visibleLineCount - 1) {
-    e->visibleLineCursor++;
-  } else {
-    bool hasMoreLines = false;
-    for (size_t i = e->cursor; i < E_getTextLen(e); i++) {
-      if (E_getChar(e, i) == '\n') {
-        hasMoreLines = true;
-        break;
-      }
-    }
-    if (hasMoreLines) {
-      e->visibleLineTop++;
-    }
-  }
+// $XDG_RUNTIME_DIR/e.sock, or /tmp/e-<uid>.sock if it is not set
+bool getServerAddress(struct sockaddr_un *address) {
+  *address = (struct sockaddr_un){.sun_family = AF_UNIX};
+  const char *runtimeDir = getenv("XDG_RUNTIME_DIR");
+  int len = runtimeDir && runtimeDir[0]
+            ? snprintf(address->sun_path, sizeof(address->sun_path), "%s/e.sock", runtimeDir)
+            : snprintf(address->sun_path, sizeof(address->sun_path), "/tmp/e-%d.sock", (int) getuid());
+  return len < sizeof(address->sun_path);
 }
 
-void decVisibleLine(E *e) {
-  if (e->visibleLineCursor > 0) {
-    e->visibleLineCursor--;
-  } else if (e->visibleLineTop > 0) {
-    e->visibleLineTop--;
+// returns a connected socket or -1
+int connectToServer(struct sockaddr_un *address) {
+  int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd < 0) {
+    return -1;
+  }
+  if (connect(fd, (struct sockaddr *) address, sizeof(*address)) < 0) {
+    close(fd);
+    return -1;
   }
+  return fd;
 }
 
-void moveToStartOfLine(E *e) {
-  if (e->cursor > 0) {
-    size_t i = e->cursor - 1;
-    while (1) {
-      if (E_getChar(e, i) == '\n' || i == 0) {
-        break;
-      }
-      i--;
+bool writeAll(int fd, const char *data, size_t size) {
+  while (size) {
+    ssize_t written = write(fd, data, size);
+    if (written < 0) {
+      return false;
     }
-    e->cursor = i == 0 ? i : i + 1;
-    updateScreenLeftBorderOffsetX(e);
-    e->desiredCursorOffsetX = 0;
+    data += written;
+    size -= written;
   }
+  return true;
 }
 
-void moveToEndOfLine(E *e) {
-  size_t textLen = E_getTextLen(e);
-  if (e->cursor < textLen) {
-    char c = E_getChar(e, e->cursor);
-    if (c == '\n') {
-      return;
+// reads until the peer shuts down its side or size bytes were read,
+// returns the number of bytes read or -1
+ssize_t readAll(int fd, char *data, size_t size) {
+  size_t total = 0;
+  while (total < size) {
+    ssize_t count = read(fd, data + total, size - total);
+    if (count < 0) {
+      return -1;
     }
-    size_t i = e->cursor;
-    for (; i < textLen; i++) {
-      if (E_getChar(e, i) == '\n') {
-        break;
-      }
+    if (count == 0) {
+      break;
     }
-    e->cursor = i;
-    updateScreenLeftBorderOffsetX(e);
-    e->desiredCursorOffsetX = 0;
+    total += count;
   }
+  return total;
 }
 
-void startSelection(E *e) {
-  e->selectionStart = e->cursor;
-  e->hasSelection = 1;
-}
-
-void escape(E *e) {
-  e->hasSelection = 0;
-}
-
-void copySelectionToKillRing(E *e) {
-  size_t start = MIN(e->selectionStart, e->cursor);
-  size_t end = MAX(e->selectionStart, e->cursor);
-  size_t selectionSize = end - start;
-  char *selection = xalloc(selectionSize);
-  size_t j = 0;
-  for (size_t i = start; i < end; i++) {
-    selection[j++] = E_getChar(e, i);
+// Listens for paths sent by e --client. The socket is polled from the event
+// loop, so the window, renderer and rasterized font stay warm between files.
+bool startServer(E *e) {
+  Server *server = &e->server;
+  if (!getServerAddress(&server->address)) {
+    setEditorError(e, "Server socket path is too long");
+    return false;
   }
-  KillRing_push(&e->killRing, selection, selectionSize);
-  e->hasSelection = 0;
-}
-
-void yank(E *e) {
-  KillRingEntry *entry = KillRing_getCurrentEntry(&e->killRing);
-  if (entry) {
-    for (size_t i = 0; i < entry->len; i++) {
-      insertCharAtCursor(e, entry->text[i]);
+  server->socket = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (server->socket < 0) {
+    setEditorError(e, "Failed to create server socket");
+    return false;
+  }
+  struct sockaddr *address = (struct sockaddr *) &server->address;
+  int result = bind(server->socket, address, sizeof(server->address));
+  if (result < 0 && errno == EADDRINUSE) {
+    int client = connectToServer(&server->address);
+    if (client >= 0) {
+      close(client);
+      close(server->socket);
+      setEditorError(e, "Server is already running");
+      return false;
     }
+    // socket file left by a server which didn't exit cleanly
+    unlink(server->address.sun_path);
+    result = bind(server->socket, address, sizeof(server->address));
   }
+  if (result < 0 || listen(server->socket, SOMAXCONN) < 0 ||
+      fcntl(server->socket, F_SETFL, O_NONBLOCK) < 0) {
+    close(server->socket);
+    setEditorError(e, "Failed to start server");
+    return false;
+  }
+  // a client which exits before reading the reply must not kill the editor
+  signal(SIGPIPE, SIG_IGN);
+  server->listening = true;
+  return true;
 }
 
-void moveLeft(E *e) {
-  if (e->cursor > 0) {
-    e->cursor--;
-    if (E_getChar(e, e->cursor) == '\n') {
-      decVisibleLine(e);
-    }
-    updateScreenLeftBorderOffsetX(e);
-    e->desiredCursorOffsetX = 0;
+void stopServer(E *e) {
+  if (e->server.listening) {
+    close(e->server.socket);
+    unlink(e->server.address.sun_path);
+    e->server.listening = false;
   }
 }
 
-void moveRight(E *e) {
-  if (e->cursor < E_getTextLen(e)) {
-    char c = E_getChar(e, e->cursor);
-    if (c == '\n') {
-      incVisibleLine(e);
+// Shows the document at path, opening it if it isn't open yet.
+// Returns false with errno set if the file can't be read.
+bool showPath(E *e, const char *path) {
+  // empty document of a server started without files, replaced by the first file
+  Document *placeholder = e->docs[0]->path ? 0 : e->docs[0];
+  Document *doc = 0;
+  for (size_t i = 0; i < buf_len(e->docs) && !doc; i++) {
+    if (e->docs[i]->path && strcmp(e->docs[i]->path, path) == 0) {
+      doc = e->docs[i];
     }
-    e->cursor++;
-    updateScreenLeftBorderOffsetX(e);
-    e->desiredCursorOffsetX = 0;
   }
+  if (!doc) {
+    doc = openDocument(path);
+    if (!doc) {
+      return false;
+    }
+    buf_push(e->docs, doc);
+  }
+  showDocument(e, doc);
+  if (placeholder) {
+    e->docs[0] = doc;
+    buf_hdr(e->docs)->len = 1;
+    freeDocument(placeholder);
+  }
+  return true;
 }
 
-void moveWordBackward(E *e) {
-  if (e->cursor > 0) {
-    size_t initial = e->cursor - 1;
-    size_t i = initial;
-    size_t decLines = 0;
-    // skip spaces backwards
-    for (; i <= initial; i--) {
-      char c = E_getChar(e, i);
-      if (isspace(c)) {
-        if (c == '\n') {
-          decLines++;
+// Serves pending client connections, a request is a list of '\0' terminated
+// absolute paths, the reply is empty on success or an error message.
+// Returns true if a document was shown.
+bool serveClients(E *e) {
+  if (!e->server.listening) {
+    return false;
+  }
+  bool shown = false;
+  int client;
+  while ((client = accept(e->server.socket, 0, 0)) >= 0) {
+    Uint64 traceStart = SDL_GetPerformanceCounter();
+    // accepted sockets are blocking, a stalled client must not freeze the editor
+    struct timeval timeout = {
+            .tv_sec = SERVER_RECEIVE_TIMEOUT_MS / 1000,
+            .tv_usec = SERVER_RECEIVE_TIMEOUT_MS % 1000 * 1000,
+    };
+    setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    static char request[SERVER_REQUEST_MAX];
+    char reply[PATH_MAX + 100] = "";
+    ssize_t size = readAll(client, request, sizeof(request));
+    size_t pathCount = 0;
+    if (size <= 0 || size == sizeof(request) || request[size - 1] != '\0') {
+      snprintf(reply, sizeof(reply), "Malformed request");
+    } else {
+      for (char *path = request; path < request + size; path += strlen(path) + 1) {
+        if (!showPath(e, path)) {
+          // the request bounds the path, not PATH_MAX
+          snprintf(reply, sizeof(reply), "%.*s: %s", (int) MIN(strlen(path), PATH_MAX), path, strerror(errno));
+          break;
         }
-      } else {
-        break; 
+        pathCount++;
+        shown = true;
       }
     }
-    for (; i <= initial; i--) {
-      if (isspace(E_getChar(e, i))) {
-        break;
-      }
+    writeAll(client, reply, strlen(reply));
+    close(client);
+    traceRecord("serveClient", traceStart, pathCount);
+  }
+  if (shown && e->window) {
+    SDL_ShowWindow(e->window);
+    SDL_RaiseWindow(e->window);
+  }
+  return shown;
+}
+
+// Sends paths to a running e --server, returns the exit status.
+// Paths are made absolute since the server runs in another directory.
+int runClient(char **paths, size_t pathCount) {
+  struct sockaddr_un address;
+  if (!getServerAddress(&address)) {
+    printf("Server socket path is too long\n");
+    return EXIT_FAILURE;
+  }
+  int server = connectToServer(&address);
+  if (server < 0) {
+    printf("No server is running at %s\n", address.sun_path);
+    return EXIT_FAILURE;
+  }
+  for (size_t i = 0; i < pathCount; i++) {
+    char absolutePath[PATH_MAX];
+    if (!realpath(paths[i], absolutePath)) {
+      perror(paths[i]);
+      close(server);
+      return EXIT_FAILURE;
     }
-    e->cursor = i + 1;
-    for (int j = 0; j < decLines; j++) {
-      decVisibleLine(e);
+    if (!writeAll(server, absolutePath, strlen(absolutePath) + 1)) {
+      perror("Failed to send request");
+      close(server);
+      return EXIT_FAILURE;
     }
-    updateScreenLeftBorderOffsetX(e);
-    e->desiredCursorOffsetX = 0;
   }
+  shutdown(server, SHUT_WR);
+  char reply[PATH_MAX + 100];
+  ssize_t size = readAll(server, reply, sizeof(reply) - 1);
+  close(server);
+  if (size < 0) {
+    perror("Failed to receive reply");
+    return EXIT_FAILURE;
+  }
+  if (size > 0) {
+    printf("%.*s\n", (int) size, reply);
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
 }
 
-void moveWordForward(E *e) {
-  size_t len = E_getTextLen(e);
-  if (e->cursor < len) {
-    size_t initial = e->cursor;
-    size_t i = initial;
-    size_t incLines = 0;
-    // skip spaces forward
-    for (; i <= len; i++) {
-      char c = E_getChar(e, i);
-      if (isspace(c)) {
-        if (c == '\n') {
-          incLines++;
+void runEditor(E *e) {
+  Uint64 frameStart = SDL_GetPerformanceCounter();
+  updateUI(e);
+  recordStartupPhase(e, STARTUP_FIRST_FRAME, frameStart);
+  printStartupProfile(e);
+  SDL_Event event;
+  while (!e->quit) {
+    int eventCount = 0;
+    SDL_StartTextInput();
+    bool justGainedFocus = false;
+    while (SDL_PollEvent(&event)) {
+      eventCount++;
+      Uint64 eventTime = getEventTime(e, &event);
+      SDL_Keymod modState = SDL_GetModState();
+      recordEvent(e, &event, modState);
+      if (handleEvent(e, &event, modState, &justGainedFocus)) {
+        if (isInputEvent(&event)) {
+          e->latency.eventTime = eventTime;
+          e->latency.handledTime = SDL_GetPerformanceCounter();
         }
-      } else {
-        break;
+        updateUI(e);
       }
     }
-    for (; i < len; i++) {
-      if (isspace(E_getChar(e, i))) {
-        break;
-      }
+    if (eventCount && e->recorder.file) {
+      writeRecordHeader(e, RECORD_BATCH_END, 0);
     }
-    e->cursor = i;
-    for (int j = 0; j < incLines; j++) {
-      incVisibleLine(e);
+    if (animateScroll(e)) {
+      updateUI(e);
     }
-    updateScreenLeftBorderOffsetX(e);
-    e->desiredCursorOffsetX = 0;
+    if (serveClients(e)) {
+      updateUI(e);
+    }
+    if (finishFontBuild(e)) {
+      updateUI(e);
+    }
+    if (!eventCount && highlightInBackground(e)) {
+      updateUI(e);
+    }
+    // hidden documents go idle without a document switch too
+    if (SDL_GetTicks() - e->lastCompactTicks > DOCUMENT_COMPACT_INTERVAL_MS) {
+      compactIdleDocuments(e);
+    }
+    SDL_Delay(1);
   }
 }
 
-void moveLineUp(E *e) {
-  int desiredCursorOffsetX = e->desiredCursorOffsetX;
-  if (!desiredCursorOffsetX) {
-    desiredCursorOffsetX = getCursorOffsetX(e);
-    e->desiredCursorOffsetX = desiredCursorOffsetX;
-  }
-  int i = e->cursor;
-  if (E_getChar(e, i) == '\n' && i > 0) {
-    i--;
+// reads the next recorded event, returns false at the end of the recording
+bool readRecord(FILE *file, RecordKind *kind, Uint32 *delta, SDL_Keymod *modState, SDL_Event *event) {
+  Uint8 kindByte = 0;
+  Uint16 mod = 0;
+  if (fread(&kindByte, sizeof(kindByte), 1, file) != 1 ||
+      fread(delta, sizeof(*delta), 1, file) != 1 ||
+      fread(&mod, sizeof(mod), 1, file) != 1) {
+    return false;
   }
-  int prevLineEnd = 0;
-  for (; i > 0; i--) {
-    if (E_getChar(e, i) == '\n') {
-      prevLineEnd = i;
+  *kind = kindByte;
+  *modState = mod;
+  *event = (SDL_Event){0};
+  switch (*kind) {
+    case RECORD_TEXT: {
+      Uint8 len = 0;
+      if (fread(&len, sizeof(len), 1, file) != 1 || len >= SDL_TEXTINPUTEVENT_TEXT_SIZE ||
+          fread(event->text.text, 1, len, file) != len) {
+        return false;
+      }
+      event->type = SDL_TEXTINPUT;
       break;
     }
-  }
-  int prevLineStart = 0;
-  if (prevLineEnd > 0) {
-    for (i = prevLineEnd - 1; i > 0; i--) {
-      if (E_getChar(e, i) == '\n') {
-        prevLineStart = i + 1;
-        break;
+    case RECORD_KEY: {
+      Sint32 sym = 0;
+      Uint16 keyMod = 0;
+      if (fread(&sym, sizeof(sym), 1, file) != 1 || fread(&keyMod, sizeof(keyMod), 1, file) != 1) {
+        return false;
       }
-    }
-  }
-  int offset = 0;
-  char prev = 0;
-  for (i = prevLineStart; i < prevLineEnd; i++) {
-    char c = E_getChar(e, i);
-    int next = offset + (prev ? getKerning(e, prev, c) : 0) + getGlyph(e, c)->advance;
-    if (next > desiredCursorOffsetX) {
+      event->type = SDL_KEYDOWN;
+      event->key.keysym.sym = sym;
+      event->key.keysym.mod = keyMod;
       break;
-    } else {
-      offset = next;
     }
-    prev = c;
-  }
-
-  e->cursor = i;
-  decVisibleLine(e);
-  updateScreenLeftBorderOffsetX(e);
-}
-
-void moveLineDown(E *e) {
-  int desiredCursorOffsetX = e->desiredCursorOffsetX;
-  if (!desiredCursorOffsetX) {
-    desiredCursorOffsetX = getCursorOffsetX(e);
-    e->desiredCursorOffsetX = desiredCursorOffsetX;
-  }
-  int i = e->cursor;
-  for (; i < E_getTextLen(e); i++) {
-    if (E_getChar(e, i) == '\n') {
-      i++;
+    case RECORD_RESIZE: {
+      Sint32 size[2];
+      if (fread(size, sizeof(size), 1, file) != 1) {
+        return false;
+      }
+      event->type = SDL_WINDOWEVENT;
+      event->window.event = SDL_WINDOWEVENT_SIZE_CHANGED;
+      event->window.data1 = size[0];
+      event->window.data2 = size[1];
       break;
     }
-  }
-  int offset = 0;
-  char prev = 0;
-  for (; i < E_getTextLen(e); i++) {
-    char c = E_getChar(e, i);
-    if (c == '\n') {
+    case RECORD_EXPOSED:
+      event->type = SDL_WINDOWEVENT;
+      event->window.event = SDL_WINDOWEVENT_EXPOSED;
       break;
-    }
-    int next = offset + (prev ? getKerning(e, prev, c) : 0) + getGlyph(e, c)->advance;
-    if (next > desiredCursorOffsetX) {
+    case RECORD_FOCUS_GAINED:
+      event->type = SDL_WINDOWEVENT;
+      event->window.event = SDL_WINDOWEVENT_FOCUS_GAINED;
+      break;
+    case RECORD_BATCH_END:
+      break;
+    case RECORD_WHEEL:
+    case RECORD_WHEEL_PRECISE: {
+      float y = 0;
+      if (*kind == RECORD_WHEEL) {
+        Sint32 lines = 0;
+        if (fread(&lines, sizeof(lines), 1, file) != 1) {
+          return false;
+        }
+        y = lines;
+      } else if (fread(&y, sizeof(y), 1, file) != 1) {
+        return false;
+      }
+      event->type = SDL_MOUSEWHEEL;
+      event->wheel.y = y;
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+      event->wheel.preciseY = y;
+#endif
       break;
-    } else {
-      offset = next;
     }
-    prev = c;
+    default:
+      return false;
   }
-  e->cursor = i;
-  incVisibleLine(e);
-  updateScreenLeftBorderOffsetX(e);
+  return true;
 }
 
-void handleResize(E *e, int w, int h) {
-  e->width = w;
-  e->height = h;
-  initVisibleLines(e);
+Uint64 getBufferChecksum(Buffer *buffer) {
+  // logical text without the trailing '\0', skipping the gap
+  size_t textSize = getTextSize(buffer);
+  size_t beforeGap = MIN(buffer->gapStart, textSize);
+  Uint64 hash = hashBytes(0xcbf29ce484222325ULL, buffer->text, beforeGap);
+  return hashBytes(hash, &buffer->text[buffer->gapEnd], textSize - beforeGap);
 }
 
-bool handleKey(E *e, SDL_Keysym key) {
-  size_t keysLen = buf_len(e->curKeys);
-  for (size_t i = 0; i < keysLen; i++) {
-    E_Key k = e->curKeys[i];
-    if (k.sym == key.sym && (k.mod == key.mod || k.mod & key.mod)) {
-      if (k.hasMoreKeys) {
-        e->curKeys = k.keys;
-      } else {
-        e->curKeys = e->rootKeys;
-        k.handler(e);
-      }
-      return true;
-    }
+// Feeds a recording made with --record into the editor as fast as possible
+// or with the recorded pacing, renders into an offscreen surface and reports
+// timing together with a checksum of the resulting text.
+bool replayEditor(E *e, const char *path, bool realtime) {
+  FILE *file = fopen(path, "rb");
+  if (!file) {
+    setEditorError(e, "Failed to open recording");
+    return false;
   }
-  e->curKeys = e->rootKeys;
-  return false;
-}
-
-void runEditor(E *e) {
+  char magic[4] = {0};
+  Uint32 version = 0;
+  if (fread(magic, 1, 4, file) != 4 || memcmp(magic, RECORD_MAGIC, 4) != 0 ||
+      fread(&version, sizeof(version), 1, file) != 1 || version != RECORD_VERSION) {
+    fclose(file);
+    setEditorError(e, "Not a recording");
+    return false;
+  }
+  Uint64 start = SDL_GetPerformanceCounter();
   updateUI(e);
+  recordStartupPhase(e, STARTUP_FIRST_FRAME, start);
+  printStartupProfile(e);
+  Uint64 due = start;
+  size_t eventCount = 0;
+  bool justGainedFocus = false;
+  RecordKind kind;
+  Uint32 delta;
+  SDL_Keymod modState;
   SDL_Event event;
-  while (!e->quit) {
-    int eventCount = 0;
-    SDL_StartTextInput();
-    bool justGainedFocus = false;
-    while (SDL_PollEvent(&event)) {
-      eventCount++;
-      bool render = false;
-      SDL_Keymod modState = SDL_GetModState();
-      switch (event.type) {
-        case SDL_QUIT:
-          e->quit = true;
-          break;
-        case SDL_TEXTINPUT: {
-          if (!(modState & KMOD_ALT)) {
-            size_t textLen = strlen(event.text.text);
-            for (size_t i = 0; i < textLen; i++) {
-              insertCharAtCursor(e, event.text.text[i]);
-            }
-            render = true;
-          }
-          break;
-        }
-        case SDL_KEYDOWN: {
-          SDL_Keycode keySym = event.key.keysym.sym;
-          if (handleKey(e, event.key.keysym)) {
-            render = true;
-          } else if (keySym == SDLK_RETURN) {
-            insertCharAtCursor(e, '\n');
-            render = true;
-          } else if (keySym == SDLK_TAB) {
-            // ignore tab if it is from alt-tab when we are about to loose or have just gained focus
-            if ((modState & KMOD_ALT) != 0 && !justGainedFocus) {
-              insertCharAtCursor(e, '\t');
-              render = true;
-            }
-          } else if (modState & KMOD_CTRL) {
-            switch (keySym) {
-              case SDLK_r:
-                render = false;
-                debugRender(e);
-                break;
-              case SDLK_e:
-                render = true;
-                break;
-            }
-          }
-          break;
-        }
-        case SDL_WINDOWEVENT: {
-          switch (event.window.event) {
-            case SDL_WINDOWEVENT_SIZE_CHANGED:
-              handleResize(e, event.window.data1, event.window.data2);
-              render = true;
-              break;
-            case SDL_WINDOWEVENT_EXPOSED:
-              justGainedFocus = false;
-              render = true;
-              break;
-            case SDL_WINDOWEVENT_FOCUS_GAINED:
-              justGainedFocus = true;
-              break;
-          }
-          break;
-        }
+  while (readRecord(file, &kind, &delta, &modState, &event)) {
+    if (realtime) {
+      due += delta * e->perfCountFreqMS / 1000;
+      Uint64 now = SDL_GetPerformanceCounter();
+      if (due > now) {
+        SDL_Delay(getDurationUs(e, now, due) / 1000);
       }
-      if (render) {
-        updateUI(e);
+    }
+    if (kind == RECORD_BATCH_END) {
+      justGainedFocus = false;
+      continue;
+    }
+    eventCount++;
+    Uint64 eventTime = SDL_GetPerformanceCounter();
+    if (handleEvent(e, &event, modState, &justGainedFocus)) {
+      if (isInputEvent(&event)) {
+        e->latency.eventTime = eventTime;
+        e->latency.handledTime = SDL_GetPerformanceCounter();
       }
+      updateUI(e);
     }
-    SDL_Delay(1);
+    if (e->view->scrollPending) {
+      finishScrollAnimation(e);
+      updateUI(e);
+    }
+  }
+  bool complete = feof(file);
+  fclose(file);
+  if (!complete) {
+    setEditorError(e, "Corrupted recording");
+    return false;
   }
+  Histogram *total = &e->latency.histograms[LATENCY_TOTAL];
+  printf("replayed %zu events in %.1fms, event to present p50=%" PRIu64 "us p99=%" PRIu64 "us max=%" PRIu64 "us\n",
+         eventCount, getDurationUs(e, start, SDL_GetPerformanceCounter()) / 1000.0,
+         Histogram_getPercentile(total, 50), Histogram_getPercentile(total, 99), total->max);
+  printf("text length %zu, checksum %016" PRIx64 "\n", E_getTextLen(e), getBufferChecksum(&e->doc->buffer));
+  return true;
 }
 
 
+#ifndef E_NO_MAIN
+// comma separated marker names of markerGlyphs or "none"
+bool parseMarkers(const char *list, Uint8 *markers) {
+  *markers = 0;
+  if (strcmp(list, "none") == 0) {
+    return true;
+  }
+  while (*list) {
+    size_t len = strcspn(list, ",");
+    int marker = 0;
+    while (marker < MARKER_COUNT &&
+           (strlen(markerGlyphs[marker].name) != len || strncmp(list, markerGlyphs[marker].name, len) != 0)) {
+      marker++;
+    }
+    if (marker == MARKER_COUNT) {
+      return false;
+    }
+    *markers |= 1 << marker;
+    list += len + (list[len] == ',');
+  }
+  return true;
+}
+
 int main(int argc, char **argv) {
-  if (argc != 2) {
-    die("Usage: e /path/to/file");
+  char *usage = "Usage: e [options] /path/to/file...\n"
+                "  --latency-dump FILE  write input latency histograms to FILE on exit\n"
+                "  --trace FILE         write trace spans to FILE on exit and on C-x C-t\n"
+                "  --record FILE        record input events to FILE\n"
+                "  --replay FILE        replay recorded input headlessly and report timing\n"
+                "  --realtime           replay with the recorded pacing instead of as fast as possible\n"
+                "  --server             keep running and open files sent with --client, files are optional\n"
+                "  --client             open files in the running server and exit\n"
+                "  --startup-profile    print the time spent in each startup phase\n"
+                "  --font FILE          use the TrueType font in FILE instead of the embedded one\n"
+                "  --markers LIST       mark tab, space (trailing), cr and control bytes in LIST or none,\n"
+                "                       cr,control by default, C-x m toggles tab,space\n"
+                "  --line-numbers       show line numbers left of the text, C-x n toggles them\n"
+                "  --line-cache         draw unchanged lines from a texture of rendered rows\n"
+                "  --framebuffer        draw on the CPU into a framebuffer uploaded to a texture, for software rendering";
+  char **paths = 0;
+  const char *latencyDumpPath = 0;
+  const char *recordPath = 0;
+  const char *replayPath = 0;
+  const char *fontPath = 0;
+  bool realtime = false;
+  bool server = false;
+  bool client = false;
+  bool startupProfile = false;
+  bool lineCache = false;
+  bool framebuffer = false;
+  Uint8 markers = MARKERS_DEFAULT;
+  bool lineNumbers = false;
+  for (int i = 1; i < argc; i++) {
+    char *arg = argv[i];
+    bool hasValue = i < argc - 1;
+    if (strcmp(arg, "--latency-dump") == 0 && hasValue) {
+      latencyDumpPath = argv[++i];
+    } else if (strcmp(arg, "--trace") == 0 && hasValue) {
+      trace.path = argv[++i];
+    } else if (strcmp(arg, "--record") == 0 && hasValue) {
+      recordPath = argv[++i];
+    } else if (strcmp(arg, "--replay") == 0 && hasValue) {
+      replayPath = argv[++i];
+    } else if (strcmp(arg, "--font") == 0 && hasValue) {
+      fontPath = argv[++i];
+    } else if (strcmp(arg, "--markers") == 0 && hasValue) {
+      if (!parseMarkers(argv[++i], &markers)) {
+        die(usage);
+      }
+    } else if (strcmp(arg, "--realtime") == 0) {
+      realtime = true;
+    } else if (strcmp(arg, "--server") == 0) {
+      server = true;
+    } else if (strcmp(arg, "--client") == 0) {
+      client = true;
+    } else if (strcmp(arg, "--startup-profile") == 0) {
+      startupProfile = true;
+    } else if (strcmp(arg, "--line-numbers") == 0) {
+      lineNumbers = true;
+    } else if (strcmp(arg, "--line-cache") == 0) {
+      lineCache = true;
+    } else if (strcmp(arg, "--framebuffer") == 0) {
+      framebuffer = true;
+    } else if (arg[0] != '-') {
+      buf_push(paths, arg);
+    } else {
+      die(usage);
+    }
   }
-  E e = init(argv[1]);
-  if (!initUI(&e)) {
+  if ((!paths && !server) || (recordPath && replayPath) || (server && (client || replayPath)) || (lineCache && framebuffer)) {
+    die(usage);
+  }
+  if (client) {
+    // no editor state is initialized, the server already has it
+    int status = runClient(paths, buf_len(paths));
+    buf_free(paths);
+    return status;
+  }
+  E e = init(paths, buf_len(paths));
+  buf_free(paths);
+  e.latency.dumpPath = latencyDumpPath;
+  e.startup.print = startupProfile;
+  e.lineCache.enabled = lineCache;
+  e.framebuffer.enabled = framebuffer;
+  e.markers = markers;
+  e.lineNumbers = lineNumbers;
+  if (fontPath && !loadFontFile(&e, fontPath)) {
     goto error;
   }
-  runEditor(&e);
+  if (replayPath) {
+    if (!initHeadlessUI(&e) || !replayEditor(&e, replayPath, realtime)) {
+      goto error;
+    }
+  } else {
+    if (!initUI(&e)) {
+      goto error;
+    }
+    if (recordPath && !startRecording(&e, recordPath)) {
+      setEditorError(&e, "Failed to open recording file");
+      goto error;
+    }
+    if (server && !startServer(&e)) {
+      goto error;
+    }
+    runEditor(&e);
+  }
+  if (e.latency.dumpPath) {
+    dumpLatency(&e, e.latency.dumpPath);
+  }
+  if (trace.path) {
+    saveTrace(&e);
+  }
   if (e.error) {
     goto error;
   }
@@ -1283,4 +5915,5 @@ int main(int argc, char **argv) {
   }
   closeEditor(&e);
   return EXIT_FAILURE;
-}
\ No newline at end of file
+}
+#endif
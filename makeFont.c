@@ -6,7 +6,7 @@ enum {
 
 int main(int argc, char **argv) {
   if (argc != 2) {
-    printf("Usage: makeFont /path/to/font/file\n");
+    printf("Usage: makeFont /path/to/font/file > font.h\n");
     return 1;
   }
   FILE *font = fopen(argv[1], "r+b");